@@ -16,6 +16,9 @@ limitations under the License.
 
 #include "linux_compression.h"
 #include "../../../microstack/ILibParsers.h"
+#include "../../zlib/zlib.h"
+
+extern unsigned int crc32(unsigned int crci, const unsigned char *buf, unsigned int len);
 
 #if defined(JPEGMAXBUF)
 	#define MAX_TILE_SIZE JPEGMAXBUF
@@ -23,10 +26,25 @@ limitations under the License.
 	#define MAX_TILE_SIZE 65500
 #endif
 
-unsigned char *jpeg_buffer = NULL;
-int jpeg_buffer_length = 0;
-char jpegLastError[JMSG_LENGTH_MAX];
+// Tiles can be encoded on several threads at once, so the output and work buffers belong to the calling thread
+__thread unsigned char *jpeg_buffer = NULL;
+__thread int jpeg_buffer_length = 0;
+__thread char jpegLastError[JMSG_LENGTH_MAX];
 JPEG_error_handler default_JPEG_error_handler = NULL;
+__thread unsigned char *png_rows = NULL;		// Filtered scanlines of the PNG being written, reused between tiles
+__thread size_t png_rows_size = 0;
+__thread z_stream *png_stream = NULL;			// Reset for every PNG, instead of allocating a new one
+__thread struct jpeg_compress_struct *jpeg_cinfo = NULL;	// Reused for every JPEG, along with its error and destination managers
+__thread struct jpeg_error_mgr *jpeg_jerr = NULL;
+__thread struct jpeg_destination_mgr *jpeg_dest = NULL;
+
+// Set by set_compression_output(), to encode into the caller's buffer instead of into a new jpeg_buffer
+__thread char **output_buffer = NULL;
+__thread size_t *output_size = NULL;
+__thread size_t output_offset = 0;
+
+#define PNG_PALETTE_SLOTS 1024		// Open addressing table used to build the palette, must be a power of 2 larger than PNG_MAX_COLORS
+#define PNG_COMPRESSION_LEVEL 3
 
 void jpeg_error_handler(j_common_ptr ptr)
 {
@@ -37,9 +55,48 @@ void jpeg_error_handler(j_common_ptr ptr)
 	exit(1);
 }
 
+// Images are encoded at the offset of the buffer, which is grown with realloc when they don't fit. jpeg_buffer then points
+// into the buffer, and must not be freed. Passing NULL goes back to encoding into a new jpeg_buffer for every image.
+void set_compression_output(char **buffer, size_t *size, size_t offset)
+{
+	output_buffer = buffer;
+	output_size = size;
+	output_offset = offset;
+	jpeg_buffer = NULL;
+	jpeg_buffer_length = 0;
+}
+
+// Returns where an image of up to length bytes can be written: at the offset of the output buffer when one is set, or else a new jpeg_buffer
+unsigned char *reserve_compression_output(size_t length)
+{
+	size_t size;
+
+	if (output_buffer == NULL)
+	{
+		if (jpeg_buffer != NULL) { free(jpeg_buffer); }
+		if ((jpeg_buffer = (unsigned char*)malloc(length)) == NULL) { ILIBCRITICALEXIT(254); }
+		return(jpeg_buffer);
+	}
+
+	if (*output_size < output_offset + length)
+	{
+		size = *output_size * 2 > output_offset + length ? *output_size * 2 : output_offset + length;
+		if ((*output_buffer = (char*)realloc(*output_buffer, size)) == NULL) { ILIBCRITICALEXIT(254); }
+		*output_size = size;
+	}
+	return((unsigned char*)*output_buffer + output_offset);
+}
+
 void init_destination(j_compress_ptr cinfo)
 {
 	JOCTET * next_output_byte;
+	if (output_buffer != NULL)
+	{
+		jpeg_buffer_length = 0;
+		cinfo->dest->next_output_byte = reserve_compression_output(MAX_BUFFER);
+		cinfo->dest->free_in_buffer = *output_size - output_offset;
+		return;
+	}
 	if (jpeg_buffer != NULL) { free(jpeg_buffer); }
 	if ((jpeg_buffer = malloc(MAX_BUFFER)) == NULL) { ILIBCRITICALEXIT(254); }
 	jpeg_buffer_length = 0;
@@ -52,6 +109,18 @@ boolean empty_output_buffer(j_compress_ptr cinfo)
 {
 	JOCTET * next_output_byte;
 
+	if (output_buffer != NULL)
+	{
+		// The whole output buffer is full, so double it
+		jpeg_buffer_length = (int)(*output_size - output_offset);
+		cinfo->dest->next_output_byte = reserve_compression_output(2 * (size_t)jpeg_buffer_length) + jpeg_buffer_length;
+		cinfo->dest->free_in_buffer = *output_size - output_offset - jpeg_buffer_length;
+#if MAX_TILE_SIZE > 0
+		if (jpeg_buffer_length > MAX_TILE_SIZE) return FALSE;
+#endif
+		return TRUE;
+	}
+
 	jpeg_buffer_length += MAX_BUFFER;
 	if ((jpeg_buffer = (unsigned char *)realloc(jpeg_buffer, jpeg_buffer_length + MAX_BUFFER)) == NULL) { ILIBCRITICALEXIT(254); }
 	next_output_byte = jpeg_buffer + jpeg_buffer_length;
@@ -68,6 +137,16 @@ void term_destination (j_compress_ptr cinfo)
 {
 	int remaining_buff_length = MAX_BUFFER - cinfo->dest->free_in_buffer;
 
+	if (output_buffer != NULL)
+	{
+		jpeg_buffer_length = (int)(*output_size - output_offset - cinfo->dest->free_in_buffer);
+		jpeg_buffer = (unsigned char*)*output_buffer + output_offset;
+#if MAX_TILE_SIZE > 0
+		if (jpeg_buffer_length > MAX_TILE_SIZE) { jpeg_buffer = NULL; }
+#endif
+		return;
+	}
+
 	jpeg_buffer_length += remaining_buff_length;
 
 #if MAX_TILE_SIZE > 0
@@ -85,50 +164,247 @@ void term_destination (j_compress_ptr cinfo)
 
 int write_JPEG_buffer(JSAMPLE * image_buffer, int image_width, int image_height, int quality)
 {
-	struct jpeg_compress_struct cinfo;
-	struct jpeg_error_mgr jerr;
+	struct jpeg_compress_struct *cinfo;
 	JSAMPROW row_pointer[1];
 	int row_stride;
 
-	cinfo.err = jpeg_std_error(&jerr);
-	if (default_JPEG_error_handler != NULL) { jerr.error_exit = jpeg_error_handler; }
+	// The compressor of this thread is created once, and reused for every image
+	if (jpeg_cinfo == NULL)
+	{
+		if ((jpeg_cinfo = (struct jpeg_compress_struct*)calloc(1, sizeof(struct jpeg_compress_struct))) == NULL) { ILIBCRITICALEXIT(254); }
+		if ((jpeg_jerr = (struct jpeg_error_mgr*)calloc(1, sizeof(struct jpeg_error_mgr))) == NULL) { ILIBCRITICALEXIT(254); }
+		if ((jpeg_dest = (struct jpeg_destination_mgr*)calloc(1, sizeof(struct jpeg_destination_mgr))) == NULL) { ILIBCRITICALEXIT(254); }
 
-	jpeg_create_compress(&cinfo);
-	cinfo.dest = (struct jpeg_destination_mgr *) malloc(sizeof(struct jpeg_destination_mgr));
-	cinfo.dest->init_destination = &init_destination;
-	cinfo.dest->empty_output_buffer = &empty_output_buffer;
-	cinfo.dest->term_destination = &term_destination;
+		jpeg_cinfo->err = jpeg_std_error(jpeg_jerr);
+		if (default_JPEG_error_handler != NULL) { jpeg_jerr->error_exit = jpeg_error_handler; }
 
-	cinfo.image_width = image_width;
-	cinfo.image_height = image_height;
-	cinfo.input_components = 3;
-	cinfo.in_color_space = JCS_RGB;
-	jpeg_set_defaults(&cinfo);
+		jpeg_create_compress(jpeg_cinfo);
+		jpeg_dest->init_destination = &init_destination;
+		jpeg_dest->empty_output_buffer = &empty_output_buffer;
+		jpeg_dest->term_destination = &term_destination;
+		jpeg_cinfo->dest = jpeg_dest;
+	}
+	cinfo = jpeg_cinfo;
+
+	cinfo->image_width = image_width;
+	cinfo->image_height = image_height;
+	cinfo->input_components = 3;
+	cinfo->in_color_space = JCS_RGB;
+	jpeg_set_defaults(cinfo);
 
 	// 4:4:4, 1x1 (no subsampling)
 	// The resolution of chrominance information (Cb & Cr) is preserved at the same rate as the luminance (Y) information
-	cinfo.comp_info[0].v_samp_factor = 1;
-	cinfo.comp_info[0].h_samp_factor = 1;
-	cinfo.comp_info[1].v_samp_factor = 1;
-	cinfo.comp_info[1].h_samp_factor = 1;
-	cinfo.comp_info[2].v_samp_factor = 1;
-	cinfo.comp_info[2].h_samp_factor = 1;
-
-	jpeg_set_quality(&cinfo, quality, TRUE);
-	jpeg_start_compress(&cinfo, TRUE);
+	cinfo->comp_info[0].v_samp_factor = 1;
+	cinfo->comp_info[0].h_samp_factor = 1;
+	cinfo->comp_info[1].v_samp_factor = 1;
+	cinfo->comp_info[1].h_samp_factor = 1;
+	cinfo->comp_info[2].v_samp_factor = 1;
+	cinfo->comp_info[2].h_samp_factor = 1;
+
+	jpeg_set_quality(cinfo, quality, TRUE);
+	jpeg_start_compress(cinfo, TRUE);
 	row_stride = image_width * 3;
 
-	while (cinfo.next_scanline < cinfo.image_height)
+	while (cinfo->next_scanline < cinfo->image_height)
 	{
-		row_pointer[0] = &image_buffer[cinfo.next_scanline * row_stride];
-		(void)jpeg_write_scanlines(&cinfo, row_pointer, 1);
+		row_pointer[0] = &image_buffer[cinfo->next_scanline * row_stride];
+		(void)jpeg_write_scanlines(cinfo, row_pointer, 1);
 	}
 
-	jpeg_finish_compress(&cinfo);
+	jpeg_finish_compress(cinfo);
 
-	free(cinfo.dest);
-	cinfo.dest = NULL;
-	jpeg_destroy_compress(&cinfo);
+	return 0;
+}
 
+// Makes sure png_rows can hold at least size bytes
+int png_reserve_rows(size_t size)
+{
+	if (png_rows_size < size)
+	{
+		if (png_rows != NULL) { free(png_rows); }
+		if ((png_rows = (unsigned char*)malloc(size)) == NULL) { png_rows_size = 0; return 1; }
+		png_rows_size = size;
+	}
 	return 0;
 }
+
+// Writes a 32 bit big endian value, which doesn't have to be aligned
+void png_write_uint32(unsigned char *output, unsigned int value)
+{
+	output[0] = (unsigned char)(value >> 24);
+	output[1] = (unsigned char)(value >> 16);
+	output[2] = (unsigned char)(value >> 8);
+	output[3] = (unsigned char)value;
+}
+
+// Finishes the chunk at the given position, whose data has already been written after the 8 byte header. Returns the size of the chunk.
+size_t png_write_chunk(unsigned char *chunk, const char *type, unsigned int length)
+{
+	unsigned int crc;
+
+	png_write_uint32(chunk, length);
+	memcpy_s(chunk + 4, 4, type, 4);
+	crc = crc32(0, chunk + 4, length + 4);
+	png_write_uint32(chunk + length + 8, crc);
+	return length + 12;
+}
+
+// Losslessly encodes an RGB image as a PNG into jpeg_buffer, the same way write_JPEG_buffer() does. Images with at most PNG_MAX_COLORS
+// colors are written with a palette, packed to 1, 2, 4 or 8 bits per pixel. If the image has more than maxcolors colors, nothing is
+// written and 1 is returned, unless maxcolors is 0, in which case the image is written in true color.
+int write_PNG_buffer(unsigned char * image_buffer, int image_width, int image_height, int maxcolors)
+{
+	unsigned int keys[PNG_PALETTE_SLOTS];
+	unsigned char values[PNG_PALETTE_SLOTS];
+	unsigned char palette[3 * PNG_MAX_COLORS];
+	unsigned int color, last = 0;
+	unsigned char index = 0, packed = 0, *pixel, *row;
+	int x, y, slot, colors = 0, depth = 8, perbyte, truecolor = maxcolors <= 0;
+	size_t rowbytes, headersize, offset;
+	z_stream *stream;
+
+	if (maxcolors <= 0 || maxcolors > PNG_MAX_COLORS) { maxcolors = PNG_MAX_COLORS; }
+	if (png_reserve_rows((size_t)image_height * (1 + image_width)) != 0) { ILIBCRITICALEXIT(254); }
+	memset(keys, 0, sizeof(keys));
+
+	// Build the palette, and write the index of every pixel as a 8 bit scanline
+	pixel = image_buffer;
+	for (y = 0; y < image_height && colors <= maxcolors; y++)
+	{
+		row = png_rows + ((size_t)y * (1 + image_width));
+		row[0] = 0;										// Filter: None
+		for (x = 0; x < image_width; x++, pixel += 3)
+		{
+			color = 0x01000000 | (pixel[0] << 16) | (pixel[1] << 8) | pixel[2];
+			if (color != last)
+			{
+				slot = (int)((color * 0x9E3779B1) >> 22) & (PNG_PALETTE_SLOTS - 1);
+				while (keys[slot] != 0 && keys[slot] != color) { slot = (slot + 1) & (PNG_PALETTE_SLOTS - 1); }
+				if (keys[slot] == 0)
+				{
+					if (++colors > maxcolors) { break; }
+					keys[slot] = color;
+					values[slot] = (unsigned char)(colors - 1);
+					memcpy_s(palette + (3 * (colors - 1)), sizeof(palette) - (3 * (colors - 1)), pixel, 3);
+				}
+				last = color;
+				index = values[slot];
+			}
+			row[1 + x] = index;
+		}
+	}
+
+	if (colors > maxcolors)
+	{
+		if (!truecolor) { return 1; }
+
+		// True color, with the Sub filter
+		colors = 0;
+		depth = 8;
+		rowbytes = (size_t)image_width * 3;
+		if (png_reserve_rows((size_t)image_height * (1 + rowbytes)) != 0) { ILIBCRITICALEXIT(254); }
+		for (y = 0; y < image_height; y++)
+		{
+			row = png_rows + ((size_t)y * (1 + rowbytes));
+			pixel = image_buffer + ((size_t)y * rowbytes);
+			row[0] = 1;									// Filter: Sub
+			memcpy_s(row + 1, rowbytes, pixel, 3);
+			for (x = 3; x < (int)rowbytes; x++) { row[1 + x] = (unsigned char)(pixel[x] - pixel[x - 3]); }
+		}
+	}
+	else
+	{
+		// Pack the scanlines in place, when the palette is small enough for fewer bits per pixel
+		depth = colors <= 2 ? 1 : (colors <= 4 ? 2 : (colors <= 16 ? 4 : 8));
+		perbyte = 8 / depth;
+		rowbytes = ((size_t)image_width + perbyte - 1) / perbyte;
+		if (depth < 8)
+		{
+			for (y = 0; y < image_height; y++)
+			{
+				unsigned char *input = png_rows + ((size_t)y * (1 + image_width)) + 1;
+				row = png_rows + ((size_t)y * (1 + rowbytes));
+				row[0] = 0;
+				for (x = 0; x < image_width; x++)
+				{
+					if (x % perbyte == 0) { packed = 0; }
+					packed |= (unsigned char)(input[x] << (8 - (depth * ((x % perbyte) + 1))));
+					if (x % perbyte == perbyte - 1 || x == image_width - 1) { row[1 + (x / perbyte)] = packed; }
+				}
+			}
+		}
+	}
+
+	// The deflate stream of this thread is created once, and reset for every image
+	if (png_stream == NULL)
+	{
+		if ((png_stream = (z_stream*)calloc(1, sizeof(z_stream))) == NULL) { ILIBCRITICALEXIT(254); }
+		if (deflateInit(png_stream, PNG_COMPRESSION_LEVEL) != Z_OK) { ILIBCRITICALEXIT(254); }
+	}
+	else
+	{
+		deflateReset(png_stream);
+	}
+	stream = png_stream;
+
+	// Signature, IHDR and PLTE, followed by IDAT and IEND
+	headersize = 8 + 25 + (colors > 0 ? 12 + (3 * colors) : 0);
+	jpeg_buffer = reserve_compression_output(headersize + 12 + deflateBound(stream, (uLong)(image_height * (1 + rowbytes))) + 12);
+
+	memcpy_s(jpeg_buffer, 8, "\x89PNG\r\n\x1a\n", 8);
+	png_write_uint32(jpeg_buffer + 16, (unsigned int)image_width);
+	png_write_uint32(jpeg_buffer + 20, (unsigned int)image_height);
+	jpeg_buffer[24] = (unsigned char)depth;				// Bit depth
+	jpeg_buffer[25] = colors > 0 ? 3 : 2;				// Color type: Indexed, or RGB
+	jpeg_buffer[26] = 0;								// Compression: Deflate
+	jpeg_buffer[27] = 0;								// Filter method: Adaptive
+	jpeg_buffer[28] = 0;								// Interlace: None
+	offset = 8 + png_write_chunk(jpeg_buffer + 8, "IHDR", 13);
+	if (colors > 0)
+	{
+		memcpy_s(jpeg_buffer + offset + 8, 3 * colors, palette, 3 * colors);
+		offset += png_write_chunk(jpeg_buffer + offset, "PLTE", 3 * colors);
+	}
+
+	stream->next_in = png_rows;
+	stream->avail_in = (uInt)(image_height * (1 + rowbytes));
+	stream->next_out = jpeg_buffer + offset + 8;
+	stream->avail_out = (uInt)deflateBound(stream, stream->avail_in);
+	if (deflate(stream, Z_FINISH) != Z_STREAM_END) { ILIBCRITICALEXIT(254); }
+	offset += png_write_chunk(jpeg_buffer + offset, "IDAT", (unsigned int)stream->total_out);
+	offset += png_write_chunk(jpeg_buffer + offset, "IEND", 0);
+	jpeg_buffer_length = (int)offset;
+
+#if MAX_TILE_SIZE > 0
+	if (jpeg_buffer_length > MAX_TILE_SIZE)
+	{
+		if (output_buffer == NULL) { free(jpeg_buffer); }
+		jpeg_buffer = NULL;
+	}
+#endif
+
+	return 0;
+}
+
+// Frees the scanlines, compressor and deflate stream that the calling thread keeps between images
+void free_compression_buffers()
+{
+	if (png_rows != NULL) { free(png_rows); png_rows = NULL; }
+	png_rows_size = 0;
+	if (png_stream != NULL)
+	{
+		deflateEnd(png_stream);
+		free(png_stream);
+		png_stream = NULL;
+	}
+	if (jpeg_cinfo != NULL)
+	{
+		jpeg_destroy_compress(jpeg_cinfo);
+		free(jpeg_cinfo);
+		free(jpeg_jerr);
+		free(jpeg_dest);
+		jpeg_cinfo = NULL;
+		jpeg_jerr = NULL;
+		jpeg_dest = NULL;
+	}
+}
@@ -28,10 +28,14 @@ limitations under the License.
 #endif
 
 #define MAX_BUFFER  22528 // 22 KiB should be fine.
+#define PNG_MAX_COLORS 256	// Largest palette of a PNG tile
 
 typedef void(*JPEG_error_handler)(char *msg);
 
 extern int write_JPEG_buffer (JSAMPLE * image_buffer, int image_width, int image_height, int quality);
+extern int write_PNG_buffer (unsigned char * image_buffer, int image_width, int image_height, int maxcolors);
+extern void set_compression_output(char **buffer, size_t *size, size_t offset);
+extern void free_compression_buffers();
 extern JPEG_error_handler default_JPEG_error_handler;
 
 #endif // LINUX_COMPRESSION_H_ 
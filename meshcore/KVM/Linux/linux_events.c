@@ -17,6 +17,12 @@ limitations under the License.
 #include "linux_events.h"
 #include "microstack/ILibParsers.h"
 #include "meshcore/meshdefines.h"
+#if !defined(_FREEBSD)
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <linux/uinput.h>
+#include <dlfcn.h>
+#endif
 
 
 
@@ -31,6 +37,33 @@ extern xkb_struct *xkb_exports;
 extern x11_struct *x11_exports;
 extern FILE *logFile;
 extern int slave2master[2];
+extern int g_enableEvents;
+extern int SCREEN_NUM;
+extern int SCREEN_WIDTH;
+extern int SCREEN_HEIGHT;
+
+int g_uinputKeyboard = -1;		// Virtual keyboard and absolute pointer, used instead of XTest when kvm_uinput_create() succeeds
+int g_uinputPointer = -1;
+int g_uinputScreens = 0;		// The pointer spans the whole X server, so it's only used when the server has a single screen
+
+#define KVM_UINPUT_KEYBOARD_NAME	"MeshAgent Virtual Keyboard"
+#define KVM_UINPUT_POINTER_NAME		"MeshAgent Virtual Pointer"
+#define KVM_UINPUT_ATTACH_TRIES		20			// How many times to look for the devices, 100ms apart, while the X server adds them
+#define KVM_XI_ALL_DEVICES			0
+#define KVM_XI_SLAVE_POINTER		3
+#define KVM_XI_SLAVE_KEYBOARD		4
+
+// Same layout as XIDeviceInfo, so that the XInput2 headers aren't needed to build the KVM
+typedef struct kvm_xi_device_info
+{
+	int deviceid;
+	char *name;
+	int use;
+	int attachment;
+	Bool enabled;
+	int num_classes;
+	void **classes;
+}kvm_xi_device_info;
 
 #define g_keyboardMapCount 8
 int g_keyboardMap[g_keyboardMapCount] = { 0 };
@@ -135,6 +168,155 @@ static struct keymap_t g_keymap[] = {
 	{ XK_apostrophe,	   VK_OEM_7 }
 };
 
+#if !defined(_FREEBSD)
+// Keys that logind or the kernel act on by themselves, which must never be pressed from a virtual keyboard
+static int kvm_uinput_allowed_key(int code)
+{
+	if (code <= KEY_RESERVED || code >= 248) { return(0); }
+	switch (code)
+	{
+		case KEY_POWER:
+		case KEY_SLEEP:
+		case KEY_WAKEUP:
+		case KEY_SUSPEND:
+		case KEY_BATTERY:
+		case KEY_BLUETOOTH:
+		case KEY_WLAN:
+		case KEY_RFKILL:
+			return(0);
+		default:
+			return(1);
+	}
+}
+
+static int kvm_uinput_setup(int fd, char *name, int absolute)
+{
+	struct uinput_user_dev dev;
+	int code;
+
+	// uinput_user_dev is used instead of UI_DEV_SETUP, to support kernels older than 4.5
+	memset(&dev, 0, sizeof(dev));
+	strcpy_s(dev.name, UINPUT_MAX_NAME_SIZE, name);
+	dev.id.bustype = BUS_VIRTUAL;
+	dev.id.version = 1;
+
+	if (ioctl(fd, UI_SET_EVBIT, EV_SYN) < 0 || ioctl(fd, UI_SET_EVBIT, EV_KEY) < 0) { return(-1); }
+	if (absolute)
+	{
+		if (ioctl(fd, UI_SET_EVBIT, EV_ABS) < 0 || ioctl(fd, UI_SET_EVBIT, EV_REL) < 0) { return(-1); }
+		if (ioctl(fd, UI_SET_ABSBIT, ABS_X) < 0 || ioctl(fd, UI_SET_ABSBIT, ABS_Y) < 0 || ioctl(fd, UI_SET_RELBIT, REL_WHEEL) < 0) { return(-1); }
+		if (ioctl(fd, UI_SET_KEYBIT, BTN_LEFT) < 0 || ioctl(fd, UI_SET_KEYBIT, BTN_RIGHT) < 0 || ioctl(fd, UI_SET_KEYBIT, BTN_MIDDLE) < 0) { return(-1); }
+		dev.absmax[ABS_X] = KVM_UINPUT_ABS_MAX;
+		dev.absmax[ABS_Y] = KVM_UINPUT_ABS_MAX;
+	}
+	else
+	{
+		// Every key that an X keycode can refer to, because KeyAction() looks keys up in the current X keymap
+		for (code = 0; code < 248; ++code)
+		{
+			if (kvm_uinput_allowed_key(code) && ioctl(fd, UI_SET_KEYBIT, code) < 0) { return(-1); }
+		}
+	}
+
+	if (write(fd, &dev, sizeof(dev)) != sizeof(dev)) { return(-1); }
+	return(ioctl(fd, UI_DEV_CREATE));
+}
+
+// Returns 1 once the X server has added both virtual devices, attached to its core keyboard and pointer. Servers that don't
+// hotplug input devices, such as Xvfb, Xvnc, xrdp, or a server with AutoAddDevices off, never do, and would drop the input.
+static int kvm_uinput_attached(Display *display)
+{
+	static void *xi_lib = NULL;		// Never unloaded, because libXi hooks into the display when it's first used
+	int(*QueryVersion)(Display *d, int *major, int *minor);
+	kvm_xi_device_info*(*QueryDevice)(Display *d, int deviceid, int *count);
+	void(*FreeDeviceInfo)(kvm_xi_device_info *info);
+	kvm_xi_device_info *devices;
+	int opcode, event, error, major = 2, minor = 0, count, i, tries, found = 0;
+
+	if (!x11_exports->XQueryExtension(display, "XInputExtension", &opcode, &event, &error)) { return(0); }
+	if (xi_lib == NULL && (xi_lib = dlopen("libXi.so.6", RTLD_NOW)) == NULL && (xi_lib = dlopen("libXi.so", RTLD_NOW)) == NULL) { return(0); }
+	QueryVersion = (int(*)(Display*, int*, int*))dlsym(xi_lib, "XIQueryVersion");
+	QueryDevice = (kvm_xi_device_info*(*)(Display*, int, int*))dlsym(xi_lib, "XIQueryDevice");
+	FreeDeviceInfo = (void(*)(kvm_xi_device_info*))dlsym(xi_lib, "XIFreeDeviceInfo");
+	if (QueryVersion == NULL || QueryDevice == NULL || FreeDeviceInfo == NULL || QueryVersion(display, &major, &minor) != Success) { return(0); }
+
+	// The server adds the devices asynchronously, after udev has announced them
+	for (tries = 0; tries < KVM_UINPUT_ATTACH_TRIES && found != 3; ++tries)
+	{
+		if (tries > 0) { usleep(100000); }
+		if ((devices = QueryDevice(display, KVM_XI_ALL_DEVICES, &count)) == NULL) { continue; }
+		for (i = 0; i < count; ++i)
+		{
+			if (!devices[i].enabled || devices[i].name == NULL) { continue; }
+			if (devices[i].use == KVM_XI_SLAVE_KEYBOARD && strcmp(devices[i].name, KVM_UINPUT_KEYBOARD_NAME) == 0) { found |= 1; }
+			if (devices[i].use == KVM_XI_SLAVE_POINTER && strcmp(devices[i].name, KVM_UINPUT_POINTER_NAME) == 0) { found |= 2; }
+		}
+		FreeDeviceInfo(devices);
+	}
+	return(found == 3);
+}
+
+// Writes a batch of events, followed by a SYN_REPORT, with a single write()
+static int kvm_uinput_write(int fd, struct input_event *events, int count)
+{
+	memset(&(events[count]), 0, sizeof(struct input_event));
+	events[count].type = EV_SYN;
+	events[count].code = SYN_REPORT;
+	++count;
+	return(write(fd, events, count * sizeof(struct input_event)) == (ssize_t)(count * sizeof(struct input_event)) ? 0 : -1);
+}
+
+static void kvm_uinput_event(struct input_event *event, int type, int code, int value)
+{
+	memset(event, 0, sizeof(struct input_event));
+	event->type = (unsigned short)type;
+	event->code = (unsigned short)code;
+	event->value = value;
+}
+#endif
+
+// Opens /dev/uinput. Must be called before the KVM process drops its privileges, because the device is normally only writable by root.
+void kvm_uinput_open()
+{
+#if !defined(_FREEBSD)
+	if (g_uinputKeyboard < 0) { g_uinputKeyboard = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC); }
+	if (g_uinputPointer < 0) { g_uinputPointer = open("/dev/uinput", O_WRONLY | O_NONBLOCK | O_CLOEXEC); }
+	if (logFile) { fprintf(logFile, "kvm_uinput_open(): %s\n", g_uinputKeyboard >= 0 && g_uinputPointer >= 0 ? "OK" : strerror(errno)); fflush(logFile); }
+#endif
+}
+
+// Creates the virtual keyboard and pointer on the descriptors from kvm_uinput_open(), and waits for the X server to add them.
+// Returns 0 on success, or else destroys them, so that XTest is used instead.
+int kvm_uinput_create(Display *display)
+{
+#if !defined(_FREEBSD)
+	if (g_uinputKeyboard >= 0 && g_uinputPointer >= 0 &&
+		kvm_uinput_setup(g_uinputKeyboard, KVM_UINPUT_KEYBOARD_NAME, 0) == 0 &&
+		kvm_uinput_setup(g_uinputPointer, KVM_UINPUT_POINTER_NAME, 1) == 0)
+	{
+		if (kvm_uinput_attached(display))
+		{
+			g_uinputScreens = x11_exports->XScreenCount(display);
+			if (logFile) { fprintf(logFile, "Using uinput for input injection\n"); fflush(logFile); }
+			return(0);
+		}
+		if (logFile) { fprintf(logFile, "X server did not add the uinput devices, using XTest\n"); fflush(logFile); }
+	}
+#endif
+	kvm_uinput_destroy();
+	return(-1);
+}
+
+void kvm_uinput_destroy()
+{
+#if !defined(_FREEBSD)
+	if (g_uinputKeyboard >= 0) { ioctl(g_uinputKeyboard, UI_DEV_DESTROY); close(g_uinputKeyboard); }
+	if (g_uinputPointer >= 0) { ioctl(g_uinputPointer, UI_DEV_DESTROY); close(g_uinputPointer); }
+#endif
+	g_uinputKeyboard = -1;
+	g_uinputPointer = -1;
+}
+
 void MouseAction(double absX, double absY, int button, short wheel, Display *display)
 {
 	if (change_display) {
@@ -146,6 +328,39 @@ void MouseAction(double absX, double absY, int button, short wheel, Display *dis
 		return;
 	}
 
+#if !defined(_FREEBSD)
+	if (g_uinputPointer >= 0 && SCREEN_NUM == 0 && g_uinputScreens == 1 && SCREEN_WIDTH > 1 && SCREEN_HEIGHT > 1)
+	{
+		// The move, and the button or wheel, are written together, as two reports so the button lands at the new position
+		struct input_event events[6];
+		int count = 0;
+
+		kvm_uinput_event(&events[count++], EV_ABS, ABS_X, (int)(absX * KVM_UINPUT_ABS_MAX / (SCREEN_WIDTH - 1)));
+		kvm_uinput_event(&events[count++], EV_ABS, ABS_Y, (int)(absY * KVM_UINPUT_ABS_MAX / (SCREEN_HEIGHT - 1)));
+		kvm_uinput_event(&events[count++], EV_SYN, SYN_REPORT, 0);
+		switch (button)
+		{
+			case MOUSEEVENTF_LEFTDOWN:
+			case MOUSEEVENTF_LEFTUP:
+				kvm_uinput_event(&events[count++], EV_KEY, BTN_LEFT, button == MOUSEEVENTF_LEFTDOWN);
+				break;
+			case MOUSEEVENTF_RIGHTDOWN:
+			case MOUSEEVENTF_RIGHTUP:
+				kvm_uinput_event(&events[count++], EV_KEY, BTN_RIGHT, button == MOUSEEVENTF_RIGHTDOWN);
+				break;
+			case MOUSEEVENTF_MIDDLEDOWN:
+			case MOUSEEVENTF_MIDDLEUP:
+				kvm_uinput_event(&events[count++], EV_KEY, BTN_MIDDLE, button == MOUSEEVENTF_MIDDLEDOWN);
+				break;
+			default:
+				if (button == 0 && wheel != 0) { kvm_uinput_event(&events[count++], EV_REL, REL_WHEEL, wheel > 0 ? 1 : -1); }
+				break;
+		}
+		if (kvm_uinput_write(g_uinputPointer, events, count) == 0 || !g_enableEvents) { return; }
+	}
+#endif
+	if (!g_enableEvents) { return; }
+
 	if (!x11tst_exports->XTestFakeMotionEvent(display, -1, absX, absY, CurrentTime )) { return; }
 
 	if (button != 0) {
@@ -254,7 +469,20 @@ void KeyAction(unsigned char vk, int up, Display *display)
 	}
 
 	//printf("%x %x %d %d\n", keysym, vk, keycode, up);
-	if (keycode != 0) 
+#if !defined(_FREEBSD)
+	// X keycodes are the kernel's key codes plus 8
+	if (keycode != 0 && g_uinputKeyboard >= 0 && kvm_uinput_allowed_key(keycode - 8))
+	{
+		struct input_event events[2];
+		kvm_uinput_event(&events[0], EV_KEY, keycode - 8, !up);
+		if (kvm_uinput_write(g_uinputKeyboard, events, 1) == 0)
+		{
+			if (vk == VK_SHIFT) { SHIFT_STATE = !up; }
+			return;
+		}
+	}
+#endif
+	if (keycode != 0 && g_enableEvents) 
 	{
 		//ILIBLOGMESSAGEX("VK: %u [%d]", vk, up);
 
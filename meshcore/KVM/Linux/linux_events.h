@@ -436,6 +436,14 @@ struct keymap_t {
   unsigned char vk;
 };
 
+#define KVM_UINPUT_ABS_MAX 32767	// Range of the virtual pointer's axes, which X scales to the size of the screen
+
+extern int g_uinputKeyboard;
+extern int g_uinputPointer;
+
+extern void kvm_uinput_open();
+extern int kvm_uinput_create(Display *display);
+extern void kvm_uinput_destroy();
 extern void MouseAction(double absX, double absY, int button, short wheel, Display *display);
 extern void KeyAction(unsigned char vk, int up, Display *display);
 extern void KeyActionUnicode(uint16_t unicode, int up, Display *display);
@@ -101,13 +101,23 @@ typedef struct _XkbStateNotifyEvent
 	char 			req_minor;			/* Minor opcode of request */
 } XkbStateNotifyEvent;
 
+// Tile messages are batched up to this size before being written to the agent, and the pipe is sized to hold a full batch
+#define KVM_PIPE_BUFFER_SIZE 262144
+#define KVM_MAX_WORKERS 16		// Most threads that hash and encode tiles, including the mainloop
+#if defined(__linux__) && !defined(F_SETPIPE_SZ)
+	#define F_SETPIPE_SZ 1031
+#endif
+
 int curcursor = KVM_MouseCursor_HELP;
 int SLAVELOG = 0;
+int KVM_UINPUT = 0;		// Inject input with a uinput keyboard and pointer instead of XTest, when /dev/uinput can be opened and the X server adds the devices
 
 int SCREEN_NUM = 0;
 int SCREEN_WIDTH = 0;
 int SCREEN_HEIGHT = 0;
 int SCREEN_DEPTH = 0;
+int SCALED_WIDTH = 0;
+int SCALED_HEIGHT = 0;
 int TILE_WIDTH = 0;
 int TILE_HEIGHT = 0;
 int TILE_WIDTH_COUNT = 0;
@@ -116,7 +126,7 @@ int COMPRESSION_RATIO = 0;
 int SCALING_FACTOR = 1024;		// Scaling factor, 1024 = 100%
 int SCALING_FACTOR_NEW = 1024;	// Desired scaling factor, 1024 = 100%
 int FRAME_RATE_TIMER = 0;
-struct tileInfo_t **g_tileInfo = NULL;
+struct tileInfo_t g_tileInfo = { NULL, NULL, NULL, 0 };
 pthread_t kvmthread = (pthread_t)NULL;
 Display *eventdisplay = NULL;
 int g_remotepause = 0;
@@ -137,7 +147,10 @@ extern int gRemoteMouseRenderDefault;
 
 int remoteMouseX = 0, remoteMouseY = 0;
 
-extern void* tilebuffer;
+extern void* scalebuffer;
+extern int scalebuffersize;
+extern int COPY_RECT_ENABLED;
+extern uint64_t *rowhashes;
 extern char **environ;
 struct timespec inputtime;
 uint32_t inputcounter = 0;
@@ -164,6 +177,48 @@ typedef struct xfixes_struct
 	void*(*XFixesGetCursorImageAndName)(Display *d);
 }xfixes_struct;
 xfixes_struct *xfixes_exports = NULL;
+
+// Same layout as XRRMonitorInfo
+typedef struct kvm_monitor_info
+{
+	Atom name;
+	Bool primary;
+	Bool automatic;
+	int noutput;
+	int x;
+	int y;
+	int width;
+	int height;
+	int mwidth;
+	int mheight;
+	unsigned long *outputs;
+}kvm_monitor_info;
+
+typedef struct xrandr_struct
+{
+	void *xrandr_lib;
+	kvm_monitor_info*(*XRRGetMonitors)(Display *d, Window w, Bool active, int *count);
+	void(*XRRFreeMonitors)(kvm_monitor_info *monitors);
+}xrandr_struct;
+xrandr_struct *xrandr_exports = NULL;
+
+// Threads that hash and encode the tiles of the other monitors, while the mainloop does the tiles of worker 0
+typedef struct kvm_worker
+{
+	pthread_t thread;
+	struct tileFrame_t frame;
+	int owner;
+}kvm_worker;
+kvm_worker kvm_workers[KVM_MAX_WORKERS];
+int kvm_worker_count = 1;				// Including the mainloop
+int kvm_worker_busy = 0;				// Workers that haven't finished the current frame
+int kvm_worker_exit = 0;
+unsigned int kvm_worker_frame = 0;		// Incremented for every frame given to the workers
+void *kvm_worker_desktop = NULL;
+long long kvm_worker_desktopsize = 0;
+pthread_mutex_t kvm_worker_lock = PTHREAD_MUTEX_INITIALIZER;
+pthread_cond_t kvm_worker_start = PTHREAD_COND_INITIALIZER;
+pthread_cond_t kvm_worker_done = PTHREAD_COND_INITIALIZER;
 xkb_struct *xkb_exports = NULL;
 
 void kvm_keyboard_unmap_unicode_key(Display *display, int keycode)
@@ -278,11 +333,95 @@ void kvm_send_error(char *msg)
 	ignore_result(write(slave2master[1], buffer, msgLen + 2));
 }
 
-KVM_MouseCursors kvm_fetch_currentCursor(Display *cursordisplay)
+// Cursor names reported by XFixes, and the cursor type they map to
+typedef struct kvm_cursor_name
+{
+	char *name;
+	KVM_MouseCursors cursor;
+}kvm_cursor_name;
+kvm_cursor_name kvm_cursor_names[] =
+{
+	{ "bottom_left_corner", KVM_MouseCursor_SIZENESW }, { "sw-resize", KVM_MouseCursor_SIZENESW },
+	{ "bottom_right_corner", KVM_MouseCursor_SIZENWSE }, { "se-resize", KVM_MouseCursor_SIZENWSE },
+	{ "bottom_side", KVM_MouseCursor_SIZENS },
+	{ "fleur", KVM_MouseCursor_SIZEALL },
+	{ "hand1", KVM_MouseCursor_HAND }, { "hand2", KVM_MouseCursor_HAND }, { "pointer", KVM_MouseCursor_HAND },
+	{ "left_ptr", KVM_MouseCursor_ARROW },
+	{ "left_side", KVM_MouseCursor_SIZEWE }, { "w-resize", KVM_MouseCursor_SIZEWE }, { "e-resize", KVM_MouseCursor_SIZEWE },
+	{ "right_side", KVM_MouseCursor_SIZEWE },
+	{ "top_left_corner", KVM_MouseCursor_SIZENWSE }, { "nw-resize", KVM_MouseCursor_SIZENWSE },
+	{ "top_right_corner", KVM_MouseCursor_SIZENESW }, { "ne-resize", KVM_MouseCursor_SIZENESW },
+	{ "top_side", KVM_MouseCursor_SIZENS }, { "n-resize", KVM_MouseCursor_SIZENS }, { "s-resize", KVM_MouseCursor_SIZENS },
+	{ "watch", KVM_MouseCursor_WAIT },
+	{ "xterm", KVM_MouseCursor_IBEAM }, { "ibeam", KVM_MouseCursor_IBEAM }, { "text", KVM_MouseCursor_IBEAM },
+};
+
+// Hashtable values are offset, so that a known name never maps to NULL
+#define KVM_CURSOR_TO_VALUE(cursor) ((void*)(intptr_t)((cursor) + 2))
+#define KVM_CURSOR_FROM_VALUE(value) ((KVM_MouseCursors)((intptr_t)(value) - 2))
+
+typedef struct kvm_cursor_cache
+{
+	ILibHashtable names;		// Cursor names, and the Atoms already resolved, to KVM_MouseCursors
+	char *image;				// XFixesCursorImage of the current cursor
+	unsigned long serial;		// cursor_serial of the last change notification
+	int stale;					// The cursor changed since image was fetched
+}kvm_cursor_cache;
+
+void kvm_cursor_cache_init(kvm_cursor_cache *cache)
+{
+	size_t i;
+	memset(cache, 0, sizeof(kvm_cursor_cache));
+	cache->names = ILibHashtable_Create();
+	cache->stale = 1;
+	for (i = 0; i < sizeof(kvm_cursor_names) / sizeof(kvm_cursor_name); ++i)
+	{
+		ILibHashtable_Put(cache->names, NULL, kvm_cursor_names[i].name, (int)strlen(kvm_cursor_names[i].name), KVM_CURSOR_TO_VALUE(kvm_cursor_names[i].cursor));
+	}
+}
+void kvm_cursor_cache_destroy(kvm_cursor_cache *cache)
+{
+	if (cache->image != NULL) { x11_exports->XFree(cache->image); cache->image = NULL; }
+	if (cache->names != NULL) { ILibHashtable_Destroy(cache->names); cache->names = NULL; }
+}
+
+// Returns the image of the current cursor. It is only fetched again after a cursor change notification, unless
+// notifications are not available (evented == 0)
+char* kvm_cursor_cache_image(kvm_cursor_cache *cache, Display *cursordisplay, int evented)
+{
+	if (cache->image == NULL || cache->stale != 0 || evented == 0)
+	{
+		if (cache->image != NULL) { x11_exports->XFree(cache->image); }
+		cache->image = (char*)xfixes_exports->XFixesGetCursorImage(cursordisplay);
+		cache->stale = cache->image == NULL;
+	}
+	return(cache->image);
+}
+
+// Maps a cursor name Atom to a cursor type. The Atom name is only fetched from the XServer the first time an Atom is seen
+KVM_MouseCursors kvm_cursor_cache_lookup(kvm_cursor_cache *cache, Display *cursordisplay, Atom atom)
+{
+	void *value = ILibHashtable_Get(cache->names, (void*)(uintptr_t)atom, NULL, 0);
+	char *name;
+
+	if (value == NULL)
+	{
+		if ((name = x11_exports->XGetAtomName(cursordisplay, atom)) != NULL)
+		{
+			value = ILibHashtable_Get(cache->names, NULL, name, (int)strnlen_s(name, 255));
+			x11_exports->XFree(name);
+		}
+		if (value == NULL) { value = KVM_CURSOR_TO_VALUE(KVM_MouseCursor_NOCHANGE); }
+		ILibHashtable_Put(cache->names, (void*)(uintptr_t)atom, NULL, 0, value);
+	}
+	return(KVM_CURSOR_FROM_VALUE(value));
+}
+
+// Identifies cursors that don't have a name, from the alpha channel of their image
+KVM_MouseCursors kvm_cursor_from_image(char *cursor_image)
 {
-	// Name was NULL, so as a last ditch effort, lets try to look at the XFixesCursorImage
-	char *cursor_image = (char*)xfixes_exports->XFixesGetCursorImage(cursordisplay);
 	KVM_MouseCursors ret = KVM_MouseCursor_HELP;
+	if (cursor_image == NULL) { return(ret); }
 
 	unsigned short w = ((unsigned short*)(cursor_image + 4))[0];
 	unsigned short h = ((unsigned short*)(cursor_image + 6))[0];
@@ -404,16 +543,31 @@ KVM_MouseCursors kvm_fetch_currentCursor(Display *cursordisplay)
 		}
 	}
 		
-	x11_exports->XFree(cursor_image);
 	return(ret);
 }
+
+// Applies the requested scaling factor, and computes the tile count of the scaled screen
+void kvm_set_scaling()
+{
+	SCALING_FACTOR = SCALING_FACTOR_NEW;
+	SCALED_WIDTH = (SCREEN_WIDTH * SCALING_FACTOR) / 1024;
+	SCALED_HEIGHT = (SCREEN_HEIGHT * SCALING_FACTOR) / 1024;
+	if (SCALED_WIDTH < 1) { SCALED_WIDTH = 1; }
+	if (SCALED_HEIGHT < 1) { SCALED_HEIGHT = 1; }
+
+	TILE_HEIGHT_COUNT = SCALED_HEIGHT / TILE_HEIGHT;
+	TILE_WIDTH_COUNT = SCALED_WIDTH / TILE_WIDTH;
+	if (SCALED_WIDTH % TILE_WIDTH) { TILE_WIDTH_COUNT++; }
+	if (SCALED_HEIGHT % TILE_HEIGHT) { TILE_HEIGHT_COUNT++; }
+}
+
 void kvm_send_resolution()
 {
 	char buffer[8];
 	((unsigned short*)buffer)[0] = (unsigned short)htons((unsigned short)MNG_KVM_SCREEN);	// Write the type
 	((unsigned short*)buffer)[1] = (unsigned short)htons((unsigned short)8);				// Write the size
-	((unsigned short*)buffer)[2] = (unsigned short)htons((unsigned short)SCREEN_WIDTH);		// X position
-	((unsigned short*)buffer)[3] = (unsigned short)htons((unsigned short)SCREEN_HEIGHT);	// Y position
+	((unsigned short*)buffer)[2] = (unsigned short)htons((unsigned short)SCALED_WIDTH);		// X position
+	((unsigned short*)buffer)[3] = (unsigned short)htons((unsigned short)SCALED_HEIGHT);	// Y position
 
 	ignore_result(write(slave2master[1], buffer, sizeof(buffer)));
 }
@@ -484,19 +638,159 @@ char Location_X11TST[NAME_MAX];
 char Location_X11EXT[NAME_MAX];
 char Location_X11FIXES[NAME_MAX];
 char Location_X11KB[NAME_MAX];
-void kvm_set_x11_locations(char *libx11, char *libx11tst, char *libx11ext, char *libxfixes, char *libx11kb)
+char Location_X11RANDR[NAME_MAX];
+void kvm_set_x11_locations(char *libx11, char *libx11tst, char *libx11ext, char *libxfixes, char *libx11kb, char *libxrandr)
 {
 	if (libx11 != NULL) { strcpy_s(Location_X11LIB, sizeof(Location_X11LIB), libx11); } else { strcpy_s(Location_X11LIB, sizeof(Location_X11LIB), "libX11.so"); }
 	if (libx11tst != NULL) { strcpy_s(Location_X11TST, sizeof(Location_X11TST), libx11tst); } else { strcpy_s(Location_X11TST, sizeof(Location_X11TST), "libXtst.so"); }
 	if (libx11ext != NULL) { strcpy_s(Location_X11EXT, sizeof(Location_X11EXT), libx11ext); } else { strcpy_s(Location_X11EXT, sizeof(Location_X11EXT), "libXext.so"); }		
 	if (libxfixes != NULL) { strcpy_s(Location_X11FIXES, sizeof(Location_X11FIXES), libxfixes); } else { strcpy_s(Location_X11FIXES, sizeof(Location_X11FIXES), "libXfixes.so"); }
 	if (libx11kb != NULL) { strcpy_s(Location_X11KB, sizeof(Location_X11KB), libx11kb); } else { strcpy_s(Location_X11KB, sizeof(Location_X11KB), "libxkbfile.so"); }
+	if (libxrandr != NULL) { strcpy_s(Location_X11RANDR, sizeof(Location_X11RANDR), libxrandr); } else { strcpy_s(Location_X11RANDR, sizeof(Location_X11RANDR), "libXrandr.so"); }
+}
+
+int kvm_send_frame(struct tileFrame_t *frame);
+
+// Hashes the tiles of a worker, and appends the dirty ones to its frame. The mainloop flushes its frame as it goes,
+// the other workers keep theirs until the mainloop writes them.
+void kvm_encode_tiles(int owner, struct tileFrame_t *frame, void *desktop, long long desktopsize, int flush)
+{
+	int c;
+
+	update_tile_info(desktop, desktopsize, owner);
+
+	// getTileAt() coalesces neighboring dirty tiles, and clears the ones it sends
+	for (c = next_dirty_tile(0); c >= 0 && !g_shutdown; c = next_dirty_tile(c + 1))
+	{
+		if (g_tileInfo.owner[c] != owner) { continue; }
+		getTileAt(TILE_WIDTH * (c % TILE_WIDTH_COUNT), TILE_HEIGHT * (c / TILE_WIDTH_COUNT), frame, desktop, desktopsize, c / TILE_WIDTH_COUNT, c % TILE_WIDTH_COUNT);
+
+		// Write the tiles to the pipe, once enough of them have been batched
+		if (flush && frame->length >= KVM_PIPE_BUFFER_SIZE && !g_shutdown)
+		{
+			if (kvm_send_frame(frame) != 0) { g_shutdown = 1; break; }
+		}
+	}
+}
+
+void* kvm_worker_thread(void *parm)
+{
+	kvm_worker *worker = (kvm_worker*)parm;
+	unsigned int frame;
+
+	pthread_mutex_lock(&kvm_worker_lock);
+	frame = kvm_worker_frame;
+	while (1)
+	{
+		while (!kvm_worker_exit && kvm_worker_frame == frame) { pthread_cond_wait(&kvm_worker_start, &kvm_worker_lock); }
+		if (kvm_worker_exit) { break; }
+		frame = kvm_worker_frame;
+		pthread_mutex_unlock(&kvm_worker_lock);
+
+		kvm_encode_tiles(worker->owner, &(worker->frame), kvm_worker_desktop, kvm_worker_desktopsize, 0);
+
+		pthread_mutex_lock(&kvm_worker_lock);
+		if (--kvm_worker_busy == 0) { pthread_cond_signal(&kvm_worker_done); }
+	}
+	pthread_mutex_unlock(&kvm_worker_lock);
+
+	free_tile_buffers();
+	return (void*)0;
+}
+
+// Starts or stops worker threads, so that count workers are available including the mainloop
+void kvm_workers_resize(int count)
+{
+	int i;
+
+	if (count == kvm_worker_count) { return; }
+
+	pthread_mutex_lock(&kvm_worker_lock);
+	kvm_worker_exit = 1;
+	pthread_cond_broadcast(&kvm_worker_start);
+	pthread_mutex_unlock(&kvm_worker_lock);
+	for (i = 1; i < kvm_worker_count; ++i)
+	{
+		pthread_join(kvm_workers[i].thread, NULL);
+		if (kvm_workers[i].frame.buffer != NULL) { free(kvm_workers[i].frame.buffer); }
+	}
+	kvm_worker_exit = 0;
+
+	for (kvm_worker_count = 1; kvm_worker_count < count; ++kvm_worker_count)
+	{
+		kvm_worker *worker = &kvm_workers[kvm_worker_count];
+		memset(worker, 0, sizeof(kvm_worker));
+		worker->owner = kvm_worker_count;
+		if (pthread_create(&(worker->thread), NULL, kvm_worker_thread, worker) != 0)
+		{
+			// Tiles of workers that couldn't be started would never be sent
+			if (logFile) { fprintf(logFile, "KVM worker %d could not be started\n", kvm_worker_count); fflush(logFile); }
+			set_tile_owner(0, 0, SCALED_WIDTH, SCALED_HEIGHT, 0);
+			kvm_workers_resize(1);
+			break;
+		}
+	}
+}
+
+// Gives each worker the tiles of the current frame
+void kvm_workers_run(void *desktop, long long desktopsize)
+{
+	if (kvm_worker_count < 2) { return; }
+
+	pthread_mutex_lock(&kvm_worker_lock);
+	kvm_worker_desktop = desktop;
+	kvm_worker_desktopsize = desktopsize;
+	kvm_worker_busy = kvm_worker_count - 1;
+	++kvm_worker_frame;
+	pthread_cond_broadcast(&kvm_worker_start);
+	pthread_mutex_unlock(&kvm_worker_lock);
+}
+
+void kvm_workers_wait()
+{
+	if (kvm_worker_count < 2) { return; }
+
+	pthread_mutex_lock(&kvm_worker_lock);
+	while (kvm_worker_busy > 0) { pthread_cond_wait(&kvm_worker_done, &kvm_worker_lock); }
+	pthread_mutex_unlock(&kvm_worker_lock);
+}
+
+// Gives the tiles of every RandR monitor of the screen to a worker, so multi-monitor desktops are hashed and encoded in parallel.
+// The tiles are still sent at their position on the screen, which is how the viewer tells the monitors apart. Must be called
+// whenever the tile info is reset, while the workers are idle.
+void kvm_set_monitors()
+{
+	kvm_monitor_info *monitors = NULL;
+	int count = 0, workers = 1, i, x, y;
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+	if (xrandr_exports != NULL && xrandr_exports->XRRGetMonitors != NULL && xrandr_exports->XRRFreeMonitors != NULL)
+	{
+		monitors = xrandr_exports->XRRGetMonitors(eventdisplay, x11_exports->XRootWindow(eventdisplay, CURRENT_DISPLAY_ID), True, &count);
+	}
+	if (monitors != NULL)
+	{
+		workers = count < cpus ? count : (int)cpus;
+		if (workers > KVM_MAX_WORKERS) { workers = KVM_MAX_WORKERS; }
+		if (workers < 1) { workers = 1; }
+
+		// Tiles that aren't on any monitor stay with the mainloop. When monitors overlap, such as mirrored outputs, the first one keeps the tiles
+		for (i = count - 1; i >= 0; --i)
+		{
+			x = (monitors[i].x * SCALING_FACTOR) / 1024;
+			y = (monitors[i].y * SCALING_FACTOR) / 1024;
+			set_tile_owner(x, y, (((monitors[i].x + monitors[i].width) * SCALING_FACTOR) / 1024) - x, (((monitors[i].y + monitors[i].height) * SCALING_FACTOR) / 1024) - y, i % workers);
+		}
+		xrandr_exports->XRRFreeMonitors(monitors);
+	}
+	if (logFile) { fprintf(logFile, "KVM Monitors: %d, Workers: %d\n", count, workers); fflush(logFile); }
+
+	kvm_workers_resize(workers);
 }
 
 int kvm_init(int displayNo)
 {
 	if (logFile) { fprintf(logFile, "kvm_init(%d) called\n", displayNo); fflush(logFile); }
-	int old_height_count = TILE_HEIGHT_COUNT;
 	int dummy1, dummy2, dummy3;
 
 	if (clock_gettime(CLOCK_MONOTONIC, &inputtime) != 0) { memset(&inputtime, 0, sizeof(inputtime)); }
@@ -569,6 +863,16 @@ int kvm_init(int displayNo)
 			((void**)xfixes_exports)[4] = (void*)dlsym(xfixes_exports->xfixes_lib, "XFixesGetCursorImageAndName");
 		}
 	}
+	if (xrandr_exports == NULL)
+	{
+		xrandr_exports = ILibMemory_SmartAllocate(sizeof(xrandr_struct));
+		xrandr_exports->xrandr_lib = dlopen(Location_X11RANDR, RTLD_NOW);
+		if (xrandr_exports->xrandr_lib)
+		{
+			((void**)xrandr_exports)[1] = (void*)dlsym(xrandr_exports->xrandr_lib, "XRRGetMonitors");
+			((void**)xrandr_exports)[2] = (void*)dlsym(xrandr_exports->xrandr_lib, "XRRFreeMonitors");
+		}
+	}
 	if (xkb_exports == NULL)
 	{
 		xkb_exports = ILibMemory_SmartAllocate(sizeof(xkb_struct));
@@ -599,7 +903,8 @@ int kvm_init(int displayNo)
 	}
 
 	g_enableEvents = x11_exports->XQueryExtension(eventdisplay, "XTEST", &dummy1, &dummy2, &dummy3)? 1 : 0;
-	if (!g_enableEvents) { printf("FATAL::::Fake motion is not supported.\n\n\n"); }
+	if (g_uinputKeyboard >= 0) { kvm_uinput_create(eventdisplay); }
+	if (!g_enableEvents && g_uinputKeyboard < 0) { printf("FATAL::::Fake motion is not supported.\n\n\n"); }
 
 	CURRENT_DISPLAY_ID = SCREEN_NUM = DefaultScreen(eventdisplay);
 	SCREEN_HEIGHT = DisplayHeight(eventdisplay, SCREEN_NUM);
@@ -614,17 +919,15 @@ int kvm_init(int displayNo)
 	// Some magic numbers.
 	TILE_WIDTH = 32;
 	TILE_HEIGHT = 32;
-	COMPRESSION_RATIO = 50;
+	set_tile_compression_ratio(50);
 	FRAME_RATE_TIMER = 100;
 
-	TILE_HEIGHT_COUNT = SCREEN_HEIGHT / TILE_HEIGHT;
-	TILE_WIDTH_COUNT = SCREEN_WIDTH / TILE_WIDTH;
-	if (SCREEN_WIDTH % TILE_WIDTH) { TILE_WIDTH_COUNT++; }
-	if (SCREEN_HEIGHT % TILE_HEIGHT) { TILE_HEIGHT_COUNT++; }
+	kvm_set_scaling();
 
 	kvm_send_resolution();
 	kvm_send_display();
-	reset_tile_info(old_height_count);
+	reset_tile_info();
+	kvm_set_monitors();
 
 	if (xkb_exports != NULL)
 	{
@@ -651,7 +954,6 @@ void CheckDesktopSwitch(int checkres)
 	if (change_display) 
 	{
 		if (logFile) { fprintf(logFile, "kvm_init(%d) checkDesktopSwitch\n", CURRENT_DISPLAY_ID);  fflush(logFile); }
-		int old_height_count = TILE_HEIGHT_COUNT;
 		change_display = 0;
 		
 		SCREEN_NUM = CURRENT_DISPLAY_ID;
@@ -659,15 +961,13 @@ void CheckDesktopSwitch(int checkres)
 		SCREEN_WIDTH = DisplayWidth(eventdisplay, CURRENT_DISPLAY_ID);
 		SCREEN_DEPTH = DefaultDepth(eventdisplay, CURRENT_DISPLAY_ID);
 
-		TILE_HEIGHT_COUNT = SCREEN_HEIGHT / TILE_HEIGHT;
-		TILE_WIDTH_COUNT = SCREEN_WIDTH / TILE_WIDTH;
-		if (SCREEN_WIDTH % TILE_WIDTH) { TILE_WIDTH_COUNT++; }
-		if (SCREEN_HEIGHT % TILE_HEIGHT) { TILE_HEIGHT_COUNT++; }
+		kvm_set_scaling();
 
 		kvm_send_resolution();
 		kvm_send_display();
 
-		reset_tile_info(old_height_count);
+		reset_tile_info();
+		kvm_set_monitors();
 		return;
 	}
 }
@@ -695,7 +995,7 @@ int kvm_server_inputdata(char* block, int blocklen)
 	case MNG_KVM_KEY: // Key
 		{
 			if (size != 6) break;
-			if (g_enableEvents)
+			if (g_enableEvents || g_uinputKeyboard >= 0)
 			{
 				if (logFile) { fprintf(logFile, "KeyAction(%u, %d)\n", ((unsigned char*)block)[5], block[4]); fflush(logFile); }
 				KeyAction(((unsigned char*)block)[5], block[4], eventdisplay);
@@ -708,12 +1008,13 @@ int kvm_server_inputdata(char* block, int blocklen)
 			short w = 0;
 			if (size == 10 || size == 12)
 			{
-				x = ((int)ntohs(((unsigned short*)(block))[3]));
-				y = ((int)ntohs(((unsigned short*)(block))[4]));
+				// Scale back to the screen coordinates
+				x = ((int)ntohs(((unsigned short*)(block))[3])) * 1024 / SCALING_FACTOR;
+				y = ((int)ntohs(((unsigned short*)(block))[4])) * 1024 / SCALING_FACTOR;
 				if (size == 12) w = ((short)ntohs(((short*)(block))[5]));
 				if (logFile) { fprintf(logFile, "RemoteMouseMove: (%d, %d)\n", x, y); }
 				// printf("x:%d, y:%d, b:%d, w:%d\n", x, y, block[5], w);
-				if (g_enableEvents)
+				if (g_enableEvents || g_uinputPointer >= 0)
 				{
 					remoteMouseX = x, remoteMouseY = y;
 					MouseAction(x, y, (int)(unsigned char)(block[5]), w, eventdisplay);
@@ -726,27 +1027,21 @@ int kvm_server_inputdata(char* block, int blocklen)
 			if (size >= 10) { int fr = ((int)ntohs(((unsigned short*)(block + 8))[0])); if (fr >= 20 && fr <= 5000) FRAME_RATE_TIMER = fr; }
 			if (size >= 8) { int ns = ((int)ntohs(((unsigned short*)(block + 6))[0])); if (ns >= 64 && ns <= 4096) SCALING_FACTOR_NEW = ns; }
 			if (size >= 6) { set_tile_compression((int)block[4], (int)block[5]); }
-			COMPRESSION_RATIO = 100;
+			set_tile_compression_ratio(100);
 			break;
 		}
 	case MNG_KVM_REFRESH: // Refresh
 		{
 			kvm_send_resolution();
 
-			int row, col;
 			if (size != 4) break;
-			if (g_tileInfo == NULL) {
-				if ((g_tileInfo = (struct tileInfo_t **) malloc(TILE_HEIGHT_COUNT * sizeof(struct tileInfo_t *))) == NULL) ILIBCRITICALEXIT(254);
-				for (row = 0; row < TILE_HEIGHT_COUNT; row++) {
-					if ((g_tileInfo[row] = (struct tileInfo_t *) malloc(TILE_WIDTH_COUNT * sizeof(struct tileInfo_t))) == NULL) ILIBCRITICALEXIT(254);
-				}
-			}
-			for (row = 0; row < TILE_HEIGHT_COUNT; row++) {
-				for (col = 0; col < TILE_WIDTH_COUNT; col++) {
-					g_tileInfo[row][col].crc = 0xFF;
-					g_tileInfo[row][col].flag = 0;
-				}
-			}
+			invalidate_tile_info();
+			break;
+		}
+	case MNG_KVM_COPY: // The viewer supports copy commands, to scroll what it already has
+		{
+			if (size != 4) break;
+			COPY_RECT_ENABLED = 1;
 			break;
 		}
 	case MNG_KVM_PAUSE: // Pause
@@ -788,7 +1083,6 @@ int kvm_relay_feeddata(char* buf, int len)
 		master2slave[1],			// handle to pipe
 		buf,			// buffer to write from
 		len);
-	fsync(master2slave[1]);
 	//fprintf(logFile, "Written %d bytes to slave in kvm_relay_feeddata\n", written);
 
 	if (written == -1) return 0;
@@ -948,6 +1242,96 @@ void kvm_server_sighandler(int signum, siginfo_t *info, void *context)
 {
 	g_shutdown = 1;
 }
+//
+// The capture connection, and the XShm image it reads into, are kept for the whole session,
+// and only recreated when the resolution, depth or screen changes.
+//
+typedef struct kvm_capture_context
+{
+	Display *display;
+	XImage *image;
+	XShmSegmentInfo shminfo;
+	int screen;
+	int width;
+	int height;
+	int depth;
+}kvm_capture_context;
+
+void kvm_capture_release_image(kvm_capture_context *capture)
+{
+	if (capture->image != NULL)
+	{
+		x11ext_exports->XShmDetach(capture->display, &(capture->shminfo));
+		XDestroyImage(capture->image);
+		capture->image = NULL;
+	}
+	if (capture->shminfo.shmaddr != NULL)
+	{
+		shmdt(capture->shminfo.shmaddr);
+		capture->shminfo.shmaddr = NULL;
+	}
+}
+int kvm_capture_create_image(kvm_capture_context *capture)
+{
+	kvm_capture_release_image(capture);
+
+	capture->image = x11ext_exports->XShmCreateImage(capture->display, DefaultVisual(capture->display, SCREEN_NUM), SCREEN_DEPTH, ZPixmap, NULL, &(capture->shminfo), SCREEN_WIDTH, SCREEN_HEIGHT);
+	if (capture->image == NULL) { return(1); }
+
+	capture->shminfo.shmid = shmget(IPC_PRIVATE, capture->image->bytes_per_line * capture->image->height, IPC_CREAT | 0777);
+	if (capture->shminfo.shmid < 0 || (capture->shminfo.shmaddr = shmat(capture->shminfo.shmid, 0, 0)) == (char*)-1)
+	{
+		if (capture->shminfo.shmid >= 0) { shmctl(capture->shminfo.shmid, IPC_RMID, 0); }
+		capture->shminfo.shmaddr = NULL;
+		XDestroyImage(capture->image);
+		capture->image = NULL;
+		return(1);
+	}
+	capture->image->data = capture->shminfo.shmaddr;
+	capture->shminfo.readOnly = False;
+	x11ext_exports->XShmAttach(capture->display, &(capture->shminfo));
+
+	// Once the X server has attached, the segment can be marked for removal, so it is released even if we crash
+	x11_exports->XSync(capture->display, False);
+	shmctl(capture->shminfo.shmid, IPC_RMID, 0);
+
+	capture->screen = SCREEN_NUM;
+	capture->width = SCREEN_WIDTH;
+	capture->height = SCREEN_HEIGHT;
+	capture->depth = SCREEN_DEPTH;
+	if (logFile) { fprintf(logFile, "KVM Capture Image: %d x %d x %d bpp\n", SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_DEPTH); fflush(logFile); }
+	return(0);
+}
+void kvm_capture_destroy(kvm_capture_context *capture)
+{
+	if (capture->display != NULL)
+	{
+		kvm_capture_release_image(capture);
+		x11_exports->XCloseDisplay(capture->display);
+		capture->display = NULL;
+	}
+}
+
+// Writes the batched tile messages to the agent
+int kvm_send_frame(struct tileFrame_t *frame)
+{
+	size_t offset = 0;
+	ssize_t written;
+
+	while (offset < frame->length)
+	{
+		written = write(slave2master[1], frame->buffer + offset, frame->length - offset);
+		if (written < 0)
+		{
+			if (errno == EINTR) { continue; }
+			return(-1);
+		}
+		offset += (size_t)written;
+	}
+	frame->length = 0;
+	return(0);
+}
+
 void* kvm_server_mainloop(void* parm)
 {
 	int maxsleep;
@@ -956,20 +1340,20 @@ void* kvm_server_mainloop(void* parm)
 	unsigned int mr;
 	char *cimage;
 
-	int x, y, height, width, r, c;
+	int height, c;
 	int sentHideCursor = 0;
 	long long desktopsize = 0;
-	long long tilesize = 0;
+	struct tileFrame_t frame = { NULL, 0, 0 };
 
 	void *desktop = NULL;
 	XImage *image = NULL;
+	XWindowAttributes rootAttributes;
+	kvm_capture_context capture;
 	eventdisplay = NULL;
-	Display *imagedisplay = NULL, *cursordisplay = NULL;
-	void *buf = NULL;
+	Display *cursordisplay = NULL;
+	kvm_cursor_cache cursorcache;
 	int event_base = 0, error_base = 0, cursor_descriptor = -1;
 	int kbevent_base = 0;
-	ssize_t written;
-	XShmSegmentInfo shminfo;
 	default_JPEG_error_handler = kvm_server_jpegerror;
 
 	struct timeval tv;
@@ -979,6 +1363,7 @@ void* kvm_server_mainloop(void* parm)
 	XEvent XE;
 
 	unsigned short currentDisplayId = 0;
+	memset(&capture, 0, sizeof(capture));
 
 	if (logFile) { fprintf(logFile, "Checking $DISPLAY\n"); fflush(logFile); }
 	for (char **env = environ; *env; ++env)
@@ -1022,40 +1407,35 @@ void* kvm_server_mainloop(void* parm)
 
 	while (!g_shutdown) 
 	{
-		for (r = 0; r < TILE_HEIGHT_COUNT; r++) 
-		{
-			for (c = 0; c < TILE_WIDTH_COUNT; c++) 
-			{
-				g_tileInfo[r][c].flag = TILE_TODO;
 #ifdef KVM_ALL_TILES
-				g_tileInfo[r][c].crc = 0xFF;
+		invalidate_tile_info();
 #endif
-			}
-		}
 		//fprintf(logFile, "Before CheckDesktopSwitch.\n"); fflush(logFile);
 		CheckDesktopSwitch(1);
 		//fprintf(logFile, "After CheckDesktopSwitch.\n"); fflush(logFile);
 
-		imagedisplay = x11_exports->XOpenDisplay(CURRENT_XDISPLAY);
-		if (imagedisplay == NULL) { g_shutdown = 1; break; }
+		if (capture.display == NULL)
+		{
+			if ((capture.display = x11_exports->XOpenDisplay(CURRENT_XDISPLAY)) == NULL) { g_shutdown = 1; break; }
+		}
 
-		if (DisplayWidth(imagedisplay, CURRENT_DISPLAY_ID) != SCREEN_WIDTH ||
-			DisplayHeight(imagedisplay, CURRENT_DISPLAY_ID) != SCREEN_HEIGHT ||
-			DefaultDepth(eventdisplay, CURRENT_DISPLAY_ID) != SCREEN_DEPTH)
+		// The screen size cached in the Display is only updated when a connection is opened, so ask the server for the root window geometry
+		if (x11_exports->XGetWindowAttributes(capture.display, x11_exports->XRootWindow(capture.display, CURRENT_DISPLAY_ID), &rootAttributes) == 0) { g_shutdown = 1; break; }
+		if (rootAttributes.width != SCREEN_WIDTH ||
+			rootAttributes.height != SCREEN_HEIGHT ||
+			rootAttributes.depth != SCREEN_DEPTH ||
+			SCALING_FACTOR != SCALING_FACTOR_NEW)
 		{
-			int old = TILE_HEIGHT_COUNT;
-			SCREEN_HEIGHT = DisplayHeight(imagedisplay, CURRENT_DISPLAY_ID);
-			SCREEN_WIDTH = DisplayWidth(imagedisplay, CURRENT_DISPLAY_ID);
-			SCREEN_DEPTH = DefaultDepth(imagedisplay, CURRENT_DISPLAY_ID);
-			if (logFile) { fprintf(logFile, "SLAVE/KVM Resolution Changed: %d x %d x %d bpp\n", SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_DEPTH); fflush(logFile); }
+			SCREEN_HEIGHT = rootAttributes.height;
+			SCREEN_WIDTH = rootAttributes.width;
+			SCREEN_DEPTH = rootAttributes.depth;
+			if (logFile) { fprintf(logFile, "SLAVE/KVM Resolution Changed: %d x %d x %d bpp, scaling %d\n", SCREEN_WIDTH, SCREEN_HEIGHT, SCREEN_DEPTH, SCALING_FACTOR_NEW); fflush(logFile); }
 
-			TILE_HEIGHT_COUNT = SCREEN_HEIGHT / TILE_HEIGHT;
-			TILE_WIDTH_COUNT = SCREEN_WIDTH / TILE_WIDTH;
-			if (SCREEN_WIDTH % TILE_WIDTH) { TILE_WIDTH_COUNT++; }
-			if (SCREEN_HEIGHT % TILE_HEIGHT) { TILE_HEIGHT_COUNT++; }
+			kvm_set_scaling();
 
 			kvm_send_resolution();
-			reset_tile_info(old);
+			reset_tile_info();
+			kvm_set_monitors();
 		}
 
 
@@ -1093,7 +1473,8 @@ void* kvm_server_mainloop(void* parm)
 					x11_exports->XSync(cursordisplay, 0);								// Sync with XServer
 					cursor_descriptor = x11_exports->XConnectionNumber(cursordisplay);	// Get the FD to use in select
 				}
-				curcursor = kvm_fetch_currentCursor(cursordisplay);						// Cursor Type
+				kvm_cursor_cache_init(&cursorcache);
+				curcursor = kvm_cursor_from_image(kvm_cursor_cache_image(&cursorcache, cursordisplay, 0));	// Cursor Type
 
 				if (xkb_exports != NULL)
 				{
@@ -1122,48 +1503,25 @@ void* kvm_server_mainloop(void* parm)
 					if (XE.type == (event_base + 1))
 					{
 						char buffer[8];
-						char *name = NULL;
+						KVM_MouseCursors cursor;
+						Atom atom = ((Atom*)((char*)&XE + (sizeof(void*) == 8 ? 64 : 32)))[0];							// cursor_name
+						unsigned long serial = ((unsigned long*)((char*)&XE + (sizeof(void*) == 8 ? 48 : 24)))[0];		// cursor_serial
 
-						if (sizeof(void*) == 8)
-						{
-							// 64bit
-							if (((uint64_t*)((char*)&XE + 64))[0] != 0)
-							{
-								name = x11_exports->XGetAtomName(cursordisplay, ((Atom*)((char*)&XE + 64))[0]);
-							}
-						}
-						else
+						if (serial != cursorcache.serial)
 						{
-							// 32bit
-							if (((uint32_t*)((char*)&XE + 32))[0] != 0)
-							{
-								name = x11_exports->XGetAtomName(cursordisplay, ((Atom*)((char*)&XE + 32))[0]);
-							}
+							// The cached image is for a different cursor
+							cursorcache.serial = serial;
+							cursorcache.stale = 1;
 						}
-					
-						if (name != NULL)
+
+						if (atom != 0)
 						{
-							if (strcmp(name, "bottom_left_corner") == 0 || strcmp(name, "sw-resize") == 0) { curcursor = KVM_MouseCursor_SIZENESW; }
-							if (strcmp(name, "bottom_right_corner") == 0 || strcmp(name, "se-resize") == 0) { curcursor = KVM_MouseCursor_SIZENWSE; }
-							if (strcmp(name, "bottom_side") == 0) { curcursor = KVM_MouseCursor_SIZENS; }
-							if (strcmp(name, "fleur") == 0) { curcursor = KVM_MouseCursor_SIZEALL; }
-							if (strcmp(name, "hand1") == 0 || strcmp(name, "pointer")==0) { curcursor = KVM_MouseCursor_HAND; }
-							if (strcmp(name, "hand2") == 0) { curcursor = KVM_MouseCursor_HAND; }
-							if (strcmp(name, "left_ptr") == 0) { curcursor = KVM_MouseCursor_ARROW; }
-							if (strcmp(name, "left_side") == 0 || strcmp(name, "w-resize") == 0 || strcmp(name, "e-resize") == 0) { curcursor = KVM_MouseCursor_SIZEWE; }
-							if (strcmp(name, "right_side") == 0) { curcursor = KVM_MouseCursor_SIZEWE; }
-							if (strcmp(name, "top_left_corner") == 0 || strcmp(name, "nw-resize") == 0) { curcursor = KVM_MouseCursor_SIZENWSE; }
-							if (strcmp(name, "top_right_corner") == 0 || strcmp(name, "ne-resize") == 0) { curcursor = KVM_MouseCursor_SIZENESW; }
-							if (strcmp(name, "top_side") == 0) { curcursor = KVM_MouseCursor_SIZENS; }
-							if (strcmp(name, "watch") == 0) { curcursor = KVM_MouseCursor_WAIT; }
-							if (strcmp(name, "top_side") == 0 || strcmp(name, "n-resize") == 0 || strcmp(name, "s-resize") == 0) { curcursor = KVM_MouseCursor_SIZENS; }
-							if (strcmp(name, "xterm") == 0 || strcmp(name, "ibeam") == 0 || strcmp(name, "text") == 0) { curcursor = KVM_MouseCursor_IBEAM; }
-							x11_exports->XFree(name);
+							if ((cursor = kvm_cursor_cache_lookup(&cursorcache, cursordisplay, atom)) != KVM_MouseCursor_NOCHANGE) { curcursor = cursor; }
 						}
 						else
 						{
 							// Name was NULL, so as a last ditch effort, lets try to look at the XFixesCursorImage
-							curcursor = kvm_fetch_currentCursor(cursordisplay);
+							curcursor = kvm_cursor_from_image(kvm_cursor_cache_image(&cursorcache, cursordisplay, 1));
 						}
 
 						if (sentHideCursor == 0)
@@ -1171,8 +1529,7 @@ void* kvm_server_mainloop(void* parm)
 							((unsigned short*)buffer)[0] = (unsigned short)htons((unsigned short)MNG_KVM_MOUSE_CURSOR);	// Write the type
 							((unsigned short*)buffer)[1] = (unsigned short)htons((unsigned short)5);					// Write the size
 							buffer[4] = (char)curcursor;																// Cursor Type
-							written = write(slave2master[1], buffer, 5);
-							fsync(slave2master[1]);
+							ignore_result(write(slave2master[1], buffer, 5));
 						}
 					}
 					if (kbevent_base != 0 && XE.type == kbevent_base)
@@ -1193,41 +1550,35 @@ void* kvm_server_mainloop(void* parm)
 			}
 		}
 
-		image = x11ext_exports->XShmCreateImage(imagedisplay,
-			DefaultVisual(imagedisplay, SCREEN_NUM), // Use a correct visual. Omitted for brevity     
-			SCREEN_DEPTH,
-			ZPixmap, NULL, &shminfo, SCREEN_WIDTH, SCREEN_HEIGHT);
-		shminfo.shmid = shmget(IPC_PRIVATE,
-			image->bytes_per_line * image->height,
-			IPC_CREAT | 0777);
-		shminfo.shmaddr = image->data = shmat(shminfo.shmid, 0, 0);
-		shminfo.readOnly = False;
-		x11ext_exports->XShmAttach(imagedisplay, &shminfo);
-		
-		x11ext_exports->XShmGetImage(imagedisplay,
-			RootWindowOfScreen(ScreenOfDisplay(imagedisplay, CURRENT_DISPLAY_ID)),
-			image,
-			0,
-			0,
-			AllPlanes);
-
-		//image = XGetImage(imagedisplay,
-		//		RootWindowOfScreen(DefaultScreenOfDisplay(imagedisplay))
-		//		, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT, AllPlanes, ZPixmap);
-
+		if (capture.image == NULL || capture.screen != SCREEN_NUM || capture.width != SCREEN_WIDTH || capture.height != SCREEN_HEIGHT || capture.depth != SCREEN_DEPTH)
+		{
+			if (kvm_capture_create_image(&capture) != 0) { g_shutdown = 1; break; }
+		}
 
-		if (image == NULL) {
-			g_shutdown = 1;
+		image = capture.image;
+		if (!x11ext_exports->XShmGetImage(capture.display, RootWindowOfScreen(ScreenOfDisplay(capture.display, CURRENT_DISPLAY_ID)), image, 0, 0, AllPlanes))
+		{
+			// Try again with a new image on the next frame
+			kvm_capture_release_image(&capture);
+			image = NULL;
 		}
-		else 
+
+		if (image != NULL)
 		{
-			rs = x11_exports->XQueryPointer(imagedisplay, RootWindowOfScreen(ScreenOfDisplay(imagedisplay, CURRENT_DISPLAY_ID)),
+			rs = x11_exports->XQueryPointer(capture.display, RootWindowOfScreen(ScreenOfDisplay(capture.display, CURRENT_DISPLAY_ID)),
 				&rr, &cr, &rx, &ry, &wx, &wy, &mr);
 			if (rs == 1 && cursordisplay != NULL)
 			{
 				if (gRemoteMouseRenderDefault != 0 || (remoteMouseX != rx && remoteMouseY != ry))
 				{
-					cimage = (char*)xfixes_exports->XFixesGetCursorImage(cursordisplay);
+					cimage = kvm_cursor_cache_image(&cursorcache, cursordisplay, cursor_descriptor > 0);
+				}
+				else
+				{
+					cimage = NULL;
+				}
+				if (cimage != NULL)
+				{
 					unsigned short w = ((unsigned short*)(cimage + 4))[0];
 					unsigned short h = ((unsigned short*)(cimage + 6))[0];
 					unsigned short xhot = ((unsigned short*)(cimage + 8))[0];
@@ -1250,10 +1601,8 @@ void* kvm_server_mainloop(void* parm)
 						((unsigned short*)tmpbuffer)[0] = (unsigned short)htons((unsigned short)MNG_KVM_MOUSE_CURSOR);	// Write the type
 						((unsigned short*)tmpbuffer)[1] = (unsigned short)htons((unsigned short)5);						// Write the size
 						tmpbuffer[4] = (char)KVM_MouseCursor_NONE;														// Cursor Type
-						written = write(slave2master[1], tmpbuffer, 5);
-						fsync(slave2master[1]);
+						ignore_result(write(slave2master[1], tmpbuffer, 5));
 					}
-					x11_exports->XFree(cimage);
 				}
 				else
 				{
@@ -1264,50 +1613,34 @@ void* kvm_server_mainloop(void* parm)
 						((unsigned short*)tmpbuffer)[0] = (unsigned short)htons((unsigned short)MNG_KVM_MOUSE_CURSOR);	// Write the type
 						((unsigned short*)tmpbuffer)[1] = (unsigned short)htons((unsigned short)5);						// Write the size
 						tmpbuffer[4] = (char)curcursor;																	// Cursor Type
-						written = write(slave2master[1], tmpbuffer, 5);
-						fsync(slave2master[1]);
+						ignore_result(write(slave2master[1], tmpbuffer, 5));
 					}
 					sentHideCursor = 0;
 				}
 			}
 			getScreenBuffer((char **)&desktop, &desktopsize, image);
+			getCopyRects(&frame, desktop, desktopsize);
 
-			for (y = 0; y < TILE_HEIGHT_COUNT; y++) {
-				for (x = 0; x < TILE_WIDTH_COUNT; x++) {
-					height = TILE_HEIGHT * y;
-					width = TILE_WIDTH * x;
-
-					if (g_shutdown) { x = TILE_WIDTH_COUNT; y = TILE_HEIGHT_COUNT; break; }
+			// Send the dirty tiles, while the other workers do the tiles of the other monitors
+			kvm_workers_run(desktop, desktopsize);
+			kvm_encode_tiles(0, &frame, desktop, desktopsize, 1);
+			kvm_workers_wait();
 
-					if (g_tileInfo[y][x].flag == TILE_SENT || g_tileInfo[y][x].flag == TILE_DONT_SEND) {
-						continue;
-					}
-
-					getTileAt(width, height, &buf, &tilesize, desktop, desktopsize, y, x);
-
-					if (buf && !g_shutdown)
-					{
-						// Write the reply to the pipe.
-						//fprintf(logFile, "Writing to master in kvm_server_mainloop\n");
-						written = write(slave2master[1], buf, tilesize);
-						fsync(slave2master[1]);
-						//fprintf(logFile, "Wrote %d bytes to master in kvm_server_mainloop\n", written);
-						free(buf);
-						if (written == -1) { /*ILIBMESSAGE("KVMBREAK-K2\r\n");*/ g_shutdown = 1; height = SCREEN_HEIGHT; width = SCREEN_WIDTH; break; }
-					}
+			// Write the rest of the frame, and then the frames of the other workers. Copy commands are at the start of the
+			// mainloop's frame, so the viewer always gets them before any tile that is drawn over their source
+			if (frame.length > 0 && !g_shutdown)
+			{
+				if (kvm_send_frame(&frame) != 0) { g_shutdown = 1; }
+			}
+			for (c = 1; c < kvm_worker_count; ++c)
+			{
+				if (kvm_workers[c].frame.length > 0 && !g_shutdown)
+				{
+					if (kvm_send_frame(&kvm_workers[c].frame) != 0) { g_shutdown = 1; }
 				}
+				kvm_workers[c].frame.length = 0;
 			}
-		}
-		
-		x11ext_exports->XShmDetach(imagedisplay, &shminfo);
-		XDestroyImage(image); image = NULL;
-		shmdt(shminfo.shmaddr);
-		shmctl(shminfo.shmid, IPC_RMID, 0);
-		
-		if (imagedisplay != NULL) 
-		{
-			x11_exports->XCloseDisplay(imagedisplay);
-			imagedisplay = NULL;
+			frame.length = 0;
 		}
 
 		// We can't go full speed here, we need to slow this down.
@@ -1329,7 +1662,10 @@ void* kvm_server_mainloop(void* parm)
 		}
 	}
 
+	kvm_workers_resize(1);
+	kvm_capture_destroy(&capture);
 	if (desktop != NULL) { free(desktop); desktop = NULL; }
+	if (frame.buffer != NULL) { free(frame.buffer); frame.buffer = NULL; }
 	close(slave2master[1]);
 	close(master2slave[0]);
 	slave2master[1] = 0;
@@ -1338,22 +1674,24 @@ void* kvm_server_mainloop(void* parm)
 	//ILIBLOGMESSAGEX("UNMAPPING ALL");
 
 	KeyActionUnicode_UNMAP_ALL(eventdisplay);
+	kvm_uinput_destroy();
 	x11_exports->XCloseDisplay(eventdisplay);
 	eventdisplay  = NULL;
 
 	if (cursordisplay != NULL)
 	{
+		kvm_cursor_cache_destroy(&cursorcache);
 		x11_exports->XCloseDisplay(cursordisplay);
 		cursordisplay = NULL;
 	}
 
-	if (g_tileInfo != NULL)
-	{
-		for (r = 0; r < TILE_HEIGHT_COUNT; r++) { free(g_tileInfo[r]); }
-		free(g_tileInfo);
-		g_tileInfo = NULL;
-	}
-	if(tilebuffer != NULL) { free(tilebuffer); tilebuffer = NULL; }
+	if (g_tileInfo.hash != NULL) { free(g_tileInfo.hash); g_tileInfo.hash = NULL; }
+	if (g_tileInfo.dirty != NULL) { free(g_tileInfo.dirty); g_tileInfo.dirty = NULL; }
+	if (g_tileInfo.owner != NULL) { free(g_tileInfo.owner); g_tileInfo.owner = NULL; }
+	g_tileInfo.count = 0;
+	free_tile_buffers();
+	if(scalebuffer != NULL) { free(scalebuffer); scalebuffer = NULL; scalebuffersize = 0; }
+	if(rowhashes != NULL) { free(rowhashes); rowhashes = NULL; }
 	return (void*)0;
 }
 
@@ -1442,6 +1780,9 @@ void* kvm_relay_restart(int paused, void *processPipeMgr, ILibKVM_WriteHandler w
 	fcntl(slave2master[1], F_SETFD, FD_CLOEXEC);
 	fcntl(master2slave[0], F_SETFD, FD_CLOEXEC);
 	fcntl(master2slave[1], F_SETFD, FD_CLOEXEC);
+#ifdef F_SETPIPE_SZ
+	fcntl(slave2master[1], F_SETPIPE_SZ, KVM_PIPE_BUFFER_SIZE);		// Best effort, the default pipe size is still ok
+#endif
 
 	slave_out = ILibProcessPipe_Pipe_CreateFromExistingWithExtraMemory(processPipeMgr, slave2master[0], 3 * sizeof(void*));	
 	((void**)ILibMemory_Extra(slave_out))[0] = writeHandler;
@@ -1463,6 +1804,7 @@ void* kvm_relay_restart(int paused, void *processPipeMgr, ILibKVM_WriteHandler w
 		close(master2slave[1]);
 
 		if (SLAVELOG != 0) { logFile = fopen("/tmp/slave", "w"); }
+		if (KVM_UINPUT != 0) { kvm_uinput_open(); }
 		if (uid != 0) { ignore_result(setuid(uid)); }
 
 		if (g_ILibCrashDump_path != NULL)
@@ -1495,7 +1837,7 @@ void* kvm_relay_restart(int paused, void *processPipeMgr, ILibKVM_WriteHandler w
 		sprintf_s(tmp, sizeof(tmp), "Child KVM (pid=%d)", g_slavekvm);
 
 		// We will asyncronously read from the pipe, so we can just return
-		ILibProcessPipe_Pipe_AddPipeReadHandler(slave_out, 65535, kvm_relay_readSink);
+		ILibProcessPipe_Pipe_AddPipeReadHandler(slave_out, KVM_PIPE_BUFFER_SIZE, kvm_relay_readSink);
 		ILibProcessPipe_Pipe_SetBrokenPipeHandler(slave_out, kvm_relay_brokenPipeSink);
 		ILibProcessPipe_Pipe_ResetMetadata(slave_out, tmp);
 		return(slave_out);
@@ -28,18 +28,32 @@ extern int SCREEN_NUM;
 extern int SCREEN_WIDTH;
 extern int SCREEN_HEIGHT;
 extern int SCREEN_DEPTH;
+extern int SCALED_WIDTH;
+extern int SCALED_HEIGHT;
 extern int TILE_WIDTH;
 extern int TILE_HEIGHT;
 extern int TILE_WIDTH_COUNT;
 extern int TILE_HEIGHT_COUNT;
 extern int COMPRESSION_RATIO;
-extern struct tileInfo_t **g_tileInfo;
-extern unsigned char *jpeg_buffer;
-extern int jpeg_buffer_length;
-
-int tilebuffersize = 0;
-void* tilebuffer = NULL;
+extern struct tileInfo_t g_tileInfo;
+extern __thread unsigned char *jpeg_buffer;
+extern __thread int jpeg_buffer_length;
+
+__thread int tilebuffersize = 0;	// Every thread that encodes tiles has its own tile buffer
+__thread void* tilebuffer = NULL;
+int scalebuffersize = 0;
+void* scalebuffer = NULL;
 int COMPRESSION_QUALITY = 50;
+int COMPRESSION_TYPE = 1;			// 1 = JPEG, with low color tiles such as text sent as lossless PNG. 2 = PNG only
+int COPY_RECT_ENABLED = 0;			// Set once the viewer has indicated that it supports MNG_KVM_COPY
+int COMPRESSION_RATIO_RESETS = 0;	// Incremented by set_tile_compression_ratio(), so every thread starts over from COMPRESSION_RATIO
+__thread int tile_compression_ratio = 0;		// COMPRESSION_RATIO as adjusted by this thread, for the tiles that it encodes
+__thread int tile_compression_ratio_resets = 0;
+uint64_t *rowhashes = NULL;				// Hash of every row of every column of tiles, for the current and previous frame
+int rowhashesvalid = 0;
+int rowhashcurrent = 0;
+int rowhashcols = 0;
+int rowhashrows = 0;
 
 /******************************************************************************
  * INTERNAL FUNCTIONS
@@ -52,7 +66,7 @@ int get_tile_buffer(int x, int y, void **buffer, long long bufferSize, void *des
 	int height = 0;
 
 	for (height = y; height < y + tileheight; height++) {
-		memcpy_s(target, (size_t)bufferSize, (const void *)(((char *)desktop) + (3 * ((height * adjust_screen_size(SCREEN_WIDTH)) + x))), (size_t)(tilewidth * 3));
+		memcpy_s(target, (size_t)bufferSize, (const void *)(((char *)desktop) + (3 * ((height * adjust_screen_size(SCALED_WIDTH)) + x))), (size_t)(tilewidth * 3));
 		target = (char *) (target + (3 * tilewidth));
 	}
 
@@ -60,24 +74,32 @@ int get_tile_buffer(int x, int y, void **buffer, long long bufferSize, void *des
 }
 
 //This function returns 0 and *buffer != NULL if everything was good. retval = jpegsize if the captured image was too large.
-int calc_opt_compr_send(int x, int y, int captureWidth, int captureHeight, void* desktop, long long desktopsize, void ** buffer, long long *bufferSize)
+int calc_opt_compr_send(int x, int y, int captureWidth, int captureHeight, void* desktop, long long desktopsize)
 {
-
-	*buffer = NULL;
-	*bufferSize = 0;
-
-	// Make sure a tile buffer is available. Most of the time, this is skipped.
-	if (tilebuffersize != captureWidth * captureHeight * 3)
+	// Make sure a tile buffer is available. It only grows, so it ends up the size of the largest coalesced tile, and is reused from then on.
+	if (tilebuffersize < captureWidth * captureHeight * 3)
 	{
 		if (tilebuffer != NULL) free(tilebuffer);
 		tilebuffersize = captureWidth * captureHeight * 3;
-		if ((tilebuffer = malloc(tilebuffersize)) == NULL) return 0;
+		if ((tilebuffer = malloc(tilebuffersize)) == NULL) { tilebuffersize = 0; return 0; }
 	}
 
 	//Get the final coalesced tile
 	get_tile_buffer(x, y, &tilebuffer, tilebuffersize, desktop, desktopsize, captureWidth, captureHeight);
 
-	write_JPEG_buffer(tilebuffer, captureWidth, captureHeight, COMPRESSION_QUALITY);
+	switch (COMPRESSION_TYPE)
+	{
+		case 2:
+			write_PNG_buffer(tilebuffer, captureWidth, captureHeight, 0);
+			break;
+		default:
+			// Tiles with few colors are text, window decorations and flat UI, which PNG keeps sharp in less space than JPEG
+			if (write_PNG_buffer(tilebuffer, captureWidth, captureHeight, PNG_MAX_COLORS) != 0)
+			{
+				write_JPEG_buffer(tilebuffer, captureWidth, captureHeight, COMPRESSION_QUALITY);
+			}
+			break;
+	}
 
 #if MAX_TILE_SIZE > 0
 	if (jpeg_buffer_length > MAX_TILE_SIZE)
@@ -139,31 +161,65 @@ void dump32bit (const XImage * input)
 }
 #endif
 
-// Really fast CRC-like method. Used for the KVM.
-int util_crc(int x, int y, long long bufferSize, void *desktop, long long desktopsize, int tilewidth, int tileheight)
+// Mixes 8 bytes into a 64 bit hash. The multiply and rotate make the hash depend on both the value and position of every byte
+#define TILE_HASH_MIX(h, w) { h ^= (w) * 0x87C37B91114253D5ULL; h = ((h << 31) | (h >> 33)) * 0x4CF5AD432745937FULL; }
+
+// Final avalanche, so that every input bit affects every output bit
+uint64_t util_hashfinal(uint64_t h)
 {
-    int hval = 0;
-    int *bp = NULL;
-    int *be = NULL;
-    int height = 0;
-
-    for (height = y; height < y + tileheight; height++) {
-    	bp = (int *)(((char *)desktop) + (3 * ((height * adjust_screen_size(SCREEN_WIDTH)) + x)));
-    	be = (int *)(((char *)desktop) + (3 * ((height * adjust_screen_size(SCREEN_WIDTH)) + x + tilewidth)));
-    	while ((bp + 1) <= be)
-		{
-			// hval *= 0x01000193;
-			hval += (hval << 1) + (hval << 4) + (hval << 7) + (hval << 8) + (hval << 24);
-			hval ^= *bp++;
-		}
+	h ^= h >> 33;
+	h *= 0xFF51AFD7ED558CCDULL;
+	h ^= h >> 33;
+	h *= 0xC4CEB9FE1A85EC53ULL;
+	h ^= h >> 33;
+	return h;
+}
 
-    	if (be - bp >= 0) {
-    		hval += (hval << 1) + (hval << 4) + (hval << 7) + (hval << 8) + (hval << 24);
-    		hval ^= (*(int *)(((char *)be) - 3));
-    	}
-    }
+// Mixes one row of pixels into a hash. Only reads the given length, which can be any number of bytes
+uint64_t util_hashrow(uint64_t h, char *row, int length)
+{
+	uint64_t w;
+	int i;
+
+	for (i = 0; i + 8 <= length; i += 8)
+	{
+		memcpy(&w, row + i, 8);
+		TILE_HASH_MIX(h, w);
+	}
+	if (i < length)
+	{
+		w = 0;
+		memcpy(&w, row + i, length - i);
+		TILE_HASH_MIX(h, w);
+	}
+	return h;
+}
+
+// 64 bit hash of the content of a tile
+uint64_t util_tilehash(int x, int y, void *desktop, int tilewidth, int tileheight)
+{
+	uint64_t h = 0x9E3779B97F4A7C15ULL;
+	int stride = adjust_screen_size(SCALED_WIDTH) * 3;
+	int height;
 
-    return hval;
+	for (height = y; height < y + tileheight; height++)
+	{
+		h = util_hashrow(h, ((char *)desktop) + ((long long)height * stride) + (x * 3), tilewidth * 3);
+	}
+	return util_hashfinal(h);
+}
+
+// Finds how far row y of a column of tiles moved since the last frame, checking the closest offsets first. The next row
+// must have moved by the same amount, so that a single matching row is not mistaken for a scroll.
+int util_rowshift(uint64_t *current, uint64_t *previous, int rows, int y, int *shift)
+{
+	int k;
+	for (k = 1; k < rows; ++k)
+	{
+		if (y + k + 1 < rows && current[y] == previous[y + k] && current[y + 1] == previous[y + k + 1]) { *shift = k; return 1; }
+		if (y - k >= 0 && current[y] == previous[y - k] && current[y + 1] == previous[y - k + 1]) { *shift = -k; return 1; }
+	}
+	return 0;
 }
 
 /******************************************************************************
@@ -180,149 +236,140 @@ int adjust_screen_size(int pixles)
 	return pixles;
 }
 
-// Reset the tile info structure
-int reset_tile_info(int old_height_count) {
+// Reset the tile info structure, for the current tile count. Every tile starts out dirty
+int reset_tile_info() {
+	int count = TILE_HEIGHT_COUNT * TILE_WIDTH_COUNT;
+
+	if (g_tileInfo.hash != NULL) { free(g_tileInfo.hash); g_tileInfo.hash = NULL; }
+	if (g_tileInfo.dirty != NULL) { free(g_tileInfo.dirty); g_tileInfo.dirty = NULL; }
+	if (g_tileInfo.owner != NULL) { free(g_tileInfo.owner); g_tileInfo.owner = NULL; }
+
+	if ((g_tileInfo.hash = (uint64_t *)calloc(count, sizeof(uint64_t))) == NULL) ILIBCRITICALEXIT(254);
+	if ((g_tileInfo.dirty = (uint32_t *)malloc(((count + 31) / 32) * sizeof(uint32_t))) == NULL) ILIBCRITICALEXIT(254);
+	if ((g_tileInfo.owner = (unsigned char *)calloc(count, 1)) == NULL) ILIBCRITICALEXIT(254);
+	g_tileInfo.count = count;
+	invalidate_tile_info();
+
+	return 0;
+}
+
+// Marks every tile as dirty, so they are all sent again
+void invalidate_tile_info()
+{
+	if (g_tileInfo.dirty == NULL || g_tileInfo.count != TILE_HEIGHT_COUNT * TILE_WIDTH_COUNT) { reset_tile_info(); return; }
+	memset(g_tileInfo.dirty, 0xFF, ((g_tileInfo.count + 31) / 32) * sizeof(uint32_t));
+}
+
+// Gives the tiles whose top left corner is inside the rectangle to a worker. The rectangle is in scaled pixels
+void set_tile_owner(int x, int y, int width, int height, int owner)
+{
 	int row, col;
 
-	if (g_tileInfo != NULL) {
-		for (row = 0; row < old_height_count; row++) {
-			free(g_tileInfo[row]);
+	if (g_tileInfo.owner == NULL || g_tileInfo.count != TILE_HEIGHT_COUNT * TILE_WIDTH_COUNT) { return; }
+	for (row = (y + TILE_HEIGHT - 1) / TILE_HEIGHT; row < TILE_HEIGHT_COUNT && row * TILE_HEIGHT < y + height; ++row)
+	{
+		for (col = (x + TILE_WIDTH - 1) / TILE_WIDTH; col < TILE_WIDTH_COUNT && col * TILE_WIDTH < x + width; ++col)
+		{
+			g_tileInfo.owner[TILE_INDEX(row, col)] = (unsigned char)owner;
 		}
-		free(g_tileInfo);
-		g_tileInfo = NULL;
 	}
+}
 
-	if ((g_tileInfo = (struct tileInfo_t **) malloc (sizeof(struct tileInfo_t *) * TILE_HEIGHT_COUNT)) == NULL) ILIBCRITICALEXIT(254);
+// Hashes the tiles of a worker, and marks the ones that changed as dirty. Workers can run at the same time, but the tile info
+// must not be reset while they do.
+void update_tile_info(void *desktop, long long desktopsize, int owner)
+{
+	int row, col, i;
+	uint64_t h;
+
+	if (g_tileInfo.count != TILE_HEIGHT_COUNT * TILE_WIDTH_COUNT) { return; }
+	if ((long long)adjust_screen_size(SCALED_WIDTH) * 3 * TILE_HEIGHT * TILE_HEIGHT_COUNT > desktopsize) { return; }
 
-	for (row = 0; row < TILE_HEIGHT_COUNT; row++) {
-		if ((g_tileInfo[row] = (struct tileInfo_t *)calloc(TILE_WIDTH_COUNT, sizeof(struct tileInfo_t))) == NULL) ILIBCRITICALEXIT(254);
-		for (col = 0; col < TILE_WIDTH_COUNT; col++) {
-			g_tileInfo[row][col].crc = 0xff;
+	for (row = 0, i = 0; row < TILE_HEIGHT_COUNT; ++row)
+	{
+		for (col = 0; col < TILE_WIDTH_COUNT; ++col, ++i)
+		{
+			if (g_tileInfo.owner[i] != owner) { continue; }
+			h = util_tilehash(col * TILE_WIDTH, row * TILE_HEIGHT, desktop, TILE_WIDTH, TILE_HEIGHT);
+			if (h != g_tileInfo.hash[i])
+			{
+				g_tileInfo.hash[i] = h;
+				TILE_SET_DIRTY(i);
+			}
 		}
 	}
+}
 
-	return 0;
+// Returns the first dirty tile at or after index, or -1. Clean tiles are skipped 32 at a time
+int next_dirty_tile(int index)
+{
+	uint32_t word;
+	int i;
+
+	while (index < g_tileInfo.count)
+	{
+		word = g_tileInfo.dirty[index >> 5] >> (index & 31);
+		if (word != 0)
+		{
+			i = index + __builtin_ctz(word);
+			return(i < g_tileInfo.count ? i : -1);
+		}
+		index = (index | 31) + 1;
+	}
+	return(-1);
 }
 
-//Fetches the encoded jpeg tile at the given location. The neighboring tiles are coalesced to form a larger jpeg before returning.
-int getTileAt(int x, int y, void** buffer, long long *bufferSize, void *desktop, long long desktopsize, int row, int col)
+//Fetches the encoded jpeg tile at the given location. The neighboring tiles of the same worker are coalesced to form a larger jpeg before returning.
+int getTileAt(int x, int y, struct tileFrame_t *frame, void *desktop, long long desktopsize, int row, int col)
 {
-	int CRC, rcol, i, r, c;
+	int rcol, r, c;
+	unsigned char owner = g_tileInfo.owner[TILE_INDEX(row, col)];
 	int rightcol = col; //Used in coalescing. Indicates the rightmost column to be coalesced.
 	int botrow = row; //Used in coalescing. Indicates the bottom most row to be coalesced.
-	int r_x = x;
-	int r_y = y;
 	int captureWidth = TILE_WIDTH;
 	int captureHeight = TILE_HEIGHT;
 
-	*buffer = NULL; // If anything fails, this will be the indication.
-	*bufferSize = 0;
+	if (!TILE_IS_DIRTY(TILE_INDEX(row, col))) return 0; //The viewer already has this tile
 
-	if (g_tileInfo[row][col].flag == TILE_TODO) { //First check whether the tile-crc needs to be calculated or not.
-		if ((CRC = util_crc(x, y, TILE_HEIGHT * TILE_WIDTH * 3, desktop, desktopsize, TILE_WIDTH, TILE_HEIGHT)) == g_tileInfo[row][col].crc) return 0;
-		g_tileInfo[row][col].crc = CRC; //Update the tile CRC in the global data structure.
+#if MAX_TILE_SIZE > 0
+	// Every worker adjusts its own ratio, COMPRESSION_RATIO is only set by the mainloop, between frames
+	if (tile_compression_ratio == 0 || tile_compression_ratio_resets != COMPRESSION_RATIO_RESETS)
+	{
+		tile_compression_ratio = COMPRESSION_RATIO;
+		tile_compression_ratio_resets = COMPRESSION_RATIO_RESETS;
 	}
-
-	g_tileInfo[row][col].flag = TILE_MARKED_NOT_SENT;
+#endif
 
 	//COALESCING SECTION
 
 	// First got to the right most changed tile and record it
-	while (rightcol + 1 < TILE_WIDTH_COUNT) {
-		rightcol++;
-		r_x = rightcol * TILE_WIDTH;
-
-		CRC = g_tileInfo[row][rightcol].crc;
-
-		if (g_tileInfo[row][rightcol].flag == TILE_TODO) {
-			CRC = util_crc(r_x, y, TILE_HEIGHT * TILE_WIDTH * 3, desktop, desktopsize, TILE_WIDTH, TILE_HEIGHT);
-		}
-
-		if (CRC != g_tileInfo[row][rightcol].crc || g_tileInfo[row][rightcol].flag == TILE_MARKED_NOT_SENT) { //If the tile has changed, increment the capturewidth.
-			g_tileInfo[row][rightcol].crc = CRC;
-
+	while (rightcol + 1 < TILE_WIDTH_COUNT && TILE_IS_DIRTY(TILE_INDEX(row, rightcol + 1)) && g_tileInfo.owner[TILE_INDEX(row, rightcol + 1)] == owner) {
 #if MAX_TILE_SIZE > 0
-			//Here we check whether the size of the coalesced bitmap is greater than the threshold (MAX_TILE_SIZE)
-			if ((captureWidth + TILE_WIDTH) * TILE_HEIGHT * 3 / COMPRESSION_RATIO > MAX_TILE_SIZE)
-			{
-				g_tileInfo[row][rightcol].flag = TILE_MARKED_NOT_SENT;
-				--rightcol;
-				break;
-			}
+		//Here we check whether the size of the coalesced bitmap is greater than the threshold (MAX_TILE_SIZE)
+		if ((captureWidth + TILE_WIDTH) * TILE_HEIGHT * 3 / tile_compression_ratio > MAX_TILE_SIZE) { break; }
 #endif
-
-			g_tileInfo[row][rightcol].flag = TILE_MARKED_NOT_SENT;
-			captureWidth += TILE_WIDTH;
-		}
-		else {
-			g_tileInfo[row][rightcol].flag = TILE_DONT_SEND;
-			--rightcol;
-			break;
-		}
+		rightcol++;
+		captureWidth += TILE_WIDTH;
 	}
 
-	//int TOLERANCE = (rightcol - col) / 3;
-
 	// Now go to the bottom tiles, check if they have changed and record them
 #if MAX_TILE_SIZE > 0
-	while ((botrow + 1 < TILE_HEIGHT_COUNT) && ((captureHeight + TILE_HEIGHT) * captureWidth * 3 / COMPRESSION_RATIO <= MAX_TILE_SIZE))
+	while ((botrow + 1 < TILE_HEIGHT_COUNT) && ((captureHeight + TILE_HEIGHT) * captureWidth * 3 / tile_compression_ratio <= MAX_TILE_SIZE))
 #else
 	while ((botrow + 1 < TILE_HEIGHT_COUNT))
 #endif
 	{
-		botrow++;
-		r_y = botrow * TILE_HEIGHT;
 		int fail = 0;
-		r_x = x;
-
-		//int missCount = 0;
 
 		for (rcol = col; rcol <= rightcol; rcol++) {
-
-			CRC = g_tileInfo[botrow][rcol].crc;
-			if (g_tileInfo[botrow][rcol].flag == TILE_TODO) {
-				CRC = util_crc(r_x, r_y, TILE_HEIGHT * TILE_WIDTH * 3, desktop, desktopsize, TILE_WIDTH, TILE_HEIGHT);
-			}
-
-			if (CRC != g_tileInfo[botrow][rcol].crc || g_tileInfo[botrow][rcol].flag == TILE_MARKED_NOT_SENT) {
-				g_tileInfo[botrow][rcol].flag = TILE_MARKED_NOT_SENT;
-				g_tileInfo[botrow][rcol].crc = CRC;
-				r_x += TILE_WIDTH;
-			}
-			else {
-				/*//Keep this part commented. Adding tolerance adds to the complexity of this code.
-				missCount++;
-
-				if (missCount > TOLERANCE) {
-					fail = 1;
-					for (int i = col; i < rcol; i++) {
-						if (g_tileInfo[botrow][i].flag == TILE_SKIPPED) {
-							g_tileInfo[botrow][i].flag = TILE_DONT_SEND;
-						}
-						else {
-							g_tileInfo[botrow][i].flag = TILE_MARKED_NOT_SENT;
-						}
-					}
-					g_tileInfo[botrow][rcol].flag = TILE_DONT_SEND;
-					botrow--;
-					break;
-				}
-				else {
-					g_tileInfo[botrow][rcol].flag = TILE_SKIPPED;
-					g_tileInfo[botrow][rcol].crc = CRC;
-					r_x += TILE_WIDTH;
-				}*/
+			if (!TILE_IS_DIRTY(TILE_INDEX(botrow + 1, rcol)) || g_tileInfo.owner[TILE_INDEX(botrow + 1, rcol)] != owner) {
 				fail = 1;
-				for (i = col; i < rcol; i++) {
-					g_tileInfo[botrow][i].flag = TILE_MARKED_NOT_SENT;
-				}
-				g_tileInfo[botrow][rcol].flag = TILE_DONT_SEND;
-				botrow--;
 				break;
 			}
 		}
 
 		if (!fail) {
+			botrow++;
 			captureHeight += TILE_HEIGHT;
 		}
 		else {
@@ -331,29 +378,32 @@ int getTileAt(int x, int y, void** buffer, long long *bufferSize, void *desktop,
 	}
 
 	int retval = 0;
+
+	// The tile is encoded straight into the frame, after room for its header
+	set_compression_output(&frame->buffer, &frame->size, frame->length + 8);
 #if MAX_TILE_SIZE == 0
-	retval = calc_opt_compr_send(x, y, captureWidth, captureHeight, desktop, desktopsize, buffer, bufferSize);
+	retval = calc_opt_compr_send(x, y, captureWidth, captureHeight, desktop, desktopsize);
 #else
 	int firstTime = 1;
 
 	//This loop is used to adjust the COMPRESSION_RATIO. This loop runs only once most of the time.
 	do {
 		//retval here is 0 if everything was good. It is > 0 if it contains the size of the jpeg that was created and not sent.
-		retval = calc_opt_compr_send(x, y, captureWidth, captureHeight, desktop, desktopsize, buffer, bufferSize);
+		retval = calc_opt_compr_send(x, y, captureWidth, captureHeight, desktop, desktopsize);
 		if (retval != 0) {
 			if (firstTime) {
 				// Re-adjust the compression ratio.
-				COMPRESSION_RATIO = (int)(((double)COMPRESSION_RATIO/(double)retval) * (0.92 * MAX_TILE_SIZE)); //Magic number: 92% of MAX_TILE_SIZE
-				if (COMPRESSION_RATIO <= 1) { COMPRESSION_RATIO = 2; }
+				tile_compression_ratio = (int)(((double)tile_compression_ratio/(double)retval) * (0.92 * MAX_TILE_SIZE)); //Magic number: 92% of MAX_TILE_SIZE
+				if (tile_compression_ratio <= 1) { tile_compression_ratio = 2; }
 				firstTime = 0;
 			}
 
-			if (botrow > row) { //First time, try reducing the height.
-				botrow = row + ((botrow - row + 1) / 2);
+			if (botrow > row) { //First time, try reducing the height. Half of the rows are kept, rounded down, so two rows become one
+				botrow = row + ((botrow - row + 1) / 2) - 1;
 				captureHeight = (botrow - row + 1) * TILE_HEIGHT;
 			}
 			else if (rightcol > col){ //If it is not possible, reduce the width
-				rightcol = col + ((rightcol - col + 1) / 2);
+				rightcol = col + ((rightcol - col + 1) / 2) - 1;
 				captureWidth = (rightcol - col + 1) * TILE_WIDTH;
 			}
 			else { //This never happens in any case.
@@ -365,129 +415,337 @@ int getTileAt(int x, int y, void** buffer, long long *bufferSize, void *desktop,
 	} while (retval != 0);
 #endif
 
-	//Set the flags to TILE_SENT
+	//Write the header of the tile in front of it, and clear the dirty bits of the tiles it covers
 	if (jpeg_buffer != NULL) 
 	{
-		*bufferSize = jpeg_buffer_length + (jpeg_buffer_length > 65500 ? 16 : 8);
-		*buffer = malloc(*bufferSize);
+		char header[16];
+		size_t headerSize = jpeg_buffer_length > 65500 ? 16 : 8;
+		size_t tileSize = headerSize + jpeg_buffer_length;
 
 		if (jpeg_buffer_length > 65500)
 		{
-			((unsigned short*)*buffer)[0] = (unsigned short)htons((unsigned short)MNG_JUMBO);		// Write the type
-			((unsigned short*)*buffer)[1] = (unsigned short)htons((unsigned short)8);				// Write the size
-			((unsigned int*)*buffer)[1] = (unsigned int)htonl(jpeg_buffer_length + 8);				// Size of the Next Packet
-			((unsigned short*)*buffer)[4] = (unsigned short)htons((unsigned short)MNG_KVM_PICTURE);	// Write the type
-			((unsigned short*)*buffer)[5] = 0;														// RESERVED
-			((unsigned short*)*buffer)[6] = (unsigned short)htons((unsigned short)x);				// X position
-			((unsigned short*)*buffer)[7] = (unsigned short)htons((unsigned short)y);				// Y position
-			memcpy_s((char *)(*buffer) + 16, *bufferSize -16, jpeg_buffer, jpeg_buffer_length);
+			// Jumbo tiles need a larger header, so move the image up to make room for it
+			if (frame->length + tileSize > frame->size)
+			{
+				frame->size = frame->length + tileSize;
+				if ((frame->buffer = (char*)realloc(frame->buffer, frame->size)) == NULL) { ILIBCRITICALEXIT(254); }
+			}
+			memmove(frame->buffer + frame->length + 16, frame->buffer + frame->length + 8, jpeg_buffer_length);
+
+			((unsigned short*)header)[0] = (unsigned short)htons((unsigned short)MNG_JUMBO);		// Write the type
+			((unsigned short*)header)[1] = (unsigned short)htons((unsigned short)8);				// Write the size
+			((unsigned int*)header)[1] = (unsigned int)htonl(jpeg_buffer_length + 8);				// Size of the Next Packet
+			((unsigned short*)header)[4] = (unsigned short)htons((unsigned short)MNG_KVM_PICTURE);	// Write the type
+			((unsigned short*)header)[5] = 0;														// RESERVED
+			((unsigned short*)header)[6] = (unsigned short)htons((unsigned short)x);				// X position
+			((unsigned short*)header)[7] = (unsigned short)htons((unsigned short)y);				// Y position
 		}
 		else
 		{
-			((unsigned short*)*buffer)[0] = (unsigned short)htons((unsigned short)MNG_KVM_PICTURE);	// Write the type
-			((unsigned short*)*buffer)[1] = (unsigned short)htons((unsigned short)*bufferSize);		// Write the size
-			((unsigned short*)*buffer)[2] = (unsigned short)htons((unsigned short)x);				// X position
-			((unsigned short*)*buffer)[3] = (unsigned short)htons((unsigned short)y);				// Y position
-			memcpy_s((char *)(*buffer) + 8, *bufferSize -8, jpeg_buffer, jpeg_buffer_length);
+			((unsigned short*)header)[0] = (unsigned short)htons((unsigned short)MNG_KVM_PICTURE);	// Write the type
+			((unsigned short*)header)[1] = (unsigned short)htons((unsigned short)tileSize);		// Write the size
+			((unsigned short*)header)[2] = (unsigned short)htons((unsigned short)x);				// X position
+			((unsigned short*)header)[3] = (unsigned short)htons((unsigned short)y);				// Y position
 		}
 
-		free(jpeg_buffer);
-		jpeg_buffer = NULL;
-		jpeg_buffer_length = 0;
+		memcpy_s(frame->buffer + frame->length, frame->size - frame->length, header, headerSize);
+		frame->length += tileSize;
 
 		for (r = row; r <= botrow; r++) {
 			for (c = col; c <= rightcol; c++) {
-				g_tileInfo[r][c].flag = TILE_SENT;
+				TILE_CLEAR_DIRTY(TILE_INDEX(r, c));
 			}
 		}
 	}
+	set_compression_output(NULL, NULL, 0);
 
 	return retval;
 }
 
 
-// Get screen buffer from the XImage structure
-int getScreenBuffer(char **desktop, long long *desktopsize, XImage *image)
+// Detects content that scrolled vertically since the last frame, and appends MNG_KVM_COPY commands for it to the frame,
+// so the viewer moves what it already has instead of receiving the tiles again. Must be called before any tile of the
+// frame is fetched. The tiles that a copy brings up to date are no longer dirty.
+//
+// MNG_KVM_COPY: [type][size = 16][srcX][srcY][width][height][dstX][dstY], all unsigned short. The source and destination can overlap.
+void getCopyRects(struct tileFrame_t *frame, void *desktop, long long desktopsize)
 {
-	long long size = adjust_screen_size(SCREEN_WIDTH) * adjust_screen_size(SCREEN_HEIGHT) * 3;
-	int row, col, i, width_padding_size = 0, height_padding_size = 0;
-	char *output;
-	register unsigned char* tmpPtr2 = (unsigned char *)image->data;
-	register unsigned short* tmpPtr3 = (unsigned short *)image->data;
-	register unsigned int
-		rm = image->red_mask,
-		gm = image->green_mask,
-		bm = image->blue_mask,
-		rs = 16,
-		gs = 8,
-		bs = 0, *tmpPtr = (unsigned int *) image->data;
-	int bpp = image->bits_per_pixel;
+	int rows = adjust_screen_size(SCALED_HEIGHT), cols = TILE_WIDTH_COUNT;
+	int stride = adjust_screen_size(SCALED_WIDTH) * 3;
+	uint64_t *current, *previous;
+	int votes[8][2], voteCount = 0;
+	int c, c0, y, i, r, samples, shift, run, best, bestStart;
+	int *start, *end;
+
+	if (COPY_RECT_ENABLED == 0 || g_tileInfo.count != TILE_HEIGHT_COUNT * TILE_WIDTH_COUNT || (long long)stride * rows > desktopsize) { return; }
+	if (rowhashes == NULL || rowhashcols != cols || rowhashrows != rows)
+	{
+		if (rowhashes != NULL) { free(rowhashes); }
+		if ((rowhashes = (uint64_t*)malloc(sizeof(uint64_t) * ((2 * cols * rows) + cols))) == NULL) ILIBCRITICALEXIT(254);
+		rowhashcols = cols;
+		rowhashrows = rows;
+		rowhashesvalid = 0;
+	}
+	// The two halves of the buffer alternate between the current and the previous frame
+	current = rowhashes + (rowhashcurrent * cols * rows);
+	previous = rowhashes + ((1 - rowhashcurrent) * cols * rows);
+	start = (int *)(rowhashes + (2 * cols * rows));
+	end = start + cols;
 
-	if (*desktopsize != size) {
-		if (*desktop != NULL) { free(*desktop); }
-		*desktopsize = size;
-		if ((*desktop = (char *) malloc (*desktopsize + 4)) == NULL) ILIBCRITICALEXIT(254);
+	for (c = 0; c < cols; ++c)
+	{
+		for (y = 0; y < rows; ++y)
+		{
+			current[(c * rows) + y] = util_hashrow(0x9E3779B97F4A7C15ULL, ((char *)desktop) + ((long long)y * stride) + (c * TILE_WIDTH * 3), TILE_WIDTH * 3);
+		}
+	}
+	rowhashcurrent = 1 - rowhashcurrent;
+	if (rowhashesvalid == 0) { rowhashesvalid = 1; return; }
+
+	// Vote on the scroll offset, from a few changed rows of each column of tiles
+	for (c = 0; c < cols; ++c)
+	{
+		uint64_t *cur = current + (c * rows), *prev = previous + (c * rows);
+		for (y = 1, samples = 0; y + 1 < rows && samples < 4; ++y)
+		{
+			if (cur[y] == prev[y] || cur[y] == cur[y - 1]) { continue; }
+			++samples;
+			if (util_rowshift(cur, prev, rows, y, &shift) == 0) { continue; }
+			for (i = 0; i < voteCount && votes[i][0] != shift; ++i);
+			if (i < voteCount) { ++votes[i][1]; }
+			else if (voteCount < 8) { votes[voteCount][0] = shift; votes[voteCount++][1] = 1; }
+		}
 	}
+	if (voteCount == 0) { return; }
+	for (i = 1, shift = 0; i < voteCount; ++i) { if (votes[i][1] > votes[shift][1]) { shift = i; } }
+	shift = votes[shift][0];
+
+	// In each column of tiles, find the longest run of rows that moved by shift, and the whole tiles it covers
+	for (c = 0; c < cols; ++c)
+	{
+		uint64_t *cur = current + (c * rows), *prev = previous + (c * rows);
+		int changed = 0;
+
+		start[c] = end[c] = 0;
+		for (y = (shift < 0 ? -shift : 0), run = 0, best = 0, bestStart = 0; y < (shift > 0 ? rows - shift : rows); ++y)
+		{
+			if (cur[y] == prev[y + shift]) { if (++run > best) { best = run; bestStart = y - run + 1; } }
+			else { run = 0; }
+		}
+		r = (bestStart + TILE_HEIGHT - 1) / TILE_HEIGHT;
+		i = (bestStart + best) / TILE_HEIGHT;
+		if (r >= i) { continue; }
 
-	if (bpp == 16) {
-		rs = 11;
-		gs = 5;
+		// Only worth a copy if the content actually changed, and the viewer has all of the source tiles
+		for (y = r * TILE_HEIGHT; y < i * TILE_HEIGHT && changed == 0; ++y) { changed = cur[y] != prev[y]; }
+		for (y = ((r * TILE_HEIGHT) + shift) / TILE_HEIGHT; changed != 0 && y <= (((i * TILE_HEIGHT) + shift - 1) / TILE_HEIGHT); ++y)
+		{
+			if (TILE_IS_DIRTY(TILE_INDEX(y, c))) { changed = 0; }
+		}
+		if (changed != 0) { start[c] = r; end[c] = i; }
 	}
-	output = *desktop;
-
-	for (row = 0; row < image->height; row++) {
-		for (col = 0; col < image->width; col++) {
-			if (bpp == 16) {
-				*output++ = ((*tmpPtr3 >> rs) & 0x01f) << 3;
-				*output++ = ((*tmpPtr3 >> gs) & 0x03f) << 2;
-				*output++ = ((*tmpPtr3 >> bs) & 0x01f) << 3;
-				tmpPtr3++;
+
+	// Adjacent columns that cover the same tiles are sent as a single copy
+	for (c0 = 0; c0 < cols; c0 = c)
+	{
+		for (c = c0 + 1; c < cols && start[c] == start[c0] && end[c] == end[c0]; ++c);
+		if (start[c0] == end[c0]) { continue; }
+
+		char header[16];
+		int dstY = start[c0] * TILE_HEIGHT, height = (end[c0] - start[c0]) * TILE_HEIGHT;
+		int x = c0 * TILE_WIDTH, width = (c - c0) * TILE_WIDTH;
+
+		if (x + width > SCALED_WIDTH) { width = SCALED_WIDTH - x; }
+		if (dstY + height > SCALED_HEIGHT) { height = SCALED_HEIGHT - dstY; }
+		if (dstY + shift + height > SCALED_HEIGHT) { height = SCALED_HEIGHT - (dstY + shift); }
+		if (width <= 0 || height <= 0) { continue; }
+
+		((unsigned short*)header)[0] = (unsigned short)htons((unsigned short)MNG_KVM_COPY);	// Write the type
+		((unsigned short*)header)[1] = (unsigned short)htons((unsigned short)16);				// Write the size
+		((unsigned short*)header)[2] = (unsigned short)htons((unsigned short)x);				// Source X position
+		((unsigned short*)header)[3] = (unsigned short)htons((unsigned short)(dstY + shift));	// Source Y position
+		((unsigned short*)header)[4] = (unsigned short)htons((unsigned short)width);			// Width
+		((unsigned short*)header)[5] = (unsigned short)htons((unsigned short)height);			// Height
+		((unsigned short*)header)[6] = (unsigned short)htons((unsigned short)x);				// Destination X position
+		((unsigned short*)header)[7] = (unsigned short)htons((unsigned short)dstY);			// Destination Y position
+
+		if (frame->length + sizeof(header) > frame->size)
+		{
+			frame->size = frame->size * 2 > frame->length + sizeof(header) ? frame->size * 2 : frame->length + sizeof(header);
+			if ((frame->buffer = (char*)realloc(frame->buffer, frame->size)) == NULL) { ILIBCRITICALEXIT(254); }
+		}
+		memcpy_s(frame->buffer + frame->length, frame->size - frame->length, header, sizeof(header));
+		frame->length += sizeof(header);
+
+		// The viewer now has the current content of these tiles
+		for (r = start[c0]; r < end[c0]; ++r)
+		{
+			for (i = c0; i < c; ++i)
+			{
+				g_tileInfo.hash[TILE_INDEX(r, i)] = util_tilehash(i * TILE_WIDTH, r * TILE_HEIGHT, desktop, TILE_WIDTH, TILE_HEIGHT);
+				TILE_CLEAR_DIRTY(TILE_INDEX(r, i));
 			}
-			else if (bpp == 24) {
-				*output++ = *(tmpPtr2 + 2);
-				*output++ = *(tmpPtr2 + 1);
-				*output++ = *tmpPtr2;
-				tmpPtr2 += 3;
+		}
+	}
+}
+
+// Converts one row of the captured image to 24 bit RGB
+void getScreenRow(unsigned char *output, XImage *image, int row)
+{
+	unsigned char *input = (unsigned char *)image->data + ((long long)row * image->bytes_per_line);
+	unsigned int rm = image->red_mask, gm = image->green_mask, bm = image->blue_mask;
+	unsigned int pixel;
+	int col;
+
+	switch (image->bits_per_pixel)
+	{
+		case 16:
+			for (col = 0; col < image->width; col++, input += 2)
+			{
+				pixel = *((unsigned short *)input);
+				*output++ = ((pixel >> 11) & 0x01f) << 3;
+				*output++ = ((pixel >> 5) & 0x03f) << 2;
+				*output++ = (pixel & 0x01f) << 3;
 			}
-			else {
-				*output++ = ((*tmpPtr & rm) >> rs);
-				*output++ = ((*tmpPtr & gm) >> gs);
-				*output++ = ((*tmpPtr & bm) >> bs);
-				tmpPtr = (unsigned int *) (((char *)tmpPtr) + (image->bits_per_pixel >> 3));
-				//tmpPtr++;		     // ignore alpha values
+			break;
+		case 24:
+			for (col = 0; col < image->width; col++, input += 3)
+			{
+				*output++ = input[2];
+				*output++ = input[1];
+				*output++ = input[0];
 			}
-		}
-		//
-		// eat padded bytes, for better speed we use shifting,
-		// (bytes_per_line - bits_per_pixel / 8 * width ) / 4
+			break;
+		default:
+			for (col = 0; col < image->width; col++, input += 4)
+			{
+				pixel = *((unsigned int *)input);	// ignore alpha values
+				*output++ = (pixel & rm) >> 16;
+				*output++ = (pixel & gm) >> 8;
+				*output++ = (pixel & bm);
+			}
+			break;
+	}
+}
+
+// Box filters the captured image down (or up) to SCALED_WIDTH x SCALED_HEIGHT. Each output pixel is the
+// average of the source pixels it covers, so text stays readable when the remote view is reduced.
+void getScaledScreenBuffer(char *desktop, XImage *image, int stride)
+{
+	int srcWidth = image->width, srcHeight = image->height;
+	int dstWidth = SCALED_WIDTH, dstHeight = SCALED_HEIGHT;
+	long long size = (srcWidth * 3) + (dstWidth * 3 * sizeof(unsigned int)) + ((dstWidth + 1) * sizeof(int));
+	unsigned char *line, *output;
+	unsigned int *sum;
+	int *spans;
+	int x, y, sx, sy, y0, y1, area, i;
+
+	if (scalebuffersize != size)
+	{
+		if (scalebuffer != NULL) { free(scalebuffer); }
+		scalebuffersize = (int)size;
+		if ((scalebuffer = malloc(size)) == NULL) ILIBCRITICALEXIT(254);
+	}
+	sum = (unsigned int *)scalebuffer;
+	spans = (int *)(sum + (dstWidth * 3));
+	line = (unsigned char *)(spans + dstWidth + 1);
 
-		tmpPtr += (image->bytes_per_line - (image->bits_per_pixel >> 3)
-			* image->width) >> 2;
+	// Source column where each output column starts. Every output column covers at least one source column.
+	for (x = 0; x <= dstWidth; x++) { spans[x] = (int)(((long long)x * srcWidth) / dstWidth); }
+	for (x = 0; x < dstWidth; x++) { if (spans[x] >= srcWidth) { spans[x] = srcWidth - 1; } }
 
-		width_padding_size = (adjust_screen_size(SCREEN_WIDTH) - image->width) * 3;
+	for (y = 0; y < dstHeight; y++)
+	{
+		y0 = (int)(((long long)y * srcHeight) / dstHeight);
+		y1 = (int)(((long long)(y + 1) * srcHeight) / dstHeight);
+		if (y0 >= srcHeight) { y0 = srcHeight - 1; }
+		if (y1 <= y0) { y1 = y0 + 1; }
 
-		if (width_padding_size != 0) {
-			for (i = 0; i < width_padding_size; i++) {
-				*output++ = 0;
+		memset(sum, 0, dstWidth * 3 * sizeof(unsigned int));
+		for (sy = y0; sy < y1; sy++)
+		{
+			getScreenRow(line, image, sy);
+			for (x = 0; x < dstWidth; x++)
+			{
+				unsigned int r = 0, g = 0, b = 0;
+				int x1 = spans[x + 1] > spans[x] ? spans[x + 1] : spans[x] + 1;
+				for (sx = spans[x]; sx < x1; sx++)
+				{
+					r += line[sx * 3];
+					g += line[(sx * 3) + 1];
+					b += line[(sx * 3) + 2];
+				}
+				sum[x * 3] += r;
+				sum[(x * 3) + 1] += g;
+				sum[(x * 3) + 2] += b;
 			}
 		}
+
+		output = (unsigned char *)desktop + ((long long)y * stride);
+		for (x = 0; x < dstWidth; x++)
+		{
+			area = (y1 - y0) * ((spans[x + 1] > spans[x] ? spans[x + 1] : spans[x] + 1) - spans[x]);
+			for (i = 0; i < 3; ++i) { *output++ = (unsigned char)(sum[(x * 3) + i] / area); }
+		}
 	}
+}
 
-	height_padding_size = adjust_screen_size(SCREEN_HEIGHT) - image->height;
+// Get screen buffer from the XImage structure
+int getScreenBuffer(char **desktop, long long *desktopsize, XImage *image)
+{
+	int stride = adjust_screen_size(SCALED_WIDTH) * 3;
+	long long size = (long long)stride * adjust_screen_size(SCALED_HEIGHT);
+	int row, width, height;
 
-	if (height_padding_size != 0) {
-		for (row = 0; row < height_padding_size; row++) {
-			for (col = 0; col < (image->width * 3) + width_padding_size; col++) {
-				*output++ = 0;
-			}
+	if (*desktopsize != size) {
+		if (*desktop != NULL) { free(*desktop); }
+		*desktopsize = size;
+		if ((*desktop = (char *) malloc (*desktopsize + 4)) == NULL) ILIBCRITICALEXIT(254);
+	}
+
+	if (SCALED_WIDTH == image->width && SCALED_HEIGHT == image->height)
+	{
+		for (row = 0; row < image->height; row++)
+		{
+			getScreenRow((unsigned char *)*desktop + ((long long)row * stride), image, row);
 		}
 	}
+	else
+	{
+		getScaledScreenBuffer(*desktop, image, stride);
+	}
+
+	// Zero the padding up to a multiple of the tile size
+	width = SCALED_WIDTH * 3;
+	height = SCALED_HEIGHT;
+	if (width < stride)
+	{
+		for (row = 0; row < height; row++) { memset(*desktop + ((long long)row * stride) + width, 0, stride - width); }
+	}
+	if (size > (long long)height * stride)
+	{
+		memset(*desktop + ((long long)height * stride), 0, (size_t)(size - ((long long)height * stride)));
+	}
 
 	return 0;
 }
 
 
+// Frees the tile and PNG buffers of the calling thread
+void free_tile_buffers()
+{
+	if (tilebuffer != NULL) { free(tilebuffer); tilebuffer = NULL; }
+	tilebuffersize = 0;
+	free_compression_buffers();
+}
+
 // Set the compression quality
+// Sets the ratio that getTileAt() starts from, on every thread. Only called by the mainloop, while the workers are idle
+void set_tile_compression_ratio(int ratio)
+{
+	COMPRESSION_RATIO = ratio;
+	++COMPRESSION_RATIO_RESETS;
+}
 void set_tile_compression(int type, int level)
 {
 	if (level > 0 && level <= 100) {
@@ -497,5 +755,6 @@ void set_tile_compression(int type, int level)
 		COMPRESSION_QUALITY = 60;
 	}
 
-	//  TODO Make sure the all the types are handled. We ignore the type variable for now.
+	// Same types as the Windows agent. TIFF and anything else is sent as JPEG.
+	COMPRESSION_TYPE = type == 2 ? 2 : 1;
 }
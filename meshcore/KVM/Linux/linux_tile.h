@@ -22,26 +22,42 @@ limitations under the License.
 #include <X11/Xlib.h>
 #include <string.h>
 #include <arpa/inet.h>
+#include <stdint.h>
 #include "linux_compression.h"
 
-enum TILE_FLAGS_ENUM {
-	TILE_TODO,						//The tile CRC needs to be calculated.
-	TILE_SENT,						//CRC has been calculated and the tile has been sent.
-	TILE_MARKED_NOT_SENT,   		//CRC has been calculated, but the tile was not sent.
-	TILE_DONT_SEND		  //CRC has been calculated, tile need not be sent.
-	//TILE_SKIPPED		  //CRC has been calculated, tile need not be sent, but was skipped to include a greater region
+// State of every tile, in flat arrays indexed by TILE_INDEX(row, col)
+struct tileInfo_t {
+	uint64_t *hash;			// Hash of the current content of each tile
+	uint32_t *dirty;		// One bit per tile, set while the viewer doesn't have the current content
+	unsigned char *owner;	// Worker that hashes and encodes each tile
+	int count;				// Number of tiles
 };
 
-struct tileInfo_t {
-	int crc;
-	enum TILE_FLAGS_ENUM flag;
+#define TILE_INDEX(row, col) (((row) * TILE_WIDTH_COUNT) + (col))
+#define TILE_IS_DIRTY(i) ((g_tileInfo.dirty[(i) >> 5] >> ((i) & 31)) & 1)
+// Neighboring tiles can belong to different workers, so the bits are changed atomically. The words are 32 bits, which every target can do without a lock
+#define TILE_SET_DIRTY(i) __sync_fetch_and_or(&g_tileInfo.dirty[(i) >> 5], ((uint32_t)1 << ((i) & 31)))
+#define TILE_CLEAR_DIRTY(i) __sync_fetch_and_and(&g_tileInfo.dirty[(i) >> 5], ~((uint32_t)1 << ((i) & 31)))
+
+// Tile messages of a frame, written to the agent together
+struct tileFrame_t {
+	char *buffer;
+	size_t length;
+	size_t size;
 };
 
-extern int reset_tile_info(int old_height_count);
+extern int reset_tile_info();
+extern void invalidate_tile_info();
+extern void update_tile_info(void *desktop, long long desktopsize, int owner);
+extern void set_tile_owner(int x, int y, int width, int height, int owner);
+extern int next_dirty_tile(int index);
 extern int adjust_screen_size(int pixles);
-extern int getTileAt(int x, int y, void** buffer, long long *bufferSize, void *desktop, long long desktopsize, int row, int col);
+extern int getTileAt(int x, int y, struct tileFrame_t *frame, void *desktop, long long desktopsize, int row, int col);
+extern void getCopyRects(struct tileFrame_t *frame, void *desktop, long long desktopsize);
 extern int getScreenBuffer(char **desktop, long long *desktopsize, XImage *image);
 extern void set_tile_compression(int type, int level);
+extern void set_tile_compression_ratio(int ratio);
+extern void free_tile_buffers();
 
 
 #endif /* LINUX_TILE_H_ */
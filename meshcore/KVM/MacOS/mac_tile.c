@@ -23,8 +23,8 @@ extern int TILE_WIDTH_COUNT;
 extern int TILE_HEIGHT_COUNT;
 extern int COMPRESSION_RATIO;
 extern struct tileInfo_t **g_tileInfo;
-extern unsigned char *jpeg_buffer;
-extern int jpeg_buffer_length;
+extern __thread unsigned char *jpeg_buffer;
+extern __thread int jpeg_buffer_length;
 
 int tilebuffersize = 0;
 void* tilebuffer = NULL;
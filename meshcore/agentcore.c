@@ -112,6 +112,7 @@ int ILibDuktape_HECI_Debug = 0;
 	extern char **environ;
 #ifndef __APPLE__
 	extern int SLAVELOG;
+	extern int KVM_UINPUT;
 #endif
 #endif
 
@@ -1239,7 +1240,8 @@ duk_ret_t ILibDuktape_MeshAgent_getRemoteDesktop(duk_context *ctx)
 		char *libx11ext = Duktape_GetStringPropertyValue(ctx, -1, "Location_X11EXT", NULL);
 		char *libxfixes = Duktape_GetStringPropertyValue(ctx, -1, "Location_X11FIXES", NULL);
 		char *libxkb = Duktape_GetStringPropertyValue(ctx, -1, "Location_X11KB", NULL);
-		kvm_set_x11_locations(libx11, libx11tst, libx11ext, libxfixes, libxkb);
+		char *libxrandr = Duktape_GetStringPropertyValue(ctx, -1, "Location_X11RANDR", NULL);
+		kvm_set_x11_locations(libx11, libx11tst, libx11ext, libxfixes, libxkb, libxrandr);
 	}
 #endif
 
@@ -4313,6 +4315,7 @@ void MeshServer_Connect(MeshAgentHostContainer *agent)
 
 #if defined(_LINKVM) && defined(_POSIX) && !defined(__APPLE__)
 	SLAVELOG = ILibSimpleDataStore_Get(agent->masterDb, "slaveKvmLog", NULL, 0);
+	KVM_UINPUT = ILibSimpleDataStore_Get(agent->masterDb, "kvmUinput", NULL, 0);
 #endif
 
 	if (agent->logUpdate != 0) { ILIBLOGMESSAGEX("PLATFORM_TYPE: %d", agent->platformType); }
@@ -290,6 +290,9 @@ forceUpdate:				If set, will cause the agent to perform a self-update on next st
 ignoreProxyFile:			If set, will cause the agent to ignore any proxy settings
 logUpdate:					If set, will cause the agent to log self-update status
 jsDebugPort:				Specify a JS Debugger Port
+kvmUinput:					[Linux] If set, the KVM will inject input through /dev/uinput instead of XTest, when it can be opened and the X server adds the virtual devices.
+							Xvfb, Xvnc, xrdp, and X servers with AutoAddDevices off never do, so they keep using XTest. The devices are not tied to a display: the kernel
+							sends their input to whichever seat and VT is active, so only set this when the display being captured is the one on the active VT.
 maxLogSize:					Specifies the maximum size of the error log file. 
 nocertstore:				If set on Windows, will force the Agent to use OpenSSL instead of WinCrypto for cert generation/storage.
 readonly:					If set, forces the agent to open the database in readonly mode
@@ -490,6 +490,7 @@ duk_ret_t ILibDuktape_ChildProcess_execFile(duk_context *ctx)
 	ILibProcessPipe_Process p = NULL;
 	ILibProcessPipe_SpawnTypes spawnType = ILibProcessPipe_SpawnTypes_DEFAULT;
 	int uid = -1;
+	int pipeSize = 0;
 	char **envargs = NULL;
 
 	if (nargs > 32) { return(ILibDuktape_Error(ctx, "Too many parameters")); }
@@ -521,6 +522,7 @@ duk_ret_t ILibDuktape_ChildProcess_execFile(duk_context *ctx)
 			// Options
 			spawnType = (ILibProcessPipe_SpawnTypes)Duktape_GetIntPropertyValue(ctx, i, "type", (int)ILibProcessPipe_SpawnTypes_DEFAULT);
 			uid = Duktape_GetIntPropertyValue(ctx, i, "uid", -1);
+			pipeSize = Duktape_GetIntPropertyValue(ctx, i, "pipeSize", 0);
 #ifdef WIN32
 			if (uid >= 0 && spawnType == ILibProcessPipe_SpawnTypes_USER) { spawnType = ILibProcessPipe_SpawnTypes_SPECIFIED_USER; }
 #endif
@@ -583,9 +585,9 @@ duk_ret_t ILibDuktape_ChildProcess_execFile(duk_context *ctx)
 #endif
 	
 #ifdef WIN32
-	p = ILibProcessPipe_Manager_SpawnProcessEx4(manager, target, args, spawnType, (void*)(ILibPtrCAST)(uint64_t)(uid < 0 ? 0 : uid), envargs, 0);
+	p = ILibProcessPipe_Manager_SpawnProcessEx5(manager, target, args, spawnType, (void*)(ILibPtrCAST)(uint64_t)(uid < 0 ? 0 : uid), envargs, 0, pipeSize);
 #else
-	p = ILibProcessPipe_Manager_SpawnProcessEx4(manager, target, args, spawnType, (void*)(ILibPtrCAST)(uint64_t)uid, envargs, 0);
+	p = ILibProcessPipe_Manager_SpawnProcessEx5(manager, target, args, spawnType, (void*)(ILibPtrCAST)(uint64_t)uid, envargs, 0, pipeSize);
 #endif
 	if (p == NULL)
 	{
@@ -42,9 +42,27 @@ limitations under the License.
 #include "microstack/ILibRemoteLogging.h"
 
 
+#define INET_SOCKADDR_LENGTH(x) ((x==AF_INET6?sizeof(struct sockaddr_in6):sizeof(struct sockaddr_in)))
+
 #define ILibDuktape_DGRAM_CHAIN						"\xFF_DGRAM_CHAIN"
 #define ILibDuktape_DGRAM_SOCKET_NATIVE				"\xFF_DGRAM_SOCKET_NATIVE"
 #define ILibDuktape_DGRAM_MULTICAST_MEMBERSHIP_TYPE "\xFF_addRemove"
+#define ILibDuktape_DGRAM_BATCH_ARRAY				"\xFF_BatchArray"
+#define ILibDuktape_DGRAM_BATCH_RING				"\xFF_BatchRing"
+#define ILibDuktape_DGRAM_BATCH_CALLBACK			"\xFF_BatchCallback"
+#define ILibDuktape_DGRAM_PEER_ARRAY				"\xFF_PeerArray"
+
+#define ILibDuktape_DGRAM_MAX_DATAGRAM				4096
+#define ILibDuktape_DGRAM_PEER_CACHE_SIZE			32
+#define ILibDuktape_DGRAM_DEFAULT_BATCH				64
+#define ILibDuktape_DGRAM_DEFAULT_RING				65536
+
+typedef struct ILibDuktape_DGRAM_PeerCacheEntry
+{
+	struct sockaddr_in6 addr;
+	void *rinfo;
+	char address[64];
+}ILibDuktape_DGRAM_PeerCacheEntry;
 
 typedef struct ILibDuktape_DGRAM_DATA
 {
@@ -54,6 +72,16 @@ typedef struct ILibDuktape_DGRAM_DATA
 	void *dgramObject;
 	void *chain;
 	ILibAsyncUDPSocket_SocketModule *mSocket;
+
+	// Batched delivery. When batchMax is non-zero, datagrams are drained into 'ring' and dispatched as an array
+	int batchMax;
+	char *ring;
+	size_t ringLen;
+	size_t ringPos;
+	void *batchArray;
+	void *batchCallback;
+	void *peerArray;
+	ILibDuktape_DGRAM_PeerCacheEntry peers[ILibDuktape_DGRAM_PEER_CACHE_SIZE];
 }ILibDuktape_DGRAM_DATA;
 typedef enum ILibDuktape_DGRAM_Config
 {
@@ -80,6 +108,149 @@ duk_ret_t ILibDuktape_Dgram_Finalizer(duk_context *ctx)
 	duk_pcall_method(ctx, 0);
 	return 0;
 }
+//
+// Returns the cache slot for the specified peer, refreshing it (and its address string) on a miss
+//
+ILibDuktape_DGRAM_PeerCacheEntry* ILibDuktape_Dgram_GetPeer(ILibDuktape_DGRAM_DATA *ptrs, struct sockaddr_in6 *remoteInterface)
+{
+	unsigned int h = (unsigned int)remoteInterface->sin6_port;
+	unsigned char *a;
+	int i, alen;
+	ILibDuktape_DGRAM_PeerCacheEntry *entry;
+
+	if (remoteInterface->sin6_family == AF_INET)
+	{
+		a = (unsigned char*)&(((struct sockaddr_in*)remoteInterface)->sin_addr);
+		alen = 4;
+	}
+	else
+	{
+		a = (unsigned char*)&(remoteInterface->sin6_addr);
+		alen = 16;
+	}
+	for (i = 0; i < alen; ++i) { h = (h * 31) + a[i]; }
+	entry = &(ptrs->peers[h % ILibDuktape_DGRAM_PEER_CACHE_SIZE]);
+
+	if (entry->addr.sin6_family != remoteInterface->sin6_family || entry->addr.sin6_port != remoteInterface->sin6_port ||
+		memcmp(remoteInterface->sin6_family == AF_INET ? (void*)&(((struct sockaddr_in*)&(entry->addr))->sin_addr) : (void*)&(entry->addr.sin6_addr), a, alen) != 0)
+	{
+		memset(&(entry->addr), 0, sizeof(entry->addr));
+		memcpy_s(&(entry->addr), sizeof(entry->addr), remoteInterface, INET_SOCKADDR_LENGTH(remoteInterface->sin6_family));
+		strcpy_s(entry->address, sizeof(entry->address), ILibRemoteLogging_ConvertAddress((struct sockaddr*)remoteInterface));
+		entry->rinfo = NULL;
+	}
+	return(entry);
+}
+
+//
+// Returns the pooled rinfo object for a peer. The object is shared by every message from the same peer.
+//
+void ILibDuktape_Dgram_PushPeerInfo(ILibDuktape_DGRAM_DATA *ptrs, struct sockaddr_in6 *remoteInterface)
+{
+	duk_context *ctx = ptrs->ctx;
+	ILibDuktape_DGRAM_PeerCacheEntry *entry = ILibDuktape_Dgram_GetPeer(ptrs, remoteInterface);
+
+	if (entry->rinfo == NULL)
+	{
+		duk_push_heapptr(ctx, ptrs->peerArray);															// [peers]
+		duk_push_object(ctx);																			// [peers][rinfo]
+		duk_push_string(ctx, remoteInterface->sin6_family == AF_INET ? "IPv4" : "IPv6");				// [peers][rinfo][family]
+		duk_put_prop_string(ctx, -2, "family");															// [peers][rinfo]
+		duk_push_string(ctx, entry->address);															// [peers][rinfo][address]
+		duk_put_prop_string(ctx, -2, "address");														// [peers][rinfo]
+		duk_push_int(ctx, (int)ntohs(remoteInterface->sin6_port));										// [peers][rinfo][port]
+		duk_put_prop_string(ctx, -2, "port");															// [peers][rinfo]
+		entry->rinfo = duk_get_heapptr(ctx, -1);
+		duk_put_prop_index(ctx, -2, (duk_uarridx_t)(entry - ptrs->peers));								// [peers]
+		duk_pop(ctx);																					// ...
+	}
+	duk_push_heapptr(ctx, entry->rinfo);																// [rinfo]
+}
+
+//
+// Dispatches the first datagram, plus everything else already queued on the socket, as a single array
+//
+void ILibDuktape_Dgram_Socket_OnBatch(ILibDuktape_DGRAM_DATA *ptrs, char* buffer, int bufferLength, struct sockaddr_in6 *remoteInterface)
+{
+	duk_context *ctx = ptrs->ctx;
+	SOCKET sock = ILibAsyncUDPSocket_GetSocket(ptrs->mSocket);
+	struct sockaddr_in6 addr;
+#ifdef WIN32
+	int addrLen;
+#else
+	socklen_t addrLen;
+#endif
+	size_t batchStart;
+	int wrapped = 0;
+	int count = 0;
+	int len = bufferLength;
+	char *data;
+
+	if (ptrs->ringPos + ILibDuktape_DGRAM_MAX_DATAGRAM > ptrs->ringLen) { ptrs->ringPos = 0; }
+	batchStart = ptrs->ringPos;
+	memcpy_s(&addr, sizeof(addr), remoteInterface, INET_SOCKADDR_LENGTH(remoteInterface->sin6_family));
+	memcpy_s(ptrs->ring + ptrs->ringPos, ptrs->ringLen - ptrs->ringPos, buffer, bufferLength);
+
+	duk_push_heapptr(ctx, ptrs->batchArray);											// [array]
+	while (1)
+	{
+		data = ptrs->ring + ptrs->ringPos;
+		if (duk_get_prop_index(ctx, -1, (duk_uarridx_t)count) == 0)						// [array][msg]
+		{
+			duk_pop(ctx);																// [array]
+			duk_push_object(ctx);														// [array][msg]
+			duk_push_external_buffer(ctx);												// [array][msg][buffer]
+			duk_put_prop_string(ctx, -2, "data");										// [array][msg]
+			duk_dup_top(ctx);															// [array][msg][msg]
+			duk_put_prop_index(ctx, -3, (duk_uarridx_t)count);							// [array][msg]
+		}
+		duk_get_prop_string(ctx, -1, "data");											// [array][msg][buffer]
+		duk_config_buffer(ctx, -1, data, (duk_size_t)len);
+		duk_pop(ctx);																	// [array][msg]
+		duk_push_uint(ctx, (duk_uint_t)ptrs->ringPos);									// [array][msg][offset]
+		duk_put_prop_string(ctx, -2, "offset");											// [array][msg]
+		duk_push_int(ctx, len);															// [array][msg][size]
+		duk_put_prop_string(ctx, -2, "size");											// [array][msg]
+		ILibDuktape_Dgram_PushPeerInfo(ptrs, &addr);									// [array][msg][rinfo]
+		duk_put_prop_string(ctx, -2, "rinfo");											// [array][msg]
+		duk_pop(ctx);																	// [array]
+
+		ptrs->ringPos += len;
+		if (++count >= ptrs->batchMax) { break; }
+
+		// Make sure the next datagram cannot overwrite anything that belongs to this batch
+		if (ptrs->ringPos + ILibDuktape_DGRAM_MAX_DATAGRAM > ptrs->ringLen)
+		{
+			if (wrapped != 0 || batchStart < ILibDuktape_DGRAM_MAX_DATAGRAM) { break; }
+			ptrs->ringPos = 0;
+			wrapped = 1;
+		}
+		if (wrapped != 0 && ptrs->ringPos + ILibDuktape_DGRAM_MAX_DATAGRAM > batchStart) { break; }
+
+		addrLen = sizeof(addr);
+		len = (int)recvfrom(sock, ptrs->ring + ptrs->ringPos, ILibDuktape_DGRAM_MAX_DATAGRAM, 0, (struct sockaddr*)&addr, &addrLen);
+		if (len < 0) { break; }
+		ILib6to4((struct sockaddr*)&addr);
+	}
+	duk_set_length(ctx, -1, (duk_size_t)count);
+
+	if (ptrs->batchCallback != NULL)
+	{
+		duk_push_heapptr(ctx, ptrs->batchCallback);										// [array][func]
+		duk_push_heapptr(ctx, ptrs->socketObject);										// [array][func][this]
+		duk_dup(ctx, -3);																// [array][func][this][array]
+	}
+	else
+	{
+		duk_push_heapptr(ctx, ptrs->socketObject);										// [array][this]
+		duk_get_prop_string(ctx, -1, "emit");											// [array][this][emit]
+		duk_swap_top(ctx, -2);															// [array][emit][this]
+		duk_push_string(ctx, "messages");												// [array][emit][this][messages]
+		duk_dup(ctx, -4);																// [array][emit][this][messages][array]
+	}
+	if (duk_pcall_method(ctx, ptrs->batchCallback != NULL ? 1 : 2) != 0) { ILibDuktape_Process_UncaughtExceptionEx(ctx, "dgram.messages() dispatch error"); }
+	duk_pop_2(ctx);																		// ...
+}
 void ILibDuktape_Dgram_Socket_OnData(ILibAsyncUDPSocket_SocketModule socketModule, char* buffer, int bufferLength, struct sockaddr_in6 *remoteInterface, void *user, void *user2, int *PAUSE)
 {
 	ILibDuktape_DGRAM_DATA* ptrs = (ILibDuktape_DGRAM_DATA*)user;
@@ -87,6 +258,12 @@ void ILibDuktape_Dgram_Socket_OnData(ILibAsyncUDPSocket_SocketModule socketModul
 
 	if (ptrs != NULL && ptrs->ctx != NULL)
 	{
+		if (ptrs->batchMax > 0)
+		{
+			ILibDuktape_Dgram_Socket_OnBatch(ptrs, buffer, bufferLength, remoteInterface);
+			return;
+		}
+
 		duk_push_heapptr(ptrs->ctx, ptrs->socketObject);													// [this]
 		duk_get_prop_string(ptrs->ctx, -1, "emit");															// [this][emit]
 		duk_swap_top(ptrs->ctx, -2);																		// [emit][this]
@@ -96,7 +273,7 @@ void ILibDuktape_Dgram_Socket_OnData(ILibAsyncUDPSocket_SocketModule socketModul
 		duk_push_object(ptrs->ctx);																			// [emit][this][message][buffer][rinfo]
 		duk_push_string(ptrs->ctx, remoteInterface->sin6_family == AF_INET ? "IPv4" : "IPv6");				// [emit][this][message][buffer][rinfo][family]
 		duk_put_prop_string(ptrs->ctx, -2, "family");														// [emit][this][message][buffer][rinfo]
-		duk_push_string(ptrs->ctx, ILibRemoteLogging_ConvertAddress((struct sockaddr*)remoteInterface));	// [emit][this][message][buffer][rinfo][address]
+		duk_push_string(ptrs->ctx, ILibDuktape_Dgram_GetPeer(ptrs, remoteInterface)->address);				// [emit][this][message][buffer][rinfo][address]
 		duk_put_prop_string(ptrs->ctx, -2, "address");														// [emit][this][message][buffer][rinfo]
 		duk_push_int(ptrs->ctx, (int)ntohs(remoteInterface->sin6_port));									// [emit][this][message][buffer][rinfo][port]
 		duk_put_prop_string(ptrs->ctx, -2, "port");															// [emit][this][message][buffer][rinfo]
@@ -213,7 +390,7 @@ duk_ret_t ILibDuktape_DGram_Socket_bind(duk_context *ctx)
 #endif
 	if (bindCallback != NULL) ILibDuktape_EventEmitter_AddOnce(ptrs->emitter, "listening", bindCallback);
 	ptrs->mSocket = ILibAsyncUDPSocket_CreateEx(ptrs->chain,
-		4096, (struct sockaddr*)&local,
+		ILibDuktape_DGRAM_MAX_DATAGRAM, (struct sockaddr*)&local,
 		((config & ILibDuktape_DGRAM_Config_ReuseAddr) == ILibDuktape_DGRAM_Config_ReuseAddr) ? ILibAsyncUDPSocket_Reuse_SHARED : ILibAsyncUDPSocket_Reuse_EXCLUSIVE,
 		ILibDuktape_Dgram_Socket_OnData, ILibDuktape_Dgram_Socket_OnSendOK, ptrs);
 	ILibChain_Link_SetMetadata(ptrs->mSocket, "net.dgram");
@@ -460,6 +637,72 @@ duk_ret_t ILibDuktape_Dgram_setMetadata(duk_context *ctx)
 	}
 	return(0);
 }
+duk_ret_t ILibDuktape_DGram_enableBatching(duk_context *ctx)
+{
+	int nargs = duk_get_top(ctx);
+	ILibDuktape_DGRAM_DATA *ptrs = ILibDuktape_DGram_GetPTR(ctx);
+	duk_size_t ringLen = ILibDuktape_DGRAM_DEFAULT_RING;
+	char *ring = NULL;
+
+	duk_push_this(ctx);																		// [socket]
+	if (nargs > 0 && duk_is_boolean(ctx, 0) && !duk_get_boolean(ctx, 0))
+	{
+		// Revert to one 'message' event per datagram
+		ptrs->batchMax = 0;
+		ptrs->ring = NULL;
+		ptrs->batchCallback = NULL;
+		duk_del_prop_string(ctx, -1, ILibDuktape_DGRAM_BATCH_RING);
+		duk_del_prop_string(ctx, -1, ILibDuktape_DGRAM_BATCH_CALLBACK);
+		return(0);
+	}
+
+	ptrs->batchMax = ILibDuktape_DGRAM_DEFAULT_BATCH;
+	ptrs->batchCallback = NULL;
+	if (nargs > 0 && duk_is_object(ctx, 0) && !duk_is_function(ctx, 0))
+	{
+		ptrs->batchMax = Duktape_GetIntPropertyValue(ctx, 0, "maxMessages", ILibDuktape_DGRAM_DEFAULT_BATCH);
+		if (duk_has_prop_string(ctx, 0, "buffer"))
+		{
+			// Caller-owned receive ring, so message data can be consumed in place without a copy
+			duk_get_prop_string(ctx, 0, "buffer");											// [socket][ring]
+			ring = Duktape_GetBuffer(ctx, -1, &ringLen);
+			if (ringLen < ILibDuktape_DGRAM_MAX_DATAGRAM) { return(ILibDuktape_Error(ctx, "dgram.enableBatching(): buffer must be at least %d bytes", ILibDuktape_DGRAM_MAX_DATAGRAM)); }
+		}
+		else
+		{
+			ringLen = (duk_size_t)Duktape_GetIntPropertyValue(ctx, 0, "bufferSize", ILibDuktape_DGRAM_DEFAULT_RING);
+			if (ringLen < ILibDuktape_DGRAM_MAX_DATAGRAM) { ringLen = ILibDuktape_DGRAM_MAX_DATAGRAM; }
+		}
+	}
+	if (ptrs->batchMax < 1) { return(ILibDuktape_Error(ctx, "dgram.enableBatching(): Invalid maxMessages")); }
+	if (ring == NULL)
+	{
+		ring = (char*)duk_push_fixed_buffer(ctx, ringLen);									// [socket][ring]
+	}
+	duk_put_prop_string(ctx, -2, ILibDuktape_DGRAM_BATCH_RING);								// [socket]
+	ptrs->ring = ring;
+	ptrs->ringLen = (size_t)ringLen;
+	ptrs->ringPos = 0;
+
+	if (nargs > 0 && duk_is_function(ctx, nargs - 1))
+	{
+		// Direct callback, bypassing the EventEmitter dispatch
+		ptrs->batchCallback = duk_get_heapptr(ctx, nargs - 1);
+		duk_dup(ctx, nargs - 1);															// [socket][func]
+		duk_put_prop_string(ctx, -2, ILibDuktape_DGRAM_BATCH_CALLBACK);						// [socket]
+	}
+
+	if (ptrs->batchArray == NULL)
+	{
+		duk_push_array(ctx);																// [socket][array]
+		ptrs->batchArray = duk_get_heapptr(ctx, -1);
+		duk_put_prop_string(ctx, -2, ILibDuktape_DGRAM_BATCH_ARRAY);						// [socket]
+		duk_push_array(ctx);																// [socket][peers]
+		ptrs->peerArray = duk_get_heapptr(ctx, -1);
+		duk_put_prop_string(ctx, -2, ILibDuktape_DGRAM_PEER_ARRAY);							// [socket]
+	}
+	return(0);
+}
 duk_ret_t ILibDuktape_DGram_createSocket(duk_context *ctx)
 {
 	ILibDuktape_DGRAM_Config config = ILibDuktape_DGRAM_Config_NONE;
@@ -497,6 +740,7 @@ duk_ret_t ILibDuktape_DGram_createSocket(duk_context *ctx)
 	ILibDuktape_EventEmitter_CreateEventEx(ptrs->emitter, "error");
 	ILibDuktape_EventEmitter_CreateEventEx(ptrs->emitter, "listening");
 	ILibDuktape_EventEmitter_CreateEventEx(ptrs->emitter, "message");
+	ILibDuktape_EventEmitter_CreateEventEx(ptrs->emitter, "messages");
 	ILibDuktape_EventEmitter_CreateEventEx(ptrs->emitter, "flushed");
 
 	ILibDuktape_CreateInstanceMethodWithIntProperty(ctx, "config", config, "bind", ILibDuktape_DGram_Socket_bind, DUK_VARARGS);
@@ -513,6 +757,7 @@ duk_ret_t ILibDuktape_DGram_createSocket(duk_context *ctx)
 	ILibDuktape_CreateInstanceMethod(ctx, "setMulticastInterface", ILibDuktape_DGram_setMulticastInterface, 1);
 	ILibDuktape_CreateInstanceMethod(ctx, "setTTL", ILibDuktape_DGram_setTTL, 1);
 	ILibDuktape_CreateInstanceMethod(ctx, "address", ILibDuktape_DGram_address, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "enableBatching", ILibDuktape_DGram_enableBatching, DUK_VARARGS);
 	ILibDuktape_CreateEventWithSetterEx(ctx, "descriptorMetadata", ILibDuktape_Dgram_setMetadata);
 
 	return 1;
@@ -583,6 +828,18 @@ public:
 		*/
 		void message;
 		/*!
+		\brief Event is emitted instead of 'message' when batching is enabled, with every datagram that was queued on the Socket.
+		*
+		The array and its entries are reused between events, so copy out anything that must outlive the handler.\n
+		Message data lives in the receive buffer, and remains valid until the buffer wraps around.
+		\param msgs <Array> Each entry has the following properties:\n
+		<b>data</b> <Buffer> The message\n
+		<b>offset</b> <Number> Offset of the message in the receive buffer\n
+		<b>size</b> <Number> Message Size\n
+		<b>rinfo</b> <Object> Remote Address Information (family, address, port), shared by all messages from the same sender\n
+		*/
+		void messages;
+		/*!
 		\brief Event emitted when send buffer is empty
 		*/
 		void flushed;
@@ -644,6 +901,15 @@ public:
 		\param ttl <Integer>
 		*/
 		void setTTL(ttl)
+		/*!
+		\brief Delivers datagrams in batches, one array per chain iteration, instead of one 'message' event per datagram
+		\param options <Object> Optional, or <b>false</b> to disable batching. Supports the following properties:\n
+		<b>maxMessages</b> <Number> Maximum number of datagrams per batch. Default is 64\n
+		<b>buffer</b> <Buffer> Caller-owned receive ring. Must be at least 4096 bytes\n
+		<b>bufferSize</b> <Number> Size of the internal receive ring, when 'buffer' is not specified. Default is 65536\n
+		\param callback <func> Optional. Called directly with the message array, instead of emitting 'messages'.
+		*/
+		void enableBatching([options][, callback]);
 	};
 
 };
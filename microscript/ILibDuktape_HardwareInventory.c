@@ -0,0 +1,822 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "duktape.h"
+#include "ILibDuktapeModSearch.h"
+#include "ILibDuktape_Helpers.h"
+#include "ILibDuktape_HardwareInventory.h"
+#include "../microstack/ILibParsers.h"
+
+#if defined(_POSIX) && !defined(__APPLE__) && !defined(_FREEBSD)
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ctype.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+
+#define ILibDuktape_HardwareInventory_PTR			"\xFF_HardwareInventory_PTR"
+#define ILibDuktape_HardwareInventory_DMI			"\xFF_HardwareInventory_DMI"
+#define ILibDuktape_HardwareInventory_CPU			"\xFF_HardwareInventory_CPU"
+#define ILibDuktape_HardwareInventory_PCI			"\xFF_HardwareInventory_PCI"
+#define ILibDuktape_HardwareInventory_DISKS			"\xFF_HardwareInventory_DISKS"
+#define ILibDuktape_HardwareInventory_USB			"\xFF_HardwareInventory_USB"
+#define ILibDuktape_HardwareInventory_SMBIOS		"\xFF_HardwareInventory_SMBIOS"
+#define ILibDuktape_HardwareInventory_MEMORY		"\xFF_HardwareInventory_MEMORY"
+
+#define ILibDuktape_HardwareInventory_DMI_PATH		"/sys/class/dmi/id"
+#define ILibDuktape_HardwareInventory_PCI_PATH		"/sys/bus/pci/devices"
+#define ILibDuktape_HardwareInventory_BLOCK_PATH	"/sys/block"
+#define ILibDuktape_HardwareInventory_USB_PATH		"/sys/bus/usb/devices"
+#define ILibDuktape_HardwareInventory_SMBIOS_PATH	"/sys/firmware/dmi/tables/DMI"
+
+typedef struct ILibDuktape_HardwareInventory
+{
+	int uevent;						// NETLINK_KOBJECT_UEVENT socket, used to invalidate the hotplug caches
+	int pciValid;
+	int disksValid;
+	int usbValid;
+}ILibDuktape_HardwareInventory;
+
+typedef struct ILibDuktape_HardwareInventory_PCIDevice
+{
+	char bus[32];
+	unsigned int vendor, device, subvendor, subdevice, classId, revision;
+	char vendorName[128];
+	char deviceName[256];
+	char subvendorName[128];
+	char subdeviceName[256];
+	char className[128];
+}ILibDuktape_HardwareInventory_PCIDevice;
+
+char *ILibDuktape_HardwareInventory_PCIIDS[] = { "/usr/share/misc/pci.ids", "/usr/share/hwdata/pci.ids", "/usr/share/pci.ids", NULL };
+
+// SMBIOS enumerations, using the same strings as dmidecode
+char *ILibDuktape_HardwareInventory_MemoryArrayLocation[] = { NULL, "Other", "Unknown", "System Board Or Motherboard", "ISA Add-on Card", "EISA Add-on Card", "PCI Add-on Card", "MCA Add-on Card", "PCMCIA Add-on Card", "Proprietary Add-on Card", "NuBus" };
+char *ILibDuktape_HardwareInventory_MemoryArrayUse[] = { NULL, "Other", "Unknown", "System Memory", "Video Memory", "Flash Memory", "Non-volatile RAM", "Cache Memory" };
+char *ILibDuktape_HardwareInventory_MemoryErrorCorrection[] = { NULL, "Other", "Unknown", "None", "Parity", "Single-bit ECC", "Multi-bit ECC", "CRC" };
+char *ILibDuktape_HardwareInventory_MemoryFormFactor[] = { NULL, "Other", "Unknown", "SIMM", "SIP", "Chip", "DIP", "ZIP", "Proprietary Card", "DIMM", "TSOP", "Row Of Chips", "RIMM", "SODIMM", "SRIMM", "FB-DIMM", "Die" };
+char *ILibDuktape_HardwareInventory_MemoryType[] = { NULL, "Other", "Unknown", "DRAM", "EDRAM", "VRAM", "SRAM", "RAM", "ROM", "Flash", "EEPROM", "FEPROM", "EPROM", "CDRAM", "3DRAM", "SDRAM", "SGRAM", "RDRAM", "DDR", "DDR2", "DDR2 FB-DIMM", "Reserved", "Reserved", "Reserved", "DDR3", "FBD2", "DDR4", "LPDDR", "LPDDR2", "LPDDR3", "LPDDR4", "Logical non-volatile device", "HBM", "HBM2", "DDR5", "LPDDR5" };
+char *ILibDuktape_HardwareInventory_MemoryTypeDetail[] = { NULL, "Other", "Unknown", "Fast-paged", "Static Column", "Pseudo-static", "RAMBus", "Synchronous", "CMOS", "EDO", "Window DRAM", "Cache DRAM", "Non-Volatile", "Registered (Buffered)", "Unbuffered (Unregistered)", "LRDIMM" };
+#define ILibDuktape_HardwareInventory_Lookup(table, index) (((index) > 0 && (index) < (sizeof(table) / sizeof(char*))) ? table[(index)] : "Unknown")
+
+//
+// Drains the uevent socket, and invalidates the caches of the subsystems that changed
+//
+void ILibDuktape_HardwareInventory_CheckHotplug(ILibDuktape_HardwareInventory *hw)
+{
+	char buffer[8192];
+	int len, i;
+
+	if (hw->uevent < 0) { return; }
+	while ((len = (int)recv(hw->uevent, buffer, sizeof(buffer) - 1, MSG_DONTWAIT)) > 0 || (len < 0 && errno == EINTR))
+	{
+		if (len < 0) { continue; }
+		buffer[len] = 0;
+		for (i = 0; i < len; i += (int)strnlen(buffer + i, len - i) + 1)
+		{
+			if (strncmp(buffer + i, "SUBSYSTEM=", 10) != 0) { continue; }
+			if (strcmp(buffer + i + 10, "pci") == 0) { hw->pciValid = 0; }
+			if (strcmp(buffer + i + 10, "block") == 0 || strcmp(buffer + i + 10, "scsi") == 0 || strcmp(buffer + i + 10, "nvme") == 0) { hw->disksValid = 0; }
+			if (strcmp(buffer + i + 10, "usb") == 0) { hw->usbValid = 0; hw->disksValid = 0; }
+		}
+	}
+	if (len < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+	{
+		// ENOBUFS means the socket overflowed, and uevents were dropped, so any of the caches could be stale
+		hw->pciValid = 0;
+		hw->disksValid = 0;
+		hw->usbValid = 0;
+	}
+}
+
+//
+// Reads a sysfs attribute, trimming whitespace. Returns the length, or -1 on error
+//
+int ILibDuktape_HardwareInventory_ReadFile(char *path, char *buffer, int bufferLen)
+{
+	int fd, len;
+
+	buffer[0] = 0;
+	if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0) { return(-1); }
+	len = (int)read(fd, buffer, bufferLen - 1);
+	close(fd);
+	if (len < 0) { return(-1); }
+	buffer[len] = 0;
+	while (len > 0 && isspace((unsigned char)buffer[len - 1])) { buffer[--len] = 0; }
+	for (fd = 0; fd < len && isspace((unsigned char)buffer[fd]); ++fd);
+	if (fd > 0) { len -= fd; memmove(buffer, buffer + fd, len + 1); }
+	return(len);
+}
+int ILibDuktape_HardwareInventory_ReadAttribute(char *dir, char *name, char *buffer, int bufferLen)
+{
+	char path[PATH_MAX];
+	if (sprintf_s(path, sizeof(path), "%s/%s", dir, name) < 0) { buffer[0] = 0; return(-1); }
+	return(ILibDuktape_HardwareInventory_ReadFile(path, buffer, bufferLen));
+}
+unsigned int ILibDuktape_HardwareInventory_ReadHex(char *dir, char *name)
+{
+	char value[32];
+	if (ILibDuktape_HardwareInventory_ReadAttribute(dir, name, value, sizeof(value)) <= 0) { return(0); }
+	return((unsigned int)strtoul(value, NULL, 16));
+}
+
+ILibDuktape_HardwareInventory* ILibDuktape_HardwareInventory_GetState(duk_context *ctx)
+{
+	ILibDuktape_HardwareInventory *hw;
+	duk_push_this(ctx);												// [inventory]
+	hw = (ILibDuktape_HardwareInventory*)Duktape_GetBufferProperty(ctx, -1, ILibDuktape_HardwareInventory_PTR);
+	ILibDuktape_HardwareInventory_CheckHotplug(hw);
+	return(hw);
+}
+
+//
+// Caches the value at the top of the stack. The inventory object is expected at [-2]
+//
+void ILibDuktape_HardwareInventory_Cache(duk_context *ctx, char *key, int *valid)
+{
+	duk_freeze(ctx, -1);
+	if (valid != NULL && ((ILibDuktape_HardwareInventory*)Duktape_GetBufferProperty(ctx, -2, ILibDuktape_HardwareInventory_PTR))->uevent < 0) { return; }	// Can't tell when it changes, so don't cache it
+
+	duk_dup(ctx, -1);												// [inventory][value][value]
+	duk_put_prop_string(ctx, -3, key);								// [inventory][value]
+	if (valid != NULL) { *valid = 1; }
+}
+
+//
+// Pushes the cached value, if it is still valid. The inventory object is expected at the top of the stack
+//
+int ILibDuktape_HardwareInventory_Cached(duk_context *ctx, char *key, int valid)
+{
+	if (valid == 0) { return(0); }
+	if (duk_get_prop_string(ctx, -1, key)) { return(1); }			// [inventory][value]
+	duk_pop(ctx);													// [inventory]
+	return(0);
+}
+
+duk_ret_t ILibDuktape_HardwareInventory_dmi(duk_context *ctx)
+{
+	char path[PATH_MAX];
+	char value[1024];
+	struct dirent *entry;
+	struct stat info;
+	DIR *dir;
+
+	ILibDuktape_HardwareInventory_GetState(ctx);					// [inventory]
+	if (ILibDuktape_HardwareInventory_Cached(ctx, ILibDuktape_HardwareInventory_DMI, 1)) { return(1); }
+
+	duk_push_object(ctx);											// [inventory][dmi]
+	if ((dir = opendir(ILibDuktape_HardwareInventory_DMI_PATH)) != NULL)
+	{
+		while ((entry = readdir(dir)) != NULL)
+		{
+			if (entry->d_name[0] == '.') { continue; }
+			if (sprintf_s(path, sizeof(path), "%s/%s", ILibDuktape_HardwareInventory_DMI_PATH, entry->d_name) < 0) { continue; }
+			if (stat(path, &info) != 0 || !S_ISREG(info.st_mode)) { continue; }
+			if (ILibDuktape_HardwareInventory_ReadFile(path, value, sizeof(value)) < 0 || strcmp(value, "None") == 0) { continue; }	// Some entries are only readable by root
+			duk_push_string(ctx, value);
+			duk_put_prop_string(ctx, -2, entry->d_name);
+		}
+		closedir(dir);
+	}
+	ILibDuktape_HardwareInventory_Cache(ctx, ILibDuktape_HardwareInventory_DMI, NULL);
+	return(1);
+}
+duk_ret_t ILibDuktape_HardwareInventory_cpu(duk_context *ctx)
+{
+	char line[1024];
+	char name[256] = { 0 }, vendor[128] = { 0 };
+	char *key, *value;
+	int count = 0;
+	FILE *f;
+
+	ILibDuktape_HardwareInventory_GetState(ctx);					// [inventory]
+	if (ILibDuktape_HardwareInventory_Cached(ctx, ILibDuktape_HardwareInventory_CPU, 1)) { return(1); }
+
+	if ((f = fopen("/proc/cpuinfo", "r")) != NULL)
+	{
+		while (fgets(line, sizeof(line), f) != NULL)
+		{
+			if ((value = strchr(line, ':')) == NULL) { continue; }
+			*value++ = 0;
+			key = line;
+			while (*value == ' ' || *value == '\t') { ++value; }
+			value[strcspn(value, "\r\n")] = 0;
+			key[strcspn(key, "\t")] = 0;
+
+			if (strcmp(key, "processor") == 0) { ++count; }
+			else if (name[0] == 0 && (strcmp(key, "model name") == 0 || strcmp(key, "Processor") == 0 || strcmp(key, "cpu model") == 0)) { strncpy_s(name, sizeof(name), value, sizeof(name) - 1); }
+			else if (vendor[0] == 0 && strcmp(key, "vendor_id") == 0) { strncpy_s(vendor, sizeof(vendor), value, sizeof(vendor) - 1); }
+		}
+		fclose(f);
+	}
+
+	duk_push_object(ctx);											// [inventory][cpu]
+	duk_push_string(ctx, name); duk_put_prop_string(ctx, -2, "name");
+	duk_push_string(ctx, vendor); duk_put_prop_string(ctx, -2, "vendor");
+	duk_push_int(ctx, count); duk_put_prop_string(ctx, -2, "count");
+	ILibDuktape_HardwareInventory_Cache(ctx, ILibDuktape_HardwareInventory_CPU, NULL);
+	return(1);
+}
+
+//
+// Resolves vendor, device, subsystem and class names from pci.ids, with a single pass over the file
+//
+void ILibDuktape_HardwareInventory_PCINames(ILibDuktape_HardwareInventory_PCIDevice *devices, int count)
+{
+	char line[512];
+	char *name;
+	unsigned int id, id2, vendor = 0xFFFFFFFF, device = 0xFFFFFFFF, pclass = 0xFFFFFFFF;
+	int i, inClasses = 0;
+	FILE *f = NULL;
+
+	for (i = 0; ILibDuktape_HardwareInventory_PCIIDS[i] != NULL && f == NULL; ++i) { f = fopen(ILibDuktape_HardwareInventory_PCIIDS[i], "r"); }
+	if (f != NULL)
+	{
+		while (fgets(line, sizeof(line), f) != NULL)
+		{
+			line[strcspn(line, "\r\n")] = 0;
+			if (line[0] == '#' || line[0] == 0) { continue; }
+
+			if (line[0] == 'C' && line[1] == ' ')
+			{
+				// C cc  Class Name
+				inClasses = 1;
+				pclass = (unsigned int)strtoul(line + 2, &name, 16) << 8;
+				while (*name == ' ') { ++name; }
+				for (i = 0; i < count; ++i)
+				{
+					if ((devices[i].classId >> 16) == (pclass >> 8) && devices[i].className[0] == 0) { strncpy_s(devices[i].className, sizeof(devices[i].className), name, sizeof(devices[i].className) - 1); }
+				}
+			}
+			else if (line[0] != '\t')
+			{
+				// vvvv  Vendor Name
+				inClasses = 0;
+				vendor = (unsigned int)strtoul(line, &name, 16);
+				while (*name == ' ') { ++name; }
+				for (i = 0; i < count; ++i)
+				{
+					if (devices[i].vendor == vendor) { strncpy_s(devices[i].vendorName, sizeof(devices[i].vendorName), name, sizeof(devices[i].vendorName) - 1); }
+					if (devices[i].subvendor == vendor) { strncpy_s(devices[i].subvendorName, sizeof(devices[i].subvendorName), name, sizeof(devices[i].subvendorName) - 1); }
+				}
+			}
+			else if (inClasses != 0)
+			{
+				if (line[1] == '\t') { continue; }					// Programming Interface
+				// \tss  Subclass Name
+				id = pclass | (unsigned int)strtoul(line + 1, &name, 16);
+				while (*name == ' ') { ++name; }
+				for (i = 0; i < count; ++i)
+				{
+					if ((devices[i].classId >> 8) == id) { strncpy_s(devices[i].className, sizeof(devices[i].className), name, sizeof(devices[i].className) - 1); }
+				}
+			}
+			else if (line[1] != '\t')
+			{
+				// \tdddd  Device Name
+				id = (unsigned int)strtoul(line + 1, &name, 16);
+				while (*name == ' ') { ++name; }
+				for (i = 0; i < count; ++i)
+				{
+					if (devices[i].vendor == vendor && devices[i].device == id) { strncpy_s(devices[i].deviceName, sizeof(devices[i].deviceName), name, sizeof(devices[i].deviceName) - 1); }
+				}
+				device = id;										// Remember the device, for the subsystem entries that follow
+			}
+			else
+			{
+				// \t\tssss dddd  Subsystem Name
+				id = (unsigned int)strtoul(line + 2, &name, 16);
+				id2 = (unsigned int)strtoul(name, &name, 16);
+				while (*name == ' ') { ++name; }
+				for (i = 0; i < count; ++i)
+				{
+					if (devices[i].vendor == vendor && devices[i].device == device && devices[i].subvendor == id && devices[i].subdevice == id2)
+					{
+						strncpy_s(devices[i].subdeviceName, sizeof(devices[i].subdeviceName), name, sizeof(devices[i].subdeviceName) - 1);
+					}
+				}
+			}
+		}
+		fclose(f);
+	}
+
+	// Same as lspci, when the database doesn't have an entry
+	for (i = 0; i < count; ++i)
+	{
+		if (devices[i].vendorName[0] == 0) { sprintf_s(devices[i].vendorName, sizeof(devices[i].vendorName), "Vendor %04x", devices[i].vendor); }
+		if (devices[i].deviceName[0] == 0) { sprintf_s(devices[i].deviceName, sizeof(devices[i].deviceName), "Device %04x", devices[i].device); }
+		if (devices[i].className[0] == 0) { sprintf_s(devices[i].className, sizeof(devices[i].className), "Class %04x", devices[i].classId >> 8); }
+		if (devices[i].subvendor != 0 && devices[i].subvendorName[0] == 0) { sprintf_s(devices[i].subvendorName, sizeof(devices[i].subvendorName), "Vendor %04x", devices[i].subvendor); }
+		if (devices[i].subvendor != 0 && devices[i].subdeviceName[0] == 0) { sprintf_s(devices[i].subdeviceName, sizeof(devices[i].subdeviceName), "Device %04x", devices[i].subdevice); }
+	}
+}
+int ILibDuktape_HardwareInventory_ComparePCI(const void *a, const void *b)
+{
+	return(strcmp(((ILibDuktape_HardwareInventory_PCIDevice*)a)->bus, ((ILibDuktape_HardwareInventory_PCIDevice*)b)->bus));
+}
+duk_ret_t ILibDuktape_HardwareInventory_pci(duk_context *ctx)
+{
+	ILibDuktape_HardwareInventory *hw = ILibDuktape_HardwareInventory_GetState(ctx);
+	ILibDuktape_HardwareInventory_PCIDevice *devices;
+	char path[PATH_MAX];
+	struct dirent *entry;
+	DIR *dir;
+	int count = 0, capacity = 0, i;
+
+	if (ILibDuktape_HardwareInventory_Cached(ctx, ILibDuktape_HardwareInventory_PCI, hw->pciValid)) { return(1); }
+
+	// The devices are counted first, so the list can live in a Duktape buffer, and nothing leaks if a push throws.
+	// No Duktape calls are made while the directory is open.
+	if ((dir = opendir(ILibDuktape_HardwareInventory_PCI_PATH)) != NULL)
+	{
+		while ((entry = readdir(dir)) != NULL) { if (entry->d_name[0] != '.') { ++capacity; } }
+		closedir(dir);
+	}
+	devices = (ILibDuktape_HardwareInventory_PCIDevice*)duk_push_fixed_buffer(ctx, capacity * sizeof(ILibDuktape_HardwareInventory_PCIDevice));	// [inventory][devices]
+
+	if (capacity > 0 && (dir = opendir(ILibDuktape_HardwareInventory_PCI_PATH)) != NULL)
+	{
+		while (count < capacity && (entry = readdir(dir)) != NULL)
+		{
+			if (entry->d_name[0] == '.') { continue; }
+			memset(&(devices[count]), 0, sizeof(ILibDuktape_HardwareInventory_PCIDevice));
+			if (sprintf_s(path, sizeof(path), "%s/%s", ILibDuktape_HardwareInventory_PCI_PATH, entry->d_name) < 0) { continue; }
+
+			// lspci omits the domain, when it is zero
+			strncpy_s(devices[count].bus, sizeof(devices[count].bus), strncmp(entry->d_name, "0000:", 5) == 0 ? entry->d_name + 5 : entry->d_name, sizeof(devices[count].bus) - 1);
+			devices[count].vendor = ILibDuktape_HardwareInventory_ReadHex(path, "vendor");
+			devices[count].device = ILibDuktape_HardwareInventory_ReadHex(path, "device");
+			devices[count].subvendor = ILibDuktape_HardwareInventory_ReadHex(path, "subsystem_vendor");
+			devices[count].subdevice = ILibDuktape_HardwareInventory_ReadHex(path, "subsystem_device");
+			devices[count].classId = ILibDuktape_HardwareInventory_ReadHex(path, "class");
+			devices[count].revision = ILibDuktape_HardwareInventory_ReadHex(path, "revision");
+			++count;
+		}
+		closedir(dir);
+	}
+	if (count > 0)
+	{
+		qsort(devices, count, sizeof(ILibDuktape_HardwareInventory_PCIDevice), ILibDuktape_HardwareInventory_ComparePCI);
+		ILibDuktape_HardwareInventory_PCINames(devices, count);
+	}
+
+	duk_push_array(ctx);											// [inventory][devices][array]
+	for (i = 0; i < count; ++i)
+	{
+		duk_push_object(ctx);										// [inventory][devices][array][device]
+		duk_push_string(ctx, devices[i].bus); duk_put_prop_string(ctx, -2, "bus");
+		duk_push_uint(ctx, devices[i].vendor); duk_put_prop_string(ctx, -2, "vendorId");
+		duk_push_uint(ctx, devices[i].device); duk_put_prop_string(ctx, -2, "deviceId");
+		duk_push_uint(ctx, devices[i].classId); duk_put_prop_string(ctx, -2, "classId");
+		duk_push_uint(ctx, devices[i].revision); duk_put_prop_string(ctx, -2, "revision");
+		duk_push_string(ctx, devices[i].className); duk_put_prop_string(ctx, -2, "device");
+		duk_push_string(ctx, devices[i].vendorName); duk_put_prop_string(ctx, -2, "manufacturer");
+		duk_push_string(ctx, devices[i].deviceName); duk_put_prop_string(ctx, -2, "description");
+		if (devices[i].subvendor != 0)
+		{
+			duk_push_object(ctx);									// [inventory][devices][array][device][subsystem]
+			duk_push_string(ctx, devices[i].subvendorName); duk_put_prop_string(ctx, -2, "manufacturer");
+			duk_push_string(ctx, devices[i].subdeviceName); duk_put_prop_string(ctx, -2, "description");
+			duk_freeze(ctx, -1);
+			duk_put_prop_string(ctx, -2, "subsystem");				// [inventory][devices][array][device]
+		}
+		duk_freeze(ctx, -1);
+		duk_put_prop_index(ctx, -2, i);								// [inventory][devices][array]
+	}
+	duk_remove(ctx, -2);											// [inventory][array]
+	ILibDuktape_HardwareInventory_Cache(ctx, ILibDuktape_HardwareInventory_PCI, &(hw->pciValid));
+	return(1);
+}
+
+//
+// Formats a disk size, the same as lshw. ie: 465GiB (500GB)
+//
+void ILibDuktape_HardwareInventory_PushDiskSize(duk_context *ctx, unsigned long long bytes)
+{
+	if (bytes == 0)
+	{
+		duk_push_string(ctx, "");
+	}
+	else if (bytes >= (1ULL << 30))
+	{
+		duk_push_sprintf(ctx, "%lluGiB (%lluGB)", bytes >> 30, (bytes + 500000000ULL) / 1000000000ULL);
+	}
+	else
+	{
+		duk_push_sprintf(ctx, "%lluMiB (%lluMB)", bytes >> 20, (bytes + 500000ULL) / 1000000ULL);
+	}
+}
+duk_ret_t ILibDuktape_HardwareInventory_disks(duk_context *ctx)
+{
+	ILibDuktape_HardwareInventory *hw = ILibDuktape_HardwareInventory_GetState(ctx);
+	char path[PATH_MAX];
+	char device[PATH_MAX];
+	char vendor[128], model[256], value[64];
+	char *caption;
+	struct dirent *entry;
+	unsigned long long bytes;
+	DIR *dir;
+	int i = 0;
+
+	if (ILibDuktape_HardwareInventory_Cached(ctx, ILibDuktape_HardwareInventory_DISKS, hw->disksValid)) { return(1); }
+
+	duk_push_array(ctx);											// [inventory][array]
+	if ((dir = opendir(ILibDuktape_HardwareInventory_BLOCK_PATH)) != NULL)
+	{
+		while ((entry = readdir(dir)) != NULL)
+		{
+			if (entry->d_name[0] == '.') { continue; }
+			if (sprintf_s(path, sizeof(path), "%s/%s", ILibDuktape_HardwareInventory_BLOCK_PATH, entry->d_name) < 0) { continue; }
+			if (sprintf_s(device, sizeof(device), "%s/device", path) < 0 || access(device, F_OK) != 0) { continue; }	// Virtual devices (loop, ram, dm, md) don't have a backing device
+
+			ILibDuktape_HardwareInventory_ReadAttribute(device, "vendor", vendor, sizeof(vendor));
+			if (ILibDuktape_HardwareInventory_ReadAttribute(device, "model", model, sizeof(model)) <= 0)
+			{
+				ILibDuktape_HardwareInventory_ReadAttribute(device, "name", model, sizeof(model));	// MMC
+			}
+			bytes = ILibDuktape_HardwareInventory_ReadAttribute(path, "size", value, sizeof(value)) > 0 ? strtoull(value, NULL, 10) * 512ULL : 0;
+
+			if (strncmp(entry->d_name, "nvme", 4) == 0) { caption = "NVMe disk"; }
+			else if (strncmp(entry->d_name, "mmcblk", 6) == 0) { caption = "SD/MMC disk"; }
+			else if (strncmp(entry->d_name, "vd", 2) == 0) { caption = "Virtual I/O disk"; }
+			else if (strncmp(entry->d_name, "xvd", 3) == 0) { caption = "Xen virtual disk"; }
+			else if (strncmp(entry->d_name, "sr", 2) == 0) { caption = "DVD reader"; }
+			else if (strncmp(entry->d_name, "sd", 2) == 0) { caption = strcmp(vendor, "ATA") == 0 ? "ATA Disk" : "SCSI Disk"; }
+			else { caption = "Disk"; }
+
+			duk_push_object(ctx);									// [inventory][array][disk]
+			duk_push_string(ctx, entry->d_name); duk_put_prop_string(ctx, -2, "name");
+			duk_push_string(ctx, caption); duk_put_prop_string(ctx, -2, "Caption");
+			if (model[0] != 0 && vendor[0] != 0 && strcmp(vendor, "ATA") != 0 && strncmp(model, vendor, strlen(vendor)) != 0)
+			{
+				duk_push_sprintf(ctx, "%s %s", vendor, model);
+			}
+			else
+			{
+				duk_push_string(ctx, model[0] != 0 ? model : caption);
+			}
+			duk_put_prop_string(ctx, -2, "Model");
+			ILibDuktape_HardwareInventory_PushDiskSize(ctx, bytes); duk_put_prop_string(ctx, -2, "Size");
+			duk_push_number(ctx, (duk_double_t)bytes); duk_put_prop_string(ctx, -2, "bytes");
+			duk_push_boolean(ctx, ILibDuktape_HardwareInventory_ReadAttribute(path, "removable", value, sizeof(value)) > 0 && value[0] == '1'); duk_put_prop_string(ctx, -2, "removable");
+			duk_freeze(ctx, -1);
+			duk_put_prop_index(ctx, -2, i++);						// [inventory][array]
+		}
+		closedir(dir);
+	}
+	ILibDuktape_HardwareInventory_Cache(ctx, ILibDuktape_HardwareInventory_DISKS, &(hw->disksValid));
+	return(1);
+}
+duk_ret_t ILibDuktape_HardwareInventory_usb(duk_context *ctx)
+{
+	ILibDuktape_HardwareInventory *hw = ILibDuktape_HardwareInventory_GetState(ctx);
+	char path[PATH_MAX];
+	char parent[PATH_MAX];
+	char value[256], devpath[64];
+	char *port;
+	struct dirent *entry;
+	DIR *dir;
+	int i = 0, level;
+
+	if (ILibDuktape_HardwareInventory_Cached(ctx, ILibDuktape_HardwareInventory_USB, hw->usbValid)) { return(1); }
+
+	duk_push_array(ctx);											// [inventory][array]
+	if ((dir = opendir(ILibDuktape_HardwareInventory_USB_PATH)) != NULL)
+	{
+		while ((entry = readdir(dir)) != NULL)
+		{
+			if (entry->d_name[0] == '.' || strchr(entry->d_name, ':') != NULL) { continue; }	// Skip the interfaces
+			if (sprintf_s(path, sizeof(path), "%s/%s", ILibDuktape_HardwareInventory_USB_PATH, entry->d_name) < 0) { continue; }
+
+			duk_push_object(ctx);									// [inventory][array][device]
+			duk_push_object(ctx);									// [inventory][array][device][hardware]
+			ILibDuktape_HardwareInventory_ReadAttribute(path, "busnum", value, sizeof(value));
+			duk_push_sprintf(ctx, "%02d", atoi(value)); duk_put_prop_string(ctx, -2, "Bus");
+
+			// devpath is the port path, ie: 1.2 is port 2 of the hub on port 1. Root hubs are 0
+			ILibDuktape_HardwareInventory_ReadAttribute(path, "devpath", devpath, sizeof(devpath));
+			for (level = (strcmp(devpath, "0") == 0 || devpath[0] == 0) ? 0 : 1, port = devpath; *port != 0; ++port) { if (*port == '.') { ++level; } }
+			port = strrchr(devpath, '.');
+			duk_push_sprintf(ctx, "%02d", level); duk_put_prop_string(ctx, -2, "Lev");
+			if (sprintf_s(parent, sizeof(parent), "%s/..", path) >= 0 && level > 0 && ILibDuktape_HardwareInventory_ReadAttribute(parent, "devnum", value, sizeof(value)) > 0)
+			{
+				duk_push_sprintf(ctx, "%02d", atoi(value));
+			}
+			else
+			{
+				duk_push_string(ctx, "00");
+			}
+			duk_put_prop_string(ctx, -2, "Prnt");
+			duk_push_sprintf(ctx, "%02d", level > 0 ? atoi(port != NULL ? port + 1 : devpath) - 1 : 0); duk_put_prop_string(ctx, -2, "Port");
+			ILibDuktape_HardwareInventory_ReadAttribute(path, "devnum", value, sizeof(value));
+			duk_push_string(ctx, value); duk_put_prop_string(ctx, -2, "Dev");
+			ILibDuktape_HardwareInventory_ReadAttribute(path, "speed", value, sizeof(value));
+			duk_push_string(ctx, value); duk_put_prop_string(ctx, -2, "Spd");
+			ILibDuktape_HardwareInventory_ReadAttribute(path, "maxchild", value, sizeof(value));
+			duk_push_string(ctx, value); duk_put_prop_string(ctx, -2, "MxCh");
+			duk_freeze(ctx, -1);
+			duk_put_prop_string(ctx, -2, "hardware");				// [inventory][array][device]
+
+			if (ILibDuktape_HardwareInventory_ReadAttribute(path, "manufacturer", value, sizeof(value)) > 0) { duk_push_string(ctx, value); duk_put_prop_string(ctx, -2, "Manufacturer"); }
+			if (ILibDuktape_HardwareInventory_ReadAttribute(path, "product", value, sizeof(value)) > 0) { duk_push_string(ctx, value); duk_put_prop_string(ctx, -2, "Product"); }
+			if (ILibDuktape_HardwareInventory_ReadAttribute(path, "serial", value, sizeof(value)) > 0) { duk_push_string(ctx, value); duk_put_prop_string(ctx, -2, "SerialNumber"); }
+			duk_freeze(ctx, -1);
+			duk_put_prop_index(ctx, -2, i++);						// [inventory][array]
+		}
+		closedir(dir);
+	}
+	ILibDuktape_HardwareInventory_Cache(ctx, ILibDuktape_HardwareInventory_USB, &(hw->usbValid));
+	return(1);
+}
+
+//
+// Pushes the raw SMBIOS table, or null
+//
+duk_ret_t ILibDuktape_HardwareInventory_smbios(duk_context *ctx)
+{
+	struct stat info;
+	char *buffer;
+	int fd, len = 0, r;
+
+	ILibDuktape_HardwareInventory_GetState(ctx);					// [inventory]
+	if (ILibDuktape_HardwareInventory_Cached(ctx, ILibDuktape_HardwareInventory_SMBIOS, 1)) { return(1); }
+
+	if ((fd = open(ILibDuktape_HardwareInventory_SMBIOS_PATH, O_RDONLY | O_CLOEXEC)) < 0 || fstat(fd, &info) != 0 || info.st_size <= 0)
+	{
+		if (fd >= 0) { close(fd); }
+		duk_push_null(ctx);
+		return(1);
+	}
+
+	buffer = (char*)duk_push_fixed_buffer(ctx, (duk_size_t)info.st_size);	// [inventory][buffer]
+	while (len < (int)info.st_size && (r = (int)read(fd, buffer + len, (size_t)info.st_size - len)) > 0) { len += r; }
+	close(fd);
+	duk_push_buffer_object(ctx, -1, 0, (duk_size_t)len, DUK_BUFOBJ_NODEJS_BUFFER);	// [inventory][buffer][nodeBuffer]
+	duk_remove(ctx, -2);											// [inventory][nodeBuffer]
+
+	// Buffers can't be frozen, so this one is cached as is
+	duk_dup(ctx, -1);												// [inventory][nodeBuffer][nodeBuffer]
+	duk_put_prop_string(ctx, -3, ILibDuktape_HardwareInventory_SMBIOS);	// [inventory][nodeBuffer]
+	return(1);
+}
+
+char* ILibDuktape_HardwareInventory_SMBIOS_String(unsigned char *structure, unsigned char *end, int index)
+{
+	char *str = (char*)structure + structure[1];
+	if (index == 0) { return(NULL); }
+	while (--index > 0 && (unsigned char*)str < end && *str != 0) { str += strnlen(str, end - (unsigned char*)str) + 1; }
+	return(((unsigned char*)str < end && *str != 0) ? str : NULL);
+}
+void ILibDuktape_HardwareInventory_SMBIOS_PutString(duk_context *ctx, char *key, unsigned char *structure, unsigned char *end, int offset)
+{
+	char *str;
+	if (structure[1] <= offset) { return; }
+	if ((str = ILibDuktape_HardwareInventory_SMBIOS_String(structure, end, structure[offset])) != NULL)
+	{
+		duk_push_string(ctx, str);
+		duk_put_prop_string(ctx, -2, key);
+	}
+}
+
+//
+// SMBIOS structures are packed and little-endian, so fields are assembled from bytes, rather than read through a cast
+//
+unsigned short ILibDuktape_HardwareInventory_SMBIOS_Word(unsigned char *p)
+{
+	return((unsigned short)(p[0] | (p[1] << 8)));
+}
+unsigned int ILibDuktape_HardwareInventory_SMBIOS_DWord(unsigned char *p)
+{
+	return((unsigned int)ILibDuktape_HardwareInventory_SMBIOS_Word(p) | ((unsigned int)ILibDuktape_HardwareInventory_SMBIOS_Word(p + 2) << 16));
+}
+unsigned long long ILibDuktape_HardwareInventory_SMBIOS_QWord(unsigned char *p)
+{
+	return((unsigned long long)ILibDuktape_HardwareInventory_SMBIOS_DWord(p) | ((unsigned long long)ILibDuktape_HardwareInventory_SMBIOS_DWord(p + 4) << 32));
+}
+
+//
+// Formats a memory size in KB, the same as dmidecode
+//
+void ILibDuktape_HardwareInventory_PushMemorySize(duk_context *ctx, unsigned long long kb)
+{
+	if (kb != 0 && (kb % (1024ULL * 1024ULL)) == 0) { duk_push_sprintf(ctx, "%llu GB", kb >> 20); }
+	else if (kb != 0 && (kb % 1024ULL) == 0) { duk_push_sprintf(ctx, "%llu MB", kb >> 10); }
+	else { duk_push_sprintf(ctx, "%llu kB", kb); }
+}
+void ILibDuktape_HardwareInventory_PushMemoryDevice(duk_context *ctx, unsigned char *s, unsigned char *end)
+{
+	unsigned short word;
+	char detail[256];
+	int i;
+
+	duk_push_object(ctx);											// [device]
+	if (s[1] >= 0x0C)
+	{
+		word = ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x08);
+		if (word == 0xFFFF) { duk_push_string(ctx, "Unknown"); } else { duk_push_sprintf(ctx, "%u bits", word); }
+		duk_put_prop_string(ctx, -2, "TotalWidth");
+		word = ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x0A);
+		if (word == 0xFFFF) { duk_push_string(ctx, "Unknown"); } else { duk_push_sprintf(ctx, "%u bits", word); }
+		duk_put_prop_string(ctx, -2, "DataWidth");
+	}
+	if (s[1] >= 0x0E)
+	{
+		word = ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x0C);
+		if (word == 0) { duk_push_string(ctx, "No Module Installed"); }
+		else if (word == 0xFFFF) { duk_push_string(ctx, "Unknown"); }
+		else if (word == 0x7FFF && s[1] >= 0x20) { ILibDuktape_HardwareInventory_PushMemorySize(ctx, (unsigned long long)(ILibDuktape_HardwareInventory_SMBIOS_DWord(s + 0x1C) & 0x7FFFFFFF) << 10); }
+		else if ((word & 0x8000) != 0) { ILibDuktape_HardwareInventory_PushMemorySize(ctx, (unsigned long long)(word & 0x7FFF)); }
+		else { ILibDuktape_HardwareInventory_PushMemorySize(ctx, (unsigned long long)word << 10); }
+		duk_put_prop_string(ctx, -2, "Size");
+	}
+	if (s[1] >= 0x15)
+	{
+		duk_push_string(ctx, ILibDuktape_HardwareInventory_Lookup(ILibDuktape_HardwareInventory_MemoryFormFactor, s[0x0E])); duk_put_prop_string(ctx, -2, "FormFactor");
+		if (s[0x0F] == 0) { duk_push_string(ctx, "None"); } else if (s[0x0F] == 0xFF) { duk_push_string(ctx, "Unknown"); } else { duk_push_sprintf(ctx, "%u", s[0x0F]); }
+		duk_put_prop_string(ctx, -2, "Set");
+		ILibDuktape_HardwareInventory_SMBIOS_PutString(ctx, "Locator", s, end, 0x10);
+		ILibDuktape_HardwareInventory_SMBIOS_PutString(ctx, "BankLocator", s, end, 0x11);
+		duk_push_string(ctx, ILibDuktape_HardwareInventory_Lookup(ILibDuktape_HardwareInventory_MemoryType, s[0x12])); duk_put_prop_string(ctx, -2, "Type");
+
+		word = ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x13);
+		detail[0] = 0;
+		for (i = 1; i < 16; ++i)
+		{
+			if ((word & (1 << i)) == 0) { continue; }
+			if (detail[0] != 0) { strcat_s(detail, sizeof(detail), " "); }
+			strcat_s(detail, sizeof(detail), ILibDuktape_HardwareInventory_MemoryTypeDetail[i]);
+		}
+		duk_push_string(ctx, detail[0] != 0 ? detail : "None"); duk_put_prop_string(ctx, -2, "TypeDetail");
+	}
+	if (s[1] >= 0x17)
+	{
+		word = ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x15);
+		if (word == 0) { duk_push_string(ctx, "Unknown"); } else { duk_push_sprintf(ctx, "%u MT/s", word); }
+		duk_put_prop_string(ctx, -2, "Speed");
+	}
+	if (s[1] >= 0x1B)
+	{
+		ILibDuktape_HardwareInventory_SMBIOS_PutString(ctx, "Manufacturer", s, end, 0x17);
+		ILibDuktape_HardwareInventory_SMBIOS_PutString(ctx, "SerialNumber", s, end, 0x18);
+		ILibDuktape_HardwareInventory_SMBIOS_PutString(ctx, "AssetTag", s, end, 0x19);
+		ILibDuktape_HardwareInventory_SMBIOS_PutString(ctx, "PartNumber", s, end, 0x1A);
+	}
+	if (s[1] >= 0x1C)
+	{
+		if ((s[0x1B] & 0x0F) == 0) { duk_push_string(ctx, "Unknown"); } else { duk_push_sprintf(ctx, "%u", s[0x1B] & 0x0F); }
+		duk_put_prop_string(ctx, -2, "Rank");
+	}
+	if (s[1] >= 0x22)
+	{
+		word = ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x20);
+		if (word == 0) { duk_push_string(ctx, "Unknown"); } else { duk_push_sprintf(ctx, "%u MT/s", word); }
+		duk_put_prop_string(ctx, -2, "ConfiguredMemorySpeed");
+	}
+	if (s[1] >= 0x28)
+	{
+		char *names[] = { "MinimumVoltage", "MaximumVoltage", "ConfiguredVoltage" };
+		for (i = 0; i < 3; ++i)
+		{
+			word = ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x22 + (2 * i));
+			if (word == 0) { duk_push_string(ctx, "Unknown"); } else { duk_push_sprintf(ctx, "%g V", (double)word / 1000.0); }
+			duk_put_prop_string(ctx, -2, names[i]);
+		}
+	}
+}
+void ILibDuktape_HardwareInventory_PushMemoryArray(duk_context *ctx, unsigned char *s)
+{
+	unsigned int kb;
+
+	duk_push_object(ctx);											// [array]
+	if (s[1] < 0x0F) { return; }
+	duk_push_string(ctx, s[0x04] >= 0xA0 && s[0x04] <= 0xA3 ? "PC-98 Add-on Card" : ILibDuktape_HardwareInventory_Lookup(ILibDuktape_HardwareInventory_MemoryArrayLocation, s[0x04])); duk_put_prop_string(ctx, -2, "Location");
+	duk_push_string(ctx, ILibDuktape_HardwareInventory_Lookup(ILibDuktape_HardwareInventory_MemoryArrayUse, s[0x05])); duk_put_prop_string(ctx, -2, "Use");
+	duk_push_string(ctx, ILibDuktape_HardwareInventory_Lookup(ILibDuktape_HardwareInventory_MemoryErrorCorrection, s[0x06])); duk_put_prop_string(ctx, -2, "ErrorCorrectionType");
+	kb = ILibDuktape_HardwareInventory_SMBIOS_DWord(s + 0x07);
+	if (kb == 0x80000000 && s[1] >= 0x17)
+	{
+		ILibDuktape_HardwareInventory_PushMemorySize(ctx, ILibDuktape_HardwareInventory_SMBIOS_QWord(s + 0x0F) >> 10);
+	}
+	else
+	{
+		ILibDuktape_HardwareInventory_PushMemorySize(ctx, (unsigned long long)kb);
+	}
+	duk_put_prop_string(ctx, -2, "MaximumCapacity");
+	duk_push_sprintf(ctx, "%u", ILibDuktape_HardwareInventory_SMBIOS_Word(s + 0x0D)); duk_put_prop_string(ctx, -2, "NumberOfDevices");
+}
+duk_ret_t ILibDuktape_HardwareInventory_memory(duk_context *ctx)
+{
+	unsigned char *table, *s, *end, *next;
+	duk_size_t tableLen;
+	int arrays = 0, devices = 0;
+
+	ILibDuktape_HardwareInventory_GetState(ctx);					// [inventory]
+	if (ILibDuktape_HardwareInventory_Cached(ctx, ILibDuktape_HardwareInventory_MEMORY, 1)) { return(1); }
+
+	duk_push_this(ctx);												// [inventory][inventory]
+	duk_get_prop_string(ctx, -1, "smbios");							// [inventory][inventory][smbios]
+	duk_swap_top(ctx, -2);											// [inventory][smbios][this]
+	duk_call_method(ctx, 0);										// [inventory][table]
+	if (duk_is_null(ctx, -1)) { return(1); }
+	table = (unsigned char*)duk_get_buffer_data(ctx, -1, &tableLen);
+	end = table + tableLen;
+
+	duk_push_object(ctx);											// [inventory][table][memory]
+	duk_push_array(ctx); duk_put_prop_string(ctx, -2, "Physical Memory Array");
+	duk_push_array(ctx); duk_put_prop_string(ctx, -2, "Memory Device");
+
+	for (s = table; s + 4 <= end && s[1] >= 4 && s + s[1] <= end; s = next)
+	{
+		// The formatted area is followed by the string set, which is terminated by a double NULL
+		for (next = s + s[1]; next + 1 < end && (next[0] != 0 || next[1] != 0); ++next);
+		next += 2;
+
+		if (s[0] == 16)
+		{
+			duk_get_prop_string(ctx, -1, "Physical Memory Array");	// [inventory][table][memory][arrays]
+			ILibDuktape_HardwareInventory_PushMemoryArray(ctx, s);
+			duk_freeze(ctx, -1);
+			duk_put_prop_index(ctx, -2, arrays++);
+			duk_pop(ctx);											// [inventory][table][memory]
+		}
+		else if (s[0] == 17)
+		{
+			duk_get_prop_string(ctx, -1, "Memory Device");			// [inventory][table][memory][devices]
+			ILibDuktape_HardwareInventory_PushMemoryDevice(ctx, s, end);
+			duk_freeze(ctx, -1);
+			duk_put_prop_index(ctx, -2, devices++);
+			duk_pop(ctx);											// [inventory][table][memory]
+		}
+		else if (s[0] == 127)
+		{
+			break;													// End of Table
+		}
+	}
+	duk_remove(ctx, -2);											// [inventory][memory]
+	ILibDuktape_HardwareInventory_Cache(ctx, ILibDuktape_HardwareInventory_MEMORY, NULL);
+	return(1);
+}
+duk_ret_t ILibDuktape_HardwareInventory_Finalizer(duk_context *ctx)
+{
+	ILibDuktape_HardwareInventory *hw = (ILibDuktape_HardwareInventory*)Duktape_GetBufferProperty(ctx, 0, ILibDuktape_HardwareInventory_PTR);
+	if (hw != NULL && hw->uevent >= 0) { close(hw->uevent); hw->uevent = -1; }
+	return(0);
+}
+void ILibDuktape_HardwareInventory_PUSH(duk_context *ctx, void *chain)
+{
+	ILibDuktape_HardwareInventory *hw;
+	struct sockaddr_nl addr;
+
+	duk_push_object(ctx);											// [HardwareInventory]
+	hw = (ILibDuktape_HardwareInventory*)Duktape_PushBuffer(ctx, sizeof(ILibDuktape_HardwareInventory));
+	duk_put_prop_string(ctx, -2, ILibDuktape_HardwareInventory_PTR);
+
+	memset(&addr, 0, sizeof(addr));
+	addr.nl_family = AF_NETLINK;
+	addr.nl_pid = 0;
+	addr.nl_groups = 1;												// Kernel events
+	if ((hw->uevent = socket(AF_NETLINK, SOCK_DGRAM | SOCK_NONBLOCK | SOCK_CLOEXEC, NETLINK_KOBJECT_UEVENT)) >= 0 && bind(hw->uevent, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+	{
+		close(hw->uevent);
+		hw->uevent = -1;
+	}
+
+	ILibDuktape_CreateInstanceMethod(ctx, "dmi", ILibDuktape_HardwareInventory_dmi, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "cpu", ILibDuktape_HardwareInventory_cpu, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "pci", ILibDuktape_HardwareInventory_pci, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "disks", ILibDuktape_HardwareInventory_disks, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "usb", ILibDuktape_HardwareInventory_usb, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "smbios", ILibDuktape_HardwareInventory_smbios, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "memory", ILibDuktape_HardwareInventory_memory, 0);
+	ILibDuktape_CreateFinalizer(ctx, ILibDuktape_HardwareInventory_Finalizer);
+}
+void ILibDuktape_HardwareInventory_Init(duk_context *ctx)
+{
+	ILibDuktape_ModSearch_AddHandler(ctx, "HardwareInventory", ILibDuktape_HardwareInventory_PUSH);
+}
+
+#else
+
+void ILibDuktape_HardwareInventory_Init(duk_context *ctx)
+{
+	UNREFERENCED_PARAMETER(ctx);
+}
+
+#endif
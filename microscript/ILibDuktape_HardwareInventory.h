@@ -0,0 +1,71 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef __ILIBDUKTAPE_HARDWAREINVENTORY__
+#define __ILIBDUKTAPE_HARDWAREINVENTORY__
+
+#include "duktape.h"
+
+#ifdef __DOXY__
+/*!
+\brief Native hardware inventory for Linux, read from sysfs, procfs and the SMBIOS tables, without spawning lspci/lshw/dmidecode. <b>Note:</b> To use, must <b>require('HardwareInventory')</b>
+*
+Results are cached and frozen. pci(), disks() and usb() are invalidated by kernel hotplug (uevent) notifications, the rest never change while the system is running.
+*/
+class HardwareInventory
+{
+public:
+	/*!
+	\brief Contents of /sys/class/dmi/id. Entries that are unreadable, or set to 'None', are omitted
+	\return Object of {name: value}
+	*/
+	Object dmi();
+	/*!
+	\brief Processor information from /proc/cpuinfo
+	\return {name, vendor, count}
+	*/
+	Object cpu();
+	/*!
+	\brief Enumerates the PCI devices in /sys/bus/pci/devices. Names are resolved from pci.ids, the same as lspci -m
+	\return <Object[]> Array of {bus, vendorId, deviceId, classId, revision, device, manufacturer, description, subsystem: {manufacturer, description}}
+	*/
+	Array pci();
+	/*!
+	\brief Enumerates the physical block devices in /sys/block, the same as lshw -class disk
+	\return <Object[]> Array of {name, Caption, Model, Size, bytes, removable}
+	*/
+	Array disks();
+	/*!
+	\brief Enumerates the USB devices in /sys/bus/usb/devices, the same as usb-devices
+	\return <Object[]> Array of {hardware: {Bus, Lev, Prnt, Port, Dev, Spd, MxCh}, Manufacturer, Product, SerialNumber}
+	*/
+	Array usb();
+	/*!
+	\brief Raw SMBIOS structure table, from /sys/firmware/dmi/tables/DMI
+	\return Buffer, or null if the table is not readable (requires root)
+	*/
+	Buffer smbios();
+	/*!
+	\brief Decodes the SMBIOS Physical Memory Array (Type 16) and Memory Device (Type 17) structures, using the same names as dmidecode -t memory
+	\return {'Physical Memory Array': [], 'Memory Device': []}, or null if the table is not readable
+	*/
+	Object memory();
+};
+#endif
+
+void ILibDuktape_HardwareInventory_Init(duk_context *ctx);
+
+#endif
@@ -0,0 +1,464 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "duktape.h"
+#include "ILibDuktapeModSearch.h"
+#include "ILibDuktape_Helpers.h"
+#include "ILibDuktape_LoginSessions.h"
+#include "../microstack/ILibParsers.h"
+
+#if defined(_POSIX) && !defined(__APPLE__) && !defined(_FREEBSD)
+
+#include <pwd.h>
+#include <grp.h>
+#include <utmpx.h>
+#include <dirent.h>
+#include <errno.h>
+#include <ctype.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/inotify.h>
+
+#define ILibDuktape_LoginSessions_PTR				"\xFF_LoginSessions_PTR"
+#define ILibDuktape_LoginSessions_Users				"\xFF_LoginSessions_Users"
+#define ILibDuktape_LoginSessions_Sessions			"\xFF_LoginSessions_Sessions"
+#define ILibDuktape_LoginSessions_Seats				"\xFF_LoginSessions_Seats"
+
+#define ILibDuktape_LoginSessions_SESSIONS_PATH		"/run/systemd/sessions"
+#define ILibDuktape_LoginSessions_SEATS_PATH		"/run/systemd/seats"
+#define ILibDuktape_LoginSessions_UTMP_PATH			"/var/run/utmp"
+#define ILibDuktape_LoginSessions_MAX_BUFFER		1048576
+
+typedef struct ILibDuktape_LoginSessions
+{
+	int fd;						// inotify descriptor, used to invalidate the caches
+	int passwdWatch;
+	int sessionsWatch;
+	int seatsWatch;
+	int utmpWatch;
+	int usersValid;
+	int sessionsValid;
+	int seatsValid;
+}ILibDuktape_LoginSessions;
+
+// KEY=VALUE attributes that are converted from strings, when parsing the logind state files
+char *ILibDuktape_LoginSessions_NumberKeys[] = { "UID", "LEADER", "VTNR", "POSITION", "ACTIVE_UID", NULL };
+char *ILibDuktape_LoginSessions_SessionBooleanKeys[] = { "ACTIVE", "REMOTE", "IS_DISPLAY", "IDLE_HINT", "LOCKED_HINT", NULL };
+char *ILibDuktape_LoginSessions_SeatBooleanKeys[] = { "IS_SEAT0", "CAN_MULTI_SESSION", "CAN_TTY", "CAN_GRAPHICAL", NULL };
+char *ILibDuktape_LoginSessions_SeatListKeys[] = { "SESSIONS", "UIDS", NULL };
+
+//
+// Drains the inotify descriptor, and invalidates the affected caches. Caches are only used while their watch is active
+//
+void ILibDuktape_LoginSessions_CheckWatches(ILibDuktape_LoginSessions *ls)
+{
+	char buffer[4096] __attribute__((aligned(__alignof__(struct inotify_event))));
+	struct inotify_event *evt;
+	ssize_t len;
+	int i;
+
+	if (ls->fd < 0) { return; }
+	while ((len = read(ls->fd, buffer, sizeof(buffer))) > 0)
+	{
+		for (i = 0; i < len; i += (int)(sizeof(struct inotify_event) + evt->len))
+		{
+			evt = (struct inotify_event*)(buffer + i);
+			if ((evt->mask & IN_Q_OVERFLOW) == IN_Q_OVERFLOW)
+			{
+				ls->usersValid = ls->sessionsValid = ls->seatsValid = 0;
+			}
+			else if (evt->wd == ls->passwdWatch)
+			{
+				if (evt->len > 0 && (strcmp(evt->name, "passwd") == 0 || strcmp(evt->name, "group") == 0)) { ls->usersValid = 0; }
+			}
+			else if (evt->wd == ls->sessionsWatch || evt->wd == ls->utmpWatch)
+			{
+				ls->sessionsValid = 0;
+			}
+			else if (evt->wd == ls->seatsWatch)
+			{
+				ls->seatsValid = 0;
+			}
+		}
+	}
+}
+int ILibDuktape_LoginSessions_IsKey(char **keys, char *key)
+{
+	int i;
+	for (i = 0; keys[i] != NULL; ++i)
+	{
+		if (strcmp(keys[i], key) == 0) { return(1); }
+	}
+	return(0);
+}
+
+//
+// Pushes a user object, from a passwd entry
+//
+void ILibDuktape_LoginSessions_PushPasswd(duk_context *ctx, struct passwd *pw)
+{
+	duk_push_object(ctx);											// [user]
+	duk_push_string(ctx, pw->pw_name); duk_put_prop_string(ctx, -2, "name");
+	duk_push_uint(ctx, (duk_uint_t)pw->pw_uid); duk_put_prop_string(ctx, -2, "uid");
+	duk_push_uint(ctx, (duk_uint_t)pw->pw_gid); duk_put_prop_string(ctx, -2, "gid");
+	duk_push_string(ctx, pw->pw_gecos != NULL ? pw->pw_gecos : ""); duk_put_prop_string(ctx, -2, "gecos");
+	duk_push_string(ctx, pw->pw_dir != NULL ? pw->pw_dir : ""); duk_put_prop_string(ctx, -2, "home");
+	duk_push_string(ctx, pw->pw_shell != NULL ? pw->pw_shell : ""); duk_put_prop_string(ctx, -2, "shell");
+}
+
+//
+// Parses a logind state file (KEY=VALUE per line) into the object at the top of the stack
+//
+void ILibDuktape_LoginSessions_ParseStateFile(duk_context *ctx, char *path, char **booleanKeys, char **listKeys)
+{
+	char buffer[8192];
+	char name[64];
+	char *line, *value, *next;
+	int fd, len, i, n, upper;
+
+	if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0) { return; }
+	len = (int)read(fd, buffer, sizeof(buffer) - 1);
+	close(fd);
+	if (len <= 0) { return; }
+	buffer[len] = 0;
+
+	for (line = buffer; line != NULL && *line != 0; line = next)
+	{
+		if ((next = strchr(line, '\n')) != NULL) { *next++ = 0; }
+		if (*line == '#' || (value = strchr(line, '=')) == NULL) { continue; }
+		*value++ = 0;
+
+		// REMOTE_HOST => remoteHost
+		for (i = 0, n = 0, upper = 0; line[i] != 0 && n < (int)sizeof(name) - 1; ++i)
+		{
+			if (line[i] == '_') { upper = 1; continue; }
+			name[n++] = upper != 0 ? (char)toupper(line[i]) : (char)tolower(line[i]);
+			upper = 0;
+		}
+		name[n] = 0;
+
+		if (ILibDuktape_LoginSessions_IsKey(ILibDuktape_LoginSessions_NumberKeys, line))
+		{
+			duk_push_number(ctx, (duk_double_t)strtoul(value, NULL, 10));
+		}
+		else if (booleanKeys != NULL && ILibDuktape_LoginSessions_IsKey(booleanKeys, line))
+		{
+			duk_push_boolean(ctx, strcmp(value, "1") == 0 || strcmp(value, "yes") == 0);
+		}
+		else if (listKeys != NULL && ILibDuktape_LoginSessions_IsKey(listKeys, line))
+		{
+			if (*value == 0)
+			{
+				duk_push_array(ctx);								// [obj][array]
+			}
+			else
+			{
+				duk_push_string(ctx, value);						// [obj][value]
+				duk_string_split(ctx, -1, " ");						// [obj][value][array]
+				duk_remove(ctx, -2);								// [obj][array]
+			}
+		}
+		else
+		{
+			duk_push_string(ctx, value);
+		}
+		duk_put_prop_string(ctx, -2, name);
+	}
+}
+
+//
+// Enumerates a logind state directory, pushing an array of parsed state files
+//
+int ILibDuktape_LoginSessions_PushStateDirectory(duk_context *ctx, char *dirPath, char **booleanKeys, char **listKeys)
+{
+	char path[PATH_MAX];
+	struct dirent *entry;
+	DIR *dir;
+	int i = 0;
+
+	if ((dir = opendir(dirPath)) == NULL) { return(1); }
+	duk_push_array(ctx);											// [array]
+	while ((entry = readdir(dir)) != NULL)
+	{
+		if (entry->d_name[0] == '.') { continue; }					// Skip temporary files that logind is still writing
+		if (sprintf_s(path, sizeof(path), "%s/%s", dirPath, entry->d_name) < 0) { continue; }
+
+		duk_push_object(ctx);										// [array][obj]
+		duk_push_string(ctx, entry->d_name); duk_put_prop_string(ctx, -2, "id");
+		ILibDuktape_LoginSessions_ParseStateFile(ctx, path, booleanKeys, listKeys);
+		duk_freeze(ctx, -1);
+		duk_put_prop_index(ctx, -2, i++);							// [array]
+	}
+	closedir(dir);
+	return(0);
+}
+
+//
+// When logind isn't running, fall back to the logged in users in utmp
+//
+void ILibDuktape_LoginSessions_PushUtmp(duk_context *ctx)
+{
+	struct utmpx *u;
+	struct passwd pw, *result;
+	char buffer[4096];
+	char user[sizeof(u->ut_user) + 1];
+	char line[sizeof(u->ut_line) + 1];
+	char host[sizeof(u->ut_host) + 1];
+	int i = 0;
+
+	duk_push_array(ctx);											// [array]
+	setutxent();
+	while ((u = getutxent()) != NULL)
+	{
+		if (u->ut_type != USER_PROCESS) { continue; }
+		memcpy_s(user, sizeof(user), u->ut_user, sizeof(u->ut_user)); user[sizeof(u->ut_user)] = 0;
+		memcpy_s(line, sizeof(line), u->ut_line, sizeof(u->ut_line)); line[sizeof(u->ut_line)] = 0;
+		memcpy_s(host, sizeof(host), u->ut_host, sizeof(u->ut_host)); host[sizeof(u->ut_host)] = 0;
+
+		duk_push_object(ctx);										// [array][session]
+		duk_push_string(ctx, line); duk_put_prop_string(ctx, -2, "id");
+		duk_push_string(ctx, user); duk_put_prop_string(ctx, -2, "user");
+		if (getpwnam_r(user, &pw, buffer, sizeof(buffer), &result) == 0 && result != NULL)
+		{
+			duk_push_uint(ctx, (duk_uint_t)pw.pw_uid); duk_put_prop_string(ctx, -2, "uid");
+		}
+		duk_push_string(ctx, line); duk_put_prop_string(ctx, -2, "tty");
+		duk_push_boolean(ctx, host[0] != 0); duk_put_prop_string(ctx, -2, "remote");
+		if (host[0] != 0) { duk_push_string(ctx, host); duk_put_prop_string(ctx, -2, "remoteHost"); }
+		duk_push_int(ctx, (duk_int_t)u->ut_pid); duk_put_prop_string(ctx, -2, "leader");
+		duk_push_number(ctx, (duk_double_t)u->ut_tv.tv_sec); duk_put_prop_string(ctx, -2, "timestamp");
+		duk_freeze(ctx, -1);
+		duk_put_prop_index(ctx, -2, i++);							// [array]
+	}
+	endutxent();
+}
+
+ILibDuktape_LoginSessions* ILibDuktape_LoginSessions_GetState(duk_context *ctx)
+{
+	ILibDuktape_LoginSessions *ls;
+	duk_push_this(ctx);												// [obj]
+	ls = (ILibDuktape_LoginSessions*)Duktape_GetBufferProperty(ctx, -1, ILibDuktape_LoginSessions_PTR);
+	ILibDuktape_LoginSessions_CheckWatches(ls);
+	return(ls);
+}
+
+duk_ret_t ILibDuktape_LoginSessions_users(duk_context *ctx)
+{
+	ILibDuktape_LoginSessions *ls = ILibDuktape_LoginSessions_GetState(ctx);
+	struct passwd pw, *result;
+	size_t bufferLen = 16384;
+	char *buffer;
+	int i = 0, err;
+
+	if (ls->usersValid != 0 && duk_has_prop_string(ctx, -1, ILibDuktape_LoginSessions_Users))
+	{
+		duk_get_prop_string(ctx, -1, ILibDuktape_LoginSessions_Users);
+		return(1);
+	}
+
+	if ((buffer = (char*)malloc(bufferLen)) == NULL) { ILIBCRITICALEXIT(254); }
+	duk_push_array(ctx);											// [obj][array]
+	setpwent();
+	while (1)
+	{
+#ifdef __GLIBC__
+		err = getpwent_r(&pw, buffer, bufferLen, &result);
+#else
+		errno = 0;
+		err = (result = getpwent()) == NULL ? errno : 0;
+		if (result != NULL) { pw = *result; }
+#endif
+		if (err == ERANGE && bufferLen < ILibDuktape_LoginSessions_MAX_BUFFER)
+		{
+			// Entry didn't fit, so try again with a larger buffer
+			bufferLen *= 2;
+			if ((buffer = (char*)realloc(buffer, bufferLen)) == NULL) { ILIBCRITICALEXIT(254); }
+			continue;
+		}
+		if (err != 0 || result == NULL) { break; }
+
+		ILibDuktape_LoginSessions_PushPasswd(ctx, &pw);				// [obj][array][user]
+		duk_freeze(ctx, -1);
+		duk_put_prop_index(ctx, -2, i++);							// [obj][array]
+	}
+	endpwent();
+	free(buffer);
+	duk_freeze(ctx, -1);
+
+	if (ls->passwdWatch >= 0)
+	{
+		duk_dup(ctx, -1);											// [obj][array][array]
+		duk_put_prop_string(ctx, -3, ILibDuktape_LoginSessions_Users);	// [obj][array]
+		ls->usersValid = 1;
+	}
+	return(1);
+}
+duk_ret_t ILibDuktape_LoginSessions_getUser(duk_context *ctx)
+{
+	struct passwd pw, *result = NULL;
+	char buffer[16384];
+
+	if (duk_is_number(ctx, 0))
+	{
+		getpwuid_r((uid_t)duk_require_uint(ctx, 0), &pw, buffer, sizeof(buffer), &result);
+	}
+	else
+	{
+		getpwnam_r(duk_require_string(ctx, 0), &pw, buffer, sizeof(buffer), &result);
+	}
+
+	if (result == NULL)
+	{
+		duk_push_null(ctx);
+	}
+	else
+	{
+		ILibDuktape_LoginSessions_PushPasswd(ctx, &pw);
+	}
+	return(1);
+}
+duk_ret_t ILibDuktape_LoginSessions_getGroup(duk_context *ctx)
+{
+	struct group gr, *result = NULL;
+	char buffer[16384];
+	int i;
+
+	if (duk_is_number(ctx, 0))
+	{
+		getgrgid_r((gid_t)duk_require_uint(ctx, 0), &gr, buffer, sizeof(buffer), &result);
+	}
+	else
+	{
+		getgrnam_r(duk_require_string(ctx, 0), &gr, buffer, sizeof(buffer), &result);
+	}
+
+	if (result == NULL)
+	{
+		duk_push_null(ctx);
+		return(1);
+	}
+
+	duk_push_object(ctx);											// [group]
+	duk_push_string(ctx, gr.gr_name); duk_put_prop_string(ctx, -2, "name");
+	duk_push_uint(ctx, (duk_uint_t)gr.gr_gid); duk_put_prop_string(ctx, -2, "gid");
+	duk_push_array(ctx);											// [group][members]
+	for (i = 0; gr.gr_mem != NULL && gr.gr_mem[i] != NULL; ++i)
+	{
+		duk_push_string(ctx, gr.gr_mem[i]);
+		duk_put_prop_index(ctx, -2, i);
+	}
+	duk_put_prop_string(ctx, -2, "members");						// [group]
+	return(1);
+}
+duk_ret_t ILibDuktape_LoginSessions_sessions(duk_context *ctx)
+{
+	ILibDuktape_LoginSessions *ls = ILibDuktape_LoginSessions_GetState(ctx);
+
+	if (ls->sessionsValid != 0 && duk_has_prop_string(ctx, -1, ILibDuktape_LoginSessions_Sessions))
+	{
+		duk_get_prop_string(ctx, -1, ILibDuktape_LoginSessions_Sessions);
+		return(1);
+	}
+
+	if (ILibDuktape_LoginSessions_PushStateDirectory(ctx, ILibDuktape_LoginSessions_SESSIONS_PATH, ILibDuktape_LoginSessions_SessionBooleanKeys, NULL) != 0)
+	{
+		ILibDuktape_LoginSessions_PushUtmp(ctx);					// [obj][array]
+	}
+	duk_freeze(ctx, -1);
+
+	if (ls->utmpWatch >= 0 && (ls->sessionsWatch >= 0 || access(ILibDuktape_LoginSessions_SESSIONS_PATH, F_OK) != 0))
+	{
+		duk_dup(ctx, -1);											// [obj][array][array]
+		duk_put_prop_string(ctx, -3, ILibDuktape_LoginSessions_Sessions);	// [obj][array]
+		ls->sessionsValid = 1;
+	}
+	return(1);
+}
+duk_ret_t ILibDuktape_LoginSessions_seats(duk_context *ctx)
+{
+	ILibDuktape_LoginSessions *ls = ILibDuktape_LoginSessions_GetState(ctx);
+
+	if (ls->seatsValid != 0 && duk_has_prop_string(ctx, -1, ILibDuktape_LoginSessions_Seats))
+	{
+		duk_get_prop_string(ctx, -1, ILibDuktape_LoginSessions_Seats);
+		return(1);
+	}
+
+	if (ILibDuktape_LoginSessions_PushStateDirectory(ctx, ILibDuktape_LoginSessions_SEATS_PATH, ILibDuktape_LoginSessions_SeatBooleanKeys, ILibDuktape_LoginSessions_SeatListKeys) != 0)
+	{
+		duk_push_array(ctx);										// [obj][array]
+	}
+	duk_freeze(ctx, -1);
+
+	if (ls->seatsWatch >= 0)
+	{
+		duk_dup(ctx, -1);											// [obj][array][array]
+		duk_put_prop_string(ctx, -3, ILibDuktape_LoginSessions_Seats);	// [obj][array]
+		ls->seatsValid = 1;
+	}
+	return(1);
+}
+duk_ret_t ILibDuktape_LoginSessions_logind(duk_context *ctx)
+{
+	duk_push_boolean(ctx, access(ILibDuktape_LoginSessions_SESSIONS_PATH, F_OK) == 0);
+	return(1);
+}
+duk_ret_t ILibDuktape_LoginSessions_Finalizer(duk_context *ctx)
+{
+	ILibDuktape_LoginSessions *ls = (ILibDuktape_LoginSessions*)Duktape_GetBufferProperty(ctx, 0, ILibDuktape_LoginSessions_PTR);
+	if (ls != NULL && ls->fd >= 0) { close(ls->fd); ls->fd = -1; }
+	return(0);
+}
+void ILibDuktape_LoginSessions_PUSH(duk_context *ctx, void *chain)
+{
+	ILibDuktape_LoginSessions *ls;
+
+	duk_push_object(ctx);											// [LoginSessions]
+	ls = (ILibDuktape_LoginSessions*)Duktape_PushBuffer(ctx, sizeof(ILibDuktape_LoginSessions));
+	duk_put_prop_string(ctx, -2, ILibDuktape_LoginSessions_PTR);
+
+	ls->passwdWatch = ls->sessionsWatch = ls->seatsWatch = ls->utmpWatch = -1;
+	if ((ls->fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) >= 0)
+	{
+		// passwd/group are usually replaced with a rename, so we need to watch the directory
+		ls->passwdWatch = inotify_add_watch(ls->fd, "/etc", IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE);
+		ls->sessionsWatch = inotify_add_watch(ls->fd, ILibDuktape_LoginSessions_SESSIONS_PATH, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MODIFY);
+		ls->seatsWatch = inotify_add_watch(ls->fd, ILibDuktape_LoginSessions_SEATS_PATH, IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE | IN_DELETE | IN_MODIFY);
+		ls->utmpWatch = inotify_add_watch(ls->fd, ILibDuktape_LoginSessions_UTMP_PATH, IN_MODIFY | IN_CLOSE_WRITE);
+	}
+
+	ILibDuktape_CreateEventWithGetter(ctx, "logind", ILibDuktape_LoginSessions_logind);
+	ILibDuktape_CreateInstanceMethod(ctx, "users", ILibDuktape_LoginSessions_users, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "getUser", ILibDuktape_LoginSessions_getUser, 1);
+	ILibDuktape_CreateInstanceMethod(ctx, "getGroup", ILibDuktape_LoginSessions_getGroup, 1);
+	ILibDuktape_CreateInstanceMethod(ctx, "sessions", ILibDuktape_LoginSessions_sessions, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "seats", ILibDuktape_LoginSessions_seats, 0);
+	ILibDuktape_CreateFinalizer(ctx, ILibDuktape_LoginSessions_Finalizer);
+}
+void ILibDuktape_LoginSessions_Init(duk_context *ctx)
+{
+	ILibDuktape_ModSearch_AddHandler(ctx, "LoginSessions", ILibDuktape_LoginSessions_PUSH);
+}
+
+#else
+
+void ILibDuktape_LoginSessions_Init(duk_context *ctx)
+{
+	UNREFERENCED_PARAMETER(ctx);
+}
+
+#endif
@@ -0,0 +1,67 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef __ILIBDUKTAPE_LOGINSESSIONS__
+#define __ILIBDUKTAPE_LOGINSESSIONS__
+
+#include "duktape.h"
+
+#ifdef __DOXY__
+/*!
+\brief Native user, login session and seat enumeration for Linux, without spawning getent/loginctl. <b>Note:</b> To use, must <b>require('LoginSessions')</b>
+*
+Results of users(), sessions() and seats() are cached, and invalidated by inotify when /etc/passwd, /run/systemd/sessions, /run/systemd/seats or utmp change. Cached results are frozen.
+*/
+class LoginSessions
+{
+public:
+	/*!
+	\brief true if systemd-logind session state is available in /run/systemd/sessions
+	*/
+	bool logind;
+	/*!
+	\brief Enumerates the password database
+	\return <Object[]> Array of {name, uid, gid, gecos, home, shell}
+	*/
+	Array users();
+	/*!
+	\brief Looks up a user by uid or name
+	\param id <number|String> uid or username
+	\return {name, uid, gid, gecos, home, shell}, or null if not found
+	*/
+	Object getUser(id);
+	/*!
+	\brief Looks up a group by gid or name
+	\param id <number|String> gid or group name
+	\return {name, gid, members}, or null if not found
+	*/
+	Object getGroup(id);
+	/*!
+	\brief Enumerates the login sessions, from /run/systemd/sessions if available, otherwise from utmp
+	\return <Object[]> Array of {id, uid, user, seat, tty, display, type, class, state, active, remote, remoteHost, leader, ...}
+	*/
+	Array sessions();
+	/*!
+	\brief Enumerates the seats in /run/systemd/seats
+	\return <Object[]> Array of {id, active, activeUid, sessions, canGraphical, canTty, canMultiSession}
+	*/
+	Array seats();
+};
+#endif
+
+void ILibDuktape_LoginSessions_Init(duk_context *ctx);
+
+#endif
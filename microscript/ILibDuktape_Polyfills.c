@@ -2514,7 +2514,7 @@ void ILibDuktape_Polyfills_JS_Init(duk_context *ctx)
 	duk_peval_string_noresult(ctx, "addCompressedModule('util-descriptors', Buffer.from('eJztWE1z2zYQvWtG/2HLSYZUTFOyc6oVZ0b+atQ6ssdykkkV14VIUMKEAlkAtOy66m/vgh8SKTK2dGhO4cEygcXD28XuA8D2q2bjOIweBJtMFex39vegzxUN4DgUUSiIYiFvNpqNc+ZSLqkHMfeoADWl0IuIiz9Zjw0fqZBoDftOByxtYGRdRqvbbDyEMczIA/BQQSwpIjAJPgso0HuXRgoYBzecRQEj3KUwZ2qazJJhOM3G5wwhHCuCxgTNI3zzi2ZAlGYL+EyVig7a7fl87pCEqROKSTtI7WT7vH98Ohie7iJbPeIDD6iUIOhfMRPo5vgBSIRkXDJGigGZQyiATATFPhVqsnPBFOMTG2ToqzkRtNnwmFSCjWNVilNODf0tGmCkCAejN4T+0ICj3rA/tJuNT/3rdxcfruFT7+qqN7junw7h4gqOLwYn/ev+xQDfzqA3+Ay/9QcnNlCMEs5C7yOh2SNFpiNIPQzXkNLS9H6Y0pERdZnPXHSKT2IyoTAJ76jg6AtEVMyY1KsokZzXbARsxlSSBLLqEU7yqq2D52K3guHnwfG7q4tB//dTOITOfaez19FPV5s0G37MXQ2EsbsjAfOsVrPxmC6VmopwDpY5wNyQcYR5lwXIhB2IROiic04UEIU+zHQyLUqAE6ouIspPqHQFi1QoZIadokvMJXcKVgUo7c446MclGCfDx0UeS884WHXo544IcKcs8NC5LE0sM2m4zZDNlkPvqXuGSW2Z7THjbTk1bRiZ+HOjaRfhkpGOVF4YK/wRiGqa3XJzyC3TI4ogyNJZy23BY1I9yaidQ3AdFQ4xrfjEanVh8c2JqBBPICbjvjGScUdnO7UM7anEhIBdH4zi4jAP3wz4B5CT+eULN8H808RXMv8Ku2f6f9P4JrMlvvlobmCErSen54eG0d3QOsLgKCQ82ngE5ofFDve67M3grLuzw1objtuUPz69Q4mlqqwXzD6yDcDobD6W+dbR6PUN/AvtP0ad3Z9v2psS3I5jIXYv5Utp2DrwNui5t2Cbr5e9cfjxWWxouqld7sfNRiSMRZquzyJ/4fSeKcz3esw5YeoUDawqmBIP5YbH8qt+BFWxwAr9dXgxcCIiJLXWdcPByp9Zrdb6/Is1OiTRQNraeM5RRbLWIMeCkq/ddfUMGI/vf2hnTUoFEtra23aNcLZ977tp5/ZquJ3afgftLIuS1qQXbAtt2VKN/l+JeQb3h8As2zzqkzhQa9pShVskB8RljbpBKGnxcOh7PSHIw+r8qeXJ19rE4yDIQJivLzGoFAEbu3CY9qXykR5WXcL1XcZn3ANtY2oByddgPtU3m3wmJ6B8gveZt9CpHjqTiXPDKIysYlQ0CzR4C/uFuK7FdMnSSTxF+yLCojYmt1ps7yz8e0nU1AYiJkSIVUTqva9wfyIWy2lXIWbd1f9qFqHbo5tCU4RMivvD7S+UU8Hc95iWUxLgDnGMCaHoRyKYvpXl7FsFDPRDboVh7aH8pt5nq9SCV0+NvwyxyKkYsr9pPrG+WVlM33m6wOBNGa4LWgIrkcvIbsU1xR2xUt1gIJ0ollPdW2zHV8ymhOtR7PtUWC1HX5i1ncRdL2+0kfK2DpdW1fd0xJNkqbuIdfMrHvbXVKJc6dYqj9PkjPLMlCsQTDfL1N2AO3IozNrL4DliWOXqRthSXsxCzpDBLuN+iD6mg/r4Ypml/M3GuittKNW3hn2yuEsavFa3Ge6z6z/A+/cdvRTh/UM6YSISTlRI/SJkNuo9VdPQS4N1V9k8agyTxakYrmtwQaJrFL/ew4KqLseGXOFBkdYKVfpPrusapLrMc8ZvcdUu02PUO8I9LBA8TBU+KuShL5DCe9NPSZp9pYLT4PVzqpqbbbtMZj7Q8YKgEtMS9Noq6Pq5zI/E5eisXvLQlIEKQ63CtxgbOjboyBSqd7l8y9V7rKInkl/aUpuNJ76lPOaweAswk1uAeVBsyj6rmIXtexZ6cUCx3PUXH12fjzXfcg5q2uzKpn5QabGzTe4g+7WTdDxYCQQsCvEt5nn1nLEh0ezLVh27rKt2ziSyesddj6reeE3M9Nf75irAZS7OehEgubra0NP8B4ZlDiE=', 'base64'));");
 
 	// DNS helper util. See modules/util-dns for a human readable version
-	duk_peval_string_noresult(ctx, "addCompressedModule('util-dns', Buffer.from('eJzdV2uT2jYU/c4M/+HWbWN747V3SSZNlzIZso+UZsNmAkkmAyQVtgyaNZIrycuSLfntvQKzmH0AmWYmnfoDNtJ9nHuudGwFO+XSoUgnkg2GGip7lX1ocE0TOBQyFZJoJni5VC6dspByRSPIeEQl6CGFekpCvOUzHryjUqE1VPw9cIyBlU9ZbrVcmogMRmQCXGjIFMUITEHMEgr0MqSpBsYhFKM0YYSHFMZMD2dZ8hh+ufQhjyD6mqAxQfMU/8VFMyDaoAW8hlqnB0EwHo99MkPqCzkIkrmdCk4bh8fN1vEuojUeb3lClQJJ/8qYxDL7EyApgglJHyEmZAxCAhlIinNaGLBjyTTjAw+UiPWYSFouRUxpyfqZXuFpAQ3rLRogU4SDVW9Bo2XB83qr0fLKpfeN9u9nb9vwvv7mTb3Zbhy34OwNHJ41jxrtxlkT/51AvfkBXjaaRx5QZAmz0MtUGvQIkRkGaYR0tShdSR+LORyV0pDFLMSi+CAjAwoDcUElx1ogpXLElOmiQnBRuZSwEdOzRaBuV4RJdgJDXpzx0Nhg13gkxupTxJXjlktX805cEInEaqhBp1ddDrEUR3LCHfvTC8qpZOErItWQJLbrH0pKNG1i9gv6WorLiWM30mGSkpT5UYIWeSyW5qavqB6KyLFfUN2keizk+WsiyUjNLJd5I6LJNpnfEclM9539vcpjtwA8ofyr/K+d0dHX4nkWx1Q6rm9WEH2L2+1R5fT4OkteVAwOFnazFMeA90wg139HEqjVYM+de+RkX1fJ1SmuNgRqXPwjKmnsrMH8WjDc97LFPlMT9Sk8g8ovFTiAypOnHjx+uoRmrkgsnwuJzYWd9tNMDZ0cwVel9mD/iVvkSIsW7hg+cNwFieaawnhopMNxCmWupNvz1jWokNHNHdylIxY7Z/cHw26edjq/YXWZ5IDlaDMzLSz+hPHs8o6lHyLUqLhgZgOfUilC3LSIhl7S8ATLceygz3ighrYHHRtvvUXymYevdCQyjTeJ0Wy7ujosuGObVqPzNSQndOFqJrUzr4c1CAuMVmF6KwGV8u5IJtBtc8bnq9ixQqIhoDoMUIlEcuGHgsfwN6BipsDJiCoqUWVwBHHYXW6D/aeN/8j4HHZPzLNt3R/dvrLXTOLo0fFpzbKqG6xSrFvHYHU2WqJYOqy2X2W/NU+qDx8yd4P9JnyzHe38xL4EH38MDJVID749Moo9sN0Nnp9rCkVdo7vX9ixAnrbK9rlWq8CDB9Du7PdqNWvZBGtTNdsVVCD0Z9XtdvNfy8NmeO1OpbcFzEXrvI0dMVtwg8mm+QXa3tpk1nTtSuxyesk0LuBVmzFh+hgnnMWwlpNbujwXD+eP1lnTT1GMqHNzY/u4NUeodTdUBzdXOHTobaVfyFGnV/CYrryTRyQUd72R/2eydG87VZhplsDuLlJwvyB9Z0W6+m6KBF8g+Njtqh3Y6Xb1zpKZbrfT2dv9tdcLvplc1AtCdvZyWym7oTPznwNYPFme4doDjNh51Jvf9/+z2jPdSnv+lfrcrz9m2+vZgaYGW4hQ9ZZyzZz9czpRzjeQKIWHvHAITi45fpoQjct8tNSpkODBxZ59WNkHxaEYD2J9FS0GzTUSUYbg8CwkpFZY4fX3WKGOPn6Zn1eLkfDI8qiyNk7hULM2UkQkmq4Nda3F9wSKaEyyRK8LsSp9RXJhekdUJPof7kamjA==', 'base64'));"); 
+	duk_peval_string_noresult(ctx, "addCompressedModule('util-dns', Buffer.from('eNqtV21v2zYQ/m7A/+GmvUhKFSlxi66LZwxpkm5eMyeI3RaD7XWMRNlEZFIlqTpu6/32HSXZluuXZMCExHrh3T13x7uHZHBQr52JdCbZaKyhcdQ4hjbXNIEzIVMhiWaC12v12iULKVc0goxHVIIeUzhNSYi3csSDt1QqlIaGfwSOEbDKIctt1mszkcGEzIALDZmiaIEpiFlCgd6HNNXAOIRikiaM8JDClOlxjlLa8Ou1P0sL4lYTFCYonuJbXBUDoo23gNdY6/QkCKbTqU9yT30hR0FSyKngsn120eleHKK3RuMNT6hSIOmHjEkM83YGJEVnQnKLLiZkCkICGUmKY1oYZ6eSacZHHigR6ymRtF6LmNKS3WZ6LU8L1zDeqgBminCwTrvQ7lrw8rTb7nr12rt277erNz14d3pzc9rptS+6cHUDZ1ed83avfdXBt1dw2vkTXrc75x5QzBKi0PtUGu/RRWYySCNMV5fSNfhYFO6olIYsZiEGxUcZGVEYiY9UcowFUionTJlZVOhcVK8lbMJ0XgRqMyIEOQhM8oLA/EPPTOlERFmSB5upIlcfMipnud45+q+oRDQgUZS7HEsxyceuuoWdei3OeGgQsQZ4JKbqfcSV49Zrn4t5NULFHW5oTCU15WKC+5XqDtVTIe+uiSQT1IEQM3xrRtF3LI2TpaYpDoXVkVAiuT9hoRRmGn2swIDyw0wFJbi5P20EJGUBS8dJah54fLh4PhxRzQvQNAdd+Vg8fSQSi0pDC/rD5uoTS/FLWWyO/f5Xyqlk4R9EqjFJbNc/k5Ro2sHMf6TXUtzPHLtdQvpRghKlLZaWon9QPRaRY3+dhFxyhRsRTR6D/JZIZirfOT5qPHMrjieU/yf9pTIq+lq8zGKcMsf1TffQN0g1TxuXF0uUMqgYHAxsYz6N854x5PpvSQKtFhy5hUZZGssoubrETkNHjYp/jkUSO3t8vhYMOU922SdqrL6AX6DxYwNOoPH8hQfPXqxcM1ckVs8VYHPhTPtppsZO6cF/gvbg+LlbzZEWXWQLPnLcRRLNNYfp2NCm41TCXIM78uBxiG6p4K4UMdgiu9+Y7DZNr7RR2sxp3qYJwhS+zIsbhpxJDhijNl7OK/2bMJ7dV7p3o397uUEUymmLTigvuAY7P0kgEeJuyVqRYaSSM5B8A6rDAF9E8pFi0/J43bYpAhVKlprkWCHRVYVcHr4AknkKnExoSUlfQEuwB9wG+28b38j0Dg5fmWfbKvNf2nzSAvuzvfkN384vLluW1dw+mOJs6his/i4BjNZhreMm+7nzqvnkCXO3i+3AzlvH+Y79E/z1beDCZ1wgOS5RGW3CfKfGp5bCFUOjmtfzLMC1ep/xT61WA374AXr942GrZa2yZ7k71XZ7W0nJ92owGJS/lodZ9Hr9xrC5TzVPtWftltkR9Hz/5Ay3WbTmeQ1sqWBc6PAvJEli1vRYIz9SLrLR2MO6xcJjGmSGxYtVbeo4FcIIqjFNEuVhKStNiVHEdZlM80WYAKe43eC4M8JtC2g2oeu4Ws42aK9oQ+f37lXHx5VI0RXpdA3WNeJi86MrThGV6ysdiUz7SDETZJgFxZRtjT0Tjh3q7gACpz+saMzX1u0JCcWeVRuHr7pbO77YF+IWZYZZmUCmGVbmDKfBPJmtRIxdPP6aDzZbP0SCjKrLVP7hfSpFiPKYBnpPw1dIoo4d3DIeqLHtQd/G2zKoXGORIty0oTXbbq5/FtyxzQKDysvYndA0ntnc5lpYOmGFx7ERNwColNstGUPz1dKzVGC8WD0dq0zM4aHJxk5C285oG34szSK17RmscNx+qUU/fX5QcpP19ss/5N+CB+EfCP4aDNQBHAwG+mCVmcGg3z86/Gk4DNyHTT0CDa/TCo1evS6J9DGKVQIsfk5g8WR5JtceoMX+02FxPx4+zu6SHR8Unj8gMn/kRM/3ghkG3VfMuPDSe6axWNdtTAnTFzjgrJS38Z9pe52f1VpQIcGv23jBds0N5syV/Ts6U87/wIUKz6/IVE5JOX6aEI1lPlkRYkiQ7Ox892OfVD/FeMa8VdHio7mKMxWyFp7ItcIIlzurJpSkeplvo/DMBi+75ys23bFPMtctburumlXk/KizF7dyImsWuO+KLyvExTFlH1BEJFrai7RcQ5YRFsvGEqfgvu0oEY1Jluh99tdptjqRMG9uWsVJ/ReHdgBb', 'base64'), '2026-10-18T13:52:47.000+00:00');"); 
 #ifdef WIN32
 	// Adding win-registry, since it is very useful for windows... Refer to /modules/win-registry.js to see a human readable version
 	duk_peval_string_noresult(ctx, "addCompressedModule('win-registry', Buffer.from('eJzVW+tz2sYW/+4Z/w9bfyiiEQLjPHzt69shNmkY25DwiG8aZzyyWIxuhER3F2Pa+n+/5+xKIIkVCOO0U6aNYbWP89pzfufsqvzT7s5pMJ4x924oSLWyf1iqVqpV0vAF9chpwMYBs4Ub+Ls7uzsXrkN9Tvtk4vcpI2JISW1sO/AnfGKST5Rx6E2qVoUY2GEvfLRXPN7dmQUTMrJnxA8EmXAKM7icDFyPEvrg0LEgrk+cYDT2XNt3KJm6YihXCeewdnc+hzMEt8KGzjZ0H8OvQbwbsQVSS+AzFGJ8VC5Pp1PLlpRaAbsre6ofL180TuvNTr0E1OKInu9Rzgmjv01cBmzezog9BmIc+xZI9OwpCRix7xiFZyJAYqfMFa5/ZxIeDMTUZnR3p+9ywdzbiUjIKSIN+I13AEnZPtmrdUijs0fe1jqNjrm7c9Xovm/1uuSq1m7Xmt1GvUNabXLaap41uo1WE369I7XmZ3LeaJ6ZhIKUYBX6MGZIPZDoogRpH8TVoTSx/CBQ5PAxddyB6wBT/t3EvqPkLrinzAdeyJiykctRixyI6+/ueO7IFdII+DJHsMhPZRTevc3Ief3zzcdevf355lPtolcnJ6TyUKlU9o8Xj+vN3mW9XevWbzq9tzfQ0ol6HcZ6XbUbXTW8Ck9eH+MC5TL+T9r0DgU4kz9QvxwU7FGb+dbIdViAmrDAiMrUL014ORgDlcAtL09dvx9M+c2YBSJwAo+XR7zExswvV185Dn1TqZTeDJxB6eXt7euSXR0clCqD1/3K4cuDiv3qlVo/ou+s1q3ddD9/AM2cKEv7Q/3BT7v+y02z1awfkYqZbO38ekT2U231/36oNc/ko2rq0dtGs9b+fEQOUu1nV6322RF5qWuGQTAnWEqteURepXpcNJrnR+R1qvWyd9FtSALepJ60651Wr31ah4Gd7hE5TD1+17u4WPQ5q3dO240P3Vb7iPwra6J2/WOv0a5f1pvdTjjrflpKHxV7+/uq+VFqfzDxHTRBEqmRhXZgFHd3QuGjO7FuWrf/o45o9MF8CtC5FHUsHMd7jWzGh7YHncLtbhRufqE+Za5zqR4ViokB57A9qHdQhRGJGaxTRm1Bm7BB7ukHFjzMjELU1+p7WdOEwy6pGAZ9o/AOnGDXHdFu0JlxQUf4HUaS1CeXyYcSwr8H1bI9dssCZvs98Cl+9wel2M8Sel/8LQIuF8bvcXpr/fva2M3DNPSECbVMq0lSLMNGVg3ndFZ/uNJwux3T8A1Uj/yqb2gIjlzwG53Rh2keAuv+ZLSOvGclkMKCm5H3yfYm9K8k7x4XzEVeC3zvXyo9dPb5pfdxQtms4Q8CoDGbwmck7zdc0IUFgcb8FEoFr5Lhc1MoFZxThqdewHEDr1Lw8+5gXBDkl4e4Mwq+ja7U7vMS15cL5tWuIm/d/n128vLv3w4Va43vWQnkVGiM7z0gLghAf5B2EIgj8nYyGFBmDVgwMgqHFfUpmKQwpA+FosWn9vigahRNcjphjPqixynTj9rXjboIHNu7hFzB9al+WFU3DFfh+v4Hy/1DUDNnUW50MFRgcw50ojZjCAZlkrEthiaBr8UlwImolDJ2nGwZZgTtD4ELyR0ziqn+HvUzRnyymYspkPEyPQa01Z2N6cbj3p+vIQ55Tg9i0hxhoD/xvNgzd0AM7A4W8k2KcCUtUph/AIzsg3oFm1DyCLb9mJzuB5Q2Toh/EUgWZJdIZ6HZd9kM80CMOjIlipCmJANTLQyXVOXPkOYyLqzkMgZobU5vuAsTcdN4f26uZkeZRYofEzKPpWTsz4z8yyTDogWCLZIfIOEqLiiMWZgyVBZMiVFA6jBPjBIxAqQekQJ5oYT1Ar6e/Aeeigkg3T6pMxYw9Ry4jetUyjwuUhRJWhaJEGgMrTPK6AA3HMr4Z/kv5lmL/8CMJTvkZCU3aFB9W9jrzAWms0SgtrVRtOBhv9fwxUH1om4U49w8AwPhbjIlYdmcaLjBD5+6whkSI5xlBdXLYzXTKRvPal9oX7JGcEVOHNsnt1hlmPh9YoujzNGbBgzITRA3laMdVpJhoiRw1c1Id2xOUym8tcip9WPwM3c+qJts2R5nz3ALPb9lPF9JVTyl34rAt89PYOfXDJKyBizKHXlZuQLPVu113x0+M+lhdUU/qE8H9sTLsuBlIhfyXkGlGmLdhH4H/+ToLVSAXbutnyCex2TTY8o3qw/1OM10o/PYS+S+bvneLAwU4ApUUReDH3STv7GY6grp9KY2j8qQtG+C23AmqCh4Ck/8glBexCItrG5OXSwu255HppR882F6l8M6tiB2pCoiXUI0GJDkWoeZ9tRRLrNw0jqZRmGwGQjyDkkspHslxZhEDTLqK1CBqIL8+CP5Qcrvzz/Vl5UBi1GOnCIW5pNb6A6I88tXU7Eefo8sNzLQR02MwpXk0qoPAh2VG4QrWOEkIeiJDwcl10NUQwkqki+TCeD51LM5Xxdb9yvVl2nhhePP1wO5FaNVTFoz/qD65vXhqgk67u+bIdtoAt8e5R1MsqWXd4Z4/7h3wLMJOncPWdICXXYmtyDutdrKGi5l9bTRXuDfUS460pafLO5wFiUEwRCbbjGNZKcJGtx6krMc8FI7CQdfCMqbnVHuMHcsAvY0WmwurtAIsJi8bga5E5JzzCOcFtJGhbM4pI1M0UwYpZk4B4k+C8Mzl+3A1CjVXBibZrq09swlVZgauZpJIenwfBiGURIyPwJfGYWAJVEUUWYq7aGLtGcxQzLRxA9kiQbqCivslWP48++YYFbEevLihbs+JYgc0WZuYaXuFxXxuOJdM3Ta5nzNeEq2SsZKznExa9KdDP4UpTJihfHQGk/40FC0LJCjbs1s7BPqhWgUo8wvWy8kp2LiISZbOdoIFcpLpxdVSlzWi2w3E4vGtFPJTDLXS10Bj7nQ5fTbiH1zSKY2HG5TJChVXlj82GzixaQSHh3HDyLxG4AgufFl1Qetm+CxmfwVQdtR0JfIVlPku4ABl+FjXcEv/jxf8e8+VSnbvhj4jy3QRZ0wGdHV5f6+AtzfWWdL6ump+Pzp2HwrXL4VJt8Qj+sF9X2h+BYw/OkQfHv4/QzQe2vYvTXkfga4vS3UBk/1CxXSUY2osGVxKLqnNfdcMtDG1vweqPwZEfmzo3F01vfbgPD7Bf5OiP408O8pU+KXQRxEP7JFykJmXORQ7P7rNMmpOz+6Wz5GgmczWisGymLMSicP/p9x3GoivCQUi40L5BJeahrwQtFyFJPR8skli8v4RpItO6TOJKO2NCwJS1B6dKKg2RMASVJR8vGaeL4E82IXjIy1cObJkb4yj/fy4qL8NZwj63zhXql2ddBfGdVT5eSoCYvGK2SpqqbUlzcqoy7qKMnAynMwMJRqszlIH7U87XTou54KpUmUZwKF2yCApfyCpsofSQ6sNOtYRpPc5DlQ1Kbb6TObJGBQOvqZ7ONJoW64rr6vWAQHfUvZP4PDzTjjMgRtzlnn1yeyda+y6HRmko/m7POk1dSqQ6ptKLY86t8lXUf0Uc/xBr2RUk8ettKRtGPf05WgReegY1eMUmfjP2+cJB4pNxwJNDpGl6zdcMAwenccY3HbYkTSl4cvB6A8kCHlxlNpcyx0518uUYhQt8iIvRB7zJnLOefX4OKRfN64vsLgDozVR1M6xS7u3n2fuKvVpYa2ZbVIylAvmaE1pZi8Z6Gb1lmiMUv4KEumsbLE98My+mtDIa4ZPl3s+ZFNSuaRNIz56afe1parnxt7EH19JpO9bY6PpVC+qOMBydYLUviaYZv4zNI4D42gNiPqcdmfzP1KV76bFbkLUBjHu25hJgHuZsKpqqyY2G5H72XM0zoIeYu8bjp0nSGe2U/w9TGb66/LySnRe7kRfovokWzhY1ywG+Bly5Q/W3poYIs+IekHI3x5TNUpU/FJQl6iBssz+kC+TiJP6rHRik2rMQw3HGupNeTJerRarB1yNtU/OVoK4GSxTmY1Ow7Wl9B4dC9xQPE+GEraUTdhQ1LSFBuq+eQExbHe7uf8zHNMfMtmOnIh0ZT3xyEnb7W619enjctPeFd2r1O/qJ92yU/kXbt1Sa4Qu9+cBqPxBLyVSoT3TPKlgIWCwtfil8pXC79qNg9YHwfIbiHq3zcKyzrfw10ipQhbZq+IBVJFrtpMoVJyuXrHxhTod72qc2tDVg/cfqhUnY9fMrgQ2K5XREzTsPekojtUvrhHGmfpV/1g23l4s1nSoYOCEIci1zq/eTy/fm3Fb0WbpNCpXV5fy3/OpEj59XXNcSCxE9fX8ib09TWqEP5ECtH5QiUYFt02UVedVvs3pHOygk65eHotPGR18XXNSXRMuF64sC3mvb+4Xy3q9/mVK4ZGoYQsAekb3KOcB/Msik0SXwyN9/r6U+DZAt+Nrfv3Lgv8EexgvEne69TbZ63LWqNZkAYTGrV+5QyC8KMxn1gFFN3r/P3bDtiTvG01DdP37FmjAlScn6yraY/LzblupKmtSXNsTeBxfk+LzKjAF3UJhNgCx12LvN8y8EIlsBAH754l40QYijYxt7mphWM1BrcUMYxUXzQ3PvZcgbZWDPO3/7ySF7Y0XReWeSNrs5QX0qaZ4Twwwk9dzwPPEHwjtiqCehCT8YXq0M3j3g2v2g0xwWPUARq8GYy5uwOnApAzUH5GOnIN4Il7xxUEKVms3SfLAvhrdst3Iq1Zu6wrwlK4YgPS8BNtu2UaVt0L1WzAjGZNU7gLaT43mGtjR+C458s37sGy+gDs2QiCDkFJ36DIOhFejMd0Jel0sEFgK/3BKOhPADfQh3HABG5on041bxJLHPx/znhG+Q==', 'base64'), '2022-07-25T17:31:37.000+01:00');");
@@ -2580,7 +2580,7 @@ void ILibDuktape_Polyfills_JS_Init(duk_context *ctx)
 #endif
 
 	// monitor-info: Refer to modules/monitor-info.js
-	duk_peval_string_noresult(ctx, "addCompressedModule('monitor-info', Buffer.from('eJztPdt220aS7z7H/9DhcYZkDJOirHgdyZwcRaJsrnXxEWlbiaRoIKIpIQYBLgBeFFs5+xHzuH+yD/sv8wP7C1vVF6BxJQDJnmQ2fRJLQndXV1fXrQuN6v/97/9pf/PwwY4zvXHNq2ufrK91npO+7VOL7Dju1HF133Tshw8ePtg3R9T2qEFmtkFd4l9Tsj3VR/BD1GjkHXU9aE3WW2ukgQ1qoqrW3Hr44MaZkYl+Q2zHJzOPAgTTI2PTooQuR3TqE9MmI2cytUzdHlGyMP1rNoqA0Xr44EcBwbn0dWisQ/Mp/DVWmxHdR2wJlGvfn26224vFoqUzTFuOe9W2eDuvvd/f6R0Oek8AW+zx1rao5xGX/sfMdGGalzdEnwIyI/0SULT0BXFcol+5FOp8B5FduKZv2lca8Zyxv9Bd+vCBYXq+a17O/AidJGowX7UBUEq3SW17QPqDGvlhe9AfaA8fvO8PXx29HZL328fH24fDfm9Ajo7JztHhbn/YPzqEv/bI9uGP5HX/cFcjFKgEo9Dl1EXsAUUTKUgNINeA0sjwY4ej403pyBybI5iUfTXTryi5cubUtWEuZErdienhKnqAnPHwgWVOTJ8xgZecEQzyTRuJN9ddMnUd6EpJV9KwUReP6rj82OTNG8czERY02pDPBuav2Om5/PvAtMWjDnnxImx3oC/V59+K5xeHveHF+4OLwXB72Ls47h0cvetBm7UtZIF2G5CZwOzaM0DXRxxhhv5NWtft3V2ELfvphtFe1WV49PLlPo62Lnv5ztUVsEu002B2Cas+G/kzlx5TA0gz8g907wN0bLC5rK9JCqlNDx3fHN9EGna+C0gJIxw4BsCbWvqIshnzmpPti+3h0YFC4gNA+FX/cDi42Ht7uMO5SEIMRg4b7fZ2jo63o806stkOMJftHwCzIeN0ydOnsuJ9b441EXQ7KrpIkJ1r4Dkanfx6vBGfOJJVMsW2fSMrhzdTOduHD8Yze8T46Yr6++Zl3x47Dcu8tPUJbT588JHrAQQwujYtQ2VN9uAC1mkEU6k3W3RJR3ugjBr19qVpt73rukZO6/DjHLFDMKxHy/MNZ+bDDxeg1etpdY7dqBu6rwOEAL/G6Hpmf2iSj0ztse6Pu4Q9bPnOAHSCfdVobpHbxGim3UJFQxu1BUg6BR1iGSPHHptX5BPRFx9I/SOwm2n75NE6ua2f2XRp+md2LQpooZt+DyoazS2pHs0xYhWdUwsQmTSa5CucW5O3E1SUlAxG7yYoInpvhR3ugeyrSP95yJ++BMHcH5MaeTKFBQB7MCX1GjwQbIdVLc9p1aESRqmfndl1Uv+5Lhbryd7PwYKNyVnt9Ky2hYq5YXY7W+aL7uHe1uPHJiCKIOugqi1Ys0emRkDKfY3UmrCu4ik+Oe2c86p1qGtgnTl2lt2wwfrpOrSAh1CvYT2gOerWYNDrxUifdmtrcvyxw1CAHy+6CATxgD+QZua4wSHCg1N8CCB/sT8ASIRWa3a769iMgQ6aADFzOrLRN4OuGa3WlogyxxSewFwQKmH/Q5ETRfr4DnYgnAQN+AtI8xVMFKELate+9j6enSHO8O8mgX++9uAfDX+b6v518ikbOfkYJxp5egvPG+ZX3c73QORNGJThwxYHfy7hJwOlMRrBHG4DnM6B/rdngdjWkwyYIrpYfPcm/EORUSmncxCSfx8cHbamuuvRLElXh5NKYd6yqH0F3hdogTWkn0vBHIEQzVFCwvbKryPdH12TBm2moiQa3kr0wU4eOoEi0dBrsR0YxZtZvhiMGqr6+hyKu4jSSCiMFbqaum46JASUo9rrlkfAMb1s1yOKpN76ps5UjapK/haqEvy9LjTFbm+fibXkq9OIXgnUCgrHo85v7Ubj7AzUVBN/nK49+e78cfOb5qN2UloSggG8DmNpj8wtPqaGDExWM3QKM0fYWOEXyW8F2FeCESwW48MUmKfnSpfbiA8xcWzTd2Aa4ESE3gNb/4ujy1/Aaeujh1gX7Z5gQ2mFeKuricqpFy+pTV1zdAAzuNatetT0Cg5uoZaGhYKeAHph2k/XUwwvBw+7JvfpOgwhR2vtuFT36SH453MKDtLyplHnjVqGZUV0iQpBdDug/rVjNOo9ezbZNUGV6jcHfGpe0a6i/R74+e9N23AWKR0/wNaCWivxls0yMA+qowi8BL9P9/ye6zpuvbiC5DC965Hj0hV4DV7BRpgmsIpDSeK1OzX3HFdQKNI3qTiXy3TNmYKrPbOsdFiRyWMncIrRI4ZOqp/cF/ydMRzaDpP3QiCxKUsxsulCbvgaoZoDFe5YsJXUoB3Ki+M24+DDGSniBmOhleGdN0kSzGbwG+y2qTXeZChqQD7LutRHH/jfbAmB8kLuXlrOpW7tiCaNjSa53SqATEsCbSlkiLQoBMVY7IIVgO4BZlyHDJ03vttItI/ybgHkuLn0YIDT83LTQgsVpY1qq45swbKMT64BAjgvxgjWQsOwTfqKYkGlxkZV5nnxDhZifMOf8yVjMJrpIDIgY0G2NKYmTPe7ZynTVZt516oWjmjrphSkHBA4D485PyhqGZiuwFaisuQoZ5sEoTbe6a6JcSZg0hzMJNSbSlDz4XrXrbjOEou/prFpaGzYVehxzLA9uEo/zMZj6jaawKu68bZv+0/X93uNPBC3eWji1N1LnHhrF3bC4wZg1nnWVAbKgcw4UMhMazrzrhuwYaFjHzTLJcNPorfGnPdp4vkGPGcx0kTNc6i5dHzfmSSqOutQB8TYZIS5zV8GNj+pb5jIoqpT7BLGZa9WzNNtvdMtFsfKaSOUuJsF6Db5OAN3FBau4IR/kOJM4DrBf9kaKa2Oq88mnw3fh6TjKg1Dox44Al30mjlWgdugOgoNBjZr8pw6KZUpVKGWR7MR41YsqesTSjwNlYQo3DZTfAjxg+GR6VVapj1bpniVsA/bM13PR/LbV2RBiS2i2wYoaoxWUx/jwTYlLPbEQr8nnQ5uUVzQLdQjLOot4fGJjq7p6IPqc/Anq1yOZWIn2viKAdx3Riz+fAEj7/d/iCnkFOIzxdvpCOutRAaBEJcAJOHHYcHgeMNcYlxf9E3R/DmWT3SSW+cuRqk/fZKwTs3leYuFALCmtlYrbwAj7myJfli4RW4ZdAxrKQOpjC81Uo/RF3yBj0BCa0Y3I9jjRjAaH0srl6CoPuQr+KwquXdbVjO5GZDTVFmKt5RG3JzVlmJG7flpgoDnuIuuSvJ8yLgABafEyBndWORMLAbgtoAsDgfDgrLoe36GMELNSmkUvUuKo+iVkEfx/I8ikEDkiECq6P8pkaLkSiRSsJxExmieD7msRJIyIlleKHsnRYWSLrOEEmpWCqXoXVIoRa+EUIrnfxShBCJHhFJF/0+hFCVXKJGC5YQyRvN8yJ/TTJaXyb3+SW9QUCrH5pJ6GXLJ6lZKZgChpGwG/RLSGdT8UeSTETwiodEp/CmjouTKKKdiOSlNUH4V9H+aQ0tSBPV10c3lh8t0EYUKPNC2UkZ5/5ICyjslpJM//qOI5uvo/lJB/k+hFCVXKF+X3V6+Lra7fF1hc1nKlc34U76REY/AfqZGsMYupZeekflmtFrMCST23oJOuGp49EyNy8OfT2B9DOrWm2Hw6XTtvHmXCAHAaVmiOm3J7m3vXmxKbAtfek6xPVbpOaWp70J7n2KTYlug0pOK+aj3MqmCzmOxaQkPsvTEEma9xNTih3+yRJwHqdGkldQAwXwpnj/FI0HsIGpvYvo+dVmsXczJd2e02RqxdymsTaP+YT4ZzKZTx/V3qQ/EoEby7AG0uVh2OhcedefU3XNmNh5IGuuWR+NND46G/b2Lvf3tl3h0NlP54FlbPIp7sb2/L59tBgdyiZbR+rg36P/Ui7TuZLdmB6GjsNdzWvcP+wccumz9NKf19km89UZ26539o0Evism3TYU6t3EyXix99naBH/ONVsFqJLW9fLhC4bsUDHHK2mFh4tdIU/7kL38haRo09TkqodXiqlitxNu8FLVwL1gV0iFcAWGX4t5p0CX/JE2qXc1w5QKQsWM1J/z8uNRVqY52gf78rNK2Lz7FSN9U58OxHI+K95wVeju2TRnrHs4ml9StBAF0kT+gFodTAQL78+VO1Z4p571K9B7gZyqVYezSsT6z/B3HAvOgTysDGIAtoBVot0s933VuKqPv6ot9MLkVenKOe0XxIELl7u9Nw78u33uPgtN/qE8q4L1nzbwqI8LyfEnOfkn9bd+ZVJsjdOYMUV07vaY33s1k6MDPkWNUwAFPiLg2zqF83wN9Wo2hP5IJ+2WT1E8OwXNmrlUdD3XgURjkOdwtbjL3K3uHXxK4TRe4TJHHgxt7VC89Qv3kaErtyrr8DbUN074q3/HYcfyqGoTr/b49nVXQAlzr7YAfW7nz0bgyve6GOhCbc0CFrv6e49IrF/33at2Fu1mpM+r7uzgcAOIQjZ31ymSbnAr9A2fhaGFX8TkQxOxywVj2oJJ6AgjvD0A9+s7IsapMwocVrKadmW4o3esHSx99eAO75uTh75V931+bPq3Yd+aPn0tioS0xBctUs/fCnFQgONg06Hzp6K4B5mFaSc/xD2aYUQPjVtVlL4JG6ulR/vXn3b9BlGV0XfxLn2S/+CdI9/L9kVoyDwHGAihqydjXcezCj5SmHnmiL+VHjyepn6wpSxF/hGcU7zQ2rTw0QMv4ik4W/jHsii9hC+DdbpMTMmCBIjJGS5PeLDfylhJvUmNvBdwoOjHTY1siBvYZFkyGVhD+avCxP5MjpYySM0Iy5M0by1CIiCc9fkxekM7zouGZJR/Po/7QnFDgC+VLF/9a97l06n4Yk5LBRqgD8dRIZw0KP92cE+VJhr/CcJZSVYxn+IIzfrmi/mZMM8mT31lxzSb7li8RAUXtBA73vun5+KVBREnht4oaAR1tWNTNDr+hgLHPGlEXpXBmsFZpWK1cMDF8ItibQ/TYx2LszL331jb9GzWyKB7lxBUlSSOv1k52X17svD0+7h0OL3Z7g9fDozf1czZ1Bi7+NVgMj5m9S0eYekUESFSE4nUNg9t4jXDHLD8AerCYMP8xGakLvxVZi1MNO05ER8l3AQA02Mq2M0QnC379ggfJZbqJelMjiSElnuGHHhvqdx7cKgRflIQZKlQYCn7RqGGcZFpidmlPnq6zrxgkZhr5NuOTPm6wqb9tWc6CGtsjnjxFWcNEZRKjsaVfedlriUl7SKxkZfnY528VtLwe0ZQfslMHO6V3C95erB5BfXXRjYDObC1yuIi26/lt5YuLoP3T/Pby1UXQfiO3PX95ETT+NqaMeP4b9cnvXc7uImkpPLZCdAP03jgmYo8pfPLH4KyfQPQziHMsh04Z4ebKFycj11mV7lhtEsOlRthfhn8NtpNFcwFJ037Pn8Bvr+RDfSkf6kv+MF/FewpOWbzxPJX3MC8UdAqTNH3iyZlSXpRJVOVXkmi9A6SDTydZYg+A+akbZHVKvClm0MQcI9DkbNOh8VxQW8ktXzD9YgyNEOO0iIMoz8LLKiDJY7KRD/amItjn+WAZG1YE3VnPh815Oy3LSJyF2PoWHPRZ/qASdPJcghg4hbOKjby+gp0C2BlDxxi9zMgreEOCzhy4+pxXsE+ol1LEUdHa0QhmUicG6Kz0qxb6jXdkD51pwqkKakLwbhBmL+YiLyaHoMAnAx8U5l2sr5ooDm1vwj/lg7Fxti+d+b0NdrH9A7hPwZDJQZcjlsMtxz589yyOrOhTTKk+fdrcIsnSbseyx/k3U5o3TCpDwibqOfmebDwnmyuF4uk6QwS/c0XO88HqR8dTF7s15aMEsDC7ZKMERmuI0ZqyTEojFUnACTCacCJc3IUI3z7DIZ+vHjJGl0TiQ0kmDEG2rNO18ziZQja9K5mebQDO6H0VIJOCUieOEhPluyLzdB2QQXNSBBnJxHzoHD0n3lGl6yBgkMx8kJ8y8j9qkifyVOO1aYiYQH/EMmwGqjFa88dSjYMP5vTeNOPgdf/NxXB78PqH7ePfoYJUy70oy273+fcbzzd/F2qS4bK2+WUUJA727bPNL6cakU3vQplnG5vVdOJ9akVE5On65h9XH8Y04mfIfyVOkWIerqwMWCxrVfDm7sJl51jh363gwS/swS8pb/AANCa8C5VPQj+xQ5pKrLl1sv12+OrouD/8Ec9OR6p2+4M3+9s/FvyoSc12BWQ6YXQKXppiepcnHuWpoetNbPHWNLLrF9eOPjGVDH1qkUiCzw54NurhHOoaR6S11Gf+tQOimdj0pgEQMw16C05Lif8nl1O0DTJ1MaZVjgQ1ggReMSOQRuq0na4YIExlU+BVl6DqmJESFRS+oMYzDI16G5Bu+5NpG5Sj7Q8sfU5h3pFTTGRPh+b8rSELp22Sup5xMgpZDnmykQohowdPH0QTG/tUAnvheaMokZWDSJJILDNPisyZjDcTmc4wwyWr7q5tmS+UgVi6y0J8zzulIRYccgoVV2r+K8AtmlFqTWSQWgsyRimw1TOYKmCceJhHKtmB77GTPTj+m+Kn/LtvAAxN8vZmwOQJFkgJFpjkr0WYVDeM9477wZvqI/qKv39TsJP4rxhPcJ+HuX+TzlgGpykwAs3L5P5iaUwaIs2caeS/jEwckvgqzJQUvClt8NR8cazvKaO4LKvSWyfa3FuK6wjkMNM4P23xxEEq4o/RxAjOXshfMO0sVmfmp61/JEtLZmhe15baWa19hvmZebby5enSwnTOyYzlUcQSGWPDRSyUvjyDBSQbcKsXBsVkOsrb1E8huWkyJtnJz4HW+86Cujs6+AWrmZ+xt8z/mNIsYo1jjgy30LCj8xyL5vK74rVEs4fKyhl/NU9yzT08wmbqiCmg/sXlAtk+/4AV+Z7U8JxUjWwSzD8OAhIRJt+/YTLlTCagNVW5ypCACApCsgo0rcsqoZQxPXTCnud0w0zRG7+1f95sN8t0+1imsYLdo41S2N2WaTxhqQMegT1uP0G/krQet5tlhuNazGObEYRzDNvD4+HjZ9rxfu/w5fDVk2dNjVwg6DAPfRkEWVdgbwkCtnbJ/u12AQi5OJZe/063W8NkiqHIY7LxGr6gYwOyDPsFgNZk1cciPK7UBhclfO1p8r+zmvaoo4FJYShogoG2ykC+Ldw4Zp9KWShUh7CYlJ3+yLIXnLXqWpKKnOYsE2iH50L3mLZiCXUZ2NTtBq9S8kRsFNlw+CwHM+imTYEyu70g3IUFj/E+icCtFM+ewjO6xPNcPXu+Gf6amnA5Oq86G/qvBLksNkf0+lZuMHDGDERqut6UqbbbZAiGgOyjq0d28T4mzHcJu3S8mAq82QW7lulEHOI0bc9n91GZNkt/iYaRCMOoseN/8j4lgMDyYwZ72Va6x5H39TPIVaYJvta9fefKtHf8tKTEmedo780aR0BWuk6hoiFODIyHr1MGzjyTXWbgFUOH2sHCtRj5FrGAhYJ1ynKFE/omG3JducIh87R8SjeDWqkmPqeLLd3zNbyZxMbYVe1vaaYrB0Z4yYTNNt1l+iZ9hZzGRJphhumpea5e+lISENg2dkfM+vnjtWa3mzRxpaZB0rye/PYcB0Rh47wrrqkBDHxQA3iqpTy06K0d0ldP3l0z4IzaN1KqMJAtHx/ZSGZZBVRJtgdjkbgFB5iQ33nz9Dx6B866+PltimOzcnKMtbVyvE3SfMSc9qUaK5edlOhWy9nsRnut+FqBNYya0UAdCVsa19JZ48lwdyf/uqC87p5pZF5DINsAr6xsY2bU8cxZ/E4/k7zg6Ar/ZoskA32yZJhELIgyj9kxYKBMWoFgZE0Vi4wYsB64keORBu45xSH6GLsukTcKy5/2+j4HTrHW3rWzkNYar3DjL7PhFxn4xg0+Y49fHBOQA1OQF+IqY9fhKTBtaHLRetX+VtbeEh71tsHk2i+6ABCsrv0FzBWMtC5wRz1un2tz3dJKuwu8Ii8ksbKzPsKkItX6Klft4YRKeyy8ogL5CDP4QDLQDOQ30v5Z8Fs3JbpSBFg1FLBcebPLhjK+VqtpHK8qKymKXFAOqBqcCl4PiVOVifMXp6kgqRj8PggqePwLk7NCFyC/wLVb47+EVy5KrtgSaRtLwy/T/l6dq0g8pP59PRoJyX0r/sqZ0D3HAuumBspxT9FunQRA6kHgp92G37mtaeOZpCC2khEwKhFp4etDGl9F3ycDkTzfYy+T8fWb8qa9vCMV9UKj4Ni9hOCO7h71BuTwaEh6J/3BMHNJgwW6X/cnXPd/ggsUGfxLu0GRwZW7JgNXiPPtEw/U1sxju4Z7cHyyRlU9n5MVfkMGjJ9ybX5GpyLRlIyuUWch31fIAJFtUjI6EKZST0Dr/9b+ufX4H3//r3/8/T9z7Fk2mCpDk8CWBUOjNTvJt2W58PiiIwTt3fa+lh+tyYUUhji+9mraTwgu9T1JIWA/5QcUsvtm26SMPqU7FAkupHctYgPDngXsIBbcmk/5Fj/l7bFa7pJBWoxQIQSBZVXa58avlZM+F7V9dfkpO3nT3x1kvNLAWTbzyc1eESAx7uUCQqplhlVkEeEV02ZrkDNcgSGxrDpHAN4K3hf7xjTYPJlqWQ0VyUKVw44r8CyIK5aY09Il6jAFMMMSYwWCyz+gvo/Xqp0oniOyhAqeuUhjoAYyDa8uQRMsqxKiy5IjISuqc2Wg3SYD37QsvMA7nChPfaIRzyEW9T3CE7bi2zHvxvPphAS5g5H5LDzYZkzyRKKR6cHW2+7MbgsQ7P7smbw9u71U3O3qYpTgj4JDVlNXeKopfBPRzRMlY/IWmqivDNOJ4xnG5C4EkCHiFVyGzfD2A0+Vf4YRpgE0TDeBUgGAMElGh1VkWK3jlHOiDEsZQM6OH8tSQI+IU2PRaaNfHZsz4xY2fGG1x48fC2bg5PiMui8D1d+TMirxWBwOaAVHvHHrxTLNYLRenJBIHnaVJYeIoPfeh9dlYpZ18kicASeXN6DfnA+o+3Wf6KAcUfOJPSyIB1DYxkqHnyjwUHfguwRdHCCInzxAHYlbwMjZg2zUFuA3UdIoNsUV08QiXt/gpwHsHYczzb2AFstn2sYHoFecCczt89m22pGRUs7SinN/U34KEAVaOUnrs3BJTX0UeSFdCw/V8tDao3XYiZBC3n6IWEGPHwu/H8OmqUeXROgqIwFbHMzU0+D/pUbm8F88qXtaYR4p+yYFvVKGxT2oaNAF/OTA8lyevSokHiXGwJK7CaoAD8s03aYq34SgaDGNHZsic0qoPTfdnLyl8bJCPcsiLoGZerQA9bCUmHFwFuJeMS7EfbIwLgS+5S+e8ZcX8K/y3hke3f/E2fbPOwXY52kfC93TKFjmMDGYj2eZI9qYcxltKupOSnm3MN+oc5ifrvGEZ/LTrBITqTAZLBFLT+YYG6oGJLB21fqzM/3h9yjwRFOUeeoHcXmlIG/LwngcufVx7h3wFUcp0OxLOXfVKM12s8nHuI91yILWXUquHPTOwK27dGc+c7/w+CeABseO2rMJdXW2sUfPLvTqnIUNziA0CVw1jeD5fnDjpnTkM9dOKOIJft85F58Reklk7vkzCixF3abP6yqV+KSi2w0+qPief06xGfmYQrpR6BILp+msxj9KEpvx2qOzpNfUyfvgKERxhaN0B+dI7kTtPNcmQ/mxYfFTRW7kbWnkM1/9NSxb2Ku/VtjjsPhh8WCeZeefnIqE73ATRjM+UC6IHpb897TqgMqL1WDckq9SlUHvoOLvdI8gz2ybcdgdSwa9+HZ15Mwsw677fL+qLAbqqYAmnoM7UZ1Yuodv8NHHo2NgW5giC+b9MoPnuMFlHpLolj5s4MjncnsO3lhKcj0nEwlZ/+6733sTAolbEc4vgBuWpATcG58L8Hd0Z+7F3q9OHy1EQw31sFSCnz5F/cJusU9Df4fxnf9HHkFqwASIs/kdFDVGIr31WOgkcAEqRE0+twNQOCIiPYXcIEiGhkDTnxrrqOIH3Om17uePXKx895sfoFgxgQKBiBwEVgYccJGBE7prW/Dvi6nyViI/urAC65JRhILhMxYMQWjRj1VWd77fUEPV8EKJdyKVwgj3s/UvQs7iW/wvYH3LTVu58JltxQMzEvglmJtJLBXLW0C6Ye/YEoYu7CY3PqH3/33sb9g9atJZFY1lspIozNgNlZuh9po4tuk77hOcJ+ixWMMcMMPBsBgYaJgDpndSEAw0zAHDLvMtBog1Ta5dkJYFFza6iguZEWYAbaYNxzLeRZfz5YFqEC5e4n0S5uhAd71rPbwoKf2uC4SmkdqFh7BrqVeihAOhzsEOKQmdXh6USeU0l3ebBtCCiiBVF1YFT9FJ+i16KRCvUrh3LlOZK/eINuZyyMBVKkKN+bpKinnYOb3bHPscHx0N3/cPIx0FRuG1dNgUdH0ReNs7w/67nrzqIg2skrUReiRXgGdqjN+Z0QwxCFd2gqnhuikw4ElKjs9OB5N8PgtSnmN3kQQvvcO/YfuNFSkc5fx5LnpMSqcgGclTH79sFucPLcQSaGTnPcuOx/PaTQQgFQxzlOaR7P1QtUu9kWtOQXJZd1WqYlXodOmGET5tBAjG7qEFDuRJpTD/kW54eIFM9Lqh5MCtC8VYZrdCoRAwI6IxNlKEAxb5pJerJ+JL31lb31DNjHwJzjLuyQRsfNLiwsZoHZt3dgKdNDiRayej0DRAP27rvQULpTROelk5QpE8AX8VuER6pMO2V/IhT464mbUdUMbNIWpeVuM8XLFxjERRjRCj7oqJpVOdK1txt1VgZ7iMsZut0lpfUX9n5uKvQa6yRqYbluERZZ1qMfglwhk0T+ul3j+kaPqoCU3LqzbX+I3cgljsow4uxOiL5yhmaKFqYzRkt+FHqQErUKknGEP3gMS+vE1pLq5SClFvjZjs8ZyeyZVoRgxhmWujFFYIrovCD2wTQ2BUhy83cwXCfG2R3UjMF0la13kae8SSbCW5JxXXr2LoxMbmN4CpyBXzhaLt2UG4wOwJYY0EQrHVpcnu/ljZzvu1SCtfN60i7VzqgSxktQzbKolhExcmCyU6DxLhztcVOxk+iuoWlkL22Qb7sW3fSGDDmykefjY0RhANpquxyWgCVXUCuILer0I/MlMQCxrHlFSYlxAhBf2K6fWthBLAEr0CL2F+XGdBGvWe6zouGeM93BhgHHHeDJktfq+Y+MH0S2bOQ0N3F6ZdD7XLxDFmFm3xDZknUt2KXYLJkudu5cFU0tmAmK66izJ1TJTLffNS5LwL/+Dj/h/LcQs5', 'base64'), '2022-04-02T20:22:49.000-07:00');");
+	duk_peval_string_noresult(ctx, "addCompressedModule('monitor-info', Buffer.from('eNrtPdty28aS767yP0xYPgEZw6QoK15HMpNSJMrWWheXSNtKJEWByKGECAS4AHhRbKb2I87j/sk+7L+cH9hf2O654H4X7cS1UdmiCMz09PT0bXpmev73v/+n9c3DBzvW5M7Wr29csr7Wfk72TZcaZMeyJ5atubplPnzw8MGBPqCmQ4dkag6pTdwbSrYn2gA+xBuVvKO2A6XJenON1LFATbyqNbYePrizpmSs3RHTcsnUoQBBd8hINyihiwGduEQ3ycAaTwxdMweUzHX3hrUiYDQfPvhJQLCuXA0Ka1B8At9GwWJEcxFbAj83rjvZbLXm83lTY5g2Lfu6ZfByTutgf6d71Os+AWyxxlvToI5DbPofU92Gbl7dEW0CyAy0K0DR0ObEsol2bVN451qI7NzWXd28Voljjdy5ZtOHD4a649r61dQN0UmiBv0NFgBKaSapbffIfq9Gftzu7ffUhw/e7/dfHb/tk/fbJyfbR/39bo8cn5Cd46Pd/f7+8RF82yPbRz+R1/tHuyqhQCVohS4mNmIPKOpIQToEcvUoDTU/sjg6zoQO9JE+gE6Z11PtmpJra0ZtE/pCJtQe6w6OogPIDR8+MPSx7jImcOI9gka+aSHxZppNJrYFVSnpSBrWFfFIweHHIm/eWI6OsKDQhnzW03/HSs/l90PdFI/a5MULv9yhtgg+/1Y8vzzq9i/fH172+tv97uVJ9/D4XRfKrG0hC7RagMwYeteaArou4gg9dO+Sqm7v7iJsWU8bDlt5VfrHL18eYGvrspZrXV8Du4Qr9aZXMOrTgTu16QkdAmkG7qHm3ELFOuvL+pqkULDokeXqo7tQwfZ3HimhhUNrCPAmhjagrMf8zen25Xb/+DBA4kNA+NX+Ub93uff2aIdzkYTotewX2u3uHJ9sh4u1ZbEdYC7TPQRmQ8bpkKdP5Yv33Rm+CaHbDqKLBNm5AZ6j4c6vRwvxjiNZJVNsm3fyZf9uInvr8d0A0OkzOe0Qc2oY8E4fkbp40wQKucD8Y9LpEMXQzelCaTx88IFrCRi0I+DvGSUtLE+oOR1TrvZQssmckqFlKi4xheQ7E21ukonDq7v2HfkQxcETgDeB5yAFZEkGmju4IXXagFrLhw+W2ItWC/+TEwqjDmKGAiYAUgcUHlRA0QyILiACitOlNq87mpoDJlUj3Ry+kTXrvIjfUySWDRzdIWcXW/6jiQNPgh1oOqY2cW4st94QxVBz1LGsziVLJy+gWtOg5rV7s0UeP9YbvKBoCX9wADgG9Ylzpl80sMfQfHMydW7Eoy0kARYWHzajAKnDJzbNiON17pq6B/rVvjmy6oZ+ZWpjGu4aUMkYBonPHlyKnimNJl3QwR7Ym7rSutLNlnOjqORMgY8L2U9Wo+m4Q2vqwocN0BQl6Z1l1pWh5moAwcOvPriZmrfYS7RsrPrjDmEPm67VA7VvXtexy7HWdLOJtoTWa3NQ5hTMhDEcWOZIvyYfiTa/JQpymG665NE6WSrnJl3o7rlZCwOaa7rbhRds1PgLHINon5qAyLjeIF9h3+LDhpT0Wu+QlNpbfoUVkD2P9J+G/MlD4PX9MamRJxMYADD5E6LU4IFgO3zVdKymAi+hFeX83FSI8osiBuvJ3i/egI3Iee3svLaFElTXO+0t/UXnaG8LBYZ8QJAKiLQBY/ZIVwmqKZXUGjCu4ik+OWtf8Ffr8K6O7/SRtej4BdbP1qEEPIT3Kr4HNAedGjR6Mx9ok05tTbY/shgK8PGig0AQD/iCNNNHdQ4RHpzhQwD5m3kLIBFardHprGMxBtorgvosvSJrfdOrmlJqbYEoc0zhCfQFoRL2H35kR5E+roUVCCdBHb4Bab6CjjaIR+3aP5wP5+eIM/zeJPDrHw78UvGviebexJ+yluOPsaOhp0t4Xte/6rR/ACJvQqMMHzY4+LmATwZKZTSCPiw9nC6A/stzT2yVOAMmiK6wLf6XgIxKOZ2BkPx77/ioOdFsh6ZJerA5qRRmQnejFlgTiplp3pmvkwN6mWEqDVciSr4e962q5SkSFR1T04JWnKnhisboMKi+PoXiLqI0YgojR1dT206GxAx6umpXDIfA3OOqpYQUidL8RmGqJqhKfvVVCf6tCE2x2z1gYi356iykVzy1gsLxqP1Hq14/Pwc11cCPs7Un3108bnzTeNSKS0tMMIDXoS31kb7F21SRgUk+Qycwc4iNA/wi+a0A+0owgsUifJgA8+wiUCXsQ4wtU3ct6AY4Eb73wMb/8vjqN/DL93ESoIhyT7CgtEK81PU4yKmXL6lJbX1wCD240QwlbHoT/c+5bj5dTzC8HDxMjO2n69CEbK25Y1PNpdxFBd9ucVdXeKHm0DBCuiQIQVQ7pO6NNawrXXBqd3VQpdrdIe+aU7SqKL8HU7n34F5a84SKtzB7pEYu3rJYCube6zACL8Hv0xy3a9uWrRRXkBymczOwbJqDV+/VDhSKYRWFEsdrd6LvWbagUKhuXHEuFo2iuIopTAKsUOexEjjF6BFDpaCfvC/4O8N26LwWAol0WYqRSedyTl/31RyocMuYUVuFcigvlt2Igvd7FBA3aAutDK+8SeJgNr2/YNpFjdEmQ1EF8hnGlTa45d/ZEALlhdy9NKwrzdgRReobDbLcKoBMUwJtBsgQKlEIynC+C1YAqnuYcR3St964dj1WPsy7BZDj5tIJTtgK1kQLFaZN0FYdm4JlGZ/cjHGmezMcwFioGJlLHlGp1FirgX5evoOBGN3x53zIGIxGMogUyJIthxOcYn73bCu7mHMT1MIhbd2QgpQBAvvhMOcHRa2RXjADW4nKgqOcbhKE2nin2TrOroFJt/Kh3lWCmg3XuWlGdZYY/DWVdUNlzeahxzHD8uAq/TgdjWCG3wBe1YZv90336fpBt54FYpmFJgtRXGHHm7swEx7VAbP2s0agoQzIjAOFzPAoA0xY6MgFzXLF8JPorTHnfRJ7vgHPWRg89uY5vLmyXNcax1611+EdEGOTEWaZPQysf1LfMJFFVRewSxh6v87pp918pxksVJlRRkZS0gAt449TcEdh4QpO+AcJzgSOE/xL10hqqvps8N7weUgyrtIw1BXPEeig18yx8tyGoKNQZ2DTOs+pk/AygSrUcGg6YtyK1fOVeCO5tfDDZSPBhxAfDI/8qGZEa8E8bE+3HRfJb15jMFOGMYegqHFBgroY8jcpYbEnFmU8bbdximKDbqEOYQsbYZszuKGD26DPwZ/kuRyL2Ey0/hUDeGANWMD1Elo+2P8xopATiM8Ub7strHcgMgiEuAIgShK5WRRTX+DSjaiboPkzLJ+oJKfOHVyI+PhRwjrTFxdNFgLAN7W1WnkDGHJnS5oibpGbQzqCsZSxcsaXKlEi9AVf4AOQ0JjSzRD2OBEMx8eSfq5AUd1mK/i0V3LutqhmcpfFVVmCt5RE3IzRlmJGzdlZjIAXOIuuSvJsyDgABbvEyBmeWGR0LAJgWUAW+71+QVl0HTdFGOFNrjSK2iXFUdSKyaN4/qUIJBA5JJBB9P+WyCISiRQsJ5ERmmdDLiuRpIxIlhfK7mlRoaSLNKGEN7lCKWqXFEpRKyaU4vmXIpRA5JBQBtH/WyiLCCVSsJxQRmieDflTmsnyMrm3f9rtFZTKkb6gTopcsne5kulBKCmbXr2YdHpvvhT5ZAQPSWi4C3/LaBEZ5VQsJ6UxyudB/9McWpIgqK+LTi5vr5JFFF7gnsVcGeX1SwoorxSTTv74SxHN1+H5ZQD5v4WyiFC+Lju9fF1sdvn6x0/sypYWxpPto92TgvJoa+bQTrGa7F2uRHoQSgqlVy8ml96bL0U0GcFD0hnuwt8CWkRAORXLyWiM8nnQ/wxJXYZ3WoCnmxhrHtmUXjnD1D0M1aLDIMgrCw/j8OEm0eAKGnx9gvtjKWgKP0x8tsY3plaN5QGcpiFeJw3ZyqJsxbrEgm2l+xSJhpTuE6kapSjWKRasKN2pyGxyJZ0qOM0r1i0x1yvdsZgDvpKuFbTFxbomDHLprsW0ZImuRXcgpmkvvlKG9rukcvP6S/GcA+5LZAceumPddanNFvxEn1x7ShvNAVvQZWXqyu1s3JtOJpbt7lIXiEGH8Q1QUOZy0W5fOtSeUXvPmpq4K3KkGQ6NFj087u/vXe4dbL/EIxqpehXPdOCRj8vtgwP5bNM7+EHUlNIn3d7+z91Q6XZ6aXbgJgx7PaP0/tH+IYcuSz/NKL19Gi29kV565+C41w1j8m2DxO2bb6oWLlvi5MdJIrvRZuO4IZMPc2yZTfFYSHzsPPGrJ9k18vXXJMk4JD5H/ZovrgGDHNtSkKAWVoJVIR3CFRBWKe6Ne1Wyt/MlugxbOSAje/tO+TklqauUivX5hsltVxz5cyrAMSyHis0WFWpbpkkZ6x5Nx1fUrgQBdJHbowaHUwEC+/pyp2rNhE2nJWr38DhkZRi7dKRNDXfHMsA8aJPKAHpgC6hZpbrj2tZdZfRtbX4AJrdCTc5xryjuhqpc/b0+dG/K196jMJ850sYV8N4zpk6VFmF4Pidnv6TutmuNq/URKnOGqK6dXtM7527ct+BzYA0r4IDb1GwT+1C+7qE2qcbQH8iY/bFJlNMjmBQw10rBnWW4Hw95DifCm8z9So9ilARu0jkOU+hx784cKKVbUE6PJ9SsrMvfUHOom9flK55YlltVg3C9v29OphW0ANd6O+DHVq58PKpMr/uhDsTmHFChqrtn2fTaRv+9WnXhblaqjPr+Pg4HgDhCY2e80tkkp0J9z1k4nptVfA4EMb2aM5Y9rKSeAML7Q1CPrjWwjCqdcGEEq2lnphtK1/rR0Aa3b/QFNcrXfX+ju7Ri3ak7ei6JhbZEFyxTzd4Lc+JUsmlQ+crS7CGYh0klPcdP7TGjBsatqsteBI3ELexslYJN2reSpzyhHAHpRw9SJj8LLx4QPuPvHcyZBI9xTpoDazxuYlBmcTyCzikN8j1uscYjjXId4/vQrDcjwIxbjwsjyo/i3/9AeCjCfVP86GVy3ei50JUcCs1aNcgKKpVY8eCY+qdIJw55oi3kqfTTxDPFBVZMkke0Ai703qgA1NiJ0VTmDw1mKJNBUTFlS3oMXHHZa7XIKemxqBwZYdXkYplhzoTgXjDQWcBnpWM9OZAoAo6fQJZlHAvhb5Vd8423lNBKRgvxpRNeWMadRPDu8WPygrSfF42FLXh7DnX7+pgCJwVUqHujuVz0NdcPAMrILrwD2VdJew1++HmWjJDaMjWgGOLyYjzDB5zxyzV1NyOqTyr9tCAyyzuzjIWbUfXB7OZAd1w8WxbSgHg6XSVgEIcGyyCTQlYUJnaQHZVcAmd6Y5WEVe6AieZjkfUMokeOB7NTVs5bU3fvgmFc8SgjiOvZ0eAq7enuy8udtycn3aP+5W6397p//Ea5YF1n4KLnfyN4TM1dOsB8aiIaFUQo+q4+5A6VSrgXnB1tPpyPmbMeD4v6pwPXolTDimNRUfKdBwC9o8Ac30cnDb5yyVckZA4ppaGSWJMST/9o30bwZB83K94ZQj/tVLL3FgnRRkmmxnqX9OTpOju3JjFTybcph7i5N0DdbcOw5nS4PeAZ0QJjGHsZx2hkaNdO+lhiJr6oDKSl7jrgSzhqVo1wHi9ZqY2Vkqt5S0X5LQTXiToh0KmlRWI2UXY9u6xcJfLKP80uL9eJvPIbmeX5SpFX+NuIMuJJ7b4kObuPpCXwWI7oeui9sXTEHvPyZbfBWT+G6CcQ50hivDLCzZUvdkaOc1C6I2/jGC5Uwr4N3RuwnSx0Dkjq5nv+BP56JR9qC/lQW/CH2SreCeCUxhvPE3kPM8ZBJT/z4keecTFhVVKiKienaL09pL0ZK0vlBDA/drxUjVtJa4myjyFosrfJ0HiCx6244+51vxhDI8QoLaIgyrPwogpI8phsZIO9qwj2eTZYxoYVQbfXs2Fz3m4UYCE2vgUbfZbdqATdSOa2RD4t1vL6Wm7LQkYLMXqZlnN4Q4JObbh6n5/nthzsc6rWDoeL4zrRQyfXr5prd86x2bcmMafKe+ODt701jWIu8nx8BAp83HNBYd7H+gazv6LtbSep3DlvZ/vKmq2sscvtH8F98pqMN7oYsMSsGfbhu2dRZEWdYkr16dPGVnJsJJwS1r2b0KxmEhkSJlHPyQ9k4znZzBWKp+sMEcxsgJzngtUPtxcc7OaEt+LBwpTR9RIYrSFGa4FhChQKIgk4AUZjToTL+xDh22fY5PP8JiN0iWUzlmTC+GbTOFu7iJLJZ9P7kunZBuCM3lcBMgVQakdRYqJ8X2SergMyaE6KICOZmDedoefEgmCyDgIGSU3y/DElqbMqeSJLNd7oQxET2B+wtNmeagy/+bJUY+9Wn6xMM/Ze77+57G/3Xv+4ffIXVJArV5adzvMfNp5v/iXUJMNlbfPzKEhs7Ntnm59PNSKb3ocyzzY2q+nEVWpFROTp+uaXqw8/fcZDPzF6as5DlqfQWxa8tNmmYfi95T34jT34LWF5kCU912xf+cT0E9sRG4g1N0+33/ZfHZ/s93/CjeqhV7v7vTcH2z8VPDYXzG8IZDpldPJWZjGh1xOH8vselAaWeKsP09/PbyxtrAdysgZ/JJLgswOedcXvg6JyRJoLbereWCCad0UAiJ56tQWnJcT/48Mpynq5GRnTBvZf1b2UjREjkETqpJmuaMBPXlZgqUtQdcRIiQoKV8Fxw0hdaQHSLXc8aYFyNN2eoc0o9Du0ZYzsaVCcrxqycNomUbSUbWjIcsiT9UQIKTWCqfdzCez4m7vCRA7s+pJEYrnYEmROZ7wZy22JOY3Z687alv4i0NCWf9FADt/zSkmIeTvKfMWVmPEQcAvnEFwTOQPXvByBAdjBDa9BwNhxP3NgvAKfY8drcPw3xaf8vj8EGKrk7U2PyZcFtvbruN0jn3jacPjesm+diTagr/j6WwA7iX9Oe4L7HMz2HnfGUjgtAMPTvEzuLxfDcV0kFtWH2YuRsd0XX/m58byV0jpPxppEpQJ7dNI0rVN8bw50A3UGfnz9NZk0B+NhyladlK1ECyewh6fccWZuEPx4kczNu9xK26DBNfcQ814vHHCVGLo8K79C2CEv+a0Fem1iTeroUxxYc2rvaGBHC25MkOSRmXIziq/otg9/B0r21ROxMiu7fiIE2b8FhG+seWIxDoEPILi3zUb+gSnh8XVq7njlA1kY8vaEdXWhntda53h3Ar9JZHG2MPCqhfhtImHEUvfm6KNCV4vknAMqx44BVkxpO5PzlsmKKMpxy7jHeZrgcnJfCubejmXQTM0U8C/Dmb3lyynfREEyHTN4hMWCLSaAcq1baiamjPakZmtVeg+mCQeWdetdLHYq9kjppuOyO9z4C91hGaFVtq/Gu8KI33PkO4krU6s+fTK0a8KrJ+ickhztizhp9jXMB7B0WsYJ7nrzu5IWeFmSr7BxRwwbokA2iTW8QmmhF1fkiAFXxws9qo9TtpCxziVVkd2GiWdYq2dscmRVuJSjwvNYTkAH0gd0niobdXGJFquqAAF64NuwNpIFHzEkXM12nfc6eFLKptJokB/kKwIer3JRJC1Cla1oK7QoRa3Kp7Us6dYFjUf2TlUgeg03mtaA5njDDpiZkEmCsWSWyRqPwUsMWqdaQTSEjSpYXJGvhDOKF6EoJavivSgbf7R+2Ww1ylb9ULZCANNHG6UxXZatwC6Jqz+CuUmLy3PzcatRtlku/Q4LziCsk15/+6T/+Jl6ctA9etl/9eQZyPIlgvdvYiqL6KXQQxIMSHUyjFarAJRMXCvxR7vTqWFq8YAReYyXf4F+Yo2y+6YKAq553FMrWYEFQ8T1Yf9wVPnvvKY+aqvgzDFUVMFgW2WhL0tViHiIaRUz93B7FiLNaxOGR1VyXDYxLCx1fptfHuQwBchuoGCtJEZrYiZ3o0i8xmWXloCq2xQ9YNd9+UEs7zFewObNysWzp/CMLnA7bNecbfp/Jt5QEu6Xwpr+niAjRvqIk+bc+Az2mIEo4cj10U07wJky2cU7ajFBPPhoeFkvv/BSM+P+nW4yJw69OyK81Rwvr5l5NiYxUweIXqpffKM5B9a1bu64JY7SrNjQpxv7T2zbQw3j4ZiEhlPPzJRpOKdpX2EYOBYD1yAGsJA3Tmnz01pupwJnTfw7z5QS1YbUSPUUUqqYcs68hlf5mRj6r/2aZulSYPi3spksZlmm7ocyhT2rzTA90y+CtySWBATmj12quH7xeK3R6cStYKMkwLI94TggChsXHXGvI2DgghrATYHloYWvuZMT6Phljz3OqPvDhFe4DigfH5tIZvkKqBIvD8Yidm0kMCG/JPLpRfjSyHXx+e3FVvnOMdZWa2VrliJjqcKB2wFLVKtlRKAyPIyUgmEz6qkjYUujWjqtPbla2M6+XzOruqMPU+/t8kI17l1uGT3lHU9s6d/GzNBNuJC5xPE+RJkveTBgoEyanmA0ci7T8mrgvNAPDEAHIxBdXPorkcfxb3u96oYTrLVzY82ltcY7j/leIPhDrhtivICxx2+WbrL4UFbcuVZOIwHT+iYXrVft11/LWy80uSaYXPNFBwCC1TU/g7mCltYF7qjHzQt1phlqrQL6BSIbmZW1ASbAqlY3cDc1dqi0x5IVIskLk4DBB5KBZiB/kNYvgt86rUYlYNVQwJ9rZ3pVD7Sv1moqx6vKSEYCQBxQNTjLFVCVifNnp6kgqWh8FQQVPP6Zybms5MUKXDs1/od/R7nkii2RRrk0/OWf5VyF4iHKD0o4EpK5qeiVNaZ7lgHWLbh6hXOKVvPUA6J4caAWriRzW9PCLZ1ebCUlflQi0uJttwpvxwEiOa7D9uLg7oXARqUKORtCXmgYHLvIG9zR3eNujxwd90n3dL/XV7L8q0/g/vypLtCf6galyJXvCnG+feKA2po6bNawAscnrdWg53Oa4zekwPg50+bfI5qSG9oQflaGr1A6wpEZnDgFrf9H65fm43/987/+9c//bDUqgKnStG/LvKbRmp1m27JMeHzQEYL6bvtAzY7WFAxx/MOpqT8juNQllVxgP2cHFKrYpNKBhXsEF6rbwFJ2UE7NJ3yKn7ClI7T0cY97HUQLFUIQGbNp1le2XPh75UsYito+RWYCIW/2d3spSxrYy0Y2udkSARJjJTd2UzU1rBIJr+gmG4NGduGcJtkGhJzNPeCt7NnW+I0+ZP1kqiUfKpKFBvaKN/KrFMBV7uAMOC0dEmxmqxiMCCsQHP4edV28h/g04DkiSwTBMxdpBNRApuGvS9AEf/IuKCkgITmvM2Wg1SI9VzcMYlqBjvLMUSpxLGJQ1yE8uTiujjl3jkvHxMtzj8xn4L7g4ThLJOqpHqzSsqdmS4BoIQH5BjP0txcBd7u6GMX4o2CT1dQVbjX0VyI6WaI0HL/l+75yiOMMh+P7EECGiLfyi+F1YU5Q/hlGmLJ2qNsxlAoAhE4yOuSRIV/HBbbZMyxlADk9flxCj4itnOFuo18d6TPjFtZ8YbXHT28IZuDk+IS6LwXVv5IyKvFYbA5oeidkcOrFtiVitD5zW3kOEUHvvffvl8dNm+SROEJDru5Av1m3qPs1l2igHFHzTeSmTgIUNvGlxXcUOKg7cC1BcwrsLJWztnTU5uA3UVIv1sWC4u/yRD5sjQM3vReQXLZKm1OuRKrQkszNWi++nZb1j3WQb5aNba/lyUTH2iQdxiS0EzRvYl5ADNITV5YgxCeKqJTd+fl5d4IW2xnKN3mK3Z0TvtcTBz5w6sBlUaxa8FFon0DNP4DAI56P1mGCSApNwkrsKUvj7liIUMQUMzKTFuQ9NulzVPi/UMkM/kUvjkmdSbD94DibYEiuwLSCjuA7PhYXcgtdIbVW0hRmTl4rwGOT2mRfKHAUEuWQWdpIF5kzSc2Zblv5Y1lwTEMzYtBYDm2svMfeHpaVYlyI+0JcCHzLNwzgHy/gd2C/ADxafceZKXPOAPZF0hnZFbXCiAEdg/44hj6g9RmX0UZAJ0ol0CnMN8E+zM7WeJ5PeSK5UQ5Gyc5IJ9Q/wzzDmF41IJ6XUq0+s+P+MUx4ogY9gLLUXJYcVoeN6wLTg5VoabkyQftcTnk1SrMoROJu3p5F5lSxKbm20KsGd/zKnrrMbcZtuwAaHHJqTsfU1lhABj1y3xu35iY48VAkcHgLj3mA+z2hA5e55EIRjzGtwUycnneSD0z9fz9Z0+l452p+4KdqNkNnaqSfhVMZ4VWd1/gJTxFEqT06j7tVbZIT2i4U0vbmJeV9JxlBMLNcm4xrAgw8oc+NvCmNfOqSbd0whb36vsLclMV9iwdhDTN7x1so7IrTI5qSl6NcTC1jfT3YYGBB3Gu35BL4alT8ve5j5gndUw4pZNCLhxkG1tQYmorL4wyBwUA95dHEsTCCoBFDc3DnBfp4dARsC11kQdjfpvDckGdYRbWMHZe53F6ADUtwvefrmyuLWqxMCPwFiHzOL+gExSVgZXy+Gndm+QlEIeGoqhCNYIiOZdD9+DHsF3aKnbP/C8blsoJh978rp1qgS3rLPNiF6GOODjTAKwt03fc+js+2E7pA2c+1SzktKAUDtPkd/ATjUHIII+Epz4uqGJkqGI2q6EUtk8WjUKRJemCLCh4YulSJMaQq/tW9tjl8+ohQ7l6I7MBPTgcKBHgyEMgN5OAgAyd01rbg94tJYJUuO2rzocBCQ/HoTMGwJAsyIbTw4a38yqsN4VQN25RYI6wUnllNSKUIOYuHTj6DV1Ou29KZAyAsxOHZF8/fw1SPYqhYch3SSU2+408NNrlV8mdVP0S+w6xclZMAUVjmPgvDjNwuvulrr7Fl6q5lP8F+gh6LFMwA0+/1i4GBghlguqcFwUDBDDB7+6fdXjFArGh87Lwsbziw4VGcywRzPSgzqVvG8F14OF8eBg3C5Uu8nkofHGq2c6P5l1wmX52F0FRSu3QQdi3xhjW/IdQ5WCEhP+TLwzKZIWfyXnoPmvfCy/yJr7yn6D39Eb7EkL8KcO9M3owSuAO+PpNNej5UEWrM1oOkmPmVk6vNsM7J8XH//f5RqKLAyL9SGIuCri8Cb3unv/+uK2/OSgIbSAINNeIjwBM/R6/gavgY+CM7xkyznQQY8CQhZXi7jTnDn3k3qGB1kVM3ucK/YfmNnIzQsv/8ahvMcRtAMnTtDSemf28v9h9KiCFQyc57lmyXp8kdC0BBMMxRmoUuA4JXu9QZ2PoEJJdVD0pV5BU6Xdpw6D+tewhapsmv8z2ajq+glzORoxKnP9rQwfvowrcXxhtuXgaMZXopFAoBMyQao2GCcMAgn3Yz9UR06Ntr6xtBMyM3hbAEvjKfK++0uGw7/I71Oz3LWxKc0JXhYWgqoB+7n2XOQlT1025aynEkj8dfjfy5/0BzKJF8yHMtb6bvC/LazSBq1iUJWbiyvSRhEoU1QoS6RSceIZBc2YqrMj07w2WMXZSZVPqaujtTG//0Up/WGyVvMU3b5QWKUJsa7mbxWstYIsJl3IQmpWmdqZiZ1TOk7JATF2L0xTMUM5QIamM0ZEv/kLbHClTqCcbQXSCxKy9nnImbGX3UmwMmezxFeHwkGiFDWOYWygAreLdP4oHzWBMYLePDzVwBP1wTmo1EfJG4dZ0lsUckE2ScexJx/SqCTqRtfqFoELlivlC4PNsY6pk9IayhkAWWutLZVWK55Zzfi5RyNd0oUs6mDshCWsnofalMgb6U966F7kZtgkMjhXm2HrCT/qOwbmEZ6Z9tsI9t804C699N8DDAUGUEUaG7KuuMKlANdgBH0Pld6EdmCiLB+A9paY4RklevmF5PzkYajhXGzI9tzUld6dq2ZZMRBUOCgdsB502f2ZQE4HKilZpCeajZc91UfO0ytoZTgzb5hMwRmfPFLEFnufi3smAG0juBmObdmZ3YJsrlgX4lErP6X3i7/wengOE3', 'base64'), '2026-10-18T14:33:55.000+00:00');");
 
 	// service-host. Refer to modules/service-host.js
 	duk_peval_string_noresult(ctx, "addCompressedModule('service-host', Buffer.from('eJztG2tv20byuwH/h01wKKlEoeVH73J2g0KVZEeoLQmSHKNIA2NNrSTWNMlbriy7qe+33wy5pJbkkqKbpMDhjh+SiDszOzvvmWX2Xu3udPzgkTuLpSAHrf23pO8J5pKOzwOfU+H43u7O7s65YzMvZDOy8maME7FkpB1QG/6SK03ygfEQoMmB1SImAryUSy8bJ7s7j/6K3NFH4vmCrEIGFJyQzB2XEfZgs0AQxyO2fxe4DvVsRtaOWEa7SBrW7s4vkoJ/IygAUwAP4NdcBSNUILcEnqUQwfHe3nq9tmjEqeXzxZ4bw4V75/1ObzDpvQFuEePSc1kYEs7+tXI4HPPmkdAAmLHpDbDo0jXxOaELzmBN+MjsmjvC8RZNEvpzsaac7e7MnFBw52YlMnJKWIPzqgAgKeqRl+0J6U9ekp/ak/6kubtz1Z++H15OyVV7PG4Ppv3ehAzHpDMcdPvT/nAAv05Je/AL+bk/6DYJAynBLuwh4Mg9sOigBNkMxDVhLLP93I/ZCQNmO3PHhkN5ixVdMLLw7xn34CwkYPzOCVGLITA3291xnTtHREYQFk8Em7zaQ+Ht7txTTia98QcQ6vVVf3B4QN6R1kMrevZb5I/0x0HrJAs9mbanPYD+TCbT4WjU6x6nsK39pgo2nl6PeiCHwZkCcqCCDEcaiMMmGV8OBtmXR+Qpx0e70+mNpjEjmVcRXT1TCcD7y2l3eDVQ6ReARsOr3rj3oTeYbsCOWkVavckE9Nx53x6c9TaQb1sRw1mWwSqm4+F5hmf5TsfT980iVOnREggd262uhpKe71ZvI+cI4DqGuJ7+MgKt7+58jp31ajpBUpPheURy0OtE++03i8vd/kSBOFAgxr2L4TSDf1hczaIfKQAJh+fDs2Ekt+9LFk9PcfXv2tXOz7j2D83a5SBZfatZ3fCO4kSof2qgOuMeeAuuUs3qtDe+6A8kwM3uTmwxsfgHw+veeAyhBPwyNaSQ8Xtw5QvqQRjgsCTDn2nIlTd38ZLRiHDmK8/GWJAgvvdDYcp/D+gda6T6xOhuXQ9vfmO26HeBckpxCTjGSQyFPDAIMILxS+G4ocoBu2eeCI2G5XgQ4hwRmkizITFVLMvmjArWQ4SU84mgXBjPAPeDGtCez++oW592FEprQAb+mnEgK1hnCVGZSXkjkjMnZsB9G2hZgUsFhPE78g4Euna8wwOjEUNJsaeiP7tQZXl9xjyQoX1BebikbspQCt6e3dPAARSJbHUi7gYQ+e/ZiPsPj6YRwxweWDO3lILEu2Bi6c/Mz+Qu+scxMSKRTWJZdwR3u04YUAFJmbeNJlAAtFny7pjsk6daGxhjtoCMCqLbUH4PectlvPfQrsekMWEJY6iAVVhE+xmyI3OjnFYhnwRKL590Nbv5GRPnNBQ9zn2uKD1FG7ps274RiH7TeCm7Y8fve1C4UNf5nfUe6uJcQnmQYOn4vJ5sokCB3Q+UO1hGmeIxYFCvZUJGZMtYFXkLg/xIlCVyrP6yPITOc5vse4EV4WZfEKs0+TPXv6Fuh7ruDbVvzYNKCtYIyjhPSEKVkJGDye0qAX0PtJxhAgw+DaS+l2OQ8oXdJPDnfWNDVfFufPb2pn7XPyadJbNvsRq9o7dQ1624rKqxsIZibxWqakq5i8+YMhkbfbnODt6qIou3Rz3O2JyA2la2INdqLXc5KbKLf3avhuMu/D1by42nQKRAOQvZWXHkNQqM20B9T3DfDds2NhNstgX8CoNn78ERHX+2jXQiKFk318SKlDPyHU9sY4U64r0O7Ilk5dokr85H2VcneQ0D8cS9oeSX7gN6Qh3XtQVL+D+t5nPGzYaFTQ67hI7w8OC8Z2Yq/LxZfAnBqAmw1EIeGoEmOaq/Rxz2EzOWIDLeV2YJU0cTA05Tu5u0M4mfhQHnAWbCZVz2aAln0Rv58zlzLZZ6ROsDdTFmthpZ1JzT4ZOUDQws1tzP7/WksR25H0aQEDM2BOVvp2SloduiaqnHfKbeKiu9CmOIhs53kvPzled9g7PLPvRZhr2ddtw5WpquFfruaqBNd7cVNNPgNUkhK/z1+lJhZdWSqW1M6K4roxSm5n+r2XjoTTaNzanjRYRA8DlPU38UvQ6bmvrlt4qVVuHPLMCTp355W8T9who3T6Z+masKIExqkbIypIimOO2aYtTyA6hNinDhl6S2OgTUIUrBvWsRkE5Vqle9O+n9KCzxGXzUMj9T2JuFFFHtdNjPljTcKXYGT58F69TtRzVp1avgczh1avkcyraqXotl2lA2Nkk02cDqV/6zSwVtEhtA2YMor/rRQX7LFTggsksvVGqOhEqhriDmb+TFO+KtXJd89x0SiiltryLCtQNNOYmYx+KjUQTRYOFjU6hBc4NCq3RQ+SU0cIypx08VqbdZZeqjezgTK+6VANRjLTMXLd8pHsdF86L+DLScWobVZZzNzSOMKmrwwIlJGjuqzhDrz0ytrkSHyVOiy9yhC7NcqzhB/UqETk+3UMInzbUrUO0bKUicHsb6tqOp2qxS18lzA5K9rYB7Kl+qQoV+ma5cUXGWMuxCoY7PX1FulZw6jetP6owyM9P5nA2ewyC+QYKQUzYB8qP4VZwAfSY498lMgsjTScIOc0OmGYByf01M42IVCnnb9ZjclKljKp8TyZihnCg5zwvdCSzJxoiKZcnktQIDzr9pyZiNr7L7KrNz6EAAPM0o8NMsbqidDb/Iz4ZzSPhEFzL9M7wwuN5k4XS369xaoQIu2mMexQrqxtun3G89oWJGxyc5PKZjiQd5OEchU5OovgTiMlESTnQpQpwfEnI4frNc5i1AQeT1a6dckDK4qogfnU/bxRVFP+ONg8kbSumSqKDYYXhvy2uajXdt3sEBPLbO3edAVigLVoI/6hcqon9+T0syL+3d1Fl/WbwtYcumUaYqyU4VvEHZE/ous1x/YbKqIJ8ZiVRwV8Kfso3W2TFWkdfEIFI2FSmnFidlKUGaz8r7rzaglP3/m5DGhFLpfFsjiuZ8OvuRNjarsq2q5ANWFu9cpqpvZ5x5Q1uklVG5zBtWJIlSKdZXXDI5tSzr2yoOkmm53sL/Ib35wVdRmx8EX1Nt5QW0ulbvfh8fTQ0nRTuNPlIrvcI7Iq/SpehGivGJ83shyBUucq0gBk57TvzgzlT3VBrSSmrRTehzqDXrMxyG9iw5e9IJlX9tkNmwnGBl1amAYeE58z2WmyJX7M+ZwAZcl4rQFOLlsksejRlkmMoU3bqPVdQn54VPeZjC8ENBwMar3HRdx1s9bDHdO3+2cjPfC+S7xR/1DZUXN4b5TsoKVzfxZwTmPvhzYdmloeh7M/YwnJvGnlGwV+QpOQSOSdQBviS2+RoKI9Moftn35r6537DwJAWnjySkEsU4Gz6Ggt3NDJzDFRZxGmts7x8iyejUjAPxS+/W89ceGSU6iYeNoU/WzOAMZXMD5h9/i0uTIFIarhJ912Pq2saL78CZqQK0l447u5ZixKkMaOXUgdBk7N043l64BP/5aMBfn3SGmqUL8X7mr4TFWbhy0UMNozZO5K5UUNVdTXu58m7T/CXJvn5HovcQkyaxVWHe0s71ZQuoaPKZI9JY6dsGmJnDQDiNbg/S1hoS2GvVp16Tl8l1yh+Erm+J8TmAYwjyt6Mn41cPE9iv3suqOrdqmCUrEGnIf5bzCN0WbsKo5gh/kAVnATGi73tG/e6xkT/O4RceR1OL5JheU0f0koSvi9pmpYGiV8e+TnnI+p6oBI+mYWlQdWbPTABbrmQqDl308Hp7PTfLVKUTfTaZUQ61UEU6gZB36vBQEJcJIyRzhvcV0DhF36qD0YT4nwTklX4S7XJfw2D0j4LU14laEWaiWMhKuiiVgakRmJBMvaiUUt74mkuB6hJ9zXVCkThMQWExZoXBo5wguzOc5eYPaYWBixahoYtowr9lXtgkji7x4jfs+UEgfsNm4mxu/4Q45Id435KxnMYq8In3BBIR7kfnU8qj3lgxX8c4H1uf0Gc3P9CN30TdUfAxffsJa5fkR6GvKQwB0MI/Ks6tqLHGzBDM/IoRqPA2OftFZWVQGQb+dILf7vZFH0fVRtKIwzt4UuBzgYpRviQ/yS/Lb6TVyXT8xvTlbCj93jyuVYmp9JvRx+kJILL4dPIf4qZ5rw==', 'base64'));");
@@ -2590,7 +2590,7 @@ void ILibDuktape_Polyfills_JS_Init(duk_context *ctx)
 	duk_peval_string_noresult(ctx, "addCompressedModule('power-monitor', Buffer.from('eJztGv1v4jj290r9H7zoVgm7EErnhzsVdVcMZWa5LTBX2qtGMxXnJgY8DUnWcUpRr//7veckkASHj/m425MmqgrYz8/v+8NO46fjo44fLAWfziQ5PWn+rX56cnpCep5kLun4IvAFldz3jo+Ojy65zbyQOSTyHCaInDHSDqgNH8lMjfyTiRCgyal1QkwEqCRTlWrr+GjpR2ROl8TzJYlCBhh4SCbcZYQ92SyQhHvE9ueBy6lnM7LgcqZ2SXBYx0fvEwz+vaQATAE8gF+TLBihEqkl8MykDM4ajcViYVFFqeWLacON4cLGZa/THYy6daAWV9x4LgtDItgfERfA5v2S0ACIsek9kOjSBfEFoVPBYE76SOxCcMm9aY2E/kQuqGDHRw4PpeD3kczJKSUN+M0CgKSoRyrtEemNKuR1e9Qb1Y6PbnvXvw1vrslt++qqPbjudUdkeEU6w8FF77o3HMCvN6Q9eE9+7w0uaoSBlGAX9hQIpB5I5ChB5oC4Rozltp/4MTlhwGw+4TYw5U0jOmVk6j8y4QEvJGBizkPUYgjEOcdHLp9zqYwg3OQINvmpgcJ7pILc9sej96POsN9vDy7IOTl5Omk2T1vx5Kgz7g8Hvevh1bvhbfdKTb9p/vUkmf7tdnAxfn01bF902qNrNTuBJ5ntjsYXvdG7y/b78VX3Hze9q26CP35wj+OjSeTZSCYJ/AUTfd/j0hdm9fjoObYGNDdrPLz/xGzZw/WGAqzPY0ijFYMl+jcN9sg8GRpVq4tfuiAFyYRlU9c1EVWNSBGxarwIH8sWjEqmoE3DnoFsmWOUAoRP5XP3FPdaXgIJbjkUtR27fBYMLXDp0qi2UneIBdDujECdDPhvtrLjrzN7wmS9uVrHJ8QMhG+DfVmAUoIZzck5yG/BvVenKQXPa0IaDXI9Y2Bw8yiU5J6BTKdg9gy96nX3zfCqSzy2uMQhD+wJvGLm+w/oMcEaiaLK9wrCqJGVmk0XR6rkWc+Amm2Rl2pLg1OJLotrvsazFpAZs9nuGORX0iRn5KSaQfiSkytizTCVQ+7ROQRHtJx7aj9sygsFjDBqt1irQE0KnzO5PIWgQ6BMEXhGjNft6+vu1XsDiSxBnjcs2ARnNeL7BbxrOw1ZcNww3fKlaG8cBBky2ZvPmcOBanMtl5C5k01prBwQcoSoQ6BWwQi5UnYF1gJ/HkRhjNHMpqtUAn8LiIVxzLvlnuMvQtKH9RDhIJjBRGLFsDAJhbA0dvP19g5zGcgWaQPiU13HbFd3+4TLvehJ4xOp5t5RyGrnxItct2iYqUwTkA93q93wwTjosEeIuyFMroQ0wQgFfu84XIyWnm0ajXAZNmyXhmFDBbhxGEEaiwNBigzZNxEjxzyWoM2EkgzhKbebO76B1L11y4ZBfk6Rf+B38MNoyGXAYL30R5AGvakJXwWfm1UlvD5k9TAb0jS0aIR5yP5GaxPdPXDzUBjPeNDLn15uieHsLbmMoVlBFM4OoiRnSOWiWkeWRE8/xFZfLq1i+A2oCBmUottEmNsBqPM9cECtoLJUa8nMCsVl3hQQ/gJRcAe5UyYLiWcV34pz5m71oGmF0RyLG42dKsPTjCurVBa5wUl1E1qzLT647c+HCD2zS2IaNlbZXC53iV+jhiwV56SPOpi4PtRvONDQmG2sIR1WwWQkMLtE8y2Wio+2btCq1azmYjE+kIxGHPuUBI4owDjPYIcD2SGgU4p1vupkwEZ7NbJgKnVhAwGVNvcdjpl1SaA5sR9U4kpSdFy/7KK3o5ZlbW5jdk+re6TbmS+uQb/BNT+c6wqCva1OqwLAq9lxBc6gFN8oC2HNHib20iqTqJIV9r0ilgSWLMkvfcWyhbG4dtjQRFxEKRRFu6yRV6qTWZcZGgZiYqkdcDC8vNbTQRO/qAZge1JagVmZunNMHRoAyXukkdWGVszrOmivMYPkIqZRSWFtrM2kIC+sLq9wd5OkcYQteWujFsthSzwjA7SKjqreqyM0RL24tYCvtQKWTM+QqkBbPTpUQFOlKR/jttVy2ATS2zsILUzIZVKQV8Y2nUwY90ADlVpRXUqQZyRjxPsFBHvGXSdbaaqBcUI2MMuemI0pAYqHe+41whlw/cGAjzudetRqK5SOH0n4EFi2Ga38MIrPoZLmmid71ZnhKshQdia5FPq7jc24Z+EhDdCoOgPoENai+uixJy4/elprijEsKJddANJGwDTPFDkrSXgv1azgN9vSz60kNtT9VVW3Yo4JoVMbDn8Vtf3X7GPTNirBHKI9qU9V7iX/JoDH+AiGQYx/GfCTLh5I/Q1+Nyq7sRnPGwalAYJRVWefh4EL9vWXZi1YiFql3alUf2n+WmlWzionldaemBIcpzXFAAQEAnQetBbXfTi9q9mzaa3y4/6rAxCznJDK88ePFWrDvzPyY1iDT1W9JL9fKjXFaw2QTD8071pkD+yVFyN10BKhlzqnhOqpJKhxb+KDZf19NBxYqtLd13vxSR0ekWx4NwQWac+Iyaq6vb9VMP3WXpnb7H8Tub/EO/UYNR5aAkg+z0vLse3nqbvWK299tc1bt/DzlTy2RFlbvHa9YmtaLfFefL7Yg/HZ5sX4rD1ZaF05i+MZCtYz0qzFzdoZqTf1Vl3sQrYVnvdb27uN2R2lAB5J72xss4vUcXGyyKL2ur9LSvz9D+fSjiCDTafudUeX9AB7nnFv7exzXCjl7NWo7jowS0WZR72dq0Kfqjs938s6UJtyHuylyKIKYF1e+vqTD4BKGdpyQJa5IdhxNvZt+uoNF/iSvjr5iLOUy1hwEV+bZZ1uNU6XJnRqNttsz1A5kMznPGTZLJ8M5aw1iO0nBc8IQTBo5gT7tL6KEslZf9haDXxSA59a2YsWJZsFV1Gr2FaW68imQGxyh3emP+Apu4qxwPjexRsNFx4TAzpn6525U7VkyB303ZP9j4IaDXLL1PGZiDx1F01DcumDckfLULI5XrPj+dmMPjI8P4NO2CEU3yQQJCEtudaBNg/mF754KM8jfhBfaZ+DsF0KOpidwbe570QudMuFq+EamTM58x2YyBoJHliIaXhGPtzhBVjZmZVY6idK5IBPQp2lmDsvvRJDPdzAEB7ilCvLhg/fZTfcKc+KmqNYfNJUWAz7e7AQKGs1jYGvVBQS159OmUO4vuFOnzS1BgdSGlj6GrsO3OPLInislVyQm4l0y3ZIUFlrhw52QGL5i1VPrvxduXGCR7lzaeGrYYu5Idvbe3LuquEcR5CiFQw4fj2xDJifcYeZ+Yvj7IMe87afFe74LV5zc7sPNdiMuqU6xZWo/1ensPpt3+ooFQyo5I94jvW0NI0bNW05bjmWGEOyuK980TRGzHOS6932rpVZWDP/skkt/+JKrfiqSo2clltKotMv00kaOccsLop1WtAM6a4t46CeHCNqonqZm3x2K7qfs6RQ23pTlITWNTKLS3vNnYu/gotm6Fi3VHF3mrxso5KD5y+2Hi3q1OawCY1cqVVYGkYlGUVB4AuJbxXtgTdjMRtBNc1VivkFfWCasiczbP55Kp4UaVzvHFzulHvGus5dHxHvX7wc4lfFXdC91r/AQI16pP5Lcqp3usyOn+cVBQSH+2QWgda1bN9hh7lXFuX2aHJQLPxe4B5W4Gbc/nt9+72+/V7f7q5vH8BCmbulwv09Adha46ZYNqpceT3D12+6kD8iFL061dmNpmShqXmZ+v+nvt1RKOlpPbQyUm/2xpESsjaWXGFawuReLQfQ/wAeFD19', 'base64'));");
 
 	// service-manager, which on linux has a dependency on user-sessions and process-manager. Refer to /modules folder for human readable versions.
-	duk_peval_string_noresult(ctx, "addCompressedModule('process-manager', Buffer.from('eJztXHtT20gS//uo4jtMVNmVvLFlY7KpLBy7xfLIOguGxZBkCxNOyGNbRJZ0emA44vvs1z2jt0a27JDsXdWpKtiame7p6e75dc/Daf6wvrZnOw+uMRr7pN3aeE06lk9Nsme7ju1qvmFb62vra0eGTi2PDkhgDahL/DElu46mw0dYUyfvqOtBa9JWW0TBBlJYJdW219ce7IBMtAdi2T4JPAocDI8MDZMSeq9TxyeGRXR74piGZumUTA1/zHoJeajra3+GHOwbX4PGGjR34G2YbkY0H6Ul8Ix939lqNqfTqaoxSVXbHTVN3s5rHnX2Drq9gwZIixQXlkk9j7j0n4HhwjBvHojmgDC6dgMimtqU2C7RRi6FOt9GYaeu4RvWqE48e+hPNZeurw0Mz3eNm8DP6CkSDcabbgCa0iwi7fZIpyeRX3d7nV59fe195/y3k4tz8n737Gy3e9456JGTM7J30t3vnHdOuvB2SHa7f5LfO939OqGgJeiF3jsuSg8iGqhBOgB19SjNdD+0uTieQ3VjaOgwKGsUaCNKRvYddS0YC3GoOzE8tKIHwg3W10xjYvjMCbziiKCTH5qovPW1O80lb47JTqRARb5+Qy3qGvqx5npjzZTRB7DV+W+b7b3eda+7e3p6drJ30OsBVeu+1S7WH5/sXxwdbLZZg41WWQNO/zqsDple/3FxcPbn9VHnuHN+sH/d6R6enB3vogpDbi3kF4nuuDaMm6blD4uY3MPA0lEHZECHp7z8N1CPSV0F9F4Hotva+toj9zt0bPUayhk3bztbestKb6F0hp03m+TC487w3rAG9pTpHRRsBffoZyOKEwNMN2FGINqNHfjEDSxuLtfWwe7US4kYlh1rFpjWVWokI9bJzS3V/c4+SCGHLRsT3lTeJpE06CoDehOMRszBNdNEwXAGhyKhE9iMFfEfHJx1KJNvTNAnsDf+F/j1qB84rL1jaj4OJHFAHRh7IYEHE14fEyUUSo1a13h1OAh8dA0MJU8Na7MtbyXFyRg/gTNTk7nNm2N1z6WaT7ugvjsKtrt/UOSogTowuV+W8wjJj6k/tgeKvGfakemXI3xD/SPN8w9c13aX7JK9ndu2Oaams9nuWZrjjW1/OS7H9iAw6Wb70HA9//1qtF16vyzpiUOtU27R5QhDotUEjolXkPiPgLoPh4Fphkw6E5gbXW1Ci3xugPATlP2Ne+QQYsONN0j7JK8wcTIXiweaC04sdmF9bJiDUII0KLHya6dEo5FA0TuglRaYfqEH154WJxp5QWQWnL3AgcAPEWou/1kKVagVTCikCvQ0wiOQOQakYq1SnNQVQDjd1AUM2iEWnUZEStxdgsjksYDFBRgmszRrYKsiKN1o+qf0EKIyxfFqSevHrHaiRiqKxDrF5inuM3FHrD0Tx081ZoIC1CZKS9PkhA5cNm6/ljUOwO8Zr9QitLaHW8QxBqTxcxQo0uFFTRk13XdaFxmZYnkKBuV4XgbnAvWJnTXlsPJB6EiZyIeRUwbfXcGd8y6dGDIVYFCJUWROhds8H+a/xkDQQ+iu7zQTtPg4K2kxhkohLhWBXylmUHXSEg0OGaN104HwneYamNIqUHJqG5Dquz3jXzDpdshr8gv58dVrskV+/PFVGb8hQKOj+WMhz3br5esyQiTiPQkIX5ZSjbejfD794KhU3/41GA4xx1ExF6cXsHDZbB8dKKz22oPO5ijGgtiQIGxO97nwo4zrrEsRr+kY1zBKip0Ktq6RYsvHYhE+OB13+Ij2qUuHyus6eVlLjw50NYgHJxwQPtzJLoHdFXoa8mVzvU70CXxLdVA0/Usw/eYrsPzLl3XSftWqqe+NAW1fnB++JjOhBZgVhkRRHIHrpsK+sjAfBxvVUc5aDRVHnu2QxkZN3GGJBpkWQ/cq94rIc7lnlGkxGlduROVpASiAjSBiX49FicfTKhnOgiHljKqG0y4eR2yiOUOZlVfl4SZJbWFIZeoR8RO39N2HpY2YHm3gwWIzlQrgewOwly1O5VoqPp1MYaGJtlDQi1QLvi0hPUHAx1BF6XJeV8JMXFoNbVi+Og9sBH3OMaPQiujccdgGmIjTENzueGB+XyeX3BJXtW1Rl+VBM0x1MWjyJeyCkDlMJVua6Ynshs3Q9pk8eIgeQO8Nz/d6D5auyE3q603ThvWqCokE1AKgMZfZ+uknGXCNfZfLgsycFBt6ofohQDz0cWNYTW8sg3pk+LgSaddRPX8AS3T4QO+VYVEdF9mWAkm/r8n1JJtS9DhNRYoXO0QHBOv5LiQ5Si2XnmY6oa6b7wSLnrYTUCcDUcjEPdKgpGHz7NFmORc3CyZaUKC5I498hmnPqiS537dkAn99GUq16SfSOJSwrQRFEunLwnQs1+ljlUZYAiPxh0R6lLZJRRLIERVjZ2Pb+Hv3cPvFC6NWke6xagf4eI5p+Mpzo75bl4hUC4WrSj3yghuleUlAYVc/XLYaP129iF4+ko/4JXx/0axLUv25UdteQjbOvQ8PUPfDZ0UuUsxieTmMISiIPPs3aX5EL2lWNQQ+Vf0jqgjd5DsPBGV/th7hD3g0fo3K6vAPPTtfBllUumgm1cGBdjZ+kaQtqS7V6ruXG1fRn/YVqEGsBYDGKs9pZ39hCSEXvYOzXJFuTya4hYhPVd3MKuqxartI0TOpiidIM7kP8dHw+5Ykbj3VDP8AGiji6YMhLY2JKiDbRKlh6gUwUzkRTwUj3w3KcognDhixOr520Ig7+tqBI+4oMbATRQYeFP6RhAT8LgutXmRTEg4EDaHEpNZOCL8bMfx+2IGVPL1nRZfQ4qoEqcQsF0YZMRmPNO0FkUZMu8yISSrenJ/8zoe8HD1A3A4AOtgamXxYlrwkpADX1ThlwsoKXL4G3rdjvAcdI9inPgD1gahcyCrQ/5VwX6wjMZ6L2y7C9CLVIlznFBlsz1fPRHCPCPwW4Ott76QLi2LXo0oaQRcueqrvzKgsqd0hl1cl4uNBmcK22aDVxjZ8/B0T4WBCLd9TAWFG/nib4KTHDRnGTnUCb6zEjS6NcJFVvsUyLBd8jvCheLgmxtPqt6vvQcyvLV3nV+SOD47S8LpaV2Hm7Fi+8jbc88B9IVTegJrUp4QXb4O3Wz4sMKlwfZp/0EB6YfmIu2oYp8MFJAbwJttJBoXBOqUJUxmWs8VzPtHDMJ7dYJij5iUUEilFB/fA/bkWW6mzF7LZrjToCk1QJ+mAHuZNFcbLZOP5Ffn++9AqKmgMy1jSkCqCkoUSL6hesEMTPQs0O6eTkqrSeRnO5cDyxsYQvLVMacLdFU5cGe/Kt1vER4ilx5HR8/89j+p7Htp9vOXBdiThM4q0S2x2PGaSx0JGCJLyjOfjJUmt5pN8zrc/hSksyLIDb5BybDOB2EsbETGTu/HQo/CWtRep1za8toGRMFn7PsyzCglYoSqRlJc+fa71DHOtOiRbkGvhMQb+Q1qWY5FZOiEhs36capQsOCssIZdPEFbIRLg03zCvELFnC+b8gSmEmRg0Vko1yBPkGk+RTXyTcE/+B+M966EY70vjeKppMaRn0fTLozv5a8K7qPivDO6hSMmhKywa3wgvAWrJRbroKgfUsWMXTpm7xtHhNwEEFzmwhp2dcbqve4sj120te0mDTS3RfY7lLm8UrlxFD2KD52t+UDxOWgQQnEyID6mLFqU3PBBcsFPOJj0LeZSXS0IXJguM/04LEgbGJQoAiP9LxSqI/9RCIRgbgJeo761S2GNn4Yws7JX8TDZYasUKIbvA7dLoe7SCKA08oKTLsHXrKkNa7bQzuuxUdkC68D6P2DjF+2SFm76i3vBKFmQkd9mTaov64E46u+HSY7XCNRUSX+umAdE6PNmXJ9QbN9DnklPvwBg0717KtXIWETEmaWq/7xgO7fc5k0wHAnqItmDJZBSqaXg+tZRHdodhK8V/hjaNgZqn1nw+n2buG7MLrltkT7NwWnMd4GLdogx0ZLFrpCTAXD7VPpvRV3Z2PVkmiBuE1yzjjtgitYyXeH0xDqwVtmRYDEbSFAKw1Ovx8fHDbDbru4gDK+dP8dUVNn52/hFaGC89lljrtLOvpJCuRron5+Tw5KK7j/biU25hjGfT6LYMAfMt30a3IPC4JgJAtwQC88Sf6AOC2FuAkIi2XonwTjMDykk3liDNZOMtno2jDJlE/Ek2wZArwDIMjBlPmucJS7DGJ2QNIwi/qXy1iB64UY8LQ5BvAMhXSIQrJp1c719pYDFzGFr8PTu4pPjrDq/0xHHFobm3l6FdMoP7cskXVId44Snu7SI1heiwdOqNT2Z3JoeJZTe4hIm1eE3PLkzjzlalra4o4aTW3SUmCwPDla8QDvv93gNExclmu98PbwKf2lPq9sbUNPv9uw21BVEXSzwsQY5suywpgle5YdnQA/7eLXwz7ZHNvobbSey7fFUH/CwL9Ux2dUA93TUc33aPqa9hXBL+mGcei8J+XaHqybbUMpyz+3eFqpU7XdBtsqN36dKhySO+uut5dHJjPlxtbR3Z2uC94Y9PNdc3NJPdJZQ8ZnVVt10q1UpjU0lHzzEN4yllI7x6z71I7Zyop1DnqdjLAL/usRQNhkS1iSKpUp1IgvSNbSfWyWZteyVZ1D2e66DOlmbgTcuGwqV+j+1chXW0gnwf8E449RvRBclGx9LNYEAvPH6vkzQgMUklKOQzgdFAtuif24293jvS6NrnDw7tJGvkFYaoslHA+pkqzz9AoAJFYemhiftqK4wqz3HjaTlKYcIofSFXtmsa0ZQvuIo/yWFbquxXJ1UWYoV9DWNY3ILE8MnXacWtCP7LRbzdCaMHT3HA/NGei3ztjFzqAG7kAisLmVsk9eugXHAWBGK2fVg5bFQ6IRGj7oJ2c1YdeUTMx04xFBeNL03H1KWGR5j6wqOL6LCCPG+TBSf4nOPcE/zIf/IqCHcK8iSzWtpCOXBP7uVzefPZVs6Yuf0v8d6XgscX/z0+UcUFVojCJRH4aaJvaWepC2DMXiPLntDoDn/mRhg/OWNHZtHxWeHk7DI+OdvInJwBkBg/sy2pqGVdSp8PfTeAsPncSBdd8SMjIUwKIHLu0VKFOcDX/DkLPIsW5+FGSr5BPEFEGXSGY3ZGJav+iPFkEP8YbmgH1kAuu3ASzdXUcVbZtC3MWwHUC3ehD+7F8/DgHgWtE9th/9lAEf9Lz6wyASNHhA/f3/MC0xeduBV/Z5k4/201YDBKdm3ZAVGeRwkfPkLlFteooAeYZEe4fNjTwAbMpIXC1baeQvUiRyswTfL5c6Rx9vOiYr9MomLVl/yiCU3BTys5c2Mwb5FZ/egmV1TApiSVQQlyv8xNXp4Q678Jxn8TbBegIr8dkfpJSHIvgqE9JuwceyQB1s+/JVGG9fGFCDe8DgFzxr1sXz3bkbBPqVI88CAeuOwCxWxBTKgaCwQxIAtc87F6TgZTiuAFuMWHmh4tZbYiuidozmbJhP1nEOD/eF7nJYcmmf9zBMj/A3mpTao=', 'base64'), '2022-08-03T11:11:18.000-07:00');");
+	duk_peval_string_noresult(ctx, "addCompressedModule('process-manager', Buffer.from('eNrtHGtz2zby83nG/wHhpCXVSJQtp53UOrfj+pEqjWU3spt0JNdHk5BEhyJ5fFj2qbrffrsAKZEiIFGKk97NnGdsUSCw2F0s9oWF699sbx15/mNgD4YRaezsviItN6IOOfIC3wuMyPbc7a3trbe2Sd2QWiR2LRqQaEjJoW+Y8JG8qZLfaBBCb9LQd4iGHZTklVJpbm89ejEZGY/E9SIShxQg2CHp2w4l9MGkfkRsl5jeyHdswzUpGdvRkM2SwNC3t35PIHi3kQGdDejuw7d+thsxIsSWwM8wivz9en08HusGw1T3gkHd4f3C+tvW0Um7c1IDbHHElevQMCQB/WdsB0Dm7SMxfEDGNG4BRccYEy8gxiCg8C7yENlxYEe2O6iS0OtHYyOg21uWHUaBfRtHOT6lqAG92Q7AKcMlymGHtDoK+emw0+pUt7fety5/Pr+6JO8P3707bF+2Tjrk/B05Om8fty5b5234dkoO27+TX1rt4yqhwCWYhT74AWIPKNrIQWoBuzqU5qbvexyd0Kem3bdNIModxMaAkoF3TwMXaCE+DUZ2iKsYAnLW9pZjj+yICUFYpAgm+aaOzNveujcC8vqMHKQM1NSb19SlgW2eGUE4NBwVZQB7Xf681zjq3HTahxcX786PTjodGLXzsNMovj87P756e7LXYB12d2Qd+PhXyesE6M2vVyfvfr952zprXZ4c37Tap+fvzg6RhQm0HYSXou4HHtBNs/gnTQzvfuyayANi0f4Fb/8Z2OPQQAO+V2HQXWV7a8LlDgVbv4F2Bi1s5lvvWOsdtE5x8nqdXIVcGN7bruWNGd+BwW78gHI2oLgxYOlGbBGIcevFEQlily9X4Jmw7jTMoJi0nRkuLG2gVUgOrfPbO2pGrWPAQk161ka8q9okKTYoKha9jQcDJuCG4yBiuIMTlFAIPAaKRI8+7jrEKbJHKBM4G/8L8Do0in3W33eMCAmZC6AJgMNkQAgb3hwSLUFKT3tX+OuECPwxDVgodWy7ew11f948p/EjCDN1mNi8PtOPAmpEtA3su6ewdg+Pmpp20C2Hy6UcRjL8jEZDz9LUI8dLl369ga9p9NYIo5Mg8II1p2TfLj3PGVLH32t0XMMPh160HpQzz4odutc4tYMwer/Z2DZ9WHfouU/dC76i6w1MBm2G8GzwBhj/GtPg8TR2nARIawR7o22MaBHOLQz8CG1/4xLZB9twG1pZmeQvHNzMxWbLCECIxSJsDm3HSjDIKiXWfuNLOJoilH4HbWXETlSYIfDGxY1GXhCVGecw9sHwg4VaCn/KP+y+ANLBQUp0cfeCSuB7kdRxHKFuPKLczUBLSsaUWJ6rRsRNLG3oG2PQamHdB+PrzwFFwSOZJOxKMLhktjrDrotMO1BDpsB6pmUoqMWUhGlGP6bY0ItUswK4mWotvtWKBJYwJ9muAWjTAyB2nA7SZtPNbcuM0LlVKRgUMs2CBrA6qtdbw/yYJSFt0/ywMu89ya9z2klHlNik2D0DfSqeiPVn6ESZzgxRMBpzpmXHLCAdB4zuqJIXM5Cad/ylkdodr79PfNsitR9Sk5c1lHpmUbNzZ3mRw2mGT2FBuWWSGSYB+8TbLrP11JNU6LM2HH0AFXbhBhtTtPkLphKZmPoYGcdhEQ6TX9tqit/A0vxmOMDFyVTSYwgvhRq2aMK0oi9YJTsVCWBc3axJ/80IbNzYGrRceDYELUHH/hdF7fOK/Ei+/e4V2SfffvudDF4flLxvREMhzMbOy1eygTiIzyQY+FI6athMI5PsD1KlR95Pcb+P3pqOUQW9ghBsr/H2RGNvb0KYbAljXLByc1uxwPsFQ6oNq2xKEazxEKMxLQNOh7WukGLPSbEJf3A7HnCKjmlA+9qrKnlZyVIHvLJmxAkJSvQATNwFcNcoaQiX7fUqMUfwlJmguPQvYen3voOVf/myShrf7VT097ZFG1eXp6/IVLgCqRnTfIHoZhwYbWVkAWtURTwrFWQceXZAarsV8YQSDjIuJuIll4pUcrlkyLiY0rVAkdzBAQYwClLw1RkqM3p2KvK5lpC0sKh6su1mdMyWaAkpU/mrRXUzd9KBJBl7RPDEPcHTWHsRs9TGIYTNGVcAv9dA97IwW61k7NP5GEJmXAsNpUh34WkN7JnCR1NF6XpSJwEmbi2nbZjnvUzZTEXWUbqMwlVE4Z6ZbVATMzcEEzePTO6rpMtX4hq9v3WMZuK0o9HkwfgSkznfZTlHFPaLCxJeKa0/UZm/kdnWmR2Zsz07mx6mRlUm8BjUa8yQYgakCR9/B2C6Q91BNGySFy9sZOKbrh92bdiieeWbtoFS6kQB+C1apYppvCB9h8+JfuYN8AgKVyZbubVbe3chFUYwQE5031wvURqMZqR3l9MLg8DzcqMC2QhN9+NwqM26ABGV5jK1I5Q3BFRZb9OKhFDSnfktGbfecEIq8QpwQXKxYx91DX2wwyjsPLqmptZpZNYdb2C7Oris8BZMJ1NO+99/r4IFZc+qzJ1ZEpbCLNQ8BWcC5ri13Xo4VGEjqvBxLWKNr4eR5cURfKCeVNXmvMlzNQiUI0Otzv12zZwFRDjixQExM2K5EAjlJqFBsDgJNj3tJMBOZq4h5gtJjZKax+MUj3n3fFnQpYcGJsN/goFhrxS113NVAn8jFVqN8UdSO1WwrwJNCumpaolJJ2U6YQtQEvWJMlGapOQQ2E2afbDbtP/ePm3ixik5blJ2AhZu+Y4dac/t6mFVIUolQa7s6EEY32r1LgGGXX/T3al9f/0i/fIH+QMfku8v6lVFqT63K801cOPQe/ADo3vJz4ZQlBmI9fGw+8Ag8uzfpP4HSkm9ssbYyRp9M2LyVQiIsj/7E/gDEo2PaVsVflGyF9vACGSbpkoVBOhg90dF2VeqSqV62N29Tv80roENYi6AES7zc9E6XtlCyFXn5N2iJvdGI0y7i70eMW+mJfk4XXM/TpUykqBM1R54YnbUcxVx77FhRyfQQRNvH5a4y+hEHTTbSKug06Kq5V2WjDGKgpgu81uezmB8MaPxxQyHYIH91DJwo/CPuUnAZ1UpB0ZiDsQiCD7RQaJ+d2fq98OB7Vr0gTV1oce1RFNtaGWWWZrGCksjsTZr9M3am8vzXzjJ640HFXcACh3WGoF8WHe4xKQA1M0g5czKBlA+h75vzPQ98BiVfeYDtD4MkiNZRvV/Jr2/jj7fTKevr9cFul0QNohddgwt33TO27pvBCHVshp0ZXhdPgeop4HZdZk4dFVcxsHJIjN5bNnfOLZE1YP+uu2SN5tnu5a/lWaUSkJPqbTDttHW2HK23Eh7k2TXMAOJzLOoQyNKeHMTpN2NbBeM9LKgNiswZiF8xPwt2ukkgEQDXmdnFsAwiFPqsJUd26XqspxkltE2q/qprO5cgiEzmQXxwEzwDssJsS9kr1GK6BJdkCdZg574Tc1yC2Zy/4p8/XWyKixNAm1mkntJm6BlJcYrXq/IBZbk7HTtjKx0XyZ7OXbDod0HaZUxTZhX4YNL6zt5Yk987C49wv9/zmP9nIfxMEt5sNw3fKaWdo1kxyTnPBY8QsCUezx/dEkmmp/7c5H3MXFhAZcD+AYuR5MhxL40UCPmfDduejTes/Ii87UBXxsASOisfZ34WQUHrPBqjilvfXpf6xn6WlVwtsDXwgMz/GWZWfSxyDTrkJBpb+ZqqBuHkOs7CBt4Il/cr5Cpb2GlS6o0NnI1yBP4Gk/hTXwRc0/+B+09m6Fo76V2PNO1aNLz2vTTrTv5a8z7f5txTwu5ZloqUy7kZuuFJsSwLGrtk26yk6+rxBwa7mChLaAj75634THYtEpCG4vSsYzVMcKIUUE0fjDouc5jRVhudMRAS2qOkpeCCjLJceJBcpzITDSvIxJAy1cKyWqK8uKX1l0JThUtu98HSW4KOPxaWJpszMt707IseMc4JeRRi1f1CBiEb9g5+JeoyFqYdpGNqLzEfNzgTFnsXIaREcXh2iqYD1NXFE1Jq7VQfeOkHExWz3E/SpU4B+iOMfgHO+CSMSipiUULu5Y3AB4WdREJBgbPjpO596WGhW0RNiyZlfxAdtnOYI3gv2FCOn1OYzSpaQcmdZPeO9e5oeWOZdMNJCt2WFmbJy22W6gNLdw/EM2G5ZXg893nq05cGoE4maxarcPearLBN6Zjgz+UVOmoIxoOayhz8wqW2Lbq9y/VihxEOhjdYL3X822f9nocSG4CwXhe2TunQnfsMKKuNmH1SPsZ+NNCTW+6ny9ytyBY2f0+OTJc3NacB5gOcSlTOqpYNDIYYLSU6Z+PmUoLuzkPxCSVRrz4ezYRSwPIYIkjuGHsbpD0Yl4ODs1oAObcTiaTD9PptBegHtjYQ51ZNEY/O2FKVhgLmCWrddE61jKarkLa55fk9PyqfYzrxbfcSi+KbaO7ZTU1i3FJiudMAQYSFbg4+CN9RCX2BlRIOrZaauC94cSUD91dY6iongdxyIU6T5JmRKigloEwtniK+nQOfAIaKEiedB6PowTuVmeNiZKvgZJvPplbz/n+mQibAQfSZs954ubNn5c86ZnuhqQFd91kXXLEfTrm05UVpPwyQnC3ik2Jdti8mjTNfy3oRFlhlzB0EWdN2OUHzB2WSiamDid177voLFh2oF6jOuz1Oo9gFUd7jV4vqeq/8MY06Ayp4/R697v6DlhdbAmxBSGyhOS8Cb6qNdeDGfAWbvLN8QYee0wSduxZhZBoMpWZeoa7btHQDGw/8oIzGhlol4RXDJeBKGREC6+eLGmZg5zPkBZebTzpimnnOdNuQPsOt/j6YRjS0a3zeL2//9YzrPd2NLwwgsg2HFYXrIRs1XXTC6hSkdomyUTP0Q3jLmUtCYu5FOmtc/0C3oU6zmLh4xFz0YAkaow0RVeqRBG4byxhWyV7leZGuOhH3NdBnq0NIBzLSOFYv8d+gcYm2gC/D3i/g0a1tNi51nJNJ7boVchrtEkNHJOMg0L+JEANeIvRpVc76vxGam3v8tGnrXmMvAGJOqMC4meqPf8AhgoYha2nDmYuN6BqEeLu00JUEodR+USoLC+djpEHXMXrdSxpzW6QlQnECpmjUqXcE+nlNnEmQ8N0vzQ5MY/0BPmXPqh2NnyBGMQTWZd4Dmn6Mwl/MN2Y3hrre7FrCSIcwWW7lBUZzlAH/3FBv5j5Rp+CB69FpvBL5lhUDCIBPPBhT6SpPvWG3eMEZVpgA/gR+yRz/XHBY5mIg+TytrTUwZzYFK3otyQUWzQTiw6F2D4Vd4QyHtKA2iFh7EtOzNIzMvK8QVYUjnCISwtHUolYZEGSPlkcMq1kV2jB4mX2EcN30QWdCG49r7mN/mqZIJ/HNZG4JU/jkpSQM75eA9cb0fSSUq4QkR/YspPa9NS2cGDbnR3Y7uYObEGR2D+wPF3as6pkjyW/ssCXeG5nm675SaVaDvvlJ5ol9gBPhCyswLM0Y5Gq14UOsw0iCityEPM7ap4KWaG35Xs1c4oq27aFfSuwf8LU/MmDeB+ePCCiVeL57P/CiA8whEelOYMhNYVh7ESig97iRfK58N+VUwy2JJXNziXvymfyQJDvkktOsMneYkx1ZMAasCUtNG6Wj0vYm577kD//TDnO7k8W52UYFV99ypVNXAp+SH6XXACrNJ/ixHC6aEqaMucEMZD864HS1+4EUrb2LbrkWrywAqHEzbqV0sn2THpxTmcl1+d9ZvHID4lzh9PzxZhdxyuqnGnRT2TjPt1RRDALK5H/VxZPZHW/iLX9IlZWYJ94eVTmTti8MIrZXYwn+aIoAqu7vExKZnVnFVFBUg8F2ivoNq6fHSg4p1LKModgmQNWQTVdYZ3LWmWBNc7v7eVWc4kvKRVtoRrBEEcKbEM7O7erbJeM2H9QAvnH4+RwfqaX+0ddMPw/QHU7lg==', 'base64'), '2026-10-18T12:47:10.000+00:00');");
 
 	// Helper functions for KVM
 	duk_peval_string_noresult(ctx, "addCompressedModule('kvm-helper', Buffer.from('eJztWm1v2zYQ/h4g/4F1i1JCbLmt96Xy3KHLS9uhToc6WQOkWaZItE1UpjyJsp2l3m/fkXqlXhJ5SdcPsxDENnn33JF395A0vbuzuzMOmc2px9CE8NOA+IGm7+7c7O4geBaWj3wStBFtozBEA3Sz7kc9PvkzpD7RcAgqnYAEAUAEWDf2Q98njGsprBbq6EaggHrYR2sdECKMsecjjSLKRK8etcWGxUPHSJv7ng3Yxty1OIjP0KMBwkvKei9wjHpOL4xRZP6dAybippA6YEsFS6S5xQkaANBr8HBBMPr6FZX69j3GiM2JIw2F4XnJlUHqCvqp7ImZ8+Qi9Sv1aZ1MQuUoBbRLWbjC5WkRMQnm1pJZVy64iviUBobrTSg7pQ4Er5+JZhOcKuhZbw4zcQSGmUpmvg8QC11XV8UL2uKp1kb5tr6qlQtQcV58wkNfZE8oRiSb756qXNparustiXP67kAk3nliWc4et3x+MIRmjONmG5KXI3D4cmatZLRq0lsUCXUgOcZ0ounG8PWZgjC1grPF+CqP4NKrzpgyh/igDv0/U2b51xpegVzHDxnWiwhvmDcjcSY1QZoI+cTJMtz7lUOawMhpcUG4DHE2tptDrED4B5yVuYyGPwH9y+HoLUxaLjT9rAhARFQa96/hvxq9X0Yfjo255Qckkloj2+L2FGl/6SXZc1FjSTYJ3Eevfd+6NmggX7WctF6jnS/NXLfhEjbhU5Fxz8plGY0wSU/4tDDEDOV40IoYK0pry5BzFXyifKrhTidnZ4B1PebJfG02nh8jmLuUaxhwzp9fCKim03WfKcvV8G3zVlKvrbQ8pWUxURJpQX0eWu7BUE2jAmM9XJBSe/UhEguUtC0GKq2pETHm3jweUHHGco6nykBQ2diDJYUwyhBz73Q+J/6+BSHXy+O0oR3hNwdDbJZJvsAwwliOEVUyUdZQ8Vz5xPrSL1p6f3ZwWGNKsE/BREY0DeHPjvbr4AUzVcFHJHQnvkPGVujyh56lfzX2+49IZkq8t0oyWq6+v0WJG49FW8BCV73fEj3oVbIQ1m8WBKcL0QGSGp1Eo18hBnXNrBm5a1WNxTThWwWMPaWu82tUuXko2X4ZlzSu0vTmYiKEErDn9ZyYCpYxEhN0Au2BcXL4cdhGhC1MEH37bnSy/+H45OOH9ybCFCLukyuPT7HgywoznPgzWAZdsKPgkxWxj6gLrnavKOsGU9xOXMrWyORJQIB4HC/kBgQLOxa3QCfjKFukh1ibPZcYlI2955oNjDDiPmWwKSkyUxGXMmPpUw4OBSHCaC+L0B7Cn1lpDqt1k+0L6jD08iXqWBIqSVpAQk8bY5EV5Z9Z9L9eZWlRfggyWlEi3SqqmZMrFOIGpDaXE/VFtf66VFJQpGpBjcL53PO5Vq6pBLs28wVLiIVun7vo6dN0/whviwwkTikJp+j19Z5bNiuPDi50QYrOPCeE7CEr4XiQbMlUUfXEJ62kBwoBU08PsElpcloQIHAouJClmR6dTBS3i9SMaKWN5MEM6nCUHCagIqAzlY0kQP8YEhnkZHqKjEz7E4Ixm9FQrKeXar3Av+nWqjDgirNNPiGiY01dEJfWtWsxRwwprAtkLCNOgH5IFCaJDrvxIMdiZFBbAQ9G18wGGiLc7k6cWdcOA+7NDGCSMdZv53rJaLfQbiXLnWN4uShWq9RM+C3gfrzLUZrraU+edoXWHtBsjvQqOC9FTImmBcFCVcNHX9HEJ3P0KZrTQ5lhA2gFQ/gzkBLCf2D4aC2/oM6ReI9bd5vDNyUyqxCC1jiUg+f9hgpQhxoDcfbj8VF/bw92Jw0Vm3okk0h7wv7u/v64Gy83HE7ZBOYZ6w0RJkF4pXVRt41arTZ6wvSmw8tZVyPS1ZsjbDBUeKId+hPWRk44m12Dy6rl1ibOR/5LoPMXF4NBa2zBAtTawPmN/UdZFj3bzNP1RtLRdrO5SlP0pnJzKHeeDLWJH601TrYWNSVbu68QNFpkKwP4Zqbp8munZ8VKqFjlMpaWOXDn91+J3bvpu/c/5+/elsBvkUNbAt8S+JbAvw+BJ5v8WFfZ6Ys3KSc6NBDJGWdqxUZfjKBwGLj9Buce2/6aCXjg5SML23+whCjGct97EAe1gu5jlSFkfLtVbZNW9anhVbH58oXsqPgWo9qT1mxRA1FpsKICanBrKyaTr62aiq8l77Mb2aZVg7Tq1eRV7wESq1eTWb3vmlrqBUgaC8LuJsRHW0b8RqlblaWV6bxlxC0jftu02jKi+l3wwbCGDTfmt9wFN4ZerFf8UGrT5C5g9gqgaR/O7YXFi3oNgQa1TG7DsYUT9drFrLrcbKt6dXc15i23OAUIcUsQmOnP4wq96X2Lmb0tiMSXK2b+lw8FEWVFM9WPBVH1zGAWPheEleXUVD9Wu3AwNLO3SnLCX3SPdvMgscv9QJA6+QSS13Bo3TiQkjo2illVQNSh/gNJWmX1', 'base64'), '2022-12-13T10:41:20.000-08:00');");
@@ -2601,14 +2601,14 @@ void ILibDuktape_Polyfills_JS_Init(duk_context *ctx)
 	duk_peval_string_noresult(ctx, "addCompressedModule('linux-cpuflags', Buffer.from('eJytXHtz4kiS/3scMd+hjrhb4xnbGLAx3b2OCyEJW9s81JKM8TyCkKEAdQuJlYQf09v72S+zqgQl7JY0s+foaAMl/ZSV78xKXPvpQA3XL5G3WCakcVZ/R4wgoT5Rw2gdRm7ihcHBQc+b0iCmM7IJZjQiyZISZe1O4ZdYOSYjGsVwLWmcnpEqXlARS5WjDwcv4Yas3BcShAnZxBQAvJjMPZ8S+jyl64R4AZmGq7XvucGUkicvWbKHCIjTg3sBED4kLlzrwtVreDeXryJucnBA4GeZJOv3tdrT09Opy6g8DaNFzedXxbWeoeoDWz8BSg8ObgOfxjGJ6D83XgQbfHgh7hromLoPQJ3vPpEwIu4iorCWhEjnU+QlXrA4JnE4T57ciB7MvDiJvIdNkmFQShXsVL4AWOQGpKLYxLArpKPYhn18cGc4N8Nbh9wplqUMHEO3ydAi6nCgGY4xHMC7LlEG9+SjMdCOCQX2wEPo8zpC2oFAD1lHZ6cHNqWZh89DTky8plNv7k1hR8Fi4y4oWYSPNApgI2RNo5UXo/BiIG124HsrL2GCj19v5/Tgp9qPBz8ePLoRma43kzl1k01EyRX5+u0DLtR+4gp0MqNzL4ANq+YtEVfFx/jO0IhPH0HFzp7P+E+dVHVtfHRMnsJoRs4IPkICPx23W5Ourji3lj7pmrc//PDDFamSs5+ajZ/J2dEHAs8cBg+hCzfDcu7to76eub3Obx95UbJxfdIPZ5Tozwlsle0/D0rLIjU4kkYfNosF8rUkjGlncZocx0Qh2d4fpclxbDWDc85xHG8FOIm7WoNJb0AyUS5K37YyKBccBfnin9ipFll0ASoNFp+/MyW7s5bY2fIlBvvyiTKbMQUuucG+moW7FKSBhYOiEXVJp18AC/0JOqI8KHXczkC1OZTaN8fqzXUbzBwMdjMtxFFMQ5Vx3mWVEZdz77d1U6ajLrTRvrf1gaNbNXwxNpx8tjiWJWMIPezTVRi9EOdlTYkFRk/LCu06w+W6rI7XfvgActMD5hzzZaVkUM7fkpUSwbuETpkDyRVXfziS0S5ScQ1HsqhiUl37m5h0cWE6PYYXw77Bown4haMCZXUyFLekfSuJcN/EKdw5mHOzJQMJNW22Th68hMByAf8HGTKEZppROAVTAW8e08gDGQSb1UOBKau9bu/WvpHRhH6KldJqrtkyTQ2hpZVZEle4vwMHExbIUFFNQwYRaoofk0fPJeB48jWqP84QIfSyv/ET8HAzQCjpRrpjW7aXhlBN+FgZ6bXu2LKdoQWByjo/Hdp4cS7auN/PkCVUsxJD4lN0Y0O+sbW7sZF/p633uvZgODSluy+3d1dYwI2pPydxEIbrXKibjM43hLLdgM+ITpxlRN0ZBrJ8sWaiTkNoWCVZVYiyScIVJBJTMvVDsPdpGCRR6OfiGUrrXMJrivBuKCetc7LeWkGuBXV0kv4AEKQTpNkgEFiF3po0YNvqwP6+yM6MJS9KXyuVurRF6iKSlnq+yO5tVen1+Mbqe64eV9DTW3qBo09jRV225b5JVMhyi9zSYCzf3BBs1Z/pFN2a5sXFLr0/1seODJKacF8jsAj5aGn7mwxNRwK6eMsESQhxfOX9ITLRPMjrjqlc67ZMW2pO69ma1hcPFXLdIWvw5flAlgZZlCnjCMPiC7n39voZDgvx9ELQNJZVVp/bLVDiY9I6Z5Eg3qyhwEryo1JTGwzvkO1b4NQikOuwGj6V5TuD2plFfd8sONjWDpzIDeIVTdyS1tBuSdbQyOeyrg5HunXPNtWQs3h8BJRYEZ1idfJCVsi4XKYPB9fW7eAHCaq+Y3y0Ccg6fII4Wcb19CzHkPxGY8ugHaAFgAmzFA8z6bk7lTzHkFVlOw71vGDzvOXeCspKVjYyBjW3lHTfTE9ZtMM9NTPsgTL9+Xu29hbQx5aUHjZl9qD6fGxBQQ4pABR9mK3ilflw6r1ljCdQo0p4DZk0BRGqVxzqKB8LMlzl1oJM0UJuN/e4rdIgcTcRgeW3EN+S38c0p2/K9U+lQoZrkFUYHEMet/TDAAJJLsxlBuZiC8Pvzg89zcy9re29ZjP/vvMMDy539+XTqg4HtqMMHCz+MggikuPHEH+/QGGfsKYJk3ZCIjfJt6tbM7MR4cxsCDZfaBSAyYNpseYBMOQ23y8qlpMhrZ46MP/JfYm3QJjFRaQKV+dLWbHUm4mpW93+cJDFFZrN21dSbQHZsgm22i+Snd6xpT2ndZQJzsiL6Yn+CBpJOi52wWwX+y0FmVHHsbP0Cc3ugGOdLtG/TmmJvFkkCM0GkPZDSttOt+OXGEppH72mocBzNlAfxOvUL+WAsgIzi3oho1LWKvhzsJZuTq6HQ00GFTYAS2TlTSGBQ5cOPhB08on6BR65qw9UEZUlyPaWTn4BkAscBQv3/oD4zq4uylknJoTVrONJEyr0jMp0ulltfBcbdiYLIH06XbqBF6/ys6yh2ZN0KE2znCUluATJaJfUu0fZojWX1N6dcp/Vo235VREmdIJtQFTOtBeXW3Y4Q3PYG17fSzJKEzmMvkm4Dv1w8UIoVJhlUwtgOMi+Zyidni7BNndOyIvJlyB8CrCH+kAhwPteccqKzm1ovvJtacWGn89CkDh2lWMgHLVVhVcgtnx6ee6SwbzYsWDpxiK7ketjL2E1VR4s5Gkaawntg7fSbBu4OaO8LwTXVNsEEsGCqAbqONHUfhbwcqeqKyyATwK0qnLlkcKcJ/6XxUw7DSc2MhC4EM2wuw1BAxIWL2BpOKgYnT24WMthzeH5XvICPhvBahwSyviCDUlindjNnbGkiW0q1uBwJ1W7ycVaqIUfIccdTLqW/imbVNR32Cherotz7PrTYPqyy+H+Uuta3bau86M1ZHVN7h3O06yOlSiBVyG2rZ8U5Ahqr3/b+6R9khDqDGG7Ur6h4+h2Wmefp2kcIInSpGxPp3+nGI6M0uQ7WoErhpsrBGK0AaVcjV2YVjwFrSY1daHnaRrHek3xZLr2sbnRO/nnxvW9uQcCqs49H8IUnR2Vpnm07SOdp/kdtjxSbX/kBwGi7MwPontILYZku3MMF2iPdFzKe+q2k8G5ZDh6sMSzMEg21mBzdkLzOzkOdpMkkDYDgcATrdixBhNIQV1mgxJmFPQd3xGIzacrTMj9EnoKnk2mpM61XIUCDKIJAQvKJUHrXMs3cwW3wdFA7ipknNtc6CuZh3O17m4wa2Oecu2/nLizWcHpQL0lg3CtFocD9VantJmNHdOSgbgu2xAEiOPGXyC39MIIXWgf3HZhc8KEMCCjcc3F1LbGGaOmPtkDpKJ+qsnktEPjWif6zDtxzUDsaGsFpwaamuU7Vz/Ng+Q5AbrwpBhyKkQucJDnk7qMwzUQm6KwwL3k+Wl+r42BNCSQxpkE0khB8k1h3Ngd7ZynTW8A4Z/nO8XhqKPLd3IdZB+X1hxzaKoDVjedbwM0V0OxUhYIg6KmK1rPGMAbo8+T3vM3cynqznw8neGlWG4OoduyuNPsCT4un9qyZp8MIrIk3gTkPcDa2Nadzqg2vsZf5bGH9iv0XU3NljIMpKwHPMNMA4+6h3b+5kcZv58mTsrskTvsEeg8+NqyxxH1VkbPRBVS58dFXROL9kc+W1HUu7SUgZaRbppSiaWyOnNzD6ncyLCHWV1JkyhrV/q7ZIlnBY9emnSyJGpkKDXWD6qJLk6phErNNtQvCpQHtEPI90LuQ1WiYFEh1uCapFVR9TnGpCA/KeV4E30gITZ3iBMacNBUU3KxVOvedGTa0j4Q1M8VYNsJsmEavayhGKo+sxcF1DHELHWXO0xGXRa2DJ2KqjdkKvf1WGVQi8hdL18gHVmga3jMd5sIiWRKqGlVDWU63FyGLvMmPYG+SBMIfhI76+Ep0o0bL1NyCmCypKQNIlgoR8f2aO8i0xASdEBOlSzCFbap+zyz8Aq8JgACRdsG88V+ZwjWM4QxY+pjQku3lSNUfHPfXcTvv3scBeWIMKFWfnNFuemyQwtBDmnJrWZcrdnwHzpFHw8xCnvxkCBNevq1ot5zrrXkfrMxJy+QlbCjxd3JIlbuj5Bt5wvCHqEgsmQKYdh0ih2P7fiOmC8oqNJ5bM8CNt+o0Ulxy0u12m9sWkRVWET2NRvMlxcyUOm83ufFnlEyIDfw1tidKqxQbP1c2UcUzohlQUp+JmPYSs+4Hti2Lm8unbvxYpDcAt06XFC8O3b+ZFp6V3fUGwmuLR8/gdOe02S6/DOhfnS3v8V0DMcGxYg97DPdhdEXNwo3Qb6mGdgCzoKl7seQguef6AKPh+YrRGESO6Mejcvv1/5oDLDozkKm5sAWa7ZzbZRHvNOcVyQKa7hzQRazcFEiJezdvd6oUN4emy29o+wXVBhQtBexDeq48300objnJAQf4gYzqHEUtfw2HTY+loUUqszOOoU98WJlm7wVtLI03dD4zNwOVGjfAAzCmBXWYc5ro087vEAW51QHjL4vGX3BRofmkJ3UZ0GFijjbBu8uP01DiTsvqEB1q6s61kTF3GuHnB7ZYaQC0czDaMXGeKdi3rBkFzlFH3QkbqYFyqDzn0B3zDcYIvRJcxOXPOAsyDr0IF+kpURvsnHLLOBlOl+yoxPt5iRm05fTEtOXKQt6PVXmgXCRPTdOSI8FfK6l/wFHWEduvJ2TwV20tkVhOlrCunY7flRFO29cE3fLtnckjdBsnkFvXUiMWKqSX7UYg+um1Ee8lJMQC5W/uddFLG3wTKsnXeW2l8HOHBNyzZ+7mMAVuCTV7EiGeilnIZiVMe2XRd8Jwzi/16m/gdhM552amEjr1vU9U4pJx1DsUg1UVXEmveY+bJqQ8E6M74dT7u0cOl0G3B/0Ctp6iNvYx70ogZtfMqia+Qa9rdSlQFIBrp4bqWiXpb3ZAoKNwQh7XBMbNKynSwogzFSfz6FQ98CaXoi4lvztb2zuD1/rV/ltppu7iWk7iqPLutXe6cPN3YlpF55ZmNZQhTe61lHUjxKQdBaJLbmuOHYxMlMn329M6/t6VZemhkTOLAaE9YCVjMX+zniFKSzpI58IYJOyfD7WiEMRTcvUWZbumEPsT0mcTBOaSoVc04BGbOY8gciF2f0KdGAhzqPCCBvk0wRb927k4XBD0fCReBqerEkPbG4fiDz6f3qYMXD03sQ0jYG8t3PZA+0me40ARwxQJoMSw71oNvvmuB2MzjWbfJIhX5nYpq5OIA71JKJ3syyY0WyvwJNd/PYJOx8oELRtd7R9ioUxIltZcvOYzkR0XtZuHJebTOwor3SznZmC7wAznrxZspR9VK6W2B3Y3ti+k+X2bsuCruf7BK7BHthUtMrjJw+S5YIevq2P9kltvDZNYZPYSyx/HHVrY/1idiSKpVEBI5jxZrwYPzEjOvPSaiaKsHVRxlb5Qyx70r3DHVxuU4advd7G4ADgEjLbRBhTI8hL8Dsocy9a8QNl1/cLuITaxTtynXtTse2JBqVop6dnnylOGytbJfmeFp3mVy72RO1eC+3c8e484xBwdafoXBo4ts5vLszykSH7cufnN/uCsSh+V2ya8JO/aZkyn0s9C956E/wNqefKwQHofeRLcSQXLIDjvJXzveeEBadGv2B/bg++nQqVzYLGvOPlrjyI0mfP9UtS/YUG+d3SXt3pQrzSIajL8nyXAuM6m0ASDQG4FJJK0WMvlCJkZTfKQNW1jC42z7KHtswAdg3xrBWLBh6bDyWiNS5adu38ys4E33yjaEPhltpysszDCVxC7KU7E6O83z0FH/SNHefbrxPjtKMG1+UX6j19bFrG0DKce4mmhozV9enz9qgzPyGWOxHtTELMkLbdOSnZyN2maWj7gOdvbVOKwvkH1KN+n0/yZ0DTwGti+yoi4iIcdhrxV7ktIn1gjvYBd+F2TAOydiNXTCaQxYYW1hXORNnfdxppv89Ilx3QnoAlg5iwz5jPh7fYsJvMu9mdC4mqJWZna4IfZY+iRv27lOX4mPb+sB48adRnUYV1DsHfpFezgykxGpl91l8b9Ll8f0aqemc76vMu3yzsa7ujpH3Td5miVuuypWNyZ6WvLO16+xl/lSlziw54Fe0ft7YjP0uad3JnnzdxglGLRamz52Ynv1fSN+o7ub6TjbAOircAp7l+3YYu2Xa46cmlyTvZILcjOOx0Rfe9QnesjMaNfbC0Xw5L5TsFXUim9bFqOoPJcNC7l/i4M0P8YvEM02nWJQIj36xnLv9CN4QmoPS5fSm+zV7cw+3r5j7haSK82dqN+C4yfkMHOQEuCueZi5gC4nvFFGGWDQh2/5n4dKtv74MLS9yGPpz07Q9HdqcGGZzdKS8FUYTv4e/67+ygCAvqnbMuOVVkOf19rUuLVyndYl1glxGKR0m8csitwT69hk1HaVlD5FNop6NXRd2lX3RrOOmqkFhr9k7/pKr0FxqFJNwkTBFVm5V3+FLLH1bom+NXNJ5naiNJr8p1vS0Nwss+5sWWneEmmlIx+gMikjpBJWsvsN2LeqO7/4TW1rJPYJl0MXcrC6Z9kpxjGglTJO0TqWrhBkJg7dPGRRNxA7CL6Eg+8ymavbB1/ZXmtlOHj4vlv1OuvZZY2g7S1DETPKSAf+bIqK/su5u06Nx3N2JIC/IY7EWUY67Bhu520PUsezHSLsBf8iG8fjqEp8xmf6KVy7+wPDTlILc9d9guluax2rvr7HMkbZHCUmkc0d/JUHXxdneHf9+jmJtmVwbbU3ozPR4txtEtGWdP5fXndRiggMHRoT5ZdOrh9Lib/30MjqxqMnI7iwweee6DPyUaLROtoJqZDIx9UaRfN7pR6jX4r3HRyhy/lpys4tR27iRqt1+eFNR27ki185LQ2h2mdH/B8PkzRiw5fbc/KJU+BZar9Ua7hvsQw2E9GiyS5dH+VsTfVVl6/gwQxR+lqR6yDyZivP/w6JRCUtD1fFipPXhBLV4eHpNfD+HX70cfgFa8+jROZhAt4FcESIeHH0jm4zCoHmI2AzfONwFna3V6RL6yP83D7vr5ikxPk9BOMHZVYUffMuBecIp/CYdWK+DSSQ2JqwGXvGAekn8BK+lanP78iwDY4W+/BYfk8N+H8NZ9+kJOuv8mh18haYdcak4qwLTDyq+VD9hirXpX9Q/e368G3ZP6h59/9pCoeO17SfW/vWOCPdljUnlfAYKer/jn+Nmvjd+PcZQE0vcKwcUU+n/ir5VjUvX+66r+v5VjuBEX8TGf4TGf/371DM/4jM/Y3fDbb/y/96SOt36WbuXP+PXz7x8I+ba95Vsl8/Z3ePvtt8PfAvrsJbDvDN9oFOVwX+Lxk+slOgBUj9jf1fHmpCo04HQNWRueM5ErEK2PbYTDox8Pvv7I/vpREr3wF+I9/qzC2canoDe8ELsi/7CHg1OoKmNa3VeXUxD4qnqET8Vbv/FfU5wEINXno2JssCE/e7M3r2aveo0yfPgMlnHKCzLwmhCWkpe9u0C0fD0GsXxFSWzo+8xfIfomUQ3/qB/TLV++R+c35O7/Ad07ZDo=', 'base64'));");
 	duk_peval_string_noresult(ctx, "addCompressedModule('linux-acpi', Buffer.from('eJx9VVFvm0gQfkfiP8z5Bago5Ny3WHlwHJ8OXWWfQnJV1VbVGga8F7zL7S6xLSv//WYBO7h1ui8G9ttvvvlmZh2/c52ZrPeKl2sD46vxFSTCYAUzqWqpmOFSuI7rfOQZCo05NCJHBWaNMK1ZRj/9Tgj/oNKEhnF0Bb4FjPqtUTBxnb1sYMP2IKSBRiMxcA0FrxBwl2FtgAvI5KauOBMZwpabdRul54hc53PPIFeGEZgRvKa3YggDZqxaoLU2pr6O4+12G7FWaSRVGVcdTscfk9l8kc7fk1p74lFUqDUo/K/hitJc7YHVJCZjK5JYsS1IBaxUSHtGWrFbxQ0XZQhaFmbLFLpOzrVRfNWYM5+O0ijfIYCcYgJG0xSSdAS30zRJQ9f5lDz8uXx8gE/T+/vp4iGZp7C8h9lycZc8JMsFvf0B08Vn+CtZ3IWA5BJFwV2trHqSyK2DmJNdKeJZ+EJ2cnSNGS94RkmJsmElQimfUQnKBWpUG65tFTWJy12n4htu2ibQP2dEQd7F1jzXKRqRWRRUXDS77yyruR+4zqErha119H25+hczk9zBDXgt7L2FeZMO0zvve/iMwmgviOb2YU7xDaooY1XlW54QjGow6A7ZFWUKmcEW7XstZdBzdhGjHAsu8G8lKT2z71lGuqmpwakSoxAO8MyqBq9fVRRWAe6oXjrdi8z34memYtWI2EbIIy2zJzReAC/HYLxomaMTb6/x8Cq18yGjAglDLpyCCcvU5zGTQmDrpX+Ampn1NbwRO4QNGpYzw67PDIWXEE718AdODZSc1FAYz1J4wzPZuhFPwTn6h8N2kSpYVSRGTy5vNqumKKhnbkA0VfUGyMgnaibCtFEjI1MaEVH6QaSplamkX8WpoMPFC7pl2rNRhaKk6+LmBn4PqJZtYo3Qa16YPpcJvPySoUZ88gP4jVrTsxSvym/bh6hQcnMCy9oPLlNiRZN2gCHwIs4Oo2+z5/Yq6eDBz7ALptvVmU7iuoNf+LejV3DRKrtaUxSaCDf8OCe28QXbUN93jF+uvtF47Wv6MEy73xzTprfGHbUqdWr+SP8TH8a3cz8Ij9Nz4dCHtw69Ds5w/WDVGebsZThKNi1rBn3qEUTzYq+ljcybCmmO7URawwRuz66oyf8tuBKP', 'base64'));"); 
 #endif
-	char* _servicemanager = ILibMemory_Allocate(35773, 0, NULL, NULL);
-	memcpy_s(_servicemanager + 0, 35772, "eJztff1b27iy8O/nec7/oM27ZxO2IQmB9rTQbJ8QAg3lq4SPftDlOokJLo6daycE2uX+7a9GH7Zsy7acBGh38b1nS2xpNBqNZkaj0aj8+7//1bCHt47RvxyhamXpJWpZI91EDdsZ2o42Mmzr3//69792jK5uuXoPja2e7qDRpY7qQ62L/2FfiuhEd1xcGlVLFVSAAjn2Kbew9u9/3dpjNNBukWWP0NjVMQTDRReGqSP9pqsPR8iwUNceDE1Ds7o6mhijS9IKg1H6978+Mgh2Z6ThwhouPsS/LsRiSBsBtgg/l6PRcLVcnkwmJY1gWrKdftmk5dzyTqvR3Gs3FzG2UOPYMnXXRY7+v2PDwd3s3CJtiJHpah2MoqlNkO0gre/o+NvIBmQnjjEyrH4RufbFaKI5+r//1TPckWN0xqMAnThquL9iAUwpzUK5ehu12jm0Xm+32sV//+u0dfR2//gIndYPD+t7R61mG+0fosb+3kbrqLW/h39tovreR/SutbdRRDqmEm5Fvxk6gD1G0QAK6j1MrrauB5q/sCk67lDvGhdGF3fK6o+1vo769rXuWLgvaKg7A8OFUXQxcr1//8s0BsaIMIEb7RFu5Pfyv/91rTlo6Ni4oo5qnIKFPHuVh8GHIu6tO9IHvXPd7WpDKGmNTXMNaH8xtrrQBLrQDHPs6HXy68gGRuzrTkEjvxf+/a/vdGQBmqOP1ugvF7NK99IvBO9YQXh6+oU2Nker/puuhhHN7+3vNfPCW3gw0FplLfiu4+ja1Vq4drt5eIIZ6Pyw2T6qHx7JAC0pATpsru/vS+tXE+rf0X9wsbFjFfA/QOS7AC31m5GDabKJZ9ieNtALMNUOtNGlT0bjAk/T26GOZ5D/FdVqKA9MavXzUWIC5Uf2FR58PH68TsnFLDcq5M/O8gulr7ZhFfJl/Bd7WyYMIAKwMDprfJbCM7kEMVAowAcMlzZQGtrDwgLFJwCCdhqR0gtBeuimq0dwZkTysLX0CRBkwat5J6da2x47XRndOAKJtENvPPqgVYFUBGh0tPD8HWIRsmmbeI65hQvyb7BZIF3PHIwcTCI8t7p4wpeGpjbC83pAWp4Y1nIVGoaRwI1i0ntkDg6cB50NEgHLaUmmM6AtzFBhlNjomLrVH13+UYnyCKtboP9SIBgpVs+9NC5GhQWMHi3wjPXpWajAgjjkwKlQumRgEXSzf1FQ7f8Ceo0qC+g7VhUWFtZjfY2zCgf7iyevLlzMtPoNltBu+9bqkgYXoG6wxOCqZzh+AQ/gXWRINcfV27pzjYVlG8vQsUtpFxzRr5hU3+8E0ru0xtHt0JsLpQ3d0S8KlSJaWShhoXiimazC15LhEl4lsnXDMbAgB9oXRCi/ocpNhT5VwqPCTwHOO6wDdDMdxlIQxpIIo32Jmbh3QEcnAUi1EgCCfwpA9idWOoSlIISlAARQHDCNcVfiQSxVAiDgpwdiohmjt4Y1Co1A4QX6HY8BGYeRvT6+uMDaaaGEBXPvGLe5XN1pFnwgjjaBcQ8PY2FJHQjVbajgA4vON6JHvOF4HtIkX0suwyGPjYij1t5x8/ygia2Jva28ioLyAL+IB3xQP25PCfW/KVA3soFbiQd3eLy3lxm9ajw8oven6/RyEtT9g+mALiUDPUgm5Z0vgEBUOrbp1rtglmNDNcS+1SxzQALs85c13/4oRAokTfEI70cbKA3H7mXBs8+A5w/3d873mkfr2GKub2wEbIms9Q+bu/snzZlANPfq6zuzgdhotQMw7tToWXkZlNwvQbkpt31QP6zvNt7W97agYeU2IxonW5tYBEBryjW4jFNHUaIGMqGIVwBvj4829k/3spBlJUiWlUxtTtNgRGtnahALkAyNRbV7lsbe1g838Oq3eXC4v9naaWZmuZVg6ysZx3P/tHnYPGnuHWVo8mWwyZfZmmw32228tI909GtpaESk73/VpS9fp3z1lhvEjpaZzia2jW/yvmXqGbHn4yFWI87ofEsfMVv2CDwiBfnasIvXCD3RCUBenLM2iX2td8FgxevCjmGV3ct8EX3O43++iAKR1ML6C69SHPwPmKP5/FrwtY2XmT1tpGEAHraFLhAePEuk1rMa6mIqtcmKrACElTZij0eyRuD1/BoxrBI4jPRCzrCwTTcykYlXGugvhEHkz6w8yv9PHv/SJldocRP+zueS4eS/51MK4LdDjNToAuW+59aQQnHMDwWjtrRmvN7bXHv2zFhQqaSCB3yo0bXmr0YRVu7FXBF3UAU+fKiyylDz89KXIjFtijmkDsKFqjV33MFj5oGpFOkylr9YWGS/CfzP3Sp+s6TeBEHRq1p0GJZldSwdWPLQep+rX2q1nDO2wDGXe5Nj9mtuNcfMudyaKlpGr5ZTYwAEsq7QrdWqSkMPo69YzqMPITWmDsYq0wDynuD/4eqqte4Uy/GJ8h/37Iz+ZxV9x/8lQ0F+8fdF+AsjAS/5u7tcEc+b2tKbHB4ezNdFwm2YAYqAshKuSohyLO/SRzN3h6WKfmOMziyJIIH1bRN/LIifmFtVdEjAM3Ju/R+CvIeHFt9u7++ViLujEBaqInzB89LVwGXLF7MhwEI5rsKYh1P46mso7ld+0lDz0lCUoqCjFhfByVlj/hP8k8yHGpNKWF/1HX2ISvz7P1ibZZBkMlnD/8LiJShJENdV9I8VNcn3iNLk8eQJmlqgEONY/L9YQ7mnORPDklnKfX2032ZboA8kewJiIea7XD5cjq2riIyAl9nkxOT8GneYi4EDx+6NuyO+DUynf/475TP0axVNw0Tlsqy7S5XSq3wcsyFHm6xGqFTC3RoUvG2pUh7PLd7ZVYE21OPPdniAPBga29XCdYAqSORmXLQE29aaox/ZsLfCAXkvC9eaKedLD29tAm5qvp8E5QPbcOgNLmYKmKNV8gLXW2ObGNqEDqdjT1Ah37LwZ7x2xAhgoTHSHWFVKTbs6uYFLDAj3RTaClDZw5htDhWR628TiYXYZhE0wLaK0B+ogn77DTorvFkIVgsRBx5ogMgCvLyl8PgO0RpBw/sGgL1PUThAJxe9Ro44wMS6v4sr/EewsKRs6CepJnQZD6LfXRFUJQoqXPd1TFWKMtnqDOMGYJSl3hqVdPC3v/+uYzF6AAtTtgNJtU4RAjYcoxeVaoA0LVnSrZ57auC1E2y7AcL0vbfdWKJrLxAtlSJ/x/q6iEK0FWczYLDK8OiatquHZ+tdEZ2Pjd4qwzIwPZO3+BiKz2CrEP+X7D/jH1jk4yK4F7GztlxG6zpWCjqa6GzWGRYJjRjZEx1PC1Mf5V2kW+OB7oAXXjNN8plAJtvBbhEiLPAU1AFJ29LRpeYiDQ1AlYFxZWod3YxOPVJXVCKkU+AA4vuStFfhOQDhHwUOALAlgNLnH6EgKfsZ/vtFGGiPTnEbrCLec1J+/ElTgtJyc1OGEei+UsSmCMphLgrxlkBB/CsnmspnpbyvLJlZiaeIhleauddX+u0fO8AJr8vw5xmYmbSMBqto1CGlynRmiZ87xGjsks/iV6qNu2QNHaOQg72TrhVF7ojRtGTv3w+0SGEzeECXshiQZIZjwRW8QFCyCB888fJigQVhsC+SnsCz3/mqd0elnn5hWDo2Z4a6M7oFqVlEeaxQNRczzndQvWMmkeRckQaK9kIAlcArsQ2EdwP5k66hfDKzARIsBwTtc5HOjIAdDc+Vyw1NH9jY8uWRH0sQaBH4BCEX9EW9r1swTLhDANOXrAtob/8Ibe4f722ETBLhTz+KR8Irs9A1JN+jtFUYf2VmxuuBgKKSl0oAwJ97EJ7ioypIY+vMXahKW4oKWGBjqk5/Fnka7ViibBUfbsHFyNqk6hJ9fBezjE7i/x6d5MLs8gbAC/UTxYFb9mQFNqRBWoycsQ5iWAPTNYBCkksgCSfDckfYstJ7G9jGCqImGkfgtCKWkYfxQgnzaVh8R/yTNzcq/oSSNhye2s4V5ogN3GZ3ZDu34kJQ8rmQvB6c42xXmd33N5sTZi+BNN30DVNzXjO5j+2IQvnsrPxruXiWO8sVYVLzGX6BwENXZm8Tp3rK1JYMScysjiy946RAgIvXIty5Y3dJCHeIK/nrJ26chRuxSOo72qDu9PFazxq5D6xXUpgtg94QGSdJ6J47Y6s+2rG1Xtgakhgy6VZQjPWDV9inOrLYcQu2SiZnRgw4moDq45G92IbQBFgrsw2IIqxrbYccU7CxGd0f4xU67jG6xMYtnNoYDE0dRgl8a7hqXt72PVlcWSyt+7ew7sWyOuSskTQLynHsP409pWhHpcwDTLLjIWbyhubqdOWaOzo8bkpbDS+wFhTnDeE4CEHOOm0yzBrjgvqsqbEWs+ZIWG8EHN/+RIelXv34aP+cHnaBhd5Gc7e+t8FexFFdYnrCE1zgZURNRCRDu1OOWu78SteHddO41nPZpR1SHrgnkaMgcmQS5x0fnkS9GxA4VS5waOkU0RJAl0THYIlVq53lekZ3hAF8DzTXo2oevlHouAI7Y0MEHV4D4SUKKQTLISIK/yDBmLQU/U6KXllLXi8F/PFr0tKVVaVted+p5MTvcXWyTZWpZ2xDgTbSpRgQMpd5P6401nPAHL9E32mLZ7n6zmn9Y/sst3YHzT6U0M4qnIHH8Aw9aG2IhjB9UxgbeOg0l3JxskFsD+l5yBo5EQkyo7cWLdW1BwPNCn8hZ+6IcMUNol/o3hkM/5iGevJPxDcWrRrcZPY3HguwI7pUYeedUuUUww03mDPJkl2IRyRbuXnPKCZuL5iUgubHvPDrMjBCtBRMCLbfu7R2J7CCZKx8OpLurxIa3IUKhgY0qjpitiwIPRl5laWwT5e8TxfaHRoTw+mTy4d7ns8x+pxRAvmyajQYYj2CxUyttgwjzagnAwGfPerBVLo78ygoE9sSPSfXrdn72x8bxGcKdAQ37g/d8chcmVGdFjlv/ugLWDaACovCqCzhws47o/nXX54ABMkEUj5dlHAZ7W3DxwnrMI7TTOyMCkHcXgjpAcMFu5acR/LGhb8D2RGvATJJcBnypISodQihAVLwnHMU5UMWdhfAmb18WKQXSOxGIrK7ehDPXf2hUawJ56SNXhK2JqxxBGzhdzK2QvSMJ18g/GDR1Wn6BCxf2vh7xLaBivSAbVCXS4plsjOIDAefzHwNjvjVpFTvAtF+qRFp8ttviPwImyMxdeHhm5DiNgIajLFZgleiWDYhx7ZH0kVf8qbnVEaDRyIY5pggoQIeyRgjjPUfKE74BP8k/+LfU1Bk36K+r2sWW2dfoF2tu98uUvJ0dEIacHERViZleVAu1qq2mPgDcpPgb/in1tVVqMlJSEgU32P1XikZfgmITGPfdDB9sKbQhqJl88NbFg9hTGSOYJ+b9SIYnTAgfLTA3MyHnfLYHDxj9mAGF3hY0I+tsKinb9KFPR9zSawjEekqAn1qhaGmCTC4dczl4O+u0V3WeeoCX7SrxYxdS8VEjUpGSolMopBuCBBxx7IiYLFGBBmEnuk3RPqx8SXSjoq/R5ZAoCNkhIiGvqYAYsA8woG1zn8EmTcDQHgwXSEdV4dyTnLZAIeB2Zot7IA/8f5fNXwNyx1fXBhdA3ZytC4I3eQ6XI3u6XrPxc3r1xoc4MUrzmsspfu6m0+gX0xH5unb5rG/8xjMrzBD6DwoYsOgO4YsERMdYQZEmglxorc8VpXmfGPTJ8PIy2SL+PwDh34uBmhhCrE4VwGjKgtU5cA850iQtRVxS+LU9FGMxzVeR7VUGXQqxkyzTh/d5xUwJhPg3J8pO1fIZFHoMZSa4TOd5znJOGbzkfugZbZxjGkMz8yLKBXUwu7i2XCcRnwmosnswgxY3clYTGmNQfb5xSUGeZG+wlAz8qdaQ0ztWyOHPwQfEPdqqDlJ4mr/EV4EYDAxFvk0IH+pRdwvYoh7Q7MgBy0dJiFenTpKNPwNUqqSlUXPHkCmWXqYDSoxB5QMqxBSvrMnuWnm5ZI2EWyENOAtViMu/QdxTCQL12xLfkqF6GbQXBb67sgeBuegPXyagj/cFMSDFJyBDzT/vHbVpx/pNhtCLyaIHNNtOJp7qffysCSXfQ8cJJRwHjyCdyPqwygiRyNEGV1qlJWHsA1kjMgCTwOTnRBtAhmYjVHehM38K928xTxKZlm0PYKn4Puaw+bcfQkgeB7cOxpo9KE8pIFG5SITM65MYiaYVimxNgl7pIx5RDHKXt3TTt4cI1yUpWaaFI89zioLnUgwM4U4m/Qi8aoxPiRi5un3HfX0EeTJx5If1vRFQQk8zUmluAu/sMp8g0ddsnr8JnL1G6zU6KqwHOQWkmA7z1dlBWEi4jrwazWN8xe8Y5MC1Pnz3RNnxUr7K6N7RSXB4lV4g+yeRL6XMMQVpb7/9rGPCs0599Vs4z5tQ6rHj4J5tPIxR38SsmjFFMJvtZoXplcvJp1jwo0qgqQA6xCbvI5Bao6jZa++DtUbuHo5a31rPGB9akDsMr1MoOifuFKH5KcNwzBJ3jDFiqrExw89avhn6Rk/8lUu5nIM6c/GF2VckZhN7D8uS0O4QLKHYf7JFZEHUxXknUK5uHRgfunsB9L4JSJWPvZUWkwaGy97l7/ap+umXc3S4P4YP1sXtT3peQ8SBp5nRRcHtCy3rGITgNFLJvjJDkEGEtBbu6L0O9/SLd0xurua415qZoCwdMo79s0tV+lbu6WGo2sjfU+DiwsO4FshX+9da0NjuVrqmXEAWLVdfXRp9wr5/aFutRus73W1Ok3M6ix5okvvqmjenGZojlZVrPF+rDu3gYsxmjfZazZs68LoK/YvWrGqWLNBczizump1yLFEVkO1GUhsxKq8xTreVGyK/spG/8alZvX1IDUUq27opu41p1albppwzlivW72WZYwMbEh+09tGTxVXvXt1BDJsVx90sAVyaQzVam46uteMrHg1ed7R21AS51011OKWPtrR3FHTcWxH1qzh1nsDI3AKm72CNFZRa2rvqD7GkLHEjcqIE80xSJbTF2EBK9QSM4QTwd2yRi8Lz4vouSzIiGAC95NpI9txtxx7PIw0e2AbcLWKNEhJ451je64xTgE6VnFcURDQL6JqES3j/z1fWSmiSuT/JQgvlE40UxZjGbOqGhCminSTXzwmM65DHZExaEGOHEvhvlBkzcYiG4Mwb53Wjk//7rk9+YiQHXrF/W6ha2wGFRK6krK6ZQqb4BGj072obWp+bnpJ48TzWeK3hCUITW7ElK8N6w3N6V7S87z5mxcr4R11uR/2xQrqGCN0alg9eyLZvPcYALMLmw9tzLzQyEqmXFf03AQzMnTr+nOedxTyPxVuXr5YyH/By/XUIqvxReQL7DvJwVSGUAKktRhK1YfDCBcEX+Cyy9V4qmZtGp4gN4X4ycu7xzSVyE9yWTvQIOkeuSkvk9DrdTJXuSTqnVehUy1osxXgIoki8v9bWcKLQPLHinzjr3M70l2IJNF7mXBh1q97SEYgY2VHdzGZ3wa6k1qxXBbbDVIhpNqqL6pLKytStMdddj2YUFtqwxYotanKYNdzLAt/V5ZFOhdFQhYj1CkGukyryMdjOGIygTFI6dzFP2U9+YbLCI36V72JFZPv+ogKQQz1dXDnSwejxMtHKaTMcKWbXbIxitoe7rfw4MxjOHi7+K9vcxuQDjY3rtiQLL8AlyhcY8WGKdwLv/AzuD2OD+YiKvhf/uNVXhD+ls4SuK8PCfde8cfLyGngr5U1/M/rSA+z8wMCj4WS8UNcA2TjmLbJ2jIwYbx+Fv0/45y/gRsMxedrSbzQ0+8JJxY3IkqnRk+vHh9tvpQC6RkuXoHf7kVhMUCZIbqEHXnuYMkVjQyOwCLYEH0hPXBOh5fe7PM1xRwSRV1kvcemRpy/hLYT8IxEjSiJuvPfFkLJOCVa0HDJMaJaYL0ikTGCeJCqP09C0Ky939EEjwfdVYr6RZm8zKR6kvSd1zgGyqbL3LUw+2Opgv8oMKq9Ia+qFWyOETkkiwChrRK7vxaKTejaY7NHQhBsjAZqB1xYMfm7LyX4M1eAJ2mFcZJ1w8ee9LdSZR+rFbGPtB4I6IWk3mVcfXmi8TvyfHKrEZccv10iL1uusOl37nYHGA7tc/wsPXe9CXKZUIp48RhTJRQLeO/Ij7TC1UDp8AXPQnEmOCM3JfMnNmPNCSQXyVMBly9KzHx4vse8hyc185AHJP4TPDGz9Dw6Tb33wmIqLiMIf2gdyvUydyID6sXPeD4DAaW0NoiQGyUgLpptsfo4rRU/WCJTb9wR/I+Kt2CvkpwK4pMyfvCwm7MlWtIdpXYs4RAIPMkHQTIhiArfEbmXBsuO4713e3AzYnpm2QT84o59yECmzEQvQ+n6rSx3cEo/5zkZHb0v7k1MDGsRvwK3zm1sHi3+BPKzTtE+PN5d9X3K4+/0W/Lj7bvmxxKkojR36RocU639sX3U3D07a4wdR7dGng9+dHbGlxRwxTfbOKVGRv68JdB6VvaUJICdqd+oQMKOHoYnpcMVg6oq/9IMuzNwYDAvb5D9PI4A//mu3SOn1AtxhWfiGMYsrQE2LQ600WXi8S/F4xQJzCIhS8x1I0zzU9Vdonc3Q04QLtGyuBYZ3fRr2MjHFGvCH82BMRrB6X08npLlRBACwYXcthH0nWUWYTwjoWd6/fYbU6jYZJteookqU7KWCjSZxZiIh4WxVYLjm5heRfmxcfGJm93J4wNhKf+XLwaGK2VIpXlZps8T6WX9YXEwhHeHyclXFPrNkB0Pe/QGc/+0PnkzFRsyM+tCM8yxo9e7NNZ4JpWqdXnAfKJtG2yyxGrx3Oi/o5cLUfd26CmXES7+O1h79kWh3TivN45a+3sp2knmYFLACM9QKLkscyVlpBI8HDrzLv3+Mnx5Mdma9CzmAG5HNt+KS8D7s/GlBHdnLRA6YlJ59OFfsiK58gzwjNyyHEQ0BaOebmq3cSMbRpIUTrUN0jmSzo/eZgCrBP5cqaTznog0Z0B2g/VmvbVzfNhkHWmn8IoUOd8tmJXWju7qowPdMewe7QTGrzc59N9Oj41sSQoS7SV6g6oraBUtVafmDX6l1xrg22Ufk1HlNYcUG6/Nrj28LUzbj+Uq9ONFEUnX30LXsq5gpeEl4SUspp8U8QXfNzaz4CGetUL+2AJWp1nERyhEp1IpdfEzhVGerINjMvJPodVmWdcRvcCtYALhvhZmgq0tRsimdQtcLx6C3oWE+o2eX/hc+ULu8YEfCXD4ZUckiJpdIZWj15VR8OSjd3lUzF2AwuiFow/DT/rAJ10UMiUD0AhPLuQD9zp4QZVniaxAIWDxMkwcFi/RHi1OL4sE0FOSQ5rQcAZjVLRB6foJ4j7YvenxucKlDlYBzXM4ddW8EZAsuEU0nG6wunTiwK5bANWU2TCkJzwFCzsWa3hYgqQCa216K7cLyWPy7ML5/Gq6zB2WzrFeLnhV0oQrPHE3mckROT9o7m3AgKphgw2roav3jgziUAcvRsnCWmEBLcJXmpPfGCTRnz8kJDgI8DWieyLplRXUFUUYriVyyKYswcsejwouZ8EioAyR1fCliAgXKiCe4uqCJ90bm6EThFD0QLACZTIAhocvKq8M0ywkrCyldYPMWX7X2tlR5FF4FOgIjxot4cnSbUD9ayE/ojyBgAtAcsISj3scwMLBfDLP/igUUZm9Pf1CG5sjhRmbjXe+p62J4Hlo9udDdWzpN0Os5fWetzsBZ7iYSJ7PvE0jfnwCq0SVF86eMLVpCorO0icwaweGqxd8iFqRXq5M1wUOCTPS1ryfEFTipNwPSDfoWCiHoPyVdGnIYZVoRRbijYqpNSt4AIDK7aQ0hSLamIys/djV/HIkGFwGCNdxbSuloOe2ZWu6wCmIyH4kj95aKnpo+gs58CcVaKMe7ix+XoyYL5AaC/KEweKjtudCJ6G3DCHLBZIEZAHBuhxPSmwjXSISF0dnJkXxR9jWxLyxZ08gaZ9//9VoPEQaAvHfQ+DB72jdK/jShfhzmiyCMKkicTzDJ2AUKQglUjtoVFVUq3HTBcwbOqPgzVtI+1/GlpSiDRYE9Ro9r1TYii7QAn6duJyLB/kH1I2DqQYUKkosOTZvmDEXgE79MOTl/B0S8HgZnCPCLGBVw2xNV8ApTJzVSGPzNZtpdl9ZJj3hke/SdDEw3VDAqSFIkyKaXOqWt66jVDXcVb+CSO8p+6PiekhR6KFEHrNsoUgZiCz2ZtpNCQV1M80TOEsnC+tRcU96oOfnV0QR3QJ5UbhyuQenIjwz8bUXaJjC1aQf987WyfwqST0zC8fSXc6ZjLWWcLEkx84eO65uXmPbFePHTrYUQW3TLNVDbWJhnc2zqrDsCEw2BnLzcjVPxoTALmKQXS9vL0n5pKdsaMQmXTiHrAvXevCo0QSjazh54kc9O6M5RJarZ2fdQY+4VSEvg/93vtzASLLMWbkI1+TQb4mf4y+ouy9mJ4a+b+aneDbhGVLWHyquWLTAekVhtcLaCEQHpBbHdp1VSJ0C/FGRXWmRXIpwCCxCW9ohLjfms6wlATWoEL5+aGZcyQDj4SqkxoTwh2re+fQqgIOWSqs7MdmILiQbETqRznJepAarOD9RDVPsf2HDiOvj8y7Z7NPON073Dzfi4/IjR7oCBIqGwbKT/oVLHsSb0GocaFAFCdUSDtNOlUg7ljbxVJkKu6TR5Ev4RIJKW415zaONk8ivEn2sILqvybEAORbC1rbkBC7s0L9Eq2jlZRFJyvhHhOg+ZMrsSYmOhMxZeTjfwsIbAe3UGUk3Z+TjzeNPiisJR7xm1wJkNwW8NgoeWV52KUPZqkJZeMTVCdyMDAlZhOt9FWW0igdaxG55BuwC1x7fE34rs+DXatfXYeU8R9ymCICg+Xhkn2B2s8CYUPhcVCS+XHpVjZtN5HyJlXICbMWPbopXC4lCskqkZLUYwrmIALcixyBV7KXtCvuRWsF2YoVAjPgTApRSdvKBcy7CYWLSY5yJlcQorCj2MbFdgZ4kLuDlbfqMEzlTKz6QyIuFaYKXEq2Rv1571Ib4RvxmHjGgcV1PGKZg/FWclqL/YqC/vyy+FImopmQoNvekP7KJqZhoOHJwFpu2WH6tovze/l5T4ewOfzJJVhUFlhVfHgh52KQa4Z5Qz6hPlVA/bK7v798HxuqbvVlR3j962zycM8Yp67YU9HT9Ck9SEr0L/gDJbItd7CQ0Hu8bizkKnlCRXusu08Zpd8lMc1o9epgZG849HqFAvYfkGLpQj+HB/vG9PoIcKpfRjmGNb4r81ktITbTe3siWYssvGxJxPmFjMuIa7qFtj4LLrQC9YtMFXmBEO25PdI2HGpcvMehmUH7/YM/VLVd68ipGTiudGVRxmp6f20OLtC7m8A4E2/lFkkMn7yFHMH8U87QmyowHyzUrbdTPqsmJuciveWWZX7270asYZnzmzSj02Cyc4hMe7FqEHux6bXpFNTZdSB6H1dRr4GJZRVnqRQiYOFmGF+1Z5spMOwzn54Y7vEibLV6Z5OmS6KRNMc8COdAu6Lwy3JHbvrW6eGbpo2556BI6LTrd/ALcWREsDtoLpqFYgUm0QPw2ZwqQcpzy89hbCxEz9Z5J/nikhtvU72X3TcErndDDpPGOdlp1bpFys8yoqVLHxHTVj/n6TrT8KjttSw4mrgZTsKE7aXh4rMOtiHKQ3gQr/ZzgcPslgdXHrlN2QZPQXPmY1++imWzgMS7SZozTLfXKnu2yIHEmxAx8QnfyePoJPZE0pHz+mIV2JPUCiAEZN01Zf+6lOwktZuqYMnLc9myHjU1yIR2xRe2xJd+al7SdxImeyy03Y06HxC09BUlPrzhhE2N26YvtbM+yTit7jzYdf+Zh20VgPaSNF2ncz7TON4Ijm+XI6QJp/0J9Rx+ic52cXqsxU/AM24JC7n7Uwcx4dpbDpiDM/87n6pdaLfex2c4B0tRoJD/XQNyeJd8aIUdayYTkT2xyd8FWAAMy6EbHpqTo9f9BIjDZpHqaCPc8EZwuuRSJxND4TI65+dcK5uVoLInA2T7T/FMYPCkLTPQTRDL2dLfrGMPwYVPhtUwFxUyRe2L1B2fJtKtYnC67h4XIYKAVF8CLmzUId3qGGI8uYR6F74Qt8a8c5kRRQDuQx1QQ0dofSz4D449YYgPrUi8dX+ZXCDcr8bMiD6fwrdQkkrwDhko5xCr5/MRgKQyWCwm53Hn3smc4QZ5Tb0pyC1BCYcRvo8mRO2h+rUoun1Goniv/mpulfvkMPwijgKaC4d+CU4b6Warn7jIR9webknPJ9RVN9OWv5IKLSgj3JUtKckFkd6HUhWMO2TJloSypsmKFkCyFQuDwuzJZPCde8joqbQ//nv3bj+ybTtKPxL9S873VxHhD/4fK53DXpe6c5X4tAzbs1itWvlw8y53liljdYXToJ6E8fDwjBch3UTMyZSmFFik8f3+57+WKmbqJMXlk+4560mPzUNCjQSwb0yKaQ16KJ23rsyu7RTGgXf0dFsww3gdgwNC3VGZSZCSSuGMwjGcinrrj1+9gFNzhgSD5NjwzIT7QtYDh1moS/2dmsfbPFWmMR841p+9yRtk7rNWW4k0FeSMJtlhMBcTvQsTLh5NibhEbNQnWUDwQzAgneHUBYvhPsK1y5eg9hulQpkHf6wG0XzxsHhXZAmg6WL55+CuxUDFADHdaaHQuUxjTgIhej5heBxTW49F+Sv4J0GrpQWiVZInHtKLk8Mmg3FmW4gxGOTwx+jXeFZkgdBkGWIhn2daLWaxLUyx5Lx/URlZxqT7FiSQ0KnGZkn0ovZfVb0rckM2NTE7TzHMo3UlK9q4RvRbkyXLlMpBvDEWcQsi2dJbuJBwXtDxHy1Rl9BwqP+RbqTGiiKZd8e8UN3o/nPiZJe7GzyyTGE6Di5Ux9crRg9dDI/3UuHghA2RdxnWiETmJh8LSwlumjW7xsUOFxaX5xbxOpUJVtrH/AS6bDJIk86qGr1Fe8C2OEmxwoOxGYheubSfO20Ju6KLFIfoP/u8kR+Biu3Ma25WeZi9AxnaUFJMmqYzVoadN9w7/WBJ+ZsVjGvMd1Pdz2FIiS/ZVorT9zaQjTOfPQGf6CpYwRfQBv/yS87xeH8BWj+woLa1lX7jco2XgCbA4O3supq9apvsYORKI3CTKSiGlfRwu4XxqNCHBk4N6ntKOGsU0A0VY4M3TBTxPRfUPGJYUJWQP73ls4qdkKL8MS2DxNCnvY1ICrZ9m5Y8zLmmmoTN6pGkpSfzEXk0zNRPzPqVwALZRME1GuuNfM+29STRy/GKlseVeGhcjP/MSZhrIZp9sI6mmcWLAikKLyed8aHw0ybaJDilVwTV4bWiIwY7fIohNGfv38Qz+ELKST4CfRlo+LbbTJarzqDI1IMl8B5wgzR7Y6HHTvGSBEyP+lnfw9pDkNmgkCbk0YUAcW3gxy0JFSr+nrGihl6z+b78xSJ8rXzigqPOOxa3gOfprfrY0g0cYLF6qQmpBFleT7nY0UryGhByGRVJsu96VIOkx0uT6MOHqMAKDhaXM6W4wQmkAC5dgMfKyiJ7zC1Pru7VEemZoCR6SM+bFCu6R1yajBsovgN9EDQwFQRNxlC4ce1DAb4oo39Fc/cWK6iU3YcRI7zFcDMvj2LPPmFfPvihn9Ocwttv7eyXiZCmQV6r1udNDuVLKWYz05Aqkuc+JEv6+UkSSLNvW4obCLJsJ0VjLKU1z/o03uaKhN3kvGPrPszP390AATk5wyUIMTpZQaB4mGAFKo5392MM/c4XPJFAG/6f85dlCmUatRCIK5xeUT+8vcILzNWPkAedMKEmlRrnwZhV3xM19efZX7vOfuS+/5xaelftZYvzjwgnF4mrpL3qaMzGshOwXGY4fC8fpL7CBcHlgGi4W3eUdo+Nozm15R8M1L+l0djHj0rOta5FO8iZp+XqfXsckNit8KdATzJAQxOiln4AGQtCy0H2SBSCzxzmhcwQloW+SEY2+ynSIVoJEbFYUTKm39kDftE1s+yQWO8avAGVGm4UFmPBJffMortDHEFf6QyFnSRMSycyFI/HCmwFWY4xfvOKwMePhFG4RzhUX5CG/2Q7YF3nenSOSPom3KJv0LF1YTH9i+gQPvZcLCN1LupCLdD/lkL1hGaPgMfvv3GfhEQv0BB+Ygni+ewHt7R+hzf3jPbg0ICVcugTZNkHtydpN3r6a0/GnFKry556Pls4jJioA56GPlEoUPlgW3vqMjLNoWxBGPXf10TlZ/vI4X8QoRwKAMSYAIIfNbwsvDP7HjweHv5O3ymOQSt4KjqmEaAZDq7a0Zr3e21x79sxKjuCNhzNt+4juSFv/V/7z/5ETHJigIyw/9bTt5ESQ1/x8pFWkV0kqxQenYXmNLcO5oehe+lEJwFEYv/+4xBxkl2WmRyCnwL/WzBqLU3AvpwY1TRfTomzjWuNzqNtD3CAn80QhLj4G5LRsyQz2z3hYRl+elYsox44RTQlvWKOHbyDIYmVqKOIpyuFsUPhhyunBBM5DDqeBMiWbKJ/AzxA2Ao/yyfsyHLfPuIqCJyX17ZRHDvnzpOh/CEVP4qJz6gd6Ytr+UQRXd9ATRBeqPgdI0wCCOw4pHAyyWCm+XKjVcp5R9Ahmh9AzwOjlLMr2htkbAAhr79mtDQwIc37hBrPPG/z3KgY6iz0wrZ1CnVIYgZ9EvKeLwGmP1cLD7/HTrR676r2EReMckl0/5feZKb8PcfVisQtjS66K4iIaSIamEcgxDaVLm5iKaBbBHA+Tn4LP/Ul6SoTODOBm6R4KnilVlH+J8GD9cpJ6hjIZTLrgi6+beqYyufocqZl6vjIV2mPTkq45/iyVyaLjGnKLzwCNqiUMZVogKqoppvlZ83+lV5pFRcGDpcIvXvwpU1TleW5yUwRplIbUG0muOp7HBeSKu7spjaWtu9QDdfnzN1xrzQOOP0vCbu9g/slAqNI8l/HpI612SoI/T+MshaM+zn7w/UMOc7YQX/48DbYUjupghyIQH3K85QexxOT45Pw3uou5owuepJtc6BYk9DxuB5KWGA8JCdK2KafYpRT2cikeiRuQio2Uxe1N4uDKRxrjXUptrxDYAic4Qmhj5r7+9Vcy2wTb4egpNiXt8UzHkflGbwxab1BK62gVxZEi3V1dEnbfMQ4cBQU3RnSwZvdiJOX+g2Dew0Z80r/AaJGUUri65XQXnbGXVj+tfZKeflSiTc3P2k3q1rk2xhYvFXzQOTWI8DAqqN+8PAXmflv37l4Sn0d1D0kRiVWpyi4vKdjoToEnECLRhu54CHPVtZ3a2VmO/9IXaSQyuEsyLSyj+GRKMi0+adteNJFgBqB3C6q8rET62ZaIM92xID6Kc0797oUpgMPzgJN5nj7jCMzHFA6BMyZKuoI/GSWvRFRgncYSY7BbDANyImpW/3529hnLhrMphIPChfH8Sb/SQHwyUsEjd8BcEcykDAMwRfPwZN7dpQtIWDiOLVO/1s3p5XOGYYAn21DAMx96kGsU2bmo39HiQLvp6cPRJaqiRbgcE5lo0XT9fOKlUuxSMOeFs+UW/8BFedawaq2WS6om5A+DBdtUNy6ITwbCZyg6g7qd290OiupVQbmmQ5v+igfx+cF2QR9D++ApIBCsJF0wzm/ZEnMkxl+MRo6RUiEo3EjBR5xncIreScFKzP1qirus016B1dXk6pyoi+Vb9JguI2370nZGixs++VYlFAZZGS0oEhoXgX9Eqs2faFMIuyluHciAVEgaCbNI1f0x/xB7eH5k+ZaxnlwAXo6tq4gQhJfTCEJUkJC4lNkpBY/ihJ3O5M9gWfn3tAo+oQddWYQFUHQtIfVI6OfsNLTsIKSQG65ezC0ukltjkJ8grg4J4tYh3oM/RNYHQozXSeRaMF54nYr+KY27H2VhM4dBAC45h32yv+0oKBZTH6gMgzSLms63G4etg6OafziH3OJg6ha3cKpFpBXRWa585idH5LGy1WKlSPMY4L8XFtmf2mf8xxdyZFTt0hDxUTHnfzAzKMXIzFNGzivlCE1uVzE2L6YyovHJfJJdk6mE5xC2V2cE", 16000);
-	memcpy_s(_servicemanager + 16000, 19772, "OytayL+doEwvJ7hWCwROBcuCqJSDwuKBqQWGxddXDrSLBzF/MifeEKYMlN/r8pgkVg12i2k9oBsea1EB1lWi10Tc7Ydot8T9av7MulSZbqUx/ZplhtNB8DytUTKvUThpf+61yUx2qpDWJNkuZVYnFXn1qU3Lv5e9yBXAk70HJCLHFJ7Mvfj66Mku+7ubUGn1f0yvbDYDZUoTRzWhvvgoSK7s+lX9IET2DP7hR2G8n6wy9sBIAlM8wuYZqDeWaRyCN2RmAL0xicmrvc2MKv8H0OXxGWYz3OWS3MbMilvMmwK3ueho0SbXIsE/8C+zNf7jwvnKvc2ZV/HZE6nEw5tRj8whdVAC9FlHxrHtEWxJzggGj+EcoGTPa5QMbw6GjJeSCBlFpH6mMxEmNmMNbCnWarklsjdMxsAIXdCDCcpePbJByectmZuAFh7oN4DyKtGVs02seQvbGYys1MuHMpoJKtZXSC1mM7uyXuEpPlMYYIKv7hfD3dP2BAtqQc1192QSCbT1xuonsIuqwu3nRf/10t/XWnr4ns9/fUj4iXBTOelmzgCeWSTPlJIr+8lteO7fD15EgrhDb2CmkwSpsaDaQ21iQVy0WzpqHu5i5b1Kc/vOV94oSxRCx4eXJnlBmjhCeDZ3Sv9kMYF5LiJmPQKv2J2M815lhoYZIdvszHbaHp6nuZn40LlpDx91auJR/VvPzAxJCxR7cy8TM8AFWebldOkR4Mli67ND+L/9hu7F9wpXelmIzWLeebeIJjrqapZlj7x7ruCiG3ti8VTlaOzCUgfOYdEXReTaUG0wdkeQFJ7eVKaGBcgiiNjLeIGb+ED1qa5xE58prnSDdn/EyfoziXd45i3i4aEJHGYzwuCZLUaAS3w+kWYT+vD8WHv7CUogazIT/ih2cIoFWtoxaHW5P/1aCxa1wcUWfvP4Fl1mQ+z8Hr0557O7cyhdH3f1BUP9cxl5jxFF5R/mFqOlouIk++Hhn0ZS0v7fR/8e0NEFk3ZWo5xnB1ZiP4XRIPdqwi1PwoWa4CD/UQytqeyjx8j4kJ7GIrNtNu1BrznEbOJRAxdsJGAzV6Kb38TlzKMz/b3yM7JZHrNTfsbuoBM2uZHnrOYHUn+pneWWzoRD+r8uwZnTfKhN4TzqvYQ8wvNQUi+R4Hkg+A9kIMKjvAE5JwUee/fvk5h6bDEVw87xGU9SL8VUuegy2y2Wcpwzcz1wyLVmznTLZRQmwMP/TbnzMuPEJJmvZ1/sqa7WpljqwaWGwsIjxxYeuTkZNFNcFD5FU/A8htzIsrCMVL7/xWWgSWW5QG9RiJEF5OMPMP8p4SODoZ41HZ5sV90qTOO0JUX85/u6knrK6y6nQjQ9pS41OBPv9YTBxYNIrpavJODRs6emCbnTxe2Sntd4Y7g19IZOCfxNG/IrglfTrvCEJyUBr2l0yqzr7N8yzx7J8QD7ki2653HDTOBK0ozNT8/E8JAgxBR6jF3nsWkyBQozTG40wYJKp/4CigK9ypnslgH/PXv2eilZxnB3A1SfPoPxU3rMp/SY8UgI/j8yHWS+YTYzSjS6OX92hun71TYs+BN+iLbEjq319N6qZ0p8D2QL62CeW4MTpBC73a0trXVf17S1Z89I17BZ2vnchUBn3dI6pt7DBslfiL1C/J00g+DUCU6mNEfgmVumP5XGVPP8pSD8lOVvPln+plH9ylNJWQEqDgehl225tqmXDOvCXmJer/nhOdOyZI54/IBbVjLCJxgiD078+eIyz1Cq8LEool6ETIk14RD+mZC0ckOetHKGJIqPcBY3XZI/5TdMqPcgRzJ+NhUQk9hBgmsuA645jquXASLMd7Xg/hHLgMqcS6Vngms5kM3OdzbxXHaezylLpvTHD0TNJQnafxipf/i0BqIMfRKYTwLzIQRmE49/GzwxwcRCP8shufsTb/dMmKkPyMdkERBThs56oS+V2YtlmvH1ptrLFbXPS6pZIdPzKrBxWqSOb7Q4hqul/+NCjqQ5NCRmUpgGSNaz3j+mWrmnXDdPOoW3Flhb5yIOzKmEz5SXRs+pdU/07WqGhQ5aG6uh4Cu2jF1+uAnyOJkO7jldwdMcCrd2b5xcx1hf6zF8nDVp4j0de9cIjpBSlj+z8/CPe3A9+3mpxzgHm7ZFJZ5WyrJEuE/Xn+qpzuiR6aeBj8KTD7x4NPlnGvekI7lPox+FJxv9yDHFn4kB4k/X/YgWyw98gG7uwQsPwSHw3NvBpHnE3T7x4Iw8GImxVQqYyf3pe7niInD9EvMIw52CcecSfpst9DYJUtJ0+LtH1bIrhRPCactldODq457t4zfQ3csNcvlUghBQieC0u5pZBmjsLiu3LHZdyQuvEKkbDNlUbPOfKSIfOvZpnhGR2c8pfEZnZ6Mvv/sjFisycclgwUeSnCPndm57L1yAKhyBmtcOCRHT+vzTqX9W4vQ5JMS4fy+MKt/8swXCPUsEvDCExeuv2bIwSOaz2sCz5sL2kOBV/EXRbAVokx7PLSWN2lKEElBu02SqAiCmHwaBsXomAC3R7FXqNLJJCB4gQ/JTQ0aqVQo0j39iDjHt/v54NByP3FUEodxF1HU09/KQrvFXOZHx60mP1Eyb7/B4U4yZBYsDzdL6uoMnGfurRK2IAu9qUehkkWN9f46+uQgeTMAhpmci2/DVBxIWH4iuPYD+igzxjxBdUWnDCZw1I84jWwh8G+7KMM30jbsiyrdbW+Dqm1t4F7EXbuZjL8wvHdZ9pUEs/CKkQZyfkcTYGqSFwrAINUi/FKtQS0xt2BWF0pR6ZzhTasQp0iIO5xB+fY+xHU/C/e8j3Nl4xhuKiqGTBEb4EtQLzXR1epfC0xokNNZJ9wbl2KKB8QLwwa8RP4KQAGl2L4G6c/Qxom0e9yjJ0/r5oR1q/n2mk/TzA7MeIPixz1mpzY77v5Q5cM2gdMLxMRSNK74m/2lC7lRMmww2DA8ANe1+Ic9g54u8FTXBi6342E0PDujnzlj0qJnOYq2vBAv2IZMKpRlnGRD45w0pGFlDJJhR3OC6fKghxLM3Ia4T7CM1OIrTFx5PVDtjfY7pG+C5l6SXSv6lKeDCE5ScY8s0rCv17eIyiPksKTcUyQiPuieKPxm6ngGP0Fptbuzy0Oe+MvdjBu/dPYdw5He9aIgHi9yQVJHOy5geJORwyhuWO9JMU+9taCM9D2Ge15o5FuM8yeSEuDgyNb2MUiWsIHDHpQpAgi+ZUahwI5tTMWiL9hmup9YO5zT8b7iGyDRCTRrnZ40HuoNJwINexIO8fFfHrxPCmG3qjc0RbFh9/rIW/QxGS+xHZ2yNID8R7HaFWdudGCCLvEU7iyAKkVFCQppAD8vU8U1c+jwGm3cQkouxP712IKB34Y3sLVqlpOvrI0Y0eBvryU6YXRRTuFsgKc8fPISKpeHYvcQ6Qh91y1CplK4GkkKifAz4FQrTIJGKgjDG56yh8y2fdPAp1W5R64ZCzsRIN6KHb1M7FKgvP8CbiSis6tyJkh7yJu9NxPqYictipH5cFTqSF46ud9zYkYwwotNNmAsxPUytl4xiT3MmhqWE4Y7RcTTntryjYcnKVGg8UQNV2/Q8eDYIMsQjzm5IJQci2ECGRdtMl6xQ/gIvx1xxzUbUJG6x1zMcuvwHYJ8N6RKNt/oVWiWg1NWimkJIAQKPgoIItonSNQV6I32fUVcoIB/shIru4I/yiibTqo4of8quoZ4WyPh+/vqlyPBUTjGuehUANa1U4uzgUeyWYuNp0pc/mTQsf2DvilMPm2g999QYYXFADFClXB3w/DCLXQUW4W4t1sPPFWAa72anLItdeMA5yRTsZ695Xb8qLJArKr5kWN5O0WF4Qq3CKgJ0fSJWtFTGrsKT1l1y/wmJrMvYcXim6Dw8mThqDu3BE+o79VF6O4OpJMrKZfzJ4NYQH+pqGWbxtYjPlHSaAtmMVTIUz+qYUpf18MzfM3UvqkFx1cKfONWQJZMTPD+ldvA6SRUEJ90UCgLFygPxCFoZm7ZDCCj7QgNIpEI9f3i8t9fa28qv3Sfv/71YX21typ8nnvd5fmxdWfbEysbz/2BBmwJKzbOU4o/gTyrTKIU0KDDHrJlwFQc5Bd25kDbZj8KfOAmA54g7mseVF/M9cCYM4YWOSX0AaHqOkSKKTHLWDzzF53oGTW0eK3Rrtmu3MvoHQ69CPy9sBxEf0hX4kBit031X7OJwKPz56ouY0V9Q7aEvxM0l+1BYiOj60E9/O4biJ27BsL9ZDRoLT3ejJJswwS+hLRmhnyTcNeQaI7Gv1M8FneQOKn6dj3CDj/gp2DeA+wv/jJfjWBqJsOgbDE2EEA+gZ2CO1273yIVBPhThdRoo/pHRBULTRacce92yDkytq9MYDrp92dAsyx4hd6h3jYtb1LFxRRGIZvVQsHY+SokIhWFZjeXXcjUfv0sWoABT5wfceylQIfSJD1HYdxhhPZEsERg1wUxOGjf6ggmkXD7Hw4sW88kNhgieOg9l41eLkECIdCpL/dzGhYwTSqZu9UeXfyype5VlUIYJZ0iS8RehUPrJ0ZdIPfkevTrW5OS/LPwvWVDFzSl275KaYE3iPs9gnblzCbExHgZdezDULCJJfqlBB97IPpEwmvzCaiGPbQf8IyBxHm60Qh1i1IvvEUgbchnWG/ln2iu0ini/iPwYWzIhL5/pWbgnXTDT64kE4SdOD8+Kk2otKlPhHqCzM3L7Txl69F1Kyme1GNUnA0IuPvIxD100whVwi4JHfKgEHhH7t5aiHWoK2oHGUPTFLTVcZRG/wiahcxsZFEJQdoCu3hvgkVsQ1RzDHCKSNZenMily2C7SoEpedvylXEbrOkZbRxOdnvcvwl+WrvfQyMaUGt7iVnTUMSzNuYVX8Msx+pcjuEK1q4fxlI77tBqCq8IDx+472mDTNnu6I5XSbJ9QMkEyhODA2gSmWsK6JI4VMbPBdAaWC0oWEqR7lribnn4xZNJKKQGjOeOS7r9RxCUkvuaKaLriCzOoYDYOHX2oOTrlM1cq3ZQMMaZLI2c0BVl2Dqcg3ct6X7dG5JrNsS6Znkn4TqWkATOsUKTa/1nYUISUQRh36VI7Zg4FIwRAfEAoNwkRkKBSlHNMLB5qalo6GtlaigZSiD+jdkCCRAtiEWYJSY/kojBcUUyYpgYk1sLNat3ytGz437SAk5CmxW+yK1k5nP2hbrUbuzRPRb2wEKECycMWoD3RJlu7pQYWHSP9RHMMEnKVz4lIiFVwH3MkSnRi9HSaeCMaAgrtXOJ1pOktr/FQ3dyWQghWbiqVIvL/W6nKdDwFVDqB69ZrqCLqeN1xbMgUopODRx5kyUotSiz81P5A7eNGo9luJ1FqT/ASRCklimgVsgRX+ClAhcJB2FLQmE/qXZgQcA8ykHOzsrS5Gd8xWEWHvoZ5lYf9eJzAL3yV5hylilm4njIu6tRvn6JaXQOjqz4e2QNtZHRj1H5kCD1sMBSNV54yjC1wy6YE72RFH+nRMukR5sexZk7TnQGpOW1fWu36+k5zQ5n+KwTbDcMld6ROg2+P1Z0tFi/aBp0YzHo/jRFpl0EpE6pD5UdRnM5FFJhZ3sQBMbRUQX+RfypFkVD4UxEF1HRF/H+p4ArJLB9B03Y5fm8JdgxJLLe4aGsS0Ua6QmQbLb3qH8YloKqlLX20o7kjUrywAC1OJ/ziDTjRQ5yq4YmIc7sKos2HmiY2OVxG/Y2AXzqmGf76AGvnke60jW/SUycYVWwCkCLr44sLWEgRA60Qbau0oTv6RQEPtgx2aWRzAPJjf0BRkQXwgPc5DzRs68LoVzGrFtFSUdLPBZ+T1Fdu4uHWMbn9GJaqLrboBNqXSqWM3g7eGT6QF5phjh39kKfKYZ6Zv/5CMSX+iPQijo90PEMFqyumpTfoOdZ1aDWm3FoALog5Ataw0MAwTcPVMaF6rhwDrctzkMWw2TL6Hb1cWAvXTXowBsu/u5hn7ItCu3Febxy19vckw8ra9tluRWQyeoTyuGWNlqs7zcKSOg64fa/Zz5UvJUjqntb6SnLrZKAUMQg3T+qmtf/yfnq/pNb7percuh9uXqn3Sy/m1f1A81W13ldTWG/a3le93svnHpvF9bQpuFLJNPp85jUPT1qN5vlmvbVzfNhkSLUl8zCIh9p0/G+1kooVxqU3wTJKHx3ojmH3VlEVvbXHjkQUSVGQaCEQiS+xPKyuYGmYxrXLC2sYhS4DuoqW4xlBqiGzIrVcBaReKKnPMCKqyhN3OYjWzIrzOKA4N4N9nkp3ptiBYYBqZmOS/eZn/EhXu1kOlZJDMwO83mauBEfvl96Pdef2nQ5nS/ult++aH0uQ5MTc1bqXhqVDwsCP7aPm7tlZY+w4ujXCgzdybLOtj87OWM/cqOsT12vxhmIXGD4qxLsa8KIIaUipuwbFh40B5qcwU+63G0Uf4SwHaAs30xygpYb/jdIZ2siiLMITksbulWjnLX5Eef02XyRtjbGNDF+P7GP8F22UOVnh06KLF3MGORrGtkpgdbc/sXQHVnwFMQEW3QWMHBUOraBiDi9/l9AufiaK/u30uVguy96hTbwstOwJbEnlsfVrW+YtOEKv8QIKaRYaW/xAtwNtC/tUhkt+wZYM0oiLnX7ACw4bA5M2NrGt/Chp58sZW+SN1yyiSwu17pBVHSmP5QdVAKULxx4Ucpjpvivk4vWa5WFB+Vx02ySHZcYdT+jw/c73GpNEIbkFP59JvqO5+osVqYzJIhrVpsP+5tFp/bB5drZrdB3btS/wRDg1rJ49cb1JcoJlFu7L2dkx76l0imz47oy8v4EgBhnNJO3mj2kLiyYBU8Gx8sNgyqQOS4tg6RMEfxaAXVrtfZ4Bp+SawHeV4lIFTn+S/V+4eLdfzOVidUxAPY87eBV6qTs0/O6BO3nAWxcGw8coNpD/sQaDp0zLS3fJfhjWabojrN1Heg+MW4zrLmwUXZi27RRismrIJkIJ1iqojJYq1ZUZzZU59m3P3rV7xgVo4srN0g+E1qE+1AwnGS1x4tHozxoi+VwQUcp50W117ivSGt2Mzn7C+sHJ4H2l8kkuYmmqrQtfZy8uglXQ9h3ktZws/CAXa3zHiIn4dDs/Kc06L1Zgs5ksLqjhkpEij6VvWWnIbsjMn2v6hkSeDIwR6DYhsdv9JPVRiqELMo0khDgpSjMmMi4tyDDM6eXoGTaVOJgk45/azOlmf1BBEJ9NJFwkKV7D517W4hziNmaNmnnkYJnsTprQjtkmyfXRsIeGZIcTFjGDSCKQiGZPRLA0sHvhvfgB+qsWvlGt8XZ3f+Mc/6/ZLrXPWx+O24foL5RcZuvwILXM/tHbcLdCA3GJMczAg4PAQQ//z9joUH6yLOX0QDTeM+CuE4M+vevrvJBPx7YhTZNyiCgvfxcd8MBtOVE3k5gFReJ7ghDccJwQYSPJLnLKlXou5AOlEeCRmDSpUwFtYkqvtzfkq3GnG+HkLvG3E6WFtYOuDaTZgyJiFHZ1L0yt7+K+Tjp5+bYurslygf6/X1hm05ikn0JJdHC4f9LaaK4iaYxkev3D5vvj1iGuv9naaVKvVBvtNY9O9w/ftfa2FCBgpY0Lb6wi93I8wmrZSq1TQpxU7rjjnKVXsOLNsNS6sMFL68r22wXmFN+uUku4gW0LRzOZQbyg1qDTxcxT+/U7oHh3rhOneWqlodGD83+1XBlXLjtjS6qKwUmXikC40nn3smc4QfKJQXvxyYN5U0mIg8WkWT2MeGgGphOKVT3HYtKt5RYP0K/fGRnuCDcXZttXhxD/RYeE+LNrYhcv0NlZHB2kwZ64OM3JK9zdRcmVE8iVUydXKlFMW+udO93zLtnKQb/CKKZWWsWkk/EL4z7G/tHINaJthBg1kaLBQuv7+0esECHsx2abUHZvn/X9Ln1ejC3aMTLqKPfrUgKL6FZPGouaYFwoSWKpdUEBP6qFQbodY2UoqpjBPKxbrBMhMDVWJ3oe6pzy7XDNm6AnOmXOQUQtFCc3c7pkCWZc3Mp28KAw1qzBm+5ycxEcOXBx5DCD50iS3hzhcXZ73jSCFCt82Sk8qb+fraXlnviZLJWfzz75mRT//PVuQt/IzIqFLdVl56BadEcV+DlhCKyXo34eokx/Swfk23m9DMYe6IjBveiHv5lWSNMFqbBEh0L0areMfCUfqRkWziJsiXaDRzjwPaNNkynS4x6uqHjwKymiV1DknG53ZCJqMiLZ3jG/iSKXDDTx5om0CAtY5rP4pou2brk6jB/5vX+w58KLBUjtMK9xVzslJ+KjzirYluJ9AE5xDN1lAtQlWUrw1IWwASzK0MTAE6Dk4lkHFz9c6cgeXeoO+r3j9ookuYnfMagCd01ldhkqmpFKxchi1I0PQJrJlOXAYya9xPXujZHHI1kGiVcSzkMj99a9tO0req4jNo4DHmIVT+coYo1gEpBmys8ri2FaRK2E/IKStQaPq2qwBQrr3UsbLVoo1wakwCEoG6BVFKedA8DY4gDJbThK3libgEKKU/XwZOCzqYkdx4TSxROf8LDC9fgKYoZcmLeX2rUO856kEyTYIftadxyIV6JyN262o67twLVe5m1YRMQv1bKsCXyM8iJ7aTHc5Qr+jCS/w8dmO45N5AMbl0oiMY3RP9lNDgMXfB0sEzm1GEo1lKr/6DE6IH9sqjuOhzLD0YsqVJah0Q55eAHHhuUb8vl5gNcwCXJFrH7cbp7jdWpjo7akWIPMzdqr58rF9w9qFVXg9DoMNlCFBcVa3xXLwW8ymudwVpgGdljdOB9jfG1XH50TRkXco8fHQGFVKqj5JDUy57NV/EkIuEjrK57jQ21ioV+/Y4mgY41i9lYXlyp38MIY6NhMX10MuBxiD2rBEYC4UhDnVKmQbD15AO3oI+d2dbES52SFJybIQt6hLoTPZx37pNZJOS7Q44soSAhlxskr20FSUaHY6W4viZ9jXTVhMMSDkisFRJ6/zM2lRugneMsUyZ/qGYkRyrG+EQr00f0j8CT7SGK1TYyXJIVa6gz6M5MuyzRMoGN80oTsopkYIsLiPSHREC1Lt7NVS6fnauDPPd88q+D0uRxbV0pXWUtuGk2aE8Szy7esFa8dzXjd6HxuqErJHiv/kJwpIunanHuybuPNacOFbbjDBmR9hR2oBAMpISiGbMeDmed0F51xNCiGPwmzjm0IHjbiiwi4kjRVatYVVsQh9BL9AOHq2XeGZFC86IUsGylTNMBiHDKHEsSS/H4MY3gSeAEelpsGNWDXFTGQKQJCXNuMh7CucW2nluN/64vJESNpsHSW9ZMHkiySjbfkUA8gdS6V4e7r9lRMxD1bQseuqWuOOgE4c3W07lXfsceYkWECZiUjXW6O7OGMdJS2NBVxRfRmj4ySQe3pQ2Iuo6Rlc7gSmmgWnABM04qqiyavbJKLc57HCTDfHTlazwDaaSaiiirpYvZHlTOBqQFHNqlh0iuizhj/hldwItOwLnU4BGDeIiwRhrYz0nuoc4tae60jdp4TDcbuCCvSKx2qkc2W7Xa6jTcaDM+n8trRc3Dgs4vccBt+gm2UxpZ7aVxgpfD9+/e7u7vUiRxBMRQ2E/y+4KkcCt7XPNy9iqf+dUXhtlOhxZxnDq95ByrAam23to6ah7sBw5V4X4m96GBJc63XTXMH2yu6BccI8mBwghyhJa4M04QtzNAZVeIV9CAS3vDBKhnk0a1u2OwMUfIZyi0o77/eiUV1x1EqCmVIj8UysMocu1CQ9Yz29877mcsyNPlA8IYYZCTyhNKRX/7EGtfwgHy51NGFbZr2BHzk7Jw1FTQ8eqSFJo490kvoUCNbGKNLzYKtEaiANWJPx6KJzFGSopq8xTBGl/ivIq78FebyOsEUS4QuXmH3YFbjmkNHv4az3IbrjnW3pCSgRaLkW7fN648Dc7yzvGc3+va748peu32yfnxwMtROTfy/E/PT6cnVu2PzZP/9ye6r7uDVda+OyzXN5uGVuXt4VLnuDTZvd5a3lzrGq4+nm5cfTxvPJ9rp+3dHzVdvA2WqN9efbr0ybqfafdew9iofP2xX3jWu+vrE7re2zEFr0+3vnH7st4zD9+3jw6328c1my1jvtRofB62t0bCzNenvHNX7243Lrx8/vA+Vu+rvfl25/rR1Ut2pPl/CZf/bentofzpdeddq1DH8k6/a1sv+9tKe2bU+DT9Wj/sfT29uP51uXunt9dve6fOxdvrc2r6tP9v+2qJ13m6bvbcntx2jftMw6v1Pgyv8ft38WL28bjV6R72tzdveljn+dLv+7dOH7ap2umeu2I2BD2Md93XvstNY3zg6fv8K43v0fml7+3jzfV9fHr1/f7K9d7y89Ar371lrc2JsN28ODiufto+aJ92WUR9wnD803l+2+kCjm+uP1U231dzbO9xcXz9p9l9hWjB8fNgXjfXLXtXtby+7/c7Wyfjgw96ks2ViWr+f7OBvO426sXPbGu7frk+6mAd6jfVvvdPtb723LXt7o+624H9bN2Zn0Ktojf7VbuNqBHA+LR/a77Y2O/D3h/YV1H+1fUto8vVTo371vrLUPG5uHrfrGNe3e0utxtLXVqNF3uP+XDFe6h8YdWN7c337sAl9PTYIbU/37M5t3Tquntz2BubXT22ME6HvyRWn58V7+113+fC62+gPW29daHf4yVjvtBpNKd9g/CoaxhXgi+PGx6q19fwa911t7E9vvn16b293t8yrg/Z7u7W1d9lrBPvRaly9a5yaQV59i3Fs1G8PjFdXnz58vO5YJ25nw+33ti7NDoxpI4hbb+vVpJvIU3VSR6uabqdRH+0eHdM26lFYXj/f7lU6y+uTT6fvrdbGymC3b2/z/ijRZYLLY95vfNge4TEdtBrvDU8OtAmfD7T3w1cNa9vE43PZtfBAfXBxeWi3Tv6Fud6wKjB+l5iu3941zP82+iYbP4DZuhJg9j9g3BiNthsfcP82KhiBdcm8rw8xi25rePw9mmBehHFqbbSe7VQPzZ7xatw7vXE9fsDlG6d0brXMSyKXgEaAI5Fng+fDzqDrtt6u3+L5i/u0y8axhaeQaXbe7pkijO0lHwbu73WvujmkcqEL5TFtfHor1Tn9hPuE6YnlMp7v3z61MZ9tNA0sIzHuJp0XwGvv2d91DPfI/S/99mryDtrhtH9/9d99PH7dwUmo3qsJ9IGNl1+Ojw+D8fHD4VJ3wuFf/e87oQ8t8+Tbx9OeuW/4vNra5P0a0fbe3pC2Lt5y3jh8ydu4aLdYu0OzW9382hicrGh4fHexnsGmgqejhTCvZIuA23yf4OEGn+zIphqYD/CEwVjyRPqy+h/hCddnR/9SIPCUEtg4Pqgf7raxfVwUDJ7EW7JU1llPGydZNk5k8J7c/Y/r7of1OnfHzuE6+ejmgdNdHA97cMep1utJA8O4A195/yDlnrhkR9v0PaHdWCRRmEn9cOfVkR9xnyRLFaVL6zNvlMi9eeTGd/U4x7+j1Als7dhAxj0Sogh9YzddNt4e7u8299vn87jsMuISRty9gtfX9La4RZ4n4keZ1TKUnbFl6te6iT5Xl1eef5kd1UebiMHu2cNg7ypLL74kbmA8bvAUC5RKxFCh33QLYn4ROJn2+UJHf2kMjmoUjqxAsmhNufQ9Nu37jKfbpttaNo1OmSHM/p1md1lZXUSbizk2wC7GVtYdDAsxw0nmxqbYulFJZ/HAJJY3eY9knqbBh9gl47He7JJKZLJEeyQ0nyGL6Pn8scO+QFKcWeTc52NsCyUpK7GwMP1r5FRmVCoohAsyYKeaNXJrlj6CYwaLtmUals6EoCKE+gWWjjNB+MwC6VUJcIobMqz+hgFHImzntpa0Qa0GsonVAznwEgdLdl73plrJL0R0R1LJvFSnqAWRjzSrpzm9/fFoOB6Re0x/WO3PANVsa5GBnjmgZfqtZAlibb1bW36k4I8YdJKixlk8eAqzJCAd8/pvuXAKCBZ2XkdlGRAWipBiuzbAlr2xCHm00yWaDFDdNDS3lqTSVAEm2ZX8IUedzpmD5l6cVWILpfOB3Rub/FI4sYNZoMzH8xUGGb8Lz0EGzRHyOpD0MXubvnOJWglwnHpxkf6NaGzVoqPDkXa1QRetJR8iO6A9lZmUBfOYdsSLJT31xq98zMDU8SgoutsCAJTcamor9afZ9sic/wicAc8cXaWc0SAg5pitIvjRUnqBHs82rMFh8wNXH/dsr0QB1ugbhGgxepica01bPfrpXekAuOy29GC9wVXPcBKrSY6zzopHeKdsGrSiUOaNZkwmSf4kGEPgqsGzfmtswJ5Rfv3VqxeVpecvX1aer6zUl16t/3fzv81X682VlVdLK42ll3EuGA6KIrLdDiWKyu/c2u/eV19N9A/bw0/Vy0prozXZPbrqt0+fVz6dTvr4221369Xtxw+Hw0515V3j6mb4sXoy7lZPrlpvT8aftk5uSThQe329u7X5Vds67h9tmV8/nT7/9qk96Z8MTm67VfO6Y9Rvd77W++9I2brhl2kN9yfD553l437ndPM5C5FY6laPIZRj2L1dH2inN2Zr62QFtzvB34YdY/1rp7oEoTeXnQGEYfSGva0+Cf1oNTl+x+OGaV732uujjx+u+p3qduXjqTlubTX7H6G/7fXrTwaELYj4rl9CKBYNa7qs9N7WX+zcvlruLXfHHz+sX36sXpo7g1e3n25fubAl37H2zO7tq9328d7mkbm3uXPUGsMW+8npc/fTh71vEOrS/XAy7A4wrba2cd82J90twG/T6OB2O1ubyy1MW/zewmXMT431SueW9G+5OzArECKy01j/1ql+qvSqm7ef3g+vtA97FfzN6H04hPJLncGh2Y32A+gWLovHYP0Sj4MBoULtk12j1dxeP66YRzv14Yf2yWHraOnkuLXZWz82t9ePzMPtQ1zuaKnVf195tX/YNI/bx6/2j2/XDw6Ndfwd80jF3D9sTPqfTk0I/7iFMeqScITdfme51ddOyRjhtlfeHVdPTMYnu5x2ra1P1xz37jKEy5h4rHeBLuNPyyeXnzAPfKq+qn76sE3CZVpv183uYGnYXd7DvPj8WwvK1Yd4LJbw+G9ier0a437H0GTl3Tvj5btGfzj8ZNRtjOc15pNv3dvnl91Br7oz4GFZ9Zetjd1hw3IZH+xdY1yv8XiNO1uvrHeNHubNTevTkd3/tLVpdnCbEF7Hwj0gRIyEZbTeTvo8HKO1WemfLvPwuJPe9u3Vf1no1KQ7ePUVeGWHhmjY745cEo4F4X2tt7v9g/Y6DbGZDCtd6+odCenDeHVv6698/jq2tz34xyM8j8YQPtI1usOdwRKeIxjfD63xp+pJxQ8DuxTaxry1/Kmza1ZgLr5qDPYue1t79ru3/Xg64G/7HBeflqZOwuFw/6wKhCIuax8Ov2oNSVsnFRH2Jcx33AcSKrT9zfbCsTCNvu34IY2MbvR/eB7jef7K/dQmoY/29hItR+aNsTL26czKW9vmx1OX0/7rxw+YBxs9Ml6yNjvLdTIewvuvwHed6g2WAxB62beOIWzu7TqENY1xm1aovIHn9aX2TdbPw6XubfeFiB+EWr17uzvG87bNQ8Rwn4diGT7+iThZJ+POAEKeJn0I/WptVPrbt3UnwC/VT98wfcaA36fmp2Fn6+RIP33+9V2je937sEdCSyEkcqe6ZHarlxec17u3L61Ww+2H58/pt+0evN++fQWhqta79vNKZ4nIH4xHfxiiyyuxTyyEy+/TW7FszFhXwiGGwbG+EOFtbUM4qsP5FeuswccPJ25vw04cWyzHnc7g1TLTN6OPp8+v9o16TP83e3FjT8IrZXOkX6uJ4VgpKhxbAxEnPDYee7H519IADrVeD0KjPZMAW5N2t/ASLaJCAQMpmbrVJx5Qbj34b5Ze4P+sLKD/oJeJMVPQziRjaiOZBSXsEuQmnVzy8kI0eHZ0K9zBlcQFnl9PvOFxvVkIESH+wDI8E7bewGRM81myYeC0/YPeb80BsK/xlqnYGkcxqclwWdxRleKi1cjsUsy6l/pN/NV/tHpySgF4VDIwyXlCIY2v1BwnYXWpQW+KwXOZowETrn9QXqkgcqtGZN9gmit1sl0QMTOG2ZbHKbdBzIzNTx1gOVvfE5MuZNvyVcMh+5av6AafyDbsEtv3GLhrD4aaRS7u+4Vser2RfaJkWljNB/bjQnmG42Z04RdZdunvktN+NTjQF8PtknOA/DSf2iwKnHr1gBBSKSXDTtobkh1SJKj9mPuHXvTQVHvqWUNwsiWd62nOxLCyZ52bIoVcEG65jHa1LtoPnVwlcUHEqzuk1zsJ23nwFr3Bjb6+0m//EHaQQR+8LsPLM+s1Zaw/xGnPqmKmel3mn2kOujBhoXltDBsnhDdUMrO+wVDhoHr5D3KHwGuS4QL/kIEmDAsTD5H0VYh05MCx+/h13emPB7o1cnlPwo40VvlZjVfWHEdLLkizZNHSErqkxYx51JKwrpCtOMs91JjxCiQlyGgAaWNTQcSAydRNH/hn3OyXtJ7BE07sy/9IGZFy3JBIWME0XOCw/Os3NwMTsUvbarmlUiVHT4Ji9Gq546PNxZe5N7JRJgCg7de/bOw3jj4eNNm7g+P1nVYD5RbL5fpwaOqogVXLGPe/XN442kAHO632EcLtlMvNvRzKXY5Gw9VyeTKZlDQoDpoICrplzJlD3RndwqnmRVyh1Bv1csmo0D8DvUmsgInWM7qjlDKEuDArdrSObsZOEF6D8YOMF7gSTWIAHw4fYKk2kiIYDuaZBddQ7I8ayoLwzID24diqj3ZsrZeOry8eM8B/p+vDumlc63HwBXEyBwUtkRgRtGLYTlaW94LkcNBjaRRXlWoHtfKvyzF4TXP/SQQ4002p0ONH4xdp/JJK20CzI2w1jEam3rKwNLrWYmeyFICBK/V15w/F2KLXZV5B2t0EgRQ3BIKYK5O//4hycfLe3I7RcTTntryjja0u2xWNWaGQBlRSuiddKzlFi0XazYRUxvAosR+3EZlVKL81BWkmuA5vESVURJwEzVnRoBWYAAJW401YiHSlRodocoQrxXQi0s5n40vpvEN8UOq2SiBJM4wRz0Su34wcrTuCEYOVX6SphOuhs94mmtpUEcV2NN1EgkceSahCEvD2SEjStsdOd2qiBFxIClDjbgmZaowSb8SlP9i72Jszg2szgYx0OcYuTicTmxx+gPR6PPwl+pWjnbLU83oH2/2CzoWoQXJZRXgxqCwGArnJt0y7ww9tlKlYElaNGsCWiQLJYtF3CR7ZV7olZjYSvvFAr3IEagRAaWgPIytuoI2kpK5fFRbIYJXyJM9NDLAwO3AMw64kjHwUBI1LK0u8Pve8XH3khbi/WmbPTItm4VFeP/tPyhIzdJ948sIZSV1e8sUymv9qObUzc1gvqw9CYMn8tEz+wZbJiyZRIBqI6Z9hyRyRpz/Pujm4F+cCY4AAd0Hnyt6Lu7TTrcZ2jIFBkD+y2z7gTGuyOBEKjye93BEoIkF+id3IIMFC408xkApjH/xn0vg0Mkza31gHX1jiTekEmXGb4h/i+JizryOW6NzZ8Y/2b8RTC68Q0iWPuH4Qt3Hh9yKbqbBY6+ujY/zKEhdY0EDy4EUNhgvb7JGWAg2/EXbPJS2/tQf6JqlYCK53YCM26EIhKxaIPgezNeZbCGcOsm/0Uiiw5djjYWsjiQDJLiba+8xeIz9AnQGQ8Gt489+eWEINf+1MwnGELqeMYJIfg41lVl+V4L0ko5iRGOGuJbU/Rafv1gKrf7KaHltsvc5PTQgr+fC3As1aFVzNC51K2bA95uDoOtyN7NjytXfU3Qaa1Mb/kvMJZGFpd75iO4usfC16koccqiLHeMQ+Cwt1yKsPyGFuFzskEiy0rPfXxGB477Dz64VwDWb6RWuE7ctQDFis+2ViWMvVtJ1xNgygl724C/fKGG7oJl5BrRsWlg4KLhLnVtkMCjIrXJ9nXRFuFUimaN5gSsKB2QwXTGbLHuaFgVrXn4GcWMjkv9A86/Q01XL17Kw76EENcoys3ECNt/utRhPhvz6i8h4qb8C/", 16000);
-	memcpy_s(_servicemanager + 32000, 3772, "eB1WQb+hnm7SpCeh5XYu/wUCeYA/V9GKPIgneYXq34vq2De3JTp6nD85L/FbzAjvKxjdkSnnHYrCPEa94VygFBEoep3dnao7Di/gI1UtbemjHc0dNeFrIeJ0TNSMvAvkqqyIc8ufmmDuRHR+hDslfSUXt+t9kS3wgC/iV1hQOrcx9yn3GaXf6bcF+PX2XfNjCWa4uathrrLgBtf2/ubRaf2weXa2a3Qd27UvRmdnp5iZ7Il7dtYYO5Au/YSupM/OPFqfnXH6phCKTIKCHp4E32MrCX+y5CfT3efIz6uHxCEsW1TcqgpXGd7fmc45nsKMPyAZTtvobRlB/qiEaKopIPYMl14TNAXQlHOc2c5vSjUBPDECGZ40jUAS0KXFfk+jyRTxU8Ex7ZRAIgxR9fuDmnSlMzzJV3Z4e1Mej3iGmN7LHMgXr2jhSaCdFJOuPcYa2LJHqKMH0CqiuCZiEJO/ne5qKaWUiimZoiTzc7prnniSfspd8UXv99j7nA+rJxxUZxo8i5jkw8GlRGqi1ZQpLsKK3X+aPbVjPBH8dK5gKAblO0/jOkv+xPvKoRPfIzGt6+JFsEv0zpHp0/7MlJgge1KCWMUGz7TKQy4wUkZ4HtpOAelExDNovbREvNOqqhTYnspSyAA1Fw2VgE9CJgQFXRKw9Ggy3ul0ClNtT0oli3D46SWLjH2eJMw/Q8LMlOJ2dingO7ViK7fhZBHdD4b7ydSX2feyYvfzJZEUz4GZk55MSwUuW6jPD/Sjr94fYPGdqChFQRFNXRQnUfwjMd4zlRDInJi5LBt5WS6ogDBXhpN4uH2qNMfTIZwJViLSJGGD22X7M4SfyVV00X2X+YwNb2sOwyMFdU8jNA3aWcElov6P8Tmp5Jnj2ao9hzq3RUEdxq8GuPvBcA/HlkVTX2buvu/DkMQBp/RtVmGegNa9mLmKVmK6FXcznXbKZo49uHM8aWrFdjkGmfgz3tNNe/Wz34m7VKkHwDmdMOlsLXoUXWVzMHUMpGEc8Mwyn+53/1y2ixiVtgm7wmQb1x9pCMdwxYNSHjPU/qDHYlKPQ2QfCmfA436ELRSV/dLUnk7BiReOrnfcngIrSiXzHMMxUvk1EIeSQq+wi329vZGOAVaBrCxyh3rXuDC6Evt6LmEj8s2zc5jsuqMaKMs20dVmoaT+PdxKF7iJzh1BSGA+r3wJNrGTodazGuoKmbRjEmlHr2TLOV1xvZrzaZvjd7Dl4iHFrjRj41Yu2rrlqoifOYYalZxu0kZrQsTRdJwS1/n9gz1Xrfd/Gz5LvZddiUdNFwlpi8Dj6XRLeBVzadtXJbyeIe7uvzDPQMiWlUf5/8njn9rkCi1uwt/5BBYOeFm+SxlEUhC/3Wju1HK5tQw1hphmowuU+5ypFqQiMWpLa8brvc21Z8+MhQx1s/QHkYjUXw30f6j85+fK4qsv5D+LXMlHb1ih6ed/LWfBKDtSAuH+456d0f/kikD/IvrVyEJK+pCBK2YaA/zcZSiepSzv2xdlhHJ3yvyceI2mRITLJRFMMzjfSBJiDTXH1QthaVLC8mAQtTHgCR5rJ7DUreC5LqXyqUKE+EQIinBeejpHRkZPhgRasjpR0HYymzOgf8HwDKokOL6VskmJyUUyfRECqqR8gEEnhf2IzXCRLGqeg0pI6CpFNJNpOL1tiIUnaZAmzMsWqwy3d8EMIwAE9erd+xHv+SczK+FbNBdk3M2wQbIppxyk+qmC9RPpBTvvRzRV5qkLjEqgQFIH1vdafuFz5QsTMHDWyfM/nNPbUvKEeb1qfsF8UhhPiitqwEQoB5uS6g+ebE6iQWzGvOj0/7FW0JJFs7fGlwQJi4dEwuHDtJKAvWcrn3trbv90G+7TaOxY4RILkTMc/nod8QsFxcNONKI5srqPX9DTfVR60EKyiyo2N6ER37KTdDJPGIXMXQopsHmxTLCZ4ywFND0/nRE0jRxPhuyxIaP24kCztD6s2IFNDujLlnVhF5boZcsx3jXRBZPrjN3bjn2Tu68DIcpxLg+6qAo06FuDQxctajdo0UZDowf/dO0BJnKPrYDy34lZv1SrneWWznLQLv5xljvLrSEqYX+twLEqt4jOcvj/cevEJIVXn6tfMC53+URPgI9W6r6zwBcxBqSarg4zBI31VecGxYisaeKvAqKHxRir25GSV/z4hURKpaCTHAbtl0i7XV4liEThlAc8Sdc9pV8UliLWVRuTEDlcNOCzDumjmoeHUIFrJl8nMcW4FtCMdEdb1IhsjxvPgARlGFabxLjhIyIqRgAT0IbEq0sLnvPGI6nxwu7rUHlfYJpGZ/ECKzgivuEP6qnmgS+9RVpFmjMiBgtIRhRujxyJX4vxzUthsTpSUgRNA3UlEGyEaIJgL4sItxFQDQ+iDhKX7bz3Kevz4KHeKFfyd098+VPyZX5x/JNzZ0Bq0hT1In/SN4UhuWDBzwOVcNzcp6vd0xfHI8MM5nAMpPk7qB+95fuZoSzwtElgkSJaWoiFIKavj4HjI50KjW8XykGxr1E4QQ77BhnKhFT0YH7zXy08d24KebgQgE1oMMXjCRQqyBH7JlaACfEN/RE8ghya0mJmfGyLdvXCN+hAeLUxV8pGpt5oMOTOTRkUsS4tiv9bcscdWriwVCQvWJqjRYp+kAze3QmTXgIt2HIUL8MMJ1AliRxtfUSSdDZON9DIDuYuDdUNORICYM7Caf/Fr7kMKyfYQGTZqXJk+QQvkhIXoDekfOCGW5KMEK0GPpS99wCZQIXRIG4eyJuSK5LNS/wOauZyC6QgFoC5WC72Oh0kjLhDD5LPm33o+13E1UAogecRSQCYOwuOlCjYiQMUSQr44HOxc5v0ZS1UWcgfgrtDb6h3F0KF/CuXXX20obuYWWg8AH8tvHNLO/tbm62dJhbqAULt2P0+MBlro1QqkSDBUFMQNRFuPfQbZcJmo9Wur+80NxbCPQ+3LFACeB53OmEyRWp7WqVr6po1HtatHtVdqZ0JXi9g9IhTDXSlc/s91k0fLr925wVqfb+LIBeLLLmrowHMpYToTz2F5YQnPQj3Pa7/Hg0SLB1q6Iic341cTp4GOmbDe2bQttVlpwCCphm2ZhbCUiWNDgSqOL8JGyFgehLIl1BNnGmQbI0l/CLmssCQEHdPM6BFJlV0/vEngQRRZMmBkjhsZS1IpFMSjeKaRJskAYpauwlySpAWKimyWfGiJ9jwixADhdoKDEfoGwcCjNpubcGJHJFXFQUfnX8wxIRDrwzTjBveCBNIyviXMcpKYObICXo8qISHTP9+ThFSoese5QIrppAnvL4IaJCGS8Oxe1nIL3ZerEClgBklFBDvA/SthgV/FL1rLUUAnAHOeR/Jv5ICPX2kdS91kPGQz1BSYkQ3Y1bWpl97holTDOHnL8DWIgNFzCqPZ4LhpYRZwcLw2lwTtpbgH2Eh2LyJLgWbN1kWg5Lbwuap3sIpv9iZlkB2tjfBn6sCTp8rX0LLqCzGjTi4UmMhdgHSJ7nOSxm4IURxSYI7Eeasd0RgUpadsRU8XITlIBZdYjMh0ZiwcRuoNZtZkA58BsMgBXiiaSDReHKFlxA1E0v4uH2eDFaCRIkmbEvfyTSAbB2UsJc7zXIoYQEuXxtJUQ5m35gBL39hFOOKzCgxeMXA4AjiMsVciO0TyK5sEiBgSqQJiOmYNJwCOWh2CAQV3JFEqg7s3hiPhH4ztJ2R6ydv3KU72mvhEiW21Q2Lf30SKs08owqXajAqhWD39dF+m6WTww2IP9cYvv8fi6KjCQ==", 3772);
-	ILibDuktape_AddCompressedModuleEx(ctx, "service-manager", _servicemanager, "2023-01-20T21:07:47.000+00:00");
+	char* _servicemanager = ILibMemory_Allocate(36197, 0, NULL, NULL);
+	memcpy_s(_servicemanager + 0, 36196, "eNrtfft72rjS8O/nec7/oOXbc4AtAULSnjYpuw8hJKXNrSGXXujJa8ABN8bmtU1ImuX92z+NJNvyXTbk0t1ktwnYuoxGo7lpNKr89s9/NPXJraEMRxaqVVdfo7ZmySpq6sZENyRL0bV//uOf/9hT+rJmygM01QaygayRjBoTqY//sDcldCYbJi6NauUqKkCBHHuVK27+8x+3+hSNpVuk6RaamjJuQTHRpaLKSL7pyxMLKRrq6+OJqkhaX0YzxRqRXlgb5X/+4zNrQe9ZEi4s4eIT/O2SL4YkC6BF+GdkWZONSmU2m5UlAmlZN4YVlZYzK3vtZuug01rB0EKNU02VTRMZ8v9OFQMPs3eLpAkGpi/1MIiqNEO6gaShIeN3lg7AzgzFUrRhCZn6pTWTDPmf/xgopmUovanlwZMNGh4vXwBjStJQrtFB7U4ObTU67U7pn/84b5+8Ozw9QeeN4+PGwUm71UGHx6h5eLDdPmkfHuBvO6hx8Bl9aB9sl5CMsYR7kW8mBkCPQVQAg/IAo6sjy57uL3UKjjmR+8ql0seD0oZTaSijoX4tGxoeC5rIxlgxYRZNDNzgn/9QlbFiESIwgyPCnfxW+ec/riUDTQwdV5RR3cZgIc8e5WHyoYh5a1ryeHAhm31pAiW1qapuAu4vp1ofukCXkqJODblBvp3oQIhD2ShI5Hvxn/+4ozMLrRmytUm/mZhU+iO3EDxjBeFnIF9KU9XacJ/0JQxo/uDwoJXnnsIPbrRe3fQ+6xmydLXpr91pHZ9hAro4bnVOGscnYQ2tCjV03No6PAytX4upP6d/cLGpoRXwH0Dy3INL+cYyME528Ao7kMZyAZbakWSNXDQql3iZ3k5kvILct6heR3kgUm2YDyITMG/pV3jy8fzZdcomJjmrkO9288Xyd13RCvkK/sSeVggB8A1oGJxNe5XCz2wEbKBQgBe4XdpBeaJPCkUKj6cJOmhEShe9+JBVUw7AzJDkQKvJM0BI0ak5D8daR58a/TC82QDE4g794eAHbXCoIo0GZwuv3wlmITu6iteYWbgkf73dAuoG6tgyMIrw2urjBV+eqJKF1/WY9DxTtLUadAwzgTvFqHfQ7J04p3U2SaRZG5dkOQPY3ArlZonNjiprQ2v0ezVII6xugf6ljWCgWD1zpFxahSIGjxZ4wcb0wlegyE85UCqULiuYBd0cXhZEx19Eb1G1iO6wqNAws57Kmzap2M3+4vCrSxMTrXyDObTZudX6pMMi1PWWGF8NFMMt4DQ4D0ypZJhyRzauMbPsYB46NSnuvDP6HaPqbs6h3qQ1Tm4nzloob8uGfFmoltB6sYyZ4pmksgrfy4pJaJXw1m1DwYwccF/gW/k3qt5U6U+N0Cj3lWvnA5YBsprcxqq3jVW+jc4IE/HgiM5OTCO1qqcR/JVr5HCmJbew6m1h1dMCCA5Yxngo0U2sVj1NwFeniZmkWO8UzfLNQOEV+g3PAZkHS9+aXl5i6VQsY8Y8OMV9rtX2WgW3EUOawbz7p7GwKt4IlW2o4DYWXG9EjjjT8dInSb6XTQZDHisRJ+2D09bFUQtrEwe7eREB5TT8Krrho8ZpJ2Or/0lodTtdc+vRzR2fHhykBq8W3R6R+9kGvRbX6uFRtkZX4xs9ikfl3GVAwCoNXTUbfVDLsaLqI99amjUQ0tjXb5uu/lEIFIhb4gHaD3ZQnkzNUcHRz4Dmjw/3Lg5aJ1tYY25sb3t0ibT1j1v7h2ethZpoHTS29hZrYrvd8bQxF8Nn9bWXc78G4Sbc91HjuLHffNc42IWOhfsMSJx0fWIWAL0J17B5nDiIIWIgFYjYAnh3erJ9eH6QBi3rXrSsp+ozS4cBqZ2qQ8xAUnQWlO5pOnvXON7G1m/r6Phwp73XSk1y697e11PO5+F567h11jo4SdHla2+Xr9N12Wl1Oti0Dwz0e3miBLjvf8S5r22nfHfMDaJHh6nOKtaNb/KuZlqpoAOJqE9TTbGI+VJC/aGhTyfgF0BH7W3qu/nfqWwosglOEGQSJRf1R3L/ykQDXctbSGP+EnMizTTmAuhbaoVpZAG1lyrKrukBry3jFqPTX8DRyj0qNkEfloxEa5JhGua2/eIo5he2J+IUjw3r0lMZ5vYSj0EmBUroSr4Nt30JNuo+WH5xbBzP8zIUBuWctA4WDzcmm6pog7QBamsw4xa+e4wV+w2p8pWB+s3p/N//Rp4XX/EYnLdFDFvI2w3Osp77kTSd4Pk0rItd2WIYPgFXWCEcMX1sHA74WSEPLhixEcNK7hNk5Cs9RauYo3wJfc3jP994SUhqYcUFm6cG/gN2SD6/6X2sa4X8QLIk3IADbaEPyAOXIqn1oo76eHl0iCleADyGdqJPrbBO4PHyOlG0MngK5UJOwTOAaR+p2MREf2Kyxoaqlkf5/8njb9LsCq3swOd8Lr6d/F0+oQAY4Rgo6xLl7nKbSKA4ZgQFpb66qbw92Nl88UIpilQSgQNe1KmT4VelBC6bUq6EB4gE69ZYZaj5dfVbiei0pRwSb8KEqnVz2sNz5jRTLVH/hf2guMK+k/a/9mv4yap4FwREp2rJYFBWxKE0CEujTdS+1es5Y6qBRzb3R44ZLrmNHNPjc5uiYCmDei4nCoJyWejX67WiYPE7wXIOfgiqMXYwVKkm0B4J/oeri9aaC5azF8q/zG6X/tpAd/g3mQryzX5egk8YCHhoP5vnSnjd1Ff/yOHpwXRdItSGCaAEIAvBKgSoDeU8eTZzc8xV5BvF6mohjAQcGy38suB3ymLxwnuimNx1v9wFHNS4+PvO4UGZ+LkKfqbKtz/nbVbw1dteDF/DIdKOubZDJZQtxsUkFJPNprD4Zs2zps1ChAR32rVlbSTOItCMKP9FBUfBUDQH2qK3nK9FPwxfofq3MuMdTJ+gD0HIsed5j17hQ3wE8lmpZ6GfVug7Ki9aWYENgzqbK/yVsJg6mxSsAgwNeYLK9vu/sYKQQjiEsW/7E+bYXuaMbPFPP6x/e+oM+vFYNMrMowmX4P+LNDoHkjFTNM7qdBbdULYOOyyc4IEMDg9biHgfzh9GU+0qwCPgYTo+Mbu4xgO22cCRoQ+mfcsOqaDLP39H6Qz9WkNZiKhSCRvuarX8Jh9FbMiQZhsBLJXxsMYFZ4u3nMdryx7sBocb3qIl6MGtsR1iXIeY6nPvzm4ZQkAkQz7RYZ/Sbsh5iGVkkoCVZrDlY+/NQnnPljYW8/gZBzmW6vAA19tkG4LSjE6noc9QId/W8GtlANt5mGlYspEvBuQn1S/US3DWBIbJ9eXBsgMx83aUkM/v4dsehw7Ytiv6HVXB4od+3CfJugJ0QHhBW7Noe/Zu6yYBw3kHDTuvInQO9BYZ/AQTg2keVfh3b+GQsr6vVK9xh4wn0R0u31Q12JS/7tuIqhRkEjbghw2aEeZ6m5TTeXjYpYzZ6BHY+mw3n0qdEgQ/GcogyNUAaFqyLGsD81zB5ihsYQPA9LmzdV+m5iywlmrJfsbGuoJ8uOVXM0CwweDoq7op+1frvIQupspgg0HpWZ7x2+UMxBew7Y5/k1gO/AWzfFwEjyJy1VYqaEvGQkFGM5mtOqwAQ5iRpc9kvCxU2cqbSNamY9mAHS0JK+vwmrRM3JBmiXglTVkGIHVNRiPJRBIagygD5UqVerIaXHqkLi9EyKDAmWrv8dNRFaPUdeIDxdCShsR09V9I2a/w+xs30Q6eooIV7kH4iQrB+xWGMUIRqyIoh6nIR1scBvG3HK8qd8t5V1gytRIvEQkb77m3V/Lt73tACW8r8LELaiYtI4FjAvVIqQpdWfzrHlEa++Q1/5ZK4z5xS0QIZAHzm6eOCElLXMRu0FICmdmylMVTxRMcC1SyC3g5C/fCYS+viiygib3ZDAfgsPdd7lvlgXypaDJWZyayYd0C1yyhPBaokokJ5w5E75RxpHCqSGqKjoJrKoZWIjvw76xHiKQQKeOimU0Qpzkg6N9m6UwJ2JPwWhltS/JYx5qvHUW1CkFLnlfgm6cPGkNZg2nCA4I2Xc5aRAeHJ2jn8PRg26eScB/diLgQWlkErz7+HsStwPwLEzO2BzyCKrxUTAP3yDyzMNKHY6qCDBbImIrTn4WfpuStYe6tCF4bVz1EHs8jzOg4+h/QRc6tLmcCnLBZnh2YFYdXYEUauIVlTGVgwxKorh4Q4lwCcTApmmlhzUoebGMdywsarxyB04poRg7ExTKmUz/7Drh8b25E/AllaTI5140rTBHbuM++pRu3vCEY8roQbw8ucbWLrO77W80xq5e0lG35+rG5rJU8xHpEodLtVn6tlLq5bq4Ei9pe4ZcIPHQV9jR2qScs7ZApiVjVAdM7igt4qHgzQJ17ep8ch/BRpf34mRoXoUbMkoaGNG4YQ2zraZb5wHIlgdhSyA2ecOKY7oUx1RrWni4N/NpQiCKTrAVFaD/Ywj6X3VAcaiWT81cKHPNBjamlr3Qg2gNsZbYBUQK7VjfIkR8dq9HDKbbQ8YjRCCu3cAJqPFFlmCXwreGq+fC+70njSqNp3b+GdS+a1bFNGnGroBJF/ln0KUE9KmEdYJSdTjCRNyVTppZr7uT4tBXaq9/AKgquG0JxEM6fdtmkWDXKJfVZU2UtwuaIsTc8jm93oYOp1zg9ObygB8fA0Ntu7TcOttmDKKzPwx97DbyUoPGApOg346zlLq5kedJQlWs5l57bIeGJe2Y5AiwnjON8sKcnVu56GE7NZji0dC4FuCTgCHOser2bGyh9Czdw5+luQMU8vKOt4wrsvBphdNgGwiYKKQTmEGGFv5PAZlqKvidFr7RVZ5Qc/Pgx6elKq9G+nPeUc+LnuDrZpko1MrahQDvpUwgImiv2OK4kNnKAHD9Ed7THbq6xd9743OnmNufQ7UMx7bTMGWgMr1CIA6579m3xk8JUwVMnmZSK4xVifULPFtfJ6WLgGYPNELVZH48lzf+GnF8lzBV36Ia63qEpDZu2X216I1fsqt5NZnfjsQA7oqtVdnYwkU8x2HCHOZWY7FyIJ9nKzTtKMXF7waLkJD+mhV/XgBCCpWBBsP3e1c05Rwohc+XikQx/g+DAH2Xkm9Cg6IjYsiD4DEQ3JXBhFy95Fy90ODQmxsZPLu8feT7H8NOlCHJ5lTWeYDmC2Uy9vgYzzbAX1gS8drAHS2nedTCYT6b2aNmafrzDqUJ8poBHcOM+6YHPw/aoFxCnJZs2n7oByyZQwCgM8hKb2Tnnnf/802GAwJmAyyezEptHO9vwUcy6uISFnVIgzKO9IooJei052+fMi/0MeEe0BEjFwSN1a17qEERDS96cAUGQj1nYnQdm9vBhgS6S2I1YYPdlL5z78kODWOdyDiiDOGhVsHE4aOF7PLRc9IzDXyD8YMWUaSoSzF86+H1At4GK9LC6V5ZvLqhnEB4OPpnlKhzR1mSo3AWk/VJ3DvfAl6q4+LU3IfltBDSeYrUEW6KYNyFD1618MfWmZyalwUERTHNEkFABz2SEEsbGDxgndIK/kr/4ewaMHGrU93XNYuv0S7Qv9Q87JYqenkxQAy4uQsqkrB2Ui6WqzifRgTw/+B0cb+vLIti0UUhQFD1i8VEJKX5L1m96GD9YUkgTXrN58prFQygTqSPYl6a9cEonTIg9W6Bu5v1OeawOdpk+mMIF7mf0U83P6umTZGZvz3lIrCNh6SIMPbPAEJMEuLktTOXg767TXdZlygKXtYvFjF2Hsok65YwUE6lYId0QIOyOZRjBbI0wMgg9k28I92PzS7gdf1r30TgQyIgwRPweOvQEFyhYVzbiQFu3v3iJN2V4CcYrpLbrUcqJL+uhMFBb04UdJPt/xeBVNHN6ean0FdjJkfrAdOPr2GL0QJYHJu5evpbgMDy2OK8xlx7KZr6YeiDL9G3bsb/LmMzvsELoOihhxaA/hYwrMxlhAkSSCnGit3asKs2fyJZPipkP4y1/86lfigJayMAWl8pgRHmBKB9Y5hrxkrYgbHGUOl8+t8cwtkUJNBNhJmmnj+7z8iiTD+4XW7rOSoxCh6CK9+h5jlOO2Xq0fdBhunGEarwUI0oENL+7eDEYs7DPWDCZXpgCqnlmG4Ps8/MmBnmQbGGIKfmZbIjMvjVy+IPzAdleDTEnSVTt3/1GAG4mQiPP0uQv9YD7hQ9xb0oa5HOm08TFq1NHiYTfQXpiYlkM9DFkbaaH2aASc0CFQeUDynX2xHfNvFyhXXg7IR04xurmozgm4plrOpOfYiG4GbQUQ9+09Il3DeqT5yX45JYgniTvCnyg9ef0K778yLDZFDoxQeSYbtOQzJE8yINJHvbec5AwQnpx3o2gD6OEDIkgxRpJlJQnsA2kWMTAk0BlJ0ibQTZzxcqrsJl/Jau3mEbJKgv2R+DkfF9L2Jy7Lwb0KN7RR/GQCrBMTLhhHDNGtUqItYnZI2XEw7NR9uiedvKWGOEizDWTuHjkcdaw0IkYNZOLs0kuEi0ao0MiFl5+d2ggW3DnBOb8YNOXOCHwvCaF4i7Srbd0nNWhN56q/8BCjVqFFS+1kGT1edsqK3ALEdIq4m8bSZRfdI5Ncq1uPuLZ7r8dt79S+leUE6xc+TfI7onlOwlDTJ7ru08f+6jQknNfLTbvWTsSPX7kzaOVzwlYV3d5gUL4qVR3wvQapbhzTLhTwSZpgw2ITd7CTUqGIaWvvgXVm7h6JW19bTpmY2pC7DK9mKPknrgSb8lNG4bbJHnDBCuKIh8OCpCjhv8tv7CPfFVKuRwD+qvyTRhWxGcT+5fJMjsWSfYwTD+5EnLaFG1yLlAudw8H0uwLebR8McawD0tj42Tvcq19ajftS5oEdzG52bqo7knPe5Aw8DwrujKmZfNcnv+YC1vskx0cDyRN7+7z3O9iV9ZkQ+nvS4Y5klQPYumSN/SbW1uk7+6Xm4YsWTLNYn0E7wr5xuBamihrtfJAjWqAVduXrZE+KOQPJ7LWabKxN8TqtDCp20kjaSrJ1s15iu5oVcEaH6eycevJgN26SV+zqWuXyrCRtWJNsGaT5kNndcXqkGOJrIZoN5DYiFV5h2W8KtgV/ZYO/82RpA1lLzYEq27Lqux0J1aloapwzlhuaIO2plgKViR/yB1lIAqr3L86AR62L497WAMZKROxmjuG7HQTVrwWv+7ozUKx667m63FXtvYk02oZhm6EdauYjcFY0bxhseQRpLEKalMHJ40pbhlz3CCPOJMMhSSOfeVnsFwtPts+YdxtzXpdeFlCL8OCjAgkcNefZOmGuUvy5vu7PdIVuKYoNEhJsgfH9lwjnAJ0rqKoosCBX0K1ElrD/16ur5dQNfB/CMDF8pmkhsVYRlhVY0JUgWHal/hFZTziiS6EQAvhwLHrEIol1m0ksLHb/ahAa0dfpeC4Pe0ZITv0gvvd3NDYCirEDCXBumUCm8ARIdOdqG2qfu44SeP481n8u0K848kRvjrYG5LRH9HzvPmbV+t5IT/sq3XUUyx0rmgDfWbGEAAmF7YeOph4oZP1VLmu6LkJpmTI2vXXvD1QyP9UuHn9qpj/hs31xCIb0UXCDew5ijxbEdPSZgSmGpNJQlgCLrtWi8Zq2q7hx0tNPnpy8u4xScXTUzivHUuQdI/cOpmK6Q16qauMiHi3q9Cl5tXZCnApSwm5v6ur2AgkH9bDN/56t5ZsQiSJPEgFi52E+5jMQMrKhmxiNL/zDCexYqXiS2weEOCOaKu9qq2ur4eCPe2zq/a42qE6bIFim4oMdtXNGve5usbjucQjshTATskzZFolfD4mFuMJjEDKFyb+GjaSH7gM16l7bSJfMf7enJA8oj/sOyTtnS8ZlBInHyWXMsMM3ewKm6Og7mH+8E/OMqbD7hd/+rG0CelhdeOKTcnaK3CJwpVwbJr8o3ALv4CbGO3JXEEF982/nMpF7nPoKoH7evg75OwfJyOngt9WN/Gft4ERpqcHBB4LIeWHuAbcqwVM1peCEeOMs+R+jHL+fg+7HAB+vpf5y3HdkdjIspWI8rkykGunJzuvQxsZKCa2wG8Pgm2xhlK3aNr3MUVdd8ra4UgEK6KvQg+c0+mlt2R9T1CHeFYXsPfY0ojyl9B+ItKV2UpUiLhznxZ8yThDpKBikmNEdY+9UghfUYxqQsWfwyFo1t47NMPzQXeVgn5Rxi9TiZ44eed0jhtly2XpUph9WK3iDwWGtT/Io1oVq2OED4VFgNBeid5f98Um9PWpOiAhCDoGA3U8LqyI/N2jEPiZK8DhtNw8hQ3DhZ6Mt1pjL2tVfoy0HjDoYtzoUlpfDmu8Q45PbiPgkrNvl8iHmSts+V2Y/TFuh455M6aYs0BGMaWIF48RVUwxj/eOfEkqXPOUrkUXZ4wzcOu4/ROZseYMkovkKYPLl1BElDWKDp9OzDwkGKsfsUovgsvUec4ZU0npMGkdSvVh7kTWqBM/4/gMOJCS+iBMzooBnFfbIuVxUi9usESq0ZgW/KPszTuqOKdCivlzZU8hREqaVuLA5vGv4w+CpAIQFe7IPY5YwuRPDz4cwC2jyZll5+mPfYQ1mbASnQylW7dhuYMTxrnMxWjIQ35vYqZoK/gRuHVu84nLjc/Puhgx4T4pjX+Qb8mXdx9an8uQilLdpzY4xlrnc+ektd/tNqeGIWuW44O3ul3bpOh2ndAEqmTkL9ocrhclz5AEsAvSKL0d80FoMnS67lLmKffRL82wuwAFevPyesnPoQjwn+/rA3JKvRBVeCGKYcTSHmPV4kiyRrHHvwSPU8QQy51QAywrO0h+k13kRu5Bh5wgNkdL41pkeJOvYSMfY6wFH1pjxbLg9D6ezxBzIkQLIbdteH1nWc6seqQXBOKxB/1xdo7Gi8wQW8rTZRplIrotDK1QO66K6VQMPzYusrrj5wfCUv4vX/JMV8KUhuZlyZ4n0sn6w+JgCO1O4pOvCIybATudDGAV8Kf1yZNMZMjUrEtJUaeG3OjTWOOFRKrUtwPmY3Vbb5dlVsvOjf4bel3cTBIilQrCxX8DbU+/LHSaF43mSfvwIEE6hTmYBCDCKxRKroW5kjIIQLt15l367bX/InCyNelozB7YTnR7Ky4G7q/KtzLcnVUkeMSocvBjv0kL5PoLgLMYD2gCRANZlW6jZtYPJCmcqBskUyRdH4MdD1Qx9LleTaY9HmibANlt8DuN9t7pcYsNpJNAK6HAuW7BtLg2ZFO2jmRD0Qd0EBi+wezYfZodmjCTFDjaa/QHqq2jDbRay0wb9pVemwBvn72MB9WuOaHQOH329cltIes41mowjlclFGp/c0NLa8GGhpf4TViMv1DAi65vbGHGQzxrhfypBqROs4hbyIencjl/D0p5vAyOyMifQaotYtcRuWBrwaSF+zLMOF2bj5BNGha4XhwAnQsJ5Rs5X/xa/Ubu8YEvm/FC3zmRy66QytHrymjz5KVzeVTEXYAx0YfpJz7uopCMBEAjPG0m77nXwQmq7MaSAm0Bs5dJ7LQ4ifZocXpZJDSdER2hCQ0LCyYt99hPEPfBrqLPxwEZC+YFnLpq3XBAFswSmmSbrD5dOLDr5gE1YTVM6AlPTsPejFMHWIKkAustu5bbh+Qx+c7J4dFRazu/kcxzJ+ULLJcLTpUk5kq2WyNuMgsH5OKodbANEyoGDVasJqY8OFGIQx28GGUNS4UiWoG3NCe/MpYFwCQhwd4G3yK6J5JcWUBcUYDhWiKDbMoSuPSpVTBtEiwByBBZDW9KiFChAODz5CLJ3tgUgyCIogeCi2I1BBum4e7UqLxSVLUQY1kKEGflQ3tvT5BGBfEojsu0wwbQvxfyFqUJBFQAnBNMPNvjABoOppNljme+nNU7kC+lqWptCC4yYdq5S7KJHoP87ak61eSbCZby8sDZnYAzXIwlbz4I8qMTWMWKPH/2hMyqKQg6TZ7Bqh0rplxwW5RK9HJldtMICTOSNp2vEFRiJNwPSDfoWCgHJ/yFZKnPYbUZn3UvUqlYJJdZB7DciUtTyION0cj6j7Tm116J7GniOqauJRp1XpvOcwoisB9pR2+tlhwwXUMO/EkF2qkDO4uf5yPmC6RGMTxhcPo9F7oIHTOEmAskCUgRgV2OFyXWkUaIxMXRlUlBfArbmpg2DvQZJO1z77+yphMkIWD/AwQe/J7Uv4I3fYg/p8kiCJEKIsdRfDxK0aZgba9SVRWtZqsuoN7QFQVP3kHa/wrWpAR1MG9Tb9HLapVZdJ4e8ONNERYabPJ3qBvVplijUDFEk2PrhilzntapH4Y8XL5DwqZMGhzqZ2YerRpWa7IATiDitEoaW6/pVLP7yjLpMI98n6aLgeWGPE4NjpuU0Gwka45dR7GqmBtuBR7fGccj4npIEOi+RB6LbKGEEhAx9hbaTfEFdTPJ4zlLFxbWI+KedJpenl8RBWQL5EWxhUv+/tbwAlumLNAwgarJOO6drOPpNST1zCIUS3c5F1LW2tzFkjZ0+tQwZfUa664YPnaypQRim2apnkgzDctsO6sKy47AeKMnN68t5smckLZLuMm+k7eXpHySB0l8KyLpwgVkXbiWvUeNZhhcxcgTP2q3S3OIrNW63f54QNyqkJfB/ZyvNDGQLHNWLkA1OfTv2NfRF9TdF7ETRd9V8xM8m9RsI4ifCFosksdeEbBWWB+e6IDE4liv0wpCl8iL8q6kSK4Uhi7FLR2QzTeWY9aSgBpUkItLhpVMMJ6ugizqI6GSdzmj8sAgJeJqzicbkblkI9wgkknOidRgFZfHqmGJ/S9sGNny+KJPNvuki+3zw+Pt6Lj89SgYuFD2kJP+hZEdxBvTa1TTIApiqsUcps2USDsSN9FYyQRdcTM58ioWoaG9Rjy2o43j0C8SfSzAuq/JsYBwKLit7ZATuLBD/xptoPXXJRRSxj0iRPchE1ZPQnQkZM7Kw/kWFt4IYCeuSLo5U4gb3HppPeaI1+JSgOymgNdmQ7zsaoqytQ1h7upYJ3AzMiRk4a73FeTRIh5oHrq1BaDzXHt8T/CtLwJfu9PYAst5ibDNs/mXo6UGC4zxhc8FWeLr1Te1qNVEzpdoCSfA1t3opmixEMska4RL1ko+mEsIYCvZECSyvaRdYTdSy9tPJBOIYH9cgFLCTj5QzqU/TOxunrYSH4UVhD4itsszkmpqQMsu4QTO1PI/kMiLhWmClxJtkk9vHWxDfCN+sowY0Kihx0yTN/4qSkrRv7jR316XXvNIFBMyFJp7kh/p2FRENBw5OItVW8y/NlD+4PCgJXB2JxNnXb0HeO1AyOMWlQj3BHrtHkA/bm0dHt4HxOKbvWlBPjx51zpeMsTzRPMpDjxZvsKLlETvgj8gZLWtL9U3FnEUPKYivdY9TBon3SWT5bR68DAzVpwHdoQC9R6SY+jBc+zsj+v14fhQpYL2FG16U7JvvYTURFud7XQptiKPvruIjciIq5jHum55zS0PviLTBV5iQHvmIB997j7cxKCbQfnDowNT1szQk1cRfFrozKCI0/TiQp9opHc+h7cn2M4tEh86eQ85gh3+KJandS7Uxn3nmg3t1M2qaSNzxb7mlWV+de5Gr+E2ozNvBluPzMIZWOfcZNdRxPXa9IpqrLqQPA4bidfARZKK+H1c/rKxi2Vy2VlkraDFFotiTi6TVotTJn65xDpp75K3u5wldknXlWJaZudW6+OVJVv9ysQkeFox+vki3FnhLQ7SC5YhX4FxNE/8tk0UwOVszC9jb82HzMR7JgPUBrep38vum4BX+i5TwyGDFl1bpNwiKypT6piIoboxX3dEym+w07bkYOKGNwUbmoeGh0c63EooB+lNsNDPcQ63X2JIfWoaFRMkCc2Vj2l9XgyNmlYuk1aM0S8PKo7uUkSLn67G7AovP24kIR0Jnz9moR2FBGRAxk01bDz3MpyYHlMNLPVd6R2/skkupCO6qD7VBqJ35MVRouNyyy2Y0wEtkNTBveKELYziMgLPHM06qew96nTL1O0eVceL1vXsJEfBCAxk9AG1f6KhIU/QhUxOr9WZKtjFuiCXux/1MDF2uzmsCsL6732tfavXc59bnRwATZVG8nUT2G03/taIBVRIv1SKUiDrTIH0utGxKsl7/Z9IBCZbVM8L4Z4XgtEnlyKRGBqXyDE1/1rFtByMJeEo2yWavwuBx2WBCU0mhuWX2TeUif+wKfe4IC7/74nUH5wkk65iMfrsHhbCgwFXNgNe2alDuNMLxGh0FdMovCdkib/lMCXyDNqAPKYci5Z+X3UJGL/EHBtIl3rpbDO/SqhZiJ4FaTiBbkNVovDsdEmHWENePxNYAoHlfEwud9EfDRTDS3PiXYXcAhRTGNm30eTIHTS/1kIunxGonqv8mlukfqWLfxAGAWVqw70FpwL101TPzVMh94ktyaXk+gom+nItOa9RCeG+xKQkF0T2i+U+HHNIlykLpUmVFcmEwlIoeA6/p7pTQcCOuntc//Yj+6bj5CPxr9RdbzVR3tD/ocoF3HUpG93crxWAht16xcpXSt1cN1fC4g6DQ19x5eFllxQg73nJyIRlaGuBwsv3l7teroilm5yRgnrSI/NQ0KNBLBvTClpCXopnaeuSK7tF0SNd3R0WTDDOCyBA37tEYhIkJJK4YzyJJiI7dcevd6AUzPFEkHwbjpoQHehawO3W6yH+z9Rs7e/L0hiNXEjG0LQJ5eC4Xl/N59J1EqOLRSszjvlwVsqtYKUmRhuKbgQTwhm2LoAN/xd0q1ylmKGVLOA7I4D+S8etkxIzgLK15aqHvxINFTeI283aGl3LtI0sTcwz1AGB9Xi4R7nFcbX6ILiK08SzauMphTvLUpxCKY+Rr9GuyMRsRsDE02zrRRjroSmWnIcPqiOLuFSf40TSuUzJPpQ8SOs3JW7I1nYqp2nqNZTsJCV714heC/Ksudo80N4YCjiFkK7JLN2JPy5obYmaqcjsGZR/5NP4DWnaFfdOcWXw5NjPInE3bmaZ2HAaXKyCsVcJHryeKMmnxvkLGSDrMq4TjMgpZkwyQLOYy8VFEicQyllZXV7MayYRKrKN/Tdw2aTgJKmtGttGeWVvcZRhgwOlVxL7cG07cd4WchMTrUzQv/DvWY60i/XOLLorPc1egIztKC4mLaQyFoeOND04/n2V+5p/AMsPxPdL2FIiJvsGEdruZtIJxvNXwDN9BCZMCX3CD7/lHK/XJ9DVAztKq5vpDZd71AwcBhalZy9F9RXLdJ9wPyuNggdhJZDSPgoWfz41mpDg2UG9TG5HlWKagcLP8JbpAl6moHoWQvrknucmekn68suwBBbPi/I+FiXg+nlV/jyqoWE90rIMSfzEHmVZmrF5nxIoAOsoGCeWbLjXTDtPYpUct1h5qpkj5dJyMy9hooFs9vE6kmgaJ9ZYiesx/pwPjY8m2TbRMcUquAavFQmxtqO3CCJTxv51PINPglfaC+Cn4ZbPxnYyRzUelad6OJnrgOO42QMrPWaSl8xzYsTd8vbeHhLfB40kIZcmjIljCxuzLFSk/FuCRQujZPX//W/W0tfqN7uhoPOOxa3gNfprfrE0gye4WWyqQmpBFleT7HZUBJI+q4pGUmybzpUgyTHS5Pow7uow0gYLS1nS3WAE09AsXILF0Msiei4uVWlo1vPF5SWBIzljXq3jETl9MmygfBH8JoJpBUgTNBFH+dLQxwX8pITyPcmUX62LXnLjB4yMHreL23IotvsV02r3m3BGf7uN953DgzJxshTIo3TZ7pB4pfmiyRVId1+/PUaeX5JlW1vZFlhlCwEaqTklSc6/VXhW3gmG/m+3a/7mCcDJcS5ZiMFJEwpthwkGGqXRzm7s4X9zha8kUAb/qnx7UazQqJVAROHygvLp/QWGd72mjDywKRNKUq5RKfyxgQdi5r69+DP39b+5b7/lii8qwzQx/lHhhPPU6S8GkjFTtJjsFymOH3PH6S+xgjA6UhUTs+7KntIzJOO2sifhmiO6nE1MuPRs62ZgkHaXtHxjSK9j4rvl3hToCWZICKIMkk9AAyJoWRg+yQKQ2uMcMzgCEje25R+iDQEiMisKxtQ7fSzv6CrWfWKLneJHADLDTbEICz5ubA7GBcY4D+aSYYGQoSSpQiKZpVAkNrxZw2KE8YtTHDZmHJj8PcK54kJ4yG+6A/YlO+/OCUmfZPcYtuhZurCI8cTQC72XCxA9iLuQiww/4ZC9oimW95j9ne2zcJAFcsKemAJ/vruIDg5P0M7h6QFcGpAQLl2GbJsg9sL6jd++WtLxpxRBBfd4tHRZx0of7UhpiMAHzcKxz8g887oFIdQLU7YuiPlrx/kihjkSAIwhgQZyWP3WsGHwP248OHyO3yrPtBUcvR0MGQy1+uqm9vZgZ/PFC62YsZ2s/bMdae3/Kv/9f+QEB0aohfmnnLSdHNvktX0+UivRqySF4oOToLzGmuHSQDRHblQCUBSG718mUQfZZZnJEcgJ7V9Lap3FKZijzE1lGWJSlG1Ub/Ya6g+QrZCTdSIQF7/kZcEU9q94WqxvLyollGPHiDK2N6nTwzcQZLGeuRX+FOVksVbsw5TZm/Gch5xsPhyZCJ/AT3n6XvjkfQWO26e0oqJsIZ/gz3Dk8FnQPylBT+Kic+IHep444+qPBxzrQrWX0FKWhuCOQ9oObrJULb0u1us5Ryl6BLWDGxlA9HoRYXvD9A1oCEvvxbUN3BCm/MINJp8/8OcN3Ogi+sB8ER4PwPwk7F3kaspsx2ptExP4tKwN2FXvZcwal5Ds+jm/z0L5fYirF7NdmFtyVZTNogFlKAtDzsyU74Mxx/JUcgo+918yUsJ0FmhukeEh75lSQf4Xb8Rh++Us8Qzloowvum7imcoHwyb66XFJbY7/livE6LiG3OILtEbFEm4layMiomlR8ZRJRDFTILOIYp6KX5z4UyaoKsvc5KYA0iiNUG8kuerYerjd3YTOkuwu8UDdv7CttYx23FXid3t78096QpWWacYnz7TYKYnneV7SPLvB9w85zelCfJ8neymT7YtAfMj5Dj+IxSfHJ+e/0RxFtxN3kwvdgoSRR+1A0hLTCUFB0jZlhl1Kbi+XwhG7ASnYSYXf3iQOrnygM3tIif0VPFvgBEYIbUw91j//jCcbbz82eIJdhY54oePI9kZvBFh/oITe0QaKQoXAjfbc7juGwQZBwI0RnKzFvRhxuf8gmPe4GZ30zzNbJKUUrq4Z/RVj6qTVF9B7ASe0q+Vpu3HDupCmWOOljA8GJ9YiM8gAC+I3L2eA3Ik3EbmReYH2eVW88t+u+Zs5nQBhmrpRz9mf5RUadJurjMuWzAf9BMOz7XXFx7kWRSNMBW2HIAcXvhB6AVSlBOoBHINPxrGXThkSdlYK7vE4rDwQJ8oRc7cbIGdwdKVyCSywQZl2w5KmgEzR6LwoyoXm92/cL3Q7RoYlKn5rRsb1D3KXCewOTY3BrnEC5YW/6Z6Kc0HBvAAzsunHPW9z3MQaiwfGMpXDXFZIrLF4S5i35jX3HjMkcqHEALbKuZz0kKLek7M+FWWmkawPxjOXuanypHiw5xCWkDKVkQRDU4+tsMwx7JpPDzsO2p2/dbtfMQvuZuDBKagq+c6PBbDgoNvPAGw7onjv+lvq8AfqYQHPylRT5WtZzS4GUypF6aZiefgg94yyg4O/oZWxdDOQJ9YI1dAK3B6LVLSimm7C/XI50leSc+I9cyu/46J2Wr1avZ6Lq8Yl2AOPRqYrSTIifp6Wg2XSapZ2+YmgFiOgwyS3lv0OlCccJvAY0gcvAQ5h5VCPyvLs+ogzY663JnDOmjJB7soWe8btFGfBS1tYiaXf3TJPu+wFSF2Mry4Ju5i/Bc+xM9R2RrphrWy76NsIwTDwymBBHtG4CPzhsbZ8pC3/hqfiwteJl8NXkah/cPlnUJ46f0tZL5wBjqbaVYAJwsMsjBAVQlBcTu21TbFgs6n8dxlsCt5p+qCWhZ8BBW2JUMePfMHSBYSdFOaSJzZKuZUVcq0ScjMoNiCD4hYERNk/hNd7YvC3SGinN6B+i7L+jMrdUzFsljAJQCUXsJH8l50FwWLiE3WXwduQQUznO83j9tFJPe+95kSVNVvD", 16000);
+	memcpy_s(_servicemanager + 16000, 20196, "qZWQVELdXKXrZg+1g8lrpWqJJvrAn4sr7KP0FX/4Rs5Ui92qk1adf2JqUIKSmaeEnBdKopuw8O7yC1Sm2rmzyK7JUsJrCOurCza7KFjIvb6jQm/vuBaLlE9slkUZCkdNRjc2X7C+cCTqQ6I59gq9lEiOu07v/lEsGg0a0btHNjyWUQHaVazXhA+HgXDQTRFAFjVVslka2W2WBY7PPdsomWwUG7U/t22ykJ7K5f2J10uZ1klZXiOzavnX0hdtAfCs7wGKyDmeZ3XvWS/7G6tQP6dXNp2CklHFEb1xIiXnSi9f79Jle0x1xUWG+Y4NrQEk3at6UqmgDnBzyUQ9WdVnJczhZaYl6pfkC9zbpGjk41F7G11i5bCEdPzVmCmm7BaxTFm9FM/oyQIl6vEROZviWhZtEGYG9Fcbi7ztYBehw8MFqhAyxD/bQG4rwflektR+1sO5WQtS+INsl8IyYpcvABWGKX70EjkmoQ52Uip5T0B7i066neJ6q3tW1fhUUnDBlYxWdMJO4A/8Zdrlv0w4cn6ws7DfJn1uqXvTHJaQTe0eZ8bQdQs2oRdsBs/hElpJn+rt3lVXJ0sbUkpI/Jh7bJvYcFGwbVCv51ZJNACZA8V3ZxlGKHv0yCaEvW7J2gSw8ET/ASBvEGm52MJaNrNdQK1OvI8tpWI4F9SWMyvaaW81XlDl5jSsXxTzQDrgdOaimNaUoAQz2O9VE34knZSVYHfGPuuY96NjhhLQk1Q0a3NXByi5j1f/uurnw498+S4WQk+Emipxtz+nlwJBwk0jCtJnB3mYraQS8h7bwSudJOGObKozkWYaHC0wyyet432sDW1QTrpcfiPMUQgeH56b5DluYnAnHOx9nZ8srDZvs4hF06zcz7qfi66wzKszXUaX57UpuDb1yaMuTTyrf+mVmSIxzmMuTA8VpFmX2VLwpDWeWKIX+/zssrcv4NpIDbFVbA/eLKGZjPqSpumWc5ciXKamzzTb5kFTE2xHOMpIH5SQqUO18dS04OIRehumuFEFQa8pLwnlf6B6pqtCvdOa+tpQ6PcpLtafib3fB4u3FxEj38ycPgXKEzi+vZAWY/qCtCROT4sPMFoIpE2YlXKAGQy0+eIiI0hRKW0t6jvijS385CcM3Lu4R2/OxeLuHNup9pjWF0z1z6XkPUYgopsPgQ84DLKT3F+XU9Lx38f4HtDRBYt2UaXczkAvRH53QoCCX91zaTPsOCx1wYTuSSx/6WBlHXIdI3+GppIn6oZE6GhYmbZ08tzN7kRUdPKI0SFck2yZdP7TpZ+J2AIJpNJJmZHFtxFSD26EHEgHYrsfAYbmOZQZ3FqJi/ZJ3amvbcEwsBQc64FSAD16qp4lp0lb5ITuEoLt8ayB4z8QaZ8r0xgWstFhh9W7IS9dEvMSEfDSZbfrcrEqyNkisTMJ/FLv5la7XHaVX1chWUDe1yeXSOBeYtUfUtbGIjwPCH9CZkmqOIIlqY1EMjqOFk5AFopPxQvxd2VTqVNVJV73LXKFd7r7uZdE9UAh15K60P3dwTahPfw74TbvlAuT3OnxABc+lAOWq3jeY0/a4xwzd3NLUqPDmAXifbU/Nd9I4854BJdGNr5A74eK4AXk5RNY/xTxgckQvw/Gq3IbCcte8BBz9iRFMa/itZ+E1ZHxIu9MgCZfFkAVztgby2Fy8STKwDCqMXAM9IUS1Mtmn4y8bndGjTiyJPA7aUKvmoe8rgmXk7seiMjU7arSq7Chs78VO7uyDQfol8wuXsbdeZ7L1lN2v1imLRJLnICPqWk8Nk4ygLDA4kazEfgmCi4IXI5joL8XL96uxvMY28lFMsBnJv2/XProaMeSE+f7RzDmFqa8YK/1IK2xfchMjqiYSFzhDNDPiZ0fNrFzmNudEEnYlgyjmDI9pZHvdjF+v+uKBh/hC69M7enSQB5sOLrUnSfPZQ8vuk3IfQBnUPr11c3+27q0+eIFGRrWy3tf+3Bgg5EN1sj+ROwRsp+F5r7NnJrrKeSoXdYWhshFMQ+Wn5bca4K7uGC85+JUU6wzeFhwlPASysNTTOR5LndnXnTrknYRwnzICzGe8tdPpZtFTRNe9cLKSpq9Yl0zdVUuK9qlvso8lMuDcyETcolwPMXIxRDExyiND4785cKyzGBL/0lUIgk5llbnMt10uczQ2+GZoRfIVPwk0xA/WhJhQSHEvAMgh/yALEkYucoAKAD0WRkTiSr15UKFZNIjqdkwhcINvZvPp9L+4jIuIj1UCKy5FLDmbFidPFJ+eq57NzNZHnXm6Sy/4PY5PDlxXc+nnRHXcYB2f8Lk8xGS5G+G6iefHIkXEo8mEVqYg3ZoOGQmUXAf2YUY8CvUbYtWpiU0U6wRngwE8wNHDvIreYRpSAeBknoDb+qQPsoXv1a/caKqe1P4Wl15I61cNlZ2vt3V5sXKkGfs4xLq8+KP8vLypaGPmyPJaOoDmdu7L6HVV/RY+7L265+l4rNUTGTVzpr25qDM/e1l2D0jJnNmnYj0Q3x2efGsMeGNUcG8UqGXA9zUBrmS9HX120Jt8gmZAjwbdbtYvkM6zSV0xKdgytJI2iQxT1N3uKe0iFjynkAiv6GhTydw4g/pmnqLLFlV0dTEyw2vx5mcN2QERwEn5BzgJR9CXEaHUIGRALrS9JkJG2T9kZ3qBoKMocK+pGgQoywm6B5xGyi4/QM7e24kr1lWtIF8c3hZ4JP5oLeoymsHlxJmlc/mbirB7nXT5QLbNpkkQC4b71lS7478scl/wxdzyzxiaw/HpR4nT9U9J5t6cjxj0eRNz0zhwZZmA0N9LUcszNqjqw/EwyoRGCGcwP5ZUlKSJ5n2J/1p88fIIpIUacCf9U5jeN7ntsg8c8KZ54kXnXg+scvPNO9xCU2eZ19s9gNJHn6uhR+Vm+A5/cCCOsuCMWgPQSGRqsgyjnUv4/zIk90I8e+JJ54/eIoGwM+1nALHXoRCOHP/dd3AUYdi3BLLOBmTYQ0u5URMutMwWVf2X/2gy0C+lKaqFXPCpVJBR6Y8HegufGPZHG2TvAzFpBMA8Ycq9L6kVqA1di+wWeGHLrRNJXB4xnuKQrDPp8Pt/8ohrsuM0U9/dPAr6natb7+5MxbJMnFJb8FH4pyWcbv0e50ETiUvawuRsGl5+VdTff32QJnR7t+hJEo3f2+GcM8cAdu4YIf/mlt0PYtNPOvOrw9xDtJfBNVWaG02sJOMhgbnCrbiEW5ZUpZCI6obDIahesE1WqZpTMVxpJNIawCG3PwCqUk3aKN5/BVTiKoPD6fWZGqZGwgOF5VQ35DM0TF1V2zYSMaPZwNScy6kZLIlxtSClbGkSUPZwIuMfSpTLaJgD7XEDbJkQ31/PsulMB6MwAnGZyzZcEFljvGBqO0B+N981mViuI2N4LSpER9ZQ7C3SK8UVU3eVAWPQ3sXvJb5peoLN8vRF+b36z5eQj7swi9cPuzlKUmMrIFbbKaqQcaVKjeF2LQLMqWMcmeyUI7sDPmxJ0s4ZXNPwU/PzP2vxdzZfEYrioLOXdJGnZxaCo3nerZBfHMddyNnjhkNjBaADn4N+BG4nISLewmediTUo50YfLafH8WhlnPCjGbJp6gWPUb1tI/TZj8ixT0uLCV3kHtle+iCs+eQV65sm/ynCYcUUW1S6DB2cK6qDwt51na+ZPcixnixFh+56WE39Jx8dIlZARlSYzTYh8zzl6ScpQDg7zeloGRNEKdG2QrX6KGmEK/emBBV0I+WnhHMYdXGVP4Z8lAL+ZcytOsxvgnnnGqqol2JbxdXgM2nSQKVIm2ZuCcqw9AzZN1nttpDXqGx1IORqccxf7IhHPl9JxriwSI3QqqErsuIEcSkVcwrmmlJqioPtiULQsfuaLTZhm9xQogfWZpOkscyFhB44KECIAResqJQ4SZsTUWAzetnuJ5YPzal4b/+GjzRcDVpyKI2HcsGRoEd9MKnM7B3ddw6PojZpt5UtWDD6uu3zeBrUFoiXxpTzYKMebDb5Sdtc6YAL3KMdhZB5EPjXRjGIact5qnTm6iMtqxte4BwKpB9dPqB2OTiH2FP0QZF3VC2GNLgaaQnO2Z1UUjJtfYb8WuQYLE8mZojLCNkq1+BSuVkMRAXEuVCYN+llQWIRBC4Ob5gHV3suqiDV4XlDEMgjXFgGMHT6YkD8tQPP+GeCil2cOuykZIc8hY+moD2sRCVRXD9qCp0Ji8NWe6ZkTMZIESjH7MWIkaYWC8exIFkzBRNCMI9pWdIxm1lT8KclYlQUwzcDk2YkK6FMMADzm5IbgosWEGKRvtM5qxQHu6lMnmbjYhJ3ONgoBjU/IfGviqhJprd63folTQlLhbFBIIw240VEN4+UbKkQH+gJciKFNqluOxIbdGksuqI8Kfk6htpgczv1+/fSgzO4rJv56GqlbxcY1Ww8yTum0nC8ntXNvawijYw4bK4Qp4ooELJbJ6UsStAIrZbi43waxWIxrniM42xazsnmYD96nQvy1eFIrk16lsxXXMpB+wZNO0VrAiQ9bFQ0VKb6TtLGi65koxE1hXTN55h8Kkpagn9hSCd+iidncFEFBU3s3U9z1aNulomN8UHxVMGYFNWmd+fY0qc19+PZ+peRIOg1ZIkGtKkOvtppYMzSCogbNRlEBAokh/wR9AqWLWdQEDZNxpAEsrU88enBwftg9385n3S/l+L9MVs02eaD9L8VIPMXFo6mv8bM9r5MjxLCf4IYaIRCmkQII5FE54LTvLdA6A23o+SxAHwGjGtZdxCtdwDZ9wUXsoY1UcApuMYKaHAImfjwEt8qWfQ0LIOoc3vjRLmibsb84DjChEf0hX4kBiuk31X9JguKfz16ht/xwwn2n1viJsr7EUhePDf99XdjqHw8Vsw7DOrQWPh6W5UyCaM941vS4YbJwl39bnGSOwr9XPBIG0HlX3DHnepHv/KOzZo9xf7NTbHMTfi26JPcGt8C9ENDBRM8dLtAbnDz22Fe5zUlP2S4QVC03mnHHvc1o4gFzSN4aDbl01Jg8yX5kTuK5e3qKfjinwjkjZA3tr5ICYCGAazGvOvtVo+epfMgwEmzo9s7yWHBd8re4r8vsMA6fFoCbRR59TkuHmjDxhDyuVzdnjRSj6+Qx/CE9dh2PzVAyjgIp0qoX5u5TKMEsqqrA2t0e+r4l7lsFYmMWdI4uHnW6H4Cwc/hOuF79HfpYECd7aZlp1Gral6aGr4CMYaR32Owrrw4GJiYxwI+vp4ImmEk/xShwH8EfaK3WGyUchj3QF/8XCch5st34AY9qJHxCXAjBkVXN7CxkX4x1QLY/LhKz0N9SQzZnphHsf8+OXhaHGhUovyVLiMptsl99HBlTMc/+JR+aKOxBshV/G5kPvuk7IFcJs2j+yp4miEH9+mgPxNkg40hmLIb6nhKiv4EVYJQy73IQhlB+gagzGeuSIv5hjkEJEsmXYqk5LdtokkqJIPO/5SqaAtGYMto5lMz/uX4JMmywNk6RhTk1uS/rmnaJJxC4/gm6EMRxYiNy/44Qyd96wSwhaFR4Y+NKTxjq4OZCOUS7N9wpAFkiIEB2wTWGoxdkkUKWJig+UMJOflLCRItxu7m558V3M+G0RLhiXZfyMIi499LRXQZMH3S7TaODHkiWTIlM7MUO4mpIgxWRo4o8nxsgs4BWmOGkNZs8jN11M5ZHnGwZtJSANkWKCESv8XfkURUgZh2ENN7Yg15I0QAPYBodwkRCAElBJKB4eYmA6djXQ9bcZSUVAPuBOFwk8Sm6Ks0F+RT5gm1kikhptWu7XTsuG/SQEnPkmLn6QXsuHtHE5krdPcp3kqGoViAAskD5sH90Sa7O6Xm5h1WPKZZCgk5Cqf44Hgq+Ax5kiU6EwZyDTxRjAEFPoZYTtSdcxrPFU3t2UfgNWbarWE3N/VWpiMpw2VzyQV+EeVl/GyYeiQKUQmB4+clkMstSCy8E/9d9Q5bTZbnU4cpg44L0EQUzyLFkGL18JPaJQr7G07tGlMJ40+uZ+iTtG5U13d2YkeGFjRvrd+WrXDfhxKsO9gL0YHnHIXJkdFnbr9U1Brm6B0NaaWPpYspR8fDexOoQMNbkWyK2cMY/Pc+xwCd7ygD4xojYwI0+NUUrMMZ0xqZh1Lu9PY2mttC+N/nUC7rZjk1u4s8A5Y3cVi8YJ90IXBtPfzCJY28nIZXx3KP0r8ci4hz8pyFg6wodUq+pP8qZZ4ROFXJeQR01X+/1DG5eNZLoCqbtrwvSPQMSAx37JZW4uwNjIUwtto6Q33MC5pqlbela09ybRI8UIReszG/KIVON5DLBQZOTD7AqzNbTWJbfrY1rbHLx3Rjf34CEtnSzY6yo/QUycYVKwCkCJb08tLMKSIglYI9lXelg35soAnO6ztsqXbDYQf+wOM8iSAJ3xo00BT1y6VYQ2TagmtlkLGWXQpKdPhifxUI0HW2FQ1sUbH4b5cLqf0dvjJ41JS1KkhH9upcphn5s8/UUSJ3wOjiKIjGa9QTuuK6OkP9BLLOrQRUW4T+Wz7bdKsoqGxoqqKKWNEDcxwCKS+nYMsgszW0G/odXEzzaY3hmDtNxPTjH5Z6DQvGs2T9uFByLSyvl2yW+eJjB6hPG1r1lptr1VYFYcBbqa0u4XbIiE/fVLv6/G9k4kShMDfPamb1P/r+xn9qtjoV2tLG76/e6HRr75a1vA93dfERl+r3s/oa87oI+Lr6SpuJC3B9Wqq2bdXXuv4rN1sXew02nunxy0GVCdkHXrhEFuO/6lVE6HCsAxmmEfJ1pFsKPpgA9XQO31qmIIghEghYImvMT+srWNumES1a8VNDEKfNbqB1qIJIVRCpgVqrQZAvRISn1mFJx6yF6yFBeepR3DueMecSXYm6IH+BsXUxjj9zc34kSx20xwqJYdmxtjeZq4EQx6WP05l4/aDDGdLh+V3H1qfy5DkRN2X+iNFkyFh4OfOSWu/221ODUPWLDx5lqGrHdnqdtnIzKDrE9dr2x1FGhguKMS76vGicGlIqbsGRYeNAeTnsFLudxglF+A0B2gLN1kO0FLF/0boDG3AKAvQxF3Yodt7RNpF2z6ivHWbL5G+plhHhrcn+in+RDtlTlZ4tWJiY04hR8PYVglYd4czTTbA4vPcckl3AYvx3s2ow8t3IbiLXom8fzt5LVYqYc/QDjYLNX0GW1J5rP2Sy03xeK6xAYUkDU01+0C3AX1z+1Ts0lLYkkEScbHTF9jg0HFjoZ3NdC1vxe18GVONPHG6RdS0EBsOsepIecw/qAAgl48Xcpjo7gRy8Trd2mFB+Vxw2ySHecbcTuhwN3e9xiRRSK7o5jPJ9yRTfrUeymPSsEax5XC4c3LeOG51u/tK39BN/RIvhHNFG+gz01kkZ5hn4bF0u6f2SEOXyLbrzsiXwqKJFuN2y4e0jVkTBynnWHkykDKuw9IiaPIMwccCkEu7c2hnwCmbKtBdtbRahdOfZP8XbqYelnK5SBnjEc/THrZCR7JBw+8eeJBHdu/cZLgQRQbyP9Zk2CnT8iWRHZJHg7ZlWli6W/IAlFsM6z5sFF2qum4UIrJqhC2EMtgqqIJWq7X14pMZ24G+rw+US5DE1ZvVJwTWsTyRFCMeLH7h0ejPOiL5XBARynnebXXhCtI63YxOf8L6wdHgvKX8KZzF0lRbl67MXlkBraDjOsjrubDwg1yk8h3BJqLT7fykOOu9WofNZmJcUMUlJUYeS96y0pDdkKk/1/QJiTwZKxbINi6x2/0k9RGKofMSzV26KM2IyLikIEM/pVeCZ9hE4mDilH+qMxcFTCleQBCfTSBcJC5ew6Ve1uMS4jYWjZp55GCZ9E4a347ZDsn10dQnSsgOJxgx40AikIBkjwWwPNYH/r34Mfqz7r9Rrflu/3D7Av9rdcqdi/an084x+hPFl9k9Pkosc3jyzj8s30SMMIQpaHBc3IwMkA2NDrVPliWcHgjGe3rcdXzQp3N9nRPyaeg6pGkSDhG1y8/Dsnlxt+UE3Ux8FpQQ3xOE4ObDyChkFznhSj0T8oHSCPBATNpduAMBY3qrsx1ujRv9ACX3ib+dCC0sHWRpHJo9qBKUPXfoUpWGJh7rrJcP39bFNVku0P/3C8tsGpH0kyuJjo4Pz9rbrQ0UGiOZXP+49fG0fYzr77T3WtQr1UEHrZPzw+MP7YNdgRaw0MaFtzeQOZpaWCxriXXKyEaVOe0Z3eQKWrQallgXNnhp3bD9do44+acbVBNuYt3CkFSmEBfFOjT6mHjqv94BiPMLmTjNEytNlAGc/6vnKrhyxZhqoaIYnHSJAPgrXfRHA8Xwoo8P2otOHmx3FQc4aEySNsCA+1ZgMqJY1QvMJs16buUI/XrH0DAn1FxYbF8dQvxXDBLiz66JXblE3W4UHkKDPXFxmpOXu7uLoivHoSsnjq5EpKi6NLgw+hd9spWDfoVZTKy0gVEXRi+M+hj5ByPXiLThYtR4jHoLbR0enrBCBLGfWx2C2YNDNvZ58rqYanRgZNZR7tfVGBKRtUFoLGqMciHEiUO1iyegYcRpGYIiZrwM7RbLRAhMjZSJjoc6J3w7XOvG64lOWHMQUQvFyc2cJjHBlMvbsB08KIwlq/emu9xSGEcOXBw5TOA5kqQ3R2ic3Z6XhZFigR92Ci/U389s6XBP/EKays+nn/xMgn/5cjdmbGRl1VPJsgsQLbIh2vgFIQgsl4N+HiJM/51LoecNUih7ICPG9yIf/mJSIUkWJLbFOxSCV7ulpKt8GuDTth0i3XwHvhfUaVJFetzDFRUPfiVF8AqKnNHvWyqiKiMK2zu2b6LIxTcae/NEUoQFmPksvumyI2umDPNHvh8eHZjwoAipHZY172Kn5Hh4xEkF61L2GIBSDEU2GQM1SZYSvHQhbACzMjRT8AIom3jVwcUPVzLSrZFsoN965qBEkpu4A4MqcNdUapehoBopVIwYo2Z0ANJCqqzdeMSin8fMkUMjaSbJrsSdh0bmrTnS9St6riMyjsPRirM5ilgnGAWkm8rL6oofF0EtIV8U0taIeimqsHkKy/2RjlY0lOsAUOAQDJugDZQTaYwZByhch6PojdQJaEtRoj4lnWVGdhQRhhpP9oIHC9ehK4gZMmHdjqRrGdY9SSdIoEP6tWwYEK9E+W7Uakd93YBrvdRbP4uINtXS2AQuRHmevKQI6jI5f0ac3+FzqxNFJuETG5VKIjaN0d/ZTQ4T532ccGrRl2pI8OYMQH9kqjsbDmGCoxdViJihwQFx21KXAf6GXHoeYxsmhq/w1U87rQtspza366uCNcjarL95KVz88KheFW2cXofBJqpQFKx1J1iO7t/i2byAs8I0sEPry6lrm7J1QQgV2R49ew4ErFJOzMeJkSWfrRIIuEgaK17jE2mmoV/vMEeQsURRBxsrq9U5PFDGMlbTN1Y8LofIg1pwBCCqFMQ5VaskW08emjZky7jdWKnOY3A1TzN5fQifTzv386RyNkOPLiLAIYQJJy+sB4WyCsFB9wdx9JzPCTZDPCi5sofluWZuLjFCP8ZbJoj+RM9IBFOO9I08Ef9Iso8kUtqMM2FLnEB/ZtSlWYYxeIxOmpDxhhbOeN9IKku3s0VLJ+dquGcfUKgvKNzpM5pqV0JXWYfcNBq3John196yFrx2NOV1o8u5oSohe2yWTBFx1+bck3Ybc5jMhG244yZkfYUdqBgFKSYohmzHg5pn9FeMqZbPcB0d2xA8bkYX4WAlaarEtCssiH3gxfoB/NXT7wyFSnc7eiHNRkqGDliMQ+pQgkiU349inEALjB4gNw1qwq4rYk0mMAjetplOwK4xdaOesz/LK/ERI0ltySzrpx1IskI23uJDPQDVuUSCu6/bUzESD/QQPPZVWTLEEWATV0/qXw0NfYoJGRZgWjRSc9PSJwviMbSnTMjlwVs8Miqs1YE8IeoyuktRCc0kDU4AWinqzEXKxrk4l3mcANPdiSENFMCdpCIqqOIuZn9UPuNZGnBkkyomgxLqTfF3eAQnMhVtJMMhAPUWYY4w0Q1LHqDeLWoftE/YeU40npoWFqRXMlQjmy3vO8k6njWeXGTy2tFzcOCzC9xwGzhK6emjPNXMkXKJhcLd3d18Pk9cyAEQfWEz3vdFR+TQ5l3JY7tX8dK/rgrcdsr1mHPU4U3nQAVorZ327knreN+juBLvK9EXDcxpruWGqu5hfUXW4BhBHhRO4CO0xJWiqrCF6TujSryCTouENtxmhRTy4FY3bHb6MPkC5YrC+69zvqhsGEJFoQwZMV8GrMypCQXZyOh4587XXJqpyXuCN/ggI54mhI78JirXNn8ZyehSV1V9Bj5yds6aMho7eqSNZoZuyWV0LJEtDGskabA1AhWwRBzImDWRNUpSVJOnuA1rhD+VcOXvsJa3CKSYI/SxhT2AVY1rTgz5Gs5yK6Y5lc2yEIPmkZJv37auP4/V6d7agd4c6h9OqwedztnW6dHZRDpX8b8z9cv52dWHU/Xs8OPZ/pv++M31oIHLtdTW8ZW6f3xSvR6Md2731t6v9pQ3n893Rp/Pmy9n0vnHDyetN+88ZWo3119unTJmr9b/0NQOqp8/va9+aF4N5Zk+bO+q4/aOOdw7/zxsK8cfO6fHu53Tm522sjVoNz+P27vWpLc7G+6dNIbvm6Pvnz999JW7Gu5/X7/+sntW26u9XMVl/9N+d6x/OV//0G42cPtn36Xd18P3qwdqX/sy+Vw7HX4+v7n9cr5zJXe2bgfnL6fS+Uvt/W3jxfvvbVrn3Xt18O7stqc0bppKY/hlfIWfb6mfa6PrdnNwMtjduR3sqtMvt1s/vnx6X5POD9R1vTl229jCYz0Y9Zpb2yenH99geE8+rr5/f7rzcSivWR8/nr0/OF1bfYPH96K9M1Pet26Ojqtf3p+0zvptpTG2Yf7U/DhqDwFHN9efaztmu3VwcLyztXXWGr7BuGDwuG1fNrdGg5o5fL9mDnu7Z9OjTwez3q6Kcf1xtoff7TUbyt5te3J4uzXrYxoYNLd+DM7f/xi8a+vvtxtmG/7t3qi98aAqNYdX+80rC9r5snasf9jd6cHnT50rqP/m/S3ByfcvzcbVx+pq67S1c9ppYFjfHay2m6vf2802eY7Hc8VoaXikNJT3O1vvj1sw1lOF4Pb8QO/dNrTT2tntYKx+/9LBMBH8nl3Z+Lz8qH/orx1f95vDSfudCf1OvihbvXazFUo3GL6qhGGF9vl5s+eqvfvyGo9dbO7Pb358+ai/7++qV0edj3p792A0aHrH0W5efWieq15afYdhbDZuj5Q3V18+fb7uaWdmb9scDnZHag/mtOmFbbD7ZtaPpakGqSPVVLPXbFj7J6e0j0awLWec7w6qvbWt2Zfzj1p7e328P9Tf2+MRwssMl8e03/z03sJzOm43PyoOH+gQOh9LHydvmtp7Fc/PqK/hifpk4vLQb4P8hbXe1KowfyOM1x8fmup/mkOVzR+02b7i2hx+wrAxHL1vfsLj265iALZC1n1jgkn0vYTn38EJpkWYp/Z2+8Ve7VgdKG+mg/Mb06EHXL55TtdWWx0RvgQ4AhgJPxu/nPTGfbP9busWr188pn02j228hFS19+5A5dt4v+q2gcd7PajtTChf6EN5jBsX30J1zr/gMWF8Yr6M1/uPLx1MZ9stBfNIDLtK1wXQ2kf2uYHbPTH/Q9+9mX2Afmzcf7z6zyGev/74zFfvzQzGwObLLWfPD2vj86fj1f7Mbv/qfz9wY2irZz8+nw/UQ8Wl1faOPS6L9vfuhvR1+c6mjePXdh+XnTbrd6L2azvfm+OzdQnP7z6WM1hVcGQ0F+YVrxHYOt8X+LEVvuQk/FHNfIIffzNaeCL9sPqf4cdfnx39S2jBTimBleOjxvF+B+vHJU7hKS5qZz1vnKTZOHl29z89dz/Y67Y7dgnXyQc3D4z+ynQygDtOpcEgNDDMduAL7x8k3BMX72jLPhI6jBUShRk3DnNZA3mK+yTpd0kSLq1PvVES7s0jN76Lxzn+FbmOZ2tHBzQekBBFGBu76bL57vhwv3XYuVjGZZcBlzCy3SvYvqa3xa3YeSKeyqoOA9mYaqp8Lavoa21t/eW3xUF9tIXoHZ4+8Y6uuvrqW+wGxuMGT7FAqVgIBcZNtyCWF4GTap/Pd/SXxuCIRuGkZ60Jl75Hpn1f8HRbtq1lVelVGMDsb5bdZWFxEewu4tgAuxhbWHYwKPgMJ6k7y7B1I5LO4oFRHN7lPaI5S4cPsUtmx3qzSyqRyhLtkdB8Biyi5/OnBnsDSXEW4XNfT7Eu9E2QlXHLv05OZQa5gkC4IGvsXNIss67JFhwzWNE1VdFkxgQFW2hcYu64UAtfWSC9KALOcUeKNtxW4EiEbtzW4zaoxZpsYfFADrzUU5zXvalV88WA7IgrmQ+VKWJB5JakDSRjcDi1JlOL3GP6ZKU/a6iuayus6YUDWrJvJYcA1pH79bVHCv6IACcuapzFgycQSwzQ87+R4eRhLOy8zreUMTHAFCHFdn2MNXtlBfJoJ3O0UN6oKpJZjxNpog3G6ZWu5FLM8gVz0NyLs4rvoXwx1gdTVQ67oT1FK8vxfPmbjN6Ft5v0qiPksSfpY/o+XecS1RLgOPXKCv2MaGzViiHDkXaxSee1JbdFdkA7k5qUBvKIfviLJR3xZl/5mIKoo0EQdLd5GhByq4lZ6s+r7ZEp/xEoY8muUpvQICDmlFkR9tFSeoGenW1YgsPmR6Y8HehOiQLY6NsEacVo5e6XJOvRTe9KJ8Bkt6V7642vBooRWy0fnfo8Kxz+nbIsYAVbWTaYEZkkBZQhcNXgVb87VWDPKL/15s2r6urL16+rL9fXG6tvtv6z85/Wm63W+vqb1fXm6uv8ZnxTFJD3HV+iqPzerf7hY+3NTP70fvKlNqq2t9uz/ZOrYef8ZfXL+WyI3932d9/cfv50POnV1j80r24mn2tn037t7Kr97mz6ZffsloQDdba2+rs736Xd0+HJrvr9y/nLH186s+HZ+Oy2X1Ove0rjdu97Y/iBlG0obpn25HA2edlbOx32zndeshCJ1X7tFEI5Jv3brbF0fqO2d8/Wcb8z/G7SU7a+92qrEHoz6o0hDGMwGewOSehHu2XDdzptqur1oLNlff50NezV3lc/n6vT9m5r+BnG29m6/qJA2AIP79YIQrFoWNOoOnjXeLV3+2ZtsNaffv60NfpcG6l74ze3X27fmLAl39MO1P7tm/3O6cHOiXqws3fSnsIW+9n5S/PLp4MfEOrS/3Q26Y8xrnbf47HtzPq7AN+O0sP99nZ31toYt/i5hsuoX5pb1d4tGd9af6xWIURkr7n1o1f7Uh3Udm6/fJxcSZ8OqvidMvh0DOVXe+NjtR8cB+DNXxbPwdYIz4MCoUKds32l3Xq/dVpVT/Yak0+ds+P2yerZaXtnsHWqvt86UY/fH+NyJ6vt4cfqm8PjlnraOX1zeHq7dXSsbOH3mEaq6uFxczb8cq5C+MctzFGfhCPsD3tr7aF0TuYI973+4bR2pjI62bdx1979cm3D3l+DcBkVz/U+4GX6Ze1s9AXTwJfam9qXT+9JuEz73ZbaH69O+msHmBZf/mhDucYEz8Uqnv8djK83UzzuCJysf/igvP7QHE4mX5SGjuG8xnTyo3/7ctQfD2p7Yzssq/G6vb0/aWomo4ODawzrNZ6vaW/3jfahOcC0uaN9OdGHX3Z31B7uE8LrWLgHhIiRsIz2u9nQDsdo71SH52t2eNzZ4P3t1X9Y6NSsP37zHWhlj4Zo6B9OTBKOBeF97Xf7w6POFg2xmU2qfe3qAwnpw3D1bxtvXPo61d877Z9aeB1NIXykr/Qne+NVvEYwvJ/a0y+1s6obBjbi+sa0tfalt69WYS2+aY4PRoPdA/3Du2E0HvC7QxsWF5eqTMLh8Pi0KoQirkmfjr9LzZC+zqp82yNY73gMJFTo/Q/dCcfCOPqx54Y0MrzRf3gd43X+xvzSIaGP+vtVWo6sG2V96uKZldfeq5/PTRv33z9/wjTYHJD5Cuuzt9Yg88E9/w5016vdYD4AoZdD7RTC5t5tQVjTFPep+coreF2PpB9h4zxe7d/2X/HwQajVh3f7U7xuO3aIGB7zhC9jz38sTNrZtDeGkKfZEEK/2tvV4fvbhuGhl9qXHxg/U4DvS+vLpLd7diKfv/z+odm/Hnw6IKGlEBK5V1tV+7XRpU3r/dvXWrtpDv3r5/zH+wE8f3/7BkJVtQ+dl9XeKuE/GI7hxIeXN/yYWAiXO6Z3fNmIua76Qwy9c33Jt7f7HsJRDZtescwaf/50Zg629di5xXzc6I3frDF5Y30+f3l1qDQixr8ziJp7El4ZtkaG9TofjrWZqA0EnPBYeRxE5l9LanAiDQYQGu2oBFib1PuF12gFFQq4kbIqa0PiAbW1B/fJ6iv8a72I/oVeF5P6maVMbRSmQXG7BLlZLxdvXvAKz56s+Qe4HmvgufX4Gx63WgUfEqIPLMPPjNkbGI1JPks2DTZuf6f3W9sNsLfRminfmw1iXJf+snigIsV5rZHppZh0R/JNvhhfPT6lQHwEWRJNCKTxDVXHSVhdYtCbYPBc6mjAmOsfhC0VeqtG8OaDDNfDpLsgYmEI05nHCbdBLAzNTx1gudjYY5MupNvyFYMh/ZYv7wafhW3YxfbvEHBfH08kjVzc9wvZ9Poj7BVFU3Ej79mP8+UZjlrRhV/CskvfhZz2q8OBvghqDzkHaJ/mE1tFnlOvTiMEVULJsOP2hsIOKRLQnnj0UKY99bQhOOmSzg0kY6Zo6bPOZUgh5223UkH7Uh8ddoJZ4KhXd0Kvd+K28+Ap+gN3+vZKvv2d20EGefC2Ag+72ltKWL/zy55VxUT1tmK/pjnowq78kaawcUJoQyQz6x+4VTioXvmd3CHwlmS4wF/CmiYECwsPkfRViAzkyNCH+HHDGE7HsmaZ9kj8jjRW+UXdriwZhhRfkGbJoqVD8JIUM+ZgK4R0uWzFae6hxoRXIClBrDGkjU1sImaZCQ/Tbfwr7vZb0shCFuTc/pAwI5WoKQkhBVUxgcLyb/+4GauIXdpWz62Wqzl6EhSDV8+dnuysvM79ETbLpAHo++0v24fNk89HLfbs6HRrr91EuZVKpTGZqDJqYtEyxeOvVLZPttHRXrtzgnA/lUrrIIdyI8uabFQqs9msLEFxkERQ0KxgypzIhnULp5pXcIXywBrk4kGhHz2jia2AkTZQ+lZCGWet7Ek9WY1cIHYNRg9htGAL0TgCcNuxJzhUGoUC6A/mWQRWX+yPGMgc80wB9vFUa1h7ujRIhtdljyna/yDLk4aqXMtR7XPsZAkCOoRjBMCKILuwsvYoSA4HORJHUVWpdBAr/7YSAVeW+08CjTPZlNh69Gz8Ehq/JNI34OwEaw2WpcptDXOja0lNg8m3Cq40lI3fBWOL3lbsCqHDjWFIlUSO9LZCPv+eD7nWLW5vbk/pGZJxW9mTplqf7YpGWCikA5GU7nHXSmbosUSHuYzrd2wdkWmF4bemIEkF1+EtoojKx+dQ9t436BABBKxGq7AQ6UqVDl7l8FeKGESgn6/Kt/JFj/igxHUVT5JmmCM7E7l8YxlS34IZA8sv0FVRzBYXuU00sasSihyoWOb68EhCEZSAtycEJR19avQzI8XjQhJoNeqWkExzNE8mY/Ys8uZMr23GoZGaY+zidLKwyeEHSK9nh78E39pgJ5h6zuhgu5+TuRA1SC6r8BuDwmzAk5t8V9V79qGNCmVLnNUoQdthrCDEWHRdgif6lazxmY24d3agVyXQaqCB8kSfFIohnD2kpCxfFYpkssp5kucmojE/OdgQ+l1JGPhgEzQurRLi9blnc/WRDXHXWmY/CxnN3I+w/ez+JJiYvvvE4w1nFOryCjeW0fKtZfQA9rL4JHhM5mcz+YmZySsqESASsOmfwWQO8NOfx2727sWZQBjAwE2QuWHP+V3abNbYnjJWCPAnesdtOJVNFsVCPdzLtEAQcfyLH0YKDuab/xhm7Db/lXSehYeFW+dRA54vxwmy4DbF38TxsWRfB0pydvyt", 16000);
+	memcpy_s(_servicemanager + 32000, 4196, "/RvR2MIWQjLn4e0HfhsXvq+wlQrG2lC2TvEjjTewoIP4yQsqDJe6OiA9eTr+g9s9D+n5nT6Wd0jFgtfegY1YrwuFWCwQfQ5qa8S7zXBlf6gMEjCwa+jTSXs7DgHxLiY6+tReIzdAnTUgcPulPtO4Gq7tTMJxuCEnzGCcH4PNZVpfFee9JLOYEhn+ocX1n2HQ802P9U+s6anG7HX71ARnyfvfFWjWKq81f+d1jMVs2J7azVE73Azs2Nq2d9DdBpJUx3/J+QRiWOq971jPIpavRk/ykENV5BgPP2bOUIe8+gAcpnZ+QDzCfGa9axOD4r3Hzq8X/DWY6hes4dcvfTFgke6XmaKt1ZJ2xtk0gFx24i7MK2WyLavYgtpSNMwdBFwkxq2wGuQlVrg+T7si1MqhTFC9wZiEA7PyfV0Y64SBatdfAZ2YyeS/0Tzr9DTVWq3b7Y8HUIMcI6s0UfPdYbvZQvjTZ1Q5QJVt+IvtsCr6NxrIKk164jO3c/lvEMgD9LmB1sODeOaJSgC9F9XQb27LdPZs+rRpyb7FjNB+Vdzx5Sw551AUpjHqDbcZSgmBoJfZ3amyYdgFXKBq5V3Z2pNMqwVvC8VUktEeArkqqxDhAkNU3QnI/AB13kVc3C4PebLAE76CH2FGadxG3Kc8ZJj+IN8W4Nu7D63PZVjh6r6EqUqDG1w7hzsn543jVre7r/QN3dQvrW73HBOTPjO73ebUgHTpZ9SS7nYdXHe7Nn4TEEUWQUGW4+czPKqGJT/Jdp+jfV7dxw7BbBFxqwpcZXh/ZzqXeAoz+oCkP22js2UE+aNioqkytDhQTHpNUIZGE85xpju/GSoJUgXOBiUCSUCXFPudRZKlyBORVWoJtcGLfndS4650jgm68+9NOTTiKGLyIHUgX7SgTY4jDELS16dYAmu6hXqyB6wSiuoiArBlXi0llFIxIVNUyPrMds2TnaSfUldceqT7PPa+5MPqMQfVmQRPwyZ921rlxESrd8k5Hu22IvefFk/tGI0EN50rKIpe/m6ncV0kf+J95dCJHhGf1nXl0jskeudI9rQ/CyUmSJ+UIFKwLSI8whmGQFrhRaWdIK0uQ+rNxTKrpBZVSSLQFlkCGaCWIqFi4JkvJEs8mh5NxptNpjDR9ixU0jCHn56zhJHPM4f5e3CYhVLcLs4FXKdWZOUOnCyi+8FwP5m4mX0vFrubL4mkePasnORkWiLtMkN9eU0/uvX+AMZ3rKDkGUUwdVEUR3GPxCTYkglMIHVi5krYzOfjIU/RzuYCwMakAE4NcKq2YoEmCRvMPtufIfRMrqIL7rssZ27svpYwPaFN3dMMZQE7bXObzz4nJJZnzs5W7TjUbV0UxGG0NWC7HxTzeKppNPVl6uG7PoyQOGABk2QRZn73wGquoJaYrMXdZJNO6dSxB3eOxy2tyCHfpT3jnW3Zi5/9jt2lSjwAbuMJo06XgkfRRTYHE+cgNIxj0fV0v/vnYbuIQW4bsytMtnHdmYZwDJM/KOUQQ/13eiwm8ThE+qkwxnbcD7eFIrJfmjjSDJR4achyzxwIkGIoZ15iOEYivXriUIrJ8YW8i32rs50MARaBrCwyJ3JfuVT66J7CRsI3zy5gsctGPk0kiWggyTw8fGDJt9J5bqIzLQgJzOeFL8EmejLUelFHfS6TdkQi7eCVbDmjz9urORe3OfsOtlx0S5GWZmTcymVH1kz5YUONykY/bqM1JuIoG6VEDf7w6MAUG/1fhs4S72UXolHVRFzaIvB4Gv0ytmJGun5VxvYMcXf/iWkGQra0PMr/Tx5/lWZXaGUHPudzYh3l7/KCBfHT7dZePZfbTFFjgnFmXaLc11S1IBWJUl/dVN4e7Gy+eKEUU9RNMx4akfqrgv4PVf77tbry5hv5tWIL+eANKzT9/K+VYrpeUgLFIe5fZrdLf+VKgP8S+lXZTN0ambhSLmXFeYri8wxE8U0YoNxcmJ5jr9EMYeHhnAiWGZxvJAmxJpJhygU/NyljfjAuhJ4w9h5rJ22Ja8FLNaXyiUyE+EQIiHBeOpsjQ17Y3pqniEQPlXZhOqdH/oLi6RVJcHwrYZMSo4tk+iIIFEn5AJNOCrsRm4uIebupmISuoYCmUg2z64aYeZIOacK8dLHKcHsXrDDSACdenXs/oj3/ZGVtpskFGXUzrBdtwikHqXyqYvlERsHO+xFJlWmTgbQCSR3Y2Ov54tfqN8Zg4KyT43+4oLel5AnxOtXcgvl89r2IMWOhdrNLvwZqHJkxbx5iPz8lCzrEaHZs/JAgYf6QiD98OPRUCN3Lcmxu93QbHpM1NTR/iWLgDIdrryP7QkH+sBONaA5Y99EGPd1HpQctNsKOyLndzWjEd9hJujBPGG3ZdikktG0XS9U2c5wlNE3PT6dsmkaOx7fskCHD9spY0qQhWOxAJkf0YVu71Aur9LLlCO8a74LJ9abmbU+/yd3XgRDhOJcHNaoitMGJiVakG7Sio4kygD99fYyRPGAWUP6OqPWr9Xo3t9rNQb/4SzfXzW0iymF/rcKxKrOEujn8P+6dqKTw6GvtG4Zlno/1BAh4A0LoIkKB3BQUtV6CoLG+4tQgGJGVJf7Kw3pYjPFmVs3PZVbueFMkc4oNg3ZLJN0uLxJEInDKI25Pjd9XE8RtkK2LdjZP5nEen7VPHtUdOLgKtmRyZRITjJseyUh3tHmJyPa48QqIEYZ+sUmUG3tGeMEIzWx68+nih7Tghd15IDWe333tK+8yTFXprVxiAUfYN3ygnmo78GWwQquE5oyIgAKSEfn7I0fiNyMzBIe0xeqEosKrGogLAW8nRBJ4R1lCuA+PaHgQcRBrttujT7DPvYd6g1RpP3umy5+SLvMr05+cOj1ck6ao5+mTPilMyAULbh6omOPmLl71gbwytRTVm8PRk+bvqHHyzt7P9GWBp10CiZTQajGyBT59fUQ7LtCJrdnbheFNsbfBdrwU9gMylHGp6EH9tr+18dq5KeThQgC2oEEVj0aQr6AN2A++AiyIH+h37xHku5CMWywzPtZF+3LhBwzAb20sFbOBpWeNJ7ZzM6wVvi4tin+XzWmPFi6slsgDluZohYIfngC0PxvE4IKZo9gMUwxPlTh0dGSLJOlsnm8jS/fmLvXV9TkSPM10/Wn/+be5FJZTjty0TvZoc8R8ggdxiQvQH6S854ZbkowQbXheVJzn0DJpFWaDuHkgb0quRDYv8TOomcsVSUHMAHORVOwM2osYfoceOJ+z+tDdPOBqIJjA64gkAMx1g4lebNwRBygKKeA2n4tc22Qsm93I/CF4OPSGerPY9Xtr7CGbsrUtm5hYaDyA/Zh7Zpb3Dnd32nstzNQ9iNrTh0MgMtZHuVwmQYLdYMojf+9dv66dBprtdqextdfaLvpHPo/GBNA8HnTMYgrUdqRKX5UlbTppaAMquxIH471eQBkQpxrISuP2LtJN7y+/OXcCte7mAeAigSV3dTSBuIQA/amXcDjiyQiKIe/Cxh9QgEI0Haro8JTfD1xOntR0xIb3wk3rWp+dAvCqZlibKaKImlF4CDBCQkYIiJ4E8nXjHPTuYoJkayzhF1GXOYKEuHuaAS2wqILrzyH1aBQEgSUHSqKgDeshhDvF0kpEl2iHJEAR6zeGT3HcQiRFNitechgbfuAjIF9fnunohqsaQKid9i6cyOFpVZDx0fUHU0wo9EpR1ajpDRBBSBn3MsawEpg4cpwc9/n7mfz9msCkfNc9hjOsiEIO8/rGgUE6Lk+m5qiQX+m9WodKHjWKK8DfB+hqDUV3Fp1rLfkGbAK4sMdI/oYUGMiW1B/JwOMhn2FICYtuxqxvZrc9/cgp+eBzDbDNwEQRtcqhGW94KSFW0DCcPje5rSWfIdi6CZqCrZs0xmDIbWHLFG/+lF/sTIsnO9sf3q8bHExfq982o+2HJOWGn9xQZSHSABmSXOflFNTgw3hIgju+zUXviMCorBhTzXu4CPNBzLr4bnysMWbj1lNrMbUgufEFFIOExmNVg8WDKGMQH32PnbCWECJEi0KnBTx3xgXsoJi93CzmUIwBHm4bRYaVLwUu1zCKukQvHccI1Rk4dpmgLsSmHkzHATyqRIqI9xREOg/XhWT/xuWcc0cSrjrWB1M8E/LNRDcs003euE93tDf9JcpsqxuMf3nmK808owKXajAs+doeytZhh6WTwx3wXzcZvP8fFz2ZlA==", 4196);
+	ILibDuktape_AddCompressedModuleEx(ctx, "service-manager", _servicemanager, "2026-10-18T15:28:26.000+00:00");
 	free(_servicemanager);
 
-	duk_peval_string_noresult(ctx, "addCompressedModule('user-sessions', Buffer.from('eJztff132ri26M+3a/V/UFlzLuaUkJCmX+mhs2hCWt4kpDeQ6cxLcnMdMOAWbI5tSnIzfX/721sftmxLxiak7cyUc6YBe0vakrb2l7a2Nv/58MGeO7vx7NE4INtb9Rek7QTWhOy53sz1zMB2nYcPHj44tPuW41sDMncGlkeCsUWaM7MPf/ibKvnV8nyAJtu1LWIgQIm/KlVePXxw487J1LwhjhuQuW9BDbZPhvbEItZ135oFxHZI353OJrbp9C2ysIMxbYXXUXv44Hdeg3sVmABsAvgMfg1lMGIGiC2BzzgIZrubm4vFomZSTGuuN9qcMDh/87C91+p0WxuALZY4dSaW7xPP+vfc9qCbVzfEnAEyffMKUJyYC+J6xBx5FrwLXER24dmB7YyqxHeHwcL0rIcPBrYfePbVPIiNk0AN+isDwEiZDik1u6TdLZE3zW67W3344EO79+74tEc+NE9Omp1eu9Ulxydk77iz3+61jzvw64A0O7+TX9qd/SqxYJSgFet65iH2gKKNI2gNYLi6lhVrfugydPyZ1beHdh865Yzm5sgiI/ez5TnQFzKzvKnt4yz6gNzg4YOJPbUDSgR+ukfQyD83cfA+mx7pHPfaB79fHhyfXPbetbuX3Va3CwiTBtl6lYJoHh4KgC5A1DnEh6PLD70uf3G5967ZedvCCq63tt9IMO+PP7RO3pwcN/f3mt0eBdiuv+Dv37/pMYBuq9drd95KtbzYqj+RoJrvj7qn3fetzj59uxN/ddLqnh61ZIDnKoDmae/4qNlr71GQ+nYchiHSa/ZOuxIeTQF0crwHfb38r9PWye+X7Q6MDFbFBu16a2dLjFzv+JdWh4GxV1tbors995PlnPowMdEw0me9m5kFz2JwXYvObXuAwALV1skJzEi70z09OGjvtVud3uUb+No6oUAC6l2r+f7y/7ZOji+PWkfHER5bHBc+Ob3uJdBq9/iwhX87rb0eEZ8GMWCAKq/SkPvtbgyYQm7LkCfQZi9dJYN8ooBMVskgd2RIQWaHx29hxBN1PtVBHhwkIJ+pIfd+Ick6n6sgTztxWAr5QgUZjUHv5PiQQ75UQe6dtJq9VqLOpgqy1zo5anciYAr5phLO59vT9v5lc29/jy2py+7x6cle65X08k2z10Pqfd+CF51e820LEW22O7D0ZDhprt8fNn+/xEXRou0M504fGQyw88l86rw3Pd8yBmZgVsnAovzH8ioPH9wyro4VBkjLPiCLUDUfGF5gRKCvIkDPCgDq7II/Ag5o4GMb2TerpMLe8MrxYw9BeNF3Z/ZFbWI5IxBEr8lWhdxifbXZ3B9HAJVX5Asry/8AyNxziAF/EZMv2EOpj7hS+Sr0jahXKAxrl8dXH61+0EZuUwYR6W34HLL8SlROpZNRtj5bTuCXK7UWfmlBx6Hntb45mRhYVZUE3tyqRJ2q9T3LDCwKbZT7Y+D81qCsBZi4/U9Z7+eOAsIcDI6sYOwOwvJVEvbb4MNHx4b1lgHhAGpqCVvR1fMoVdEreTjZcxjMoTnxLfmV62hxTBTFcUxWjKW1uCmbZhWwKpC+Zp7bh6mtzSZmAEQ5JQ2Y8YXtPNkupwmS1Qjk8Bmk7jvXTfcpgprC4hmbE3gfksrlW8uxPLt/xF6VK6lCn0D4W5Mn29hduZbaHp3zDoj/z9Z7z72+Mcq/cNjaYJJVFS8qZvKtFRyaftDyPNfLXwoYFRRs9rH5PVgF7sQKBZhMeZmV7E1c33oHuszEKkeTQIt5N9EPabyjKheBn2dMPgS+ObMVYxKrKd25ljOfWqBhi175zSKl/2tueTdiPBykIqqmfShSx4k1AoU05EgdN0DFkNZTpJpTZ00VHYB6fWRNXe8mVupL9BXq7I8NsBgqyrn7Eptg2pA5+Ayzk2cemxRSS9usogTSzQksdfjddAZtB+wBc2L/r9W1B3nL742t/ieqm0G/r8CAGtuzvGVxtERTyQIoPvKtaAap6TN/GWv3lkzpl11SFtP+3l3g3AdoD8XmHgTRGMoO9m1/hjO3S+pf8rVSPnW8ZbWna/JmfS/I0+sTBNzR9JrWkkRnbg8OPHfaBfvNGTW1pdj7nnt6SuV4KBzk58YIKlMTMH645vIr5eNyudo81alfTc9GC9WoP0uuM3topAozHBN9SYNp2qBoVzlulRpFEMyASrzdRG/wIylFWDKB6Jf4TwsE29IagazcBYH1484nA+pT6LsOWLEB8Wln0EbH7qS4zxclW9HNIIwGp6aCokMjjY5nlvOeCf9yRVVOudClUpRVaFiqsixIUFpGEhFFih+CvjGfNft9d+4EwGx04kWLd4+u/zTaaZ6ewdGjn2qDJFzx6Rk0yk8HT6yX5tOXG9bL/acbO1dbWxvms6vBxnD4ZGc4fFp/9nTnRQy1pXZNZnPmc3PwYmunvnG189Tc2Omb1saL5+aTDcvqX13tPHthvrTq6eaU5lFmO8+G1rOXT58+23i+tQPtPDe3Nl4Mt3c2+tsvBi+fPBsOzJ3nKtHARXQ3gIlC4j4rMw0LeDWsJscBC4SqteIH1TPwd3dsDtwFfgNu3pch26hcwd9DZNfoR8IfJ5ZvBRTaXTgUCuRj+SLJNpEu9yamD6gsXfSoInApC8th5JnT8i7ZqqoBm8x7hwTfMacWQNY1kB9c7xMgvQ/qcj9A3WOXbGtAj1tHoHvukiea95F+ukt2NDBoAnKMnuowsun8RKg/0wDuu1PTFkDPNUB8IumMA9gLHdjEBuPuzdyeDDpz1EUA9mUmrBhX3RQwKHlc67o5YKAwq4M5WMA4fHXdHDDQd6Y3QKcrg9XNB4NtDgboHkVA3aQIVH0wySiiuqkJEQ3cvjtBJxtC6+YHV0bPZqOkm55Dd+Q6Akg3OW2n706BSN/cwKpFQN3MHM+DkSsBbusmR9R4AMuIQermRlQZQWZPDS5phFq2SDiYbkoksNY1AmqnxHWG9khUp5sKUDzsAV1TAlI3IbxhTjW/7iCsdl78E7BXQhMOQV8mFI40C7b9E9cNZO2QPTGydUKQQnMQrJ4d3GhU3FBTSymDUtla4L6ZD4eWZ1RquIdhtZ3ghfG0Sp7GpYVotjkAMsF9CxMWsf/Wc+czTfPvgUoCrPdVuhYTa5H8FkldVXiFuCKhs6sMqSNVYNPkCfz3dGenCnIg+X8F4kxpfZRLaUWsp9Qo03QX98lGiu4qO6Qy9Aw1krV9y7OGBmjarHkt0hrERfustDzdqIqdAtpPtg9bRoVVSW7DueHOrnSNikexznFL1MjozBKln1sIFBO1lkgbHFkBV4SPFw4To/IyUrw2ZjlMLajDmU8mCrJ1WAuZi62+tb2jIvkBFc6rlsaWmXg/ZD7oJfVAJakyqaUeTr6u1SsKnrvFdAW+PQjYzlPxstSrPmd7WVu69zl4T7pk1JfQMJOMKkO7EVcFpZEgBaVsa2KMIwOY+n2ZQXpg2hO2RfxvVJwJd/USG/0l5DGrLO6nYhXG2UXS5DPGVXkXsMrGgnKGRiMHM0tapZFX1Bir+Fe6O9QOIBwntp1It5RnsZ6lFrliFoFECpNHbHAUNi3bkYk4Z3y7s0obrYJKHiPwtTSC6nw1Il0qeTIbkYg8cwzkSvRMPE3vKdGzck/yYZDornJVoKj0HHghtgCS/D9J/ym/A8rKELUIceR41RTfq3Leq3rDGVQR95XoBUOKpLcxOK3LP3N5sRC72qUPqg3leBxr6YnSlQZvbmnRXVbBB3tgbZ/2Dl6Ibu+KiqQ3uAB26b8ZCsGXZes3g43EKEq9svKxn8QOaohLWo8GcX9iLoS6HvDImoRCoIAw/IgxmPAwWz9g1L2CynuFJtgJ7Y2Vj+PpFjJulmRs+eDaSHRJLMpqHItVqJ6SO8G9ZfSrZqDBxEBiquWtv5ra+asYORgthr8gKP53K9GfDL4ovVLMDVtGDKBmorFh5K04UdtVDcPQktQa0qiYu2hry4j3LC/5p2l/CeH/oPo/GdWHez4J0g+5eGqs7kxhCdRk/k/r7rNt91OqsUmBOuLpEo+FpOiFQ5O1q2/QmUrvY9kDUHKvD/gHFAs6S0a54165gxsycUcjoDUbdxjUdqUR101T/YTlgtqPk7YnxWMjc8suFtmiWntzVD/jDu+a5AuuLFnq+8KUlFFjD+8HscixnIna3tzzLCfmyuKPjP5Vzh3O26TWgW9nNmCzAveh+mJh6yLFc9KhGQbzKVFzEFCrspbWwlnSjS3lKWyhLOUqaJ/xiDeqX9rkXwzvDB3wFXn82M7nHeNzRAckIaht8k8xpGIS+LR1qW7bIDvkZ1LfJugArlRJblCFSoyofKRKcchIdiluBTRd/HysSZsuUJ/UraXo7RDcWNF3oxKOD9vF0zYfek5i+3RnRXB5QeiOBNmp6AfgQoEAroIQiQYR+4IVnY/xY03imVoG87Emm+F6DqhAiDWyH3OjrdCExMsUjSh8m4w1nUnVXkDzH/MZR2lpHFsfaYWHRX3WBtbQdjA8ZWZ5wQ0XzlUS7c7eAqFP5mD0+WN3wZ4eOxMBWSFfVFwNuDAU7F+Fwl7jeNUoA9EvrOzRaOJeAc1dOu4RjIw5st7PpzM9m9/cJB8s4vAjEz6MAwHz2SRTVpjMoHQVzxmQoRX0x/BmYTsDYJJjahqmuTsveIkF5RhHKLbB323gO02QAgfhpR1rEavQuMXjKLCWdtXnEGB80/XUZiYXgDxIJLNVGjpqXdtBLGy07w6sMHSU1ReSUWZonSGXGC+cWAxsNhIIHUNinNOHKLUGnR6nqDk97ze2NRmwaR647NgPhl+PEeI6IDSUGVQ4d0ZmsGBBdbf6c9O3yMICeKcckIUJAFARiswcMWdKfIaeO6VtyjRQZsFpZdqmOWdtQv+I2Q/m0NgNntGhhey+5/qB2f/E49nA8pj38XySGci1UooOQaCjY3cyAPyUKOH5HzBgpuZs7HrseM7cx36yJVkj7SHiQ3vtuIsq/sDjTwOoHOOLsYIPdL345Hk0bDYMmA1FAu8GK3NwaG6IPZ1aAxs4++RGM7EhBEyrbwVt8dOIaMS3JsP8W1DQxQ6sZTpGgPrY/GwlV3iVddAhItQPsacj0LeAvYXd49zG1+91IWry2sH1lHxWy454jdWB9F3VnVhKc1HxiTXJwxpptNI7Oqrpl8uoWYGUOgQKtFOdCFW1i+FNa0cqK2aqIH4YB7V2/JRBVhmIbW5yS7cGFqahn9saldT6Yda/Z91U6fL4+cK0mZSan4/F898xLj/1R8v5vL+wURojcI1Xkn/V95EHqeTnrho+2eACRsicKtpb0m68/cRRrIy2xUcWbpYwyFA59UF3BhbvSHwQJ8/PQDEnquKD/ItWeYYDMKEDcJFUCKypHUiHVtLwWp4kf1Kko/pcgfj6tAQuNczsHNtfZqCl8z3f3VDTA4tLRlpZ6OCg6PzQsQiPi62hQxkDl1VUcJX4yd+vxFLAMjPnkyDH2Mniopw+qHx22vmlc/yhQxhGF8zNI6G4ToqJn3DOgXxoTc1QrG5MXccOcJ+TU4F/TYOAD1ut92uhhCSiiePU60KYVXvZgSXQ7oB20tzrtX9t3WMP1jzgHP/7xj11UP3u+K+TbcTQTZ/uz4Esug8Y/xaeJKGKqZ3LfGsQ7UYj4v2XY+saJgX+Lae2VXSt4iFlaJNVwN1A21vV+IMl/rqtrP1M1Ufwv1gj6L9+FmskcJk70uBdWpuopZOltlTyIpNjUpO9pefBkwOXv5qcfYv1casAmuKzZOGY/UEfl35zL9faSX7yrKXkh3alfn9d4Zbh1+3P9v31591x76v0JYeeuUrV0erMMtnvYaEuGd4rE/MY3Bxan60JDLNyORcYvdWGROkl+MG0lkzdgB+dgcUBdsafnnHJ3en86dmW1Jv99tFRK30sNs/nO2BeOaq8Jwt0uRGoK51oMOYXiOeOwZhRDHdRpgeZ2M78ukz++IMoXw89y7ryB4r8Ier9RZYmpjw2/UN3ZDt7ATLcpa7BkRXsyglPcrsFowgLqUU8gILnLtK5YSQgvbeFxnuM7clA3gqkDy5n4ox1zbq2+gf2BN5sXtnOpj+Gbp6V4c+FbgnQGmp+MHDnAfzBGLhyOQ8sOl2Rmcc398Zz51PoY8LqHjcIfRiJDtW2XaoF22FHOIzSYgyyyPYx7MmGZibkD2IuPpHyLVAGGC/kp23ypXzu4D7juVPKrnhh2kELALVGRXrSGqkRqkE3puw8UamkqSdjfostmSxyLo0G01N7UKomyTCbbjXhLdqDQQJgGoUlwFcaDqeBpCOmCblYw2pf0hnWEht6eeTVkBkKBY3MWgz0oyIDzu2BL2ffUn3uYfmG1aaWcJ7Vmlqp+VZprFHL81SN4uOVG83RbMQggNpxTx2302Gy/iBQa/n83CmT8v+UiZYhaCqLuEvBkuXw3dD2/KABrCFT7ciqgTK2oVG6BRxWrsRpsFRxP6HzBZgHMoz/uUuFmE/ObtRf2f9yXmHQ3MoV3a5cEj+sV7RHZ/ZFtVkt7d6lV/hh401K//DPz9k/u+QW/sW9EPwhnlYJ/DOw/L788As8plNeJc2zJxf4b53++/TiblhxOqoWJqRS+O7LykQsSPBL8bEtfeHLrlDLQoLnaGypFMdPLGlN8rPEimRM//90jzvoNvUtI8lhl9kTYmcEQ+HqBq2IJeqxhzcG1F6lEgWs60wDP0N3Z0lk/ne1XZ5UKF+s5u9NRt1Ro4w1XlhWrbPxaIGEquzE9oMw7WVSdAlJVHQNC252VlwCDazJKoJrXaKGSZjtlSXMKoIlIU7w1CVgT1YTKah2up/Odi4aMIw0FNV1AtBtMc/ACtVFcgmlkQg/puIpJpLCwF3FK4xvFo+PHeyneAUaawweBRkQAB0CKsjwb53/3V5JmFF6Ki7AyoUHS4zURXFhmcN4jErGRM/9CB9x1KB+NxFEq1kCQw9MSIclaLM8CTA7GAEkjIYNSwNMX2Oa4Lk41Z9VeaYMxEq/P9lH7VOQ/dxRQ/7zP1nvpbTIK0/rYowyU6rudVZlOSrED0swgHY7myV3lmu7lPfzDIpe1FCfhUkaWNfHQ6PMc0KRI9MxR5ZXrpDXQB7UMhcF2Gl+EKGjwbSsfjPB6xW0b/0BvFpvnBNdI20nMKClClDy1HZybioU2FAQTp1YY3ldy3liqLJBMl5rXqlz26Qfrlnn+6r+iHv1Q2gbiyRP0vsw8qwZKb113KlFEosJnQsYAlVSqHkbB7uSS/PJMpdmDkOInofRuy7LZWRvBvP6hRStKVARa0pyXS8vo0j88vemNjlgTm7sruQGjDiTtPB7uQSvgcIiL07n4BUX8Vx7twFh0H3RnYKa7BCUwMdb/6JBe7aDpR/TLCeMRvHtK74LRL7g/2j7P8j2r0e298UkD+klTD+YpIraRAWp0xpyRmf5XXiwP568gD2hceBoO2YfUl8jiefZVrw/58/SXYLzErJDMSpIbuelGJEJGssgsaUWYbSrpiUD1SFWLPK6EV7BEqVHSepz4oi96AYLsJY6VcYjXeTg+LQTD4GQj4NH38Jhp7txl8cOC2m97GMuR7GLlpECA3HPKlqjZ/HBBnhN6jkSCMTtxxKGduDJJxJG2obHGEf2Z3wxnym5QEjM8Ttm8sTtstFPL8BvsHK+xmK5T+/o0vV5R59oQT9oAd/nXfydq/g4c/k17+zLXIP/8k/psyzop8zlmyzojyzmg8wlZVbwF/LspcqYBZXvMJev0E/7CsN5Vmk6cR5f7rb3AZ/XVIwlHIa+cBgqRucH311ZKwq5LmbZEFyXbMwIy4uCShKd04+uDZiQcgVVJaHAU5iGmkVzozMXo2bUZThglTrMKnVysUWiCiXQbmoDb/vJAb7GsDZpRpFSZM86kTGbs848cIVXdlKlyrZOlmtRm5ukhwF0ZGHiHaeE9VtkklumdfF0LCLTkA/zNHfUulIuzU+d5DOzaGBPaUFNCNaK2t0q6UtphgcSaiYLi6XOgPHBS3Ext4PIAYLJKMyRaS8fX6hQOcTVqI6VR/vx41XH2rcCvKEBKC5Toa+Sp1uZ9mmcoNeQQk2fufyHICikgGsjMUWoJe7cPFoSQqky2tIccDF2M0UE90sKjem29IpKAxOkgcmkgYldDHVuU9ZrlaFb4hvohob5uv5zCUPEShWhFAol8RVQaFj+Swl/nmeHIS1xKK3CVPSBtbkGdw2RJCtEkBSMHLlrxIjWiloSi5g7QmQtkSFai8pgZPd4q/K6ITnTc+NMdBGTWapOsTAUbU0+SxHYKPHcpflnOIHJ/9v871kAi3Jzk9oJvFr2rjBWeW1MlgqPB2uu1/AM4XkCxSJWaVX0v+BgZkbT5NVRNbC5AZdF2hSPsMkVWXOHqJgsSzesWvH8XizesMPfw07SHaIbv0lI5XdhwKoRyWfE6ssW5/CrGrP6eovAAgLQfucganMrf2Nr4Qh2ni05zZafrYnl0gQD8aVNNkj9IkxbK1KVKppQJ1nlOXbr2Vqjej+owY8OLtUnlZGHmm4xnDK4acYo4ifMt/zJusEkl7hJpYbMCLKCQmdQ/oJmND4Nd7LE46qc5RgeVNmi3ZUyxc7pVR/R9qchyqrzHosPDi1AQT9NL/A/2MEYhFvgb5YrSNMgay2YZlGVNtox3/VhNGSRGDkTyyXPA6o8vp+ZQKPd/mx7mMATuu6nbBIuxGB2sES+k4BzKftwmBAei4exn0r6ZmJQnsR5bPZEDTPMwS5mUb6DlU6k1A6D4goWwP72eXi1gRq0BJMWFKnh0mYczpluuKIzoGMOC8149q9qmNKUn9hUXJuR9JfIDWSclczehg01iyGqEwukvryXZtHqP2AJ6gpS1ARaCVDJpjd3NueBIvuwui6qDTAvUkwfAHM+OYwa/FKdS7r87nTY8w7+y1xVLPFj5qlDG9ur4U1pB0SOcbjDdrkGFdUKlX/Gf0mMnN10mo5mYc8NZab2yFGYumhBvO4PRynCxoQkqHF3b5w+0LcV9DepZolcA99HqmmNuQXKGhdReHFfMjs2fqQLCoAhAx7aZPOsCjx87k7mU+c9E8/DEXVElM8DvFMsnq+VldBNC01IQCHOti4oG8HcL0ftTplHmdTgu6xQceB6RvpHTZ3N36I6m7+tUKfARorCF5VJGRSEfptX+1LdMkSh5biYlLua+eOgExENChddpq/6PtzRX32b8Kv7vyMDARQmkliFwmhDIotOaaMhVG80zkucns8lK+inbRqZWmgHTkU1S60Mdkbi5+XmCNlNbpkkr5ihqZJ9meexJ9+A3r7PyL1YJCjO/pPXjSgseUjQBbeLXjgHnXQ/1eG/J8XJID3C1A+sygailweyLKqqpUIoESYOigTaSA5NTUgH5pyeOBcCi12lUIpxas6cz8IHaHqFrBmHKvpkyu2cV7dd8swYEkFTQ+UHGf/Fyfi+KbcuU+5W2kRfjVypwDlNkGz4cAkbXp4i54dycOeVlDpNIFbSuVhKKI/lnTa89F1sOD6vXlVLm/yIy9WZefGoUXJcOsGy6sAW25fzMvMOl2AhlvDfqggTP5f2rM/+4V/gKkUXaMYWck51Y7lDDsyV2cTsw1BUL8rV8kW5knltHXMPJ2k6eppB1LE8VtJFiLe8+C4MztyCWdOFlycdVDIGMb9V5rriUUuNZH80TO5HMMjdRNXMJxsW2XDRI4d/ZuxPfxqe3UFX3F81NjsjquAbx2YbbD+50miUcAJK9xAlSciU+vgiRDd3z7Y2Xl483syNKf1c8iycGE42vwJyjKrEzOsnverJYavztveuWLUp7DbMeTAmtcLo0WI63B4/E9htPCtWr8ibxEITRNTAP3yWOooNSTqQ4BqxST+ehcVjEQUYSSCGt8p6IkILiiFbJOyd5At4/e7C41MbYgqtlEm5LMGb2gNLKJd8g+d6ue0mJOpZStTIOwFJCbr0ZmJ3hk/8b+wl+LPLxfROyncSJJk3DKFEFAe885fVZD3UsZDw3DgKMxaPec3FL490soNptTQLfHylNfBSY/xopZyfKixBaF43GvWKunHVTq2mq7fqGpZJgjDUtGhp7t4uVu4+gj3WE6shH7MWC5idYJAOuW6p9wWWntHOTyLavEzZAQqxO8WR2+r8uwU36DLCAjKQWr7l8SMQ+Ucg8tcMRMYVyhUQ3K3jX2vCam9QJ8HdGDlvp2Bcs2KpqDfF74QJqgGqKOcVsMsZ8qyMRvazzsZKxx5+BB2TnGIrflgrb6zxnyRM2dcl8Usfyu0WO5Qbju+PGOc/cYzzV2Hqwl1ylpVvVV30MjvPem7muv6o7a8oDhVB4AWHUduLzCJE9nT9wy9V2WxUncLTyD6XOZKda8t/fdl/l9j73ISpLv5Vl+WFblnez+AWOFSQaxRXUAKSIGse7lUM0Gj/fcV0wOHu/MfG1quP/8JgOq4ePH78cfWMtrgV//FCDvBjugV/Tg9LaKLFxScjpWlGyN6S0iw/8HXSF5ujV3rfbEaTd10Kq55joWUzzrJkNImfVHBb7JALztvqY5AKwd/cJG8sIEMLsyT45g1x3Ct3cEPYtU4ja0BcB+xvKyj7hIY8YxYF38LrwUCHwkQLAGmSt/tH6swVSNyYBFOcW6D3IikiL7CPslLKb47bwOegk46s4Lc2fDWggmTv6VDT4jwsFX2/+KBGN29cYDg30TO+O7PcF4zVUswbRQ4kxcZzhJxoPqPj56dHzSG/iUEjvju16H1aVbxo6cq8mtwQvPOX/NrZy2DUX+PGsXvW5WMNf+1rIO7HX6auOdf1DwX9Zpoiha99WNV/pilbVG9d4aqH9fjS9DWtoHrftycos/GlFzoUUWU18IWA81z8UFwxjEotvWvojtc15Lk6Lusqh3u5wiHhATpdyQOEn/yXHizRf+m+d647DvKK+GzFFFY4FnjUECdQkpJeOpwiC/zwhMpdtOqEXqbXxPBzx9T/IocsV8i4NgZryhVUsJbcWaJXCsUqfgBSfI2+iX23d6C7HLiTAT1FJ58Ii17gWEUFv0UARAbM140vR6cgLBrmCEylNX5290MxOSyV9HEq6UBx8lifOGc8/zGH8hzO9ZNYX30SlVvq0i030qa8dp612ajxFHc5RD1PDmpBG289dz5TEEf43Bj9oA4ywtGgxDH60xHHSBDHqBhxLMauObVlsmBP/sbH4tgAfA02rlip7xOh/PxRvjBEui+lGD5/YaPnLriZWe4wrGq5DyX7snpBem3nszkBqsPqwRS0+vbQtjg1siZJ1KZG4dJdet83fYuUnfn0yvLKGjxEr8PrL2jDyTQbAgNcHCXdPezZaDDtvBAawsO9eqMuTbKha1TyotfCqyhgFWQhU5MvMgCssrIcxBuwB/JB8ULjTu2iJQ3KbWGNxS0aigcsfEPdcfYacSjo+VZN0Xd6XYHRr9xq75VZV/Dvio1I3gVxEIafgKFX2PGTMFSK8Zkif9Ara5jzTrnFTuW17JtbchGTMsUpbrQa9qNGIqVpIpXpRanwMbSEsM4dMp/nsFqu0HnDSm6iadssGDk/tJ1By/nccjChsiSx5Of5xNaV536imqkJHEexuaBJO4KvZlK2pqSoTA0/Te8EbSjq+Zh4hjQU5hOZ5UrwlNULPsj65CkTuRcwegeeO4XOGDOWkEntCKIuqo+IoWBwNNVSElcNvvixhwa2fRYvf/bx4mK1fGPpeqBbmhaKceCVUu6IKcGt5AxPj04Aa9DJjglGIUbbzX9i5XZZIp9CnqAlqbAUOmdEbwnNM06IeZKIp8g7f7YtTbfWLFXxs/o+2fd2Q1xGc4mULzhWmygqZ8y03bScz7YH7YiNsa0y/huAeKUClcvY0nlQip3IvtUIWPTrvq7DNwFYLb36Eh5aiQRvQxa8yszi4iAeP0CIRbcfMyvZYO+oGRxLMA5SOW9wWdE85ArPbrFMkKtKc/zoMh6mpXoOHNJsRtGEgvMsP671N1rF0lluwBvTTaMiKy2s0PCIPeJJlX6qN85L50CwP23zL9yrtIW3fNKliPm04R/614F/IjcEyUWv//Ef6tGH9a7UPDwpJZqaMpckZoupSjxZWm7aBKyiVCN2mLOkoTXQUMuAQjy7Dn6rqzSJ1TKWaFRchXZr0Cya0Hy2UJxzn2vKKlaEb/3V3Wpg8uGaWHLw82dS2jCvCTXCcO2krURpfc3FHZPRChNe2m+RzycMByyScoon9xGJe5wLvuoURE3vgXRkj3HudUY5gNrEmDhZQXAWrrbVrAG6xHj5dWnXolrqg1IsXQ7OxZaa1gamt8DbfxjobWLN/7jpNVFztIJtvnMmXe4aLTyu6NV5IqsqCDAQcVBzeGzZcmiIDOWc5yXjPNQE8RHLkLby1kqOG2E1EZ9iwhTpY/OKCbGR1t5Xba+19//eW6+2ar81IpjtKm5ZReQCq3ZEyQFzT8I3lneSAeMLJCH468ynSSpiT4XT7itkp0xsySdp4rvckI9Zod8l5XyNPEwDvz8hNRoiSjZPaWLQU8f+99yCJSzrF0maxRMq242G9K4iqxzr4F8aYsvPtQBHrCnnNYb5vEb4yeWE0sYqOG6gueNwiXPqOw1d+LGOUuuIzohP3gO9mt6NkIjSchplLKfRWpfT3a/3LLCNTyn3DmslFbqx2lpZmsno76uCSEmAcA/xvFa+B4NxbeybrMK/E9e0LCPQXNGpFDJTxckTOormwt+X9DiH3MB7ELiqsSmMKNld2Dno4pjtQ//7gevdxPMYi7Trd9Bqiyb7+bY8EYeHKxBsoFblium072vkg3PfowSJk0xJkn8p1/AflIr4l806fhM65h3pNo/ucb/5ie87EXGRAIu1uO4iP3g1dSKEOnI5FdH9TYXXTzooQltPHBRREHo8X3fk+tZnc4ul66YIKVPNsz/CS4iHTlUJvNUmL601y6xN5Zy/e7r5b7SIvjcyTg7h346I03S7NAv9qkRsD3rm1US2KJcIhYCDK2OQViF2e0BJHf58l1S8BtqEKdNTQ4b+K13lVJAa6UTdzCwVQao3FGO7n7ToWT0sUlXfv4aUcMZgGdtVrKZYPz5K+6JZ2zP2wPS8iOI/hogY2s3Q8AAfLYuLRA/HXSgMEntJwyuQDLaq0dNo9VX0+1CKcTjD6i9o/TkL2AMEx2KKAvk2gWiVWQt9b+55eLBDllexuwVVW7Yyk0y+FHwgxkbufBWFYAoTk8q6szL98ldlDAXXOx4EDVdztPXJ2MBSewJFziMmZhQyCgnxflPMZDZN4jezqqHCGz2Tr/3Ankwiyx1IKhydOvk5vIGTgBnVdsz4na5IthiRr8VMd79rZmYYbbrV+0juMjQyx5bfJvwouk44Rkg5xrD4nncehDKvN9YMzDLFR30PK8Umz02sTF9Kr3h+Eyvm24zdtcr1K8X54hAz1dY7TsXCdp5slyuYZuUQ4z+r5MjsH3er5MCzrDfdfVY6uSUfBLEAc/h5f75MHCYUUrv6wt2ZuXB6KMhqvdbJ0Xd5lU8Jx0y4kDZJWbr+6vz8um5hsCX8OS9V6V1+y7xKyarv5ikFMsySEYBXSkoIkQ9F42wOHoDegkzOc92gnKUNdK3JUKYj/H0PzqBItYfFtzH/E8jxZK+XBFKsIYIiMTO2fwKTJ88Ne5L3/iQ2kyzVU7qZkCtRWMuZTy0PWPFp0jEYf2Ok44PogRPPndq+JdMEfxSjPQqKY2ItRBEjmjvPoldWf9R3jymYlwDoTj7z+6KT51ZCmI/UZUxh5HMssamfAeTYdAaTuKs+fMilgBahmYSNwsKW3a6ymqTqFtfKDQklDXEo0rgr0WIDYOhsgRlGXjM7ABGQgMJQD1ESSsH/w+FJSErfnXt9xIZjwRfLr5SfhVlmWOAnOqlkM0LYFqjr+UnwYDoLOWX8LuOwyUTnUTizd6hqcN0iUi4yFw7gy5LWhBUklzTgAyhKDey7UxOw+Vnx7DGeGyjjDaxlmiA3AhCqrUKveMQG6AwaYp6g6CfOEgxHhnYRHyFWND1C4WDzBD3SFLMv2uvrYXyAdYflZdUpmsFwdUk8DgriU5mCRlbQowa9gZwzRjnsBuoULdghJXAAPlcoIWWb3bAb+Mx2Btb18ZDqmVFIEs0PRLDQGdhJ7BLpyA2TUbEdViw9q8RawQQo319LNMs3LIM5Dmiq1pgvI4EUlokUlXCTiwHx+Xz4YOoO5mA0Wdcz1wt8ztqRwrs8xRyt/v8DoYSWXw==', 'base64'), '2022-03-29T11:33:55.000-07:00');");
+	duk_peval_string_noresult(ctx, "addCompressedModule('user-sessions', Buffer.from('eNrtff1b27iy8M+3z9P/Qc2ze+OchpBQ+rGw2T4UQsu7LfSSsN29wOGaxEncJnaOPxq4nLx/+52RZFu2JX+EwLa79JwliT2SRtJoZjSaGa3/4/GjXXt27ZijsUc2mq1X5MDyjAnZtZ2Z7eieaVuPHz1+9N7sG5ZrDIhvDQyHeGOD7Mz0PnzwN3Xym+G4AE02Gk2iIUCFv6rUth8/urZ9MtWviWV7xHcNqMF0ydCcGMS46hszj5gW6dvT2cTUrb5B5qY3pq3wOhqPH/3Ba7AvPR2AdQCfwa+hCEZ0D7El8G/sebOt9fX5fN7QKaYN2xmtTxicu/7+YLdz2O2sAbZY4sSaGK5LHONfvulANy+viT4DZPr6JaA40efEdog+cgx459mI7NwxPdMa1YlrD7257hiPHw1M13PMS9+LjVOAGvRXBICR0i1S2emSg26FvNnpHnTrjx99Oui9OzrpkU87x8c7h72DTpccHZPdo8O9g97B0SH82ic7h3+QXw8O9+rEgFGCVoyrmYPYA4omjqAxgOHqGkas+aHN0HFnRt8cmn3olDXy9ZFBRvZXw7GgL2RmOFPTxVl0AbnB40cTc2p6lAjcdI+gkX+s4+B91R1yeNQ72P/jYv/o+KL37qB70e10u4AwaZPmdgpi5/37AKALEC0O8enDxadel7+42H23c/i2gxVcNTfeCDAfjz51jt8cH+3s7e50exRgo/WKv//4pscAup1e7+DwrVDLq2brmQC18/FD96T7sXO4R99uxl8dd7onHzoiwEsZwM5J7+jDTu9gl4K0NuIwDJHeTu+kK+CxEwAdH+1CXy/+66Rz/MfFwSGMDFbFBu2qudkMRq539GvnkIGxV81m0N2e/cWwTlyYmGgY6bPe9cyAZzG4rkHn9mCAwAGqneNjmJGDw+7J/v7B7kHnsHfxBr52jilQAPWus/Px4r87x0cXHzofjiI8mhwXPjm97gXQavfofQc/Dzu7PRL8axMNBqi2nYbcO+jGgCnkhgh5DG320lUyyGcSyGSVDHJThAzI7P3RWxjxRJ3PVZD7+wnIF3LI3V9Jss6XMsiTwzgshXwlg4zGoHd89J5D/iSD3D3u7PQ6iTp3ZJC9zvGHg8MImEK+qYXz+fbkYO9iZ3dvly2pi+7RyfFuZ1t4+Wan10Pq/diBF4e9nbcdRHTn4BCWnggnzPXH9zt/XOCi6NB2hr7VRwYD7HziT62PuuMa2kD39DoZGJT/GE7t8aMbxtWxQg9p2QVkEarhAsPztAh0OwJ0DA+gTs/5I+CAGj42kX2zSmrsDa8c/5lDEF703al53pgY1ggE0S+kWSM3WF9j5rvjCKC2TRasLP8AEN+xiAafiMkCeyj0EVcqX4WuFvUKhWHj4ujys9H3DpDbVEFEOmsuh6xuB5VT6aRVja+G5bnVWqODXzrQceh5o69PJhpWVSee4xu1qFONvmPonkGhtWp/DJzfGFSVABO7/yXrvW9JIPTB4IPhje1BWL5Own5rfPjo2LDeMiAcQEUtYSuqep6kKtoWh5M9h8Ec6hPXEF/ZlhLHRFEcx2TFWFqJm7RpVgGrAulr5th9mNrGbKJ7QJRT0oYZn5vWs41qmiBZjUAOX0HqvrPtdJ8iqCksnrE+gfchqVy8NSzDMfsf2KtqLVXoCwh/Y/JsA7sr1tLYpXN+COL/q/HRsa+uteqvHLYxmGRVxYsGM/nW8N7rrtdxHNspXgoYFRTc6WPzu7AK7IkRCjCR8jIr2Z3YrvEOdJmJUY0mgRZzrqMfwnhHVc49t8iYfPJcfWZKxiRWU7pzHcufGqBhB71yd8qU/i/fcK6D8bCQiqia9qlMHcfGCBTSkCMd2h4qhrSeMtWcWCuqaB/U6w/G1HauY6UW0Veosz/WYMdQk87dIjbBtCF98BVmp8g87lBIJW2zihJI70xgqcPvHWtwYMF+QJ+Y/2t0zUHR8rtjo/+F6mbQ70vYQI3NWdGyOFpBU8kCKD6KrWgGqegzfxlr94ZM6ZctUg2m/aM9x7n3cD8Um3sQRGMoO9gz3RnO3BZpLYq1Uj2xnLza0zU5s77jFen1MQJuKnpNa0mi45uDfceedmH/Zo12lKXY+559ckLleCgcxOfaCCqrKZkP11x+o3xcLNfwU536TXdM3KFqrRfJdWYOtVRhhmOiL1rRNijadY5brUERhG1ALd5uojcJpQhLJhBdxH8aINhyawSysucE1o/tTwbUptC3LdjFesSlncE9OnanmtHYIn8GYTQ4NZUUHQppdDQzrI9M+FdrsnLShS6UoqxCwVKlZUGC0jKCiChT/D3oG/5sp9+3fcsDZvOpTGHEu0fXfxrtNE/P4OjRT/mGJFzx6RnUqs8Hz4yf9Oc/rRk/7T1f27xsNtf0F5eDteHw2eZw+Lz14vnmqxhqufuazOb0l/rgVXOztXa5+Vxf2+zrxtqrl/qzNcPoX15uvnil/2S00s1Jt0eZ7bwYGi9+ev78xdrL5ia081Jvrr0abmyu9TdeDX569mI40DdfykQDF9FdDyYKifu0yjQs4NWwmiwLdiBUrQ1+UD0Df3fH+sCe4zfg5n0R8gCVK/h8j+wa7Uj449hwDY9C23OLQoF8rJ4n2SbS5e5EdwGV3EWPKgKXsrAcRo4+rW6RZl0OuMOsd0jwh/rUAMiWAvKT7XwBpPdAXe57qHtskQ0F6FHnA+ieW+SZ4n2kn26RTQUMbgE5Rs9VGJl0fiLUXygA9+ypbgZALxVAfCLpjAPYKxXYxITN3RvfnAwOfdRFAPanTNhgXJuZUOK4tlqZoDCrAx92wDh8rY1M0He6M0CjK4N9lgm7MxigeRQBN3NQdWFLRhF9noeoZ/ftCRrZEFo1P7gyeiYbJdX0vLdHthUAqSbnwOrbUyDSN9ewahFQNTNHvjeyBcCNZk6N+7CMGGQrp8oIMntqcEkjVN4i4WCb+WCdKwR8rqbvoTkKqlNNBSge5oCuqQDyZXbDnGp+20RY5by4x7BfCbdwCPpTQuFIs2DTPbZtT9QO2RMtWycEKeSDYHVM71qh4oaaWkoZFMo2PPuNPxwajlZr4BmGcWB5r7TndfI8Li2CZncGQCZ4bqHDInbfOrY/UzT/EajEw3q307XoWItgt0jqqoFViCsSqn2VJnSkDmyaPIP/nm9u1kEOJP8vQZwprU8KKa2I9ZRuyhTdxXOykaS70g7JNnqaHMnGnuEYQw00bda8EmkF4kH7rLQ43aiKnQDazzbed7Qaq5LchHPDjV3pGhcyBVzoHN+JahmdyVH6+Q6BYrKtVtFHhscV4aO5xcSouIwkr7VZga0W1GH5k4mEbC3WQuZiazU3NmUkP6DCednS2DIT7++ZDTqnHqgkVSa11MPJV7V6ScELt5iuwDUHHjt5Kl+WWtV9dpbVVL0vwHvSJaO+hBszYVOlKQ/i6qA0EqSg7TS/GkcbYGr3ZRvSfd2csCPif6HiTLipl5hoLyFPWWVxOxXfrMdWVHLLp43r4ilgnY0F5QztdgFmltyVRlZRbSzjX+nu0H0A4Tix40R6pDyL9Sy1yCWzCCRSmjxigyPZ07ITmYhzxo8767TROqjkMQJfSSOoztcj0qWSJ7MRgcgzx0CsRM3Ea/mydOmeFMMg0V3pqkBR6VjwIjgCSPL/JP2n7A4oK0PUIsSR49VTfK/Oea/sDWdQZcxXQS8YUiR9jLGsFQuxa1y4oNpQjsexFp5ITWnw5oYW3WIVfDIHxsZJb/9V0O2toCLhDS6ALfo3QyFY5K3fDDYSoyj5yirGfhInqBl6NIj7Y30eqOse96xJKAQSCM2NGIMOD7P1A0bdS6i8l7gFO6a9MYpxPNVCxsOSjCMfXBuJLgWLsh7HYhmqp+RO8GwZ7aoZaDAxkJhq8eivITf+SkYORovhHxAU/2wm+pPBF4VX2yqljwE0dNxsaEUrTtR22UA3tCS1xg+6YkdbWrxnRck/Tfs5hP9A9d8Z1YdnPgnSD7n4tpwd34LCEqgtktbZPjt2P6Eam+CoEzzNsVgIil44NFmn+hqdqfQ5ljkAJfdqn/8DxYLOklY9tC/twTWZ2KMR0JqJJwzyfaUW101T/YTlgtqPld5PBo+1zCO7mGeLbO35qH7GDd4NwRZcy1nqe8FWUkSNPbwbxCLDciZqu77jGFbMlMUfaf3LgiecNwsJF5mZgM0S3Ifqi6V3Fymek3bN0JhNiW4HAbU6a2klnCXdWC5PYQsll6vg/ox7vFH90iQ/M7wzdMBt8vSpWcw6xueIDkhCUJvkH8GQBpPAp61Ldds22SSvSWuDoAG4VieFQbflqHymSnHISLYobiU0Xfz3uSEcukB9Qrdy0dskeLCi7kYtHB92iqdsPrScxM7pTsvg8orQEwmyWVMPwLnCZhki0SbBuWBNZWP83BB4ppLBfG6I23A1B9xWNbIXM6Mt0YTAy7YL2TYZazoVqj2H5j8X2xylpXFsfaQVHub12RgYQ9NC95SZ4XjXXDjXSXQ6ewOEPvFh0+eO7Tl7emRNAsgaWci4GnBhKNi/DIW9wvCqUAbibrFPRhP7EmjuwrI/wMjoI+OjP52p2fz6OvlkEIuHTLgwDgS2zzqZssJkBqXrGGdAhobXH8ObuWkNgEmO6dYwzd15wQssKPo4QrE1/m4N3ymcFDgIL20Z81iF2g2Go8Ba2pLHIcD4putpzHQuALmTSGar1HXUuDK9mNto3x4Yoesoqy8ko0zXOk0sMZ5bMR/YbCQQOobEuKANUWgNOj1OUXN63q9NYzJg0zywWdgPul+PEeLKI9SVGVQ4e0ZmsGBBdTf6vu4aZG4AvFX1yFwHAKgIRWYBnzMpPkPHntI2RRqoMue0Km1T91mb0D+i9z0fGrvGGB1ayOw7tuvp/S/cnw12Hn4f45N0T6yVUnQIAh0d25MB4CdFCeN/YAMz1Wdj22HhOb6L/WRLskEOhogP7bVlz+v4A8OfBlA5+hdjBZ/oenHJy2jYTBgwE4p4zjVWZuHQXBNzOjUGJnD2ybViYkMImFbX8A6Cn1pEI64xGRY/goIuHsJapmMEqI/1r0ZyhddZBy0SuPoh9nQE+gawt7B7nNu46rMuRE1cO7ieks8a2R6vsTqQvuuqiKWa9JAM/8Wa5G6N1FvpHR3V9Ms8apYgJXeBAu1UJUJl7aJ708qRyvKZKokf+kGtHD+pk1UGYuvrfKfbgB2mpp7bBpXU6mFWv2fdlOnyVAIzbSal5hdj8fx3jMtP3VE+n3fnJkpjBG7wSoqv+j7yIJn83JLDJxucwwjp05oa+Eb9Kmo/EYq1lV0mKdyMYEOGyqkLujOweEvggzh5bi2/zpt8kIB/0SpPcQAmdADOkwqBMTU9IWglDa/kSZmkI/t3CeLry3bJYWZxbH+ZgRbie765oaYBi1tLFNrfLzs/dCzCcLEVdChj4LKKBlwlHvl7TywFdma6P/EKjJ0oLqrpQOXTk8NfD48+HRKG0Tkz8wgorpJi4hHOBZAPd1MzFKtrU9syPTzn5FTgXlEn4PedzsfqXSCaCKdeFcKs2otDWAIHh6Cd7Oz2Dn7r3GEPVjzgHP+7xj0VqH57/FfJNmLopqP7CyCL5gPGvwNLUqCKyY3L/GgQ941axPsvxsYVTAr8rdaK9Iu6gemeDm2yCrgZaKNZjz/Isdc1s84zs/hfrBG0X7+INeLZzByp8S6tTNTSyZLvVIois1WsJbG3NB48OXDFq7kpDhr2sblVrlCBhaP3B31c+ju7hdbOMmtJ2pXW3XWF7wzvtz8bd9efd0e9e+nLojhomaqj1Zm1Zb+DhZozvJc65jG4fm98NSYwzNLlvH3XQyK1EjwwrZypG/DQGVgcsM/47hmX2J3D755tCb3ZO/jwobP3vTKvxZ+2A83fBKpKLzKsd/HcMegziu4u0vQgE9Pyr6rk3/8m0tdDxzAu3YEkfwjVfO2RGbhDu+loB2VOEtZo5gkfC6unZzfzwTptaEACww40h/nRorOc6DBQn1MnFlDBWaG+N0lYNZ1rcpPCPKT09+IL6lHMAomJRg/TFoqkEOvr4nfCXMRceojDcQ+S7rATGXPgkl/aZIrOxPzYysUTbzpEugtDxJEnE9P1oow9jVgzYQcwrZ3te/TkR/cwYZvnXdMzJ/eLOZsZgzrxWSa6qj6ZVPEMiedrMwbyToTWMjpXFxadjjDFEMUbaioSAnN6LovniIY+NhUNN8xiJCvFHCm2891Rgmp4pqWC3ifsyIeVxDRNPnqaMbLGFYLdxugm+vs//5MkQX/G+azRk3Hb8mDc5GFPvBf0FCKqgE7c6/SjrThKOK9xKHyyRapVVbxY2BwsvCqi/QQnLg/JMCfVDRLrVrKv1OE9/hQfolEzAUtd/jkOW8GXOp6FAkHFYd3QR4S9raatnYuyXq0JOuaud1qWcxsuLFyLsAwZJ6kTynfMPvliXLt0WeECljh7Xc8Me0jdAmk3WNIIOujr/zxtrv10/vSH9YZnuB6C4BxQV8YZ5iYDLU0LgnhkXYwvE6EfiY5HP+QeICyRV3Wsu5TV7XqoEueuDGhvS0xJVSpiMM5s+QISM27F+8YYptocHrnVCZ2QVZsCUtdJnfzG5mQgygL64GIWJNZoGFdGf9+cwJv1S9Nad8cwcqdV+DhX6T20BqDrATBn+EDH52q1CCyetKEGH/foGPvWl/BgAat72ib0YbRfkPlqpFowLRa3p1XmY9iAgDQIxc2/iT7/Qqo3oA6Ylkd+2CCL6pmFziVnViW74rlueh0AVFqS0pPWTo1QA7oxZUGklYqinoz5LacnZa2QymgwPTEHlXqSsrOXgsKnURkNGvogRb5o8JX6QCsg6Ygp3pkKGSBfgYUXcUJiUyzFaXwt1xLYetxKawBivfQcLKUG+OzkTlFuPsYEv1pCyNN0ivICGbtZNjNy7ho2MLNnsCn306GIyYHG2gQNAaVoqBngAwSA6vu22wAeZ1wdDbUqTw9BPuiWPjJge4WaYRMVDgRmjpDAN4Aeq6mHE8yvLHvhDuBpbfnTKUGy5vVbwVIVj6m2JmhqdKYz1LQC+EYHsKIihsMdPk0M+VvLhnGSD7woQcRa1cLjW+hp9JiSwNNE18UHYzsO4I4NWKfR4CChfc9DoZr09zQX+R1PelBJs6BTcM4euejGvJAmpiUZd/lRp0EU84FalsVYO+5y22r2H6oOq1W61IpXER0rpV8V061ijRqOI2sUHy/daIFmI7WO7Vu49QR0Oqi1enZmVUn1f6qkUqgPUWWRTliyZDVa/6bjem1Q6KrL1kDV0aFWuQEclq7EarOszj/gOSmofKjm/c9tKsTUz2a7tW3+bG0jF1u6opulS1KLAu0V7RHwrfpOvbJ1m15F400qP7pnZ+zPFrmBv8gc8UfwtE7gz8Bw++LDBTymU14nO6fPzvFvi/59fn47rDgd1UsTUiXiwZXbkuCi/NhWFnzZlWo52HcVaCx378VNn0vrg4zp/7/u0WGDmiu0JIfNM/0HTkwYtdLSaEXMPGIOrzWovU4lSp20arXlzOws3+P/LqfyLnKn5luSUbe0A9xOVq2y8WiByO3dSdEVSKKyazjgZqflJdDAmCwjuFYlapiE2VhawiwjWBLiBBOkAPZkOZGCaqf95XTzvA3DmDA7L1FdJJdQGgWRglQ8xURSGGMneYVm5uDxkYX9DF6BxhqDR0EGBECHgAoy/Gzxz42lhBmlp/ICrFp6sIKROq8sIa1yTX4K0XM3wieICm7dTgSpLGRZO1XabGynSuiJiMtOR+jr3L1iIRmIlX57so/uT0H2C0Yt2vtck1uBaaVmPE2o7pdmjofKTTHfSM9Fmx6bJbTcFXAB4P08haLnDdRni9jnwgIs8ZZgpEu/ES116bfMXLfSkITwVAlaqvGzyWKlb8p4XjFzR6yxol4gi1t7ZixWYZVcKIJN2QEAnpWjGxVGlGLsozll959x5xfCrz/jSzswk7NS8OQrnr27GKBquAZxfCsI/pzZNqbAo8Y3V27Np+9EvbOLDz5CQSlDD9RUWqwBTWnVpB1g5BgzUpFaP3Gbj3EDFYnCtba/JRwJPQPBXVGdNsd4cnSWw06eNWZsD4lFAlwLSFUwyGXDb8snsOhowCxn9hy/VyvwGgYg2u4f7m9zWcDVPBN0ZFCScN+NKs8QtIWnzZ9pIIZpYemn1MbIhhDfbnPPHrLA/9H2C4wqqOVsOLkmFcaFiBByQfRdzk5FarT9q9Gq0mgsuhvVZNmF4hmU2BNqwEatWO3iUPRMUHGa6StPzMKmFUPuy87pfbX2FGS3CeplsU3BL1xXGE1N9o9ODqWXcqicksJpkvFWSo8JG+pZpRJvuHJWiVFcQHBIb3zaZZkzsPnkgQP1Xkn2fumeizlolH4wRxaLo7noYwLp4DxAy6GYjKINmgAItJlfSKtA1qK4JlxBf1IMtyZheE+YO2FkfsUX/ky6jMPpi19sVyRYiI1+EZIZQtdkl6OtYCWJfnDKI3QJ8gV83qirF0U93LcEHRGdrpirVYr8lsk7egdONH+KjexebGMZza7UKraENaykFey21q9lrV6FrV0rsXKtyLr13Vq1lrBmFbZiLWG9Km+1KmStuoWliaepV554q6xPhSxObtriFNKCUseOydhq92APcPuFqhEJ05MbmJ7UivoDP1+2UQk3x1RrATcnazPCkuOhgknn+bNtAjYE9nigZgY7IQrTlrN+vkstLAD4ybUFW1mLbWWtWolFX4bLMh75gwX8kfWA6RuVaDNsRTvhEvUu7o4rpBco05oyXFVTTr0LWf5hWlG+Xri+Tnrolkvmukt0i7vKB0pb7jpnOfyi2BDaqnS0Cunz8nzxmUXRRuaoXYSW1NmX0UhpsrBIyZ4bLAsbjE8QPxREDmFYkD7SzfzxhQqlQ1yP6lh6tJ8+XXasXcPDy76ANDO3aXXyvNnMvrwylQ//dtl41ZfgBI7M6YWS6fGGBvQnOZ5sNw+C7C4F2XxsZwoibi4NdLibyjaVNzrIG53JGx2RCXcJuqh9S12Pgm+guWr6L63XFXRxqtQClTVQYbeBgsPyiwr+PMt2o8nh/xKmc9stf3FP/zzjAJoeSyiainA8mQ5aIHwu46BIiB07Ca1X6aCwPX6rSBVIVUixHIsIw6AyqjcAGNvUYOosSUCaQMesBE+4nI4wg+/46XjuJ9Mbw07Dc9dB1XotA8TAOp5NvipfHYu7HsxkTCITX9x8SPcBPL1zkNI3Uqfyg2GWNPLISfiB597L5uFvaQpqfRemII1Jo6fN2i9t4ejvbvdWq7A/kTAquV3h/K6yvSQm/3/9n8BSz87W16nhglfL3pXGqqhhjMkS7oO8WmtZCM8lShlTWhj5XHIwy5rVSmyIH0xw92mCexCAD9az79h6xuUatH+4H7XZ3L5L85vEcUDphxFZ4VQOB6bCRVGlbbOlTdZIS6JZF73mg9/y0sreTMqdA9pF95JSh1r1jiybm2aMYuy4+Ytxjflq0GNhmUjrUyh/Tu/UiTaGwePYJhAeRBu/8K4SuvETfF+0oKz85h1xaAFKsutDmgZZa8A0B1Vtl/MclHriYrKgQnOzKOB98JUJNNrtr6aDV0hA19PB8VyIwexgieKOPMmbyjQsHro0Z2aGiSbRj81eUMNM3L6DXmkZfY8lvzYFKD+ACrfs1d+/Di/XUIMWYKTJYAreeVPwwpua7Gie33eTb2C8bOClGjx9hOTiRlXuqKXTZDGWwTWLIaoTc6S+otc20+o/YQlqQZbUBFoJUMm641vrvie5/0ZeF9UGmPE5pg/odXJZzu6hPCm4VQzzLY49VnH8UaQOpcu6gjelLTeF+PHSvlMqflgrI/EERg68YWiO0q6M7LlWy06rcrNQpUoZjlKEjb7cqHF3r60+0Lfh9VmiOOQa+D5STRvMLFBVWI7Dq+PdbP8sYMiAh/K6M1YFHi/aE39qfWTieTiihojqmYc56OI3hrASqmmh2ZEoxGnznLIRzD764eCwym2GDfguKlQcuHWek3EpXefO71GdO78vUWeATSJjClYmuIkWNmeKrrQy/qtKlCUYMqETEQ0Gtk0lA06pYCp76W2ocEo58fo/z9x/8Jk8c59qLJtYbX2qUnynMk/bcIKmODe1PK8/hTJzUygnW+KgMXnH50WQ+Ccc7gue9OfOvJZLZhqiDEbFXmQOmOmsJjj0p7HMLKj9iglG4lvhDHou5Ny8QntDkdRld2d4KJDTQnD2xz3ys1/aUYTFkKB9bgtNdBZa8H5owX/PaKyFej+auxelKU/RSCxzBlELC1FQ1eUiI6SmiYXygjZSQI0LRAezXE+s8wCLLWU2yJCNBydI4QOkzJBv41Cp5PZiqZvFL3g2GGG5013MX22RQ69iaxwX/cPKfljZ4sq+68XcEhdz8zxPzBdcwXRJnSRWcfgw5872fK+HP2nhq/0hchd+qb1sLFcZS/0cS1bGIuH4lK/DgqaRy9S50LJpp5iyzWwv+TnKvkmOc19HCPd+UCIxnau42lnA1pAKxFNiaFUPDstf1i/rlXUeTHp5qp8/aVc4GQjGf874FmdVdrJRAaZYwb/1IDbtTHDDOv3RPUeOieb7DK+oHI+ogIjyjcmwyZlN9D4MRf28Wq+eV2u1LPbCjjaS/CV6msFgYglh+VYZWcxNmGbac3wDZk0VJ5c0rooYxGyumTyOO+q2k/1RCJw7F+n3Qe/3vqIjtWHmkjWDrNloTcaPGfvoT8PoYTQjF/aQKekdU8Iz5jZeMct4xBTyhrm1J0y2F8yz81q7XcEJqNQKFi2KI/3HrCIRoutbzCKyXhhT+u8iSOPQJq5/CeQYVYn31h336sfvO4dve+/KVZvCbk33vTFplEaPFlPh9vRFgN3ai3L1BqnsmFtN4PHyo8uy+bEhSTvBXCE26cezsHjMGwa9YILhrbOeBG4x5ZBVOsMUPdsu5ART0gGm3FF37gakiCWRSbkswVvLsb9ze95VrWBbRDs9zzrFSkrQSPSKAlQQyPYMn7jZYvQhLuCvGhdQ1MWmQiSpVoqXvSGVMi42YQYXFHYsBOGKi2fuxWd603pl5rn4SrkZTxHnk6XSNMuwBKF61W63avLGF8W7ekPKOR9xSRFGV5QtzY9uypX7RsIA8zPx0AUTZuMRkrgUSr+TjCAsTiLKVHrZzjfRFol7z6icgEoePme4vGQgtVR0wncbe4N4c+GHVh/+tRHsGNt0g1ruQo6McJ5bRKHkkFFmNAozTSUCc5bOoC85wf0TA25oNpVioUQiMyg0GA9ROQ9ROQ9ROd9fVM6KmfrqgnwkPEbuIXYrTHDDJQv5WQK7gvE/0tAcNyu7jRAa/BCBU1TPjSc8KBp4853E7LgqKZxOl9N9SJfz9wv4uRemHthfT7Ny6suLXmTfpbP480KY7lEcSiKiSg4jybpzp8gtMD+6P7qVOpuNulV6Grl9v8CFNsry9y/7bxOItridGL3XZXmuWpZ3M7glIuwW95TzasXDvYzFKrJxLHnlQ+jE87nd3P78MxoouHrw9OnnW92Mefr5PHZtM9Ut+HMaObjcjZkFrB95Zjjt6qq2tG3w9LxMrMctl8KyQZ0BdZpLX/ca94SPRXz6ifu0SxssUzeJvzGADA3MNObq18SyL+3BNWEXLo+MAcGr0CeGV3UJjf/BTGSuQc2cHk0BB5A6ebv3QZ79DYkb89cHQXz0wgKJjyL2UVRKp7Zlerazhs9BJx0Z3u8H8FWDCmReeaw4j9HAUzZ80KCnwTYwnOvoGT/uzTfGYrUU83aZ6NzYeI6QE/kzOn5uetQs8nt4GYNrTw1603UdL9O81C8n12To2FPy2+Fuxs3EOddXZl0no7RTIzddzTWceRbqmCGwzhh2HrfMM6LG7r65raF3qaC1h7vYHu5i+3PvYmt913exlTKGLrML/NNNercz7S2zNylt6ruFyW95rb+E9r8Cs14pM13Z+9RUGnDcgneylAUP/xW/mCxHRlNHqEL3kBVV0bI3FrDAscCTdqBqJDU1QQsRFTbFKXq5XVFCrx4sc5ld0eu5gttRuELNtWlYOnZABSvJHxz0SqIYL6Se7Okret6B7rlvTwY0JYAY3h69wLG606t6qHoYXNGjzOrB7uIJSeQ18RtjvCgMM3Q+xKjFojnQ9gxrm9mbU3cAvSjnCSqbhgIb4nQIu5DEJZlKIcjt4t8rqSnMIBkXQbG7ozJvgsLUMfQqJDoBpe9/+nsRqa+m0tbyVCr1ZRNuBBWmVEnIyvuuis3vQnIb2lvH9mcS6g+fa6M7JP+R7FI02rTmXc8MGy0e0Dy77pNOK71nbv2fLHDhh/WGZ7geg3kdmcbo7y0yUi+lkWwpjQospVEw1KOHpaRYSiOcP7qSRt/dSio4vamVNB/b+tQU1xB7ohVw2/+LUgMbgPsQ6hK29jERkMgfFQumoIfhkuFz5yYeFzDOFFaVz+kGxlD3J96W4pyHk96B9VWfANVh9cSdGX1zaBqcGgNmGLap2CWw00RZhj3XIFXLn14aTlWBR9Dr8BpR2nAy0V2AAS6OSnUpNDgjL4NGcKy2fKM2TXOnalQ4umuE13HCKshCpiHeKwlYZZls4w2YA1H6lBp3usfPaVBsC2ssvw2neMDC1+QdZ68Rh5LHbbIpWnybYb5av3YT44Ei/1tVaO+SjQiWryCcl8fx0rvReTwvlWJ8psi/6dW/zBgt9euh8lq0M+dc3Cy9ewS9OzTzSTtx10jijpHzSulg+mUD/4qE3BcKANQMo2gAYMn4v6FpDTrW146FNyEJEkt8XkxsXTr2F0Nx5WpG4j98NRPypSZFpTQOH0SVK6nnczqTS5TRb1YoxWpWL/ggq9MXTsRewOjtO/YUOqPNWEpUufWSmls/I4YBg6PJTt0y4Q8atn0aL3/6+fx8uYy/6XqgW4oW7iHpZTAleBy6nQUmF8CFHQGSQoy2Wzzu9maxSvNlTjJaic4Z0VtC84wTYpHbv1LkXTzfbcZu+5txtE1tMO7SwbZAY4UcxEAOkHUcq3UUlTO2tV03rK+mA+0EB73NKv71QLxSgcplbOXMq8TyytwoBCweRvzSgm8BYL2yvQhDayPB2xYFr/TKryCdAE+DgEU3nrJdssbe0W1w7OYvkMpFPVrLXhB261zsy0pzlQegXKoXwOGmyJ1WqjjMzGj8v9EqFjLSAN4YF4iKrLCwwo1H7BHzniA/tNpnlTMg2B82+BduVWqSBU/rhDfawB/6acGfyAxBCtHrf/yHfPRhvWfmNVbfeZqTGjmmKvF0xYVpE7CKkteZYRa8tnKDhloGFOIpLPFb67w0Vaty4ClUXIl2q9E89tB8tlD0uYE6tSuWHJb81c1qsOXDNZGT1+M1qazpV4RuwnDtpHeJwvryuRVDWGGBlfbPyBAZ+iCXyevK00UGqSCtc77qFPb/iSVajEvFkBvyLcbEyvK8NXC1nS/vesvLr0q7DqqlNijJ0uXgXGzJaW2gO3NMsMhAbyTnqilFGN0qQ/Pa39YwbvJjxsh8KCw8rui1eGrUOggwEHFQc5hcxbCoOxflnGcV7SzUBPERS0O89NFKtAMp62YeTJjkAoeiYiI4+jvYk51FHuxlH8T/XagmqQtxgtmo45FVRC6wakeUHNrwG76dVSL7Hb5AEoJPy58mqYg9DYx2t3fLyKWkrASXt3XPuJekrN8k5dxHNsmB25+QBnV5JusnNJnwiWX+yzdgCYv6RZJmMSxuo90W3tVElWMV/EtBbMW5FuCINcnSDC1tNSpshFI6dli2B/qRbw2qJY1Tt/TzeFhH97aO6Iy45CPQq+5cBxJRWE6jjOU0WulygorLpN/KWBcFtYjbrJWU68ZyayU3H+Pf2qMjsHPiGeJZo3oHG8aVsW+yDP9OXJSYR6CFXKoTTs6L5fydcbvw9yU9ziHX8A4ormqsB5so0Vx4uN/FMduD/vc927mO34zBiXSDrNj57JvliTg8XIFgA7UsV0zfPLVCPui7DiVInGRKkvxLtYF/UCriJ5t1/BbomLek2yK6x93esnDX1ymUcbBY2eUuzApdT4X5iheO0PNN6VWsYdATbT0R9JR7A0xk+ibFLoBhd4LI7nNiH4GVECPdt3Nj10OffKy11MVO6TudvpNF9K2R8d+eiNN0m3uv0bJEbA56+uVE3FHmCAWPg0t9kJYhdnNASR0+vkkqXgFtwpSpqSFD/5XdxlSMGulEXc8MGUG2c251RUrDoqetsEhdfgMyUsIpg2VsV7KaYv34LJyLZh3PmAPdcSKK/xwioikPQ8OoU1oWF4kajptQGCT2krpXIBk069HTaPXV1OdQknE4Da67TKUkURVgN+fRC/OWPQSiVWYt9F3fcTCwQ5RXsdu9b3KYpIoPxNiIVlsRU5joVNadVumXvypjKLneMWwqXM3R0acsz7Mi9cwTJmYkMgoJ8W7zWmU2jVRGguOALSKHqrPshunXrmdOJtHOHUgqHJ0WeU2q7Lb7Kkb0Hlgsl1eVnr5tMTJGj3wlZotl0lEpk8LfRUapoZY5tg2WNxJ3tsFAiIRUYAxrq51sjlCEz+oyTx3REBG8TRqa/ujYM8Pxrtnw1MPm6kBr1Pl2i6bYZE+PrAkHrKVXPLUYXNIkv5eNvj6ZUCNTnXD9ShIUH2ImO3rHqZib1rONag1zO71H/886+aD3j7p1su8YxpvunvxI3vNiDubw8+5smThMKKS21IW7M31u9VCQNXqd4w/f5IWEFRyzwIS0TqrChapnZ1ctA50t4eOsUv9ho8C5e7Lq21lKgQyzZATgVVWdyULROJuDB6C3IJNzbNurZmkDXWMyFOkIf9+BMShS7WHxrfnfgRwv6UixAg+KxMyY7jFMnjg37EnRWyDZTLL8cttqrkRhDcufGg6w4pOkYTD+Rkv7B9GAE8eemq4h0gR/FKM9CopjYsyDIlo0dw5mpXKMz+ruMQXzAgDtyVdqXYev2wqYz9RkTGHEOJbY1M8Acqxbg0ncVB8+5FJAidBMwEaywxbNrqKaJOsW18o1ASUFcUgum5GixQZAU+0FZuh5zfYBiIAAFLp61CL/Mfh/ODwJSenavtNHbDgWfLH8RvlZmDqQOX6ikUrcRgR7C9T13CS4N52FnFJQiE3MZsibTHSeXlxC36GqwXWLSLnIXDiAL0/qF1SQXNKAD6AoNLBnT3XA5rXk2VOMG6jWWOYYTNMdAgSqrUSveMIG6BQaYpag6CfOEgxHhnYRHyFWND1C4WDzZFPCFLMvcrWJjQ+w7rC8qDpFMxiuLoHHQUF8KlLQyPB6dEOvIeeMUU7fnvhTK0ULZkgJHIDPFUpIcc+umW18ZloD4+poSPXMyCWJJrUiWOgU9knnlDQiM0xGxWZYsfCsFmsF0+F8ey3RLJmwDHwc0FStMVtGAiksEykq4SEXA+Lz+fjR1B74sGkyrma247mctSOFhzk4EfT/AOBX4RE=', 'base64'), '2026-10-18T13:52:47.000+00:00');");
 
 	// Mesh Agent NodeID helper, refer to modules/_agentNodeId.js
 	duk_peval_string_noresult(ctx, "addCompressedModule('_agentNodeId', Buffer.from('eJy9WG1v2zYQ/m7A/+EWDJXUuHLaDQMWL9tSJ12MtskWpyuKtiho6WRxkSmNpPyCIP99R73EsiwlDraOH5KQOt77PXdM/2m3M4yTleTTUMOLg+c/wkhojGAYyySWTPNYdDvdzhvuoVDoQyp8lKBDhOOEefSr+NKDP1EqooYX7gHYhmCv+LTnDLqdVZzCjK1AxBpShcSBKwh4hIBLDxMNXIAXz5KIM+EhLLgOMykFD7fb+VBwiCeaETEj8oR2QZUMmDbaAq1Q6+Sw318sFi7LNHVjOe1HOZ3qvxkNT8/Hp89IW3PjnYhQKZD4d8olmTlZAUtIGY9NSMWILSCWwKYS6ZuOjbILyTUX0x6oONALJrHb8bnSkk9SveGnUjWyt0pAnmIC9o7HMBrvwcvj8Wjc63bej67OLt5dwfvjy8vj86vR6RguLmF4cX4yuhpdnNPuFRyff4DXo/OTHiB5iaTgMpFGe1KRGw+iT+4aI26ID+JcHZWgxwPukVFimrIpwjSeoxRkCyQoZ1yZKCpSzu92Ij7jOksCtW0RCXnaN84LUuEZGvgyQxWexz6OfNvpdm7ySMyZJMdqOALLGuRHiuLrhWAnMvZIczeJmCYFZ07+ubholsdIdyviIl1ah/Vjn8kFF9Vzs7RcbR7cbG5LnfwJqVRE3LbGxnV4wjQb61ii5bhDiUzjnY64RO93Rmm5D5brT6we3NBt5l+IaHVIQlOEW2ewLSo3/U6OjhTxjmLmD1FqEwkj5AaSYHlIKrm/oX6ZBgFKUgmjwHjTEFpODxKmVBJKMv0QrJD7PgqLZLpT1K9xdcZUaDuujseUY2JqWyEurbpCt5tbku2FNjr3+qt2Z0JGXw/qoaA4fPeiHol+H15xqTQMQ/Sugee1Sn4fxsIUscr2WcKc/K8xdCVSynl0xRxRKLOIOruG1Eiek+D7wtVwjey35872eYNtjT54gN6sxyTb/D/JqHLdNh83Z9gOlhj/ijSKdhfXcJR5HI5yTvDkSbarhS1PP8tx4JucbvcI5d6e7+Ch24fLEP5lHfoYsDTSh+1UBQPSOpUCbPptVL1tgHA2wxqACzoiW7+8HZ9RShiiMco5NQJDW/DngW3Ijo4qXqzYkIN+G+Y3GHwPsphF6HIq0hnSlJK3OolT02BXpkMran8F3iyQOAkaNgR13VQWeFNh1FzgxK1aSqTGs1JAY4gzL3HfOKnaBlsor3HVMyLmrCnDDYUiXT3j849E5p69Pv3gvok9Fr2lYYYLzG7nx8NUShT6nUL5uQ2tMjHb3xahGcHsPLrrMslluxGKKTW8n+Fg95ogSZnbpu4fKcoVwYhdcFMhD7RNIGuNi5Hp06eLBAWMs++tyGImF5v8RWwPBsZx8JOR4qp0QhtVaDnY36fd43GmFWUfuGeWgZcs5EeQo4kbyHhmbxjfErxmH3z6ZNF4UTHuI/34TNR5NhGWK5rvtG39Sn/+FXNhW/vrw2/vDvuml1kTqp8fvre2ELzFSTsabVaBBnVFWwJYXXXUalotreSBTyWILu8x7x7TWjjv3meqNeTQIFH4yHpLYADHUypQa9B0t8kjzVhuVoYMOfJW0ak4ejZjgkZ6STEv/nKxhMgCrxsRqdTVABfLVd0myurQyOd5JXKqw0JuWYOwv893hwrqF8X9j/wzvdISUyKmC9nO0VF9ZHt8ZRdGVUSIda9qWvfl5m55UOdw29h4jRoNnZfecKgbX09l81335kHJsbE7ue/pcYo5+jQTPBKRjAJEcbnWkGbm56UWHj0P44iSICaEyWjMy7jss5Q2NFwWTAqz10Z75mVQ4Zs7Z8N6RS/QVJH9AYtUGb872K4kAA0Edw+NzJkgiCcQQC+YArOnd3t1UKjMJqWMNodV8PxredQx6PEcfskfHocb5hYZlE/Ty83Z6racvsDOzdgevTZsrZUMee0EI7yboap+CzhGfrvX7kvBnOdX9th2qa29tGofLMnkUVDMhZYmtM3M57pnzmYpPVgTqlWkeVGHjLJGZwkkcI4GfIksNv93WXCVDZeSq2uYFkmf/WcqiuOERiuU+fBJ5aGZ0NGq8K5xZuHhTb0aM70dR4pol0gyi/2UqhCXSSy12pxDB/XPrlqP71Vo2SaswJIhrGy3aevVbC7Uz7I59B+bi172', 'base64'), '2022-06-03T01:08:06.000-07:00');");
@@ -2661,7 +2661,7 @@ void ILibDuktape_Polyfills_JS_Init(duk_context *ctx)
 	duk_peval_string_noresult(ctx, "addCompressedModule('file-search', Buffer.from('eJztWG1vIjcQ/o7Ef3BRpV1yYHK5fgLdVTSXtKhREoVco1OIIrM7gHOLvbW9ISjNf+/YC8sm7PJyqipVqr8k2PM+j8cz2zqoVo5lPFd8PDHk6PDokPSEgYgcSxVLxQyXolqpVs54AEJDSBIRgiJmAqQbswD/LE4a5A9QGqnJET0kviWoLY5q9U61MpcJmbI5EdKQRANK4JqMeAQEngKIDeGCBHIaR5yJAMiMm4nTspBBq5WvCwlyaBgSMySP8dcoT0aYsdYSXBNj4narNZvNKHOWUqnGrSil062z3vHJef+kidZaji8iAq2Jgj8TrtDN4ZywGI0J2BBNjNiMSEXYWAGeGWmNnSluuBg3iJYjM2MKqpWQa6P4MDGv4rQ0Df3NE2CkmCC1bp/0+jXyS7ff6zeqlZve9W8XX67JTffqqnt+3Tvpk4srcnxx/rl33bs4x1+npHv+lfzeO//cIIBRQi3wFCtrPZrIbQQhxHD1AV6pH8nUHB1DwEc8QKfEOGFjIGP5CEqgLyQGNeXaZlGjcWG1EvEpNw4Eet0jVHLQssF7ZIrESiIrkI/LGPreYsuz6a9WRokIrCCXdA1MBRO/Xq08p9mycKD3F8MHCEzvM0rxLFnfkXmdlEYjKIIJ8VFugO7SOGIGvZrW0+OFJLsChpZ4My4+HHnt1XamaMRFiDpyJonQV1KaBgkwraA4q79me3790y7rtQKDcgTMlv77mUwfU9JAgoc6eV64hzsuPrqTbTy4jYcOeal31lVkoYRHEEZ7dXpi/znBpKCRNGBRhGrQaqMSqK/z20UDBcyAY/Q9VJ5ExtuJFkToFVtlqAaFoMlnWwCKXQjou1N/MzPNQ8aUkN4HCGdhYoblAEExBT1peuTdSm2S8LD1+JNXL9W25B3gooNBzGMYDFIZr+QXsBs1x+TlTI7wAoPwn4llaK/EY/bIC8LO4RPSjCs5I76XQvhEKana5JgJW//SIGH9EgIcWDzLvjFWUvhejr6xwq4fFCSzAK52oQQtI6BcjOR737uUM6zZE4gikppJjl00lpZhHaG0EAJOGMViZgPrlRCkGF9ZjbRBqawYK6iwl8lylVLZMFhY5v0vwXJJCOyyNzdieqnN+kGxLk8LIbRcfER8x/SDdTm71KndSyxTwKuZ3bIGibgAlD/hI+PXi5OcObdjbvANydJTmhu7nHkYLPSKbKFaOPE6VyKJom3iF4xBJLH0bTWmMFZlVWYTp62kpeoKK6ldKXxCZtjr+zNJxLf9QbREDnmHsLYiqJF9RJEYbwyEw55FRR58Gh9tDMVADcTGWMwmtmHyU1RFIMZYej6R9yXGb3Egc2IvCJfL24DtLFYfU3G3h3f7JO8l7SDebtvyGGBEwvwz5DbuFy0CPkjwBMEpRi3rGkA83trWIOTKu8NXAN+F/hyr+vTD0WBwg/typt3l69vLNxg8vqeH+Gpk19FKxLDceqst767s7XHWoOehTEwJ+mwlaR0sb38kx76X0reJfaSCHKzqnYNWWaOQ08UFtc0pBuNWwShKLzTtag3TYTS/a7fPJAtvsHW8ZMpwFp2zKfg17YJAA6mwYS9FYomiH+2rmnZCTemaOJIGlfYu6CWeaWq1hPbftI6hT8Cmfo3WGqRW8BrbzODRh3rnu2yhx2kps8VvbwF6VuZKavWN6xF9p2h/+34F0zy22z0USpqX1lkXAOw/s0owQOg+SC5817bgc4PhIM2eCKIkBEfud5Vic8q1++tnfevPy/8W/A2v3s4OUzH2PpDmFQSJwvar6ZqTborHPh4JE80xfDjdJED+2sc1cirVCc5azbSRR+fSS4cQx6BSF7czLAD+j/f0FJ8XiwlMkD07jRI9sdl62Tee8MRNxlPCZWfKKN/xpztFvUNJxXQlLNX+jWPbXVinCrUnyg0D5i3Hy5vfQ4TWt9xeCCOGJfj/+eWfnl+s4+kA2lVj69GtZwOIZdmGsOhl4qO1oZN8xDYQH7PkCS/nzihaqaWxxbvXNPMYSt/8NfLR7qR+IWkBRG1jW1JLdr8e644JvNs7W5vVrFyfUczpWqAVfdoEfTrcv39bt1hu7L329HBXL4v4CpJUsAWRhn87P3tAauOFeV43qL5hCN69y/NaiVatIRetxZVe6Smy3RqaU5AOPbuj3vUsm2aRDeW/JHRrXWM2ZK8fxRs/nezSe+73/C2nne2TzsYpp3zG2W++2Tacxd81ypSMMW9HGBrLuLgJ2Nq6gFIbZoEt/O4LCHY835tIi/iFL0t4Lb59vPmwscTY2yAWM5d/2ygStmnmf01fervKw/Rf6/VQ0ot97aYyTHAChKdYKqMXbVn+Y3nnb7eDsqA=', 'base64'));");
 
 	// identifer: Refer to modules/identifers.js
-	duk_peval_string_noresult(ctx, "addCompressedModule('identifiers', Buffer.from('eJztPWt327aS33NO/gOiTUq51jvtba8Upetnqq1faznp9liuS5OwRFsidUnKluv6/vadwYMESVCiHKdpe6tzEksgMBjMCwNgMKx/+fzZlje9853hKCStRvOf1Vaj1SQ9N6RjsuX5U883Q8dznz97/mzPsagbUJvMXJv6JBxRsjE1LfgjnlTIB+oHUJu0ag1Sxgol8ai01nn+7M6bkYl5R1wvJLOAAgQnIJfOmBI6t+g0JI5LLG8yHTuma1Fy64Qj1ouAUXv+7CcBwbsITahsQvUp/LpUqxEzRGwJfEZhOG3X67e3tzWTYVrz/GF9zOsF9b3e1s5Bf6cK2GKL9+6YBgHx6b9mjg/DvLgj5hSQscwLQHFs3hLPJ+bQp/As9BDZW98JHXdYIYF3Gd6aPn3+zHaC0HcuZmGCThI1GK9aAShluqS00Se9folsbvR7/crzZz/2Tr4/fH9Cftw4Pt44OOnt9MnhMdk6PNjunfQOD+DXLtk4+In80DvYrhAKVIJe6HzqI/aAooMUpDaQq09povtLj6MTTKnlXDoWDModzswhJUPvhvoujIVMqT9xAuRiAMjZz5+NnYkTMiEIsiOCTr6sI/EuZ66FdQgMbtKzqRtCByAN5RtzvPb82T1nCCAABT65QerxJ1gsnuLHuSTlF/Dk9OaM/PYbEd+6XWIceC41UmXGGrknNh3TkIriDnngwODPQwqtYxrMxmEKJUTHqZB5J8KQlB3SJY0OccgbhFobU3cYjjpkfd3JIswazMV4Tp2ztfiRUksObV4LQtMPgx+Ba2Xj3FhbS9ZJNcGPMjzn7HR+1klWeUj+pOOALgWJmETwkJDubDyWpI0KG2vZlhpgBXDU4Kn81DPswnfoZXlETZC4oAIaf7WYZ3POsznwDOoqPJvn8MxBnkFVQHcxz14IJGqOa41nNg3KTnG28Q6AKvlsi8ePf3waznyXlHHAHUYShSi2GZrfg1aOqV+2YnqgIQXB8sl6l1i10OuDtLvDcrb92HFn83NHUc8UUeMnQM77h078CPBKFwG7ZzSqyMsZwYQJLRuXgbFWo3MweUH/zrXKRj24C+rW2AyCuj1x6o4NGgAqLD9JO7AEzKXjT9Do1m16A9YoBMNcvzADWp94QHwGOMvMJEwfOLsLE9AKUBXy1tCowB9VpY/NYHpBff9O0z/DIabwqXHhmb59fkNd2/MN0DkSNydHjqHRIk1z15xQ1vgTDK0YBgH1HXP8kThwIFV3NoHxF8TFgjkpJBM68fy7/tgLURZPdcYHpdUaOWNbRZEVnE99z4KJkwkYtRBbwPTCcevByKiQUwP+nGn7xtbAetubhUz3cDrqJIs9t2ygygIgRXMXQnPcGnoVgMSNNaSuNbHJkIbnMEZi+hPyxRckUz6czgYuaEc4cI182LemE+5AJS0hQxC4e5Itj4kMloOpenrYkQ6AzxGWjRwUmOCA9jEowjbjFNPS6oj8KIytTWfBqHxP9jzLDD2/DU7T8T7ZZxVKFdJ3fqVtjuNp40wi0zXWTptnAkPyoJnOCvX07ui9vqfmI3oCM1rjvaHdFHDPt5kytBOi/JBDx4ds8QMBXK0RTIJztKbpqZY5BTpChyPfuy0b791r17uFKRe1OcM/dabSQmJQSNlg7vx0bIYwvU6I7YG8oKc/Mm8o2d7vkQC9yCB0rCDRh5z+MrBRacHWgB8QaC2L7fi5k4oCn032bHLDCV8ALDA3ILo58OsGWZeQ0OWrOQEzHHqTz5RLz0uQhtMYTiEDuhCPIkZTCEv5V42oxJRI4SX9b8XfTtXpLPfw8BMzFH3OyG1gHSdmFscLzsFoyqktTBR1FrVS5tO4nSxc0pItXzNNRenCtolJEJrCvGLPrDAqz22cnsTDZNnidulek6WL22bolChd1jZNqWRxXmtJldkMtDRDK166rG2SVsnSTuRLC884qXtZtqHrw4At1v7IbaGXjoH6vg1VLZgf7sDef0eM9zu7PaNNjD06NK27yP5Ehpkyw7yge9myE+P+RE7LxzsqGucEhkXqiEXdms4c99Ijv5GhT6ek6pAScycJMqQExWijStCtMQDngBhtWMMT8/aaVHeBXvdkCvYqJC9b5MGQXkwp2XHGc0mQEfqPJSLHO5HtwLLltu2SUgl5VK+TLZjwN/c2Dn6oAEBqXZNxADVh9ghCsMexND2RR/k0nqSGSRztT8GYBcz5GAY9KGxXZwheDJzZpahN6JChzCVr/8FUpDQOppYjqW+QD+82CFI4JvgvkuBAbLPLPcmXjQrzLUvAG6NS+gUozhlxSUqnpQ7bQHO6zY7zxuzgdhQILG/IPVLnrAKrgUoJ3Val5atgMOD/gQcL7bvN70qldqlSWsPqpy2cvKPKZ9DNw8DILCly+M2XDgmOD1WO/0//8KA2Nf2AlnOYv9bJcWAzcpCQgj5YX9y67P0JJGF0S6rMccPt3+scKWA8vyewOkoJQ6X0pV4OWiAHXagvRYHpd7cEzy1zihs+7HsASxZeGIOOxAUQnAg5Q5hXAPPqjcVhXsXihdVOr84qoXdNXUCojQ34I14Ey5/KNb2rlJjgOZdl+AFl3W7JpoHlOwwdZmAlasHsAggsm7fOKi0mCGpTMbeX4rEVaITDZS3YuLUNoAVrw2F2S0oHAjsBVPx6AVVwe5RVeSHqx8p1D4q1xWvCt7bUtQr828cW6UJcQ6plD6UKKmUrUkrRbYX1V8FxID5PqqMB155zvg0TfFpVFZ2RG288m4DzPwvwpMG+/EOrrWFfkuqJUM6BcXAMZhOF4GWT/JuUauulezFDvq6Ql1/Bv6/h3zfwrwWcUZq9bZJ7yTeUlCDFfZSIWUDtdJl5YzpjPHpKP5h4Mzc8n3oAMv0ovJsmJasCBv9lE5GqKIhyBPEob2C8JEG98rJeV3De3HnXO4iRPi09xD9eBQix8UB2Drbj0rPSytKIGyFSHp5e9PjWdC25n6386iSqsW1xvqCIcMycYqXgrXVUPx3W4za1QF1VOR47F9VLB4/MQIjxy6bjmrBiMKLahuqaxjBe8NFkDy7+mB4n9X0dFCx+jN8a0wH8U1KVG7zZWVPjjibmXelcLalnQCkX5DLI+lrHWF7d8iYTE+fUInXj2ZzvG1ZI6ZdfivUTu3tdi03yBdrcF6gDHzvtCaAyIGrFMIMPb49nfjD3E+EZEJzAVgIQT82oRWjBAAgpDATagOCJlqevz9YbHVKsJczvrHGXfI12XXz/h/K9mfjxTRHqF2cAe2jNC0qR+Eg55U4Hs/Ftcg8mmUkk4yFQsijtiBCxq+5r8Pps5vIVb7nCOJHZs4ty/edTMhiEZ1/WK7ASQVyvVsKVMy2WO3RIJ1Pmjb5troD5yshr8YeuV6Q1/wwZKBLBaD4CRiwHsRgoazyQK9BIBpv/fQyeTDgrq0gnfB6K116hqhzuw0Nhu8AecjNdeAxFMCpSR6J7thzbUvHdlfgheFDxj9TRAnojV4s9qvSpgAinwOUb/tdKPU6HxFxpAmJykImaA1g8fblKBsgsaIUfcdCAjU4BwNmpseH75h13IgzdOa++1Y7vez5uE/gTFse0BIBEuCUxZmByzvQWHF+iTxdjgQD5QYo4bmOxTLrnB15I+jxCi9q5tYwFh4wLkNJSiEHNoQZ+NKdEOcXZM6D0MVtZig95SxprGkxRGvFYWwk2UT+rSCN+cmhRQCoXtOZDIWXAk1FQxlCxfYSoDGMR8miHH1mTHznHkrbCwa+OfPGSJj5phi9LA5DwI48r1IioxPPkYku0jtdBs+BC7CgUWghB9arcgVCXQgqY3LXQE8Z0/LHXQwoxcEH0yGXQskVQEYdolWXPiiuqxK4nGfrebPq4dZLcDn26lRIbdau4nz6Px8LGwRZXuMxabXVl4TZPt1GwOlJgDhSYv5lzCsyffLUCthtHgdGh/yaln/vgdRduu5K7vb7OB1/c0yvoShashmsMhsDbxpMTUVnAyVXbWmdlR/VjGL4qN1JsP1mF7av2RYS2vV5tVZyiLKyBRqZv43l9cn3ckqRurb6wkSvAk3a0BiS41BK0WXl5xVeBXcLgdD8C0EXyVAdAKJsxxfdRog8K1h0I1t2bCy5Yd6utrB+xtgZXiIUkia2gu7NKvVtffcFKyCh13gOQmpXj/snG8Um1+RiAN1mAHNz6o8Axnv+XkJzRYyAsW/gz7QHYFXIjhf31Y4R9hcV5Aq/VFugr9vMxMxBZXS65wvefSOG5iEcq+hgJj8RbQvkI4b5Jw3q0XBcRyRaK5M3jzW9xMSlec3WR/WvsDynrQ1haFN8qSi8Ty/PHrhKnlrPKKpFF0iTWhwqAv9eHCjHYgdnkcy4RP+FBmplcI0ZnacWXiCa4NeYbk7s15hMuEWPbHpyaaNxJYeN+kQ7KwfYTGpowNDSgheHMAtWiczjNCuFmvSiU6GyCTXUAs2jD5MEUNNROAwLkyusdCb2CELmwp+EjyVY45khAnJju7NK0wplPfS3crx4HVwl90oL9R2GwGKyELb49Q4NXKur3rL4uZXijHN0FIZ2I5dMKLoGEU4Sq367iRK1E2GbjMaCf1hFYHfCfynXA4NZHuw7kcb5DvU72WKjOnhmEZNPzQvJ+Sk6cibjynIr2X2X2nwU+8wBmIFQTyrwA+M+oBugJYMeTWYAJCtgNYDDapnvN6UHMkFzQocMuz+OpQuBN8HKMGXjud492IaIbu2ULzxRyL/iSh1wPQwuNxU0tEYaY3Xjrd0gxMqr+88C+/+qhCv+3xP+E/d9W/n9ZV1rza0TQuhbSIMyN6srcmEoIGfIZ2fx+ikxeGj/OhEV7R+2JHMHfjZOJjpSQRDOkpGqT0n+/LJfJyzL7vf4qWCNV+MWj90RYIvwrv2yuYagfv6jBJXuNrK2VSGn91U/VV5PqK5u8+r79ar/9ql/KvUO6QEQ+htFPwWzGcL2Z0ZiR5GWcrFU5OdrX2pGCdwPD6QT/NdL3g9KHnGLQUBXPOLNEwbNfkUilXfQ+oOwb/5O3sM4n5pWnvUq9jIB5lJK5CfgIkBHJ9AK3sGjzboPz24ljnfsi2wZOBYkkA/Iqseb2sK+IH1a9pndYM32xt5KopIQuAGLKA75npxRwlOQlcV6O15u9Ma2NvWHZ2MOO2uxmjHpVGSaCHwAT/gBxEuXx1BmdSjf5qbTaOidxCCLkXVylz7kT+Di8S0eVeT6qiCqOhioRRnjAzU7K8csbFXVECn7mZ75gBJxMofnm7PKS+rVL35vIbVA8pgaiXLAFekLC0rZDGU2iLYBO11WeQ6+sb5GZ5DuwsKSNRRrbozSTtiZZSaNimJUDiaG2Yp1mYBUyNnGuj9qBZ1OlDZc4fsAvMnoobaU+8Vr5+iTipFPJOsCqT5wgEXEsihLqMW2iGaS3sn45npF8XED79CqamFBpGbygExVcsYIrZYJiUFtPCZXDnTZr5wzuVIYgTVtQgvhPm53EtcgJ2naj9I6G1Q+MOOQ30gcuWGH18OIK/pDqke9NqR/ekW3fuaF7NAypX+HGE5c2e+YFHSu/TzDwFG9msP+O6cRkLl2FtcaH0MOW54JtDU+86lZwQ6oHHpYrgUUlQ6FQcZdDFNWoe3NqIM8dvJW7jjs4HLfXrcHgRy4LR94t9fsjOh4PBjfNWmMwmGJJgCUIkbktcRHzYV0PesA8W+IXKKPHvrJluGvDdyBo5OgAGyTu7K8o5rNxLHSMJfGDT+gQrbhx9tgOEAS6QCkQWsNtVnDakcdsYC8yfnOULSd+YKKF4djkpc/wU/5Xel4xc6Kd7nWmFJqZufMDfhTz2WAbC2Bmv/iCRDe6sAhTfl3CTGMvt6p4HzsCJ3stsdQYYFyz9XPAyA9eIWzHyCQBVvLbYSB41K5VvF3AUnuIdq9Xa+dLexEB+Ko4AGjs3eBNn6jx16nGLOLvWFYzFsCybFDQxXC2tqvHh/uGHkY65E4/4TEpFqaAmffyPfHRWQ1BKWTvsX4lbXw4oq4yXVzpNYxr0FXNT2lWJNpXtTChXel5YdMJ9zzrmvpLJ4h9jPU4wvtUFV63D+79LKhAhZAyLHnBKjNAhNGfdRZgzGppZwImZ+nZoJV5GHEq4YfHz3/PzZBPMWvEnWhnjsWutdPJlj1ifsBP0TlCgwnT5WJzBX74ciJj4tu4Ih45l2GMKJib2tSb6jOIiQQzzNFPHt8tQRU/sqW4PCg0s5s3T2j6T0CZpnW8mzdz5EBakN0HP8jXS7Avdm973/SvqY1LTOjk0hxjwlT2SPcgvmnI5LZCprDMv/V8m4vx4g5hZE9id4LI7oBliOwKfEe7Ubfwf7Ac5pBWL2xKqoKWnh+Q6hDMt1HJyoqYDGFZW2VOtU8tTD16J4dnwLP7zFaY+pGDy9qP9JMn2YXTdr0wmZrKCbnXoUG6iGqrnyiPlZLpMrnNMF9fFxlM9jxvSqhpjViNfJgSTfPCijYU5jlLX1076HjsgOrbyD5MooOAXnSlIwm/4qSZxgGoq+9Y5pgcCWaD4eCb6zscDultL+9zSGGudVfpMrBGwIQfqOtCp2HU6TsGqFCflz51rYLD3PdCAtqAVSnYtonsbpfBKNSdIGuR3hRS4sMXK5NcPihK+CJIKaTORWoxU4pjxVmzMmP0qC3hXTGscH5LKsZvvyWlFn6rEgU/VY5HtZN18dfCdIkqVVw6D8d8QhFaDRa9WVCz5SBYm5SVQaKVI+gxqaOympoNtbeNdIYh5DxFNuCJRJFhMazUWTGC6dPp2LQo765isH3yqAS6qOBtqeJDx49uyg79GS3Q/IGdPy2iX4p8hUevuAASxCrDedRgFldZ8HjBo8j5SrCznKX5dyrD20gqpo198C1gdTdmqzsSp2ko0KN0N45iUpbTxPkuJnRen4sNgcywSHXZODW0Sf3MLq4B/cQRZ2JdLcbHNpKnrfxN5Pysz2KzStZsgwNG1DzPmPwnqLA/FbZwiTo9NRSoLIeMsuWVSBEd+aHQSfV2gkn0/jWjGN13fHh4Mhhs9fY/tEBTS/2dvZ2tE/Il2T0+3Cew3n3dOt90PEw7cmocwwreDOg2JoEErd5XIkzwd39/s3fYx3/i/IwVsmSIBzyvcLS8dS7FKRb4puoBXXZQ6VyUUbMkOur6IBeIknJRAZMYRkE4cfpFBVB2/IWgKUkkVWAJumUOLvSgsvkMkxlZPloSgNybmGqSicMRzw+V4bJGNCKCPEoAkjk6FSJJDJbSOZ2tcxmhFwN6CjnK5PFUIKXF5+FpubjlTaazkPp8X0vQkHH0/fveNrLrgNH6MbzKZBhVhsWgLyNMJs2oAuAgnZI1nScIsxqlkgR9Avodje4C9OpFVuplZEq9+0Ic3Ss0qAnLH98X5tU+DfaHU4ovlXGHnP1PiL4XsFSkCss+zQi2neD6CPxYhye1ezL8pxJmkGYBfpKJrAUkXR5rgYVzVtuO4yS7XePd0UmbcKLrnc4CZp0lul16RvDU8s63qDyf2QiRag/NBM+bzk1G2uLvm/MtdNf6U0rtyKbgVIE+XAikcYYu27QvZGgiJmFO1ayC4J+nHPIHYIO35bmh743HlA9cDmBr5sOKMPze851foYY5BunyxjNJFPEYbHiIRkJ5uNI4h9pxPrUaseP1hWxl76aAL5HCBYyJzq+cmWzXdrWR2dhnRsUSTASPv+fCdB2yZLM4FQSR56Ma+JrMdUqUN09EijoUuZFBXVOU1b/4KFXpVLQ/qyHn10TSPF3vPMBkcfNORjnjQcpcqpzwOUNNpYzUjti+SQ+WEzs73iXQ5WsYhFS0NTBP7ZuzmnheIUxOcquxp/LtDTl18KGytkqkEM+ga8V8TxkH3OxGgqv5CtPxhuIYL4447LnhCe5C4wFAtFV9I1iOSzu+Q82CsLZGpr8F4ymXb8jbt6T11Rr5gjTmu7sVwkua/0iXfBsX3IhvKA8dZYTqseUqyj0Y9Kk1853wbjDYdyzfw3ehnUwneUoPj5i694INGOYNLJ3s854Lim2OP2DHRgUe7bh4zq15cHjrZotVy9+zUwXRStBQ4iqTUb0Jm5GeF5G7xUI1Ixg1pVhs72NWPHiiObhPIt+OJCFGqZasEu9u1U9/Hswbjepg/s3uWX2Id3bWlvSgQVbzWANEYZfaOI+LWgiCq8n2OlZrWzPWJ9tmpSHVcvXQVrHVor6JbGJaXpHtE6UGbqHgDT4fNCeznSKP0nnJE0Sm/34BWHEkuuP5dEiqdotULdI7PBKvfdmZY0gFn0Zk7nO20qw6dpRevotR6iL7IyamZQGD4rKbSDsPRTwtefG0smkLHS/aF4aS/6dwIX6q7jd8Fp7wbZC/uQJcUe/IfRZe8J2kv3kBvBB7YZ+JDbzvv/mgWircr/ud2aFuH/51uRHcBVY4JlXm3IxsOsWFS+3CN12wzgzCY+mnrIv+urQL6eRcBFP6pH/Et2G3oQ8MaSpKOTU8aFlsUAxMpMAJ1CSaiTuvy16JKQFgfJvoRYl/4Pu/rGGbv5oVVquHe9tkf2OrT/DN1KS/d3jST7rZImWn7LKpGxEfSn3g3rcqD3UYGr6Gu/w6fSCvgqmBDdgB+YyChcsBlFcwRcg85zqhcrsMqi55K2Walpjke42NmEUpkBH1c2KnIiI2JBFfdA1Dl81URQ1ROuQ3vsROS/SSyRS0eInXflln4QuwguD7NWytgzsVTMtMfEk3oZNpeEe44i5GQYkLUSl9ymi6HgdPLolFi0IvMhzC0qUBDfJVoPKFmSvEQbC7RxhCIiJblBjUAuEMIjgS45URRkzwgm35jW/ZepV4GtmSX8nr8u1MIg79MEJGlie2sfHdciM6P/E2Astxyqlu10j7EZgIKcR4iDhOhrC4mei0i4c8gGTi9Xbxunrc2GMvj4f2eNWNWuHizhYFhyxCNPMyVoFxXpsCARa6C+I4xIOdH2PLdvj+RGfcNO+GTSlv6dBlXpz+LbFRHDGmqY85VSEoAVwAZNXXeVVVoZCVv9JXTrx9VqEDTtR8QyKRFVgOLb3r+SednPH1WrPQGbP3w5GqOR6vMh0HPBJcOyMLO/Nl9ElOyrJpTnJrtjee3TfHj3KsFyW1TkGDQhbam511o9lONFBC+DUmPMaix89JMxm2scbtyBvTnxhYFoyuqTIVB9CLa3ljG9zLnArRsK/4sK8y4cxXmjFL0GC8PgiLyrXh6mzxTBBbftl0ofFXjX3UoHkG5lj5JTWurY/Ix1mOW3UQ/A+OH87MMVj0iCo5IXiJZj8iL1iApcAGC3/CbNkqm4pAkgikYB14ACrJzlxofEsaAURQxcqtDqbPdkzCTijz3KBY8uLDvnjGWWrE83HAV+qx88AiPbOKUbdSaIiB2/N464FduM88017/WBzGh9SXPNLKMVbgwpDr+bBcdzFz1kjidCwelk6E81/7HZOkGKBle+r4WX5YKL6lJ5q/wEvizO9/+kO97019IV2zEb+R7rO+8E3riaz2AjjdnInrFjFvsq9vNODjWZStcrKzijx7TzbjiyKw8nhPCQ2NOQu985GXY+I0/aIBAe+awak0i+WS0OOiLFEbYlXughseeK4zMclhH74R23OhZOTdshvQjEaud5vs8/PlQcpJZ7lQrT6DVnENUt+W+M/fSXmS1Mi9YZZz3/AJlOoTKddiwZZKhvwsoGT5w12ibPJTYLGofcukUnG1N6Dumxao56dJWBcwFWV7uVHGumvqu7UL6InlsfuPTV7H90GRBkFoTqb7jGNdUh/c41oJN2IG9jqsrGf8F/wgg4c6I3ARXUFhfhELoTZqhD9iu33J1GZs1yYAfyssJxHEV8ElMjDofThF+DM50xZA7mjnmxUSpRUIdtbqgsA5FV+hRFgoW1zwlctHRFLw+V9EpYn7Y405blELyHGVxKIuKgZ08qHwbTb5kNmRFq7rokJ1k0DKPy/SLd9jWJFxROFvraWTXEDFI9Pxk7jxJL5OhbRUlgkF0sWBRTwX4CoYAZZKNcWxRmGOo4cGs0bjm93qYLYLHxZAJG87sVQjFPho+qYV4ttzsUPSmDca3zZI6LEIst3dBGsTJzyZK0jnACsInABPSJT4GfRjKLUDhHmBlofhZkMLcHZE2Bm5mIXEBmOFdWZD3IeUTxx44NEA/J4Rcy2IiS+IC0D7fUy/N76L2fanSsRhVJP34NHciAHELxqTKnV6Fsd2ctMl0+N6/j4NTbSjKLFiXFV+Zd+XAvxXSd+U8B8xAcyPE0ekeuGRh5x5OzALesHM1ySE2ZlPgfxRWpitWGKDxO18TX/Ml8vWKbAU4vf2pAanmRGrcfxqNh2AFtfbGX+1YKT5WTUMomRnihZmAkCVNDtFI7wNEex5tBXnU8u/88P0Qq2ajshUElPpJtck1aKqGZi6jf8lwJrizrdNL03MFukE8DW4Dr1pvieYOo9cGaaWVRgBsWtiPo2yMJ64rtPFHhrbO/0fTg6PpEoHYD4RrWQzfKI6myYQo9lsCzOMazMwUXaqwuuGrHCCq6gw/ThqLzIjOVApXacl62yDNQKcElUEvXAUJxubezsn6a3UC3BHrzspmP9kIFmqC3OaYA0fVoT1gRdS8Iav0xW+khX6swtNJQWrvY0jhbR5WAnOtnUg0nqHRryFSS33Dzd7ezuY2jLNQV03C2JVnz/jLI/mrqmIoImlhQ3bYJl2DQXLiWfPxhSmqqnHD1XvyTm3h71tQEu9DFQhQxqy06fZXA2HTXisKsK8y1tU/4/rUnOFuUIUh6Kd9jAwsY5UnnZKmSok5kU7xZslQ+FO98eNJRNNnNtnVqQ0vTGYySVSOPK9W1I23rvBbIo1wZ+SEVXo3z1oewQpSoLHJMb8trtyJ0GWKZMH26NOiR3LJchlTfVU2DkQd1Ye45j9kU4aS2D5RWLtgI4v6xZ71aN880r04hUeuobf49i1poxdQ5+yVMfwNVjj8Ni1brdkMwKX1kQe71Kz1HlYMaKNETtDFJbfkRmMjobXmyYmSL1jDi21kzwXz/jFTWpr49/VM758Y4RP75dZTa3Fz5ou2b/mVUJRsmzw3TO5spk7fo66Mb7TJ1OLLlkK0MuTqGVThOem6la7r+Nhk+jk1GGLjDrO1rqk3Wx3THBC9/LnnN0yzp0F6T7S1Jafxadbeh5lbD1+kJrv9lX2nL+jLuYl2gf/aISHoprDY0yxjjx9t1/bgr5C+sH0HXQdys2Wrj7ue9Hx65ba5MAMnRsKDv38DpMS8Qo1e5ztUbYWDWHZNPJstowQd9TZOo/fNUy35cesor2uRZmNZa32wRyjEjaKiBNvA1LAs2+X10Q61mbrWzz8zHna+vrrJ5IMzT4pes+FgTPXiwhxBRHHxHDUruA5BXiRsEIfUesaSRdilB06xGyywl12vhXg5eUt4xn15Gwu3CvFV85sNuRtBUezkgIs9vdY4qXkE+Gfap4IR26101P86NUo62fIgX++85sows9ae9xbLFZb/T+6m3iGnk4CkPDqkFyAFGbfiZaYmkHhDnbf4gadCCUflFAxBiXoKuc1OnGvC16NkbeXLCZj7htJLVwkHJmM8WHuTP5hPzl7f9hfOmGzCQ/lilEcfMqyuvPk2PwNHWh45PcaTGji8kh2Wpfrz/zKqQax6H/Yx9f2VkjPtWppBeA1/ndn/73+yf/RjM4ImuXbOd3sp/dKdLUfEswRtErc7oiz/uSRaXmTjyCWhiT8QZ+amCdI/3Bnt4cxjnTsTSeAGPnBCUmvR+rk8MP+rr4JTrITb05sJ+Dxoih73iXZ2f4Bmv7h2KLefeJSnX81qpsidI7W5naDgdoLdWRhk3zm84CuTS/jFCee4wHkyHHpZ2PBglUikpa7jCwXIxq1DJ3wvY2RP54ilkx/kE8qsMA5bVikpHIMxFlMjAJvD1mZbDkJUmLKsKHHYoVGOF5pdxYY/+fPlhA2tvypeUIcm5/HKbxTbxuRO0vgyUUJ0KAWWo3qWyXzWVwjukvI66hBy2oledON18rkLONV1cu7mxv9nc3DjePt6luRKwoK2YWyurxbrDSKbpcqzRJXXmVbXrHqyouwvFR/T1aBH48yhq8ONYI/yYw/ddVPARCN/fmz/weNU2+E', 'base64'), '2022-10-27T08:44:49.000+01:00');");
+	duk_peval_string_noresult(ctx, "addCompressedModule('identifiers', Buffer.from('eNrtff132zay6O85J/8DopcspZr6TLvblaL0Ov5IdeuvFznp67G9XoqELToSqSUpW15X929/MwBIgiRIUbLTtL3rc2xL+BgMBpjBYDAYNL95/mzHnd179vU4IJ1W++/1TqvTJgMnoBOy43oz1zMC23WeP3v+7MA2qeNTi8wdi3okGFOyPTNM+CdydPKJej6UJp1Gi1SxQEVkVWq958/u3TmZGvfEcQMy9ylAsH1yZU8ooQuTzgJiO8R0p7OJbTgmJXd2MGatCBiN589+ERDcUWBAYQOKz+DblVyMGAFiS+BnHASzbrN5d3fXMBimDde7bk54Ob95MNjZOxru1QFbrPHRmVDfJx7919z2oJuje2LMABnTGAGKE+OOuB4xrj0KeYGLyN55dmA71zrx3avgzvDo82eW7QeePZoHCTqFqEF/5QJAKcMhle0hGQwr5N32cDDUnz/7eXD64/HHU/Lz9ocP20eng70hOf5Ado6Pdgeng+Mj+LZPto9+IT8NjnZ1QoFK0ApdzDzEHlC0kYLUAnINKU00f+VydPwZNe0r24ROOddz45qSa/eWeg70hcyoN7V9HEUfkLOeP5vYUztgk8DP9gga+aaJxLuaOyaWIdC56cCiTgANwGyo3hqT2vNnD3xAAAFI8MgtUo/nYLLIxR/7ilRfQM7Z7QX59VciPvX7RDtyHaql0rQaeSAWndCAiuQeWXJg8G+ZQusD9eeTIIUSomPrZNGLMCRVm/RJq0ds8gahNibUuQ7GPbK1ZWcRZhUWoj9n9kUtzpJKhV1bNPzA8AL/Zxi1qnap1WrJMqkq+CN1z744W1z0kkWWya904tOVIBGTCB4S0plPJiFpo8RWLVtTAawEjgo8pa/qARt5Nr2qjqkBM87XgeNvisdswcdsAWMGZaUxW+SMmY1jBkUB3eIxeyGQaNiOOZlb1K/a5YeNNwBU6ZXoP/7zaDD3HFLFDvcYSSSiWEZg/AhcOaFe1YzpgYIUJpZHtvrEbATuEGa7c12N6iO9xoZnoYgaOLfAnK53T/iwQxns5MxzTZAfjdnECIA8U8ZeE9uZL7S4nWaTHIEkuAUJcu9f+c3h4bvB8RCE8GRCTYCJgpDcUWK5jhYQRwhKf2bcOWTiz0y7OfHHd01ralvUdC0xUQPA5UGJnxDFVe3HdKZWA0YnphGYY1KlKAWWaVox5C9tSRSlJlCcA009LHtxFoxBOgmm9pxGBXk6mxwRjle+VmvQBYh3f3jvmFWtCURqmhPD97HHTdsCbgdEw5+kzFsB5sr2pkiApkVvQfIGsAg1R4ZPm1Mg44QBzk7cJEwPZvE+LLZrQJWmUgMFKPyTxdcHw5+NqIejUVOKmZjCZ9rIhTG8hOGzXE8D+ULi6uTE1nqlqjvGlLLKX6Br5TDwqWcbk0fiwIHUnfkU+l8SFxPW34BM6RRm/3DiBjgXz1SCFmerObYnlowiS7gUTM4mGDURW8B0ZDtNf6zp5EyDfxfKtrE2DL3lzgMmZ3Dp7SWTXaeqoXgCQJKUKoRmOw3UoACJW/OaOubUItc0uIQ+EgMk0F/+QjLp17P5uQPcEZw7Wj7sO8MO9qCQkpBc3KjXMU5kkByM1dPdjngA9KugquWgEHIfgyLWIZSmnVre6ok/0sA2ZnN/XH0gBy7IN9frgoL44ZAcsgIVnQztf9Mux/GsdREi09dqZ+0LgSFZ1jZs6f3JR3VL7Q1aAjHa4K2h3BRwL3cZM3QTU3mZQ8elQo8Ipf5iIcR+MhcVIBWhg7Hn3lW1j85nx4XliHFzZvzkVVkJiUEhVY1tXaK10nJhvuCuZmzA2rh7OCA+asx+YJt+oo1wqc/AxgmTXQFf8CU6M3GQxWFJAapm6jQgPTPtmb7D1jzUeaAEUg5GB9QSgAHfUT9Z3XmEAK2AYuYrxZ9le7krXyFGAmgtT1dNNoW0zWmnqZGtEBrq4g3bZ1Kulst7TBoUTuGzGF4pqV+ITxlJL83y6r8VczxJmRR+4UZJ2hilyvSUXFW8qYgGXWiMUjlpDidWS9v1L2EhCJfrIJHUK6ol6QhxvTBxRU1mfshUFamFdRMLO1SFtdKam0GUnls5rZgEybTieulWk6nFdTN0SqSuqpumVDI5r3ZIlfkcmDpDK566qm6SVsnUXrQXkvYGRcOG6hwDViwkIlWMXtkaioVdKIpblntYw34g2se9/YHWJdoBvTbM+0hcxVsMttgUNB/W7MW4y4qYxDflRX2iOXM2jymXFfuQDTIFC/Ty1pgnUgqfRhlUKIFAatJEbJrQGdu5csmv5NqjM1K3SYWp7QT7V4FkFKsVaFo7ByWMaF0N0oy7z6S+D2P4QGYgYgPyskOWWqgtVrKNK7XEfJrnaIO9xO4dBzcXRJ9UKjiNYBu9A3rWu4Pto590gEvNz7A9hpKwFvoBrCh/nDHjaP/xxinFlyHLwsjsU2R41INxCq7LssjzM1OtmUF6fheu5S4k9nWSqhRZJQFUwiqp2v1XoRCs9w2mjwws8vYt+b7G7HqL1utWa/WOPUaJ7xMEvKnhzK8MM5h71IPh1dggizyL+qZnz5j9ZYuENTzQ+NmxAFCsBdK2qqG0vmUVM2XekPZfUSK3NNJlBt4IeFgkVqLaf8VsrQalWNnaaiPbH00qVpjdLOQwjXx6v02Qi2Km+mfIVMBQRp9v0l62dLZtqyB59Mo/gas4s12Rylmlx+zwdr/ds98YPT5/CK/IN3v2hQ6Dr1dwRyjVfOWfn/M/sDmE+v32D5VKt6JXalj8rIOqZVT4AppZnmvK3XoBX/PdeT5r/Pfw+KgxMzyfVnMYXbYMZvaIivV4mWH+IbArHooMNhQAlu1/9tWbM8zJFwI+b/iS24v8crKAwSyWBoVthEaAHYPxbZcDRIYTKTo5RKEuZbDvoX0gSsWvZFlqu/v7Z7rxHakzycn6l8NwjL0eCNA+xXd65Rs1y3WA5fpQPuQ6tlz2K5BvcmKzzz5QkifGoCPOBASngqUR5g3AvHljcpg3MSdjsbObCz1wP1MHEOpiBZ7Fk87aF/pneq9XGI/bV1X4Amn9fkWS4kxfCVHz5yMgcli9c6F3GK/JVYU2X4n7VqISdpfVYP1WVoAarA6H2a9IDQjsBFDx7QUUwQMtVuSFKB/LsQeQYWJ2w6duKNZ0+GVzO52IU1tOW1Z0lH+dSP6JZnXWno79QHy+iDhUCYnfQiqKdsmtO5lPqU/mPh4XW1dJheoRHP14blYoqNYVqZ8Kfj3Xjj7AooXz4mWb/A+pNLYqD0IHfa2Tl9/C73fw+zf47cBgSdXetslDOJQ4efzUhMBJMveplU4zbg17gv4D6YypO3eCy5kLINNZwf0sOdl0WG5fthEpXUKUI4j+GOfaS+I39ZfNpoTzu733g6MY6bPKMv7yykeIrSXZO9qNUy8qqgmaMzn5xEQLbzgfHjULM/o4X0vxzK2RPKiTvvUSxdh5H7cqRDhmXBFS8Go9ebPusLPNw9Binbvgg3qaXdq5ObuKmmhqs58AG+oMmTNpRABPOPCEUScomPEPjDga3+7TOgBkoeFUBp1/iJ32aZBrnQGkC4WHQ8HJNkNIPh/NtIWIp9FjDSX9I1Y4FaRpF0LA/50LpGRozdfwrGhF0SM3IEPu90KtMhW0nJONAmsxo4wA0S+Av8Zph9ogDhOFQQx9N9hqGKWhzqiqGZbgGh9DdvWOKWzyeHRDzaAB9X1svhaebL0luJVMMGF86AMfZIecmNUiF4AUnSJnlB/ilWRij+pXNnoewTKCH97ZjgGspkVANAXXxS3kstzvUwulnqeCgsmb6LIxHbZIhdTDI+SsRltZoROHe8wV5TRI5StKFRadWk9bXdx0p1MD9d0yZWNNm59M6qTyz3+Wayfe9fZNpoCXqPNQogx6+6S1dGQIRK0cZvDD66MHFejlRGjtBJXLtQDEajPyGKoSAISUBsJPFUXNs9cXW7BklKsJujer3CffoYIlPv9V+txOfPlbrRzckgPAMs1FyVkkfsJ5yjcETNnqkgfQjdiMZGMIlKytAZHvyF7Djsxi27HyNdfoJw72fFRt/uOMnJ8HF9809UpFR1xv1sKVD1o873CzOJ2xneLbdm0tOOshr8Qfml6T1vznmoEiEYz2BjDieRBPA8nUBfMKOJLB5v83wZNNTr2yXr1l+dLL9af9cllZpx9CTJfuQxmMypQJ0b1YjW2l/EFCYo+dqzqjrnJTvLVJq1DCOTXS4HvFyvjNesq3rP3frKVOC2+AG6GFXpxp255n3HMlQsvTSbO19jzP9dA06k2ZV/gKAIkNQQRmfd0adboYC6Fjy1sAWFtU+Sm9P6eUVuDGVICUkkJFKn6OTl9O+094WwjxfSPr4Q9qb8BwW5m3XSs5GwtoUWJWlhjezXY16t1NPNMetdnK39aU2TdF/smSfClrdys+csjsZZpNMjSmlBhomBvVhXFQJ3djG1Bwnck9qMt+4LPLGyIXPhvCZy00+cI4+uxszU9aJgCm8kAD0hP2ygS9eKXsAYY036BIzoxTnGhCYXb6IB9AhvtF2M+L7BNuglbkDJlbzRHzupXnmOk6ASBMM9Mr3Rs+tTg01TmHvMOFUiGZVaakdfa50oCqdrpSS4XWpf8V212JGLjf3XCXu2qP+/DEu9o1N8yJAydy7bnz2Wbb4PAk6uk2wqzXnfLbsEXcF9YPtnfGXfR6m2cTzen9VsniSIEFUGDxZsEpsHjyzSgszdgLvEr1P6TyjyFsqkrXXWs3tbXFO19ekV8+nfoutpAMgbetJyeitD8PN+W13tr7kMcM+LqjkRr203WGfYN9NCPF6/WMHtkdb7g6Jc0fnZDUnfX3reEG/7QbbfEJ7qQFbdbePfNNfp8wOP1HABolD9QBhGRrI5W14eHEuoeJdf9mxCfWfW1NCGubTkDTZa7hwtJ3f6E3+8317RGEjFNH7QCprX8Ynm5/OK23NwF4mwXIwW1tBI6N+f8RM2e8CYRVdh3GPQBbJ7fhZH+9yWRfbsh9yzUn3PIRomj4hUURZ/jhEzE8n+IRi24yw6PpHUJ5xOS+TcPaeF6XmZIdnJK3m4vf5VOrAhtN2T+H+S+znS1pCUxbAaqL38AIsI73caJrvFLhTj3tclyOZlhL+BeO5n43dOWFz7qwQnRj32H8qhPZvzjKlBN1IjmodVWux8u00YfdcOflkJHv/YBOJfdNBc6UfsabnlFhvMCoxCwqUgLHuGwC2546GkBsS4DqT2VLYO7EKiuC1MZ/rAgSMdip+fRrGhK+4Gm6kbQkRAfq5Q0JBii/xhuDK7/GExoSYg3APzNQBSClVYBR2msW609pYEDXcJktDWfuy+s+h9PWCV/8y0KJDiiZQgQwy1ZMnk5DRaWyIECuvSsOoesIkU/2NHwk2RpnnQmIsjBUwv12M7iS4FSC/WtpsOhNjDW+Z+5elcoXs14wvCPRLzbZayiOIZwyVP3+YgPApQjbbm0C+mnVxfUB/6EUTK6Fbahgks00zGaTHDDH2QPDD8g71w3Ixxk5tadUfQF3rTgF4aEUPytmZ1MwwSChDqvMledO2WnUCBtlybYjLoDi7d3sqfqIFeqT5j/4p+q5tVV72ZwylaM42k0ENRFtRaUmctB5PYpQQZyhDL0juwYqDDheAyfg1dEJhXxD2q1Wq5YToWVm4IhEwYqqtyIkA4v9VL3Fa3Ct1DU43BEueyvOKHEYcRQ/zk45sRDTxjUN9qE7v1DDq7Irc3V2ac+wqmH2oesEY5bXVhdg3azV4ht/Ut6P7hzDK7HMbgYy4BXQ3OwhNV3H8qulLu8lbmMvc2doIUVyRnYdvXbue0y35bOZ6bfwR6v7qOPirJ/OfYxmyMKFgTpiOJ/5KBHgghG9tlmkPdxh+e4UAzQYvuv8oMCnvIIczyQTaZMbESy7N8pTlmOIjNjqarmRdngYrWu6YPx6bj18u6zD3474S9jfrvT3ZbOnimAFEBowe4LcGwU5LFrEEsU3hFeHkvm60ZU2H+m8KzLA2aRukcp/vaxWycsq+771yq+ROnzjt0nENRn4rb5s1/DqCRepnANqpFarkMrWq1/qr6b1VxZ59WP31WH31bDy2GBNj5kETzURVsdHUSywhWIrtfSenhzmirISoW+C2RR/W+m4FjW1rgFF0ZqR7SN6SYkArt2yYW7CtvFPGD3kcmrcuMqwZusL+GRMRN6DbFjEO9ux3Dv/8m5qm5eeiPKJ+lIi4F8Y1ksRycuTZigWxVsOUDIdZEtPFJKc/AAxKYMffyTiCSJKoYVN3HhyHd+d0MbEva5qB9hQl62rctgwWFN+Akx4BuIk0mP9MrLStbmVTq6dE7AUEXJHN2mPsAQ+Nm/STlxFZL2KqGIrqJJwBWOWQ/zwRkYdkYKvtUKPy2A6g+rv5ldX1GugnhieKKFDFxBlxIxZiRmWXp2k3iTqAuh0WSkfWmVtRwY1DdUvSFKsTVK1UAyt9N7EaKBIDLkWazQDq5R/WRxjtHHkWlSqw2ccN72KSKKKGKO8VD4/iat9qcCZIPintk/lBVAkJdhj1hYKssisxguXh1Ymj95E6xcyLYPn96KEG5ZwI61jDGrnKaFyuLN245LBnYXOurMOpCD+s3bihiCGIoTVufKeBvVPjDjkVzKkGP20zi9IkfqJ586oF9yTXc++pQc0CKinc+GJ+/8DY0Qn0vdTvKKB94vZnw90ajDtUGe1MRNa2HFhq+UFp259x78l9SMX0yUX3IrWy4YcWq2dhDFfqXN7puGY2xhNagvNnBy3153z85/5XDhx76g3HNPJ5Pz8tt1onZ/PMMXHFITINJw4ianDjgstYHxv8Q2Y0WUfma3KseAzEDTSiWAYQtzZ/8QF1HjSsSH5TfSmNa3LmzaAIFBLSoFQCm5Dx2Un9FgAedFL5kuRa+MMAyUMxyYvlKWXUtHS64pR7uwnWiOM3PUhJT5b4rIlumlGcQkwCUONX8FKY62WqhhHLAIXtlphYSpBuK7tioyxRroxMkmAen49vDIV1euUr+ezMBqi3uv16nmhvIgAfFseAFR2b/FyelT5u1Rl5hv/ISymFcAyLWDQYjg7u/UPx4dajjt2qQWPzWIhCph4rz4QD5XVAJgibD3mr6SMD8bUkZaLGzWHcQ66aXgpzoqm9k0jSHBXel14ZwcHrvmZeisXiEN0mzvBEAA6LzsE9X7u61AgoAxLnrDOCvCHXwXE8qtaCZSrQSeTGY1UQg//zXbaX3zVWLFyFKvWtsJOs8H6sM4akSNuS64V+MO3ExkR38Ud8di+CmJEQdw0Zu6swJYQcEU/ecZdYmUIa4p4F4Iz+3nrRG8FlFmax/t5K0dvo8C1OK5XIF+swe6h4X2mFm4x0eJsTPChFpalyoiDY7B5q5MZbPPvXM/i07i4QejZk8gdP5I7IBkiuQKfUW40TfwLksO4pvWRRUld0NL1fFK/BvGt6SRHHYCKpM6Uao+a+OTJfdg9DfIelrWCDoady8qPdM6TGesyTRfayuSRCG0dCqTLsLYyVLP0wkbSzLDY2hJhLQ9cd0aoYY5ZieJ7c0zyjMzIoLC4KA6JLNeDhic2sL6Fw4fBXxHQi36oSMK3+LEO7QjY1bNNY0JOxGB3MVQg4rvH4ZDB7uo2rymstc46TfrmGAbhJ+o40GgQNfqeASrV5pVHHbNkNw/dgAA3YFEKsm0aNrfPYJRqTpC1TGsSKTHzxdokDzPKEr4MUhKpc5EqHpTyWPGhWXtg1KitGLtyWOH6lmSMX39Nzlr4Ls8o+CqPeFQ6WRa/1VZdgo1CKNFFMOELiuBqPFEsydlhJ1idlJRBolUj6DGpo7TEyySDXaQzdCEnF4cBDy3KdCsZQZFZnwRMj84mhkl5c7rG7ORRCjSh48Ft+a5zYZtdsgNvTktUX7LjqiL6pchXuveSChCCWKc7G3WmuMhy7dvVCeUrMZzVLM1/kAecHb8zbhyCbgG7uwnb3ZE4sliJFkN14yQmZTVNnB9iQue1WSwIwkcD6CLn1YDiU6zs5hrQT7icJPbVsiF51sk3Iue/wCSMVWHJLihgRH5zCUNY+jr7p7ONS9TomSZBZREQJZNX4rmmSA+FRup3Uwz+/q85RU/YD8fHp+fnO4PDTx3g1Mpw72Bv55R8Q/Y/HB8S2O++7ly+s12MlHemfYAdvOFT9IFArpZvION3/g4W/orzM5Yo3TaOD37tK3GKBbqpfECX7VT6DYWoWhKdi14JINJTARKYRDdKwomfDZAAZftfCpr0+IEMLEG3zMGFGlQ2Dn8yiOCjZwKQ+x0+kcCmg7hinhllxdSICLLRBEi+LSERKcRgJZ3Tr0ysInQxoKeYR5n3JyRI6emzfNpR3HGns3lAPW7XEjRkI/rx42AXh+uI0XqTscq8jCF1i0FfRZjM8xgSgKP0UyLp0JYYiDMV1/IL0O9kfO+jVi9eiFpFptSbm+LoXqJBQ0j+OLIGL/ZlsD+eUXzM1rnmw/+E6Ls+e65CGrIv04Nd2/98AnqszUMzPxn+sxCmnx6ChAHAFq+czhVPNcVud2jN242dift97f3JaZdwoquVzhJinT3QUuYNzSed79xE5XpMRoiA0Sgm+BtmXGSkJf6hsdhBdW04o9SKZAouFajDBUAa+9phRvtSgiYaJHxoI8sg+O8pu/wJhsHdcZ3Aw0c9ecfDDuzMPdgRBj+6nv1vKGFMYHa5k3lIFJENMjxAISFlrtXPa2U/n5qN2PF64bCydyLhQ8RwPhtE+998MJnVdr2eWdimXziIoPEPHFiuA/YCCS4FfqT5yAK+ET6KIF/bixj1WryfA+yaoqz6weVUoTNR/6KBIy8ck5WtcweT4urZALBxJ8OXFjjhc7qaCniu7LF1m+4sJ3a2vyugZ15DyMI8s26zbyPkFEu8lJBTJvluQvLpqwy6ZjzuKeGAxm4kuBxiO+1vKI7xYo/DgROcohU61xedW6iZE9bO2PB2oD/onv72Lel8WyN/Ia3F/r5OeAo+x5JM+T5OuBWfJCf21BHGesx9fj6k5tyzg/vz80Pb9Fx8g/10Ns1jeshi7D7wt6Gbt7B1si4HDjC2MfmEDWs6ZO05eM6tyDi+c7LJsuQfWKmEaCeoSX6VSQfghMxIr4s4uuVcNSMYDSlZmPcxfizkKA7uk8h3o5kQo9RIFomtW82zf5wvWq36+eJv+xfNa7zYVlvRggJZRbYCiDRccuW8UVRCEKOarK8aamVtNvTJutnZoD/WtVWYWuQX0KeG6ZYxn0gluix4vGV4wDkZc0p4lP61Hmx4hANW7Kxuux69JnWrQ+omGRyfiCdY9xboUsGXkfCxJLbTrNtW9OZYHx3ZRZxkfEuBOQyKG6HiLTJI4u8YlX8JIS2h4017oYf5/5ZRiHMT4fe+xphwM8h/RgVGJfGI29cYC25J+s9YwFgIW9hXGgbe9n/GQZZUaK/7jYdDNh/+eUfDv/fNYELqTLkZW3SGG5fGyDMckM4Mwqb0k/ZFf17aBXR6KZwpPTI84WbYXWgDXZrKUk52D1rlGxQDE9HE/OSzL8nrQ+HbIsOJG/jpeEIhAPRvE61I/g/c/ssqsqN55k10fLBLDrd3huTnwemPZHhwfDrMOi9KTbZVPeJdaZ47Dx192YSuTYDlq6/TB/IymAbIgD2Yn5GzcNWHdB3D6Sxyb4RHt8ugqIJ+ishsES3xOYwa6zHzUiBj6tG8J5Gq0Z00TsQXfU2rrfADRJSO+Y0vYWk5cGE34npdkoIWb/G6L5vMfQGjEzF7DdvroKXCEWGmDYfQ6Sy4FwGji1GQ/EJkSp8xmm7FzpMrfNEi14vMCGHqSocGtHWx6ry36/hB8Dv7XhBegJN8UHvlanMnVgYjJnjJuvzyeFi7vVZtXpNfyetzcyYRh37oIROmJ8zY+Cb6mC5O3W3ftO1qqlmMHrU+JmIWoj9E7CdDmN9MdNrFXR5gZuJNeYA8mgcsKgSGicD6eNWNmsHmziFFiEoTk1sBBcabR5BPPoYq7pNjF4/2fo4l2/HHU5Vwy6CTYd7KscO0OCLO40I7YyRnhQ2oW6nFI6UTnAF8AoRFX+cVPUxEPOOFv1UXhs4qr2zgQs0NEon4+WHX0lbPP+jijI/EzgN7wh4NJ3VjMllnOfa5J7ifv35p30Q/yUU5rJrzDASzjWft5qljvSjIXwoaJDLX3uyqG612ooLkwq8Q4TEWA35OmnmLAkvcjd0J/YWBZc7oiiIzcQBdXMqdWKBe5hSIun3Du32TcWe+UfRZEuKfhETl3HBzUbwSxJI/rFoo/GVhH1VoX4A4lr6FHNdVe+TjKselOkz8T7YXzI0JSPSIKjkueIlqP+NYMAdLgQ0m/sLeH5CGqQykEIEUrCMXQCWHMxcaN0kjgAiq2Lk1QfRZtkHYCWUt9+GbcObFh33xilPyzUUVDvgwNDsPLNMyKxg1G04aoqF5Pgqqk8lTXv8oduND6odjpJzHWIBPhlrR05vS4NRI4nQs7pYyVEZu3JSYJOUAlbkRuPqwUHz6E75rbPz4y+/qiWL5DeV2K35E+au+UazURNZ7s1i1ZuK+Rayb7OMbBfh4FWW7nC2l00y2Gt8UgZTHe0ooaIx54F6O3RwRp2gXBQho1wyO3i7/xmtuFxCNltiVO6CG+65jTw1yPIRPxHIdSBm7d+wGNKOR495tHl1rRcikp4kcW8hWX4GrOAfJD3z//TdinpLRmHLuGz4BU30h5irHZDieJZhsY2ZbY7OofBhddYS8+uV0YNNDwwT2LBfVcd3Ydz5jUWbLjYLffaae08Cgfiwk3tPEwfvt72uXi39XwCrcDoo08ANjOjtkI9YnzfMH3CuhIQaDVuqgZbBv8IWcL5s8gmUJXsHJ/CKehEqvEZ7FrH3JiGfMasPDVCYRZPEqlwpbRR7wbCi1Asg5QUsVQUlzfCRKODsreUHtXyF5WEgmLvjI50dEUtD5X0SpiftjrQWaqAXkuEhiUxclY8T2XCjczBZmMjnSwX1dlCgbCcL5n3J9k7bvMaxIOOLk79TSQS6g4Ilhe0nceKRrWycdecgEA6n8wKIxF+B09ABLhZriWONkjr2Hzuet1t/26+fzffhhDkThbScWaoTCOBqeYQYwtjxKbGvRan3fIoHLPMj29xNDmzjhyVxBugRYvm/7eEIi+c+gHkOp5SPMEUoehpsFNUDZEW5nZDQPiAXCCsvMr9EOGebYkOFS38HXE1G1IAY+peoD93sYfm9y/wcNx6TVk/fgUdyIDsSPJYQsdXYR+3Zy0RW/InlIAwPlKM5Y0a86v7LvaX+y8E0J/REDwPw8tUWoF+55yAdvD1ZB1597ioAwe4sZkD8KC7MTz1g/cTtf0R7T5bxNtkL83l7IwZlI07WMTK6pAHQ43875I7wR52fZ0I+CnUlcmHEAlcLslPXw1oSz58lOHE8t/84P4wu5aNojUwpMpVpck1SLimZg1sospklgbXHn26JXBkaLtH18Q+Rz4M5WOBMWDOsqmMqhQg+IfQPjaVSF8MR9ncr3UNvdG/50enwSsrQP4hPRSlZLOWCbBhCj3e4KMYx7MxBRVqrA61ZY4BR3UUE6O6ovIiPZUChdphOW2QVpBDgligh6YS9Ot98d7J2mTakjUEc/91Iw/94NA5sfGLPE0PBuRVgfuQEFbfhzusC3YYHhfKQoJGF1sH0ikTYPKzGyXRWINN+hEO9gUMvD43eDgz0WWTw1gqpmCnxVnz/jQx6tXTPhQRPPFtZtjQXg1SQsp641n1BYqmYuP1R9IJdcHg52AS35MpBOrmnATp/mC9kdNqGxygjzJu+Q/R/XpOIKs04khaKb1jB0EjNPN8VMOonHopsamxVd4Ur34/qS8SbObTM7pRStMZjJLVIw9tw7UtU+Ov58hiVBnwo9qlC/WypbhFmUBI9BjPltd+lOQpgmLR7MRp2adiyWIJ9rsqbCzoG4srKJYvZ7OmmsgOQPH0mgk6umyV7NDZ8nil4n4q5r+Dn2XWuHvmuoU1aa6L4Gexzuu9bvVyxG4EpNhPqutCu95ZoebYzYGaKw+I5MYPQUY/3OwACp90yhpVZyzEUev7hJLaX/u3zGly+MUmuQWmoqJX5WdGXPVbPBskF3z8TKZur4JfLG5F4dTC26ZClArw6ilg0RnhuqW26+iYdNopEzm20ymrhaq4J2M+uYGAltrXhpxeE+0tQud7qlHqOMrA/H6P2hPDyX76mDcYkOQT8a46Go4vAYQ6zjmL4/bOxAWwH9ZHg2qg7VdkdVHu1edPK6I1c5MgL7loJCv7jHoES8QMOaZFsMa4uKsG0auxbbRog76myfx+8aqqKoRvVVNaqsL7XGJ2OCTNgqM514HZgFPPp2tSbCsbY73+PhZ05u57vvnmhmKOykqD2XBs5ULyKmK0xxDAxHLR3PKUCLhB36mJqfkXQBetmhQswWK7Syc1OAmxe3jEfUC1dzoV5JunLG2FDLjwHIVyUJWKzvscBLyRyhnypyhCJXeyI2yuoZT7hYPtKoC2vm5s+alN/9b9xMvELPpj7M8Po1GcEszD4cmFiageGO9t+igU64kp9XkDHOK9BUzltTJc5qAGqOLVksxlw3CrmwaHIs1aq/aiX/dJhcvT8drlyw2YJnheFHQaesypYn2+IPd6DgCT83YEETl0eyy3q4/8wvrJAcfOp/OsQnrXQycMxGmgF4if+7d/hRnfP/aIZnVso51eqn1kpUpZeJwRG0StzuiKP+5JFpdZVHEEtBEp4xpAbGCVJn7u0P0MeRTtzZFBAjP9kBGQxIkxx/OtxXV8FFduouiGX73F8U5557RfZ2f4Kqv7thke8+8VmdfzWqnyJ0DtfmNoOO2oU8Ulglf/C5Q9c7d6EeEZGPB5Bj26FfbQgKdolIWq4ysliMKNQydMLHTSN9PEWsMPxBPqlAAufUYZ6S0jEQH2Ki1UrFuV+PbDkBUmLKsK7H0wqFcLzT7hUI/+fPVhA2lvypdUIcm1/GIbxTr42EliXQ5KIAaPgaDEiN+lsp8llcIrpLyMvITstyofCmGy+ViVnGi8qXd99tD/feHW9/2K2/FbGiIJFdKGuGd4ulStHtUqla4sprWJcXrDvhRVieqr4nK8GPexnDl7sawZ9m+p+66icBiPr+/Nn/BzhNC94=', 'base64'), '2026-10-18T15:23:08.000+00:00');");
 
 	// zip-reader, refer to modules/zip-reader.js
 	duk_peval_string_noresult(ctx, "addCompressedModule('zip-reader', Buffer.from('eJzVG+9T4zb2OzP8D9q9mcbphhASlrbkuB5LwpUpCzuEvZ3eltlxHJkYHNtnywXKcH/7vSfJtizLdljaD02nmyBL7z293+9J3v52c+MojB5i73rJyHAwHJCTgFGfHIVxFMY288Jgc2Nz49RzaJDQBUmDBY0JW1JyGNkOfMknPfJvGicwmwz7A2LhhNfy0evueHPjIUzJyn4gQchImlCA4CXE9XxK6L1DI0a8gDjhKvI9O3AoufPYkmORMPqbG79ICOGc2TDZhukR/OWq04jNkFoCnyVj0f729t3dXd/mlPbD+HrbF/OS7dOTo+nZbLoF1OKKj4FPk4TE9L+pF8M25w/EjoAYx54Dib59R8KY2NcxhWcsRGLvYo95wXWPJKHL7uyYbm4svITF3jxlJT5lpMF+1QnAKTsgrw9n5GT2mrw7nJ3Mepsbn04ufzr/eEk+HV5cHJ5dnkxn5PyCHJ2fTU4uT87P4K9jcnj2C/n55GzSIxS4BFjofRQj9UCihxykC2DXjNISejcU5CQRdTzXc2BTwXVqX1NyHf5G4wD2QiIar7wEpZgAcYvNDd9beYwrQVLdESD5dntz4zc7JtPzo8kFOSA7A/xv+HZvLMbF6Gi0N/phuPu9HDw9xsG970bD3e/eDsfIfhyO4hCQU3gkpWB15FCnK1cu0sin9+oM4Ce1V51uf8IfcWBuGjhIMgGhO7fHoQ90f7DZ0lrQhHU3Nx6FgngusQCBA5zrR77NgEErcnBAOndeMBp2umKWnIwfXA648aufAJuZ1dkGzDehF1idX3/lVOK8J/FF/YSuAwNXSiDbOgzcNAtvgdvlRQ10kx8JgiT7RAFXQJvbnMUCaD9Zei6zsll3S7BHSz7yaXANNvgPslPlBAfy5oBY6xNC3mg4M6RCFNarXKRuAvyg92AqyewhcCxE1u0WkxU68FNet7pdeHGxTMHxlDP2SVERes9i22Fn8G1Fmm70IxoswCwyVsDWBl3ySKJ+EqaxQ/uOHyYUuAcjX8AA8VdMWRoHY1V+AcAGjhfgojDKWc61WuhE1EeShboCt57FWsQx/uuotQP+JPRp3wvccMfqTIUQgDewIdgNt1O5gsUPFWxGu9Yw2MxZWrS624rw1EcgxRurpDVSnjls8QNmCsfDxSYBXlM244MWSiMDAlPDlEUpU70WV1UH5jL6CcIIletwHz1QMNe3rxNgxd28Q54qgPqBvUITVmRePCucaFR5FoIo+K47PZIbgFVlEWoQhucMWLZZoNghrw5I6VnGzdgRa5C4Bmstw0V2d44ujsgRSpS4NvifRUflf0UGioy5Nir2q8LO1UFhn9xF5EXUyrmCz59KUeN3L4ro4nx+Qx2AifG/8AscxRfx7GQCXO7A7C0AC6rYVxd2xuoCDgW9Ln7LJxiPLTT/m3tMJzJEGs/E+uNJtvjzzf1V310ozJgD9tuy8gsS+gvqegH9EIcQ1tkDZ0+PdDDnSkADFCSguftVjTBID8kFaQAxn6/G1UeeNgZbtDy+uYIL3fIUDYEUdz9Kk6WlrPrsXQnN0jA8mTSFWPBtcv1dVSiozAfFrlGBOYaKCDKgKjk48wpB5Hqmgs49gYpAcQ9GNJyB4A/JAalgKoVKYr3CeRiJ2DIO74jVwaTaDSFBA9spvJQisbE6hiAQQh/zbUwckTwe3GoFrznssxDqg3ztK5PFcgd1JzM2q1XomE1TVQmdZRrcgp/yQRO61fkGEAY6P9hJsn25jFMRVzjMLJq/gaH5AwNb0KnPPoqawL+jYUZTNl63DrIZIUHU4vOfDdQ37CBHLFdn6sAtghNQh1agJuvgbsGPH854qwlXQSmfiwJPfb9hwVP9oyKp+ApSy0Tw7+dTUTNcT1i7/ES6N7GZvab01t+IgdqnXnUM/L/tq1b1THNaU53aWMF3j8rRtPlmhfvjxQPSgSocrCtO6cu4jOFfZXLi/a6HuQaKdGOvJ4eXZ7lAFO3KS7UB+eabssRK7qO6MqvFuvW+7KUakHvDOt1bA0bBp0xLyF/FL9EVFkOL2PaC2kDTQETNsEExtcTIEJL789R1afw+XGAuumOYoOqGKckTczLFcm3gjmlGZlq1ExoEg89FzB0YnkR2qhVtai1QElalTVCqwLLUhy628haSKMgmNHsG2esj+fTu5HK2T7Z23pZ5quDlW5KpG36NtUfoH2ZecKtmg/mgReO4JxKRCxiCn1xI66ViQ6uDcHhyk4MoMhvyeXpxIVIfwILjV5D456j7CfXd/hc+9ZS6TFeZ2olk66BA17yI53WW2FM/we6rNVC22zVUojX7xs/2NpmEASWfit4r9768K8n7LHM/dG6rC3MnVOxBS3gbsOpch8Rycn42JbgB7JpeYis7BrWJq7WrQjkkze/DmBI0roZQAMZjjIIGT2D2TjU7AApy9OQy5NS37xU07AJshibI7wKAUCqNpT2tPK7jRbkNgvKTwuFFibvAFojQmP0MBf+rR0Sg29cRQ+TbHfywR34UX9XnpqhdYnqutWtwvuwG6oydqz/3OEyfAipq+z/xnkHFLWjPXuQddjK7Q5o+ngRsNDydWoMuqv7p8YW+VU3F/0UDGts++ZDGUZhQcuzbsj2nQd3ZA6h7lQxCA6fUi+Q9ZctwUQ/s+zZgx5AInWEX7FQqRB2kYStdvPfYDqdKki4q6SS5DoM48/iC7a0DHSiXxM5ut1SXG6hTbI+FMtFEGq0a7PUm0bagqxXEevSsmGzT/sGG1/ZLmaXXEShM37w28wd/ODdq8IEheGintQD47kPXTSDbeENGg3q1rFc0U9FRh8/ktiouybTU6JnCAMKzzFVrArOpnasGVaJ48sIGZlARjY0rOQtg2TvBC9sHYi0UUovZnuKeiNgU+acSjRQJtIAgW//Iu1iQriKN2NCtxrVqKr1+/CrtazSAfKfQoQrBKGgxqImsJN7q8USp4VnqRMr2+KHvq1GmGOVHDuIkxXwO0H6SZNAK3qMsIAPDHT+Fv63OPp4KYeeyeIpHFRKJcwepjzz/EQ/HavBdN9XX0SfMjlnyyWNLfhT1AvTFH3q7u+iMY9dTHkJYhQmBkvVgwo3o2oqMI+FGmIzzgRs+cDMuyxi3o+wG8kOxl7XPBysbVnmTzvFKQnCNabkyLlsKW2SnO9ZrHXHkI21dcyHKEaaKR5sly0y9xORHIsWBAT+paDr4ZcWRat7e4Is+e1daraaojnJipJ0TtFnTl8JwRCs/GZaSt+pjFNKq1rJWgtrS+XLtdiF/d73AS5ZUS9s5IH7+zH/Bj9Rnie60RNO6cuZZbNtc26ogBZcfCR5J7BOFfn6gXVba8jpKb61uPz8yLR+SWKa5+mFPPby+MDucsN58PAZdQA1TCnHO2gX35PDyUB4nSMHp/Cx6ZhAFUKq89dla3CpLsrABqB2bWZ+dKx2HVpNUK8HnIcgf9UgjrjVlzHkMprlmFqFxeBos8FqXk8YxDRjJ+jMmhUYfoFGQpxT5nuoW/m4yaCt7bIy5NcFVLjbHWPnQcND+JwYN3B83zowR/A9tguSc7oY5b6ruvc4FPtuLYsZ02lADG54318HmU1QTnL7szxULjHkl1pfkgnd0MEss6R5iQGaihzqVjttY3g1LOayefBLykgK7Cg3KzK3REO1GLT7JIm/W1FSgLVC/umqvhyVz7Qaq2iB9VHfYDGs4bIF1aieMvA8XeCWSX3Qkl97KDJDvcmfwbIATmzUBbKNQdCiOPeovntunMFQqbTVKWbW7WJIUDomC4cHfa98TgBFuSmd2xlK3z8KZSDgrHZWvoBakoVE4BBLhf3fYHnAbVZS3SWf2KvIzyocF6Z0lve9U6H9qDxlGnyTrccXdyhhUmqq6SO3Ry26U1BNWd6bxbDFpha+x5DUQoLJQYQzPYkt3d0Raa0yz8wtUryp5WKWeKN3OQ5j8ImkGwZiAiKtZhnOs8sUvbUJxF7WEmP4G+Q4in+KP6cpjDHM04CEnonR9CTOs/5XzqyxLyK+lPlUvt3FxRTZbFnfa/qQshDP/IaIh1jqIkNenotg03ELlRXvtHWAOoLkUFJcJubtRr0OZSh3TBTG9Z0aDyoXNhNmsoKaflJta4mBzUVkVQo2ar+rpWgYuiNkg9P75l4vJ+dnpL+vctlUoRKCyDDHS8kjy4xhwY24i0+MJTZzYi1gYd3q5yQoCCzMd5L4rV1QA6yxKrgj/flZ2lpnEo9qnlFcbZEgr7jM095hMAb+Lhn40uUBtRdryRukNXgeLwXFM4xi2Xb2rrRLZlNxlgXZcXUbdxkXgBg2LIJdpXjU0rZKXgEsnq7t7PbK7h9fBiwCuxNsaKKIgbAVk3C76AV0MMhkk35DhYPd7bvb4o+2o4whcHqbDE7AOBxTzQSbg+xUjrsZt+epRfV6023YMBCPvvcBbpasXnHERc1KfvOCkC0amxzN5hu9WujrV2UWqZbov21Q3fHxG3bAOK56Tpa8jn7Xrh+FgDWg8UDw7+R9+PeSWKmAdDuCbeXEA2nXI5GtkDao1WkdGUFusBZHzdbSOtpYOZmxWD223ysv1PDwoH/p4/fKGqeFV5LvkoPq4ZlX2EW1O/Lfh9kD5jGu/Th8bIKjlegOM3SYYIpc2rwQ+N6x0oaBXwqTx4FbfK/e0NbVx0/LYMVMIAjWvetL0QwvUeadPi12luMX9Zv4zj7W12V8pZ0gsTIkNL4ToxZ249hbquREfeVZ2JK4Rae0mrxQ75SkJRtUx8cjfSSlrGpM3b7zmtMkSSHTGlZOvLeJ1u3pqBaGcv+n57Nr6GLNxMsODOAw106NJ1l5D9+ApV9ZcqD8IFR1g7EUYb1Rp0LfqPussJpBxJLfkb8JTCda0JQ9GMGfpag7qCHTXpTIJvvTLX3xeeIlTj7DqZ40IL0MGSIJ2tPWYdqqh0oiKH46bUBhBC6se6ldKWrHU8y1Zhqm/IHN8wTv3drWYReSrIjTdYuEmWni/ug5GzQ5LbY0aWvj1DRUN/DKxQ32RK/uYjp9LPieDWrrPUXgj07MKD2S12NBkG2j7lOXnFoFHuL0CYbcgAWqrrM4u9yC85D9epDUh0C+1Vtvg60b8DdysjOcXjLult23bK/BOPM/Vkb9/l/CMTb+Dok4p7tbqsPkFHISN/BOQkI+lIrprZH3RYHIXhbrypKfAdkB28Uq/APx5cMXPiO/fDpTBHTm4+04ZHMrBwUgZHGWDuw0vucVp8e6kKsqc2VKaq3CRgu3S+yiM+RHSo7yeFvMYx2W8L75AY/8P7szMwA==', 'base64'), '2022-02-01T20:15:31.000-08:00');");
@@ -0,0 +1,445 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "duktape.h"
+#include "ILibDuktapeModSearch.h"
+#include "ILibDuktape_Helpers.h"
+#include "ILibDuktape_ProcessTable.h"
+#include "../microstack/ILibParsers.h"
+
+#if defined(_POSIX) && !defined(__APPLE__) && !defined(_FREEBSD)
+
+#include <pwd.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#define ILibDuktape_ProcessTable_PTR				"\xFF_ProcessTable_PTR"
+#define ILibDuktape_ProcessTable_LAST				"\xFF_ProcessTable_LAST"
+#define ILibDuktape_ProcessTable_USERCACHE			32
+#define ILibDuktape_ProcessTable_CMDLINE			4096
+
+// Compact per-process record, kept between calls to diff()
+typedef struct ILibDuktape_ProcessTable_Entry
+{
+	int pid;
+	unsigned int commHash;
+	unsigned long long startTime;
+	unsigned long long cpu;
+	long rss;
+}ILibDuktape_ProcessTable_Entry;
+
+typedef struct ILibDuktape_ProcessTable_Stat
+{
+	int pid;
+	int ppid;
+	int tty;
+	int threads;
+	char state;
+	unsigned int uid;
+	unsigned long long utime;
+	unsigned long long stime;
+	unsigned long long startTime;
+	long rss;
+	char comm[64];
+}ILibDuktape_ProcessTable_Stat;
+
+typedef struct ILibDuktape_ProcessTable_User
+{
+	unsigned int uid;
+	char name[64];
+}ILibDuktape_ProcessTable_User;
+
+typedef struct ILibDuktape_ProcessTable
+{
+	ILibDuktape_ProcessTable_Entry *last;	// Buffer referenced by ILibDuktape_ProcessTable_LAST
+	int lastCount;
+	long pageSize;
+	int userCount;
+	ILibDuktape_ProcessTable_User users[ILibDuktape_ProcessTable_USERCACHE];
+}ILibDuktape_ProcessTable;
+
+typedef struct ILibDuktape_ProcessTable_dirent64
+{
+	unsigned long long d_ino;
+	long long d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+}ILibDuktape_ProcessTable_dirent64;
+
+int ILibDuktape_ProcessTable_ComparePid(const void *a, const void *b)
+{
+	return(*((const int*)a) - *((const int*)b));
+}
+
+//
+// Walks /proc with getdents64, returning a sorted array of pids. The array is in a buffer pushed on the value stack, so it isn't leaked if the caller throws
+//
+int ILibDuktape_ProcessTable_ListPids(duk_context *ctx, int **pids)
+{
+	char buffer[32768];
+	ILibDuktape_ProcessTable_dirent64 *entry;
+	int fd, len, i, count = 0, capacity = 512, pid;
+	char *name;
+
+	*pids = (int*)duk_push_dynamic_buffer(ctx, capacity * sizeof(int));		// [pids]
+	if ((fd = open("/proc", O_RDONLY | O_DIRECTORY | O_CLOEXEC)) < 0) { return(0); }
+
+	while ((len = (int)syscall(SYS_getdents64, fd, buffer, sizeof(buffer))) > 0)
+	{
+		for (i = 0; i < len; i += entry->d_reclen)
+		{
+			entry = (ILibDuktape_ProcessTable_dirent64*)(buffer + i);
+			if (entry->d_type != DT_DIR && entry->d_type != DT_UNKNOWN) { continue; }
+			for (name = entry->d_name, pid = 0; *name >= '0' && *name <= '9'; ++name) { pid = (pid * 10) + (*name - '0'); }
+			if (*name != 0 || name == entry->d_name) { continue; }		// Not a pid
+
+			if (count == capacity)
+			{
+				capacity *= 2;
+				*pids = (int*)duk_resize_buffer(ctx, -1, capacity * sizeof(int));
+			}
+			(*pids)[count++] = pid;
+		}
+	}
+	close(fd);
+	qsort(*pids, count, sizeof(int), ILibDuktape_ProcessTable_ComparePid);
+	return(count);
+}
+
+//
+// Parses /proc/[pid]/stat. The owner of the file is the effective uid of the process
+//
+int ILibDuktape_ProcessTable_ReadStat(int pid, ILibDuktape_ProcessTable_Stat *st)
+{
+	char path[32];
+	char buffer[1024];
+	char *start, *end;
+	struct stat info;
+	int fd, len;
+
+	sprintf_s(path, sizeof(path), "/proc/%d/stat", pid);
+	if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0) { return(1); }
+	len = fstat(fd, &info) == 0 ? (int)read(fd, buffer, sizeof(buffer) - 1) : -1;
+	close(fd);
+	if (len <= 0) { return(1); }
+	buffer[len] = 0;
+
+	// comm can contain spaces and parenthesis, so it is delimited by the first '(' and the last ')'
+	if ((start = strchr(buffer, '(')) == NULL || (end = strrchr(buffer, ')')) == NULL || end < start) { return(1); }
+	len = (int)(end - start - 1);
+	if (len >= (int)sizeof(st->comm)) { len = (int)sizeof(st->comm) - 1; }
+	memcpy_s(st->comm, sizeof(st->comm), start + 1, len);
+	st->comm[len] = 0;
+
+	st->pid = pid;
+	st->uid = (unsigned int)info.st_uid;
+	if (sscanf(end + 1, " %c %d %*d %*d %d %*d %*u %*u %*u %*u %*u %llu %llu %*d %*d %*d %*d %d %*d %llu %*u %ld",
+		&(st->state), &(st->ppid), &(st->tty), &(st->utime), &(st->stime), &(st->threads), &(st->startTime), &(st->rss)) != 8)
+	{
+		return(1);
+	}
+	return(0);
+}
+
+//
+// Reads /proc/[pid]/cmdline. If 'argv0' is set, only the first argument is returned, otherwise the arguments are joined with spaces
+//
+int ILibDuktape_ProcessTable_ReadCmdline(int pid, char *buffer, int bufferLen, int argv0)
+{
+	char path[32];
+	int fd, len, i;
+
+	sprintf_s(path, sizeof(path), "/proc/%d/cmdline", pid);
+	if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0) { return(0); }
+	len = (int)read(fd, buffer, bufferLen - 1);
+	close(fd);
+	if (len <= 0) { return(0); }
+	buffer[len] = 0;
+
+	if (argv0 != 0) { return((int)strnlen(buffer, len)); }
+	while (len > 0 && buffer[len - 1] == 0) { --len; }
+	for (i = 0; i < len; ++i)
+	{
+		if (buffer[i] == 0) { buffer[i] = ' '; }
+	}
+	buffer[len] = 0;
+	return(len);
+}
+
+unsigned int ILibDuktape_ProcessTable_Hash(char *str)
+{
+	unsigned int hash = 2166136261U;
+	while (*str != 0) { hash = (hash ^ (unsigned char)*str++) * 16777619U; }
+	return(hash);
+}
+
+char* ILibDuktape_ProcessTable_GetUser(ILibDuktape_ProcessTable *pt, unsigned int uid)
+{
+	struct passwd pw, *result = NULL;
+	char buffer[4096];
+	int i;
+
+	for (i = 0; i < pt->userCount; ++i)
+	{
+		if (pt->users[i].uid == uid) { return(pt->users[i].name); }
+	}
+
+	// Cache is small, because there usually aren't many distinct process owners. When it's full, entries are replaced by uid
+	i = pt->userCount < ILibDuktape_ProcessTable_USERCACHE ? pt->userCount++ : (int)(uid % ILibDuktape_ProcessTable_USERCACHE);
+	pt->users[i].uid = uid;
+	if (getpwuid_r((uid_t)uid, &pw, buffer, sizeof(buffer), &result) == 0 && result != NULL)
+	{
+		strncpy_s(pt->users[i].name, sizeof(pt->users[i].name), pw.pw_name, sizeof(pt->users[i].name) - 1);
+	}
+	else
+	{
+		sprintf_s(pt->users[i].name, sizeof(pt->users[i].name), "%u", uid);
+	}
+	return(pt->users[i].name);
+}
+
+//
+// Formats tty_nr the same way as the TTY column of ps
+//
+void ILibDuktape_ProcessTable_PushTTY(duk_context *ctx, int tty)
+{
+	unsigned int major = ((unsigned int)tty >> 8) & 0xFFF;
+	unsigned int minor = ((unsigned int)tty & 0xFF) | (((unsigned int)tty >> 12) & 0xFFF00);
+
+	if (tty == 0)
+	{
+		duk_push_string(ctx, "?");
+	}
+	else if (major >= 136 && major <= 143)
+	{
+		duk_push_sprintf(ctx, "pts/%u", ((major - 136) << 8) + minor);
+	}
+	else if (major == 4)
+	{
+		duk_push_sprintf(ctx, minor < 64 ? "tty%u" : "ttyS%u", minor < 64 ? minor : minor - 64);
+	}
+	else
+	{
+		duk_push_sprintf(ctx, "%u:%u", major, minor);
+	}
+}
+
+void ILibDuktape_ProcessTable_PushProcess(duk_context *ctx, ILibDuktape_ProcessTable *pt, ILibDuktape_ProcessTable_Stat *st)
+{
+	char cmd[ILibDuktape_ProcessTable_CMDLINE];
+
+	duk_push_object(ctx);											// [process]
+	duk_push_int(ctx, st->pid); duk_put_prop_string(ctx, -2, "pid");
+	duk_push_int(ctx, st->ppid); duk_put_prop_string(ctx, -2, "ppid");
+	duk_push_uint(ctx, (duk_uint_t)st->uid); duk_put_prop_string(ctx, -2, "uid");
+	duk_push_string(ctx, ILibDuktape_ProcessTable_GetUser(pt, st->uid)); duk_put_prop_string(ctx, -2, "user");
+	duk_push_lstring(ctx, &(st->state), 1); duk_put_prop_string(ctx, -2, "state");
+	ILibDuktape_ProcessTable_PushTTY(ctx, st->tty); duk_put_prop_string(ctx, -2, "tty");
+	duk_push_string(ctx, st->comm); duk_put_prop_string(ctx, -2, "comm");
+	if (ILibDuktape_ProcessTable_ReadCmdline(st->pid, cmd, sizeof(cmd), 0) > 0)
+	{
+		duk_push_string(ctx, cmd);
+	}
+	else
+	{
+		duk_push_sprintf(ctx, "[%s]", st->comm);					// Kernel threads don't have a command line
+	}
+	duk_put_prop_string(ctx, -2, "cmd");
+	duk_push_int(ctx, st->threads); duk_put_prop_string(ctx, -2, "threads");
+	duk_push_number(ctx, (duk_double_t)st->utime); duk_put_prop_string(ctx, -2, "utime");
+	duk_push_number(ctx, (duk_double_t)st->stime); duk_put_prop_string(ctx, -2, "stime");
+	duk_push_number(ctx, (duk_double_t)st->rss * (duk_double_t)pt->pageSize); duk_put_prop_string(ctx, -2, "rss");
+	duk_push_number(ctx, (duk_double_t)st->startTime); duk_put_prop_string(ctx, -2, "startTime");
+}
+
+ILibDuktape_ProcessTable* ILibDuktape_ProcessTable_GetState(duk_context *ctx)
+{
+	ILibDuktape_ProcessTable *pt;
+	duk_push_this(ctx);												// [table]
+	pt = (ILibDuktape_ProcessTable*)Duktape_GetBufferProperty(ctx, -1, ILibDuktape_ProcessTable_PTR);
+	duk_pop(ctx);													// ...
+	return(pt);
+}
+
+duk_ret_t ILibDuktape_ProcessTable_snapshot(duk_context *ctx)
+{
+	ILibDuktape_ProcessTable *pt = ILibDuktape_ProcessTable_GetState(ctx);
+	ILibDuktape_ProcessTable_Stat st;
+	int *pids, count, i, x = 0;
+
+	count = ILibDuktape_ProcessTable_ListPids(ctx, &pids);			// [pids]
+	duk_push_array(ctx);											// [pids][array]
+	for (i = 0; i < count; ++i)
+	{
+		if (ILibDuktape_ProcessTable_ReadStat(pids[i], &st) != 0) { continue; }	// Process exited
+		ILibDuktape_ProcessTable_PushProcess(ctx, pt, &st);			// [pids][array][process]
+		duk_put_prop_index(ctx, -2, x++);							// [pids][array]
+	}
+	return(1);
+}
+duk_ret_t ILibDuktape_ProcessTable_diff(duk_context *ctx)
+{
+	ILibDuktape_ProcessTable *pt = ILibDuktape_ProcessTable_GetState(ctx);
+	ILibDuktape_ProcessTable_Stat st;
+	ILibDuktape_ProcessTable_Entry *current, *old;
+	int *pids, count, i, j = 0, n = 0, added = 0, changed = 0, removed = 0;
+
+	// Both work arrays are owned by the value stack, so nothing is leaked if a push below throws
+	count = ILibDuktape_ProcessTable_ListPids(ctx, &pids);			// [pids]
+	current = (ILibDuktape_ProcessTable_Entry*)duk_push_fixed_buffer(ctx, (count + 1) * sizeof(ILibDuktape_ProcessTable_Entry));	// [pids][current]
+
+	duk_push_object(ctx);											// [pids][current][diff]
+	duk_push_array(ctx); duk_put_prop_string(ctx, -2, "added");
+	duk_push_array(ctx); duk_put_prop_string(ctx, -2, "changed");
+	duk_push_array(ctx); duk_put_prop_string(ctx, -2, "removed");
+
+	for (i = 0; i < count; ++i)
+	{
+		if (ILibDuktape_ProcessTable_ReadStat(pids[i], &st) != 0) { continue; }	// Process exited
+		current[n].pid = st.pid;
+		current[n].commHash = ILibDuktape_ProcessTable_Hash(st.comm);
+		current[n].startTime = st.startTime;
+		current[n].cpu = st.utime + st.stime;
+		current[n].rss = st.rss;
+
+		// Both lists are sorted by pid, so we can merge them
+		while (j < pt->lastCount && pt->last[j].pid < st.pid)
+		{
+			duk_get_prop_string(ctx, -1, "removed");				// [diff][removed]
+			duk_push_int(ctx, pt->last[j++].pid);
+			duk_put_prop_index(ctx, -2, removed++);
+			duk_pop(ctx);											// [diff]
+		}
+		old = (j < pt->lastCount && pt->last[j].pid == st.pid) ? &(pt->last[j++]) : NULL;
+		if (old != NULL && old->startTime != st.startTime)
+		{
+			// pid was reused
+			duk_get_prop_string(ctx, -1, "removed");				// [diff][removed]
+			duk_push_int(ctx, old->pid);
+			duk_put_prop_index(ctx, -2, removed++);
+			duk_pop(ctx);											// [diff]
+			old = NULL;
+		}
+
+		if (old == NULL)
+		{
+			duk_get_prop_string(ctx, -1, "added");					// [diff][added]
+			ILibDuktape_ProcessTable_PushProcess(ctx, pt, &st);		// [diff][added][process]
+			duk_put_prop_index(ctx, -2, added++);					// [diff][added]
+			duk_pop(ctx);											// [diff]
+		}
+		else if (old->cpu != current[n].cpu || old->rss != current[n].rss || old->commHash != current[n].commHash)
+		{
+			duk_get_prop_string(ctx, -1, "changed");				// [diff][changed]
+			ILibDuktape_ProcessTable_PushProcess(ctx, pt, &st);		// [diff][changed][process]
+			duk_put_prop_index(ctx, -2, changed++);					// [diff][changed]
+			duk_pop(ctx);											// [diff]
+		}
+		++n;
+	}
+	while (j < pt->lastCount)
+	{
+		duk_get_prop_string(ctx, -1, "removed");					// [diff][removed]
+		duk_push_int(ctx, pt->last[j++].pid);
+		duk_put_prop_index(ctx, -2, removed++);
+		duk_pop(ctx);												// [diff]
+	}
+
+	// Keep a reference to the new list, which releases the previous one
+	duk_push_this(ctx);												// [pids][current][diff][table]
+	duk_dup(ctx, -3);												// [pids][current][diff][table][current]
+	duk_put_prop_string(ctx, -2, ILibDuktape_ProcessTable_LAST);	// [pids][current][diff][table]
+	duk_pop(ctx);													// [pids][current][diff]
+	pt->last = current;
+	pt->lastCount = n;
+	return(1);
+}
+duk_ret_t ILibDuktape_ProcessTable_get(duk_context *ctx)
+{
+	ILibDuktape_ProcessTable *pt = ILibDuktape_ProcessTable_GetState(ctx);
+	ILibDuktape_ProcessTable_Stat st;
+
+	if (ILibDuktape_ProcessTable_ReadStat(duk_require_int(ctx, 0), &st) != 0)
+	{
+		duk_push_null(ctx);
+	}
+	else
+	{
+		ILibDuktape_ProcessTable_PushProcess(ctx, pt, &st);
+	}
+	return(1);
+}
+duk_ret_t ILibDuktape_ProcessTable_find(duk_context *ctx)
+{
+	duk_size_t nameLen;
+	char *name = (char*)duk_require_lstring(ctx, 0, &nameLen);
+	char argv0[ILibDuktape_ProcessTable_CMDLINE];
+	char *base;
+	ILibDuktape_ProcessTable_Stat st;
+	int *pids, count, i, x = 0, match;
+
+	count = ILibDuktape_ProcessTable_ListPids(ctx, &pids);			// [pids]
+	duk_push_array(ctx);											// [pids][array]
+	for (i = 0; i < count; ++i)
+	{
+		if (ILibDuktape_ProcessTable_ReadStat(pids[i], &st) != 0) { continue; }
+
+		// Substring match on comm, like pgrep. ie: 'gnome-session' matches 'gnome-session-b'
+		// comm is truncated to 15 characters by the kernel, so longer names are matched against the basename of argv[0] instead
+		match = nameLen <= 15 && strstr(st.comm, name) != NULL;
+		if (match == 0 && nameLen > 15 && ILibDuktape_ProcessTable_ReadCmdline(pids[i], argv0, sizeof(argv0), 1) > 0)
+		{
+			base = strrchr(argv0, '/');
+			match = strstr(base != NULL ? base + 1 : argv0, name) != NULL;
+		}
+		if (match != 0)
+		{
+			duk_push_int(ctx, pids[i]);
+			duk_put_prop_index(ctx, -2, x++);
+		}
+	}
+	return(1);
+}
+void ILibDuktape_ProcessTable_PUSH(duk_context *ctx, void *chain)
+{
+	ILibDuktape_ProcessTable *pt;
+
+	duk_push_object(ctx);											// [ProcessTable]
+	pt = (ILibDuktape_ProcessTable*)Duktape_PushBuffer(ctx, sizeof(ILibDuktape_ProcessTable));
+	duk_put_prop_string(ctx, -2, ILibDuktape_ProcessTable_PTR);
+	pt->pageSize = sysconf(_SC_PAGESIZE);
+
+	ILibDuktape_CreateInstanceMethod(ctx, "snapshot", ILibDuktape_ProcessTable_snapshot, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "diff", ILibDuktape_ProcessTable_diff, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "get", ILibDuktape_ProcessTable_get, 1);
+	ILibDuktape_CreateInstanceMethod(ctx, "find", ILibDuktape_ProcessTable_find, 1);
+}
+void ILibDuktape_ProcessTable_Init(duk_context *ctx)
+{
+	ILibDuktape_ModSearch_AddHandler(ctx, "ProcessTable", ILibDuktape_ProcessTable_PUSH);
+}
+
+#else
+
+void ILibDuktape_ProcessTable_Init(duk_context *ctx)
+{
+	UNREFERENCED_PARAMETER(ctx);
+}
+
+#endif
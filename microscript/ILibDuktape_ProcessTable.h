@@ -0,0 +1,59 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef __ILIBDUKTAPE_PROCESSTABLE__
+#define __ILIBDUKTAPE_PROCESSTABLE__
+
+#include "duktape.h"
+
+#ifdef __DOXY__
+/*!
+\brief Native /proc process enumeration for Linux, without spawning ps/pgrep. <b>Note:</b> To use, must <b>require('ProcessTable')</b>
+*
+Process objects are of the form {pid, ppid, uid, user, state, tty, comm, cmd, threads, utime, stime, rss, startTime}.
+<br>utime/stime are in clock ticks, rss is in bytes, and startTime is in clock ticks since boot. tty is the same as the TTY column of ps, ie: 'pts/0', 'tty2' or '?'
+*/
+class ProcessTable
+{
+public:
+	/*!
+	\brief Enumerates all the processes
+	\return <Object[]> Array of process objects, sorted by pid
+	*/
+	Array snapshot();
+	/*!
+	\brief Returns what changed since the last call to diff(). The first call returns every process as added.
+	\return {added: <Object[]>, changed: <Object[]>, removed: <number[]>}. 'changed' contains processes whose cpu time, rss, or command changed
+	*/
+	Object diff();
+	/*!
+	\brief Fetches a single process
+	\param pid <number> Process ID
+	\return Process object, or null if the process does not exist
+	*/
+	Object get(pid);
+	/*!
+	\brief Finds processes by name, like pgrep
+	\param name <String> Substring of the process name (comm). Names longer than 15 characters are matched against the basename of argv[0], because the kernel truncates comm
+	\return <number[]> Array of matching pids
+	*/
+	Array find(name);
+};
+#endif
+
+void ILibDuktape_ProcessTable_Init(duk_context *ctx);
+
+#endif
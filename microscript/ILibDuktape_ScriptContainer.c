@@ -73,6 +73,11 @@ extern char __agentExecPath[];
 #include "ILibDuktape_Polyfills.h"
 #include "ILibDuktape_SimpleDataStore.h"
 #include "ILibDuktape_NetworkMonitor.h"
+#include "ILibDuktape_LoginSessions.h"
+#include "ILibDuktape_ProcessTable.h"
+#include "ILibDuktape_HardwareInventory.h"
+#include "ILibDuktape_ServiceStatus.h"
+#include "ILibDuktape_ShellPool.h"
 #include "ILibDuktape_ReadableStream.h"
 #include "ILibDuktape_WritableStream.h"
 #include "ILibDuktape_CompressedStream.h"
@@ -2920,6 +2925,9 @@ duk_context *ILibDuktape_ScriptContainer_InitializeJavaScriptEngineEx3(duk_conte
 	if ((securityFlags & SCRIPT_ENGINE_NO_PROCESS_SPAWNING) == 0) 
 	{ 
 		ILibDuktape_ChildProcess_Init(ctx); 
+#ifdef _POSIX
+		ILibDuktape_ShellPool_Init(ctx);
+#endif
 	}
 	if ((securityFlags & SCRIPT_ENGINE_NO_FILE_SYSTEM_ACCESS) == 0) { ILibDuktape_fs_init(ctx); }
 
@@ -2930,6 +2938,12 @@ duk_context *ILibDuktape_ScriptContainer_InitializeJavaScriptEngineEx3(duk_conte
 	ILibDuktape_EventEmitter_Init(ctx);				// event emitter
 	ILibDuktape_MemoryStream_Init(ctx);				// Add MemoryStream support
 	ILibDuktape_NetworkMonitor_Init(ctx);
+#ifdef _POSIX
+	ILibDuktape_LoginSessions_Init(ctx);
+	ILibDuktape_ProcessTable_Init(ctx);
+	ILibDuktape_HardwareInventory_Init(ctx);
+	ILibDuktape_ServiceStatus_Init(ctx);
+#endif
 	ILibDuktape_CompressedStream_init(ctx);
 	ILibDuktape_PAC_Init(ctx);
 	
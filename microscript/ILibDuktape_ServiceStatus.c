@@ -0,0 +1,510 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "duktape.h"
+#include "ILibDuktapeModSearch.h"
+#include "ILibDuktape_Helpers.h"
+#include "ILibDuktape_ServiceStatus.h"
+#include "../microstack/ILibParsers.h"
+
+#if defined(_POSIX) && !defined(__APPLE__) && !defined(_FREEBSD)
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <ctype.h>
+#include <limits.h>
+#include <signal.h>
+#include <sys/stat.h>
+
+#define ILibDuktape_ServiceStatus_SYSTEMD_ETC		"/etc/systemd/system"
+#define ILibDuktape_ServiceStatus_MAX_DEPTH			6
+
+// The pids are kept in a Duktape buffer on the value stack, so nothing leaks if a push throws
+typedef struct ILibDuktape_ServiceStatus_PidList
+{
+	duk_context *ctx;
+	duk_idx_t buffer;
+	int *pids;
+	int count;
+	int capacity;
+}ILibDuktape_ServiceStatus_PidList;
+
+char *ILibDuktape_ServiceStatus_CgroupRoots[] = { "/sys/fs/cgroup/systemd", "/sys/fs/cgroup/unified", "/sys/fs/cgroup", NULL };
+char *ILibDuktape_ServiceStatus_PidPaths[] = { "/var/run/%s.pid", "/run/%s.pid", NULL };
+char *ILibDuktape_ServiceStatus_RunlevelPaths[] = { "/etc/rc2.d", "/etc/rc3.d", "/etc/rc4.d", "/etc/rc5.d", "/etc/rc.d/rc2.d", "/etc/rc.d/rc3.d", "/etc/rc.d/rc4.d", "/etc/rc.d/rc5.d", NULL };
+char *ILibDuktape_ServiceStatus_OpenRCStarted[] = { "/run/openrc/started/%s", "/lib/rc/init.d/started/%s", NULL };
+
+int ILibDuktape_ServiceStatus_ReadFile(char *path, char *buffer, int bufferLen)
+{
+	int fd, len;
+
+	buffer[0] = 0;
+	if ((fd = open(path, O_RDONLY | O_CLOEXEC)) < 0) { return(-1); }
+	len = (int)read(fd, buffer, bufferLen - 1);
+	close(fd);
+	if (len < 0) { return(-1); }
+	buffer[len] = 0;
+	while (len > 0 && isspace((unsigned char)buffer[len - 1])) { buffer[--len] = 0; }
+	return(len);
+}
+int ILibDuktape_ServiceStatus_Exists(int pid)
+{
+	return(pid > 0 && (kill(pid, 0) == 0 || errno == EPERM));
+}
+int ILibDuktape_ServiceStatus_GetParent(int pid)
+{
+	char path[64];
+	char stat[512];
+	char *p;
+	int ppid = 0;
+
+	sprintf_s(path, sizeof(path), "/proc/%d/stat", pid);
+	if (ILibDuktape_ServiceStatus_ReadFile(path, stat, sizeof(stat)) <= 0) { return(0); }
+	if ((p = strrchr(stat, ')')) == NULL) { return(0); }		// comm can contain spaces and parenthesis
+	if (sscanf(p + 1, " %*c %d", &ppid) != 1) { return(0); }
+	return(ppid);
+}
+
+//
+// Returns the lowest pid, whose parent is the specified pid, or 0. The children lists of the threads of pid are
+// read when the kernel has them (CONFIG_PROC_CHILDREN), and every process in /proc is only checked when it doesn't
+//
+int ILibDuktape_ServiceStatus_FindChild(int pid)
+{
+	char path[64];
+	struct dirent *entry;
+	DIR *dir;
+	FILE *f;
+	int child = 0, candidate, scoped = 0;
+	char *end;
+
+	if (!ILibDuktape_ServiceStatus_Exists(pid)) { return(0); }
+	if (sprintf_s(path, sizeof(path), "/proc/%d/task", pid) >= 0 && (dir = opendir(path)) != NULL)
+	{
+		while ((entry = readdir(dir)) != NULL)
+		{
+			if (entry->d_name[0] == '.' || sprintf_s(path, sizeof(path), "/proc/%d/task/%s/children", pid, entry->d_name) < 0) { continue; }
+			if ((f = fopen(path, "r")) == NULL) { continue; }
+			scoped = 1;
+			while (fscanf(f, "%d", &candidate) == 1) { if (candidate > 0 && (child == 0 || candidate < child)) { child = candidate; } }
+			fclose(f);
+		}
+		closedir(dir);
+		if (scoped != 0) { return(child); }
+	}
+
+	if ((dir = opendir("/proc")) == NULL) { return(0); }
+	while ((entry = readdir(dir)) != NULL)
+	{
+		candidate = (int)strtol(entry->d_name, &end, 10);
+		if (*end != 0 || candidate <= 0) { continue; }
+		if ((child == 0 || candidate < child) && ILibDuktape_ServiceStatus_GetParent(candidate) == pid) { child = candidate; }
+	}
+	closedir(dir);
+	return(child);
+}
+
+//
+// Reads the first line of a PID file. Returns the pid, or 0 if the file doesn't exist
+//
+int ILibDuktape_ServiceStatus_PidFile(char *name, char *path, size_t pathLen)
+{
+	char value[64];
+	int i;
+
+	for (i = 0; ILibDuktape_ServiceStatus_PidPaths[i] != NULL; ++i)
+	{
+		if (sprintf_s(path, pathLen, ILibDuktape_ServiceStatus_PidPaths[i], name) < 0) { continue; }
+		if (ILibDuktape_ServiceStatus_ReadFile(path, value, sizeof(value)) >= 0) { return(atoi(value)); }
+	}
+	path[0] = 0;
+	return(0);
+}
+void ILibDuktape_ServiceStatus_PushPidFile(duk_context *ctx, char *name)
+{
+	char path[PATH_MAX];
+	int pid = ILibDuktape_ServiceStatus_PidFile(name, path, sizeof(path));
+
+	if (path[0] != 0) { duk_push_string(ctx, path); } else { duk_push_null(ctx); }
+	duk_put_prop_string(ctx, -2, "pidFile");
+	duk_push_int(ctx, pid); duk_put_prop_string(ctx, -2, "pid");
+	duk_push_boolean(ctx, ILibDuktape_ServiceStatus_Exists(pid)); duk_put_prop_string(ctx, -2, "running");
+	duk_push_int(ctx, ILibDuktape_ServiceStatus_FindChild(pid)); duk_put_prop_string(ctx, -2, "child");
+}
+
+//
+// Pushes the buffer that holds the pids, which the caller pops when it is done with the list
+//
+void ILibDuktape_ServiceStatus_PidList_Init(duk_context *ctx, ILibDuktape_ServiceStatus_PidList *list)
+{
+	memset(list, 0, sizeof(ILibDuktape_ServiceStatus_PidList));
+	list->ctx = ctx;
+	list->pids = (int*)duk_push_dynamic_buffer(ctx, 0);				// [pids]
+	list->buffer = duk_get_top_index(ctx);
+}
+void ILibDuktape_ServiceStatus_PidList_Add(ILibDuktape_ServiceStatus_PidList *list, int pid)
+{
+	if (list->count == list->capacity)
+	{
+		list->capacity = list->capacity == 0 ? 16 : list->capacity * 2;
+		list->pids = (int*)duk_resize_buffer(list->ctx, list->buffer, list->capacity * sizeof(int));
+	}
+	list->pids[list->count++] = pid;
+}
+
+//
+// Collects the processes of a cgroup, including any sub-cgroups (ie: Delegate=yes)
+//
+void ILibDuktape_ServiceStatus_CollectPids(char *cgroup, ILibDuktape_ServiceStatus_PidList *list, int depth)
+{
+	char path[PATH_MAX];
+	char line[32];
+	struct dirent *entry;
+	DIR *dir;
+	FILE *f;
+
+	if (sprintf_s(path, sizeof(path), "%s/cgroup.procs", cgroup) >= 0 && (f = fopen(path, "r")) != NULL)
+	{
+		while (fgets(line, sizeof(line), f) != NULL) { if (atoi(line) > 0) { ILibDuktape_ServiceStatus_PidList_Add(list, atoi(line)); } }
+		fclose(f);
+	}
+	if (depth >= ILibDuktape_ServiceStatus_MAX_DEPTH || (dir = opendir(cgroup)) == NULL) { return; }
+	while ((entry = readdir(dir)) != NULL)
+	{
+		if (entry->d_type != DT_DIR || entry->d_name[0] == '.') { continue; }
+		if (sprintf_s(path, sizeof(path), "%s/%s", cgroup, entry->d_name) >= 0) { ILibDuktape_ServiceStatus_CollectPids(path, list, depth + 1); }
+	}
+	closedir(dir);
+}
+
+//
+// Returns the only process of the service, whose parent is outside of the service, or 0 if there isn't exactly one.
+// systemd doesn't export MainPID outside of D-Bus, so this is only a hint. Forking services, and services that
+// leave reparented helpers behind, have more than one such process, and pid order says nothing after wraparound
+//
+int ILibDuktape_ServiceStatus_MainPid(ILibDuktape_ServiceStatus_PidList *list)
+{
+	int i, j, ppid, main = 0;
+
+	for (i = 0; i < list->count; ++i)
+	{
+		ppid = ILibDuktape_ServiceStatus_GetParent(list->pids[i]);
+		for (j = 0; j < list->count && list->pids[j] != ppid; ++j);
+		if (j == list->count)
+		{
+			if (main != 0) { return(0); }		// Ambiguous
+			main = list->pids[i];
+		}
+	}
+	return(main);
+}
+
+//
+// Finds the root of the hierarchy that systemd uses to track units. Returns 0 on success
+//
+int ILibDuktape_ServiceStatus_CgroupRoot(char *root, size_t rootLen)
+{
+	char path[PATH_MAX];
+	int i;
+
+	for (i = 0; ILibDuktape_ServiceStatus_CgroupRoots[i] != NULL; ++i)
+	{
+		if (sprintf_s(path, sizeof(path), "%s/system.slice", ILibDuktape_ServiceStatus_CgroupRoots[i]) < 0) { continue; }
+		if (access(path, F_OK) == 0)
+		{
+			strncpy_s(root, rootLen, ILibDuktape_ServiceStatus_CgroupRoots[i], rootLen - 1);
+			return(0);
+		}
+	}
+	return(1);
+}
+
+//
+// Searches the slices for the cgroup of a unit. Returns 0 on success
+//
+int ILibDuktape_ServiceStatus_FindUnit(char *slice, char *unit, char *cgroup, size_t cgroupLen, int depth)
+{
+	char path[PATH_MAX];
+	struct dirent *entry;
+	DIR *dir;
+	size_t len;
+	int ret = 1;
+
+	if (sprintf_s(cgroup, cgroupLen, "%s/%s", slice, unit) >= 0 && access(cgroup, F_OK) == 0) { return(0); }
+	if (depth >= ILibDuktape_ServiceStatus_MAX_DEPTH || (dir = opendir(slice)) == NULL) { return(1); }
+	while (ret != 0 && (entry = readdir(dir)) != NULL)
+	{
+		len = strnlen(entry->d_name, sizeof(entry->d_name));
+		if (entry->d_type != DT_DIR || len < 6 || strcmp(entry->d_name + len - 6, ".slice") != 0) { continue; }
+		if (sprintf_s(path, sizeof(path), "%s/%s", slice, entry->d_name) >= 0) { ret = ILibDuktape_ServiceStatus_FindUnit(path, unit, cgroup, cgroupLen, depth + 1); }
+	}
+	closedir(dir);
+	return(ret);
+}
+
+//
+// A unit is enabled when a target under /etc/systemd/system wants, or requires it
+//
+int ILibDuktape_ServiceStatus_SystemdEnabled(char *unit)
+{
+	char path[PATH_MAX];
+	struct dirent *entry;
+	struct stat info;
+	DIR *dir;
+	size_t len;
+	int ret = 0;
+
+	if ((dir = opendir(ILibDuktape_ServiceStatus_SYSTEMD_ETC)) == NULL) { return(0); }
+	while (ret == 0 && (entry = readdir(dir)) != NULL)
+	{
+		len = strnlen(entry->d_name, sizeof(entry->d_name));
+		if (!((len > 6 && strcmp(entry->d_name + len - 6, ".wants") == 0) || (len > 9 && strcmp(entry->d_name + len - 9, ".requires") == 0))) { continue; }
+		if (sprintf_s(path, sizeof(path), "%s/%s/%s", ILibDuktape_ServiceStatus_SYSTEMD_ETC, entry->d_name, unit) >= 0 && lstat(path, &info) == 0) { ret = 1; }
+	}
+	closedir(dir);
+	return(ret);
+}
+
+duk_ret_t ILibDuktape_ServiceStatus_unitFile(duk_context *ctx)
+{
+	char line[4096];
+	char *key, *value, *end;
+	size_t len = 0;
+	FILE *f;
+
+	if ((f = fopen((char*)duk_require_string(ctx, 0), "r")) == NULL) { duk_push_null(ctx); return(1); }
+
+	duk_push_object(ctx);												// [unit]
+	duk_push_object(ctx);												// [unit][section]
+	while (fgets(line + len, (int)(sizeof(line) - len), f) != NULL)
+	{
+		len += strnlen(line + len, sizeof(line) - len);
+		while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) { line[--len] = 0; }
+		if (len > 0 && line[len - 1] == '\\' && len < sizeof(line) - 2)
+		{
+			line[len - 1] = ' ';										// Line continuation
+			continue;
+		}
+		len = 0;
+
+		for (key = line; *key == ' ' || *key == '\t'; ++key);
+		if (*key == '#' || *key == ';' || *key == 0) { continue; }
+		if (*key == '[')
+		{
+			if ((end = strchr(key, ']')) == NULL) { continue; }
+			*end = 0;
+			duk_pop(ctx);												// [unit]
+			if (!duk_get_prop_string(ctx, -1, key + 1))					// [unit][section]
+			{
+				duk_pop(ctx);											// [unit]
+				duk_push_object(ctx);									// [unit][section]
+				duk_dup(ctx, -1);										// [unit][section][section]
+				duk_put_prop_string(ctx, -3, key + 1);					// [unit][section]
+			}
+			continue;
+		}
+		if ((value = strchr(key, '=')) == NULL) { continue; }
+		for (end = value; end > key && (end[-1] == ' ' || end[-1] == '\t'); --end);
+		*end = 0;
+		for (++value; *value == ' ' || *value == '\t'; ++value);
+		for (end = value + strnlen(value, sizeof(line)); end > value && (end[-1] == ' ' || end[-1] == '\t'); --end);
+		*end = 0;
+		if (*value == 0 || duk_has_prop_string(ctx, -1, key)) { continue; }
+		duk_push_string(ctx, value);
+		duk_put_prop_string(ctx, -2, key);
+	}
+	fclose(f);
+	duk_pop(ctx);														// [unit]
+	return(1);
+}
+duk_ret_t ILibDuktape_ServiceStatus_systemd(duk_context *ctx)
+{
+	char *unit = (char*)duk_require_string(ctx, 0);
+	char root[PATH_MAX];
+	char cgroup[PATH_MAX];
+	ILibDuktape_ServiceStatus_PidList list;
+	int i;
+
+	if (ILibDuktape_ServiceStatus_CgroupRoot(root, sizeof(root)) != 0) { duk_push_null(ctx); return(1); }
+	ILibDuktape_ServiceStatus_PidList_Init(ctx, &list);				// [list]
+	if (ILibDuktape_ServiceStatus_FindUnit(root, unit, cgroup, sizeof(cgroup), 0) == 0)
+	{
+		ILibDuktape_ServiceStatus_CollectPids(cgroup, &list, 0);
+	}
+
+	duk_push_object(ctx);												// [list][status]
+	duk_push_boolean(ctx, list.count > 0); duk_put_prop_string(ctx, -2, "running");
+	duk_push_int(ctx, ILibDuktape_ServiceStatus_MainPid(&list)); duk_put_prop_string(ctx, -2, "pid");
+	duk_push_array(ctx);												// [list][status][pids]
+	for (i = 0; i < list.count; ++i)
+	{
+		duk_push_int(ctx, list.pids[i]);
+		duk_put_prop_index(ctx, -2, i);
+	}
+	duk_put_prop_string(ctx, -2, "pids");								// [list][status]
+	duk_push_boolean(ctx, ILibDuktape_ServiceStatus_SystemdEnabled(unit)); duk_put_prop_string(ctx, -2, "enabled");
+	duk_remove(ctx, -2);												// [status]
+	return(1);
+}
+
+//
+// Adds every service cgroup in the slice to the object at the top of the stack
+//
+void ILibDuktape_ServiceStatus_WalkServices(duk_context *ctx, char *slice, int depth)
+{
+	char path[PATH_MAX];
+	ILibDuktape_ServiceStatus_PidList list;
+	struct dirent *entry;
+	DIR *dir;
+	size_t len;
+
+	if (depth >= ILibDuktape_ServiceStatus_MAX_DEPTH || (dir = opendir(slice)) == NULL) { return; }
+	while ((entry = readdir(dir)) != NULL)
+	{
+		if (entry->d_type != DT_DIR) { continue; }
+		len = strnlen(entry->d_name, sizeof(entry->d_name));
+		if (sprintf_s(path, sizeof(path), "%s/%s", slice, entry->d_name) < 0) { continue; }
+		if (len > 6 && strcmp(entry->d_name + len - 6, ".slice") == 0)
+		{
+			ILibDuktape_ServiceStatus_WalkServices(ctx, path, depth + 1);
+		}
+		else if (len > 8 && strcmp(entry->d_name + len - 8, ".service") == 0)
+		{
+			ILibDuktape_ServiceStatus_PidList_Init(ctx, &list);		// [services][list]
+			ILibDuktape_ServiceStatus_CollectPids(path, &list, 0);
+			duk_push_object(ctx);										// [services][list][status]
+			duk_push_boolean(ctx, list.count > 0); duk_put_prop_string(ctx, -2, "running");
+			duk_push_int(ctx, ILibDuktape_ServiceStatus_MainPid(&list)); duk_put_prop_string(ctx, -2, "pid");
+			duk_push_false(ctx); duk_put_prop_string(ctx, -2, "enabled");
+			duk_put_prop_string(ctx, -3, entry->d_name);				// [services][list]
+			duk_pop(ctx);												// [services]
+		}
+	}
+	closedir(dir);
+}
+duk_ret_t ILibDuktape_ServiceStatus_systemdServices(duk_context *ctx)
+{
+	char root[PATH_MAX];
+	char path[PATH_MAX];
+	struct dirent *entry, *wants;
+	DIR *dir, *wdir;
+	size_t len;
+
+	if (ILibDuktape_ServiceStatus_CgroupRoot(root, sizeof(root)) != 0) { duk_push_null(ctx); return(1); }
+
+	duk_push_object(ctx);												// [services]
+	ILibDuktape_ServiceStatus_WalkServices(ctx, root, 0);
+
+	if ((dir = opendir(ILibDuktape_ServiceStatus_SYSTEMD_ETC)) != NULL)
+	{
+		while ((entry = readdir(dir)) != NULL)
+		{
+			len = strnlen(entry->d_name, sizeof(entry->d_name));
+			if (!((len > 6 && strcmp(entry->d_name + len - 6, ".wants") == 0) || (len > 9 && strcmp(entry->d_name + len - 9, ".requires") == 0))) { continue; }
+			if (sprintf_s(path, sizeof(path), "%s/%s", ILibDuktape_ServiceStatus_SYSTEMD_ETC, entry->d_name) < 0 || (wdir = opendir(path)) == NULL) { continue; }
+			while ((wants = readdir(wdir)) != NULL)
+			{
+				len = strnlen(wants->d_name, sizeof(wants->d_name));
+				if (len <= 8 || strcmp(wants->d_name + len - 8, ".service") != 0) { continue; }
+				if (!duk_get_prop_string(ctx, -1, wants->d_name))		// [services][status]
+				{
+					duk_pop(ctx);										// [services]
+					duk_push_object(ctx);								// [services][status]
+					duk_push_false(ctx); duk_put_prop_string(ctx, -2, "running");
+					duk_push_int(ctx, 0); duk_put_prop_string(ctx, -2, "pid");
+					duk_dup(ctx, -1);									// [services][status][status]
+					duk_put_prop_string(ctx, -3, wants->d_name);		// [services][status]
+				}
+				duk_push_true(ctx); duk_put_prop_string(ctx, -2, "enabled");
+				duk_pop(ctx);											// [services]
+			}
+			closedir(wdir);
+		}
+		closedir(dir);
+	}
+	return(1);
+}
+duk_ret_t ILibDuktape_ServiceStatus_sysv(duk_context *ctx)
+{
+	char *name = (char*)duk_require_string(ctx, 0);
+	char path[PATH_MAX];
+	char target[PATH_MAX];
+	char *base;
+	struct dirent *entry;
+	DIR *dir;
+	ssize_t len;
+	int i, enabled = 0;
+
+	// Enabled, if a start link in a multi-user runlevel points at the script
+	for (i = 0; enabled == 0 && ILibDuktape_ServiceStatus_RunlevelPaths[i] != NULL; ++i)
+	{
+		if ((dir = opendir(ILibDuktape_ServiceStatus_RunlevelPaths[i])) == NULL) { continue; }
+		while (enabled == 0 && (entry = readdir(dir)) != NULL)
+		{
+			if (entry->d_name[0] != 'S') { continue; }
+			if (sprintf_s(path, sizeof(path), "%s/%s", ILibDuktape_ServiceStatus_RunlevelPaths[i], entry->d_name) < 0) { continue; }
+			if ((len = readlink(path, target, sizeof(target) - 1)) <= 0) { continue; }
+			target[len] = 0;
+			base = strrchr(target, '/');
+			if (strcmp(base != NULL ? base + 1 : target, name) == 0) { enabled = 1; }
+		}
+		closedir(dir);
+	}
+
+	duk_push_object(ctx);												// [status]
+	duk_push_boolean(ctx, enabled); duk_put_prop_string(ctx, -2, "enabled");
+	ILibDuktape_ServiceStatus_PushPidFile(ctx, name);
+	return(1);
+}
+duk_ret_t ILibDuktape_ServiceStatus_openrc(duk_context *ctx)
+{
+	char *name = (char*)duk_require_string(ctx, 0);
+	char path[PATH_MAX];
+	int i, started = 0;
+
+	for (i = 0; started == 0 && ILibDuktape_ServiceStatus_OpenRCStarted[i] != NULL; ++i)
+	{
+		if (sprintf_s(path, sizeof(path), ILibDuktape_ServiceStatus_OpenRCStarted[i], name) >= 0 && access(path, F_OK) == 0) { started = 1; }
+	}
+
+	duk_push_object(ctx);												// [status]
+	duk_push_boolean(ctx, sprintf_s(path, sizeof(path), "/etc/runlevels/default/%s", name) >= 0 && access(path, F_OK) == 0); duk_put_prop_string(ctx, -2, "enabled");
+	duk_push_boolean(ctx, started); duk_put_prop_string(ctx, -2, "started");
+	ILibDuktape_ServiceStatus_PushPidFile(ctx, name);
+	return(1);
+}
+void ILibDuktape_ServiceStatus_PUSH(duk_context *ctx, void *chain)
+{
+	duk_push_object(ctx);												// [ServiceStatus]
+	ILibDuktape_CreateInstanceMethod(ctx, "unitFile", ILibDuktape_ServiceStatus_unitFile, 1);
+	ILibDuktape_CreateInstanceMethod(ctx, "systemd", ILibDuktape_ServiceStatus_systemd, 1);
+	ILibDuktape_CreateInstanceMethod(ctx, "systemdServices", ILibDuktape_ServiceStatus_systemdServices, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "sysv", ILibDuktape_ServiceStatus_sysv, 1);
+	ILibDuktape_CreateInstanceMethod(ctx, "openrc", ILibDuktape_ServiceStatus_openrc, 1);
+}
+void ILibDuktape_ServiceStatus_Init(duk_context *ctx)
+{
+	ILibDuktape_ModSearch_AddHandler(ctx, "ServiceStatus", ILibDuktape_ServiceStatus_PUSH);
+}
+
+#else
+
+void ILibDuktape_ServiceStatus_Init(duk_context *ctx)
+{
+	UNREFERENCED_PARAMETER(ctx);
+}
+
+#endif
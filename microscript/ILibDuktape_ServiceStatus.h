@@ -0,0 +1,66 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef __ILIBDUKTAPE_SERVICESTATUS__
+#define __ILIBDUKTAPE_SERVICESTATUS__
+
+#include "duktape.h"
+
+#ifdef __DOXY__
+/*!
+\brief Native service status for Linux, read from unit files, cgroups, runlevel links and PID files, without spawning systemctl/service/initctl. <b>Note:</b> To use, must <b>require('ServiceStatus')</b>
+*
+systemd services are considered running when their cgroup has processes. pid is the only process in the cgroup whose parent is not part of the service, or 0 when there is more than one, so it is not a substitute for the MainPID that systemctl reports.
+<br>This module only queries state. Starting and stopping services is still done with the init system's tools.
+*/
+class ServiceStatus
+{
+public:
+	/*!
+	\brief Parses a systemd unit file
+	\param path \<String\> Path to the unit file
+	\return {Section: {Key: value}}, or null if the file cannot be read. Only the first non-empty assignment of a key is kept
+	*/
+	Object unitFile(path);
+	/*!
+	\brief Fetches the status of a systemd unit
+	\param unit \<String\> Unit name, ie: 'meshagent.service'
+	\return {running, pid, pids, enabled}, or null if the systemd cgroup hierarchy is not available
+	*/
+	Object systemd(unit);
+	/*!
+	\brief Fetches the status of every systemd service that is running, or enabled, in a single pass
+	\return {unit: {running, pid, enabled}}, or null if the systemd cgroup hierarchy is not available
+	*/
+	Object systemdServices();
+	/*!
+	\brief Fetches the status of a SysV init script, from its rc.d links and PID file
+	\param name \<String\> Service name
+	\return {enabled, pidFile, pid, running, child}. pidFile is null if the service does not have one. child is the first child of pid, or 0
+	*/
+	Object sysv(name);
+	/*!
+	\brief Fetches the status of an OpenRC service, from its runlevel links, state directory and PID file
+	\param name \<String\> Service name
+	\return {enabled, started, pidFile, pid, running, child}. enabled refers to the default runlevel
+	*/
+	Object openrc(name);
+};
+#endif
+
+void ILibDuktape_ServiceStatus_Init(duk_context *ctx);
+
+#endif
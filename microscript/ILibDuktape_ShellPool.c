@@ -0,0 +1,650 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+#define _GNU_SOURCE
+
+#include "duktape.h"
+#include "ILibDuktapeModSearch.h"
+#include "ILibDuktape_Helpers.h"
+#include "ILibDuktape_ShellPool.h"
+#include "../microstack/ILibParsers.h"
+#include "microstack/ILibCrypto.h"
+
+#if defined(_POSIX)
+
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char **environ;
+
+#define ILibDuktape_ShellPool_PTR				"\xFF_ShellPool_PTR"
+#define ILibDuktape_ShellPool_PROMISES			"\xFF_ShellPool_PROMISES"
+#define ILibDuktape_ShellPool_MAXSHELLS			8
+#define ILibDuktape_ShellPool_DEFAULTSIZE		2
+#define ILibDuktape_ShellPool_TIMEOUT			30000
+#define ILibDuktape_ShellPool_MAXUSES			256
+#define ILibDuktape_ShellPool_TOKENSIZE			16
+
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+#define ILibDuktape_ShellPool_CLOSEFROM
+#endif
+
+typedef enum ILibDuktape_ShellPool_Status
+{
+	ILibDuktape_ShellPool_Status_RUNNING = 0,
+	ILibDuktape_ShellPool_Status_DONE = 1,
+	ILibDuktape_ShellPool_Status_FAILED = 2,
+	ILibDuktape_ShellPool_Status_TIMEOUT = 3
+}ILibDuktape_ShellPool_Status;
+
+typedef struct ILibDuktape_ShellPool_Buffer
+{
+	char *data;
+	size_t length;
+	size_t capacity;
+}ILibDuktape_ShellPool_Buffer;
+
+typedef struct ILibDuktape_ShellPool_Shell
+{
+	pid_t pid;
+	int in, out, err;
+	int uses;
+	int busy;
+	void *promise;
+	long long deadline;
+	char token[2 * ILibDuktape_ShellPool_TOKENSIZE + 1];
+	ILibDuktape_ShellPool_Buffer request;
+	ILibDuktape_ShellPool_Buffer stdOut;
+	ILibDuktape_ShellPool_Buffer stdErr;
+	size_t written;
+	int exitCode;
+	int outDone, errDone;
+}ILibDuktape_ShellPool_Shell;
+
+typedef struct ILibDuktape_ShellPool_Request
+{
+	void *promise;
+	int timeout;
+	size_t scriptLen;
+	char script[];
+}ILibDuktape_ShellPool_Request;
+
+typedef struct ILibDuktape_ShellPool
+{
+	ILibChain_Link link;
+	duk_context *ctx;
+	void *object;
+	int size;
+	ILibQueue pending;
+	ILibDuktape_ShellPool_Shell shells[ILibDuktape_ShellPool_MAXSHELLS];
+}ILibDuktape_ShellPool;
+
+void ILibDuktape_ShellPool_Buffer_Append(ILibDuktape_ShellPool_Buffer *buffer, char *data, size_t dataLen)
+{
+	if (buffer->length + dataLen + 1 > buffer->capacity)
+	{
+		buffer->capacity = buffer->capacity == 0 ? 4096 : buffer->capacity;
+		while (buffer->length + dataLen + 1 > buffer->capacity) { buffer->capacity *= 2; }
+		if ((buffer->data = (char*)realloc(buffer->data, buffer->capacity)) == NULL) { ILIBCRITICALEXIT(254); }
+	}
+	memcpy_s(buffer->data + buffer->length, buffer->capacity - buffer->length, data, dataLen);
+	buffer->length += dataLen;
+	buffer->data[buffer->length] = 0;
+}
+void ILibDuktape_ShellPool_Buffer_Free(ILibDuktape_ShellPool_Buffer *buffer)
+{
+	free(buffer->data);
+	memset(buffer, 0, sizeof(ILibDuktape_ShellPool_Buffer));
+}
+
+void ILibDuktape_ShellPool_Shell_Stop(ILibDuktape_ShellPool_Shell *shell, int killGroup)
+{
+	if (shell->in >= 0) { close(shell->in); }
+	if (shell->out >= 0) { close(shell->out); }
+	if (shell->err >= 0) { close(shell->err); }
+	shell->in = shell->out = shell->err = -1;
+
+	if (shell->pid > 0)
+	{
+		// An idle shell has nothing running, but a shell that timed out is killed along with whatever the script started
+		kill(killGroup ? -shell->pid : shell->pid, SIGKILL);
+		while (waitpid(shell->pid, NULL, 0) < 0 && errno == EINTR);
+	}
+	shell->pid = 0;
+	shell->uses = 0;
+	shell->busy = 0;
+	shell->promise = NULL;
+	ILibDuktape_ShellPool_Buffer_Free(&(shell->request));
+	ILibDuktape_ShellPool_Buffer_Free(&(shell->stdOut));
+	ILibDuktape_ShellPool_Buffer_Free(&(shell->stdErr));
+}
+int ILibDuktape_ShellPool_Shell_Start(ILibDuktape_ShellPool_Shell *shell)
+{
+	int inPipe[2], outPipe[2], errPipe[2];
+	int i, ret = 1;
+	char *argv[] = { "/bin/sh", NULL };
+	posix_spawn_file_actions_t actions;
+	posix_spawnattr_t attr;
+	sigset_t sigs;
+
+	if (pipe(inPipe) != 0) { return(1); }
+	if (pipe(outPipe) != 0) { close(inPipe[0]); close(inPipe[1]); return(1); }
+	if (pipe(errPipe) != 0) { close(inPipe[0]); close(inPipe[1]); close(outPipe[0]); close(outPipe[1]); return(1); }
+
+	// The pipes are duped onto 0/1/2 in the child, so every original descriptor can be close-on-exec
+	for (i = 0; i < 2; ++i)
+	{
+		fcntl(inPipe[i], F_SETFD, FD_CLOEXEC);
+		fcntl(outPipe[i], F_SETFD, FD_CLOEXEC);
+		fcntl(errPipe[i], F_SETFD, FD_CLOEXEC);
+	}
+	fcntl(inPipe[1], F_SETFL, O_NONBLOCK);
+	fcntl(outPipe[0], F_SETFL, O_NONBLOCK);
+	fcntl(errPipe[0], F_SETFL, O_NONBLOCK);
+
+	posix_spawn_file_actions_init(&actions);
+	posix_spawn_file_actions_adddup2(&actions, inPipe[0], STDIN_FILENO);
+	posix_spawn_file_actions_adddup2(&actions, outPipe[1], STDOUT_FILENO);
+	posix_spawn_file_actions_adddup2(&actions, errPipe[1], STDERR_FILENO);
+#ifdef ILibDuktape_ShellPool_CLOSEFROM
+	posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+#endif
+
+	// The shell leads its own process group, so a hung script can be killed with everything it started
+	posix_spawnattr_init(&attr);
+	sigfillset(&sigs);
+	posix_spawnattr_setsigdefault(&attr, &sigs);
+	sigemptyset(&sigs);
+	posix_spawnattr_setsigmask(&attr, &sigs);
+	posix_spawnattr_setpgroup(&attr, 0);
+	posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP | POSIX_SPAWN_SETSIGDEF | POSIX_SPAWN_SETSIGMASK);
+
+	if (posix_spawn(&(shell->pid), argv[0], &actions, &attr, argv, environ) == 0)
+	{
+		shell->in = inPipe[1];
+		shell->out = outPipe[0];
+		shell->err = errPipe[0];
+		shell->uses = 0;
+		ret = 0;
+	}
+	else
+	{
+		shell->pid = 0;
+		close(inPipe[1]); close(outPipe[0]); close(errPipe[0]);
+	}
+	close(inPipe[0]); close(outPipe[1]); close(errPipe[1]);
+
+	posix_spawn_file_actions_destroy(&actions);
+	posix_spawnattr_destroy(&attr);
+	return(ret);
+}
+
+int ILibDuktape_ShellPool_Shell_Write(ILibDuktape_ShellPool_Shell *shell)
+{
+	ssize_t bytes;
+	while (shell->written < shell->request.length)
+	{
+		bytes = write(shell->in, shell->request.data + shell->written, shell->request.length - shell->written);
+		if (bytes < 0)
+		{
+			if (errno == EINTR) { continue; }
+			return((errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : 1);
+		}
+		shell->written += (size_t)bytes;
+	}
+	return(0);
+}
+int ILibDuktape_ShellPool_Shell_Read(int fd, ILibDuktape_ShellPool_Buffer *buffer)
+{
+	char tmp[4096];
+	ssize_t bytes;
+
+	while (1)
+	{
+		bytes = read(fd, tmp, sizeof(tmp));
+		if (bytes > 0) { ILibDuktape_ShellPool_Buffer_Append(buffer, tmp, (size_t)bytes); continue; }
+		if (bytes < 0 && errno == EINTR) { continue; }
+		if (bytes < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) { return(0); }
+		return(1);			// The shell exited, or closed its output, in the middle of a request
+	}
+}
+//
+// Each request is run in a subshell with stdin detached, followed by a marker on stdout with the exit status, and
+// a marker on stderr. The marker token is random, and changes with every request, so the script cannot forge it.
+//
+void ILibDuktape_ShellPool_Shell_Begin(ILibDuktape_ShellPool_Shell *shell, char *script, size_t scriptLen, int timeout)
+{
+	char random[ILibDuktape_ShellPool_TOKENSIZE];
+	size_t i, start;
+
+	// Anything a background job wrote after the last marker is discarded
+	ILibDuktape_ShellPool_Shell_Read(shell->out, &(shell->stdOut));
+	ILibDuktape_ShellPool_Shell_Read(shell->err, &(shell->stdErr));
+
+	util_random(sizeof(random), random);
+	util_tohex(random, sizeof(random), shell->token);
+
+	shell->request.length = shell->stdOut.length = shell->stdErr.length = 0;
+	shell->written = 0;
+	shell->exitCode = -1;
+	shell->outDone = shell->errDone = 0;
+	shell->busy = 1;
+	shell->uses++;
+	shell->deadline = ILibGetUptime() + timeout;
+
+	ILibDuktape_ShellPool_Buffer_Append(&(shell->request), "( eval '", 8);
+	for (i = start = 0; i < scriptLen; ++i)
+	{
+		if (script[i] == '\'')
+		{
+			ILibDuktape_ShellPool_Buffer_Append(&(shell->request), script + start, i - start);
+			ILibDuktape_ShellPool_Buffer_Append(&(shell->request), "'\\''", 4);
+			start = i + 1;
+		}
+	}
+	ILibDuktape_ShellPool_Buffer_Append(&(shell->request), script + start, scriptLen - start);
+	ILibDuktape_ShellPool_Buffer_Append(&(shell->request), "'\n) </dev/null\nprintf '\\n%s %d\\n' '", 35);
+	ILibDuktape_ShellPool_Buffer_Append(&(shell->request), shell->token, sizeof(shell->token) - 1);
+	ILibDuktape_ShellPool_Buffer_Append(&(shell->request), "' $?\nprintf '\\n%s\\n' '", 22);
+	ILibDuktape_ShellPool_Buffer_Append(&(shell->request), shell->token, sizeof(shell->token) - 1);
+	ILibDuktape_ShellPool_Buffer_Append(&(shell->request), "' >&2\n", 6);
+}
+void ILibDuktape_ShellPool_Shell_CheckMarkers(ILibDuktape_ShellPool_Shell *shell)
+{
+	size_t tokenLen = sizeof(shell->token) - 1;
+	char *marker;
+	size_t i;
+
+	// stdout ends with "\n<token> <status>\n"
+	if (shell->outDone == 0 && shell->stdOut.length > tokenLen + 3 && shell->stdOut.data[shell->stdOut.length - 1] == '\n')
+	{
+		i = shell->stdOut.length - 2;
+		while (i > 0 && shell->stdOut.data[i] != ' ' && shell->stdOut.length - i < 16) { --i; }
+		if (shell->stdOut.data[i] == ' ' && i >= tokenLen + 1)
+		{
+			marker = shell->stdOut.data + i - tokenLen - 1;
+			if (marker[0] == '\n' && memcmp(marker + 1, shell->token, tokenLen) == 0)
+			{
+				shell->exitCode = atoi(shell->stdOut.data + i + 1);
+				shell->stdOut.length = (size_t)(marker - shell->stdOut.data);
+				shell->stdOut.data[shell->stdOut.length] = 0;
+				shell->outDone = 1;
+			}
+		}
+	}
+
+	// stderr ends with "\n<token>\n"
+	if (shell->errDone == 0 && shell->stdErr.length >= tokenLen + 2)
+	{
+		marker = shell->stdErr.data + shell->stdErr.length - tokenLen - 2;
+		if (marker[0] == '\n' && marker[tokenLen + 1] == '\n' && memcmp(marker + 1, shell->token, tokenLen) == 0)
+		{
+			shell->stdErr.length = (size_t)(marker - shell->stdErr.data);
+			shell->stdErr.data[shell->stdErr.length] = 0;
+			shell->errDone = 1;
+		}
+	}
+}
+//
+// Services whichever descriptors are ready, and returns the status of the request
+//
+ILibDuktape_ShellPool_Status ILibDuktape_ShellPool_Shell_Service(ILibDuktape_ShellPool_Shell *shell, int writable, int outReadable, int errReadable)
+{
+	if (writable && ILibDuktape_ShellPool_Shell_Write(shell) != 0) { return(ILibDuktape_ShellPool_Status_FAILED); }
+	if (outReadable && shell->outDone == 0 && ILibDuktape_ShellPool_Shell_Read(shell->out, &(shell->stdOut)) != 0) { return(ILibDuktape_ShellPool_Status_FAILED); }
+	if (errReadable && shell->errDone == 0 && ILibDuktape_ShellPool_Shell_Read(shell->err, &(shell->stdErr)) != 0) { return(ILibDuktape_ShellPool_Status_FAILED); }
+
+	ILibDuktape_ShellPool_Shell_CheckMarkers(shell);
+	if (shell->outDone != 0 && shell->errDone != 0) { return(ILibDuktape_ShellPool_Status_DONE); }
+	if (ILibGetUptime() >= shell->deadline) { return(ILibDuktape_ShellPool_Status_TIMEOUT); }
+	return(ILibDuktape_ShellPool_Status_RUNNING);
+}
+void ILibDuktape_ShellPool_PushResult(duk_context *ctx, ILibDuktape_ShellPool_Shell *shell, ILibDuktape_ShellPool_Status status)
+{
+	duk_push_object(ctx);																	// [result]
+	duk_push_lstring(ctx, shell->stdOut.data == NULL ? "" : shell->stdOut.data, shell->stdOut.length); duk_put_prop_string(ctx, -2, "stdout");
+	duk_push_lstring(ctx, shell->stdErr.data == NULL ? "" : shell->stdErr.data, shell->stdErr.length); duk_put_prop_string(ctx, -2, "stderr");
+	if (status == ILibDuktape_ShellPool_Status_DONE) { duk_push_int(ctx, shell->exitCode); } else { duk_push_null(ctx); }
+	duk_put_prop_string(ctx, -2, "code");
+	if (status == ILibDuktape_ShellPool_Status_TIMEOUT) { duk_push_true(ctx); duk_put_prop_string(ctx, -2, "timedOut"); }
+}
+//
+// Returns a shell to the pool, or retires it if it failed, is over its use count, or is outside of the pool size
+//
+void ILibDuktape_ShellPool_Shell_Finish(ILibDuktape_ShellPool *pool, ILibDuktape_ShellPool_Shell *shell, ILibDuktape_ShellPool_Status status)
+{
+	shell->busy = 0;
+	shell->promise = NULL;
+	if (status != ILibDuktape_ShellPool_Status_DONE || shell->uses >= ILibDuktape_ShellPool_MAXUSES || pool == NULL || (shell - pool->shells) >= pool->size)
+	{
+		ILibDuktape_ShellPool_Shell_Stop(shell, status == ILibDuktape_ShellPool_Status_TIMEOUT);
+	}
+}
+ILibDuktape_ShellPool_Shell* ILibDuktape_ShellPool_GetIdleShell(ILibDuktape_ShellPool *pool, int limit)
+{
+	ILibDuktape_ShellPool_Shell *shell = NULL;
+	int i;
+
+	for (i = 0; i < limit; ++i)
+	{
+		if (pool->shells[i].busy == 0 && pool->shells[i].pid > 0)
+		{
+			if (waitpid(pool->shells[i].pid, NULL, WNOHANG) == 0) { return(&(pool->shells[i])); }
+
+			// The shell exited while it was idle
+			pool->shells[i].pid = 0;
+			ILibDuktape_ShellPool_Shell_Stop(&(pool->shells[i]), 0);
+		}
+		if (shell == NULL && pool->shells[i].busy == 0 && pool->shells[i].pid == 0) { shell = &(pool->shells[i]); }
+	}
+	if (shell != NULL && ILibDuktape_ShellPool_Shell_Start(shell) != 0) { shell = NULL; }
+	return(shell);
+}
+
+void ILibDuktape_ShellPool_Settle(ILibDuktape_ShellPool *pool, void *promise, int resolve)
+{
+	duk_context *ctx = pool->ctx;
+																							// [result]
+	duk_push_heapptr(ctx, promise);															// [result][promise]
+	duk_get_prop_string(ctx, -1, resolve ? "_res" : "_rej");								// [result][promise][func]
+	duk_swap_top(ctx, -2);																	// [result][func][this]
+	duk_dup(ctx, -3);																		// [result][func][this][result]
+	if (duk_pcall_method(ctx, 1) != 0) { ILibDuktape_Process_UncaughtExceptionEx(ctx, "ShellPool.exec(): "); }
+	duk_pop(ctx);																			// [result]
+
+	duk_push_heapptr(ctx, pool->object);													// [result][pool]
+	duk_get_prop_string(ctx, -1, ILibDuktape_ShellPool_PROMISES);							// [result][pool][table]
+	duk_push_sprintf(ctx, "%p", promise);													// [result][pool][table][key]
+	duk_del_prop(ctx, -2);																	// [result][pool][table]
+	duk_pop_2(ctx);																			// [result]
+}
+void ILibDuktape_ShellPool_Dispatch(ILibDuktape_ShellPool *pool)
+{
+	ILibDuktape_ShellPool_Request *request;
+	ILibDuktape_ShellPool_Shell *shell;
+	int i;
+
+	while (pool->ctx != NULL && ILibQueue_IsEmpty(pool->pending) == 0)
+	{
+		if ((shell = ILibDuktape_ShellPool_GetIdleShell(pool, pool->size)) == NULL)
+		{
+			for (i = 0; i < pool->size && pool->shells[i].busy == 0; ++i);
+			if (i < pool->size) { break; }
+
+			// Nothing is running, so /bin/sh could not be started
+			request = (ILibDuktape_ShellPool_Request*)ILibQueue_DeQueue(pool->pending);
+			duk_push_error_object(pool->ctx, DUK_ERR_ERROR, "ShellPool.exec(): Unable to start /bin/sh");
+			ILibDuktape_ShellPool_Settle(pool, request->promise, 0);
+			duk_pop(pool->ctx);
+			free(request);
+			continue;
+		}
+		request = (ILibDuktape_ShellPool_Request*)ILibQueue_DeQueue(pool->pending);
+		ILibDuktape_ShellPool_Shell_Begin(shell, request->script, request->scriptLen, request->timeout);
+		shell->promise = request->promise;
+		free(request);
+	}
+}
+void ILibDuktape_ShellPool_PreSelect(void* object, fd_set *readset, fd_set *writeset, fd_set *errorset, int* blocktime)
+{
+	ILibDuktape_ShellPool *pool = (ILibDuktape_ShellPool*)object;
+	long long now = ILibGetUptime();
+	int i;
+
+	if (pool->ctx == NULL) { return; }
+	for (i = 0; i < ILibDuktape_ShellPool_MAXSHELLS; ++i)
+	{
+		ILibDuktape_ShellPool_Shell *shell = &(pool->shells[i]);
+		if (shell->busy == 0 || shell->promise == NULL) { continue; }
+
+		if (shell->written < shell->request.length) { FD_SET(shell->in, writeset); }
+		if (shell->outDone == 0) { FD_SET(shell->out, readset); }
+		if (shell->errDone == 0) { FD_SET(shell->err, readset); }
+		if (shell->deadline - now < (long long)*blocktime) { *blocktime = shell->deadline > now ? (int)(shell->deadline - now) : 0; }
+	}
+}
+void ILibDuktape_ShellPool_PostSelect(void* object, int slct, fd_set *readset, fd_set *writeset, fd_set *errorset)
+{
+	ILibDuktape_ShellPool *pool = (ILibDuktape_ShellPool*)object;
+	ILibDuktape_ShellPool_Status status;
+	void *promise;
+	int i, settled = 0;
+
+	UNREFERENCED_PARAMETER(slct);
+	UNREFERENCED_PARAMETER(errorset);
+
+	if (pool->ctx == NULL) { return; }
+	for (i = 0; i < ILibDuktape_ShellPool_MAXSHELLS && pool->ctx != NULL; ++i)
+	{
+		ILibDuktape_ShellPool_Shell *shell = &(pool->shells[i]);
+		if (shell->busy == 0 || shell->promise == NULL) { continue; }
+
+		status = ILibDuktape_ShellPool_Shell_Service(shell, FD_ISSET(shell->in, writeset), FD_ISSET(shell->out, readset), FD_ISSET(shell->err, readset));
+		if (status == ILibDuktape_ShellPool_Status_RUNNING) { continue; }
+
+		// The shell goes back to the pool before the promise is settled, so the handler can queue more work
+		promise = shell->promise;
+		ILibDuktape_ShellPool_PushResult(pool->ctx, shell, status);						// [result]
+		ILibDuktape_ShellPool_Shell_Finish(pool, shell, status);
+		ILibDuktape_ShellPool_Settle(pool, promise, 1);
+		duk_pop(pool->ctx);																// ...
+		settled = 1;
+	}
+	if (settled != 0) { ILibDuktape_ShellPool_Dispatch(pool); }
+}
+void ILibDuktape_ShellPool_Destroy(void *object)
+{
+	ILibDuktape_ShellPool *pool = (ILibDuktape_ShellPool*)object;
+	int i;
+
+	for (i = 0; i < ILibDuktape_ShellPool_MAXSHELLS; ++i) { ILibDuktape_ShellPool_Shell_Stop(&(pool->shells[i]), 1); }
+	while (ILibQueue_IsEmpty(pool->pending) == 0) { free(ILibQueue_DeQueue(pool->pending)); }
+	ILibQueue_Destroy(pool->pending);
+}
+
+duk_ret_t ILibDuktape_ShellPool_run(duk_context *ctx)
+{
+	duk_size_t scriptLen;
+	char *script = (char*)duk_require_lstring(ctx, 0, &scriptLen);
+	int timeout = duk_is_object(ctx, 1) ? Duktape_GetIntPropertyValue(ctx, 1, "timeout", ILibDuktape_ShellPool_TIMEOUT) : ILibDuktape_ShellPool_TIMEOUT;
+	ILibDuktape_ShellPool *pool;
+	ILibDuktape_ShellPool_Shell *shell, tmp;
+	ILibDuktape_ShellPool_Status status;
+	struct pollfd fds[3];
+	long long now;
+	int n;
+
+	duk_push_this(ctx);
+	pool = (ILibDuktape_ShellPool*)Duktape_GetPointerProperty(ctx, -1, ILibDuktape_ShellPool_PTR);
+
+	// A blocking call can use any free slot. If exec() has every slot busy, it runs on a one-off shell instead
+	if ((shell = ILibDuktape_ShellPool_GetIdleShell(pool, ILibDuktape_ShellPool_MAXSHELLS)) == NULL)
+	{
+		memset(&tmp, 0, sizeof(tmp));
+		tmp.in = tmp.out = tmp.err = -1;
+		if (ILibDuktape_ShellPool_Shell_Start(&tmp) != 0) { return(ILibDuktape_Error(ctx, "ShellPool.run(): Unable to start /bin/sh")); }
+		shell = &tmp;
+	}
+
+	ILibDuktape_ShellPool_Shell_Begin(shell, script, scriptLen, timeout);
+	do
+	{
+		n = 0;
+		if (shell->written < shell->request.length) { fds[n].fd = shell->in; fds[n].events = POLLOUT; fds[n++].revents = 0; }
+		if (shell->outDone == 0) { fds[n].fd = shell->out; fds[n].events = POLLIN; fds[n++].revents = 0; }
+		if (shell->errDone == 0) { fds[n].fd = shell->err; fds[n].events = POLLIN; fds[n++].revents = 0; }
+
+		now = ILibGetUptime();
+		if (poll(fds, n, shell->deadline > now ? (int)(shell->deadline - now) : 0) < 0 && errno != EINTR)
+		{
+			status = ILibDuktape_ShellPool_Status_FAILED;
+			break;
+		}
+		status = ILibDuktape_ShellPool_Shell_Service(shell, 1, 1, 1);
+	} while (status == ILibDuktape_ShellPool_Status_RUNNING);
+
+	ILibDuktape_ShellPool_PushResult(ctx, shell, status);
+	ILibDuktape_ShellPool_Shell_Finish(shell == &tmp ? NULL : pool, shell, status);
+	return(1);
+}
+duk_ret_t ILibDuktape_ShellPool_exec(duk_context *ctx)
+{
+	duk_size_t scriptLen;
+	char *script = (char*)duk_require_lstring(ctx, 0, &scriptLen);
+	int timeout = duk_is_object(ctx, 1) ? Duktape_GetIntPropertyValue(ctx, 1, "timeout", ILibDuktape_ShellPool_TIMEOUT) : ILibDuktape_ShellPool_TIMEOUT;
+	ILibDuktape_ShellPool_Request *request;
+	ILibDuktape_ShellPool *pool;
+	void *promise;
+
+	duk_push_this(ctx);																		// [pool]
+	pool = (ILibDuktape_ShellPool*)Duktape_GetPointerProperty(ctx, -1, ILibDuktape_ShellPool_PTR);
+	duk_get_prop_string(ctx, -1, ILibDuktape_ShellPool_PROMISES);							// [pool][table]
+	duk_eval_string(ctx, "(function(){var p = require('promise'); var ret = new p(function(res, rej){this._res = res; this._rej = rej;}); return(ret);})();");	// [pool][table][promise]
+	promise = duk_get_heapptr(ctx, -1);
+	duk_push_sprintf(ctx, "%p", promise);													// [pool][table][promise][key]
+	duk_dup(ctx, -2);																		// [pool][table][promise][key][promise]
+	duk_put_prop(ctx, -4);																	// [pool][table][promise]
+
+	// Requests are always queued, and dispatched in order, so a burst of exec() calls is spread across the pool
+	request = (ILibDuktape_ShellPool_Request*)ILibMemory_Allocate(sizeof(ILibDuktape_ShellPool_Request) + scriptLen, 0, NULL, NULL);
+	request->promise = promise;
+	request->timeout = timeout;
+	request->scriptLen = scriptLen;
+	memcpy_s(request->script, scriptLen, script, scriptLen);
+	ILibQueue_EnQueue(pool->pending, request);
+	ILibDuktape_ShellPool_Dispatch(pool);
+	return(1);
+}
+duk_ret_t ILibDuktape_ShellPool_close(duk_context *ctx)
+{
+	ILibDuktape_ShellPool *pool;
+	ILibDuktape_ShellPool_Request *request;
+	void *promise;
+	int i;
+
+	duk_push_this(ctx);
+	pool = (ILibDuktape_ShellPool*)Duktape_GetPointerProperty(ctx, -1, ILibDuktape_ShellPool_PTR);
+
+	while (ILibQueue_IsEmpty(pool->pending) == 0)
+	{
+		request = (ILibDuktape_ShellPool_Request*)ILibQueue_DeQueue(pool->pending);
+		duk_push_object(ctx);
+		duk_push_string(ctx, ""); duk_put_prop_string(ctx, -2, "stdout");
+		duk_push_string(ctx, ""); duk_put_prop_string(ctx, -2, "stderr");
+		duk_push_null(ctx); duk_put_prop_string(ctx, -2, "code");
+		ILibDuktape_ShellPool_Settle(pool, request->promise, 1);
+		duk_pop(ctx);
+		free(request);
+	}
+	for (i = 0; i < ILibDuktape_ShellPool_MAXSHELLS; ++i)
+	{
+		ILibDuktape_ShellPool_Shell *shell = &(pool->shells[i]);
+		if ((promise = shell->promise) != NULL)
+		{
+			ILibDuktape_ShellPool_PushResult(ctx, shell, ILibDuktape_ShellPool_Status_FAILED);
+			ILibDuktape_ShellPool_Shell_Stop(shell, 1);
+			ILibDuktape_ShellPool_Settle(pool, promise, 1);
+			duk_pop(ctx);
+		}
+		else
+		{
+			ILibDuktape_ShellPool_Shell_Stop(shell, 0);
+		}
+	}
+	return(0);
+}
+duk_ret_t ILibDuktape_ShellPool_size_GET(duk_context *ctx)
+{
+	duk_push_this(ctx);
+	duk_push_int(ctx, ((ILibDuktape_ShellPool*)Duktape_GetPointerProperty(ctx, -1, ILibDuktape_ShellPool_PTR))->size);
+	return(1);
+}
+duk_ret_t ILibDuktape_ShellPool_size_SET(duk_context *ctx)
+{
+	ILibDuktape_ShellPool *pool;
+	int i, size = duk_require_int(ctx, 0);
+
+	if (size < 1 || size > ILibDuktape_ShellPool_MAXSHELLS) { return(ILibDuktape_Error(ctx, "ShellPool.size must be between 1 and %d", ILibDuktape_ShellPool_MAXSHELLS)); }
+
+	duk_push_this(ctx);
+	pool = (ILibDuktape_ShellPool*)Duktape_GetPointerProperty(ctx, -1, ILibDuktape_ShellPool_PTR);
+	pool->size = size;
+	for (i = size; i < ILibDuktape_ShellPool_MAXSHELLS; ++i)
+	{
+		// Busy shells are retired when they finish
+		if (pool->shells[i].busy == 0) { ILibDuktape_ShellPool_Shell_Stop(&(pool->shells[i]), 0); }
+	}
+	ILibDuktape_ShellPool_Dispatch(pool);
+	return(0);
+}
+duk_ret_t ILibDuktape_ShellPool_Finalizer(duk_context *ctx)
+{
+	ILibDuktape_ShellPool *pool = (ILibDuktape_ShellPool*)Duktape_GetPointerProperty(ctx, 0, ILibDuktape_ShellPool_PTR);
+	void *chain = Duktape_GetChain(ctx);
+
+	pool->link.PreSelectHandler = NULL;
+	pool->link.PostSelectHandler = NULL;
+	pool->ctx = NULL;
+	pool->object = NULL;
+
+	if (ILibIsChainBeingDestroyed(chain) == 0)
+	{
+		ILibChain_SafeRemove(chain, pool);
+	}
+	return(0);
+}
+void ILibDuktape_ShellPool_PUSH(duk_context *ctx, void *chain)
+{
+	ILibDuktape_ShellPool *pool = (ILibDuktape_ShellPool*)ILibChain_Link_Allocate(sizeof(ILibDuktape_ShellPool), 0);
+	int i;
+
+	pool->link.MetaData = ILibMemory_SmartAllocate_FromString("ShellPool");
+	pool->link.PreSelectHandler = ILibDuktape_ShellPool_PreSelect;
+	pool->link.PostSelectHandler = ILibDuktape_ShellPool_PostSelect;
+	pool->link.DestroyHandler = ILibDuktape_ShellPool_Destroy;
+	pool->pending = ILibQueue_Create();
+	pool->size = ILibDuktape_ShellPool_DEFAULTSIZE;
+	for (i = 0; i < ILibDuktape_ShellPool_MAXSHELLS; ++i) { pool->shells[i].in = pool->shells[i].out = pool->shells[i].err = -1; }
+
+	duk_push_object(ctx);																	// [ShellPool]
+	duk_push_pointer(ctx, pool); duk_put_prop_string(ctx, -2, ILibDuktape_ShellPool_PTR);
+	duk_push_object(ctx); duk_put_prop_string(ctx, -2, ILibDuktape_ShellPool_PROMISES);
+	ILibDuktape_CreateFinalizer(ctx, ILibDuktape_ShellPool_Finalizer);
+	pool->ctx = ctx;
+	pool->object = duk_get_heapptr(ctx, -1);
+
+	ILibDuktape_CreateEventWithGetterAndSetterEx(ctx, "size", ILibDuktape_ShellPool_size_GET, ILibDuktape_ShellPool_size_SET);
+	ILibDuktape_CreateInstanceMethod(ctx, "run", ILibDuktape_ShellPool_run, DUK_VARARGS);
+	ILibDuktape_CreateInstanceMethod(ctx, "exec", ILibDuktape_ShellPool_exec, DUK_VARARGS);
+	ILibDuktape_CreateInstanceMethod(ctx, "close", ILibDuktape_ShellPool_close, 0);
+
+	ILibAddToChain(chain, pool);
+}
+void ILibDuktape_ShellPool_Init(duk_context *ctx)
+{
+	ILibDuktape_ModSearch_AddHandler(ctx, "ShellPool", ILibDuktape_ShellPool_PUSH);
+}
+
+#else
+
+void ILibDuktape_ShellPool_Init(duk_context *ctx)
+{
+	UNREFERENCED_PARAMETER(ctx);
+}
+
+#endif
@@ -0,0 +1,60 @@
+/*
+Copyright 2006 - 2022 Intel Corporation
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#ifndef __ILIBDUKTAPE_SHELLPOOL__
+#define __ILIBDUKTAPE_SHELLPOOL__
+
+#include "duktape.h"
+
+#ifdef __DOXY__
+/*!
+\brief Runs short shell scripts on a small pool of warm /bin/sh processes, instead of spawning a new shell for every command. <b>Note:</b> To use, must <b>require('ShellPool')</b>
+*
+Each script runs in a subshell of a pooled shell, with stdin redirected from /dev/null, so variables, cd and exit don't leak into the next request.
+<br>A shell that times out, dies, or breaks the request framing is killed (along with its process group) and replaced on the next request. Shells are also replaced after 256 requests.
+*/
+class ShellPool
+{
+public:
+	/*!
+	\brief Number of warm shells to keep (1 - 8). Default is 2
+	*/
+	Number size;
+	/*!
+	\brief Runs a script, and blocks until it finishes
+	\param script \<String\> Shell script
+	\param options <Object> Optional, with the following property:\n
+	<b>timeout</b> \<Number\> Milliseconds before the request is abandoned and the shell is recycled. Default is 30000\n
+	\return {stdout, stderr, code}. code is the exit status of the script, or null if it timed out (in which case timedOut is true) or the shell failed
+	*/
+	Object run(script[, options]);
+	/*!
+	\brief Runs a script on the next free shell, without blocking
+	\param script \<String\> Shell script
+	\param options <Object> Optional, same as run()
+	\return Promise that resolves to the same object that run() returns
+	*/
+	Promise exec(script[, options]);
+	/*!
+	\brief Terminates all of the pooled shells. Pending exec() requests are resolved as failed
+	*/
+	void close();
+};
+#endif
+
+void ILibDuktape_ShellPool_Init(duk_context *ctx);
+
+#endif
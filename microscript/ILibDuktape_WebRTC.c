@@ -218,6 +218,23 @@ duk_ret_t ILibDuktape_WebRTC_DataChannel_MaxFragmentSize_GETTER(duk_context *ctx
 	duk_push_int(ctx, ptrs->maxFragmentSize);
 	return(1);
 }
+duk_ret_t ILibDuktape_WebRTC_DataChannel_Priority_SETTER(duk_context *ctx)
+{
+	int priority = duk_require_int(ctx, 0);
+	duk_push_this(ctx);
+	ILibDuktape_WebRTC_DataChannel *ptrs = (ILibDuktape_WebRTC_DataChannel*)Duktape_GetBufferProperty(ctx, -1, ILibDuktape_WebRTC_DataChannelPtr);
+	if (priority < 1 || priority > 0xFFFF) { return(ILibDuktape_Error(ctx, "Invalid Priority: %d", priority)); }
+	if (ptrs == NULL || ptrs->dataChannel == NULL) { return(ILibDuktape_Error(ctx, "DataChannel Closed")); }
+	ILibWrapper_WebRTC_DataChannel_SetPriority(ptrs->dataChannel, (unsigned short)priority);
+	return(0);
+}
+duk_ret_t ILibDuktape_WebRTC_DataChannel_Priority_GETTER(duk_context *ctx)
+{
+	duk_push_this(ctx);
+	ILibDuktape_WebRTC_DataChannel *ptrs = (ILibDuktape_WebRTC_DataChannel*)Duktape_GetBufferProperty(ctx, -1, ILibDuktape_WebRTC_DataChannelPtr);
+	duk_push_int(ctx, (ptrs == NULL || ptrs->dataChannel == NULL) ? 1 : ILibWrapper_WebRTC_DataChannel_GetPriority(ptrs->dataChannel));
+	return(1);
+}
 void ILibDuktape_WebRTC_DataChannel_PUSH(duk_context *ctx, ILibWrapper_WebRTC_DataChannel *dataChannel)
 {
 	if (dataChannel == NULL) { duk_push_null(ctx); return; }
@@ -248,6 +265,7 @@ void ILibDuktape_WebRTC_DataChannel_PUSH(duk_context *ctx, ILibWrapper_WebRTC_Da
 	ptrs->stream = ILibDuktape_DuplexStream_Init(ctx, ILibDuktape_WebRTC_DataChannel_Stream_WriteSink, ILibDuktape_WebRTC_DataChannel_Stream_EndSink,
 		ILibDuktape_WebRTC_DataChannel_Stream_PauseSink, ILibDuktape_WebRTC_DataChannel_Stream_ResumeSink, ptrs);
 	ILibDuktape_CreateEventWithGetterAndSetterEx(ctx, "maxFragmentSize", ILibDuktape_WebRTC_DataChannel_MaxFragmentSize_GETTER, ILibDuktape_WebRTC_DataChannel_MaxFragmentSize_SETTER);
+	ILibDuktape_CreateEventWithGetterAndSetterEx(ctx, "priority", ILibDuktape_WebRTC_DataChannel_Priority_GETTER, ILibDuktape_WebRTC_DataChannel_Priority_SETTER);
 }
 
 duk_ret_t ILibDuktape_WebRTC_ConnectionFactory_Finalizer(duk_context *ctx)
@@ -490,6 +508,44 @@ duk_ret_t ILibDuktape_WebRTC_closeDataChannels(duk_context *ctx)
 	ILibWrapper_WebRTC_Connection_CloseAllDataChannels(connection);
 	return 0;
 }
+int ILibDuktape_WebRTC_GetCongestionControl(duk_context *ctx, duk_idx_t i, ILibSCTP_CongestionControl *cc)
+{
+	char *name = (char*)duk_require_string(ctx, i);
+	if (strcmp(name, "reno") == 0) { *cc = ILibSCTP_CongestionControl_RENO; return(0); }
+	if (strcmp(name, "cubic") == 0) { *cc = ILibSCTP_CongestionControl_CUBIC; return(0); }
+	return(1);
+}
+duk_ret_t ILibDuktape_WebRTC_Connection_setCongestionControl(duk_context *ctx)
+{
+	ILibWrapper_WebRTC_Connection connection = ILibDuktape_WebRTC_Native_GetConnection(ctx);
+	ILibSCTP_CongestionControl cc;
+	void *session;
+
+	if (ILibDuktape_WebRTC_GetCongestionControl(ctx, 0, &cc) != 0) { return(ILibDuktape_Error(ctx, "Unknown Congestion Control: %s", duk_get_string(ctx, 0))); }
+	if (connection == NULL || ILibWrapper_WebRTC_Connection_IsConnected(connection) == 0 || (session = ILibWrapper_WebRTC_Connection2DtlsSession(connection)) == NULL)
+	{
+		return(ILibDuktape_Error(ctx, "Not Connected"));
+	}
+
+	ILibSCTP_SetCongestionControl(session, cc);
+	if (duk_is_number(ctx, 1)) { ILibSCTP_SetMinRTO(session, duk_require_int(ctx, 1)); }
+	return(0);
+}
+duk_ret_t ILibDuktape_WebRTC_Connection_interleaved(duk_context *ctx)
+{
+	ILibWrapper_WebRTC_Connection connection = ILibDuktape_WebRTC_Native_GetConnection(ctx);
+	void *session;
+
+	if (connection == NULL || ILibWrapper_WebRTC_Connection_IsConnected(connection) == 0 || (session = ILibWrapper_WebRTC_Connection2DtlsSession(connection)) == NULL)
+	{
+		duk_push_false(ctx);
+	}
+	else
+	{
+		duk_push_boolean(ctx, ILibSCTP_IsInterleavingSupported(session));
+	}
+	return(1);
+}
 duk_ret_t ILibDuktape_WebRTC_Connection_Finalizer(duk_context *ctx)
 {
 	ILibWrapper_WebRTC_Connection connection;
@@ -593,10 +649,32 @@ duk_ret_t ILibDuktape_WebRTC_CreateConnection(duk_context *ctx)
 	ILibDuktape_CreateInstanceMethod(ctx, "createDataChannel", ILibDuktape_WebRTC_createDataChannel, DUK_VARARGS);
 	ILibDuktape_CreateInstanceMethod(ctx, "closeDataChannels", ILibDuktape_WebRTC_closeDataChannels, 0);
 	ILibDuktape_CreateInstanceMethod(ctx, "addRemoteCandidate", ILibDuktape_WebRTC_addRemoteCandidate, 1);
+	ILibDuktape_CreateInstanceMethod(ctx, "setCongestionControl", ILibDuktape_WebRTC_Connection_setCongestionControl, DUK_VARARGS);
+	ILibDuktape_CreateEventWithGetter(ctx, "interleaved", ILibDuktape_WebRTC_Connection_interleaved);
 	ILibDuktape_CreateFinalizer(ctx, ILibDuktape_WebRTC_Connection_Finalizer);
 
 	return 1;
 }
+duk_ret_t ILibDuktape_WebRTC_ConnectionFactory_setCongestionControl(duk_context *ctx)
+{
+	ILibSCTP_CongestionControl cc;
+	if (ILibDuktape_WebRTC_GetCongestionControl(ctx, 0, &cc) != 0) { return(ILibDuktape_Error(ctx, "Unknown Congestion Control: %s", duk_get_string(ctx, 0))); }
+
+	duk_push_this(ctx);																	// [factory]
+	ILibWrapper_WebRTC_ConnectionFactory_SetCongestionControl(Duktape_GetPointerProperty(ctx, -1, ILibDuktape_WebRTC_ConnectionFactoryPtr), cc);
+	return(0);
+}
+#ifdef _WEBRTCDEBUG
+duk_ret_t ILibDuktape_WebRTC_ConnectionFactory_setSimulatedLoss(duk_context *ctx)
+{
+	int percent = duk_require_int(ctx, 0);
+	unsigned int seed = duk_get_top(ctx) > 1 ? (unsigned int)duk_require_uint(ctx, 1) : 0;
+
+	duk_push_this(ctx);																	// [factory]
+	ILibWrapper_WebRTC_ConnectionFactory_SetSimulatedLossPercentageEx(Duktape_GetPointerProperty(ctx, -1, ILibDuktape_WebRTC_ConnectionFactoryPtr), percent, seed);
+	return(0);
+}
+#endif
 duk_ret_t ILibDuktape_WebRTC_newFactory(duk_context *ctx)
 {
 	ILibWrapper_WebRTC_ConnectionFactory factory;
@@ -617,6 +695,10 @@ duk_ret_t ILibDuktape_WebRTC_newFactory(duk_context *ctx)
 	ILibDuktape_CreateFinalizer(ctx, ILibDuktape_WebRTC_ConnectionFactory_Finalizer);
 
 	ILibDuktape_CreateInstanceMethod(ctx, "createConnection", ILibDuktape_WebRTC_CreateConnection, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "setCongestionControl", ILibDuktape_WebRTC_ConnectionFactory_setCongestionControl, 1);
+#ifdef _WEBRTCDEBUG
+	ILibDuktape_CreateInstanceMethod(ctx, "_setSimulatedLoss", ILibDuktape_WebRTC_ConnectionFactory_setSimulatedLoss, DUK_VARARGS);
+#endif
 	return(1);
 }
 void ILibDuktape_WebRTC_Push(duk_context *ctx, void *chain)
@@ -640,6 +722,10 @@ void ILibDuktape_WebRTC_Push(duk_context *ctx, void *chain)
 
 	ILibDuktape_CreateInstanceMethod(ctx, "createConnection", ILibDuktape_WebRTC_CreateConnection, 0);
 	ILibDuktape_CreateInstanceMethod(ctx, "createNewFactory", ILibDuktape_WebRTC_newFactory, 0);
+	ILibDuktape_CreateInstanceMethod(ctx, "setCongestionControl", ILibDuktape_WebRTC_ConnectionFactory_setCongestionControl, 1);
+#ifdef _WEBRTCDEBUG
+	ILibDuktape_CreateInstanceMethod(ctx, "_setSimulatedLoss", ILibDuktape_WebRTC_ConnectionFactory_setSimulatedLoss, DUK_VARARGS);
+#endif
 
 }
 void ILibDuktape_WebRTC_Init(duk_context * ctx)
@@ -666,6 +752,11 @@ public:
 	\return <Connection> Unconnected Connection
 	*/
 	static Connection createConnection();
+	/*!
+	\brief Sets the Congestion Controller used by Connections created after this call
+	\param name \<String\> 'reno' (Default) or 'cubic'
+	*/
+	static void setCongestionControl(name);
 
 	/*!
 	\implements EventEmitter
@@ -717,6 +808,16 @@ public:
 		\brief Closes all DataChannel instances associated with this Connection.
 		*/
 		void closeDataChannels();
+		/*!
+		\brief Changes the Congestion Controller of a connected peer Connection
+		\param name \<String\> 'reno' or 'cubic'
+		\param minRTO <integer> Optional. If specified, sets the minimum retransmission timeout in milliseconds
+		*/
+		void setCongestionControl(name[, minRTO]);
+		/*!
+		\brief true, if the peer negotiated I-DATA, so messages on different DataChannels are interleaved (RFC 8260)
+		*/
+		boolean interleaved;
 		ILibDuktape_CreateInstanceMethod(ctx, "addRemoteCandidate", ILibDuktape_WebRTC_addRemoteCandidate, 1);
 	};
 	/*!
@@ -736,6 +837,11 @@ public:
 		*/
 		String name;
 		/*!
+		\brief Scheduling weight of this DataChannel. When the connection is congested, each DataChannel with queued data
+		may send this many chunks before yielding to the next one. (Default is 1)
+		*/
+		integer priority;
+		/*!
 		\brief Event emitted when the connected peer ACK's this DataChannel creation
 		*/
 		void ack;
@@ -262,6 +262,7 @@ duk_ret_t ILibDuktape_WritableStream_End(duk_context *ctx)
 	{
 		// Continue with closing stream
 		if (stream->EndSink != NULL) { stream->EndSink(stream, stream->WriteSink_User); }		
+		if (stream->WaitForEnd != 0) { return(0); }		// EndSink is still flushing, and will call ILibDuktape_WritableStream_Ready() when done
 		
 		duk_push_heapptr(stream->ctx, stream->obj);						// [stream]
 		duk_get_prop_string(stream->ctx, -1, "emit");					// [stream][emit]
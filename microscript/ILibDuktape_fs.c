@@ -42,6 +42,7 @@ limitations under the License.
 
 #ifdef _POSIX
 #include <sys/stat.h>
+#include <fcntl.h>
 #if !defined(_NOFSWATCHER) && !defined(__APPLE__) && !defined(_FREEBSD)
 	#include <sys/inotify.h>
 #endif
@@ -62,7 +63,11 @@ limitations under the License.
 #define FS_READSTREAM		"\xFF_ReadStream"
 #define FS_READSTREAM_2FS	"\xFF_ReadStream2FS"
 #define FS_READSTREAM_BUFFERSIZE	4096
+#define FS_READFILE_INITIALSIZE		4096
+#define FS_READFILE_SEQUENTIALSIZE	1048576
 #define FS_STAT_METHOD_RETVAL		"\xFF_RetVal"
+#define FS_DIR_PTR					"\xFF_FSDirPtr"
+#define FS_READDIR_BATCHSIZE		256
 #define FS_WATCHER_DATA_PTR			"\xFF_FSWatcherPtr"
 #define FS_WATCHER_2_FS				"\xFF_FSWatcher2FS"
 #define FS_PIPEMANAGER_PTR			"\xFF_FSWatcher_PipeMgrPtr"
@@ -79,6 +84,9 @@ limitations under the License.
 #define FS_WINDOWS_UserBuffer		"\xFF_FSWindowsHandles_UserBuffer"
 #define FS_WINDOWS_WriteUserBuffer	"\xFF_FSWindowsHandles_WriteUserBuffer"
 #define FS_BUFFER_DESCRIPTOR_PENDING "\xFF_FS_BUFFER_DESCRIPTOR_PENDING"
+#define FS_IOSERVICE_PTR			"\xFF_FS_IOSERVICE_PTR"
+#define FS_IO_THREADS				2
+#define FS_IO_BUFFERSIZE			65536
 
 #if defined(_POSIX) && !defined(__APPLE__)
 typedef struct ILibDuktape_fs_linuxWatcher
@@ -115,6 +123,58 @@ typedef struct ILibDuktape_fs_appleWatcher
 }ILibDuktape_fs_appleWatcher;
 #endif
 
+#ifdef _POSIX
+typedef enum ILibDuktape_fs_ioState
+{
+	ILibDuktape_fs_ioState_IDLE = 0,
+	ILibDuktape_fs_ioState_PENDING = 1,
+	ILibDuktape_fs_ioState_READY = 2
+}ILibDuktape_fs_ioState;
+
+struct ILibDuktape_fs_ioJob;
+typedef void(*ILibDuktape_fs_ioJob_Handler)(struct ILibDuktape_fs_ioJob *job);
+
+// Worker threads that do blocking file I/O for fs streams, so a slow disk or network file system doesn't stall the event loop
+typedef struct ILibDuktape_fs_ioService
+{
+	ILibQueue jobs;
+	sem_t workAvailable;
+	int exit;
+	void *threads[FS_IO_THREADS];
+}ILibDuktape_fs_ioService;
+
+typedef struct ILibDuktape_fs_ioJob
+{
+	void *chain;
+	duk_context *ctx;
+	uintptr_t nonce;
+	void *user;								// Stream that owns this job, or NULL if the stream was collected while the job was in flight
+	ILibDuktape_fs_ioJob_Handler handler;	// Dispatched on the chain thread, when the job completes
+	struct ILibDuktape_fs_ioJob *next;		// Next queued write
+	int fd;									// Private duplicate of the stream's descriptor, so closeSync() can't close it from under the worker
+	int write;
+	ILibDuktape_fs_ioState state;
+	int stale;								// Read was issued at an offset that is no longer valid, so the result is discarded
+	uint64_t offset;
+	size_t length;
+	ssize_t result;
+	int error;
+	char *buffer;
+}ILibDuktape_fs_ioJob;
+#endif
+
+typedef struct ILibDuktape_fs_dirData
+{
+#ifdef WIN32
+	HANDLE h;
+	WIN32_FIND_DATAW data;
+	int pending;						// data holds an entry that hasn't been returned yet
+#else
+	DIR *d;
+#endif
+	int stat;
+}ILibDuktape_fs_dirData;
+
 typedef struct ILibDuktape_fs_writeStreamData
 {
 	duk_context *ctx;					// Duktape Context Object
@@ -125,6 +185,11 @@ typedef struct ILibDuktape_fs_writeStreamData
 	int fd;								// descriptor
 	int autoClose;
 	ILibDuktape_WritableStream *stream;
+#ifdef _POSIX
+	ILibDuktape_fs_ioService *ioService;	// Set if writes are done by the I/O service
+	ILibDuktape_fs_ioJob *ioHead;			// Queued writes, ioHead is the one in flight
+	ILibDuktape_fs_ioJob *ioTail;
+#endif
 }ILibDuktape_fs_writeStreamData;
 
 typedef struct ILibDuktape_fs_readStreamData
@@ -141,6 +206,14 @@ typedef struct ILibDuktape_fs_readStreamData
 	int bytesLeft;							// Number of bytes left
 	int readLoopActive;						// Event Dispatch thread is actively reading
 	int unshiftedBytes;						// Number of bytes to mark as unread
+#ifdef _POSIX
+	ILibDuktape_fs_ioService *ioService;	// Set if reads are done by the I/O service
+	ILibDuktape_fs_ioJob *io[2];			// Read-ahead blocks. io[ioIndex] is the next one to be delivered
+	int ioIndex;
+	int ioEnded;
+	uint64_t ioPosition;					// Offset of the next block to read ahead
+	int64_t ioEnd;							// Offset to stop reading at, or -1 to read until EOF
+#endif
 	char buffer[FS_READSTREAM_BUFFERSIZE];
 }ILibDuktape_fs_readStreamData;
 
@@ -1034,6 +1107,185 @@ int ILibduktape_fs_CloseFD(duk_context *ctx, void *fs, int fd)
 	return retVal;
 }
 
+#ifdef _POSIX
+void ILibDuktape_fs_ioJob_Free(ILibDuktape_fs_ioJob *job)
+{
+	if (job->fd >= 0) { close(job->fd); }
+	ILibMemory_Free(job);
+}
+
+// Completion, dispatched on the chain thread
+void ILibDuktape_fs_ioJob_Complete(void *chain, void *user)
+{
+	ILibDuktape_fs_ioJob *job = (ILibDuktape_fs_ioJob*)user;
+	job->state = ILibDuktape_fs_ioState_READY;
+	if (job->user == NULL) { ILibDuktape_fs_ioJob_Free(job); return; }
+	job->handler(job);
+}
+
+// The context went away before the completion could be dispatched, so don't call into JavaScript
+void ILibDuktape_fs_ioJob_Abort(void *chain, void *user)
+{
+	ILibDuktape_fs_ioJob *job = (ILibDuktape_fs_ioJob*)user;
+	job->state = ILibDuktape_fs_ioState_IDLE;
+	if (job->user == NULL) { ILibDuktape_fs_ioJob_Free(job); }
+}
+
+void ILibDuktape_fs_ioService_WorkerLoop(void *arg)
+{
+	ILibDuktape_fs_ioService *service = (ILibDuktape_fs_ioService*)arg;
+	ILibDuktape_fs_ioJob *job;
+	ssize_t bytes;
+
+	while (1)
+	{
+		sem_wait(&(service->workAvailable));
+		if (service->exit != 0) { break; }
+
+		ILibQueue_Lock(service->jobs);
+		job = (ILibDuktape_fs_ioJob*)ILibQueue_DeQueue(service->jobs);
+		ILibQueue_UnLock(service->jobs);
+		if (job == NULL) { continue; }
+
+		job->error = 0;
+		if (job->write != 0)
+		{
+			// Writes use the shared file position, the same as fwrite() did, and are issued one at a time per stream
+			job->result = 0;
+			while ((size_t)job->result < job->length)
+			{
+				bytes = write(job->fd, job->buffer + job->result, job->length - (size_t)job->result);
+				if (bytes < 0 && errno == EINTR) { continue; }
+				if (bytes <= 0) { job->error = errno; job->result = -1; break; }
+				job->result += bytes;
+			}
+		}
+		else
+		{
+			do
+			{
+				job->result = pread(job->fd, job->buffer, job->length, (off_t)job->offset);
+			} while (job->result < 0 && errno == EINTR);
+			if (job->result < 0) { job->error = errno; }
+		}
+		Duktape_RunOnEventLoop(job->chain, job->nonce, job->ctx, ILibDuktape_fs_ioJob_Complete, ILibDuktape_fs_ioJob_Abort, job);
+	}
+}
+
+// Fetches the I/O service for this 'fs' object, starting the worker threads the first time
+ILibDuktape_fs_ioService* ILibDuktape_fs_ioService_Get(duk_context *ctx, void *fs)
+{
+	ILibDuktape_fs_ioService *service;
+	int i;
+
+	duk_push_heapptr(ctx, fs);												// [fs]
+	service = (ILibDuktape_fs_ioService*)Duktape_GetPointerProperty(ctx, -1, FS_IOSERVICE_PTR);
+	if (service == NULL)
+	{
+		if ((service = (ILibDuktape_fs_ioService*)ILibMemory_SmartAllocate(sizeof(ILibDuktape_fs_ioService))) == NULL) { ILIBCRITICALEXIT(254); }
+		service->jobs = ILibQueue_Create();
+		sem_init(&(service->workAvailable), 0, 0);
+		for (i = 0; i < FS_IO_THREADS; ++i)
+		{
+			service->threads[i] = ILibSpawnNormalThreadEx(ILibDuktape_fs_ioService_WorkerLoop, service, 0);
+		}
+		duk_push_pointer(ctx, service);										// [fs][ptr]
+		duk_put_prop_string(ctx, -2, FS_IOSERVICE_PTR);						// [fs]
+	}
+	duk_pop(ctx);															// ...
+	return(service);
+}
+
+// Called from the fs finalizer. Queued jobs that haven't started are handed back to their streams, or freed if the stream is already gone
+void ILibDuktape_fs_ioService_Destroy(ILibDuktape_fs_ioService *service)
+{
+	ILibDuktape_fs_ioJob *job;
+	int i;
+
+	service->exit = 1;
+	for (i = 0; i < FS_IO_THREADS; ++i) { sem_post(&(service->workAvailable)); }
+	for (i = 0; i < FS_IO_THREADS; ++i) { if (service->threads[i] != NULL) { ILibThread_Join(service->threads[i]); } }
+	while ((job = (ILibDuktape_fs_ioJob*)ILibQueue_DeQueue(service->jobs)) != NULL)
+	{
+		ILibDuktape_fs_ioJob_Abort(NULL, job);
+	}
+	ILibQueue_Destroy(service->jobs);
+	sem_destroy(&(service->workAvailable));
+	ILibMemory_Free(service);
+}
+
+ILibDuktape_fs_ioJob* ILibDuktape_fs_ioJob_New(duk_context *ctx, int fd, size_t bufferSize, ILibDuktape_fs_ioJob_Handler handler, void *user)
+{
+	ILibDuktape_fs_ioJob *job;
+	if ((job = (ILibDuktape_fs_ioJob*)ILibMemory_SmartAllocateEx(sizeof(ILibDuktape_fs_ioJob), bufferSize)) == NULL) { ILIBCRITICALEXIT(254); }
+	if ((job->fd = fcntl(fd, F_DUPFD_CLOEXEC, 0)) < 0)
+	{
+		ILibMemory_Free(job);
+		return(NULL);
+	}
+	job->chain = duk_ctx_chain(ctx);
+	job->ctx = ctx;
+	job->nonce = duk_ctx_nonce(ctx);
+	job->handler = handler;
+	job->user = user;
+	job->buffer = ILibMemory_Extra(job);
+	return(job);
+}
+
+void ILibDuktape_fs_ioService_Submit(ILibDuktape_fs_ioService *service, ILibDuktape_fs_ioJob *job)
+{
+	job->state = ILibDuktape_fs_ioState_PENDING;
+	ILibQueue_Lock(service->jobs);
+	ILibQueue_EnQueue(service->jobs, job);
+	ILibQueue_UnLock(service->jobs);
+	sem_post(&(service->workAvailable));
+}
+
+// Hands a job back to its stream. If it's still in flight, the completion frees it instead
+void ILibDuktape_fs_ioJob_Release(ILibDuktape_fs_ioJob *job)
+{
+	if (job->state == ILibDuktape_fs_ioState_PENDING)
+	{
+		job->user = NULL;
+	}
+	else
+	{
+		ILibDuktape_fs_ioJob_Free(job);
+	}
+}
+
+// A queued write completed, so start the next one, or signal the writable that it can accept more data
+void ILibDuktape_fs_writeStream_ioDone(ILibDuktape_fs_ioJob *job)
+{
+	ILibDuktape_fs_writeStreamData *data = (ILibDuktape_fs_writeStreamData*)job->user;
+	int error = job->result < 0 ? job->error : 0;
+
+	data->ioHead = job->next;
+	if (data->ioHead == NULL) { data->ioTail = NULL; }
+	ILibDuktape_fs_ioJob_Free(job);
+
+	if (error != 0)
+	{
+		duk_push_heapptr(data->ctx, data->WriteStreamObject);							// [stream]
+		duk_get_prop_string(data->ctx, -1, "emit");										// [stream][emit]
+		duk_swap_top(data->ctx, -2);													// [emit][this]
+		duk_push_string(data->ctx, "error");											// [emit][this][error]
+		duk_push_error_object(data->ctx, DUK_ERR_ERROR, "fs.writeStream: Write Error [%d]", error);
+		if (duk_pcall_method(data->ctx, 2) != 0) { ILibDuktape_Process_UncaughtException(data->ctx); }
+		duk_pop(data->ctx);																// ...
+	}
+
+	if (data->ioHead != NULL)
+	{
+		ILibDuktape_fs_ioService_Submit(data->ioService, data->ioHead);
+	}
+	else
+	{
+		ILibDuktape_WritableStream_Ready(data->stream);
+	}
+}
+#endif
+
 // Write handler called by stream.Writable.write()
 ILibTransport_DoneState ILibDuktape_fs_writeStream_writeHandler(struct ILibDuktape_WritableStream *stream, char *buffer, int bufferLen, void *user)
 {
@@ -1041,6 +1293,28 @@ ILibTransport_DoneState ILibDuktape_fs_writeStream_writeHandler(struct ILibDukta
 	int bytesWritten = 0;
 	ILibTransport_DoneState retVal = ILibTransport_DoneState_ERROR;
 
+#ifdef _POSIX
+	if (data->ioService != NULL && data->fPtr != NULL)
+	{
+		// The data is copied, and queued behind any writes that are still in flight
+		ILibDuktape_fs_ioJob *job = ILibDuktape_fs_ioJob_New(data->ctx, fileno(data->fPtr), (size_t)bufferLen, ILibDuktape_fs_writeStream_ioDone, data);
+		if (job == NULL) { return(ILibTransport_DoneState_ERROR); }
+		memcpy_s(job->buffer, (size_t)bufferLen, buffer, (size_t)bufferLen);
+		job->length = (size_t)bufferLen;
+		job->write = 1;
+		if (data->ioTail == NULL)
+		{
+			data->ioHead = data->ioTail = job;
+			ILibDuktape_fs_ioService_Submit(data->ioService, job);
+		}
+		else
+		{
+			data->ioTail->next = job;
+			data->ioTail = job;
+		}
+		return(ILibTransport_DoneState_INCOMPLETE);
+	}
+#endif
 	if (data->fPtr != NULL)
 	{
 		bytesWritten = (int)fwrite(buffer, 1, bufferLen, data->fPtr);
@@ -1056,6 +1330,14 @@ ILibTransport_DoneState ILibDuktape_fs_writeStream_writeHandler(struct ILibDukta
 void ILibDuktape_fs_writeStream_endHandler(struct ILibDuktape_WritableStream *stream, void *user)
 {
 	ILibDuktape_fs_writeStreamData *data = (ILibDuktape_fs_writeStreamData*)user;
+#ifdef _POSIX
+	if (data->ioHead != NULL)
+	{
+		// Writes are still in flight, so finish when they are done. ILibDuktape_WritableStream_Ready() will call us again
+		stream->WaitForEnd = 1;
+		return;
+	}
+#endif
 	sprintf_s(ILibScratchPad, sizeof(ILibScratchPad), "%d", data->fd);
 
 	// If AutoClose is specified, then when the stream is ended, we will close the descriptor
@@ -1087,6 +1369,16 @@ duk_ret_t ILibDuktape_fs_writeStream_finalizer(duk_context *ctx)
 	duk_get_prop_string(ctx, 0, FS_WRITESTREAM);
 	data = (ILibDuktape_fs_writeStreamData*)Duktape_GetBuffer(ctx, -1, NULL);
 
+#ifdef _POSIX
+	while (data->ioHead != NULL)
+	{
+		ILibDuktape_fs_ioJob *job = data->ioHead;
+		data->ioHead = job->next;
+		ILibDuktape_fs_ioJob_Release(job);
+	}
+	data->ioTail = NULL;
+#endif
+
 	// If AutoClose was specified, then the descriptor will be explicitely closed
 	if (data->autoClose != 0 && data->fPtr != NULL)
 	{
@@ -1116,6 +1408,7 @@ duk_ret_t ILibDuktape_fs_createWriteStream(duk_context *ctx)
 	FILE *f;
 	ILibDuktape_fs_writeStreamData *data;
 	int autoClose = 1;
+	int async = 0;
 
 	if (nargs > 1)
 	{
@@ -1135,6 +1428,7 @@ duk_ret_t ILibDuktape_fs_createWriteStream(duk_context *ctx)
 			duk_get_prop_string(ctx, 1, "autoClose");
 			autoClose = (int)duk_get_boolean(ctx, -1);
 		}
+		async = Duktape_GetBooleanProperty(ctx, 1, "async", 0);
 	}
 
 	if (fd == 0)
@@ -1164,6 +1458,22 @@ duk_ret_t ILibDuktape_fs_createWriteStream(duk_context *ctx)
 		data->WriteStreamObject = duk_get_heapptr(ctx, -1);
 		data->emitter = ILibDuktape_EventEmitter_Create(ctx);
 		data->stream = ILibDuktape_WritableStream_Init(ctx, ILibDuktape_fs_writeStream_writeHandler, ILibDuktape_fs_writeStream_endHandler, data);
+#ifdef _POSIX
+		if (async != 0)
+		{
+			// Only regular files are handed to the I/O service. A write to a pipe could block a worker indefinitely
+			struct stat info;
+			if (fstat(fileno(f), &info) == 0 && S_ISREG(info.st_mode))
+			{
+				fflush(f);
+				duk_push_this(ctx);												// [writeStream][fs]
+				data->ioService = ILibDuktape_fs_ioService_Get(ctx, duk_get_heapptr(ctx, -1));
+				duk_pop(ctx);													// [writeStream]
+			}
+		}
+#else
+		UNREFERENCED_PARAMETER(async);
+#endif
 
 		ILibDuktape_EventEmitter_CreateEventEx(data->emitter, "close");
 		ILibDuktape_CreateFinalizer(ctx, ILibDuktape_fs_writeStream_finalizer);
@@ -1181,6 +1491,122 @@ void ILibDuktape_fs_readStream_Pause(struct ILibDuktape_readableStream *sender,
 	sender->paused = 1;
 }
 
+// Delivers a block to the readable. If the consumer unshift()s part of it, the remainder is delivered again
+void ILibDuktape_fs_readStream_Deliver(struct ILibDuktape_readableStream *sender, ILibDuktape_fs_readStreamData *data, char *buffer, int bufferLen)
+{
+	data->unshiftedBytes = 0;
+	do
+	{
+		int preshift = data->unshiftedBytes == 0 ? bufferLen : data->unshiftedBytes;
+		ILibDuktape_readableStream_WriteData(sender, buffer, data->unshiftedBytes>0 ? data->unshiftedBytes : bufferLen);
+		if (data->unshiftedBytes > 0 && data->unshiftedBytes != preshift) { memmove(buffer, buffer + (preshift - data->unshiftedBytes), data->unshiftedBytes); }
+	} while (data->unshiftedBytes != 0 && data->unshiftedBytes != bufferLen);
+	data->unshiftedBytes = 0;
+}
+
+// Signals the end of the stream, and closes the descriptor if autoClose was specified
+void ILibDuktape_fs_readStream_End(struct ILibDuktape_readableStream *sender, ILibDuktape_fs_readStreamData *data)
+{
+	ILibDuktape_readableStream_WriteEnd(sender);
+
+	if (data->autoClose != 0 && data->fPtr != NULL)
+	{
+		if (ILibduktape_fs_CloseFD(data->ctx, data->fsObject, data->fd) != 0)
+		{
+			ILibDuktape_Process_UncaughtExceptionEx(data->ctx, "fs.readStream._CloseFD(): Error closing FD: %d", data->fd);
+		}
+		data->fd = 0;
+		data->fPtr = NULL;
+
+		if (data->ctx != NULL && data->ReadStreamObject != NULL)
+		{
+			duk_push_heapptr(data->ctx, data->ReadStreamObject);					// [this]
+			duk_get_prop_string(data->ctx, -1, "emit");								// [this][emit]
+			duk_swap_top(data->ctx, -2);											// [emit][this]
+			duk_push_string(data->ctx, "close");									// [emit][this][close]
+			if (duk_pcall_method(data->ctx, 1) != 0) { ILibDuktape_Process_UncaughtException(data->ctx); }
+			duk_pop(data->ctx);														// ...
+		}
+	}
+}
+
+#ifdef _POSIX
+void ILibDuktape_fs_readStream_ReleaseIO(ILibDuktape_fs_readStreamData *data)
+{
+	int i;
+	for (i = 0; i < 2; ++i)
+	{
+		if (data->io[i] != NULL) { ILibDuktape_fs_ioJob_Release(data->io[i]); data->io[i] = NULL; }
+	}
+}
+
+//
+// Processing loop when the file is read by the I/O service. Both blocks are kept reading ahead, in file order, 
+// while the consumer processes the one before them. Nothing new is delivered while the stream is paused.
+//
+void ILibDuktape_fs_readStream_Pump(ILibDuktape_fs_readStreamData *data)
+{
+	ILibDuktape_fs_ioJob *job, *next;
+	int i;
+
+	if (data->readLoopActive != 0 || data->ioEnded != 0) { return; }
+	data->readLoopActive = 1;
+
+	while (1)
+	{
+		for (i = 0; i < 2; ++i)
+		{
+			job = data->io[(data->ioIndex + i) % 2];
+			if (job->stale != 0) { break; }			// Anything read after a discarded block would be out of order
+			if (job->state == ILibDuktape_fs_ioState_IDLE && (data->ioEnd < 0 || data->ioPosition < (uint64_t)data->ioEnd))
+			{
+				job->offset = data->ioPosition;
+				job->length = FS_IO_BUFFERSIZE;
+				if (data->ioEnd >= 0 && (uint64_t)data->ioEnd - data->ioPosition < job->length) { job->length = (size_t)((uint64_t)data->ioEnd - data->ioPosition); }
+				data->ioPosition += job->length;
+				ILibDuktape_fs_ioService_Submit(data->ioService, job);
+			}
+		}
+
+		job = data->io[data->ioIndex];
+		if (data->stream->paused != 0 || job->state == ILibDuktape_fs_ioState_PENDING) { break; }
+		if (job->state == ILibDuktape_fs_ioState_IDLE || job->result <= 0)
+		{
+			// The requested range has been read, or we reached EOF (read errors are treated the same as the synchronous path)
+			data->ioEnded = 1;
+			ILibDuktape_fs_readStream_ReleaseIO(data);
+			ILibDuktape_fs_readStream_End(data->stream, data);
+			return;
+		}
+		if ((size_t)job->result < job->length)
+		{
+			// Short read, so the block after this one was read from the wrong offset. Read ahead again from where this one stopped
+			next = data->io[data->ioIndex ^ 1];
+			if (next->state == ILibDuktape_fs_ioState_READY) { next->state = ILibDuktape_fs_ioState_IDLE; }
+			if (next->state == ILibDuktape_fs_ioState_PENDING) { next->stale = 1; }
+			data->ioPosition = job->offset + (uint64_t)job->result;
+		}
+		data->ioIndex ^= 1;
+		ILibDuktape_fs_readStream_Deliver(data->stream, data, job->buffer, (int)job->result);
+		if (!ILibMemory_CanaryOK(data)) { return; }
+		job->state = ILibDuktape_fs_ioState_IDLE;
+	}
+	data->readLoopActive = 0;
+}
+
+// A read-ahead block completed
+void ILibDuktape_fs_readStream_ioDone(ILibDuktape_fs_ioJob *job)
+{
+	ILibDuktape_fs_readStreamData *data = (ILibDuktape_fs_readStreamData*)job->user;
+	if (job->stale != 0)
+	{
+		job->stale = 0;
+		job->state = ILibDuktape_fs_ioState_IDLE;
+	}
+	if (data->stream->paused == 0) { ILibDuktape_fs_readStream_Pump(data); }
+}
+#endif
+
 //
 // The stream.resume() contains the main processing loop.
 //
@@ -1191,6 +1617,15 @@ void ILibDuktape_fs_readStream_Resume(struct ILibDuktape_readableStream *sender,
 	ILibDuktape_fs_readStreamData *data = (ILibDuktape_fs_readStreamData*)user;
 	int bytesToRead;
 
+#ifdef _POSIX
+	if (data->ioService != NULL)
+	{
+		sender->paused = 0;
+		ILibDuktape_fs_readStream_Pump(data);
+		return;
+	}
+#endif
+
 	// If this is set, it means this thread is trying to re-enter this processing loop
 	if (data->readLoopActive != 0) { return; }
 	data->readLoopActive = 1;
@@ -1201,46 +1636,19 @@ void ILibDuktape_fs_readStream_Resume(struct ILibDuktape_readableStream *sender,
 	while (sender->paused == 0 && data->bytesRead > 0 && (data->bytesLeft < 0 || data->bytesLeft > 0))
 	{
 		// The main read processing loop. we'll read as much as we can until we can't read anymore
-		bytesToRead = data->bytesLeft < 0 ? (int)sizeof(data->buffer) : (data->bytesLeft > ((int)sizeof(data->buffer) - data->unshiftedBytes) ? (int)sizeof(data->buffer) - data->unshiftedBytes : data->bytesLeft);
-		data->bytesRead = (int)fread(data->buffer + data->unshiftedBytes, 1, bytesToRead, data->fPtr);
+		bytesToRead = data->bytesLeft < 0 ? (int)sizeof(data->buffer) : (data->bytesLeft > (int)sizeof(data->buffer) ? (int)sizeof(data->buffer) : data->bytesLeft);
+		data->bytesRead = (int)fread(data->buffer, 1, bytesToRead, data->fPtr);
 		if (data->bytesRead > 0)
 		{
 			if (data->bytesLeft > 0) { data->bytesLeft -= data->bytesRead; }
-			data->bytesRead += data->unshiftedBytes; data->unshiftedBytes = 0;
-			do
-			{
-				int preshift = data->unshiftedBytes == 0 ? data->bytesRead : data->unshiftedBytes;
-				ILibDuktape_readableStream_WriteData(sender, data->buffer, data->unshiftedBytes>0 ? data->unshiftedBytes : data->bytesRead);
-				if (data->unshiftedBytes > 0 && data->unshiftedBytes != preshift) { memmove(data->buffer, data->buffer + (preshift - data->unshiftedBytes), data->unshiftedBytes); }
-			} while (data->unshiftedBytes != 0 && data->unshiftedBytes != data->bytesRead);
-			data->unshiftedBytes = 0;
+			ILibDuktape_fs_readStream_Deliver(sender, data, data->buffer, data->bytesRead);
 			if (data->bytesLeft == 0) { data->bytesRead = 0; }
 		}
 	}
 	if (sender->paused == 0 && data->bytesRead == 0)
 	{
 		// We aren't paused, but the read resulted in a graceful end
-		ILibDuktape_readableStream_WriteEnd(sender);
-
-		if (data->autoClose != 0 && data->fPtr != NULL)
-		{
-			if (ILibduktape_fs_CloseFD(data->ctx, data->fsObject, data->fd) != 0)
-			{
-				ILibDuktape_Process_UncaughtExceptionEx(data->ctx, "fs.readStream._CloseFD(): Error closing FD: %d", data->fd);
-			}
-			data->fd = 0;
-			data->fPtr = NULL;
-
-			if (data->ctx != NULL && data->ReadStreamObject != NULL)
-			{
-				duk_push_heapptr(data->ctx, data->ReadStreamObject);					// [this]
-				duk_get_prop_string(data->ctx, -1, "emit");								// [this][emit]
-				duk_swap_top(data->ctx, -2);											// [emit][this]
-				duk_push_string(data->ctx, "close");									// [emit][this][close]
-				if (duk_pcall_method(data->ctx, 1) != 0) { ILibDuktape_Process_UncaughtException(data->ctx); }
-				duk_pop(data->ctx);														// ...
-			}
-		}
+		ILibDuktape_fs_readStream_End(sender, data);
 	}
 	data->readLoopActive = 0;
 }
@@ -1252,6 +1660,9 @@ duk_ret_t ILibDuktape_fs_readStream_finalizer(duk_context *ctx)
 	duk_get_prop_string(ctx, 0, FS_READSTREAM);
 	data = (ILibDuktape_fs_readStreamData*)Duktape_GetBuffer(ctx, -1, NULL);
 
+#ifdef _POSIX
+	ILibDuktape_fs_readStream_ReleaseIO(data);
+#endif
 	if (data->autoClose != 0 && data->fPtr != NULL)
 	{
 		// If autoclose was specified, we need to close the descriptor
@@ -1348,12 +1759,39 @@ duk_ret_t ILibDuktape_fs_createReadStream(duk_context *ctx)
 		fseek(f, start, SEEK_SET);
 	}
 
+#ifdef _POSIX
+	// Regular files are read by the I/O service, so a slow disk doesn't block the event loop. Anything else (pipes, devices) is read inline
+	struct stat info;
+	if (fstat(fileno(f), &info) == 0 && S_ISREG(info.st_mode))
+	{
+		ILibDuktape_fs_ioService *service = ILibDuktape_fs_ioService_Get(ctx, data->fsObject);
+		off_t position = ftello(f);
+
+		data->io[0] = ILibDuktape_fs_ioJob_New(ctx, fileno(f), FS_IO_BUFFERSIZE, ILibDuktape_fs_readStream_ioDone, data);
+		data->io[1] = ILibDuktape_fs_ioJob_New(ctx, fileno(f), FS_IO_BUFFERSIZE, ILibDuktape_fs_readStream_ioDone, data);
+		if (position >= 0 && data->io[0] != NULL && data->io[1] != NULL)
+		{
+			data->ioService = service;
+			data->ioPosition = (uint64_t)position;
+			data->ioEnd = data->bytesLeft < 0 ? -1 : (int64_t)position + data->bytesLeft;
+		}
+		else
+		{
+			ILibDuktape_fs_readStream_ReleaseIO(data);
+		}
+	}
+#endif
+
 	return 1;
 }
 
 // Desctructor called by Garbage Collector
 duk_ret_t ILibDuktape_fs_Finalizer(duk_context *ctx)
 {
+#ifdef _POSIX
+	ILibDuktape_fs_ioService *service = (ILibDuktape_fs_ioService*)Duktape_GetPointerProperty(ctx, 0, FS_IOSERVICE_PTR);
+	if (service != NULL) { ILibDuktape_fs_ioService_Destroy(service); }
+#endif
 	if (duk_has_prop_string(ctx, 0, FS_PIPEMANAGER_PTR) && duk_has_prop_string(ctx, 0, FS_CHAIN_PTR))
 	{
 		duk_get_prop_string(ctx, 0, FS_PIPEMANAGER_PTR);		// [pipeMgr]
@@ -1388,10 +1826,128 @@ duk_ret_t ILibDuktape_fs_Finalizer(duk_context *ctx)
 }
 
 
-// Enumerate a folder path
+// Helper function to convert file time to JS time
+#ifdef WIN32
+char *ILibDuktape_fs_convertTime(SYSTEMTIME *st, char *dest, int destLen)
+#else
+char *ILibDuktape_fs_convertTime(uint64_t st, char *dest, int destLen)
+#endif
+{
+	int len;
+#ifdef WIN32
+	struct tm x;
+	memset(&x, 0, sizeof(struct tm));
+
+	x.tm_hour = st->wHour;
+	x.tm_min = st->wMinute;
+	x.tm_sec = st->wSecond;
+	x.tm_mday = st->wDay;
+	x.tm_mon = st->wMonth - 1;
+	x.tm_year = st->wYear - 1900;
+	
+	len = (int)strftime(dest, destLen, "%Y-%m-%dT%H:%M:%SZ", &x);
+#else
+	len = (int)strftime(dest, destLen, "%Y-%m-%dT%H:%M:%SZ", localtime((time_t*)&(st)));
+#endif
+	dest[len] = 0;
+	return(dest);
+}
+
+#ifdef WIN32
+// Pushes {name, type} for a directory entry. FindFirstFile/FindNextFile already return the size and times, so stat costs nothing extra
+void ILibDuktape_fs_readdir_pushEntry(duk_context *ctx, WIN32_FIND_DATAW *data, int stat)
+{
+	SYSTEMTIME stime;
+
+	duk_push_object(ctx);																	// [entry]
+	ILibDuktape_String_PushWideString(ctx, (char*)data->cFileName, 0);						// [entry][name]
+	duk_put_prop_string(ctx, -2, "name");													// [entry]
+	duk_push_string(ctx, (data->dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) == FILE_ATTRIBUTE_DIRECTORY ? "directory" : "file");
+	duk_put_prop_string(ctx, -2, "type");
+	if ((data->dwFileAttributes & FILE_ATTRIBUTE_REPARSE_POINT) == FILE_ATTRIBUTE_REPARSE_POINT)
+	{
+		duk_push_true(ctx); duk_put_prop_string(ctx, -2, "symlink");
+	}
+	if (stat != 0)
+	{
+		duk_push_number(ctx, (double)((((uint64_t)data->nFileSizeHigh) << 32) + ((uint64_t)data->nFileSizeLow)));
+		duk_put_prop_string(ctx, -2, "size");
+		if (FileTimeToSystemTime(&(data->ftLastWriteTime), &stime) != 0)
+		{
+			duk_push_string(ctx, ILibDuktape_fs_convertTime(&stime, ILibScratchPad, sizeof(ILibScratchPad)));
+			duk_put_prop_string(ctx, -2, "mtime");
+		}
+	}
+}
+#else
+char *ILibDuktape_fs_modeType(mode_t mode)
+{
+	if (S_ISREG(mode)) { return("file"); }
+	if (S_ISDIR(mode)) { return("directory"); }
+	if (S_ISLNK(mode)) { return("symlink"); }
+	if (S_ISBLK(mode)) { return("block"); }
+	if (S_ISCHR(mode)) { return("character"); }
+	if (S_ISFIFO(mode)) { return("fifo"); }
+	if (S_ISSOCK(mode)) { return("socket"); }
+	return("unknown");
+}
+
+// Pushes {name, type} for a directory entry. The type comes from d_type, so no stat is needed unless the file system doesn't fill it in.
+// If stat is set, the entry is stat'ed relative to the open directory, following links, to add size, mtime and mode
+void ILibDuktape_fs_readdir_pushEntry(duk_context *ctx, DIR *d, struct dirent *dir, int stat)
+{
+	struct stat result;
+	char *type = "unknown";
+	int link = dir->d_type == DT_LNK;
+
+	switch (dir->d_type)
+	{
+		case DT_REG: type = "file"; break;
+		case DT_DIR: type = "directory"; break;
+		case DT_LNK: type = "symlink"; break;
+		case DT_BLK: type = "block"; break;
+		case DT_CHR: type = "character"; break;
+		case DT_FIFO: type = "fifo"; break;
+		case DT_SOCK: type = "socket"; break;
+		default:
+			if (fstatat(dirfd(d), dir->d_name, &result, AT_SYMLINK_NOFOLLOW) == 0)
+			{
+				type = ILibDuktape_fs_modeType(result.st_mode);
+				link = S_ISLNK(result.st_mode);
+			}
+			break;
+	}
+
+	duk_push_object(ctx);										// [entry]
+	duk_push_string(ctx, dir->d_name);							// [entry][name]
+	duk_put_prop_string(ctx, -2, "name");						// [entry]
+	if (stat != 0 && (fstatat(dirfd(d), dir->d_name, &result, 0) == 0 || fstatat(dirfd(d), dir->d_name, &result, AT_SYMLINK_NOFOLLOW) == 0))
+	{
+		// Dangling links fall back to the link itself
+		type = ILibDuktape_fs_modeType(result.st_mode);
+
+		duk_push_number(ctx, result.st_size);
+		duk_put_prop_string(ctx, -2, "size");
+		duk_push_string(ctx, ILibDuktape_fs_convertTime(result.st_mtime, ILibScratchPad, sizeof(ILibScratchPad)));
+		duk_put_prop_string(ctx, -2, "mtime");
+		duk_push_int(ctx, result.st_mode);
+		duk_put_prop_string(ctx, -2, "mode");
+	}
+	duk_push_string(ctx, type);
+	duk_put_prop_string(ctx, -2, "type");
+	if (link != 0)
+	{
+		duk_push_true(ctx); duk_put_prop_string(ctx, -2, "symlink");
+	}
+}
+#endif
+
+// Enumerate a folder path. If options.withFileTypes is set, entries are returned as {name, type}, and options.stat adds size/mtime, so callers don't need a statSync() per entry
 duk_ret_t ILibDuktape_fs_readdirSync(duk_context *ctx)
 {
 	int i = 0;
+	int types = duk_is_object(ctx, 1) ? Duktape_GetBooleanProperty(ctx, 1, "withFileTypes", 0) : 0;
+	int stat = duk_is_object(ctx, 1) ? Duktape_GetBooleanProperty(ctx, 1, "stat", 0) : 0;
 #ifdef WIN32
 	HANDLE h;
 	WIN32_FIND_DATAW data;
@@ -1432,14 +1988,28 @@ duk_ret_t ILibDuktape_fs_readdirSync(duk_context *ctx)
 	{
 		if (wcscmp(data.cFileName, L".") != 0)
 		{
-			ILibDuktape_String_PushWideString(ctx, (char*)data.cFileName, 0);	// [retVal][val]
+			if (types != 0)
+			{
+				ILibDuktape_fs_readdir_pushEntry(ctx, &data, stat);				// [retVal][val]
+			}
+			else
+			{
+				ILibDuktape_String_PushWideString(ctx, (char*)data.cFileName, 0);	// [retVal][val]
+			}
 			duk_put_prop_index(ctx, -2, i++);									// [retVal]
 		}
 		while (FindNextFileW(h, &data))
 		{
 			if (wcscmp(data.cFileName, L"..") != 0)
 			{
-				ILibDuktape_String_PushWideString(ctx, (char*)data.cFileName, 0);	// [retVal][val]
+				if (types != 0)
+				{
+					ILibDuktape_fs_readdir_pushEntry(ctx, &data, stat);				// [retVal][val]
+				}
+				else
+				{
+					ILibDuktape_String_PushWideString(ctx, (char*)data.cFileName, 0);	// [retVal][val]
+				}
 				duk_put_prop_index(ctx, -2, i++);									// [retVal]
 			}
 		}
@@ -1454,7 +2024,14 @@ duk_ret_t ILibDuktape_fs_readdirSync(duk_context *ctx)
 		{
 			if (strcmp(dir->d_name, ".") != 0 && strcmp(dir->d_name, "..") != 0)
 			{
-				duk_push_string(ctx, dir->d_name);
+				if (types != 0)
+				{
+					ILibDuktape_fs_readdir_pushEntry(ctx, d, dir, stat);
+				}
+				else
+				{
+					duk_push_string(ctx, dir->d_name);
+				}
 				duk_put_prop_index(ctx, -2, i++);
 			}
 		}
@@ -1465,39 +2042,113 @@ duk_ret_t ILibDuktape_fs_readdirSync(duk_context *ctx)
 	return 1;
 }
 
-// Helper function to populate IsFile() and IsDirectory()
-duk_ret_t ILibDuktape_fs_statSyncEx(duk_context *ctx)
+// fs.Dir finalizer, closes the directory if the caller didn't read it to the end
+duk_ret_t ILibDuktape_fs_Dir_finalizer(duk_context *ctx)
 {
-	duk_push_current_function(ctx);
-	duk_get_prop_string(ctx, -1, FS_STAT_METHOD_RETVAL);
-	return 1;
+	ILibDuktape_fs_dirData *data = (ILibDuktape_fs_dirData*)Duktape_GetBufferProperty(ctx, 0, FS_DIR_PTR);
+	if (data != NULL)
+	{
+#ifdef WIN32
+		if (data->h != INVALID_HANDLE_VALUE) { FindClose(data->h); data->h = INVALID_HANDLE_VALUE; }
+#else
+		if (data->d != NULL) { closedir(data->d); data->d = NULL; }
+#endif
+	}
+	return(0);
+}
+duk_ret_t ILibDuktape_fs_Dir_closeSync(duk_context *ctx)
+{
+	duk_push_this(ctx);									// [dir]
+	duk_insert(ctx, 0);
+	return(ILibDuktape_fs_Dir_finalizer(ctx));
 }
 
-// Helper function to convert file time to JS time
+// Returns the next batch of entries, so huge folders can be delivered incrementally. Returns null, and closes the directory, once every entry has been read
+duk_ret_t ILibDuktape_fs_Dir_readSync(duk_context *ctx)
+{
+	int count = duk_is_number(ctx, 0) ? duk_require_int(ctx, 0) : FS_READDIR_BATCHSIZE;
+	int i = 0;
+	ILibDuktape_fs_dirData *data;
+#ifndef WIN32
+	struct dirent *dir;
+#endif
+
+	duk_push_this(ctx);																// [dir]
+	data = (ILibDuktape_fs_dirData*)Duktape_GetBufferProperty(ctx, -1, FS_DIR_PTR);
+	duk_push_array(ctx);															// [dir][retVal]
+
 #ifdef WIN32
-char *ILibDuktape_fs_convertTime(SYSTEMTIME *st, char *dest, int destLen)
+	while (i < count && data->h != INVALID_HANDLE_VALUE)
+	{
+		if (data->pending == 0 && !FindNextFileW(data->h, &(data->data)))
+		{
+			FindClose(data->h);
+			data->h = INVALID_HANDLE_VALUE;
+			break;
+		}
+		data->pending = 0;
+		if (wcscmp(data->data.cFileName, L".") == 0 || wcscmp(data->data.cFileName, L"..") == 0) { continue; }
+		ILibDuktape_fs_readdir_pushEntry(ctx, &(data->data), data->stat);			// [dir][retVal][entry]
+		duk_put_prop_index(ctx, -2, i++);											// [dir][retVal]
+	}
 #else
-char *ILibDuktape_fs_convertTime(uint64_t st, char *dest, int destLen)
+	while (i < count && data->d != NULL)
+	{
+		if ((dir = readdir(data->d)) == NULL)
+		{
+			closedir(data->d);
+			data->d = NULL;
+			break;
+		}
+		if (strcmp(dir->d_name, ".") == 0 || strcmp(dir->d_name, "..") == 0) { continue; }
+		ILibDuktape_fs_readdir_pushEntry(ctx, data->d, dir, data->stat);			// [dir][retVal][entry]
+		duk_put_prop_index(ctx, -2, i++);											// [dir][retVal]
+	}
 #endif
+
+	if (i == 0) { duk_push_null(ctx); }
+	return(1);
+}
+
+// Opens a folder for incremental enumeration. Entries are always returned as {name, type}, the same as readdirSync() with withFileTypes
+duk_ret_t ILibDuktape_fs_opendirSync(duk_context *ctx)
 {
-	int len;
+	ILibDuktape_fs_dirData *data;
 #ifdef WIN32
-	struct tm x;
-	memset(&x, 0, sizeof(struct tm));
+	char *path = (char*)ILibDuktape_String_AsWide(ctx, 0, NULL);
+#else
+	char *path = ILibDuktape_fs_fixLinuxPath((char*)duk_require_string(ctx, 0));
+	if (path == NULL) { return(ILibDuktape_Error(ctx, "fs.opendirSync(): Invalid Path")); }
+#endif
 
-	x.tm_hour = st->wHour;
-	x.tm_min = st->wMinute;
-	x.tm_sec = st->wSecond;
-	x.tm_mday = st->wDay;
-	x.tm_mon = st->wMonth - 1;
-	x.tm_year = st->wYear - 1900;
-	
-	len = (int)strftime(dest, destLen, "%Y-%m-%dT%H:%M:%SZ", &x);
+	duk_push_object(ctx);																// [dir]
+	ILibDuktape_WriteID(ctx, "fs.Dir");
+	data = (ILibDuktape_fs_dirData*)Duktape_PushBuffer(ctx, sizeof(ILibDuktape_fs_dirData));	// [dir][data]
+	duk_put_prop_string(ctx, -2, FS_DIR_PTR);											// [dir]
+	data->stat = duk_is_object(ctx, 1) ? Duktape_GetBooleanProperty(ctx, 1, "stat", 0) : 0;
+
+#ifdef WIN32
+	data->h = FindFirstFileW((LPCWSTR)path, &(data->data));
+	if (data->h == INVALID_HANDLE_VALUE) { return(ILibDuktape_Error(ctx, "fs.opendirSync(): Invalid Path")); }
+	data->pending = 1;
 #else
-	len = (int)strftime(dest, destLen, "%Y-%m-%dT%H:%M:%SZ", localtime((time_t*)&(st)));
+	if ((data->d = opendir(path)) == NULL) { return(ILibDuktape_Error(ctx, "fs.opendirSync(): Path Error [%s]", path)); }
 #endif
-	dest[len] = 0;
-	return(dest);
+
+	duk_dup(ctx, 0);
+	duk_put_prop_string(ctx, -2, "path");
+	ILibDuktape_CreateInstanceMethod(ctx, "readSync", ILibDuktape_fs_Dir_readSync, DUK_VARARGS);
+	ILibDuktape_CreateInstanceMethod(ctx, "closeSync", ILibDuktape_fs_Dir_closeSync, 0);
+	ILibDuktape_CreateFinalizer(ctx, ILibDuktape_fs_Dir_finalizer);
+	return(1);
+}
+
+// Helper function to populate IsFile() and IsDirectory()
+duk_ret_t ILibDuktape_fs_statSyncEx(duk_context *ctx)
+{
+	duk_push_current_function(ctx);
+	duk_get_prop_string(ctx, -1, FS_STAT_METHOD_RETVAL);
+	return 1;
 }
 
 // Fetch various attributes from the file system about a file/folder
@@ -2331,6 +2982,35 @@ duk_ret_t ILibDuktape_fs_mkdirSync(duk_context *ctx)
 	return 0;
 }
 
+#ifdef _POSIX
+//
+// Reads a descriptor whose length isn't known up front (/proc, /sys, pipes), doubling the buffer as it fills up
+//
+size_t ILibDuktape_fs_readFileSync_unknownLength(duk_context *ctx, int fd)
+{
+	duk_size_t bufferSize = FS_READFILE_INITIALSIZE;
+	char *buffer = (char*)duk_push_dynamic_buffer(ctx, bufferSize);				// [dynamicBuffer]
+	size_t len = 0;
+	ssize_t bytesRead;
+
+	while ((bytesRead = read(fd, buffer + len, bufferSize - len)) != 0)
+	{
+		if (bytesRead < 0)
+		{
+			if (errno == EINTR) { continue; }
+			break;
+		}
+		len += (size_t)bytesRead;
+		if (len == bufferSize)
+		{
+			bufferSize *= 2;
+			buffer = (char*)duk_resize_buffer(ctx, -1, bufferSize);
+		}
+	}
+	return(len);
+}
+#endif
+
 // fs.readFileSync() to read an entire file into a buffer
 duk_ret_t ILibDuktape_fs_readFileSync(duk_context *ctx)
 {
@@ -2349,6 +3029,41 @@ duk_ret_t ILibDuktape_fs_readFileSync(duk_context *ctx)
 		flags = Duktape_GetStringPropertyValue(ctx, 1, "flags", flags);
 	}
 
+#ifdef _POSIX
+	if (flags[0] == 'r')
+	{
+		struct stat info;
+		char *buffer;
+		size_t len = 0;
+		ssize_t bytesRead;
+		int fd = open(filePath, O_RDONLY | O_CLOEXEC);
+
+		if (fd < 0) { return(ILibDuktape_Error(ctx, "fs.readFileSync(): File [%s] not found", filePath)); }
+		if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0)
+		{
+			// Regular file, so we can allocate the buffer first, and then fill it up
+#ifdef POSIX_FADV_SEQUENTIAL
+			if (info.st_size >= FS_READFILE_SEQUENTIALSIZE) { posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL); }
+#endif
+			buffer = (char*)duk_push_fixed_buffer(ctx, (duk_size_t)info.st_size);	// [buffer]
+			while (len < (size_t)info.st_size)
+			{
+				bytesRead = pread(fd, buffer + len, (size_t)info.st_size - len, (off_t)len);
+				if (bytesRead < 0 && errno == EINTR) { continue; }
+				if (bytesRead <= 0) { break; }
+				len += (size_t)bytesRead;
+			}
+		}
+		else
+		{
+			len = ILibDuktape_fs_readFileSync_unknownLength(ctx, fd);				// [dynamicBuffer]
+		}
+		close(fd);
+		duk_push_buffer_object(ctx, -1, 0, (duk_size_t)len, DUK_BUFOBJ_NODEJS_BUFFER);
+		return(1);
+	}
+#endif
+
 #ifdef WIN32
 	_wfopen_s(&f, (const wchar_t*)ILibDuktape_String_UTF8ToWide(ctx, filePath), (const wchar_t*)ILibDuktape_String_UTF8ToWide(ctx, flags));
 #else
@@ -2391,6 +3106,45 @@ duk_ret_t ILibDuktape_fs_readFileSync(duk_context *ctx)
 	return(1);
 }
 
+// fs.readFileInto() to read a file into a caller supplied buffer, so the buffer can be reused when polling
+duk_ret_t ILibDuktape_fs_readFileInto(duk_context *ctx)
+{
+	char *filePath = (char*)duk_require_string(ctx, 0);
+	duk_size_t bufferLen;
+	char *buffer;
+	size_t len = 0;
+	char extra;
+	int more;
+
+	if (!duk_is_buffer_data(ctx, 1)) { return(ILibDuktape_Error(ctx, "fs.readFileInto(): Invalid Buffer")); }
+	buffer = (char*)duk_get_buffer_data(ctx, 1, &bufferLen);
+
+#ifdef WIN32
+	FILE *f = NULL;
+	_wfopen_s(&f, (const wchar_t*)ILibDuktape_String_UTF8ToWide(ctx, filePath), L"rbN");
+	if (f == NULL) { return(ILibDuktape_Error(ctx, "fs.readFileInto(): File [%s] not found", filePath)); }
+	len = fread(buffer, 1, bufferLen, f);
+	more = len == bufferLen && fread(&extra, 1, 1, f) == 1;
+	fclose(f);
+#else
+	ssize_t bytesRead;
+	int fd = open(filePath, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) { return(ILibDuktape_Error(ctx, "fs.readFileInto(): File [%s] not found", filePath)); }
+	while (len < bufferLen)
+	{
+		bytesRead = read(fd, buffer + len, bufferLen - len);
+		if (bytesRead < 0 && errno == EINTR) { continue; }
+		if (bytesRead <= 0) { break; }
+		len += (size_t)bytesRead;
+	}
+	more = len == bufferLen && read(fd, &extra, 1) == 1;
+	close(fd);
+#endif
+
+	duk_push_number(ctx, more ? -1 : (duk_double_t)len);
+	return(1);
+}
+
 // fs.existsSync() to determine if a path exists
 duk_ret_t ILibDuktape_fs_existsSync(duk_context *ctx)
 {
@@ -2486,16 +3240,19 @@ void ILibDuktape_fs_PUSH(duk_context *ctx, void *chain)
 	ILibDuktape_CreateInstanceMethod(ctx, "write", ILibDuktape_fs_write, DUK_VARARGS);
 #ifdef WIN32
 	ILibDuktape_CreateInstanceMethod(ctx, "_readdirSync", ILibDuktape_fs_readdirSync, DUK_VARARGS);
+	ILibDuktape_CreateInstanceMethod(ctx, "_opendirSync", ILibDuktape_fs_opendirSync, DUK_VARARGS);
 	ILibDuktape_CreateInstanceMethod(ctx, "_statSync", ILibDuktape_fs_statSync, 1);
 	ILibDuktape_CreateInstanceMethod(ctx, "convertFileTime", ILibDuktape_fs_convertFileTime, 1);
 #else
 	ILibDuktape_CreateInstanceMethod(ctx, "readdirSync", ILibDuktape_fs_readdirSync, DUK_VARARGS);
+	ILibDuktape_CreateInstanceMethod(ctx, "opendirSync", ILibDuktape_fs_opendirSync, DUK_VARARGS);
 	ILibDuktape_CreateInstanceMethod(ctx, "statSync", ILibDuktape_fs_statSync, 1);
 #endif
 	ILibDuktape_CreateInstanceMethod(ctx, "createWriteStream", ILibDuktape_fs_createWriteStream, DUK_VARARGS);
 	ILibDuktape_CreateInstanceMethod(ctx, "createReadStream", ILibDuktape_fs_createReadStream, DUK_VARARGS);
 	ILibDuktape_CreateInstanceMethod(ctx, "readDrivesSync", ILibDuktape_fs_readDrivesSync, 0);
 	ILibDuktape_CreateInstanceMethod(ctx, "readFileSync", ILibDuktape_fs_readFileSync, DUK_VARARGS);
+	ILibDuktape_CreateInstanceMethod(ctx, "readFileInto", ILibDuktape_fs_readFileInto, 2);
 	ILibDuktape_CreateInstanceMethod(ctx, "existsSync", ILibDuktape_fs_existsSync, 1);
 #ifdef _POSIX
 	ILibDuktape_CreateInstanceMethod(ctx, "chmodSync", ILibduktape_fs_chmodSync, 2);
@@ -2529,7 +3286,7 @@ void ILibDuktape_fs_PUSH(duk_context *ctx, void *chain)
 	char copyFile[] = "exports.copyFile = function copyFile(src, dest)\
 						{\
 							var ss = this.createReadStream(src, {flags: 'rb'});\
-							var ds = this.createWriteStream(dest, {flags: 'wb'});\
+							var ds = this.createWriteStream(dest, {flags: 'wb', async: true});\
 							ss.fs = this;\
 							ss.pipe(ds);\
 							ds.ss = ss;\
@@ -2588,7 +3345,13 @@ void ILibDuktape_fs_PUSH(duk_context *ctx, void *chain)
 						{\
 							exports._fixwinpath = function _fixwinpath(p) { return(p.split('/').join('\\\\')); };\
 							exports.statSync = function statSync(pathstr) { return(this._statSync(this._fixwinpath(pathstr))); };\
-							exports.readdirSync = function readdirSync(pathstr)\
+							exports._fixwinglob = function _fixwinglob(pathstr)\
+							{\
+								if(!pathstr.endsWith('*')) { pathstr += (pathstr.endsWith('\\\\') ? '*' : '\\\\*'); }\
+								return(pathstr);\
+							};\
+							exports.opendirSync = function opendirSync(pathstr, options) { return(this._opendirSync(this._fixwinglob(this._fixwinpath(pathstr)), options)); };\
+							exports.readdirSync = function readdirSync(pathstr, options)\
 							{\
 								var sysnative=false;\
 								pathstr = exports._fixwinpath(pathstr);\
@@ -2604,8 +3367,8 @@ void ILibDuktape_fs_PUSH(duk_context *ctx, void *chain)
 										pathstr += '\\\\*';\
 									}\
 								}\
-								var ret = exports._readdirSync(pathstr);\
-								if(sysnative) { ret.push('sysnative'); }\
+								var ret = exports._readdirSync(pathstr, options);\
+								if(sysnative) { ret.push((options != null && options.withFileTypes) ? { name: 'sysnative', type: 'directory' } : 'sysnative'); }\
 								return(ret);\
 							};\
 							exports.readdirSync.version=1;\
@@ -2662,10 +3425,20 @@ public:
 	\param path \<String\> directory to read
 	\param options \<String\|Object\> \n
 	<b>encoding</b> \<String\> <b>Default:</b> 'utf8'\n
+	<b>withFileTypes</b> \<Boolean\> If true, returns {name, type[, symlink]} for each entry, where type is 'file', 'directory', 'symlink', 'block', 'character', 'fifo', 'socket' or 'unknown'\n
+	<b>stat</b> \<Boolean\> If true with withFileTypes, also returns size and mtime (and mode on POSIX). type then describes the target of a link\n
 	\return Array\<String\> contents of the folder, excluding '.' and '..'
 	*/
 	Array<String> readdirSync(path[, options]);
 	/*!
+	\brief Opens a folder, so its contents can be read in batches
+	\param path \<String\> directory to read
+	\param options \<Object\> \n
+	<b>stat</b> \<Boolean\> Same as readdirSync()\n
+	\return \<Dir\> with readSync([count]), which returns up to count (<b>Default:</b> 256) entries in the readdirSync() withFileTypes format, or null when done, and closeSync()
+	*/
+	Dir opendirSync(path[, options]);
+	/*!
 	\brief Returns a new WritableStream
 	\param path \<String\> 
 	\param options <Object> has the following defaults:\n
@@ -2674,6 +3447,7 @@ public:
 	<b>fd</b> <Integer> NULL\n
 	<b>mode</b> <Integer> 0o666\n
 	<b>autoClose</b> <boolean> true\n
+	<b>async</b> <boolean> false. If true, writes to regular files are done by worker threads, and 'finish' is emitted once they complete. <b>Note:</b> POSIX only\n
 	\return \<WritableStream\>
 	*/
 	WritableStream createWriteStream(path[, options]);
@@ -2686,7 +3460,7 @@ public:
 	<b>fd</b> <Integer> NULL\n
 	<b>mode</b> <Integer> 0o666\n
 	<b>autoClose</b> <boolean> true\n
-	\return \<ReadableStream\>
+	\return \<ReadableStream\> On POSIX, regular files are read ahead by worker threads
 	*/
 	ReadableStream createReadStream(path[, options]);
 	/*!
@@ -2710,6 +3484,13 @@ public:
 	*/
 	Buffer readFileSync(path[, options]);
 	/*!
+	\brief Synchronously reads the contents of a file into an existing Buffer, so it can be reused across polls
+	\param path \<String\>
+	\param buffer \<Buffer\> Buffer to read into
+	\return <Integer> Number of bytes read, or -1 if the file did not fit in the buffer
+	*/
+	Integer readFileInto(path, buffer);
+	/*!
 	\brief Watch for changes on filename, where filename is either a file or a directory.
 	\param filename \<String\>
 	\param options <Object> Optional with the following values:\n
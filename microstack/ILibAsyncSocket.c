@@ -54,6 +54,8 @@ limitations under the License.
 #ifdef _POSIX
 #include <sys/socket.h>
 #include <sys/un.h>
+#include <sys/uio.h>
+#include <limits.h>
 #endif
 
 #ifndef MICROSTACK_NOTLS
@@ -69,6 +71,15 @@ limitations under the License.
 #endif
 #define INET_SOCKADDR_LENGTH(x) ((x==AF_INET6?sizeof(struct sockaddr_in6):sizeof(struct sockaddr_in)))
 
+// Maximum number of pending buffers that will be flushed with a single gather write
+#if defined(IOV_MAX) && IOV_MAX < 64
+	#define ILibAsyncSocket_MaxGather IOV_MAX
+#else
+	#define ILibAsyncSocket_MaxGather 64
+#endif
+// Small TLS writes are coalesced into records up to this size, instead of one record per buffer
+#define ILibAsyncSocket_TLS_CoalesceSize 16384
+
 
 
 #ifdef SEMAPHORE_TRACKING
@@ -544,6 +555,10 @@ ILibAsyncSocket_SendStatus ILibAsyncSocket_SendTo_MultiWrite(ILibAsyncSocket_Soc
 	size_t bufferLen;
 	ILibAsyncSocket_MemoryOwnership UserFree;
 	int lockOverride = ((count & ILibAsyncSocket_LOCK_OVERRIDE) == ILibAsyncSocket_LOCK_OVERRIDE) ? (count ^= ILibAsyncSocket_LOCK_OVERRIDE, 1) : 0;
+#ifndef MICROSTACK_NOTLS
+	char coalesce[ILibAsyncSocket_TLS_CoalesceSize];
+	int coalesceLen = 0;
+#endif
 
 	// If the socket is empty, return now.
 	if (socketModule == NULL) return ILibAsyncSocket_SEND_ON_CLOSED_SOCKET_ERROR;
@@ -570,14 +585,40 @@ ILibAsyncSocket_SendStatus ILibAsyncSocket_SendTo_MultiWrite(ILibAsyncSocket_Soc
 				continue;
 			}
 
-			SSL_TRACE1("SSL_write()");
-			SSL_write(module->ssl, buffer, (int)bufferLen); // No dataloss, becuase we capped at INT32_MAX
-			SSL_TRACE2("SSL_write()");
-			TLSLOG1("SSL_write[%d]: %d bytes...\n", module->internalSocket, bufferLen);
+			if (coalesceLen > 0 && (coalesceLen + bufferLen) > sizeof(coalesce))
+			{
+				// Flush what we've coalesced so far, as a single TLS record
+				SSL_TRACE1("SSL_write()");
+				SSL_write(module->ssl, coalesce, coalesceLen);
+				SSL_TRACE2("SSL_write()");
+				TLSLOG1("SSL_write[%d]: %d bytes (coalesced)...\n", module->internalSocket, coalesceLen);
+				coalesceLen = 0;
+			}
+			if (bufferLen < sizeof(coalesce))
+			{
+				// Small buffers (ie: WebSocket/HTTP headers) are combined with the data that follows
+				memcpy_s(coalesce + coalesceLen, sizeof(coalesce) - coalesceLen, buffer, bufferLen);
+				coalesceLen += (int)bufferLen;
+			}
+			else
+			{
+				SSL_TRACE1("SSL_write()");
+				SSL_write(module->ssl, buffer, (int)bufferLen); // No dataloss, becuase we capped at INT32_MAX
+				SSL_TRACE2("SSL_write()");
+				TLSLOG1("SSL_write[%d]: %d bytes...\n", module->internalSocket, bufferLen);
+			}
 
 			if (UserFree == ILibAsyncSocket_MemoryOwnership_CHAIN) { free(buffer); }
 		}
 		va_end(vlist); 
+
+		if (coalesceLen > 0)
+		{
+			SSL_TRACE1("SSL_write()");
+			SSL_write(module->ssl, coalesce, coalesceLen);
+			SSL_TRACE2("SSL_write()");
+			TLSLOG1("SSL_write[%d]: %d bytes (coalesced)...\n", module->internalSocket, coalesceLen);
+		}
 	
 		if (notok == 0)
 		{
@@ -1698,6 +1739,55 @@ void ILibAsyncSocket_PrivateShutdown(void* socketModule)
 	module->FinConnect = 0;
 }
 
+//
+// Flushes as many of the pending stream buffers as possible with a single gather write.
+// Returns the number of bytes written, or -1 on error. 'offered' is set to the number of bytes that were attempted.
+//
+int ILibAsyncSocket_GatherSend(ILibAsyncSocketModule *module, int *offered)
+{
+	ILibAsyncSocket_SendData *data = module->PendingSend_Head;
+	int count = 0;
+	int len;
+#ifdef WIN32
+	WSABUF iov[ILibAsyncSocket_MaxGather];
+	DWORD sent = 0;
+#else
+	struct iovec iov[ILibAsyncSocket_MaxGather];
+	struct msghdr msg;
+#endif
+
+	*offered = 0;
+	while (data != NULL && count < ILibAsyncSocket_MaxGather && (data->remoteAddress.sin6_family == 0 || data->remoteAddress.sin6_family == AF_UNIX))
+	{
+		len = data->bufferSize - data->bytesSent;
+		if (len > 0)
+		{
+			if (len > INT32_MAX - *offered) { break; }
+#ifdef WIN32
+			iov[count].buf = data->buffer + data->bytesSent;
+			iov[count].len = (ULONG)len;
+#else
+			iov[count].iov_base = data->buffer + data->bytesSent;
+			iov[count].iov_len = (size_t)len;
+#endif
+			*offered += len;
+			++count;
+		}
+		data = data->Next;
+	}
+	if (count == 0) { return(0); }
+
+#ifdef WIN32
+	if (WSASend(module->internalSocket, iov, (DWORD)count, &sent, 0, NULL, NULL) != 0) { return(-1); }
+	return((int)sent);
+#else
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = count;
+	return((int)sendmsg(module->internalSocket, &msg, MSG_NOSIGNAL)); // This socket has been set to O_NONBLOCK, so this will never block
+#endif
+}
+
 //
 // Chained PostSelect handler for ILibAsyncSocket
 //
@@ -1711,6 +1801,8 @@ void ILibAsyncSocket_PostSelect(void* socketModule, int slct, fd_set *readset, f
 	int TriggerSendOK = 0;
 	struct ILibAsyncSocket_SendData *temp;
 	int bytesSent = 0;
+	int bytesOffered = 0;
+	int bytesRemaining;
 	int flags;
 #ifdef WIN32
 	int len;
@@ -2052,23 +2144,34 @@ void ILibAsyncSocket_PostSelect(void* socketModule, int slct, fd_set *readset, f
 			{
 				if (module->PendingSend_Head->remoteAddress.sin6_family == 0 || module->PendingSend_Head->remoteAddress.sin6_family == AF_UNIX)
 				{
-					bytesSent = (int)send(module->internalSocket, module->PendingSend_Head->buffer + module->PendingSend_Head->bytesSent, module->PendingSend_Head->bufferSize - module->PendingSend_Head->bytesSent, MSG_NOSIGNAL); // Klocwork reports that this could block while holding a lock... This socket has been set to O_NONBLOCK, so that will never happen
+					// Stream Socket, so flush as many of the pending buffers as we can with a single syscall
+					bytesSent = ILibAsyncSocket_GatherSend(module, &bytesOffered);
 				}
 				else
 				{
+					bytesOffered = module->PendingSend_Head->bufferSize - module->PendingSend_Head->bytesSent;
 					bytesSent = (int)sendto(module->internalSocket, module->PendingSend_Head->buffer + module->PendingSend_Head->bytesSent, module->PendingSend_Head->bufferSize - module->PendingSend_Head->bytesSent, MSG_NOSIGNAL, (struct sockaddr*)&module->PendingSend_Head->remoteAddress, INET_SOCKADDR_LENGTH(module->PendingSend_Head->remoteAddress.sin6_family)); // Klocwork reports that this could block while holding a lock... This socket has been set to O_NONBLOCK, so that will never happen
 				}
 
-				if (bytesSent == 0) { TRY_TO_SEND = 0; } //To avoid get stuck in an infinite loop when bytesSent == 0
+				if (bytesSent == 0 && bytesOffered != 0) { TRY_TO_SEND = 0; } //To avoid get stuck in an infinite loop when bytesSent == 0
 
-				if (bytesSent > 0)
+				if (bytesSent > 0 || (bytesSent == 0 && bytesOffered == 0))
 				{
 					module->PendingBytesToSend -= bytesSent;
 					if ((int)module->PendingBytesToSend < 0) { module->PendingBytesToSend = 0; }
 					module->TotalBytesSent += bytesSent;
-					module->PendingSend_Head->bytesSent += bytesSent;
-					if (module->PendingSend_Head->bytesSent == module->PendingSend_Head->bufferSize)
+
+					// Retire every block that was completely sent
+					bytesRemaining = bytesSent;
+					while (module->PendingSend_Head != NULL)
 					{
+						if (module->PendingSend_Head->bufferSize - module->PendingSend_Head->bytesSent > bytesRemaining)
+						{
+							module->PendingSend_Head->bytesSent += bytesRemaining;
+							break;
+						}
+						bytesRemaining -= (module->PendingSend_Head->bufferSize - module->PendingSend_Head->bytesSent);
+
 						// Finished Sending this block
 						if (module->PendingSend_Head == module->PendingSend_Tail)
 						{
@@ -2081,9 +2184,9 @@ void ILibAsyncSocket_PostSelect(void* socketModule, int slct, fd_set *readset, f
 						temp = module->PendingSend_Head->Next;
 						free(module->PendingSend_Head);
 						module->PendingSend_Head = temp;
-						if (module->PendingSend_Head == NULL) { TRY_TO_SEND = 0; }
 					}
-					else
+					if (module->PendingSend_Head == NULL) { TRY_TO_SEND = 0; }
+					if (bytesSent < bytesOffered)
 					{
 						// We sent data, but not everything that needs to get sent was sent, try again
 						TRY_TO_SEND = 0;
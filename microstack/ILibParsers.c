@@ -1624,7 +1624,7 @@ void ILibDefaultLogger_OnWrite(ILibRemoteLogging module, char* data, int dataLen
 */
 ILibExportMethod unsigned short ILibStartDefaultLoggerEx(void* chain, unsigned short portNumber, char *path)
 {
-	((ILibBaseChain*)chain)->ChainLogger = ILibRemoteLogging_Create(ILibDefaultLogger_OnWrite);
+	((ILibBaseChain*)chain)->ChainLogger = ILibRemoteLogging_CreateEx(chain, ILibDefaultLogger_OnWrite);
 	((ILibBaseChain*)chain)->LoggingWebServer = ILibWebServer_Create(chain, 5, portNumber, ILibDefaultLogger_OnSession, NULL);
 
 	if (path != NULL)
@@ -13,6 +13,7 @@ WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 See the License for the specific language governing permissions and
 limitations under the License.
 */
+#define _GNU_SOURCE
 
 #include <assert.h>
 #ifdef MEMORY_CHECK
@@ -49,6 +50,14 @@ limitations under the License.
 #endif
 	#endif
 #endif
+#if !defined( __APPLE__) && !defined(_FREEBSD)
+	#include <spawn.h>
+	#include <sys/syscall.h>
+	#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34)) && defined(POSIX_SPAWN_SETSID)
+		#define ILibProcessPipe_POSIX_SPAWN		// posix_spawn_file_actions_addclosefrom_np() is available
+		extern char **environ;
+	#endif
+#endif
 #endif
 
 
@@ -66,6 +75,8 @@ typedef struct ILibProcessPipe_Manager_Object
 	HANDLE workerThread;
 	DWORD workerThreadID;
 	void *activeWaitHandle;
+#else
+	ILibLinkedList ExitingProcesses;	// Processes that closed stdout, but haven't exited yet. Watched with a pidfd
 #endif
 }ILibProcessPipe_Manager_Object;
 struct ILibProcessPipe_PipeObject;
@@ -118,6 +129,7 @@ typedef struct ILibProcessPipe_Process_Object
 #else
 	pid_t PID;
 	int PTY;
+	int pidfd;
 #endif
 	void *userObject;
 	
@@ -229,7 +241,15 @@ void ILibProcessPipe_Manager_OnPreSelect(void* object, fd_set *readset, fd_set *
 		}
 		node = nextnode;
 	}
+
+	node = ILibLinkedList_GetNode_Head(man->ExitingProcesses);
+	while (node != NULL)
+	{
+		FD_SET(((ILibProcessPipe_Process_Object*)ILibLinkedList_GetDataFromNode(node))->pidfd, readset);
+		node = ILibLinkedList_GetNextNode(node);
+	}
 }
+void ILibProcessPipe_Process_BrokenPipeSink_DestroyHandler(void *object);
 void ILibProcessPipe_Manager_OnPostSelect(void* object, int slct, fd_set *readset, fd_set *writeset, fd_set *errorset)
 {
 	ILibProcessPipe_Manager_Object *man = (ILibProcessPipe_Manager_Object*)object;
@@ -255,6 +275,24 @@ void ILibProcessPipe_Manager_OnPostSelect(void* object, int slct, fd_set *readse
 		if (ILibChain_GetContinuationState(man->ChainLink.ParentChain) == ILibChain_ContinuationState_END_CONTINUE) { break; }
 		node = nextNode;
 	}
+
+	node = ILibLinkedList_GetNode_Head(man->ExitingProcesses);
+	while (node != NULL)
+	{
+		ILibProcessPipe_Process_Object *p = (ILibProcessPipe_Process_Object*)ILibLinkedList_GetDataFromNode(node);
+		if (FD_ISSET(p->pidfd, readset) != 0)
+		{
+			int status = 0;
+			ILibLinkedList_Remove(node);
+			waitpid(p->PID, &status, WNOHANG);
+			p->exitHandler(p, WEXITSTATUS(status), p->userObject);
+			ILibLifeTime_Add(ILibGetBaseTimer(man->ChainLink.ParentChain), p, 0, ILibProcessPipe_Process_BrokenPipeSink_DestroyHandler, NULL);
+
+			// The exit handler may have destroyed other processes in this list, so pick up the rest on the next pass
+			break;
+		}
+		node = ILibLinkedList_GetNextNode(node);
+	}
 }
 #endif
 void ILibProcessPipe_Manager_OnDestroy(void *object)
@@ -265,6 +303,8 @@ void ILibProcessPipe_Manager_OnDestroy(void *object)
 	man->abort = 1;
 	SetEvent(man->updateEvent);
 	WaitForSingleObject(man->workerThread, INFINITE);
+#else
+	ILibLinkedList_Destroy(man->ExitingProcesses);
 #endif
 	ILibLinkedList_Destroy(man->ActivePipes);
 }
@@ -279,6 +319,7 @@ ILibProcessPipe_Manager ILibProcessPipe_Manager_Create(void *chain)
 	retVal->ActivePipes = ILibLinkedList_CreateEx(sizeof(int));
 
 #ifndef WIN32
+	retVal->ExitingProcesses = ILibLinkedList_Create();
 	retVal->ChainLink.PreSelectHandler = &ILibProcessPipe_Manager_OnPreSelect;
 	retVal->ChainLink.PostSelectHandler = &ILibProcessPipe_Manager_OnPostSelect;
 	retVal->ChainLink.QueryHandler = ILibProcessPipe_Manager_OnQuery;
@@ -437,6 +478,10 @@ ILibProcessPipe_PipeObject* ILibProcessPipe_CreatePipe(ILibProcessPipe_Manager m
 	{
 		fcntl(fd[0], F_SETFL, O_NONBLOCK); 
 		fcntl(fd[1], F_SETFL, O_NONBLOCK);
+#ifdef F_SETPIPE_SZ
+		// Linux pipes default to 64K. Only grow (or shrink) them when asked for more than the historical 4K default
+		if (pipeBufferSize > 4096) { fcntl(fd[1], F_SETPIPE_SZ, pipeBufferSize); }
+#endif
 		retVal->mPipe_ReadEnd = fd[0];
 		retVal->mPipe_WriteEnd = fd[1];
 	}
@@ -456,6 +501,13 @@ void ILibProcessPipe_Process_Destroy(ILibProcessPipe_Process_Object *p)
 	if (p->metadata != NULL) { ILibMemory_Free(p->metadata); }
 #ifdef WIN32
 	if (p->hProcess != NULL) { CloseHandle(p->hProcess); }
+#else
+	if (p->pidfd >= 0)
+	{
+		void *node = ILibLinkedList_GetNode_Search(p->parent->ExitingProcesses, NULL, p);
+		if (node != NULL) { ILibLinkedList_Remove(node); }
+		close(p->pidfd);
+	}
 #endif
 	ILibMemory_Free(p);
 }
@@ -467,14 +519,25 @@ void ILibProcessPipe_Process_BrokenPipeSink_DestroyHandler(void *object)
 void ILibProcessPipe_Process_BrokenPipeSink(ILibProcessPipe_Pipe sender)
 {
 	ILibProcessPipe_Process_Object *p = ((ILibProcessPipe_PipeObject*)sender)->mProcess;
-	int status;
+	int status = 0;
 	if (ILibIsRunningOnChainThread(((ILibProcessPipe_PipeObject*)sender)->manager->ChainLink.ParentChain) != 0)
 	{
 		// This was called from the Reader
 		if (p->exitHandler != NULL)
 		{
-
-			waitpid((pid_t)p->PID, &status, 0);
+			if (p->pidfd >= 0)
+			{
+				if (waitpid((pid_t)p->PID, &status, WNOHANG) == 0)
+				{
+					// stdout was closed, but the process is still running. Instead of blocking the chain in waitpid(), let the pidfd tell us when it exits
+					ILibLinkedList_AddTail(p->parent->ExitingProcesses, p);
+					return;
+				}
+			}
+			else
+			{
+				waitpid((pid_t)p->PID, &status, 0);
+			}
 			p->exitHandler(p, WEXITSTATUS(status), p->userObject);
 		}
 
@@ -508,7 +571,67 @@ void ILibProcessPipe_Process_HardKill(ILibProcessPipe_Process p)
 
 
 
-ILibProcessPipe_Process ILibProcessPipe_Manager_SpawnProcessEx4(ILibProcessPipe_Manager pipeManager, char* target, char* const* parameters, ILibProcessPipe_SpawnTypes spawnType, void *sid, void *envvars, int extraMemorySize)
+#if !defined(WIN32) && defined(SYS_close_range)
+//
+// Called in the child before exec, so that the agent's sockets, files and the pipes of other
+// children aren't inherited. keepFD is left open, or -1 to close everything above stderr.
+//
+void ILibProcessPipe_Process_CloseDescriptors(int keepFD)
+{
+	if (keepFD > 3) { syscall(SYS_close_range, 3, keepFD - 1, 0); }
+	syscall(SYS_close_range, keepFD >= 3 ? keepFD + 1 : 3, ~0U, 0);
+}
+#endif
+#ifdef ILibProcessPipe_POSIX_SPAWN
+//
+// Starts the child with posix_spawn(), which glibc implements with clone(CLONE_VM | CLONE_VFORK), and sets up the
+// same child state that the vfork() path does by hand. Returns -1 if the caller should fall back to vfork()
+//
+pid_t ILibProcessPipe_Process_PosixSpawn(ILibProcessPipe_Process_Object *p, char* target, char* const* parameters, ILibProcessPipe_SpawnTypes spawnType, int needSetSid, char **vars)
+{
+	posix_spawn_file_actions_t actions;
+	posix_spawnattr_t attr;
+	sigset_t sigdefault;
+	pid_t pid = -1;
+	int i, childEnds[3];
+
+	if (spawnType != ILibProcessPipe_SpawnTypes_DETACHED)
+	{
+		// The child's ends of the pipes have to be blocking. The parent closes its copies as soon as the child is started.
+		childEnds[STDIN_FILENO] = p->stdIn->mPipe_ReadEnd;
+		childEnds[STDOUT_FILENO] = p->stdOut->mPipe_WriteEnd;
+		childEnds[STDERR_FILENO] = p->stdErr->mPipe_WriteEnd;
+		for (i = 0; i < 3; ++i)
+		{
+			fcntl(childEnds[i], F_SETFL, fcntl(childEnds[i], F_GETFL) & ~O_NONBLOCK);
+		}
+	}
+
+	posix_spawn_file_actions_init(&actions);
+	if (spawnType != ILibProcessPipe_SpawnTypes_DETACHED)
+	{
+		for (i = 0; i < 3; ++i)
+		{
+			posix_spawn_file_actions_adddup2(&actions, childEnds[i], i);
+		}
+	}
+	posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+
+	// Reset every signal disposition, the same as ILibVForkPrepareSignals_Child()
+	posix_spawnattr_init(&attr);
+	sigfillset(&sigdefault);
+	posix_spawnattr_setsigdefault(&attr, &sigdefault);
+	posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGDEF | (needSetSid != 0 ? POSIX_SPAWN_SETSID : 0));
+
+	if (posix_spawn(&pid, target, &actions, &attr, parameters, vars != NULL ? vars : environ) != 0) { pid = -1; }
+
+	posix_spawnattr_destroy(&attr);
+	posix_spawn_file_actions_destroy(&actions);
+	return(pid);
+}
+#endif
+
+ILibProcessPipe_Process ILibProcessPipe_Manager_SpawnProcessEx5(ILibProcessPipe_Manager pipeManager, char* target, char* const* parameters, ILibProcessPipe_SpawnTypes spawnType, void *sid, void *envvars, int extraMemorySize, int pipeBufferSize)
 {
 	ILibProcessPipe_Process_Object* retVal = NULL;
 	int needSetSid = ((spawnType & ILibProcessPipe_SpawnTypes_POSIX_DETACHED) == ILibProcessPipe_SpawnTypes_POSIX_DETACHED);
@@ -570,10 +693,14 @@ ILibProcessPipe_Process ILibProcessPipe_Manager_SpawnProcessEx4(ILibProcessPipe_
 	pid_t pid;
 #endif
 
+	if (pipeBufferSize <= 0) { pipeBufferSize = 4096; }
 	retVal = (ILibProcessPipe_Process_Object*)ILibMemory_SmartAllocate(sizeof(ILibProcessPipe_Process_Object));
+#ifndef WIN32
+	retVal->pidfd = -1;
+#endif
 	if (spawnType != ILibProcessPipe_SpawnTypes_DETACHED)
 	{
-		retVal->stdErr = ILibProcessPipe_CreatePipe(pipeManager, 4096, NULL, extraMemorySize);
+		retVal->stdErr = ILibProcessPipe_CreatePipe(pipeManager, pipeBufferSize, NULL, extraMemorySize);
 		retVal->stdErr->mProcess = retVal;
 	}
 	retVal->parent = (ILibProcessPipe_Manager_Object*)pipeManager;
@@ -585,9 +712,9 @@ ILibProcessPipe_Process ILibProcessPipe_Manager_SpawnProcessEx4(ILibProcessPipe_
 	info.cb = sizeof(STARTUPINFOW);
 	if (spawnType != ILibProcessPipe_SpawnTypes_DETACHED)
 	{
-		retVal->stdIn = ILibProcessPipe_CreatePipe(pipeManager, 4096, NULL, extraMemorySize);
+		retVal->stdIn = ILibProcessPipe_CreatePipe(pipeManager, pipeBufferSize, NULL, extraMemorySize);
 		retVal->stdIn->mProcess = retVal;
-		retVal->stdOut = ILibProcessPipe_CreatePipe(pipeManager, 4096, NULL, extraMemorySize);
+		retVal->stdOut = ILibProcessPipe_CreatePipe(pipeManager, pipeBufferSize, NULL, extraMemorySize);
 		retVal->stdOut->mProcess = retVal;
 
 		ILibProcessPipe_PipeObject_DisableInherit(&(retVal->stdIn->mPipe_WriteEnd));
@@ -749,27 +876,36 @@ ILibProcessPipe_Process ILibProcessPipe_Manager_SpawnProcessEx4(ILibProcessPipe_
 	{
 		if (spawnType != ILibProcessPipe_SpawnTypes_DETACHED)
 		{
-			retVal->stdIn = ILibProcessPipe_CreatePipe(pipeManager, 4096, NULL, extraMemorySize);
+			retVal->stdIn = ILibProcessPipe_CreatePipe(pipeManager, pipeBufferSize, NULL, extraMemorySize);
 			retVal->stdIn->mProcess = retVal;
-			retVal->stdOut = ILibProcessPipe_CreatePipe(pipeManager, 4096, (ILibProcessPipe_GenericBrokenPipeHandler)ILibProcessPipe_Process_BrokenPipeSink, extraMemorySize);
+			retVal->stdOut = ILibProcessPipe_CreatePipe(pipeManager, pipeBufferSize, (ILibProcessPipe_GenericBrokenPipeHandler)ILibProcessPipe_Process_BrokenPipeSink, extraMemorySize);
 			retVal->stdOut->mProcess = retVal;
 		}
-#ifdef __APPLE__
-		if (needSetSid == 0)
+#ifdef ILibProcessPipe_POSIX_SPAWN
+		if ((UID == -1 || UID == 0) && (pid = ILibProcessPipe_Process_PosixSpawn(retVal, target, parameters, spawnType, needSetSid, vars)) > 0)
 		{
-			set = &sset;
-			ILibVForkPrepareSignals_Parent_Init(set);
-			pid = vfork();
+			// Spawned, without needing to run the child branch below
 		}
 		else
+#endif
 		{
-			pid = fork();
-		}
+#ifdef __APPLE__
+			if (needSetSid == 0)
+			{
+				set = &sset;
+				ILibVForkPrepareSignals_Parent_Init(set);
+				pid = vfork();
+			}
+			else
+			{
+				pid = fork();
+			}
 #else
-		set = &sset;
-		ILibVForkPrepareSignals_Parent_Init(set);
-		pid = vfork();
+			set = &sset;
+			ILibVForkPrepareSignals_Parent_Init(set);
+			pid = vfork();
 #endif
+		}
 	}
 	if (pid < 0)
 	{
@@ -831,6 +967,9 @@ ILibProcessPipe_Process ILibProcessPipe_Manager_SpawnProcessEx4(ILibProcessPipe_
 		{
 			ignore_result(setsid());
 		}
+#ifdef SYS_close_range
+		ILibProcessPipe_Process_CloseDescriptors(spawnType == ILibProcessPipe_SpawnTypes_TERM ? retVal->stdErr->mPipe_WriteEnd : -1);
+#endif
 
 		if (vars != NULL)
 		{
@@ -853,6 +992,9 @@ ILibProcessPipe_Process ILibProcessPipe_Manager_SpawnProcessEx4(ILibProcessPipe_
 		close(retVal->stdErr->mPipe_WriteEnd); retVal->stdErr->mPipe_WriteEnd = -1;
 	}
 	retVal->PID = pid;
+#ifdef SYS_pidfd_open
+	if (spawnType != ILibProcessPipe_SpawnTypes_DETACHED) { retVal->pidfd = (int)syscall(SYS_pidfd_open, pid, 0); }
+#endif
 	ILibMemory_Free(vars);
 #endif
 	return retVal;
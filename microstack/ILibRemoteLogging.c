@@ -47,8 +47,31 @@ typedef struct ILibRemoteLogging_Session
 	void* UserContext;
 }ILibRemoteLogging_Session;
 
+#define ILibRemoteLogging_RingSize		128		// Must be a power of two
+#define ILibRemoteLogging_RecordSize	4096	// Same as the formatting buffer of ILibRemoteLogging_printfEx(), so records are never cut short
+
+#ifdef WIN32
+	#define ILibRemoteLogging_CAS(ptr, oldVal, newVal) (InterlockedCompareExchange((volatile LONG*)(ptr), (LONG)(newVal), (LONG)(oldVal)) == (LONG)(oldVal))
+	#define ILibRemoteLogging_Increment(ptr) InterlockedIncrement((volatile LONG*)(ptr))
+	#define ILibRemoteLogging_Barrier() MemoryBarrier()
+#else
+	#define ILibRemoteLogging_CAS(ptr, oldVal, newVal) __sync_bool_compare_and_swap((ptr), (oldVal), (newVal))
+	#define ILibRemoteLogging_Increment(ptr) __sync_add_and_fetch((ptr), 1)
+	#define ILibRemoteLogging_Barrier() __sync_synchronize()
+#endif
+
+typedef struct ILibRemoteLogging_Record
+{
+	volatile unsigned int Sequence;
+	int Length;
+	char Data[ILibRemoteLogging_RecordSize];
+}ILibRemoteLogging_Record;
+
+struct ILibRemoteLogging_DrainLink;
+
 typedef struct ILibRemoteLogging_Module
 {
+	unsigned int EnabledModules[64];		// Must be the first field, indexed by verbosity. Read without the lock by ILibRemoteLogging_IsEnabled()
 	sem_t LogSyncLock;
 	unsigned int LogFlags;
 
@@ -57,18 +80,67 @@ typedef struct ILibRemoteLogging_Module
 	int RawForwardOffset;
 	ILibRemoteLogging_OnCommand CommandSink[15];
 	ILibRemoteLogging_Session Sessions[5];
+
+	ILibRemoteLogging_Record *Ring;			// Bounded MPSC Queue. Producers format in place, and the chain thread delivers to the sessions
+	volatile unsigned int RingHead;
+	unsigned int RingTail;
+	volatile unsigned int Dropped;
+	volatile unsigned int DrainSignaled;	// Set when the chain has been woken up to drain the ring, cleared by the chain before it drains
+	void *Chain;
+	struct ILibRemoteLogging_DrainLink *DrainLink;
 }ILibRemoteLogging_Module;
 
+//
+// Chain link that drains the ring on the microstack thread, which is the only thread that can safely use the sessions and the file transport
+//
+typedef struct ILibRemoteLogging_DrainLink
+{
+	ILibChain_Link ChainLink;
+	ILibRemoteLogging_Module *Logger;
+}ILibRemoteLogging_DrainLink;
+
 void ILibRemoteLogging_Destroy(ILibRemoteLogging module)
 {
 	ILibRemoteLogging_Module *obj = (ILibRemoteLogging_Module*)module;
 	if (obj != NULL)
 	{
+		if (obj->DrainLink != NULL) { obj->DrainLink->Logger = NULL; }	// The chain will free the link
+		if (obj->Ring != NULL) { free(obj->Ring); }
 		sem_destroy(&(obj->LogSyncLock));
 		free(module);
 	}
 }
 
+//
+// Recalculates the table used by ILibRemoteLogging_IsEnabled(). Must be called with LogSyncLock held, whenever a session, flag, or sink changes
+//
+void ILibRemoteLogging_UpdateEnabledModules(ILibRemoteLogging_Module *obj)
+{
+	unsigned int i, x;
+	unsigned int enabled;
+
+	for (i = 0; i < sizeof(obj->EnabledModules) / sizeof(unsigned int); ++i)
+	{
+		enabled = 0;
+		if (obj->RawForwardSink != NULL)
+		{
+			// Filtering will be done by the process we are forwarding to
+			enabled = 0xFFFFFFFF;
+		}
+		else if (obj->OutputSink != NULL)
+		{
+			enabled = (unsigned int)ILibRemoteLogging_Modules_ConsolePrint;
+			for (x = 0; x < sizeof(obj->Sessions) / sizeof(ILibRemoteLogging_Session); ++x)
+			{
+				if (obj->Sessions[x].UserContext == NULL) { break; }						// No more Sessions
+				if (((obj->Sessions[x].Flags >> 16) & 0x3E) < i) { continue; }				// Verbosity is not high enough
+				enabled |= (obj->Sessions[x].Flags & 0xFFFF);
+			}
+		}
+		obj->EnabledModules[i] = enabled;
+	}
+}
+
 void ILibRemoteLogging_CompactSessions(ILibRemoteLogging_Session sessions[], int sessionsLength)
 {
 	int x=0,y=0;
@@ -137,10 +209,24 @@ void ILibRemoteLogging_LoggerCommand_Default(ILibRemoteLogging sender, ILibRemot
 }
 void ILibRemoteLogging_SetRawForward(ILibRemoteLogging logger, int bufferOffset, ILibRemoteLogging_OnRawForward onRawForward)
 {
-	((ILibRemoteLogging_Module*)logger)->RawForwardSink = onRawForward;
-	((ILibRemoteLogging_Module*)logger)->RawForwardOffset = bufferOffset;
+	ILibRemoteLogging_Module *obj = (ILibRemoteLogging_Module*)logger;
+
+	sem_wait(&(obj->LogSyncLock));
+	obj->RawForwardSink = onRawForward;
+	obj->RawForwardOffset = bufferOffset;
+	ILibRemoteLogging_UpdateEnabledModules(obj);
+	sem_post(&(obj->LogSyncLock));
 }
-ILibRemoteLogging ILibRemoteLogging_Create(ILibRemoteLogging_OnWrite onOutput)
+void ILibRemoteLogging_DrainLink_PreSelect(void* object, fd_set *readset, fd_set *writeset, fd_set *errorset, int* blocktime);
+void ILibRemoteLogging_DrainLink_Destroy(void *object);
+
+//! Creates a Logging Module
+/*!
+	\param chain Microstack chain that log messages are delivered on. If NULL, messages are delivered on the thread that logs them
+	\param onOutput Event handler that writes a message to a session, or NULL if this module only forwards or prints
+	\return Logging Module
+*/
+ILibRemoteLogging ILibRemoteLogging_CreateEx(void *chain, ILibRemoteLogging_OnWrite onOutput)
 {
 	ILibRemoteLogging_Module *retVal;
 	if((retVal = (ILibRemoteLogging_Module*)malloc(sizeof(ILibRemoteLogging_Module)))==NULL) {ILIBCRITICALEXIT(254);}
@@ -148,6 +234,29 @@ ILibRemoteLogging ILibRemoteLogging_Create(ILibRemoteLogging_OnWrite onOutput)
 
 	sem_init(&(retVal->LogSyncLock), 0, 1);
 	retVal->OutputSink = onOutput;
+	ILibRemoteLogging_UpdateEnabledModules(retVal);
+
+	if (onOutput != NULL && chain != NULL)
+	{
+		unsigned int i;
+		if ((retVal->Ring = (ILibRemoteLogging_Record*)malloc(ILibRemoteLogging_RingSize * sizeof(ILibRemoteLogging_Record))) == NULL) { ILIBCRITICALEXIT(254); }
+		for (i = 0; i < ILibRemoteLogging_RingSize; ++i) { retVal->Ring[i].Sequence = i; }
+
+		retVal->Chain = chain;
+		retVal->DrainLink = (ILibRemoteLogging_DrainLink*)ILibChain_Link_Allocate(sizeof(ILibRemoteLogging_DrainLink), 0);
+		retVal->DrainLink->ChainLink.MetaData = ILibMemory_SmartAllocate_FromString("ILibRemoteLogging_DrainLink");
+		retVal->DrainLink->ChainLink.PreSelectHandler = ILibRemoteLogging_DrainLink_PreSelect;
+		retVal->DrainLink->ChainLink.DestroyHandler = ILibRemoteLogging_DrainLink_Destroy;
+		retVal->DrainLink->Logger = retVal;
+		if (ILibIsChainRunning(chain) == 0)
+		{
+			ILibAddToChain(chain, retVal->DrainLink);
+		}
+		else
+		{
+			ILibChain_SafeAdd(chain, retVal->DrainLink);
+		}
+	}
 
 	ILibRemoteLogging_RegisterCommandSink(retVal, ILibRemoteLogging_Modules_Logger, ILibRemoteLogging_LoggerCommand_Default);
 
@@ -172,6 +281,7 @@ void ILibRemoteLogging_DeleteUserContext(ILibRemoteLogging logger, void *userCon
 
 	sem_wait(&(obj->LogSyncLock));
 	ILibRemoteLogging_RemoveUserContext(obj->Sessions, sizeof(obj->Sessions) / sizeof(ILibRemoteLogging_Session), userContext);
+	ILibRemoteLogging_UpdateEnabledModules(obj);
 	sem_post(&(obj->LogSyncLock));
 }
 
@@ -200,25 +310,162 @@ void ILibRemoteLogging_SendCommand(ILibRemoteLogging loggingModule, ILibRemoteLo
 		obj->OutputSink(loggingModule, dest, 4+dataLen, userContext);
 	}
 }
-//! Logging method using printf notation
+//
+// Sends a formatted log message to each session that has the module and verbosity enabled
+//
+void ILibRemoteLogging_Deliver(ILibRemoteLogging_Module *obj, ILibRemoteLogging_Modules module, ILibRemoteLogging_Flags flags, char *data, int dataLen)
+{
+	int i;
+
+	sem_wait(&(obj->LogSyncLock));
+	for (i = 0; i < (sizeof(obj->Sessions) / sizeof(ILibRemoteLogging_Session)); ++i)
+	{
+		if (obj->Sessions[i].UserContext == NULL) { break; }								// No more Sessions
+		if ((obj->Sessions[i].Flags & (unsigned int)module) == 0) { continue; }			// Logging for this module is not enabled
+		if (((obj->Sessions[i].Flags >> 16) & 0x3E) < (unsigned short)flags) { continue; }	// Verbosity is not high enough
+		sem_post(&(obj->LogSyncLock));
+		obj->OutputSink(obj, data, dataLen, obj->Sessions[i].UserContext);
+		sem_wait(&(obj->LogSyncLock));
+	}
+	sem_post(&(obj->LogSyncLock));
+}
+
+//
+// Claims the next free record in the ring. Returns NULL if the ring is full
+//
+ILibRemoteLogging_Record* ILibRemoteLogging_Ring_Claim(ILibRemoteLogging_Module *obj, unsigned int *position)
+{
+	ILibRemoteLogging_Record *record;
+	unsigned int pos = obj->RingHead;
+	int dif;
+
+	while (1)
+	{
+		record = &(obj->Ring[pos & (ILibRemoteLogging_RingSize - 1)]);
+		dif = (int)(record->Sequence - pos);
+		if (dif == 0)
+		{
+			if (ILibRemoteLogging_CAS(&(obj->RingHead), pos, pos + 1)) { break; }
+		}
+		else if (dif < 0)
+		{
+			// The chain thread hasn't released this record yet
+			return(NULL);
+		}
+		pos = obj->RingHead;
+	}
+	ILibRemoteLogging_Barrier();
+	*position = pos;
+	return(record);
+}
+
+//
+// Hands a claimed record to the chain thread, waking the chain if it hasn't been woken since it last drained
+//
+void ILibRemoteLogging_Ring_Publish(ILibRemoteLogging_Module *obj, ILibRemoteLogging_Record *record, unsigned int position)
+{
+	ILibRemoteLogging_Barrier();
+	record->Sequence = position + 1;
+	ILibRemoteLogging_Barrier();
+	if (obj->DrainSignaled == 0 && ILibRemoteLogging_CAS(&(obj->DrainSignaled), 0, 1))
+	{
+		ILibForceUnBlockChain(obj->Chain);
+	}
+}
+
+//
+// Delivers all the published records. Only called on the microstack thread
+//
+void ILibRemoteLogging_Ring_Drain(ILibRemoteLogging_Module *obj)
+{
+	ILibRemoteLogging_Record *record;
+	unsigned int dropped;
+	char buf[72];
+	int len;
+
+	while (1)
+	{
+		record = &(obj->Ring[obj->RingTail & (ILibRemoteLogging_RingSize - 1)]);
+		if ((int)(record->Sequence - (obj->RingTail + 1)) < 0) { break; }	// Nothing else has been published
+		ILibRemoteLogging_Barrier();
+
+		ILibRemoteLogging_Deliver(obj, (ILibRemoteLogging_Modules)(ILibRemoteLogging_ReadModuleType(record->Data) & 0x7FFF), ILibRemoteLogging_ReadFlags(record->Data), record->Data, record->Length);
+
+		ILibRemoteLogging_Barrier();
+		record->Sequence = obj->RingTail + ILibRemoteLogging_RingSize;
+		++obj->RingTail;
+	}
+
+	if ((dropped = obj->Dropped) != 0 && ILibRemoteLogging_CAS(&(obj->Dropped), dropped, 0))
+	{
+		((unsigned short*)buf)[0] = htons((unsigned short)ILibRemoteLogging_Modules_Logger | (unsigned short)0x8000);
+		((unsigned short*)buf)[1] = htons(ILibRemoteLogging_Flags_VerbosityLevel_1);
+		len = sprintf_s(buf + 4, sizeof(buf) - 4, "*** ILibRemoteLogging [%u messages dropped] ***", dropped);
+		ILibRemoteLogging_Forward(obj, buf, len + 4);
+	}
+}
+void ILibRemoteLogging_DrainLink_PreSelect(void* object, fd_set *readset, fd_set *writeset, fd_set *errorset, int* blocktime)
+{
+	ILibRemoteLogging_Module *obj = ((ILibRemoteLogging_DrainLink*)object)->Logger;
+
+	UNREFERENCED_PARAMETER(readset);
+	UNREFERENCED_PARAMETER(writeset);
+	UNREFERENCED_PARAMETER(errorset);
+	UNREFERENCED_PARAMETER(blocktime);
+
+	if (obj != NULL)
+	{
+		// Clear the signal first, so a record published while we drain wakes the chain again
+		obj->DrainSignaled = 0;
+		ILibRemoteLogging_Barrier();
+		ILibRemoteLogging_Ring_Drain(obj);
+	}
+}
+void ILibRemoteLogging_DrainLink_Destroy(void *object)
+{
+	ILibRemoteLogging_Module *obj = ((ILibRemoteLogging_DrainLink*)object)->Logger;
+
+	// Records that are still in the ring are discarded. The sessions are being torn down along with the chain
+	if (obj != NULL)
+	{
+		obj->DrainSignaled = 1;		// Producers will no longer wake the chain
+		obj->DrainLink = NULL;
+	}
+}
+
+//! Logging method using printf notation. Use ILibRemoteLogging_printf() instead, so that the arguments aren't evaluated when logging is disabled
 /*!
-	\b NOTE: NO-OP if there is no connected viewers
+	\b NOTE: When the module has a chain, the message is formatted on the calling thread, and delivered on the microstack thread
 	\param loggingModule ILibRemoteLogging Logging Module
 	\param module ILibRemoteLogging_Modules Describing the source of the message
 	\param flags ILibRemoteLogging_Flags Logging Flags
 	\param format printf Format String
 	\param ... Optional parameters
 */
-void ILibRemoteLogging_printf(ILibRemoteLogging loggingModule, ILibRemoteLogging_Modules module, ILibRemoteLogging_Flags flags, char* format, ...)
+void ILibRemoteLogging_printfEx(ILibRemoteLogging loggingModule, ILibRemoteLogging_Modules module, ILibRemoteLogging_Flags flags, char* format, ...)
 {
-	int i;
 	char dest[4096];
-	int len;
+	char *buffer = dest;
+	int bufferLen = (int)sizeof(dest);
+	int len, i;
+	unsigned int position = 0;
+	ILibRemoteLogging_Record *record = NULL;
 	ILibRemoteLogging_Module *obj = (ILibRemoteLogging_Module*)loggingModule;
+	ILibRemoteLogging_OnRawForward rawForward = obj != NULL ? obj->RawForwardSink : NULL;
 
 	va_list argptr;
-	
-	if (obj != NULL && obj->RawForwardSink != NULL)
+
+	if (obj != NULL && rawForward == NULL && obj->Ring != NULL)
+	{
+		// Format directly into the ring, if there is room
+		if ((record = ILibRemoteLogging_Ring_Claim(obj, &position)) != NULL)
+		{
+			buffer = record->Data;
+			bufferLen = (int)sizeof(record->Data);
+		}
+	}
+
+	if (rawForward != NULL)
 	{
 		// When Forwarding, TimeStamp will be added later
 		len = obj->RawForwardOffset;
@@ -226,46 +473,51 @@ void ILibRemoteLogging_printf(ILibRemoteLogging loggingModule, ILibRemoteLogging
 	else
 	{
 		// Add TimeStamp to Log
-		len = ILibGetLocalTime(dest + 4, (int)sizeof(dest) - 4);
-		dest[len + 4] = ':';
-		dest[len + 5] = ' ';
+		len = ILibGetLocalTime(buffer + 4, bufferLen - 4);
+		buffer[len + 4] = ':';
+		buffer[len + 5] = ' ';
 		len += 2;
 
 		len += 4; // Space for header (which isn't needed when forwarding)
 	}
 
-    va_start(argptr, format);
-    len += vsnprintf(dest+len, 4096 - len, format, argptr);
-    va_end(argptr);
-    
-	if (obj != NULL && obj->RawForwardSink != NULL)
+	va_start(argptr, format);
+	i = vsnprintf(buffer + len, bufferLen - len, format, argptr);
+	va_end(argptr);
+	if (i > 0) { len += i; }
+	if (len > bufferLen - 1) { len = bufferLen - 1; }
+
+	if (rawForward != NULL)
 	{
-		obj->RawForwardSink(obj, module, flags, dest, len);
+		rawForward(obj, module, flags, buffer, len);
 	}
-	else if(obj != NULL && obj->OutputSink != NULL)
+	else if (obj != NULL && obj->OutputSink != NULL)
 	{
-		((unsigned short*)dest)[0] = htons((unsigned short)module | (unsigned short)0x8000);
-		((unsigned short*)dest)[1] = htons(flags);
+		((unsigned short*)buffer)[0] = htons((unsigned short)module | (unsigned short)0x8000);
+		((unsigned short*)buffer)[1] = htons(flags);
 
-		if ((module & ILibRemoteLogging_Modules_ConsolePrint) == ILibRemoteLogging_Modules_ConsolePrint) { printf("%s\n", dest + 4); }
+		if ((module & ILibRemoteLogging_Modules_ConsolePrint) == ILibRemoteLogging_Modules_ConsolePrint) { printf("%s\n", buffer + 4); }
 
-		sem_wait(&(obj->LogSyncLock));
-		for(i=0;i<(sizeof(obj->Sessions)/sizeof(ILibRemoteLogging_Session)); ++i)
+		if (record != NULL)
 		{
-			if(obj->Sessions[i].UserContext == NULL) {break;}								// No more Sessions
-			if((obj->Sessions[i].Flags & (unsigned int)module) == 0) {continue;}			// Logging for this module is not enabled
-			if(((obj->Sessions[i].Flags >> 16) & 0x3E) < (unsigned short)flags) {continue;} // Verbosity is not high enough
-			sem_post(&(obj->LogSyncLock));
-			obj->OutputSink(obj, dest, len, obj->Sessions[i].UserContext);
-			sem_wait(&(obj->LogSyncLock));
+			record->Length = len;
+			ILibRemoteLogging_Ring_Publish(obj, record, position);
 		}
-		sem_post(&(obj->LogSyncLock));
-	}	
+		else if (obj->Ring != NULL)
+		{
+			// Ring is full, so rather than block the caller, the message is dropped. The chain thread will report how many were lost.
+			ILibRemoteLogging_Increment(&(obj->Dropped));
+		}
+		else
+		{
+			ILibRemoteLogging_Deliver(obj, module, flags, buffer, len);
+		}
+	}
 	else if (obj == NULL && (module & ILibRemoteLogging_Modules_ConsolePrint) == ILibRemoteLogging_Modules_ConsolePrint)
 	{
-		printf("%s\n", dest + 4);
+		printf("%s\n", buffer + 4);
 	}
-}	
+}
 void ILibRemoteLogging_Dispatch_Update(ILibRemoteLogging_Module *obj, unsigned short module, char* updateString, void *userContext)
 {
 	char temp[255];
@@ -384,6 +636,7 @@ int ILibRemoteLogging_Dispatch(ILibRemoteLogging loggingModule, char* data, int
 		{
 			// Disable Modules
 			session->Flags &= (0xFFFFFFFF ^ module);
+			ILibRemoteLogging_UpdateEnabledModules(obj);
 			sem_post(&(obj->LogSyncLock));
 			ILibRemoteLogging_Dispatch_Update(obj, module, "DISABLED", userContext);
 			
@@ -394,6 +647,7 @@ int ILibRemoteLogging_Dispatch(ILibRemoteLogging loggingModule, char* data, int
 			session->Flags &= 0xFFC0FFFF;							// Reset Verbosity Flags
 			session->Flags |= (flags << 16);						// Set Verbosity Flags
 			session->Flags |= (unsigned int)module;					// Enable Modules
+			ILibRemoteLogging_UpdateEnabledModules(obj);
 			sem_post(&(obj->LogSyncLock));
 			ILibRemoteLogging_Dispatch_Update(obj, module, "ENABLED", userContext);
 		}
@@ -639,6 +893,7 @@ void ILibRemoteLogging_FileTransport_CommandSink(ILibRemoteLogging sender, ILibR
 					unsigned short newFlags = ntohs(((unsigned short*)data)[1]);
 					obj->Sessions[i].Flags = (newFlags & 0x3F) << 16;
 					obj->Sessions[i].Flags |= (unsigned int)newModules;
+					ILibRemoteLogging_UpdateEnabledModules(obj);
 
 					ILibLinkedList_FileBacked_ReloadRoot(ft->logFile);
 					ft->logFile->flags = (unsigned int)ft->enabled << 31;
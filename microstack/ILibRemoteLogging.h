@@ -68,9 +68,18 @@ char* ILibRemoteLogging_ConvertAddress(struct sockaddr* addr);
 
 #ifdef _REMOTELOGGING
 	char* ILibRemoteLogging_ConvertToHex(char* inVal, int inValLength);
-	void ILibRemoteLogging_printf(ILibRemoteLogging loggingModule, ILibRemoteLogging_Modules module, ILibRemoteLogging_Flags flags, char* format, ...);
+	void ILibRemoteLogging_printfEx(ILibRemoteLogging loggingModule, ILibRemoteLogging_Modules module, ILibRemoteLogging_Flags flags, char* format, ...);
 
-	ILibRemoteLogging ILibRemoteLogging_Create(ILibRemoteLogging_OnWrite onOutput);
+	//! Lock free check to see if anything is listening for the specified module/verbosity
+	/*!
+		\b NOTE: The first field of the Logging Module is a table of enabled modules, indexed by verbosity
+	*/
+	#define ILibRemoteLogging_IsEnabled(loggingModule, module, flags) ((loggingModule) == NULL ? (((unsigned int)(module) & (unsigned int)ILibRemoteLogging_Modules_ConsolePrint) != 0) : ((((unsigned int*)(loggingModule))[(unsigned int)(flags) & 0x3F] & (unsigned int)(module)) != 0))
+	//! Logging method using printf notation. Arguments are not evaluated if nothing is listening for the specified module/verbosity
+	#define ILibRemoteLogging_printf(loggingModule, module, flags, ...) do { ILibRemoteLogging _ilibLogger = (ILibRemoteLogging)(loggingModule); if (ILibRemoteLogging_IsEnabled(_ilibLogger, module, flags)) { ILibRemoteLogging_printfEx(_ilibLogger, module, flags, __VA_ARGS__); } } while (0)
+
+	ILibRemoteLogging ILibRemoteLogging_CreateEx(void *chain, ILibRemoteLogging_OnWrite onOutput);
+	#define ILibRemoteLogging_Create(onOutput) ILibRemoteLogging_CreateEx(NULL, onOutput)
 	ILibTransport* ILibRemoteLogging_CreateFileTransport(ILibRemoteLogging loggingModule, ILibRemoteLogging_Modules modules, ILibRemoteLogging_Flags flags, char* path, int pathLen);
 	void ILibRemoteLogging_Destroy(ILibRemoteLogging logger);
 	void ILibRemoteLogging_SetRawForward(ILibRemoteLogging logger, int bufferOffset, ILibRemoteLogging_OnRawForward onRawForward);
@@ -85,7 +94,10 @@ char* ILibRemoteLogging_ConvertAddress(struct sockaddr* addr);
 #else
 	#define ILibRemoteLogging_ConvertToHex(...) ;
 	#define ILibRemoteLogging_printf(...) ;
+	#define ILibRemoteLogging_printfEx(...) ;
+	#define ILibRemoteLogging_IsEnabled(...) 0
 	#define ILibRemoteLogging_Create(...) NULL;
+	#define ILibRemoteLogging_CreateEx(...) NULL;
 	#define ILibRemoteLogging_SetRawForward(...) ;
 	#define ILibRemoteLogging_CreateFileTransport(...) NULL;
 	#define ILibRemoteLogging_Destroy(...) ;
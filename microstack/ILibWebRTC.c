@@ -32,6 +32,8 @@ limitations under the License.
 #include <wininet.h>
 #endif
 
+#include <math.h>
+
 #include "ILibParsers.h"
 #include "ILibAsyncSocket.h"
 #include "ILibAsyncUDPSocket.h"
@@ -51,10 +53,15 @@ limitations under the License.
 #define ILibRUDP_StartMTU 1400
 #define ILibRUDP_MaxMTU 2048
 
-#define RTO_MIN 1000
+#define RTO_MIN 1000							// RTO.Initial, also used as the base for RE-CONFIG backoff
 #define RTO_MAX 6000
 #define RTO_ALPHA 0.125
 #define RTO_BETA 0.25
+#define ILibSCTP_RTO_FLOOR 200					// Default RTO.Min for DATA, configurable per association. RFC 4960 Section 15 recommends 1 second, this is the 200ms minimum that Linux TCP uses (TCP_RTO_MIN)
+#define ILibSCTP_RTO_GRANULARITY 100			// Clock Granularity (G) of the SCTP retransmit timer (RFC 6298 Section 2)
+#define ILibSCTP_RACK_MIN_REORDER_WINDOW 10		// Minimum reordering window (ms) used by RACK loss detection
+#define ILibSCTP_CUBIC_C 0.4
+#define ILibSCTP_CUBIC_BETA 0.7
 
 #define ILibSCTP_MaxReceiverCredits 100000
 #define ILibSCTP_MaxSenderCredits 0				// When we do real-time traffic, reduce the buffering. In theory, this should never be used, leave to zero
@@ -63,8 +70,12 @@ limitations under the License.
 #define ILibSTUN_MaxSlots 10					// MUST be less then 128, otherwise IceSlot and dtlsSlot will collide
 #define ILibSTUN_MaxOfferAgeSeconds 60			// Offers are only valid for this amount of time
 #define ILibSCTP_FastRetry_GAP 3
+#define ILibSCTP_GAP_RETRANSMITTED 0xFC			// PacketGAPCounter: Packet was already Fast Retransmitted, only T3-RTX or RACK can retransmit it again
 
 #define ILibSCTP_UnorderedFlag 0x04
+#define ILibSCTP_DATA_FragmentSize 1232			// Largest user payload carried by a single DATA chunk
+#define ILibSCTP_IDATA_FragmentSize 1228		// I-DATA chunk header is 4 bytes larger, so the payload is 4 bytes smaller (RFC 8260)
+#define ILibSCTP_UnorderedAccumulatorKey 0x10000	// DataAccumulator key bit, so ordered and unordered messages on the same stream don't collide
 
 //
 // NAT Keep Alive Interval. We'll use a random value between these two values
@@ -97,6 +108,7 @@ limitations under the License.
 #define NAT_MAPPING_DETECTION(TransactionID) (TransactionID[11])
 #define DTLS_PAUSE_FLAG 0x01
 #define DTLS_RESUME_FLAG 0x02
+#define DTLS_IDATA_FLAG 0x04					// Both sides support I-DATA, so User Messages can be interleaved (RFC 8260)
 
 #define ILibTURN_FLAGS_DATA_INDICATION 0x10000
 #define ILibTURN_FLAGS_CHANNEL_DATA 0x20000
@@ -271,9 +283,11 @@ typedef enum RCTP_CHUNK_TYPES
 	RCTP_CHUNK_TYPE_COOKIEECHO = 0x000A,
 	RCTP_CHUNK_TYPE_COOKIEACK = 0x000B,
 	RCTP_CHUNK_TYPE_ECNE = 0x000C,
+	RCTP_CHUNK_TYPE_IDATA = 0x0040,
 	RCTP_CHUNK_TYPE_RECONFIG = 0x0082,
 	RCTP_CHUNK_TYPE_FWDTSN = 0x00C0,
 	RCTP_CHUNK_TYPE_ASCONF = 0x00C1,
+	RCTP_CHUNK_TYPE_IFWDTSN = 0x00C2,
 	RCTP_CHUNK_TYPE_ASCONFACK = 0x0080
 } RCTP_CHUNK_TYPES;
 
@@ -448,6 +462,8 @@ typedef struct ILibSCTP_RPACKET
 	char GAP[12];
 	char Data[];
 }ILibSCTP_RPACKET;
+// Size of the chunk in a queued packet, less the DATA or I-DATA chunk header. The credits, and the pending and holding byte counts, are all kept in these units
+#define ILibSCTP_RPACKET_PayloadSize(rpacket) ((rpacket)->PacketSize - (12 + (((ILibSCTP_ChunkHeader*)(rpacket)->Data)->chunkType == RCTP_CHUNK_TYPE_IDATA ? 20 : 16)))
 
 typedef struct ILibSCTP_DataPayload
 {
@@ -460,6 +476,18 @@ typedef struct ILibSCTP_DataPayload
 	unsigned int ProtocolID;
 	char UserData[];
 }ILibSCTP_DataPayload;
+typedef struct ILibSCTP_IDataPayload
+{
+	unsigned char type;
+	unsigned char flags;
+	unsigned short length;
+	unsigned int TSN;
+	unsigned short StreamID;
+	unsigned short Reserved;
+	unsigned int MessageID;
+	unsigned int ProtocolID_FSN;		// Payload Protocol Identifier on the first fragment, Fragment Sequence Number on the rest
+	char UserData[];
+}ILibSCTP_IDataPayload;
 typedef struct ILibSCTP_FwdTSNPayload_Stream
 {
 	unsigned int StreamNumber;
@@ -504,8 +532,25 @@ typedef struct ILibSCTP_Accumulator
 	char *buffer;
 	int bufferPtr;
 	int bufferLen;
+	int pid;
 }ILibSCTP_Accumulator;
 
+//
+// Outbound packets that are waiting for credits are queued per stream. Streams that have queued packets
+// are linked in a circular list, which the scheduler walks round-robin, weighted by Priority.
+//
+typedef struct ILibSCTP_OutboundStream
+{
+	struct ILibSCTP_OutboundStream *NextActive;
+	ILibSCTP_RPACKET *Head;
+	ILibSCTP_RPACKET *Tail;
+	unsigned int NextMessageID;
+	unsigned short StreamID;
+	unsigned short Priority;		// Number of chunks this stream may send before yielding to the next stream
+	unsigned short Burst;
+	unsigned short Active;
+}ILibSCTP_OutboundStream;
+
 ILibSCTP_Accumulator* ILibSCTP_CreateAccumulator()
 {
 	ILibSCTP_Accumulator* retVal = (ILibSCTP_Accumulator*)malloc(sizeof(ILibSCTP_Accumulator));
@@ -726,6 +771,7 @@ typedef struct ILibStun_dTlsSession
 	ILibSparseArray DataChannelMetaDetaValues;
 	ILibSparseArray PeerFeatureSet;
 	ILibSparseArray DataAccumulator;
+	ILibSparseArray OutboundStreams;
 
 	unsigned short maxInStreams;
 	unsigned short maxOutStreams;
@@ -749,8 +795,7 @@ typedef struct ILibStun_dTlsSession
 	char* pendingQueueTail;
 	unsigned short holdingCount;
 	unsigned int holdingByteCount;
-	char* holdingQueueHead;
-	char* holdingQueueTail;
+	ILibSCTP_OutboundStream* schedulerCursor;
 
 	ILibLinkedList receiveHoldBuffer;
 	BIO *writeBIO;
@@ -789,7 +834,18 @@ typedef struct ILibStun_dTlsSession
 	int SRTT;
 	int RTTVAR;
 	int RTO;
+	int minRTO;
 	unsigned int T3RTXTIME;
+
+	ILibSCTP_CongestionControl congestionControl;
+	int cubicWmax;
+	int cubicOriginPoint;
+	int cubicTcpWindow;
+	double cubicK;
+	unsigned int cubicEpochStart;
+
+	unsigned int rackXmitTime;				// Send time of the most recently sent packet that was delivered
+	int rackRTT;							// RTT measured from that packet
 }ILibStun_dTlsSession;
 
 typedef struct ILibStun_Module
@@ -852,9 +908,11 @@ typedef struct ILibStun_Module
 	int allocationLifetime;
 
 	int consentFreshnessDisabled;
+	ILibSCTP_CongestionControl defaultCongestionControl;
 
 #ifdef _WEBRTCDEBUG
 	int lossPercentage;
+	unsigned int lossSeed;
 	int inboundDropPackets;
 	int outboundDropPackets;
 #endif
@@ -1034,12 +1092,35 @@ void ILibWebRTC_DestroySparseArrayTables_Accumulator(ILibSparseArray sender, int
 		free(acc);
 	}
 }
+void ILibWebRTC_DestroySparseArrayTables_OutboundStream(ILibSparseArray sender, int index, void *value, void *user)
+{
+	ILibSCTP_OutboundStream *stream = (ILibSCTP_OutboundStream*)value;
+	ILibSCTP_RPACKET *packet;
+
+	UNREFERENCED_PARAMETER(sender);
+	UNREFERENCED_PARAMETER(index);
+	UNREFERENCED_PARAMETER(user);
+
+	if (stream != NULL)
+	{
+		// Free all packets that are still held for this stream
+		while (stream->Head != NULL)
+		{
+			packet = stream->Head->NextPacket;
+			free(stream->Head);
+			stream->Head = packet;
+		}
+		free(stream);
+	}
+}
 void ILibWebRTC_DestroySparseArrayTables(struct ILibStun_dTlsSession *obj)
 {
 	ILibSparseArray_Destroy(obj->DataChannelMetaDeta);
 	ILibSparseArray_Destroy(obj->PeerFeatureSet);
 	ILibSparseArray_Destroy(obj->DataChannelMetaDetaValues);
 	ILibSparseArray_DestroyEx(obj->DataAccumulator, &ILibWebRTC_DestroySparseArrayTables_Accumulator, NULL);
+	ILibSparseArray_DestroyEx(obj->OutboundStreams, &ILibWebRTC_DestroySparseArrayTables_OutboundStream, NULL);
+	obj->schedulerCursor = NULL;
 }
 void ILibWebRTC_CreateSparseArrayTables(struct ILibStun_dTlsSession *obj)
 {
@@ -1047,6 +1128,7 @@ void ILibWebRTC_CreateSparseArrayTables(struct ILibStun_dTlsSession *obj)
 	obj->PeerFeatureSet = ILibSparseArray_Create(ILibSCTP_Stream_SparseArraySize, &ILibWebRTC_DataChannelBucketizer);
 	obj->DataChannelMetaDetaValues = ILibSparseArray_Create(ILibSCTP_Stream_SparseArraySize, &ILibWebRTC_DataChannelBucketizer);
 	obj->DataAccumulator = ILibSparseArray_Create(ILibSCTP_Stream_SparseArraySize, &ILibWebRTC_DataChannelBucketizer);
+	obj->OutboundStreams = ILibSparseArray_Create(ILibSCTP_Stream_SparseArraySize, &ILibWebRTC_DataChannelBucketizer);
 }
 
 char* SCTP_ERROR_CAUSE_TO_STRING(ILibSCTP_ErrorCause_Header *cause)
@@ -1340,6 +1422,71 @@ void ILibSCTP_SetUser3(void* module, int user) { ((struct ILibStun_dTlsSession*)
 int ILibSCTP_GetUser3(void* module) { return ((struct ILibStun_dTlsSession*)module)->User3; }
 void ILibSCTP_SetUser4(void* module, int user) { ((struct ILibStun_dTlsSession*)module)->User4 = user; }
 int ILibSCTP_GetUser4(void* module) { return ((struct ILibStun_dTlsSession*)module)->User4; }
+
+//! Set the Congestion Controller that will be used by new SCTP Associations
+/*!
+	\param StunModule The Stun Module to configure
+	\param cc Congestion Controller
+*/
+void ILibSCTP_SetDefaultCongestionControl(void *StunModule, ILibSCTP_CongestionControl cc) { ((struct ILibStun_Module*)StunModule)->defaultCongestionControl = cc; }
+//! Change the Congestion Controller used by an SCTP Association
+/*!
+	\param SctpSession The SCTP Association to configure
+	\param cc Congestion Controller
+*/
+void ILibSCTP_SetCongestionControl(void* SctpSession, ILibSCTP_CongestionControl cc)
+{
+	struct ILibStun_dTlsSession *obj = (struct ILibStun_dTlsSession*)SctpSession;
+	ILibSpinLock_Lock(&(obj->Lock));
+	if (obj->congestionControl != cc)
+	{
+		obj->congestionControl = cc;
+		obj->cubicWmax = obj->congestionWindowSize;
+		obj->cubicEpochStart = 0;
+	}
+	ILibSpinLock_UnLock(&(obj->Lock));
+}
+ILibSCTP_CongestionControl ILibSCTP_GetCongestionControl(void* SctpSession) { return(((struct ILibStun_dTlsSession*)SctpSession)->congestionControl); }
+//! Set RTO.Min for an SCTP Association
+/*!
+	\param SctpSession The SCTP Association to configure
+	\param minRTO Minimum Retransmission Timeout in milliseconds (Clamped to [ILibSCTP_RTO_GRANULARITY, RTO_MAX])
+*/
+void ILibSCTP_SetMinRTO(void* SctpSession, int minRTO)
+{
+	struct ILibStun_dTlsSession *obj = (struct ILibStun_dTlsSession*)SctpSession;
+	if (minRTO < ILibSCTP_RTO_GRANULARITY) { minRTO = ILibSCTP_RTO_GRANULARITY; }
+	if (minRTO > RTO_MAX) { minRTO = RTO_MAX; }
+	ILibSpinLock_Lock(&(obj->Lock));
+	obj->minRTO = minRTO;
+	if (obj->RTO < minRTO) { obj->RTO = minRTO; }
+	ILibSpinLock_UnLock(&(obj->Lock));
+}
+ILibSCTP_OutboundStream* ILibSCTP_GetOutboundStream(struct ILibStun_dTlsSession *o, unsigned short streamId);
+//! Set the scheduling priority of an outbound stream
+/*!
+	\param SctpSession The SCTP Association to configure
+	\param streamId Stream Identifier
+	\param priority Number of chunks the stream may send, each time the scheduler visits it (Default is 1, 0 is treated as 1)
+*/
+void ILibSCTP_SetStreamPriority(void* SctpSession, unsigned short streamId, unsigned short priority)
+{
+	struct ILibStun_dTlsSession *obj = (struct ILibStun_dTlsSession*)SctpSession;
+	ILibSpinLock_Lock(&(obj->Lock));
+	ILibSCTP_GetOutboundStream(obj, streamId)->Priority = priority == 0 ? 1 : priority;
+	ILibSpinLock_UnLock(&(obj->Lock));
+}
+unsigned short ILibSCTP_GetStreamPriority(void* SctpSession, unsigned short streamId)
+{
+	ILibSCTP_OutboundStream *stream = (ILibSCTP_OutboundStream*)ILibSparseArray_Get(((struct ILibStun_dTlsSession*)SctpSession)->OutboundStreams, streamId);
+	return(stream == NULL ? 1 : stream->Priority);
+}
+//! Determine if User Messages can be interleaved on an SCTP Association
+/*!
+	\param SctpSession The SCTP Association to query
+	\return 0 = DATA chunks (Messages are scheduled whole), 1 = I-DATA chunks (Messages are interleaved)
+*/
+int ILibSCTP_IsInterleavingSupported(void* SctpSession) { return((((struct ILibStun_dTlsSession*)SctpSession)->flags & DTLS_IDATA_FLAG) == DTLS_IDATA_FLAG); }
 //! Get the number of bytes that are pending in the send buffer
 /*!
 	\param sctpSession The SCTP Session to query
@@ -3074,6 +3221,21 @@ void ILibORTC_AddRemoteCandidate(void *stunModule, char* localUsername, struct s
 	ILibStun_ProcessCandidates(stunModule, slot);
 }
 
+#ifdef _WEBRTCDEBUG
+//
+// Simulated loss uses its own xorshift generator, so that a given seed always drops the same packets
+//
+unsigned int ILibSCTP_SimulatedLoss_Next(struct ILibStun_Module *obj)
+{
+	unsigned int x = obj->lossSeed == 0 ? 0x9E3779B9 : obj->lossSeed;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	obj->lossSeed = x;
+	return(x);
+}
+#endif
+
 ILibTransport_DoneState ILibStun_SendDtls(struct ILibStun_Module *obj, int session, char* buffer, int bufferLength)
 {
 	ILibTransport_DoneState r = ILibTransport_DoneState_ERROR;
@@ -3081,7 +3243,7 @@ ILibTransport_DoneState ILibStun_SendDtls(struct ILibStun_Module *obj, int sessi
 
 #ifdef _WEBRTCDEBUG
 	// Simulated Inbound Packet Loss
-	if ((obj->lossPercentage) > 0 && ((rand() % 100) >= (100 - obj->lossPercentage))) { return(ILibTransport_DoneState_COMPLETE); }
+	if ((obj->lossPercentage) > 0 && (ILibSCTP_SimulatedLoss_Next(obj) % 100) >= (unsigned int)(100 - obj->lossPercentage)) { return(ILibTransport_DoneState_COMPLETE); }
 #endif
 
 	SSL_write(obj->dTlsSessions[session]->ssl, buffer, bufferLength);
@@ -3278,26 +3440,148 @@ int ILibStun_SctpAddSackChunk(struct ILibStun_Module *obj, int session, char* pa
 	return (ptr + clen);
 }
 
-ILibTransport_DoneState ILibStun_SctpSendDataEx(struct ILibStun_Module *obj, int session, unsigned char flags, unsigned short streamid, unsigned short streamnum, int pid, char* data, int datalen)
+ILibSCTP_OutboundStream* ILibSCTP_GetOutboundStream(struct ILibStun_dTlsSession *o, unsigned short streamId)
+{
+	ILibSCTP_OutboundStream *stream = (ILibSCTP_OutboundStream*)ILibSparseArray_Get(o->OutboundStreams, streamId);
+	if (stream == NULL)
+	{
+		if ((stream = (ILibSCTP_OutboundStream*)malloc(sizeof(ILibSCTP_OutboundStream))) == NULL) { ILIBCRITICALEXIT(254); }
+		memset(stream, 0, sizeof(ILibSCTP_OutboundStream));
+		stream->StreamID = streamId;
+		stream->Priority = 1;
+		ILibSparseArray_Add(o->OutboundStreams, streamId, stream);
+	}
+	return(stream);
+}
+
+//
+// Reset the Message Identifier of an outbound stream, along with the Stream Sequence Number, when the stream is reset
+//
+void ILibSCTP_ResetOutboundStream(ILibSparseArray sender, int index, void *value, void *user)
+{
+	UNREFERENCED_PARAMETER(sender);
+	UNREFERENCED_PARAMETER(index);
+	UNREFERENCED_PARAMETER(user);
+
+	if (value != NULL) { ((ILibSCTP_OutboundStream*)value)->NextMessageID = 0; }
+}
+
+//
+// Add a packet that doesn't have credits to be sent, to the holding queue of its stream
+//
+void ILibSCTP_Scheduler_Enqueue(struct ILibStun_dTlsSession *o, unsigned short streamId, ILibSCTP_RPACKET *packet)
+{
+	ILibSCTP_OutboundStream *stream = ILibSCTP_GetOutboundStream(o, streamId);
+
+	packet->NextPacket = NULL;
+	if (stream->Tail == NULL) { stream->Head = packet; }
+	else { stream->Tail->NextPacket = packet; }
+	stream->Tail = packet;
+
+	if (stream->Active == 0)
+	{
+		// Link this stream right after the current one, so a newly active stream doesn't have to wait an entire round
+		stream->Active = 1;
+		stream->Burst = 0;
+		if (o->schedulerCursor == NULL)
+		{
+			stream->NextActive = stream;
+			o->schedulerCursor = stream;
+		}
+		else
+		{
+			stream->NextActive = o->schedulerCursor->NextActive;
+			o->schedulerCursor->NextActive = stream;
+		}
+	}
+
+	o->holdingCount++;
+	o->holdingByteCount += ILibSCTP_RPACKET_PayloadSize(packet);
+}
+
+ILibSCTP_RPACKET* ILibSCTP_Scheduler_Peek(struct ILibStun_dTlsSession *o)
+{
+	return(o->schedulerCursor == NULL ? NULL : o->schedulerCursor->Head);
+}
+
+//
+// Remove the next packet to be sent from the holding queues. Streams are serviced round-robin, and each stream
+// may send 'Priority' chunks before yielding. When I-DATA is not negotiated, fragments of a User Message must use
+// consecutive TSNs, so the scheduler only yields on message boundaries. Partially reliable messages are always kept
+// whole, so a single FORWARD-TSN can abandon them.
+//
+ILibSCTP_RPACKET* ILibSCTP_Scheduler_Dequeue(struct ILibStun_dTlsSession *o)
+{
+	ILibSCTP_OutboundStream *stream = o->schedulerCursor;
+	ILibSCTP_OutboundStream *prev;
+	ILibSCTP_RPACKET *packet;
+
+	if (stream == NULL || stream->Head == NULL) { return(NULL); }
+
+	packet = stream->Head;
+	stream->Head = packet->NextPacket;
+	if (stream->Head == NULL) { stream->Tail = NULL; }
+	packet->NextPacket = NULL;
+
+	o->holdingCount--;
+	o->holdingByteCount -= ILibSCTP_RPACKET_PayloadSize(packet);
+
+	if (stream->Head != NULL && (((ILibSCTP_DataPayload*)packet->Data)->flags & 0x01) == 0 && ((o->flags & DTLS_IDATA_FLAG) == 0 || (packet->Reliability & 0x6000) != 0))
+	{
+		return(packet); // Middle of a User Message that can't be interleaved
+	}
+	if (stream->Head != NULL && ++stream->Burst < stream->Priority)
+	{
+		return(packet); // This stream still has some of its share left
+	}
+
+	stream->Burst = 0;
+	if (stream->Head == NULL)
+	{
+		// Nothing left on this stream, so unlink it
+		stream->Active = 0;
+		if (stream->NextActive == stream)
+		{
+			o->schedulerCursor = NULL;
+		}
+		else
+		{
+			prev = stream->NextActive;
+			while (prev->NextActive != stream) { prev = prev->NextActive; }
+			prev->NextActive = stream->NextActive;
+			o->schedulerCursor = stream->NextActive;
+		}
+		stream->NextActive = NULL;
+	}
+	else
+	{
+		o->schedulerCursor = stream->NextActive;
+	}
+	return(packet);
+}
+
+//
+// seq is the Stream Sequence Number for DATA, or the Message Identifier for I-DATA. fsn is only used for I-DATA.
+//
+ILibTransport_DoneState ILibStun_SctpSendDataEx(struct ILibStun_Module *obj, int session, unsigned char flags, unsigned short streamid, unsigned int seq, unsigned int fsn, int pid, char* data, int datalen)
 {
 	ILibSCTP_StreamAttributes sattr;
 	ILibSCTP_StreamAttributes_Data sattrData;
 	int rptr = sizeof(ILibSCTP_RPACKET);
 	ILibSCTP_RPACKET *rpacket;
-	unsigned int tsn = obj->dTlsSessions[session]->outtsn;
-	obj->dTlsSessions[session]->outtsn++;
-
-	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "SCTP[%d] ILibStun_SctpSendDataEx -> outtsn = %u", session, tsn);
+	unsigned int tsn;
+	int idata = (obj->dTlsSessions[session]->flags & DTLS_IDATA_FLAG) == DTLS_IDATA_FLAG;
+	int hdrlen = idata ? 20 : 16;
 
 	// Create data packet, allow for a header in front.
-	size_t newlen = sizeof(ILibSCTP_RPACKET) + datalen + 16;
+	size_t newlen = sizeof(ILibSCTP_RPACKET) + datalen + hdrlen;
 	newlen = FOURBYTEBOUNDARY(newlen);
 
 	if ((rpacket = (ILibSCTP_RPACKET*)malloc(newlen)) == NULL) ILIBCRITICALERREXIT(254);
 	memset(rpacket, 0, newlen);
 	rpacket->Reliability = 0;																					// Full Reliable Mode (Default)
 	rpacket->NextPacket = NULL;																					// Pointer to the next packet (Used for queuing)
-	rpacket->PacketSize = (unsigned short)(12 + 16 + FOURBYTEBOUNDARY(datalen));								// Size of the packet (Used for queuing)	
+	rpacket->PacketSize = (unsigned short)(12 + hdrlen + FOURBYTEBOUNDARY(datalen));							// Size of the packet (Used for queuing)	
 	rpacket->PacketGAPCounter = rpacket->PacketResendCounter = 0;												// Number of times the packet was resent (Used for retry)
 	rpacket->LastSentTimeStamp = 0;																				// Last time the packet was sent (Used for retry)
 	rpacket->CreationTimeStamp = (unsigned int)ILibGetUptime();
@@ -3312,37 +3596,43 @@ ILibTransport_DoneState ILibStun_SctpSendDataEx(struct ILibStun_Module *obj, int
 
 	// There is a 12 byte GAP here to accomodate SCTP Common Header, if necessary
 
-	ILibStun_AddSctpChunkHeader(rpacket->Data, 0, RCTP_CHUNK_TYPE_DATA, flags, (unsigned short)(16 + datalen));	// Setup the data chunk header
-	
-	((ILibSCTP_DataPayload*)rpacket->Data)->TSN = htonl(tsn);													// Cumulative TSN Ack
-	((ILibSCTP_DataPayload*)rpacket->Data)->StreamID = htons(streamid);											// Stream Identifier
-	((ILibSCTP_DataPayload*)rpacket->Data)->StreamSequenceNumber = htons(streamnum);							// Stream Sequence Number
-	((ILibSCTP_DataPayload*)rpacket->Data)->ProtocolID = htonl(pid);											// Payload Protocol Identifier
-	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...TSN [%u]", tsn);
-	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...SEQ [%u]", ((ILibSCTP_DataPayload*)rpacket->Data)->StreamSequenceNumber);
-
-	memcpy_s(((ILibSCTP_DataPayload*)rpacket->Data)->UserData, datalen + 16, data, datalen);									// Copy the user data
-	rptr += (16 + datalen);
-	RCTPDEBUG(printf("OUT DATA_CHUNK FLAGS: %d, TSN: %u, ID: %d, SEQ: %d, PID: %u, SIZE: %d\r\n", flags, tsn, streamid, streamnum, pid, datalen);)
+	if (idata)
+	{
+		ILibStun_AddSctpChunkHeader(rpacket->Data, 0, RCTP_CHUNK_TYPE_IDATA, flags, (unsigned short)(20 + datalen));	// Setup the I-DATA chunk header
+		((ILibSCTP_IDataPayload*)rpacket->Data)->StreamID = htons(streamid);										// Stream Identifier
+		((ILibSCTP_IDataPayload*)rpacket->Data)->MessageID = htonl(seq);											// Message Identifier
+		((ILibSCTP_IDataPayload*)rpacket->Data)->ProtocolID_FSN = (flags & 0x02) ? htonl(pid) : htonl(fsn);		// PPID on the first fragment, FSN on the rest
+		memcpy_s(((ILibSCTP_IDataPayload*)rpacket->Data)->UserData, datalen, data, datalen);						// Copy the user data
+	}
+	else
+	{
+		ILibStun_AddSctpChunkHeader(rpacket->Data, 0, RCTP_CHUNK_TYPE_DATA, flags, (unsigned short)(16 + datalen));	// Setup the data chunk header
+		((ILibSCTP_DataPayload*)rpacket->Data)->StreamID = htons(streamid);											// Stream Identifier
+		((ILibSCTP_DataPayload*)rpacket->Data)->StreamSequenceNumber = htons((unsigned short)seq);					// Stream Sequence Number
+		((ILibSCTP_DataPayload*)rpacket->Data)->ProtocolID = htonl(pid);											// Payload Protocol Identifier
+		memcpy_s(((ILibSCTP_DataPayload*)rpacket->Data)->UserData, datalen + 16, data, datalen);					// Copy the user data
+	}
+	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...SEQ [%u]", seq);
+	rptr += (hdrlen + datalen);
 
 	// Check the credits
-	if ((obj->dTlsSessions[session]->receiverCredits < datalen) || datalen > obj->dTlsSessions[session]->senderCredits || (obj->dTlsSessions[session]->holdingCount != 0))
+	if ((obj->dTlsSessions[session]->receiverCredits < ILibSCTP_RPACKET_PayloadSize(rpacket)) || ILibSCTP_RPACKET_PayloadSize(rpacket) > obj->dTlsSessions[session]->senderCredits || (obj->dTlsSessions[session]->holdingCount != 0))
 	{
 		ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...To Holding Queue (%u bytes)", rpacket->PacketSize);
 		ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "......LEN: %u", ntohs(((ILibSCTP_DataPayload*)rpacket->Data)->length));
 
-		// Add this packet to the holding queue
-		if (obj->dTlsSessions[session]->holdingQueueTail == NULL) { obj->dTlsSessions[session]->holdingQueueHead = (char*)rpacket; }
-		else { ((char**)(obj->dTlsSessions[session]->holdingQueueTail))[0] = (char*)rpacket; }
-		obj->dTlsSessions[session]->holdingQueueTail = (char*)rpacket;
-		obj->dTlsSessions[session]->holdingCount++;
-		obj->dTlsSessions[session]->holdingByteCount += datalen;
-		// if (obj->dTlsSessions[session]->holdingCount == 1) printf("HOLD\r\n");
+		// Add this packet to the holding queue of this stream. The TSN is assigned when the scheduler releases it.
+		ILibSCTP_Scheduler_Enqueue(obj->dTlsSessions[session], streamid, rpacket);
 #ifdef _WEBRTCDEBUG
 		if (obj->dTlsSessions[session]->onHold != NULL) { obj->dTlsSessions[session]->onHold(obj->dTlsSessions[session], "OnHold", obj->dTlsSessions[session]->holdingCount); }
 #endif
 		return ILibTransport_DoneState_INCOMPLETE; // Hold, we don't have anymore credits
 	}
+
+	tsn = obj->dTlsSessions[session]->outtsn++;
+	((ILibSCTP_DataPayload*)rpacket->Data)->TSN = htonl(tsn);
+	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "SCTP[%d] ILibStun_SctpSendDataEx -> outtsn = %u", session, tsn);
+	RCTPDEBUG(printf("OUT DATA_CHUNK FLAGS: %d, TSN: %u, ID: %d, SEQ: %u, PID: %u, SIZE: %d\r\n", flags, tsn, streamid, seq, pid, datalen);)
 	
 	// Update the packet retry data
 	rpacket->LastSentTimeStamp = rpacket->CreationTimeStamp;								// Last time the packet was sent (Used for retry)
@@ -3359,8 +3649,8 @@ ILibTransport_DoneState ILibStun_SctpSendDataEx(struct ILibStun_Module *obj, int
 	// Add this packet to the pending ack queue
 	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...Added to Pending ACK Queue");
 
-	obj->dTlsSessions[session]->receiverCredits -= datalen; // Receiver Window
-	obj->dTlsSessions[session]->senderCredits -= datalen;   // Congestion Window
+	obj->dTlsSessions[session]->receiverCredits -= ILibSCTP_RPACKET_PayloadSize(rpacket);	// Receiver Window, same units as the refund when the packet is acknowledged
+	obj->dTlsSessions[session]->senderCredits -= ILibSCTP_RPACKET_PayloadSize(rpacket);		// Congestion Window
 
 	if (obj->dTlsSessions[session]->pendingQueueTail == NULL) 
 	{
@@ -3375,7 +3665,7 @@ ILibTransport_DoneState ILibStun_SctpSendDataEx(struct ILibStun_Module *obj, int
 	obj->dTlsSessions[session]->pendingQueueTail = (char*)rpacket;
 	obj->dTlsSessions[session]->pendingCount++;
 	
-	obj->dTlsSessions[session]->pendingByteCount += (rpacket->PacketSize - (12 + 16));
+	obj->dTlsSessions[session]->pendingByteCount += ILibSCTP_RPACKET_PayloadSize(rpacket);
 
 #ifdef _WEBRTCDEBUG
 	// Debug Event
@@ -3383,7 +3673,7 @@ ILibTransport_DoneState ILibStun_SctpSendDataEx(struct ILibStun_Module *obj, int
 #endif
 
 	// Send the packet now
-	if ((flags & 0x03) == 0x03 && obj->dTlsSessions[session]->rpacketptr > 0 && obj->dTlsSessions[session]->rpacketsize > (obj->dTlsSessions[session]->rpacketptr + 16 + datalen + 4) && (obj->dTlsSessions[session]->rpacketptr + 16 + datalen + 4) < 1400)
+	if ((flags & 0x03) == 0x03 && obj->dTlsSessions[session]->rpacketptr > 0 && obj->dTlsSessions[session]->rpacketsize > (obj->dTlsSessions[session]->rpacketptr + hdrlen + datalen + 4) && (obj->dTlsSessions[session]->rpacketptr + hdrlen + datalen + 4) < 1400)
 	{
 		int st;
 		// Merge this data chunk in packet that is going to be sent
@@ -3397,8 +3687,8 @@ ILibTransport_DoneState ILibStun_SctpSendDataEx(struct ILibStun_Module *obj, int
 		{
 			ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...Aligning on 4 byte boundary [%d => %d]", st, obj->dTlsSessions[session]->rpacketptr);
 		}
-		memcpy_s(obj->dTlsSessions[session]->rpacket + obj->dTlsSessions[session]->rpacketptr, 16 + datalen, rpacket->Data, 16 + datalen);
-		obj->dTlsSessions[session]->rpacketptr += FOURBYTEBOUNDARY(16 + datalen);	
+		memcpy_s(obj->dTlsSessions[session]->rpacket + obj->dTlsSessions[session]->rpacketptr, hdrlen + datalen, rpacket->Data, hdrlen + datalen);
+		obj->dTlsSessions[session]->rpacketptr += FOURBYTEBOUNDARY(hdrlen + datalen);	
 		((int*)obj->dTlsSessions[session]->rpacket)[2] |= SCTP_COMMON_HEADER_FLAGS_DATA;
 	}
 	else
@@ -3419,7 +3709,9 @@ ILibTransport_DoneState ILibStun_SctpSendData(struct ILibStun_Module *obj, int s
 	unsigned char flags = 0; // 2 = Start, 0 = Middle, 1 = End, 3 = Start & End
 	ILibSCTP_StreamAttributes attr;
 	ILibSCTP_StreamAttributes_Data attrData;
-	unsigned short seq;
+	unsigned int seq;
+	unsigned int fsn = 0;
+	int fragmentSize = ILibSCTP_DATA_FragmentSize;
 
 	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "ILibStun_SctpSendData[%d]: %d bytes (SID: %u, PID: %d)", session, datalen, streamid, pid);
 
@@ -3434,17 +3726,22 @@ ILibTransport_DoneState ILibStun_SctpSendData(struct ILibStun_Module *obj, int s
 
 	seq = attrData.Data.NextSequenceNumber++;
 	ILibSparseArray_Add(obj->dTlsSessions[session]->DataChannelMetaDetaValues, streamid, attrData.Raw);
-
+	if ((obj->dTlsSessions[session]->flags & DTLS_IDATA_FLAG) == DTLS_IDATA_FLAG)
+	{
+		// I-DATA uses a 32 bit Message Identifier instead of the 16 bit Stream Sequence Number
+		seq = ILibSCTP_GetOutboundStream(obj->dTlsSessions[session], streamid)->NextMessageID++;
+		fragmentSize = ILibSCTP_IDATA_FragmentSize;
+	}
 
 	// Send the data in one block
-	if (datalen <= 1232) return ILibStun_SctpSendDataEx(obj, session, 3, streamid, seq, pid, data, datalen);
+	if (datalen <= fragmentSize) return ILibStun_SctpSendDataEx(obj, session, 3, streamid, seq, 0, pid, data, datalen);
 
 	// Break the data into parts
 	while (ptr < datalen)
 	{
 		// Compute the length of this block
 		len = datalen - ptr;
-		if (len > 1232) len = 1232;
+		if (len > fragmentSize) len = fragmentSize;
 
 		// Compute the flags
 		flags = 0;
@@ -3452,7 +3749,7 @@ ILibTransport_DoneState ILibStun_SctpSendData(struct ILibStun_Module *obj, int s
 		if (ptr + len == datalen) flags |= 0x01;
 
 		// Send the block
-		r = ILibStun_SctpSendDataEx(obj, session, flags, streamid, seq, pid, data + ptr, len);
+		r = ILibStun_SctpSendDataEx(obj, session, flags, streamid, seq, fsn++, pid, data + ptr, len);
 		ptr += len;
 	}
 
@@ -3619,8 +3916,9 @@ void ILibStun_SctpProcessStreamData(struct ILibStun_Module *obj, int session, un
 		}
 		else
 		{
-			// Start of a data accumulation
-			ILibSCTP_Accumulator *acc = (ILibSCTP_Accumulator*)ILibSparseArray_Get(obj->dTlsSessions[session]->DataAccumulator, streamId);
+			// Start of a data accumulation. Ordered and Unordered messages are accumulated separately, because I-DATA may interleave them
+			int accKey = (chunkflags & ILibSCTP_UnorderedFlag) == ILibSCTP_UnorderedFlag ? (streamId | ILibSCTP_UnorderedAccumulatorKey) : streamId;
+			ILibSCTP_Accumulator *acc = (ILibSCTP_Accumulator*)ILibSparseArray_Get(obj->dTlsSessions[session]->DataAccumulator, accKey);
 			if(acc == NULL)
 			{
 				if (chunkflags & 0x02) { acc = ILibSCTP_CreateAccumulator(); } // Only create, if we received a 'Begin' fragment
@@ -3628,7 +3926,7 @@ void ILibStun_SctpProcessStreamData(struct ILibStun_Module *obj, int session, un
 
 			if (acc != NULL)
 			{
-				if (chunkflags & 0x02) { acc->bufferPtr = 0; }	// Set to Zero when a 'BeginFragment' is received
+				if (chunkflags & 0x02) { acc->bufferPtr = 0; acc->pid = pid; }	// Set to Zero when a 'BeginFragment' is received. (I-DATA only has the PPID on this fragment)
 				if (acc->bufferPtr >= 0)						// If this is < 0, it means we never received a 'BeginFragment'
 				{
 					// Accumulate data
@@ -3641,7 +3939,7 @@ void ILibStun_SctpProcessStreamData(struct ILibStun_Module *obj, int session, un
 					memcpy_s(acc->buffer + acc->bufferPtr, acc->bufferLen - acc->bufferPtr, data, datalen);
 					acc->bufferPtr += datalen;
 
-					ILibSparseArray_Add(obj->dTlsSessions[session]->DataAccumulator, streamId, acc);
+					ILibSparseArray_Add(obj->dTlsSessions[session]->DataAccumulator, accKey, acc);
 
 					// End of data accumulation
 					if (chunkflags & 0x01)
@@ -3649,7 +3947,7 @@ void ILibStun_SctpProcessStreamData(struct ILibStun_Module *obj, int session, un
 						if (obj->OnData != NULL && obj->dTlsSessions[session]->state == 2)
 						{
 							ILibSpinLock_UnLock(&(obj->dTlsSessions[session]->Lock));
-							obj->OnData(obj, obj->dTlsSessions[session], streamId, pid, acc->buffer, acc->bufferPtr, &(obj->dTlsSessions[session]->User));
+							obj->OnData(obj, obj->dTlsSessions[session], streamId, acc->pid, acc->buffer, acc->bufferPtr, &(obj->dTlsSessions[session]->User));
 							if (obj->dTlsSessions[session] == NULL || obj->dTlsSessions[session]->state != 2) return;
 							ILibSpinLock_Lock(&(obj->dTlsSessions[session]->Lock));
 						}
@@ -3716,13 +4014,7 @@ void ILibStun_SctpDisconnect_Final(void *obj)
 		o->pendingQueueHead = packet;
 	}
 
-	// Free all packets in holding queue
-	while (o->holdingQueueHead != NULL)
-	{
-		packet = ((char**)(o->holdingQueueHead))[0]; // MS Static Analyser reports that this may not be initialized, but it will be NULL if it is not
-		free(o->holdingQueueHead);
-		o->holdingQueueHead = packet;
-	}
+	// Packets in the holding queues are freed along with OutboundStreams
 
 	// Free all packets in receive holding queue
 	node = ILibLinkedList_GetNode_Head(o->receiveHoldBuffer);
@@ -3875,6 +4167,9 @@ int ILibSCTP_FWDTSN_Check(struct ILibStun_dTlsSession *obj, char* buffer)
 	ILibSCTP_RPACKET *tmp, *tmp2;
 	unsigned int FWDTSN = 0; // Network Order
 	int ptr = 0;
+	int idata = (obj->flags & DTLS_IDATA_FLAG) == DTLS_IDATA_FLAG;
+	int entrySize = idata ? 8 : 4;
+	unsigned short *entry;
 	ILibSCTP_FwdTSNPayload *chunk = (ILibSCTP_FwdTSNPayload*)buffer;
 
 	while (packet != NULL)
@@ -3884,14 +4179,21 @@ int ILibSCTP_FWDTSN_Check(struct ILibStun_dTlsSession *obj, char* buffer)
 			// These packets are not covered with the Cumulative TSN
 			if (packet->PacketGAPCounter == 0xFD )
 			{ 
-				chunk->SkippedStreams[ptr].StreamNumber = ((ILibSCTP_DataPayload*)packet->Data)->StreamID;				
-				chunk->SkippedStreams[ptr].StreamSequence = (((ILibSCTP_DataPayload*)packet->Data)->flags & ILibSCTP_UnorderedFlag) != ILibSCTP_UnorderedFlag ? ((ILibSCTP_DataPayload*)packet->Data)->StreamSequenceNumber : 0x00;
+				// FORWARD-TSN entries are {Stream, SSN}, I-FORWARD-TSN entries are {Stream, Flags, MID}. Partially reliable
+				// messages are never interleaved, so all the fragments of a message are next to each other in the queue.
+				entry = (unsigned short*)((char*)chunk->SkippedStreams + (ptr * entrySize));
+				entry[0] = ((ILibSCTP_DataPayload*)packet->Data)->StreamID;
+				if (idata)
+				{
+					entry[1] = htons((((ILibSCTP_IDataPayload*)packet->Data)->flags & ILibSCTP_UnorderedFlag) == ILibSCTP_UnorderedFlag ? 1 : 0);
+					((unsigned int*)entry)[1] = ((ILibSCTP_IDataPayload*)packet->Data)->MessageID;
+				}
+				else
+				{
+					entry[1] = (((ILibSCTP_DataPayload*)packet->Data)->flags & ILibSCTP_UnorderedFlag) != ILibSCTP_UnorderedFlag ? ((ILibSCTP_DataPayload*)packet->Data)->StreamSequenceNumber : 0x00;
+				}
 				while (packet != NULL && ((((ILibSCTP_DataPayload*)packet->Data)->flags & 0x01) != 0x01))
 				{
-					if (packet->NextPacket != NULL && (((ILibSCTP_DataPayload*)packet->Data)->flags & ILibSCTP_UnorderedFlag) != ILibSCTP_UnorderedFlag)
-					{
-						chunk->SkippedStreams[ptr].StreamSequence = ((ILibSCTP_DataPayload*)packet->NextPacket->Data)->StreamSequenceNumber;
-					}
 					packet = packet->NextPacket;
 				}
 				if (packet != NULL)
@@ -3927,11 +4229,11 @@ int ILibSCTP_FWDTSN_Check(struct ILibStun_dTlsSession *obj, char* buffer)
 		if (packet == NULL) { obj->pendingQueueTail = NULL; }
 
 		// Send a FWD-TSN Chunk
-		chunk->type = RCTP_CHUNK_TYPE_FWDTSN;
+		chunk->type = idata ? RCTP_CHUNK_TYPE_IFWDTSN : RCTP_CHUNK_TYPE_FWDTSN;
 		chunk->flags = 0x00;
 		chunk->NewTSN = FWDTSN;
 
-		ptr = 8 + (ptr * 4);
+		ptr = 8 + (ptr * entrySize);
 		chunk->length = htons((unsigned short)ptr);
 		obj->fwdTsnDelayTime = 0;
 	}
@@ -3942,6 +4244,76 @@ int ILibSCTP_FWDTSN_Check(struct ILibStun_dTlsSession *obj, char* buffer)
 	return(ptr);
 }
 
+//
+// Congestion Window reduction, when loss is detected by Fast Retransmit/RACK (timeout = 0), or by T3-RTX expiration (timeout = 1)
+//
+void ILibSCTP_CongestionControl_OnLoss(struct ILibStun_dTlsSession *obj, int timeout)
+{
+	if (obj->congestionControl == ILibSCTP_CongestionControl_CUBIC)
+	{
+		// Fast Convergence: If we lost before reaching the previous W_max, release bandwidth to other flows
+		if (obj->congestionWindowSize < obj->cubicWmax) { obj->cubicWmax = (int)((double)obj->congestionWindowSize * (1.0 + ILibSCTP_CUBIC_BETA) / 2.0); }
+		else { obj->cubicWmax = obj->congestionWindowSize; }
+		obj->cubicEpochStart = 0;
+		obj->SSTHRESH = MAX((int)((double)obj->congestionWindowSize * ILibSCTP_CUBIC_BETA), 4 * ILibRUDP_StartMTU);
+	}
+	else
+	{
+		obj->SSTHRESH = MAX(obj->congestionWindowSize / 2, 4 * ILibRUDP_StartMTU);
+	}
+	obj->congestionWindowSize = timeout != 0 ? ILibRUDP_StartMTU : obj->SSTHRESH;
+	obj->PARTIAL_BYTES_ACKED = 0;
+}
+
+//
+// CUBIC window growth in Congestion Avoidance (RFC 8312 Section 4)
+//
+void ILibSCTP_CongestionControl_CubicOnAck(struct ILibStun_dTlsSession *obj, int bytesAcked)
+{
+	double t, target;
+	int increment;
+
+	if (obj->cubicEpochStart == 0)
+	{
+		obj->cubicEpochStart = obj->lastSackTime;
+		if (obj->congestionWindowSize < obj->cubicWmax)
+		{
+			obj->cubicK = cbrt((double)(obj->cubicWmax - obj->congestionWindowSize) / (double)ILibRUDP_StartMTU / ILibSCTP_CUBIC_C);
+			obj->cubicOriginPoint = obj->cubicWmax;
+		}
+		else
+		{
+			obj->cubicK = 0;
+			obj->cubicOriginPoint = obj->congestionWindowSize;
+		}
+		obj->cubicTcpWindow = obj->congestionWindowSize;
+	}
+
+	t = (double)(obj->lastSackTime - obj->cubicEpochStart + obj->SRTT) / 1000.0;
+	target = (double)obj->cubicOriginPoint + ILibSCTP_CUBIC_C * (t - obj->cubicK) * (t - obj->cubicK) * (t - obj->cubicK) * (double)ILibRUDP_StartMTU;
+
+	// TCP-Friendly Region: Never grow slower than the equivalent Reno flow would
+	obj->cubicTcpWindow += (int)((3.0 * (1.0 - ILibSCTP_CUBIC_BETA) / (1.0 + ILibSCTP_CUBIC_BETA)) * (double)bytesAcked * (double)ILibRUDP_StartMTU / (double)obj->congestionWindowSize);
+	if (target < (double)obj->cubicTcpWindow) { target = (double)obj->cubicTcpWindow; }
+
+	if (target > (double)obj->congestionWindowSize)
+	{
+		// Never grow faster than Slow Start would
+		increment = (int)((target - (double)obj->congestionWindowSize) * (double)bytesAcked / (double)obj->congestionWindowSize);
+		obj->congestionWindowSize += MIN(increment, bytesAcked);
+	}
+}
+
+void ILibSCTP_Rack_OnDelivered(struct ILibStun_dTlsSession *obj, ILibSCTP_RPACKET *rpacket)
+{
+	// Retransmitted packets are ambiguous, so they can't be used to measure RTT
+	if (rpacket->PacketResendCounter == 0 && (int)(rpacket->LastSentTimeStamp - obj->rackXmitTime) >= 0)
+	{
+		obj->rackXmitTime = rpacket->LastSentTimeStamp;
+		obj->rackRTT = (int)(obj->lastSackTime - rpacket->LastSentTimeStamp);
+	}
+}
+
 void ILibStun_SctpResent(struct ILibStun_dTlsSession *obj)
 {
 	unsigned int time = (unsigned int)ILibGetUptime();
@@ -3956,8 +4328,8 @@ void ILibStun_SctpResent(struct ILibStun_dTlsSession *obj)
 #endif
 		ILibRemoteLogging_printf(ILibChainGetLogger(obj->parent->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "SCTP[%d]: T3TX Timer Expired", obj->sessionId);
 		obj->senderCredits = ILibRUDP_StartMTU;												// Set CWND to 1 MTU
-		obj->SSTHRESH = MAX(obj->congestionWindowSize / 2, 4 * ILibRUDP_StartMTU);			// Update Slow Start Threshold
-		obj->congestionWindowSize = ILibRUDP_StartMTU;										// Reset the size of the Congestion Window, so that we'll initialy only have one SCTP packet in flight
+		ILibSCTP_CongestionControl_OnLoss(obj, 1);											// Update Slow Start Threshold, and reset the Congestion Window to one SCTP packet in flight
+		obj->FastRetransmitExitPoint = 0;													// T3-RTX expiration supersedes Fast Recovery
 #ifdef _WEBRTCDEBUG
 		if (obj->onCongestionWindowSizeChanged != NULL) { obj->onCongestionWindowSizeChanged(obj, "OnCongestionWindowSizeChanged", obj->congestionWindowSize); }
 #endif
@@ -4125,6 +4497,7 @@ ILibSparseArray ILibWebRTC_PropagateChannelClose(struct ILibStun_dTlsSession* ob
 			if(count==0)
 			{
 				ILibSparseArray_ClearEx(obj->DataChannelMetaDetaValues, NULL, NULL);
+				ILibSparseArray_Enumerate(obj->OutboundStreams, &ILibSCTP_ResetOutboundStream, NULL);
 				retVal = ILibSparseArray_Move(obj->DataChannelMetaDeta);
 				break;
 			}
@@ -4136,6 +4509,7 @@ ILibSparseArray ILibWebRTC_PropagateChannelClose(struct ILibStun_dTlsSession* ob
 					sid = ntohs(req->Streams[count-1]);
 					ILibSparseArray_Add(retVal, sid, ILibSparseArray_Remove(obj->DataChannelMetaDeta, sid)); 
 					ILibSparseArray_Remove(obj->DataChannelMetaDetaValues, sid);
+					ILibSCTP_ResetOutboundStream(NULL, sid, ILibSparseArray_Get(obj->OutboundStreams, sid), NULL);
 					--count;
 				}
 				break;
@@ -4214,6 +4588,9 @@ void ILibSctp_DebugSctpPacket(ILibRemoteLogging *logger, char *packet, int packe
 			case RCTP_CHUNK_TYPE_DATA:
 				ILibRemoteLogging_printf(logger, ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "...[DATA] TSN: %u, U: %u, B: %u, E: %u", ntohl(((ILibSCTP_DataPayload*)(packet + ptr))->TSN), (((ILibSCTP_ChunkHeader*)(packet + ptr))->chunkFlags >> 2) & 0x01, (((ILibSCTP_ChunkHeader*)(packet + ptr))->chunkFlags >> 1) & 0x01, ((ILibSCTP_ChunkHeader*)(packet + ptr))->chunkFlags & 0x01);
 				break;
+			case RCTP_CHUNK_TYPE_IDATA:
+				ILibRemoteLogging_printf(logger, ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "...[I-DATA] TSN: %u, SID: %u, MID: %u, U: %u, B: %u, E: %u", ntohl(((ILibSCTP_IDataPayload*)(packet + ptr))->TSN), ntohs(((ILibSCTP_IDataPayload*)(packet + ptr))->StreamID), ntohl(((ILibSCTP_IDataPayload*)(packet + ptr))->MessageID), (((ILibSCTP_ChunkHeader*)(packet + ptr))->chunkFlags >> 2) & 0x01, (((ILibSCTP_ChunkHeader*)(packet + ptr))->chunkFlags >> 1) & 0x01, ((ILibSCTP_ChunkHeader*)(packet + ptr))->chunkFlags & 0x01);
+				break;
 			case RCTP_CHUNK_TYPE_INIT:
 				ILibRemoteLogging_printf(logger, ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "...[INIT]");
 				break;
@@ -4256,6 +4633,9 @@ void ILibSctp_DebugSctpPacket(ILibRemoteLogging *logger, char *packet, int packe
 			case RCTP_CHUNK_TYPE_FWDTSN:
 				ILibRemoteLogging_printf(logger, ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "...[FWDTSN]");
 				break;
+			case RCTP_CHUNK_TYPE_IFWDTSN:
+				ILibRemoteLogging_printf(logger, ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "...[I-FWDTSN]");
+				break;
 			case RCTP_CHUNK_TYPE_ASCONF:
 				ILibRemoteLogging_printf(logger, ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "...[ASCONF]");
 				break;
@@ -4292,7 +4672,7 @@ void ILibSCTP_ReorderChunks(struct ILibStun_Module *obj, int sessionID, char *bu
 		unsigned short actualSize = FOURBYTEBOUNDARY(chunksize);
 		if (chunksize < 4 || ptr + chunksize > bufferLen) break;
 
-		if(chunktype == RCTP_CHUNK_TYPE_DATA)
+		if(chunktype == RCTP_CHUNK_TYPE_DATA || chunktype == RCTP_CHUNK_TYPE_IDATA)
 		{
 			// TempWrite Data Chunks
 			memcpy_s(dataChunks + dataChunksWritten, sizeof(ILibScratchPad2) - dataChunksWritten, (char*)chunkHdr, chunksize);
@@ -4342,7 +4722,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 
 #ifdef _WEBRTCDEBUG
 	// Simulated Inbound Packet Loss
-	if ((obj->lossPercentage) > 0 && ((rand() % 100) >= (100 - obj->lossPercentage))) { return; }
+	if ((obj->lossPercentage) > 0 && (ILibSCTP_SimulatedLoss_Next(obj) % 100) >= (unsigned int)(100 - obj->lossPercentage)) { return; }
 #endif
 
 	// Check size and the RCTP (RFC4960) checksum using CRC32c
@@ -4386,6 +4766,29 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 		unsigned short chunksize = ntohs(chunkHdr->chunkLength);
 		if (chunksize < 4 || ptr + chunksize > bufferLength) break;
 
+		if (chunktype == RCTP_CHUNK_TYPE_IDATA && chunksize >= 20)
+		{
+			// Rewrite the I-DATA chunk in place, as a DATA chunk that starts 4 bytes later. Re-Assembly is per stream, and
+			// in TSN order, so the low 16 bits of the Message Identifier are enough to stand in for the Stream Sequence Number.
+			// Only the first fragment carries a PPID, the FSN of the other fragments is dropped.
+			ILibSCTP_IDataPayload *idata = (ILibSCTP_IDataPayload*)(buffer + ptr);
+			ILibSCTP_DataPayload *data = (ILibSCTP_DataPayload*)(buffer + ptr + 4);
+			unsigned int tsn = idata->TSN;
+			unsigned short sid = idata->StreamID;
+
+			if ((chunkflags & 0x02) == 0) { idata->ProtocolID_FSN = 0; }	// Overlaps data->ProtocolID
+			data->StreamSequenceNumber = ((unsigned short*)&(idata->MessageID))[1];
+			data->StreamID = sid;
+			data->TSN = tsn;
+			data->length = htons(chunksize - 4);
+			data->flags = chunkflags;
+			data->type = RCTP_CHUNK_TYPE_DATA;
+
+			ptr += 4;
+			chunksize -= 4;
+			chunktype = RCTP_CHUNK_TYPE_DATA;
+		}
+
 		switch (chunktype) {
 		case RCTP_CHUNK_TYPE_RECONFIG:
 			{
@@ -4468,6 +4871,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 											{
 												OutboundResponse->Result = htonl(ILibSCTP_Reconfig_Result_Success_Performed);	
 												ILibSparseArray_Remove(o->DataChannelMetaDetaValues, streamId); // Clear associated data with this stream ID
+												ILibSCTP_ResetOutboundStream(NULL, streamId, ILibSparseArray_Get(o->OutboundStreams, streamId), NULL);
 												if(obj->OnWebRTCDataChannelClosed != NULL)
 												{
 													ILibSpinLock_UnLock(&(o->Lock));
@@ -4590,6 +4994,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 									if ((attr.Data.StatusFlags & ILibSCTP_StreamAttributesData_Assigned_Status_ASSIGNED) == ILibSCTP_StreamAttributesData_Assigned_Status_ASSIGNED)
 									{
 										ILibSparseArray_Remove(o->DataChannelMetaDetaValues, streamId); // Clear associated data with this stream ID
+										ILibSCTP_ResetOutboundStream(NULL, streamId, ILibSparseArray_Get(o->OutboundStreams, streamId), NULL);
 										if (obj->OnWebRTCDataChannelClosed != NULL)
 										{
 											ILibSpinLock_UnLock(&(o->Lock));
@@ -4686,6 +5091,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 						for (chunkIndex = 0; chunkIndex < tLen - 4; ++chunkIndex)
 						{
 							ILibSparseArray_Add(o->PeerFeatureSet, (int)((unsigned char*)(buffer + ptr + 20 + varLen + 4))[chunkIndex], (void*)0x01);
+							if (((unsigned char*)(buffer + ptr + 20 + varLen + 4))[chunkIndex] == RCTP_CHUNK_TYPE_IDATA) { o->flags |= DTLS_IDATA_FLAG; }
 							ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_1, "...Supported Extension: %d", (int)((unsigned char*)(buffer + ptr + 20 + varLen + 4))[chunkIndex]);
 						}
 						break;
@@ -4754,6 +5160,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 							for(chunkIndex = 0 ; chunkIndex < tLen - 4; ++chunkIndex)
 							{
 								ILibSparseArray_Add(o->PeerFeatureSet, (int)((unsigned char*)(buffer + ptr + 20 + varLen + 4))[chunkIndex], (void*)0x01);
+								if (((unsigned char*)(buffer + ptr + 20 + varLen + 4))[chunkIndex] == RCTP_CHUNK_TYPE_IDATA) { o->flags |= DTLS_IDATA_FLAG; }
 								ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_1, "...Supported Extension: %d", (int)((unsigned char*)(buffer + ptr + 20 + varLen + 4))[chunkIndex]);
 							}
 							break;
@@ -4774,8 +5181,8 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 			// Create response
 			{
 				long long uptime = ILibGetUptime();
-				char chunks[1] = {130};
-				ILibStun_AddSctpChunkHeader(rpacket, *rptr, RCTP_CHUNK_TYPE_INITACK, 0, 37);
+				char chunks[3] = { (char)RCTP_CHUNK_TYPE_RECONFIG, RCTP_CHUNK_TYPE_IDATA, (char)RCTP_CHUNK_TYPE_IFWDTSN };
+				ILibStun_AddSctpChunkHeader(rpacket, *rptr, RCTP_CHUNK_TYPE_INITACK, 0, 39);
 				*rptr += 4;
 				((ILibSCTP_InitAckChunk*)(rpacket + *rptr))->InitiateTag = o->tag;									// Initiate Tag
 				((ILibSCTP_InitAckChunk*)(rpacket + *rptr))->A_RWND = htonl(ILibSCTP_MaxReceiverCredits);			// Advertised Receiver Window Credit (a_rwnd)	
@@ -4785,7 +5192,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 				*rptr += sizeof(ILibSCTP_InitAckChunk);
 				ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_1, "...Setting Cookie: %s", ILibRemoteLogging_ConvertToHex((char*)&uptime, sizeof(uptime)));
 				*rptr += ILibSCTP_AddOptionalVariableParameter(rpacket + *rptr, htons(SCTP_INIT_PARAM_STATE_COOKIE), (void*)&uptime, sizeof(uptime)); // Stick uptime as cookie, so we can calculate initial RTT
-				*rptr += ILibSCTP_AddOptionalVariableParameter(rpacket + *rptr, htons(SCTP_INIT_PARAM_SUPPORTED_EXTENSIONS), chunks, 1); // Supports RE-CONFIG
+				*rptr += ILibSCTP_AddOptionalVariableParameter(rpacket + *rptr, htons(SCTP_INIT_PARAM_SUPPORTED_EXTENSIONS), chunks, sizeof(chunks)); // Supports RE-CONFIG, I-DATA, I-FORWARD-TSN
 			}
 			break;
 		case RCTP_CHUNK_TYPE_SACK:
@@ -4857,8 +5264,8 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 						{
 							o->RTTVAR = (int)((double)(1 - RTO_BETA) * (double)o->RTTVAR + RTO_BETA * (double)abs(o->SRTT - r));
 							o->SRTT = (int)((double)(1 - RTO_ALPHA) * (double)o->SRTT + RTO_ALPHA * (double)r);
-							o->RTO = o->SRTT + 4 * o->RTTVAR;
-							if (o->RTO < RTO_MIN) { o->RTO = RTO_MIN; }
+							o->RTO = o->SRTT + MAX(ILibSCTP_RTO_GRANULARITY, 4 * o->RTTVAR);
+							if (o->RTO < o->minRTO) { o->RTO = o->minRTO; }
 							if (o->RTO > RTO_MAX) { o->RTO = RTO_MAX; }
 							rttCalculated = 1; // We only need to calculate this once for each packet received
 #ifdef _WEBRTCDEBUG
@@ -4869,14 +5276,15 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 						}
 					}
 				}
-				cumulativeTSNAdvanced += (((ILibSCTP_RPACKET*)o->pendingQueueHead)->PacketSize - (12 + 16));
-				o->pendingByteCount -= (((ILibSCTP_RPACKET*)o->pendingQueueHead)->PacketSize - (12 + 16));
+				cumulativeTSNAdvanced += ILibSCTP_RPACKET_PayloadSize((ILibSCTP_RPACKET*)o->pendingQueueHead);
+				o->pendingByteCount -= ILibSCTP_RPACKET_PayloadSize((ILibSCTP_RPACKET*)o->pendingQueueHead);
 				o->pendingCount--;
 				rpacket = (ILibSCTP_RPACKET*)o->pendingQueueHead;
 				o->pendingQueueHead = (char*)((ILibSCTP_RPACKET*)o->pendingQueueHead)->NextPacket;
 				if (o->pendingQueueHead == NULL) { o->pendingQueueTail = NULL; }
 				else { tsnx = ntohl(((ILibSCTP_DataPayload*)((ILibSCTP_RPACKET*)o->pendingQueueHead)->Data)->TSN); }
 
+				if (rpacket->PacketGAPCounter != 0xFE) { ILibSCTP_Rack_OnDelivered(o, rpacket); }
 				free(rpacket);
 				o->timervalue = 0; // This is a valid SACK, reset the timeout for packet resent				
 			}
@@ -4931,6 +5339,17 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 				if (o->onCongestionWindowSizeChanged != NULL) { o->onCongestionWindowSizeChanged(o, "OnCongestionWindowSizeChanged", o->congestionWindowSize); }
 #endif
 			}
+			else if (o->congestionControl == ILibSCTP_CongestionControl_CUBIC)
+			{
+				// CUBIC grows as a function of time since the last reduction, but still only while we are using the window
+				if (o->congestionWindowSize > o->SSTHRESH && o->FastRetransmitExitPoint == 0 && cumulativeTSNAdvanced != 0 && (pbc + ILibRUDP_StartMTU) >= o->congestionWindowSize && o->congestionWindowSize < ILibSCTP_MaxReceiverCredits)
+				{
+					ILibSCTP_CongestionControl_CubicOnAck(o, cumulativeTSNAdvanced);
+#ifdef _WEBRTCDEBUG
+					if (o->onCongestionWindowSizeChanged != NULL) { o->onCongestionWindowSizeChanged(o, "OnCongestionWindowSizeChanged", o->congestionWindowSize); }
+#endif
+				}
+			}
 			else if (o->congestionWindowSize > o->SSTHRESH && (int)(o->PARTIAL_BYTES_ACKED) >= o->congestionWindowSize && pbc >= o->congestionWindowSize)
 			{
 				// When our Congestion Window is greater than the Slow Start Threshold, we only grow our Window if we are fully utilizing our congestion window
@@ -4955,10 +5374,10 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 					if (tsnx < gstart)
 					{
 						// This packet was not received by the peer
-						if (frt < 0xFD)
+						if (frt < ILibSCTP_GAP_RETRANSMITTED)
 						{
 							++frt; // Increment the GAP Counter if this packet isn't already marked for re-transmit
-							if (frt >= 0xFD) { frt = 0xFC; } // Cap the counter, because 0xFD, 0xFE, and 0xFF have special meaning, and won't retransmit
+							if (frt >= ILibSCTP_GAP_RETRANSMITTED) { frt = ILibSCTP_GAP_RETRANSMITTED - 1; } // Cap the counter, because 0xFC - 0xFF have special meaning
 						}
 						else if (frt == 0xFE)
 						{
@@ -4973,12 +5392,13 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 						{
 							// This is the first time this packet was GAP ACK'ed
 							frt = 0xFE; // This packet was forward ACKed by the peer. Ban this packet from being retransmitted for now
-							o->senderCredits += (rpacket->PacketSize - (12 + 16));
-							o->PARTIAL_BYTES_ACKED += (rpacket->PacketSize - (12 + 16));
+							o->senderCredits += ILibSCTP_RPACKET_PayloadSize(rpacket);
+							o->PARTIAL_BYTES_ACKED += ILibSCTP_RPACKET_PayloadSize(rpacket);
+							ILibSCTP_Rack_OnDelivered(o, rpacket);
 						}
 					}
 
-					if (frt >= ILibSCTP_FastRetry_GAP && frt < 0xFD)
+					if (frt >= ILibSCTP_FastRetry_GAP && frt < ILibSCTP_GAP_RETRANSMITTED)
 					{
 						// Perform fast retry. This only happens if this packet was in the ACK gap 'ILibSCTP_FastRetry_GAP' times.
 						if (windowReset == 0 && o->FastRetransmitExitPoint == 0)
@@ -4987,10 +5407,9 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 #ifdef _WEBRTCDEBUG
 							if (o->onFastRecovery != NULL){ o->onFastRecovery(o, "OnFastRecovery", 1); }
 #endif
-							o->SSTHRESH = MAX((o->congestionWindowSize / 2), (4 * ILibRUDP_StartMTU));;
-							o->congestionWindowSize = o->SSTHRESH;
+							ILibSCTP_CongestionControl_OnLoss(o, 0);
 							o->senderCredits = MIN(o->senderCredits, o->congestionWindowSize);
-							o->PARTIAL_BYTES_ACKED = 0;
+							o->FastRetransmitExitPoint = ntohl(((ILibSCTP_DataPayload*)((ILibSCTP_RPACKET*)o->pendingQueueTail)->Data)->TSN); // Highest outstanding TSN
 							windowReset = 1;
 							ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "SCTP[%d]: Entering Fast-Retry Mode (Sender Credits: %d)", o->sessionId, o->senderCredits);
 #ifdef _WEBRTCDEBUG
@@ -5028,6 +5447,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 							rpacket->LastSentTimeStamp = o->lastSackTime;								// Update Send Time, used for retry
 							ILibStun_SendSctpPacket(obj, session, rpacket->Data - 12, rpacket->PacketSize);
 							rpacket->PacketResendCounter++;												// Add to the packet resent counter
+							frt = ILibSCTP_GAP_RETRANSMITTED;
 							ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "...TSN=%u", ntohl(((ILibSCTP_DataPayload*)(rpacket->Data))->TSN));
 							//printf("RESEND COUNT %d, TSN=%u\r\n", ((unsigned char*)(packet + sizeof(char*) + 2))[0], tsnx);
 
@@ -5052,11 +5472,12 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 #endif
 								}
 								rpacket->PacketResendCounter++;									// Add to the packet resent counter
-								o->senderCredits -= (rpacket->PacketSize - (12 + 16));		// Update sender credits
+								o->senderCredits -= ILibSCTP_RPACKET_PayloadSize(rpacket);		// Update sender credits
 								o->lastRetransmitTime = o->lastSackTime; // Every time we retransmit, we need to take note of it, for RTT purposes
 								
 								ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "SCTP[%d]: Retransmitting/T3RTX Expired", o->sessionId);
 								ILibStun_SendSctpPacket(obj, session, rpacket->Data - 12, rpacket->PacketSize);
+								frt = ILibSCTP_GAP_RETRANSMITTED;
 #ifdef _WEBRTCDEBUG
 								//if (o->onSendRetry != NULL) { o->onSendRetry(obj, "OnSendRetry", ((unsigned short*)(rpacket->Data + sizeof(char*)))[0]); }
 								if (o->onSendRetry != NULL) { o->onSendRetry(o, "OnSendRetry", ntohl(((unsigned int*)rpacket->Data)[1])); }
@@ -5075,10 +5496,11 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 						// We have sufficient sender credits to send packets marked for retransmit
 						rpacket->LastSentTimeStamp = o->lastSackTime;									// Update Send Time, used for retry
 						rpacket->PacketResendCounter++;													// Add to the packet resent counter
-						o->senderCredits -= rpacket->PacketSize;										// Update sender credits
+						o->senderCredits -= ILibSCTP_RPACKET_PayloadSize(rpacket);						// Update sender credits
 						o->lastRetransmitTime = o->lastSackTime; // Every time we retransmit, we need to take note of it, for RTT purposes
 
 						ILibStun_SendSctpPacket(obj, session, rpacket->Data - 12, rpacket->PacketSize);
+						frt = ILibSCTP_GAP_RETRANSMITTED;
 #ifdef _WEBRTCDEBUG
 						//if (o->onSendRetry != NULL) { o->onSendRetry(obj, "OnSendRetry", ((unsigned short*)(rpacket->Data + sizeof(char*)))[0]); }
 						if (o->onSendRetry != NULL) { o->onSendRetry(o, "OnSendRetry", ntohl(((unsigned int*)rpacket->Data)[1])); }
@@ -5093,24 +5515,74 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 
 			if (lastTSNX != 0 && o->FastRetransmitExitPoint == 0) { o->FastRetransmitExitPoint = lastTSNX; }  // Set the Fast Recovery Exit Point
 
+			//
+			// RACK (RFC 8985): A packet that was sent before the most recently delivered packet, and is older than
+			// RACK.RTT + Reordering Window, is lost. This catches losses that won't accumulate 3 GAP reports, such as
+			// lost retransmissions, or losses near the tail of a burst.
+			//
+			if (o->rackXmitTime != 0 && o->pendingQueueHead != NULL)
+			{
+				int reorderWindow = MAX(o->SRTT / 4, ILibSCTP_RACK_MIN_REORDER_WINDOW);
+				rpacket = (ILibSCTP_RPACKET*)o->pendingQueueHead;
+				while (rpacket != NULL)
+				{
+					if (rpacket->PacketGAPCounter < 0xFD && rpacket->LastSentTimeStamp != o->lastSackTime && (int)(o->rackXmitTime - rpacket->LastSentTimeStamp) > 0 &&
+						(int)(o->lastSackTime - rpacket->LastSentTimeStamp) >= (o->rackRTT + reorderWindow))
+					{
+						if (o->FastRetransmitExitPoint == 0)
+						{
+#ifdef _WEBRTCDEBUG
+							if (o->onFastRecovery != NULL) { o->onFastRecovery(o, "OnFastRecovery", 1); }
+#endif
+							ILibSCTP_CongestionControl_OnLoss(o, 0);
+							o->senderCredits = MIN(o->senderCredits, o->congestionWindowSize);
+							o->FastRetransmitExitPoint = ntohl(((ILibSCTP_DataPayload*)((ILibSCTP_RPACKET*)o->pendingQueueTail)->Data)->TSN);
+							ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "SCTP[%d]: RACK Entering Fast-Recovery Mode (Sender Credits: %d)", o->sessionId, o->senderCredits);
+#ifdef _WEBRTCDEBUG
+							if (o->onCongestionWindowSizeChanged != NULL) { o->onCongestionWindowSizeChanged(o, "OnCongestionWindowSizeChanged", o->congestionWindowSize); }
+#endif
+						}
+						rpacket->PacketGAPCounter = 0xFF;	// Mark for retransmit
+					}
+					if (rpacket->PacketGAPCounter == 0xFF && o->senderCredits >= rpacket->PacketSize)
+					{
+						rpacket->LastSentTimeStamp = o->lastSackTime;
+						rpacket->PacketResendCounter++;
+						rpacket->PacketGAPCounter = ILibSCTP_GAP_RETRANSMITTED;
+						o->senderCredits -= ILibSCTP_RPACKET_PayloadSize(rpacket);	// Same accounting as fast retransmit, credits count DATA/I-DATA payload bytes
+						o->lastRetransmitTime = o->lastSackTime;
+						if (o->T3RTXTIME == 0)
+						{
+							o->T3RTXTIME = o->lastSackTime;
+#ifdef _WEBRTCDEBUG
+							if (o->onT3RTX != NULL) { o->onT3RTX(o, "OnT3RTX", o->RTO); }
+#endif
+						}
+						ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_3, "SCTP[%d]: RACK Retransmit TSN=%u", o->sessionId, ntohl(((ILibSCTP_DataPayload*)(rpacket->Data))->TSN));
+						ILibStun_SendSctpPacket(obj, session, rpacket->Data - 12, rpacket->PacketSize);
+#ifdef _WEBRTCDEBUG
+						if (o->onSendRetry != NULL) { o->onSendRetry(o, "OnSendRetry", ntohl(((unsigned int*)rpacket->Data)[1])); }
+#endif
+					}
+					rpacket = rpacket->NextPacket;
+				}
+			}
+
 			// printf("ARK-END %d GAPS, %d SENDS\r\n", GapAckCount, SendCount);
 
 			// RCTPDEBUG(printf("RCTP_CHUNK_TYPE_SACK, Size=%d, TSN=%u, RC1=%u, PQ=%d, HQ=%d\r\n", chunksize, tsn, obj->dTlsSessions[session]->receiverCredits, obj->dTlsSessions[session]->pendingCount, obj->dTlsSessions[session]->holdingCount);)
 
 			// Send any packets in the holding queue that we can, we do this because we may now have more credits
 			oldHoldCount = o->holdingCount;
-			while (o->receiverCredits > 0 && o->holdingQueueHead != NULL)
+			while (o->receiverCredits > 0 && (rpacket = ILibSCTP_Scheduler_Peek(o)) != NULL)
 			{
-				rpacket = (ILibSCTP_RPACKET*)o->holdingQueueHead;
-
 				// Check if we have sufficient credits to send the next packet
-				if (o->receiverCredits < (rpacket->PacketSize - (12 + 16))) break;
-				if (o->senderCredits < (rpacket->PacketSize - (12 + 16))) break;
+				if (o->receiverCredits < ILibSCTP_RPACKET_PayloadSize(rpacket)) break;
+				if (o->senderCredits < ILibSCTP_RPACKET_PayloadSize(rpacket)) break;
 
-				// Remove the packet from the holding queue
-				o->holdingQueueHead = (char*)rpacket->NextPacket;	// Move to the next packet
-				if (o->holdingQueueHead == NULL) o->holdingQueueTail = NULL;
-				o->holdingCount--;
+				// Remove the packet from the holding queue, and assign the TSN now, so TSNs go out in the order the scheduler picked
+				ILibSCTP_Scheduler_Dequeue(o);
+				((ILibSCTP_DataPayload*)rpacket->Data)->TSN = htonl(o->outtsn++);
 
 #ifdef _WEBRTCDEBUG
 				// Debug Events
@@ -5123,12 +5595,11 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 				rpacket->NextPacket = NULL;
 				o->pendingQueueTail = (char*)rpacket;
 				o->pendingCount++;
-				o->pendingByteCount += (rpacket->PacketSize - (12 + 16));
+				o->pendingByteCount += ILibSCTP_RPACKET_PayloadSize(rpacket);
 
 				// Remove the credits
-				o->senderCredits -= (rpacket->PacketSize - (12 + 16));
-				o->receiverCredits -= (rpacket->PacketSize - (12 + 16));
-				o->holdingByteCount -= (rpacket->PacketSize - (12 + 16));
+				o->senderCredits -= ILibSCTP_RPACKET_PayloadSize(rpacket);
+				o->receiverCredits -= ILibSCTP_RPACKET_PayloadSize(rpacket);
 
 #ifdef _WEBRTCDEBUG
 				// Debug Events
@@ -5145,7 +5616,7 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 
 				// Update the packet retry data
 				rpacket->LastSentTimeStamp = o->lastSackTime;								// Last time the packet was sent (Used for retry)
-				ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "Sending %u/%u bytes from Holding Queue", (rpacket->PacketSize - (12 + 16)), o->holdingByteCount);
+				ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "Sending %u/%u bytes from Holding Queue", ILibSCTP_RPACKET_PayloadSize(rpacket), o->holdingByteCount);
 				ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...TSN=%u", ntohl(((ILibSCTP_DataPayload*)rpacket->Data)->TSN));
 				ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_2, "...LEN=%u", ntohs(((ILibSCTP_DataPayload*)rpacket->Data)->length));
 
@@ -5207,9 +5678,9 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 		case RCTP_CHUNK_TYPE_COOKIEECHO:
 			o->SRTT = (int)(ILibGetUptime() - *((long long*)(buffer + ptr + 4)));
 			o->RTTVAR = o->SRTT / 2;
-			o->RTO = o->SRTT + 4 * o->RTTVAR;
+			o->RTO = o->SRTT + MAX(ILibSCTP_RTO_GRANULARITY, 4 * o->RTTVAR);
 			o->SSTHRESH = 4 * ILibRUDP_StartMTU;
-			if (o->RTO < RTO_MIN) { o->RTO = RTO_MIN; }
+			if (o->RTO < o->minRTO) { o->RTO = o->minRTO; }
 			ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_1, "SCTP: %d received [COOKIE-ECHO]", session);
 
 			*rptr = ILibStun_AddSctpChunkHeader(rpacket, *rptr, RCTP_CHUNK_TYPE_COOKIEACK, 0, 4);
@@ -5223,10 +5694,13 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 			}
 			break;
 		case RCTP_CHUNK_TYPE_FWDTSN:
+		case RCTP_CHUNK_TYPE_IFWDTSN:
 		{
 			ILibSCTP_FwdTSNPayload *fdata = (ILibSCTP_FwdTSNPayload*)(buffer + ptr);
 			int i;
-			int len = (htons(fdata->length) - 8) / 4;
+			int entrySize = chunktype == RCTP_CHUNK_TYPE_IFWDTSN ? 8 : 4;		// I-FORWARD-TSN entries also have Flags and a 32 bit Message Identifier
+			int len = (htons(fdata->length) - 8) / entrySize;
+			unsigned short sid;
 			void *holding;
 			unsigned int NewTSN = ntohl(fdata->NewTSN);
 			ILibSCTP_DataPayload *data;
@@ -5241,8 +5715,11 @@ void ILibStun_ProcessSctpPacket(struct ILibStun_Module *obj, int session, char*
 			
 			for (i = 0; i < len; ++i)
 			{
-				acc = (ILibSCTP_Accumulator*)ILibSparseArray_Get(o->DataAccumulator, ntohl(fdata->SkippedStreams[i].StreamNumber));
+				sid = ntohs(((unsigned short*)((char*)fdata->SkippedStreams + (i * entrySize)))[0]);
+				acc = (ILibSCTP_Accumulator*)ILibSparseArray_Get(o->DataAccumulator, sid);
 				if (acc != NULL) { acc->bufferPtr = -1; } // If an accumulator was created, reset the bufferPtr to abort the Re-Assembly
+				acc = (ILibSCTP_Accumulator*)ILibSparseArray_Get(o->DataAccumulator, sid | ILibSCTP_UnorderedAccumulatorKey);
+				if (acc != NULL) { acc->bufferPtr = -1; }
 			}
 
 			o->intsn = NewTSN;
@@ -5510,7 +5987,7 @@ void ILibStun_InitiateSCTP(struct ILibStun_Module *obj, int session, unsigned sh
 	char buffer[32 + 12];
 	int ptr;
 	unsigned int initiateTag;
-	char chunks[1] = { 130 };
+	char chunks[3] = { (char)RCTP_CHUNK_TYPE_RECONFIG, RCTP_CHUNK_TYPE_IDATA, (char)RCTP_CHUNK_TYPE_IFWDTSN };
 
 	obj->dTlsSessions[session]->inport = sourcePort;
 	obj->dTlsSessions[session]->outport = destinationPort;
@@ -5539,7 +6016,7 @@ void ILibStun_InitiateSCTP(struct ILibStun_Module *obj, int session, unsigned sh
 	ptr += 4;
 
 	ptr += ILibSCTP_AddOptionalVariableParameter(buffer + ptr, htons(SCTP_INIT_PARAM_UNRELIABLE_STREAM), NULL, 0);		// Supports UNRELIABLE
-	ptr += ILibSCTP_AddOptionalVariableParameter(buffer + ptr, htons(SCTP_INIT_PARAM_SUPPORTED_EXTENSIONS), chunks, 1); // Supports RE-CONFIG
+	ptr += ILibSCTP_AddOptionalVariableParameter(buffer + ptr, htons(SCTP_INIT_PARAM_SUPPORTED_EXTENSIONS), chunks, sizeof(chunks)); // Supports RE-CONFIG, I-DATA, I-FORWARD-TSN
 
 	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_1, "Initiating SCTP...");
 	ILibRemoteLogging_printf(ILibChainGetLogger(obj->ChainLink.ParentChain), ILibRemoteLogging_Modules_WebRTC_SCTP, ILibRemoteLogging_Flags_VerbosityLevel_1, "...TSN/IN = %u", obj->dTlsSessions[session]->outtsn);
@@ -5771,6 +6248,9 @@ void ILibStun_CreateDtlsSession(struct ILibStun_Module *obj, int sessionId, int
 	memcpy_s(obj->dTlsSessions[sessionId]->remoteInterface, sizeof(struct sockaddr_in6), remoteInterface, INET_SOCKADDR_LENGTH(remoteInterface->sin6_family));
 	obj->dTlsSessions[sessionId]->senderCredits = 4 * ILibRUDP_StartMTU;
 	obj->dTlsSessions[sessionId]->congestionWindowSize = 4 * ILibRUDP_StartMTU;
+	obj->dTlsSessions[sessionId]->RTO = RTO_MIN;
+	obj->dTlsSessions[sessionId]->minRTO = ILibSCTP_RTO_FLOOR;
+	obj->dTlsSessions[sessionId]->congestionControl = obj->defaultCongestionControl;
 	obj->dTlsSessions[sessionId]->ssl = SSL_new(obj->SecurityContext);
 
 	SSL_set_ex_data(obj->dTlsSessions[sessionId]->ssl, ILibStunClientIndex, obj);
@@ -7545,9 +8025,14 @@ enum ILibAsyncSocket_SendStatus ILibTURN_SendChannelData(ILibTURN_ClientModule t
 
 #ifdef _WEBRTCDEBUG
 void ILibSCTP_SetSimulatedInboundLossPercentage(void *stunModule, int lossPercentage)
+{
+	ILibSCTP_SetSimulatedInboundLossPercentageEx(stunModule, lossPercentage, 0);
+}
+void ILibSCTP_SetSimulatedInboundLossPercentageEx(void *stunModule, int lossPercentage, unsigned int seed)
 {
 	struct ILibStun_Module *obj = (struct ILibStun_Module*)stunModule;
 	obj->lossPercentage = lossPercentage;
+	obj->lossSeed = seed;	// Same seed => Same drop pattern, so loss sweeps are reproducible
 }
 
 void ILibSCTP_SetTSNCallback(void *dtlsSession, ILibSCTP_OnTSNChanged tsnHandler)
@@ -147,6 +147,7 @@ typedef void(*ILibSCTP_OnTSNChanged)(void *stunModule, int OutboundTSN, int Cumu
 typedef void (*ILibSCTP_OnSCTPDebug)(void* dtlsSession, char* debugField, int data);
 void ILibSCTP_SetSenderReceiverCreditsCallback(void* stunModule, ILibSCTP_OnSenderReceiverCreditsChanged callback);
 void ILibSCTP_SetSimulatedInboundLossPercentage(void *stunModule, int lossPercentage);
+void ILibSCTP_SetSimulatedInboundLossPercentageEx(void *stunModule, int lossPercentage, unsigned int seed);
 void ILibSCTP_SetTSNCallback(void *dtlsSession, ILibSCTP_OnTSNChanged tsnHandler);
 int ILibSCTP_Debug_SetDebugCallback(void *dtlsSession, char* debugFieldName, ILibSCTP_OnSCTPDebug handler);
 #endif
@@ -170,6 +171,21 @@ ILibTransport_DoneState ILibSCTP_SendEx(void* SctpSession, unsigned short stream
 int ILibSCTP_GetPendingBytesToSend(void* SctpSession);
 void ILibSCTP_Close(void* SctpSession);
 
+//! Congestion Controllers available to an SCTP Association
+typedef enum ILibSCTP_CongestionControl
+{
+	ILibSCTP_CongestionControl_RENO = 0,	//!< RFC 4960 Slow Start / Congestion Avoidance (Default)
+	ILibSCTP_CongestionControl_CUBIC = 1	//!< RFC 8312 CUBIC window growth, with multiplicative decrease of 0.7
+}ILibSCTP_CongestionControl;
+
+void ILibSCTP_SetDefaultCongestionControl(void *StunModule, ILibSCTP_CongestionControl cc);
+void ILibSCTP_SetCongestionControl(void* SctpSession, ILibSCTP_CongestionControl cc);
+ILibSCTP_CongestionControl ILibSCTP_GetCongestionControl(void* SctpSession);
+void ILibSCTP_SetMinRTO(void* SctpSession, int minRTO);
+void ILibSCTP_SetStreamPriority(void* SctpSession, unsigned short streamId, unsigned short priority);
+unsigned short ILibSCTP_GetStreamPriority(void* SctpSession, unsigned short streamId);
+int ILibSCTP_IsInterleavingSupported(void* SctpSession);
+
 void ILibSCTP_SetUser(void* SctpSession, void* user);
 void* ILibSCTP_GetUser(void* SctpSession);
 void ILibSCTP_SetUser2(void* SctpSession, void* user);
@@ -37,8 +37,17 @@ limitations under the License.
 #include "ILibCrypto.h"
 #include "ILibRemoteLogging.h"
 
+#ifdef _POSIX
+#include <sys/stat.h>
+#endif
+#if defined(_POSIX) && !defined(__APPLE__) && !defined(_FREEBSD)
+#include <sys/sendfile.h>
+#define ILibWebServer_SENDFILE
+#endif
+
 #define DIGEST_AUTHENTICATION_NONCE_DEFAULT_DURATION_MINUTES 15
 #define ILibWebServer_StreamHeader_Raw_MaxHeaderLength 4096
+#define ILibWebServer_StreamFile_ChunkSize 65536
 
 int ILibWebServerSSLCTXIndex = -1;
 int ILibWebServerConnectionSSLCTXIndex = -1;
@@ -116,8 +125,23 @@ typedef struct ILibWebServer_Session_SystemData
 	char  WebSocketCloseFrameSent;			// WebSocketCloseFrameSent
 	void* DigestTable;
 	void* WebSocket_Request;
+	void* StreamFile;				// ILibWebServer_StreamFileState
 }ILibWebServer_Session_SystemData;
 
+typedef struct ILibWebServer_StreamFileState
+{
+	FILE *pfile;
+	int64_t remaining;				// Bytes left to send, -1 = until EOF
+	char *buffer;					// Read buffer, only allocated when a chunk can't go out with sendfile()
+#ifdef _POSIX
+	int fd;
+	off_t offset;
+	int sendfile;					// Plaintext socket and regular file
+	int failed;						// The file shrank, or sendfile() failed, after the chunk header was sent
+#endif
+}ILibWebServer_StreamFileState;
+void ILibWebServer_StreamFile_Free(ILibWebServer_StreamFileState *state);
+
 #define ILibWebServer_Session_GetSystemData(ws) ((ILibWebServer_Session_SystemData*)((char*)ws+sizeof(ILibWebServer_Session)))
 void *ILibWebServer_Session_GetConnectionToken(ILibWebServer_Session *session)
 {
@@ -2060,6 +2084,7 @@ void ILibWebServer_Release(struct ILibWebServer_Session *session)
 		if (ILibWebServer_Session_GetSystemData(session)->DigestTable != NULL) { ILibDestroyHashTree(ILibWebServer_Session_GetSystemData(session)->DigestTable); }
 		if (ILibWebServer_Session_GetSystemData(session)->WebSocketFragmentBuffer != NULL)	{ free(ILibWebServer_Session_GetSystemData(session)->WebSocketFragmentBuffer); }
 		if (ILibWebServer_Session_GetSystemData(session)->WebSocket_Request != NULL) { ILibDestructPacket((struct packetheader*)ILibWebServer_Session_GetSystemData(session)->WebSocket_Request); }
+		if (ILibWebServer_Session_GetSystemData(session)->StreamFile != NULL) { ILibWebServer_StreamFile_Free((ILibWebServer_StreamFileState*)ILibWebServer_Session_GetSystemData(session)->StreamFile); }
 		free(session);
 	}
 }
@@ -2112,33 +2137,180 @@ return ILibAsyncServerSocket_FakeConnect(wsm->ServerSocket, cd);
 }
 */
 
+// Closes the file being streamed, and frees the stream state
+void ILibWebServer_StreamFile_Free(ILibWebServer_StreamFileState *state)
+{
+	fclose(state->pfile);
+	if (state->buffer != NULL) { free(state->buffer); }
+	free(state);
+}
+
+// Reads the next part of the file into the session's read buffer
+int ILibWebServer_StreamFile_Read(ILibWebServer_StreamFileState *state, int len)
+{
+#ifdef _POSIX
+	ssize_t bytesRead;
+#endif
+
+	if (state->buffer == NULL && (state->buffer = (char*)malloc(ILibWebServer_StreamFile_ChunkSize)) == NULL) { ILIBCRITICALEXIT(254); }
+#ifdef _POSIX
+	do
+	{
+		bytesRead = pread(state->fd, state->buffer, (size_t)len, state->offset);
+	} while (bytesRead < 0 && errno == EINTR);
+	if (bytesRead <= 0) { return(0); }
+	state->offset += bytesRead;
+	return((int)bytesRead);
+#else
+	return((int)fread(state->buffer, 1, (size_t)len, state->pfile));
+#endif
+}
+
+#ifdef ILibWebServer_SENDFILE
+//
+// Sends one body chunk, with sendfile() moving the file data straight from the page cache to the socket.
+// Whatever the socket doesn't take is read into the session buffer and queued behind it, so
+// ILibAsyncSocket still drives backpressure, and OnSendOK resumes us once it drains.
+//
+enum ILibWebServer_Status ILibWebServer_StreamFile_SendFile(struct ILibWebServer_Session *session, ILibWebServer_StreamFileState *state, int len)
+{
+	struct packetheader *hdr = ILibWebClient_GetHeaderFromDataObject(ILibWebServer_Session_GetSystemData(session)->WebClientDataObject);
+	enum ILibWebServer_Status RetVal = ILibWebServer_ALL_DATA_SENT;
+	char hex[16];
+	int hexLen, chunked;
+	ssize_t bytesSent = 0;
+
+	if (hdr == NULL || session->SessionInterrupted != 0) { return(ILibWebServer_INVALID_SESSION); }
+	chunked = !(hdr->VersionLength == 3 && memcmp(hdr->Version, "1.0", 3) == 0);
+
+	if (chunked)
+	{
+		hexLen = sprintf_s(hex, sizeof(hex), "%X\r\n", len);
+		RetVal = ILibWebServer_Send_Raw(session, hex, hexLen, ILibAsyncSocket_MemoryOwnership_USER, ILibWebServer_DoneFlag_NotDone);
+		if (RetVal < 0) { return(RetVal); }
+	}
+	if (RetVal == ILibWebServer_ALL_DATA_SENT)
+	{
+		do
+		{
+			bytesSent = sendfile(*((int*)ILibAsyncSocket_GetSocket(ILibWebServer_Session_GetSystemData(session)->ConnectionToken)), state->fd, &(state->offset), (size_t)len);
+		} while (bytesSent < 0 && errno == EINTR);
+		if (bytesSent < 0)
+		{
+			if (errno != EAGAIN && errno != EWOULDBLOCK)
+			{
+				state->failed = 1;
+				return(ILibWebServer_SEND_RESULTED_IN_DISCONNECT);
+			}
+			bytesSent = 0;
+		}
+	}
+	if (bytesSent < len)
+	{
+		// The chunk header already promised len bytes, so if the file was truncated, the only way out is to drop the connection
+		if (ILibWebServer_StreamFile_Read(state, len - (int)bytesSent) != len - (int)bytesSent)
+		{
+			state->failed = 1;
+			return(ILibWebServer_SEND_RESULTED_IN_DISCONNECT);
+		}
+		RetVal = ILibWebServer_Send_Raw(session, state->buffer, len - (int)bytesSent, ILibAsyncSocket_MemoryOwnership_USER, ILibWebServer_DoneFlag_NotDone);
+		if (RetVal < 0) { return(RetVal); }
+	}
+	if (chunked)
+	{
+		if (ILibWebServer_Send_Raw(session, "\r\n", 2, ILibAsyncSocket_MemoryOwnership_STATIC, ILibWebServer_DoneFlag_NotDone) != ILibWebServer_ALL_DATA_SENT) { RetVal = ILibWebServer_NOT_ALL_DATA_SENT_YET; }
+	}
+	return(RetVal);
+}
+#endif
+
 // Private method used to send a file to the web session asynchronously
 void ILibWebServer_StreamFileSendOK(struct ILibWebServer_Session *sender)
 {
-	FILE* pfile;
-	size_t len;
-	int status = 0;
+	ILibWebServer_StreamFileState *state = (ILibWebServer_StreamFileState*)ILibWebServer_Session_GetSystemData(sender)->StreamFile;
+	enum ILibWebServer_Status status = ILibWebServer_ALL_DATA_SENT;
+	int len = 0, chunk;
 
-	pfile = (FILE*)sender->User3;
-	while ((len = fread(ILibScratchPad, 1, sizeof(ILibScratchPad), pfile)) != 0)
+	if (state == NULL) { return; }
+	while (state->remaining != 0)
 	{
-		status = ILibWebServer_StreamBody(sender, ILibScratchPad, (int)len, ILibAsyncSocket_MemoryOwnership_USER, ILibWebServer_DoneFlag_NotDone);
-		if (status != ILibWebServer_ALL_DATA_SENT || len < sizeof(ILibScratchPad)) break;
+		chunk = (state->remaining < 0 || state->remaining > ILibWebServer_StreamFile_ChunkSize) ? ILibWebServer_StreamFile_ChunkSize : (int)state->remaining;
+#ifdef ILibWebServer_SENDFILE
+		if (state->sendfile != 0 && ILibWebServer_Session_GetPendingBytesToSend(sender) == 0)
+		{
+			len = chunk;
+			status = ILibWebServer_StreamFile_SendFile(sender, state, chunk);
+		}
+		else
+#endif
+		if ((len = ILibWebServer_StreamFile_Read(state, chunk)) > 0)
+		{
+			status = ILibWebServer_StreamBody(sender, state->buffer, len, ILibAsyncSocket_MemoryOwnership_USER, ILibWebServer_DoneFlag_NotDone);
+		}
+
+		if (len < chunk) { state->remaining = 0; }					// End of file
+		else if (state->remaining > 0) { state->remaining -= len; }
+		if (status != ILibWebServer_ALL_DATA_SENT) { break; }
 	}
 
-	if (len < sizeof(ILibScratchPad) || status < 0)
+	if (state->remaining == 0 || status < 0)
 	{
-		// Finished sending the file or got a send error, close the session
-		ILibWebServer_StreamBody(sender, NULL, 0, ILibAsyncSocket_MemoryOwnership_STATIC, ILibWebServer_DoneFlag_Done);
-		fclose(pfile);
+		// Finished sending the file or got a send error, close the session. The stream state is detached
+		// first, because finishing the response can release the session.
+		ILibWebServer_Session_GetSystemData(sender)->StreamFile = NULL;
+#ifdef _POSIX
+		if (state->failed != 0)
+		{
+			// The socket is still open, but the body can't be completed
+			ILibWebServer_DisconnectSession(sender);
+		}
+		else
+#endif
+		if (status >= 0)
+		{
+			ILibWebServer_StreamBody(sender, NULL, 0, ILibAsyncSocket_MemoryOwnership_STATIC, ILibWebServer_DoneFlag_Done);
+		}
+		ILibWebServer_StreamFile_Free(state);
 	}
 }
 
-// Streams a file to the web session asynchronously, closes the session when done.
-// Caller must supply a valid file handle.
-void ILibWebServer_StreamFile(struct ILibWebServer_Session *session, FILE* pfile)
+// Streams length bytes of a file, starting at its current position, to the web session asynchronously. Closes the file when done.
+// Caller must supply a valid file handle, and length can be -1 to send everything up to the end of the file.
+void ILibWebServer_StreamFileEx(struct ILibWebServer_Session *session, FILE* pfile, int64_t length)
 {
+	ILibWebServer_StreamFileState *state;
+#ifdef _POSIX
+	struct stat st;
+#endif
+
+	if ((state = (ILibWebServer_StreamFileState*)malloc(sizeof(ILibWebServer_StreamFileState))) == NULL) { ILIBCRITICALEXIT(254); }
+	memset(state, 0, sizeof(ILibWebServer_StreamFileState));
+	state->pfile = pfile;
+	state->remaining = length < 0 ? -1 : length;
+#ifdef _POSIX
+	// Reads go straight to the descriptor with pread(), starting from where the caller left the stream
+	state->fd = fileno(pfile);
+	state->offset = ftello(pfile);
+	if (state->offset >= 0 && fstat(state->fd, &st) == 0 && S_ISREG(st.st_mode))
+	{
+		if (state->remaining < 0 || state->remaining > (int64_t)(st.st_size - state->offset)) { state->remaining = st.st_size > state->offset ? (int64_t)(st.st_size - state->offset) : 0; }
+#ifdef ILibWebServer_SENDFILE
+#ifndef MICROSTACK_NOTLS
+		// TLS is done by OpenSSL in user space, so those sessions have to go through the read buffer
+		state->sendfile = ILibAsyncSocket_GetSSL(ILibWebServer_Session_GetSystemData(session)->ConnectionToken) == NULL ? 1 : 0;
+#else
+		state->sendfile = 1;
+#endif
+#endif
+	}
+	else if (state->offset < 0)
+	{
+		state->offset = 0;
+	}
+#endif
+
+	if (ILibWebServer_Session_GetSystemData(session)->StreamFile != NULL) { ILibWebServer_StreamFile_Free((ILibWebServer_StreamFileState*)ILibWebServer_Session_GetSystemData(session)->StreamFile); }
+	ILibWebServer_Session_GetSystemData(session)->StreamFile = state;
 	session->OnSendOK = ILibWebServer_StreamFileSendOK;
-	session->User3 = (void*)pfile;
 	ILibWebServer_StreamFileSendOK(session);
 }
@@ -261,7 +261,8 @@ ILibExportMethod void ILibWebServer_Resume(struct ILibWebServer_Session *session
 
 void ILibWebServer_OverrideReceiveHandler(struct ILibWebServer_Session *session, ILibWebServer_Session_OnReceive OnReceive);
 
-void ILibWebServer_StreamFile(struct ILibWebServer_Session *session, FILE* pfile);
+void ILibWebServer_StreamFileEx(struct ILibWebServer_Session *session, FILE* pfile, int64_t length);
+#define ILibWebServer_StreamFile(session, pfile) ILibWebServer_StreamFileEx(session, pfile, -1)
 
 #ifdef __cplusplus
 }
@@ -1241,6 +1241,16 @@ ILibTransport_DoneState ILibWrapper_WebRTC_DataChannel_SendEx(ILibWrapper_WebRTC
 
 	return(ILibSCTP_SendEx(connection->dtlsSession, dataChannel->streamId, data, dataLen, dataType));
 }
+void ILibWrapper_WebRTC_DataChannel_SetPriority(ILibWrapper_WebRTC_DataChannel* dataChannel, unsigned short priority)
+{
+	ILibWrapper_WebRTC_ConnectionStruct *connection = (ILibWrapper_WebRTC_ConnectionStruct*)dataChannel->parent;
+	ILibSCTP_SetStreamPriority(connection->dtlsSession, dataChannel->streamId, priority);
+}
+unsigned short ILibWrapper_WebRTC_DataChannel_GetPriority(ILibWrapper_WebRTC_DataChannel* dataChannel)
+{
+	ILibWrapper_WebRTC_ConnectionStruct *connection = (ILibWrapper_WebRTC_ConnectionStruct*)dataChannel->parent;
+	return(ILibSCTP_GetStreamPriority(connection->dtlsSession, dataChannel->streamId));
+}
 ILibTransport_DoneState ILibWrapper_WebRTC_DataChannel_Send(ILibWrapper_WebRTC_DataChannel* dataChannel, char* data, int dataLen)
 {
 	return(ILibWrapper_WebRTC_DataChannel_SendEx(dataChannel, data, dataLen, 53));
@@ -1280,6 +1290,10 @@ ILibWrapper_WebRTC_DataChannel* ILibWrapper_WebRTC_DataChannel_CreateEx(ILibWrap
 	ILibWebRTC_OpenDataChannel(((ILibWrapper_WebRTC_ConnectionStruct*)connection)->dtlsSession, streamId, channelName, channelNameLen);
 	return retVal;
 }
+void ILibWrapper_WebRTC_ConnectionFactory_SetCongestionControl(ILibWrapper_WebRTC_ConnectionFactory factory, ILibSCTP_CongestionControl cc)
+{
+	ILibSCTP_SetDefaultCongestionControl(((ILibWrapper_WebRTC_ConnectionFactoryStruct*)factory)->mStunModule, cc);
+}
 void ILibWrapper_WebRTC_ConnectionFactory_SetTurnServer(ILibWrapper_WebRTC_ConnectionFactory factory, struct sockaddr_in6* turnServer, char* username, int usernameLength, char* password, int passwordLength, ILibWebRTC_TURN_ConnectFlags turnSetting)
 {
 	ILibWrapper_WebRTC_ConnectionFactoryStruct *cf = (ILibWrapper_WebRTC_ConnectionFactoryStruct*)factory;
@@ -1326,5 +1340,9 @@ void ILibWrapper_WebRTC_ConnectionFactory_SetSimulatedLossPercentage(ILibWrapper
 {
 	ILibSCTP_SetSimulatedInboundLossPercentage(((ILibWrapper_WebRTC_ConnectionFactoryStruct*)factory)->mStunModule, lossPercentage);
 }
+void ILibWrapper_WebRTC_ConnectionFactory_SetSimulatedLossPercentageEx(ILibWrapper_WebRTC_ConnectionFactory factory, int lossPercentage, unsigned int seed)
+{
+	ILibSCTP_SetSimulatedInboundLossPercentageEx(((ILibWrapper_WebRTC_ConnectionFactoryStruct*)factory)->mStunModule, lossPercentage, seed);
+}
 #endif
 #endif
@@ -166,6 +166,13 @@ void ILibWrapper_WebRTC_ConnectionFactory_SendRaw(ILibWrapper_WebRTC_ConnectionF
 */
 void ILibWrapper_WebRTC_ConnectionFactory_SetTurnServer(ILibWrapper_WebRTC_ConnectionFactory factory, struct sockaddr_in6* turnServer, char* username, int usernameLength, char* password, int passwordLength, ILibWebRTC_TURN_ConnectFlags turnSetting);
 
+//! Sets the Congestion Controller to use for new WebRTC connections
+/*!
+	\param factory ConnectionFactory to configure
+	\param cc Congestion Controller
+*/
+void ILibWrapper_WebRTC_ConnectionFactory_SetCongestionControl(ILibWrapper_WebRTC_ConnectionFactory factory, ILibSCTP_CongestionControl cc);
+
 typedef void(*ILibWrapper_WebRTC_ConnectionFactory_STUNHandler)(ILibWrapper_WebRTC_ConnectionFactory sender, ILibStun_Results Result, struct sockaddr_in* PublicIP);
 void ILibWrapper_WebRTC_ConnectionFactory_PerformSTUN(ILibWrapper_WebRTC_ConnectionFactory factory, struct sockaddr_in* StunServer);
 void ILibWrapper_WebRTC_ConnectionFactory_Set_STUNHandler(ILibWrapper_WebRTC_ConnectionFactory factory, ILibWrapper_WebRTC_ConnectionFactory_STUNHandler handler);
@@ -379,9 +386,18 @@ ILibTransport_DoneState ILibWrapper_WebRTC_DataChannel_SendEx(ILibWrapper_WebRTC
 */
 ILibTransport_DoneState ILibWrapper_WebRTC_DataChannel_SendString(ILibWrapper_WebRTC_DataChannel* dataChannel, char* data, int dataLen);
 
+//! Set the scheduling priority of the specified Data Channel
+/*!
+	\param dataChannel The Data Channel to configure
+	\param priority Number of chunks this Data Channel may send, before yielding to the other Data Channels of the connection (Default is 1)
+*/
+void ILibWrapper_WebRTC_DataChannel_SetPriority(ILibWrapper_WebRTC_DataChannel* dataChannel, unsigned short priority);
+unsigned short ILibWrapper_WebRTC_DataChannel_GetPriority(ILibWrapper_WebRTC_DataChannel* dataChannel);
+
 #ifdef _WEBRTCDEBUG
 int ILibWrapper_WebRTC_Connection_Debug_Set(ILibWrapper_WebRTC_Connection connection, char* debugFieldName, ILibWrapper_WebRTC_Connection_Debug_OnEvent eventHandler);
 void ILibWrapper_WebRTC_ConnectionFactory_SetSimulatedLossPercentage(ILibWrapper_WebRTC_ConnectionFactory factory, int lossPercentage);
+void ILibWrapper_WebRTC_ConnectionFactory_SetSimulatedLossPercentageEx(ILibWrapper_WebRTC_ConnectionFactory factory, int lossPercentage, unsigned int seed);
 #endif
 
 /** @}*/
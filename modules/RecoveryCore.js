@@ -428,19 +428,15 @@ function getDirectoryInfo(reqpath)
         if (reqpath == '') { reqpath = '/'; }
         var results = null, xpath = path.join(reqpath, '*');
         //if (process.platform == "win32") { xpath = xpath.split('/').join('\\'); }
-        try { results = fs.readdirSync(xpath); } catch (e) { }
+        try { results = fs.readdirSync(xpath, { withFileTypes: true, stat: true }); } catch (e) { }
         if (results != null) {
             for (var i = 0; i < results.length; ++i) {
-                if ((results[i] != '.') && (results[i] != '..')) {
-                    var stat = null, p = path.join(reqpath, results[i]);
-                    //if (process.platform == "win32") { p = p.split('/').join('\\'); }
-                    try { stat = fs.statSync(p); } catch (e) { } // TODO: Get file size/date
-                    if ((stat != null) && (stat != undefined)) {
-                        if (stat.isDirectory() == true) {
-                            response.dir.push({ n: results[i], t: 2, d: stat.mtime });
-                        } else {
-                            response.dir.push({ n: results[i], t: 3, s: stat.size, d: stat.mtime });
-                        }
+                // type is that of the link target, so a 'symlink' here is a dangling link, which statSync() used to reject
+                if ((results[i].name != '.') && (results[i].name != '..') && (results[i].type != 'symlink')) {
+                    if (results[i].type == 'directory' || results[i].type == 'block') {
+                        response.dir.push({ n: results[i].name, t: 2, d: results[i].mtime });
+                    } else {
+                        response.dir.push({ n: results[i].name, t: 3, s: results[i].size, d: results[i].mtime });
                     }
                 }
             }
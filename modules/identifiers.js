@@ -63,6 +63,13 @@ function dataHandler(c)
     this.str += c.toString();
 }
 
+var hardwareInventory = null;
+if (process.platform == 'linux')
+{
+    // Native sysfs/SMBIOS collector, so we don't need to spawn lspci/lshw/dmidecode
+    try { hardwareInventory = require('HardwareInventory'); } catch (e) { }
+}
+
 function linux_identifiers()
 {
     var identifiers = {};
@@ -95,16 +102,21 @@ function linux_identifiers()
             throw ('this platform does not have DMI statistics');
         }
     } else {
-        var entries = require('fs').readdirSync('/sys/class/dmi/id');
-        for (var i in entries) {
-            if (require('fs').statSync('/sys/class/dmi/id/' + entries[i]).isFile()) {
-                try {
-                    ret[entries[i]] = require('fs').readFileSync('/sys/class/dmi/id/' + entries[i]).toString().trim();
-                } catch(z) { }
-                if (ret[entries[i]] == 'None') { delete ret[entries[i]]; }
+        if (hardwareInventory != null) {
+            var dmi = hardwareInventory.dmi();
+            for (var i in dmi) { ret[i] = dmi[i]; }
+        } else {
+            var entries = require('fs').readdirSync('/sys/class/dmi/id');
+            for (var i in entries) {
+                if (require('fs').statSync('/sys/class/dmi/id/' + entries[i]).isFile()) {
+                    try {
+                        ret[entries[i]] = require('fs').readFileSync('/sys/class/dmi/id/' + entries[i]).toString().trim();
+                    } catch(z) { }
+                    if (ret[entries[i]] == 'None') { delete ret[entries[i]]; }
+                }
             }
+            entries = null;
         }
-        entries = null;
 
         identifiers['bios_date'] = ret['bios_date'];
         identifiers['bios_vendor'] = ret['bios_vendor'];
@@ -122,11 +134,16 @@ function linux_identifiers()
         identifiers['bios_mode'] = (require('fs').statSync('/sys/firmware/efi').isDirectory() ? 'UEFI': 'Legacy');
     } catch (ex) { identifiers['bios_mode'] = 'Legacy'; }
 
-    var child = require('child_process').execFile('/bin/sh', ['sh']);
-    child.stdout.str = ''; child.stdout.on('data', dataHandler);
-    child.stdin.write('cat /proc/cpuinfo | grep -i "model name" | ' + "tr '\\n' ':' | awk -F: '{ print $2 }'\nexit\n");
-    child.waitExit();
-    identifiers['cpu_name'] = child.stdout.str.trim();
+    var child = null;
+    if (hardwareInventory != null) {
+        identifiers['cpu_name'] = hardwareInventory.cpu().name;
+    } else {
+        child = require('child_process').execFile('/bin/sh', ['sh']);
+        child.stdout.str = ''; child.stdout.on('data', dataHandler);
+        child.stdin.write('cat /proc/cpuinfo | grep -i "model name" | ' + "tr '\\n' ':' | awk -F: '{ print $2 }'\nexit\n");
+        child.waitExit();
+        identifiers['cpu_name'] = child.stdout.str.trim();
+    }
     if (identifiers['cpu_name'] == "") { // CPU BLANK, check lscpu instead
         child = require('child_process').execFile('/bin/sh', ['sh']);
         child.stdout.str = ''; child.stdout.on('data', dataHandler);
@@ -138,20 +155,38 @@ function linux_identifiers()
 
 
     // Fetch GPU info
-    child = require('child_process').execFile('/bin/sh', ['sh']);
-    child.stdout.str = ''; child.stdout.on('data', dataHandler);
-    child.stdin.write("lspci | grep ' VGA ' | tr '\\n' '`' | awk '{ a=split($0,lines" + ',"`"); printf "["; for(i=1;i<a;++i) { split(lines[i],gpu,"r: "); printf "%s\\"%s\\"", (i==1?"":","),gpu[2]; } printf "]"; }\'\nexit\n');
-    child.waitExit();
-    try { identifiers['gpu_name'] = JSON.parse(child.stdout.str.trim()); } catch (xx) { }
-    child = null;
+    if (hardwareInventory != null) {
+        var pci = hardwareInventory.pci();
+        identifiers['gpu_name'] = [];
+        for (var i = 0; i < pci.length; ++i) {
+            if ((pci[i].classId >> 8) == 0x0300) {
+                identifiers['gpu_name'].push(pci[i].manufacturer + ' ' + pci[i].description + (pci[i].revision != 0 ? (' (rev ' + (pci[i].revision < 16 ? '0' : '') + pci[i].revision.toString(16) + ')') : ''));
+            }
+        }
+    } else {
+        child = require('child_process').execFile('/bin/sh', ['sh']);
+        child.stdout.str = ''; child.stdout.on('data', dataHandler);
+        child.stdin.write("lspci | grep ' VGA ' | tr '\\n' '`' | awk '{ a=split($0,lines" + ',"`"); printf "["; for(i=1;i<a;++i) { split(lines[i],gpu,"r: "); printf "%s\\"%s\\"", (i==1?"":","),gpu[2]; } printf "]"; }\'\nexit\n');
+        child.waitExit();
+        try { identifiers['gpu_name'] = JSON.parse(child.stdout.str.trim()); } catch (xx) { }
+        child = null;
+    }
 
     // Fetch Storage Info
-    child = require('child_process').execFile('/bin/sh', ['sh']);
-    child.stdout.str = ''; child.stdout.on('data', dataHandler);
-    child.stdin.write("lshw -class disk | tr '\\n' '`' | awk '" + '{ len=split($0,lines,"*"); printf "["; for(i=2;i<=len;++i) { model=""; caption=""; size=""; clen=split(lines[i],item,"`"); for(j=2;j<clen;++j) { split(item[j],tokens,":"); split(tokens[1],key," "); if(key[1]=="description") { caption=substr(tokens[2],2); } if(key[1]=="product") { model=substr(tokens[2],2); } if(key[1]=="size") { size=substr(tokens[2],2);  } } if(model=="") { model=caption; } if(caption!="" || model!="") { printf "%s{\\"Caption\\":\\"%s\\",\\"Model\\":\\"%s\\",\\"Size\\":\\"%s\\"}",(i==2?"":","),caption,model,size; }  } printf "]"; }\'\nexit\n');
-    child.waitExit();
-    try { identifiers['storage_devices'] = JSON.parse(child.stdout.str.trim()); } catch (xx) { }
-    child = null;
+    if (hardwareInventory != null) {
+        var disks = hardwareInventory.disks();
+        identifiers['storage_devices'] = [];
+        for (var i = 0; i < disks.length; ++i) {
+            identifiers['storage_devices'].push({ Caption: disks[i].Caption, Model: disks[i].Model, Size: disks[i].Size });
+        }
+    } else {
+        child = require('child_process').execFile('/bin/sh', ['sh']);
+        child.stdout.str = ''; child.stdout.on('data', dataHandler);
+        child.stdin.write("lshw -class disk | tr '\\n' '`' | awk '" + '{ len=split($0,lines,"*"); printf "["; for(i=2;i<=len;++i) { model=""; caption=""; size=""; clen=split(lines[i],item,"`"); for(j=2;j<clen;++j) { split(item[j],tokens,":"); split(tokens[1],key," "); if(key[1]=="description") { caption=substr(tokens[2],2); } if(key[1]=="product") { model=substr(tokens[2],2); } if(key[1]=="size") { size=substr(tokens[2],2);  } } if(model=="") { model=caption; } if(caption!="" || model!="") { printf "%s{\\"Caption\\":\\"%s\\",\\"Model\\":\\"%s\\",\\"Size\\":\\"%s\\"}",(i==2?"":","),caption,model,size; }  } printf "]"; }\'\nexit\n');
+        child.waitExit();
+        try { identifiers['storage_devices'] = JSON.parse(child.stdout.str.trim()); } catch (xx) { }
+        child = null;
+    }
 
     // Fetch storage volumes using df
     child = require('child_process').execFile('/bin/sh', ['sh']);
@@ -165,7 +200,30 @@ function linux_identifiers()
     values.linux = ret;
     trimIdentifiers(values.identifiers);
 
-    var dmidecode = require('lib-finder').findBinary('dmidecode');
+    var nativeMemory = hardwareInventory != null ? hardwareInventory.memory() : null;
+    if (nativeMemory != null)
+    {
+        var mem = {}, key, key2, entry;
+        for (key in nativeMemory)
+        {
+            for (i = 0; i < nativeMemory[key].length; ++i)
+            {
+                entry = {};
+                for (key2 in nativeMemory[key][i])
+                {
+                    if (nativeMemory[key][i][key2] != 'Unknown' && nativeMemory[key][i][key2] != 'Not Specified' && nativeMemory[key][i][key2] != '')
+                    {
+                        entry[key2] = nativeMemory[key][i][key2];
+                    }
+                }
+                if (mem[key] == null) { mem[key] = []; }
+                mem[key].push(entry);
+            }
+        }
+        if (Object.keys(mem).length > 0) { values.linux.memory = mem; }
+    }
+
+    var dmidecode = nativeMemory == null ? require('lib-finder').findBinary('dmidecode') : null;
     if (dmidecode != null)
     {
         child = require('child_process').execFile('/bin/sh', ['sh']);
@@ -243,7 +301,19 @@ function linux_identifiers()
         child = null;
     }
 
-    var usbdevices = require('lib-finder').findBinary('usb-devices');
+    if (hardwareInventory != null)
+    {
+        // Same as usb-devices, which only lists the devices that have descriptor strings
+        var usb = hardwareInventory.usb();
+        values.linux.usb = [];
+        for (i = 0; i < usb.length; ++i)
+        {
+            if (usb[i].Manufacturer == null && usb[i].Product == null && usb[i].SerialNumber == null) { continue; }
+            values.linux.usb.push(usb[i]);
+        }
+    }
+
+    var usbdevices = hardwareInventory == null ? require('lib-finder').findBinary('usb-devices') : null;
     if (usbdevices != null)
     {
         var child = require('child_process').execFile('/bin/sh', ['sh']);
@@ -314,7 +384,18 @@ function linux_identifiers()
         child = null;
     }
 
-    var pcidevices = require('lib-finder').findBinary('lspci');
+    if (hardwareInventory != null)
+    {
+        var pci = hardwareInventory.pci();
+        values.linux.pci = [];
+        for (i = 0; i < pci.length; ++i)
+        {
+            values.linux.pci.push({ bus: pci[i].bus, device: pci[i].device, manufacturer: pci[i].manufacturer, description: pci[i].description });
+            if (pci[i].subsystem != null) { values.linux.pci.peek().subsystem = { manufacturer: pci[i].subsystem.manufacturer, description: pci[i].subsystem.description }; }
+        }
+    }
+
+    var pcidevices = hardwareInventory == null ? require('lib-finder').findBinary('lspci') : null;
     if (pcidevices != null)
     {
         var child = require('child_process').execFile('/bin/sh', ['sh']);
@@ -360,23 +441,36 @@ function linux_identifiers()
 
     // Linux Last Boot Up Time
     try {
-        child = require('child_process').execFile('/usr/bin/uptime', ['', '-s']); // must include blank value at begining for some reason?
-        child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
-        child.stderr.on('data', function () { });
-        child.waitExit();
-        var regex = /^\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}$/;
-        if (regex.test(child.stdout.str.trim())) {
-            values.linux.LastBootUpTime = child.stdout.str.trim();
-        } else {
-            child = require('child_process').execFile('/bin/sh', ['sh']);
+        if (hardwareInventory != null) {
+            // Same format as uptime -s, from the boot time in /proc/stat
+            var btime = /^btime (\d+)$/m.exec(require('fs').readFileSync('/proc/stat').toString());
+            if (btime != null) {
+                var boot = new Date(parseInt(btime[1]) * 1000);
+                var pad = function (v) { return ((v < 10 ? '0' : '') + v); };
+                values.linux.LastBootUpTime = boot.getFullYear() + '-' + pad(boot.getMonth() + 1) + '-' + pad(boot.getDate()) + ' ' + pad(boot.getHours()) + ':' + pad(boot.getMinutes()) + ':' + pad(boot.getSeconds());
+            }
+        }
+    } catch (ex) { }
+    try {
+        if (values.linux.LastBootUpTime == null) {
+            child = require('child_process').execFile('/usr/bin/uptime', ['', '-s']); // must include blank value at begining for some reason?
             child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
-            child.stdin.write('date -d "@$(( $(date +%s) - $(awk \'{print int($1)}\' /proc/uptime) ))" "+%Y-%m-%d %H:%M:%S"\nexit\n');
+            child.stderr.on('data', function () { });
             child.waitExit();
+            var regex = /^\d{4}-\d{2}-\d{2} \d{2}:\d{2}:\d{2}$/;
             if (regex.test(child.stdout.str.trim())) {
                 values.linux.LastBootUpTime = child.stdout.str.trim();
+            } else {
+                child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
+                child.stdin.write('date -d "@$(( $(date +%s) - $(awk \'{print int($1)}\' /proc/uptime) ))" "+%Y-%m-%d %H:%M:%S"\nexit\n');
+                child.waitExit();
+                if (regex.test(child.stdout.str.trim())) {
+                    values.linux.LastBootUpTime = child.stdout.str.trim();
+                }
             }
+            child = null;
         }
-        child = null;
     } catch (ex) { }
 
     // Linux TPM
@@ -34,6 +34,27 @@ var PropertyChangeMask = (1 << 22);
 var PropertyNotify = 28;
 var AnyPropertyType = 0;
 
+var processTable = null;
+if (process.platform == 'linux')
+{
+    // Native /proc enumeration, so we don't need to spawn ps
+    try { processTable = require('ProcessTable'); } catch (e) { }
+}
+
+//
+// Returns the processes matching the specified filter
+//
+function findProcesses(filter)
+{
+    var ret = [];
+    var ps = processTable.snapshot();
+    for (var i = 0; i < ps.length; ++i)
+    {
+        if (filter(ps[i])) { ret.push(ps[i]); }
+    }
+    return (ret);
+}
+
 function getLibInfo(libname)
 {
     var child = require('child_process').execFile('/bin/sh', ['sh']);
@@ -277,6 +298,31 @@ function monitorinfo()
                 {
                 }
             }
+            if (!this.Location_X11RANDR)
+            {
+                var xrandrinfo = getLibInfo('libXrandr');
+                for (ix in xrandrinfo)
+                {
+                    if (xrandrinfo.length == 1 || xrandrinfo[ix].hwcap == "0")
+                    {
+                        try
+                        {
+                            Object.defineProperty(this, 'Location_X11RANDR', { value: xrandrinfo[ix].path });
+                            break;
+                        }
+                        catch (ex)
+                        {
+                        }
+                    }
+                }
+                try
+                {
+                    if (process.env['Location_X11RANDR']) { Object.defineProperty(this, 'Location_X11RANDR', { value: process.env['Location_X11RANDR'] }); }
+                }
+                catch (xx)
+                {
+                }
+            }
         };
     }
     if(process.platform == 'freebsd')
@@ -300,6 +346,10 @@ function monitorinfo()
             {
                 if ((lib = require('lib-finder')('libXfixes')[0])) { Object.defineProperty(this, 'Location_X11FIXES', { value: lib.location }); }
             }
+            if (!this.Location_X11RANDR)
+            {
+                if ((lib = require('lib-finder')('libXrandr')[0])) { Object.defineProperty(this, 'Location_X11RANDR', { value: lib.location }); }
+            }
         }
     }
 
@@ -381,20 +431,29 @@ function monitorinfo()
                     this._X11.CreateMethod('XChangeKeyboardMapping');
                 }
 
-                var ch = require('child_process').execFile('/bin/sh', ['sh']);
-                ch.stderr.on('data', function () { });
-                ch.stdout.str = ''; ch.stdout.on('data', function (c) { this.str += c.toString(); });
-                if (process.platform == 'freebsd')
+                var xFound;
+                if (processTable != null)
                 {
-                    ch.stdin.write('ps -ax | grep X\nexit\n');
+                    xFound = findProcesses(function (p) { return (p.comm.indexOf('X') >= 0); }).length > 0;
                 }
                 else
                 {
-                    ch.stdin.write('ps -e | grep X\nexit\n');
+                    var ch = require('child_process').execFile('/bin/sh', ['sh']);
+                    ch.stderr.on('data', function () { });
+                    ch.stdout.str = ''; ch.stdout.on('data', function (c) { this.str += c.toString(); });
+                    if (process.platform == 'freebsd')
+                    {
+                        ch.stdin.write('ps -ax | grep X\nexit\n');
+                    }
+                    else
+                    {
+                        ch.stdin.write('ps -e | grep X\nexit\n');
+                    }
+                    ch.waitExit();
+                    xFound = ch.stdout.str.trim() != '';
                 }
-                ch.waitExit();
 
-                if (ch.stdout.str.trim() != '')
+                if (xFound)
                 {
                     // X Server found
                     Object.defineProperty(this, 'kvm_x11_serverFound', { value: true });
@@ -546,6 +605,16 @@ function monitorinfo()
         function xinfo_xdm(info, uid)
         {
             if (process.platform != 'linux') { return(info); }
+            if (processTable != null)
+            {
+                var xs = findProcesses(function (p) { return (p.uid == uid && p.cmd.indexOf('X') >= 0); });
+                if (xs.length > 0)
+                {
+                    if (info == null) { info = {}; }
+                    info.xdm = xs[0].cmd.split(' ')[0].split('/').pop().toLowerCase();
+                }
+                return (info);
+            }
             var child = require('child_process').execFile('/bin/sh', ['sh']);
             child.stdout.str = '';
             child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -562,28 +631,45 @@ function monitorinfo()
         {
             var ret = null;
             var uname = require('user-sessions').getUsername(consoleuid);
-            var child = require('child_process').execFile('/bin/sh', ['sh']);
-            child.stdout.str = '';
-            child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stdin.write("ps " + (process.platform == 'freebsd' ? "-ax " : "") + "-e -o uid -o tty -o command | grep X | ");
-            child.stdin.write("awk '{ ");
-            child.stdin.write('        display="";');
-            child.stdin.write('        if($4~/^:/)');
-            child.stdin.write('        {');
-            child.stdin.write('           display=$4;');
-            child.stdin.write('        }');
-            child.stdin.write('        match($0, /-auth .+/);');
-            child.stdin.write('       split(substr($0,RSTART+6,RLENGTH-6), _authtok, " ");');
-            child.stdin.write('        _auth = _authtok[1];');
-            //child.stdin.write('        _auth = substr($0,RSTART+6,RLENGTH-6);');
-            child.stdin.write('        if($1=="' + consoleuid + '" && _auth!="")');
-            child.stdin.write("        {");
-            child.stdin.write("           printf \"%s,%s,%s,%s\",$1,$2,_auth,display;");
-            child.stdin.write("        }");
-            child.stdin.write("     }'\nexit\n");
+            var tokens = [];
+            var child;
+            if (processTable != null)
+            {
+                // Look for the XServer instance for this user, that specifies the XAUTHORITY
+                var xs = findProcesses(function (p) { return (p.uid == consoleuid && p.cmd.indexOf('X') >= 0 && p.cmd.indexOf('-auth ') >= 0); });
+                var args, auth;
+                for (var xi = 0; xi < xs.length && tokens.length == 0; ++xi)
+                {
+                    args = xs[xi].cmd.split(' ');
+                    auth = xs[xi].cmd.split('-auth ')[1].split(' ')[0];
+                    if (auth != '') { tokens = [xs[xi].uid.toString(), xs[xi].tty, auth, (args.length > 1 && args[1].startsWith(':')) ? args[1] : '']; }
+                }
+            }
+            else
+            {
+                child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = '';
+                child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stdin.write("ps " + (process.platform == 'freebsd' ? "-ax " : "") + "-e -o uid -o tty -o command | grep X | ");
+                child.stdin.write("awk '{ ");
+                child.stdin.write('        display="";');
+                child.stdin.write('        if($4~/^:/)');
+                child.stdin.write('        {');
+                child.stdin.write('           display=$4;');
+                child.stdin.write('        }');
+                child.stdin.write('        match($0, /-auth .+/);');
+                child.stdin.write('       split(substr($0,RSTART+6,RLENGTH-6), _authtok, " ");');
+                child.stdin.write('        _auth = _authtok[1];');
+                //child.stdin.write('        _auth = substr($0,RSTART+6,RLENGTH-6);');
+                child.stdin.write('        if($1=="' + consoleuid + '" && _auth!="")');
+                child.stdin.write("        {");
+                child.stdin.write("           printf \"%s,%s,%s,%s\",$1,$2,_auth,display;");
+                child.stdin.write("        }");
+                child.stdin.write("     }'\nexit\n");
 
-            child.waitExit();
-            var tokens = child.stdout.str.trim().split(',');
+                child.waitExit();
+                tokens = child.stdout.str.trim().split(',');
+            }
             console.info1(JSON.stringify(tokens));
             if (tokens.length == 4)
             {
@@ -734,13 +820,20 @@ function monitorinfo()
                         while (ttys.length > 0)
                         {
                             var tty = ttys.pop();
-                            child = require('child_process').execFile('/bin/sh', ['sh']);
-                            child.stdout.str = '';
-                            child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-                            child.stdin.write("ps -e -o tty -o pid -o uid | grep " + tty + " | grep " + consoleuid + " | awk '{ print $2 }' \nexit\n");
-                            child.waitExit();
-
-                            var lines = child.stdout.str.split('\n');
+                            var lines;
+                            if (processTable != null)
+                            {
+                                lines = findProcesses(function (p) { return (p.tty == tty && p.uid == consoleuid); }).map(function (p) { return (p.pid.toString()); });
+                            }
+                            else
+                            {
+                                child = require('child_process').execFile('/bin/sh', ['sh']);
+                                child.stdout.str = '';
+                                child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                                child.stdin.write("ps -e -o tty -o pid -o uid | grep " + tty + " | grep " + consoleuid + " | awk '{ print $2 }' \nexit\n");
+                                child.waitExit();
+                                lines = child.stdout.str.split('\n');
+                            }
                             var ps, psx, v, vs = 0;
                             for (var x in lines)
                             {
@@ -819,13 +912,20 @@ function monitorinfo()
             else if(ret.display == null || ret.display === '')
             {
                 // We need to find $DISPLAY by looking at all the processes running on the same tty as the XServer instance for this user session
-                child = require('child_process').execFile('/bin/sh', ['sh']);
-                child.stdout.str = '';
-                child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-                child.stdin.write("ps -e -o tty -o pid -o user:9999 | grep " + ret.tty + " | grep " + uname + " | awk '{ print $2 }' \nexit\n");
-                child.waitExit();
-
-                var lines = child.stdout.str.split('\n');
+                var lines;
+                if (processTable != null)
+                {
+                    lines = findProcesses(function (p) { return (p.tty == ret.tty && p.user == uname); }).map(function (p) { return (p.pid.toString()); });
+                }
+                else
+                {
+                    child = require('child_process').execFile('/bin/sh', ['sh']);
+                    child.stdout.str = '';
+                    child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                    child.stdin.write("ps -e -o tty -o pid -o user:9999 | grep " + ret.tty + " | grep " + uname + " | awk '{ print $2 }' \nexit\n");
+                    child.waitExit();
+                    lines = child.stdout.str.split('\n');
+                }
                 var ps, psx, v, vs = 0;
                 for(var x in lines)
                 {
@@ -57,6 +57,11 @@ function processManager() {
             throw (process.platform + ' not supported');
             break;
     }
+    if (process.platform == 'linux')
+    {
+        // Native /proc enumeration, so we don't need to spawn ps/pgrep
+        try { this._processTable = require('ProcessTable'); } catch (e) { }
+    }
     this.enumerateProcesses = function enumerateProcesses()
     {
         var promise = require('promise');
@@ -117,6 +122,19 @@ function processManager() {
                 if (callback) { callback.apply(this, [retVal]); }
                 break;
             case 'linux': // Linux processes
+                if (this._processTable != null)
+                {
+                    var J = {};
+                    var ps = this._processTable.snapshot();
+                    for (var i = 0; i < ps.length; ++i) { J[ps[i].pid] = { pid: ps[i].pid.toString(), user: ps[i].user, cmd: ps[i].cmd }; }
+                    if (callback)
+                    {
+                        var args = [J];
+                        for (i = 1; i < arguments.length; ++i) { args.push(arguments[i]); }
+                        callback.apply(this, args);
+                    }
+                    break;
+                }
                 var fallback = false;
                 var users = require('fs').existsSync('/etc/login.defs') ? 'user:99' : 'user';
                 var p = require('child_process').execFile('/bin/sh', ['sh']);
@@ -238,6 +256,13 @@ function processManager() {
         }
     };
 
+    // Return an object of: { added: [process], changed: [process], removed: [pid] }, since the last call (Linux only)
+    this.getProcessChanges = function getProcessChanges()
+    {
+        if (this._processTable == null) { throw ('getProcessChanges() not supported on ' + process.platform); }
+        return (this._processTable.diff());
+    };
+
     // Get information about a specific process on Linux
     this.getProcessInfo = function getProcessInfo(pid)
     {
@@ -319,7 +344,16 @@ function processManager() {
         }
     };
 
-    if(process.platform != 'win32')
+    if (this._processTable != null)
+    {
+        this.getProcess = function getProcess(cmd)
+        {
+            var ret = this._processTable.find(cmd);
+            if (ret.length == 0) { throw (cmd + ' not found'); }
+            return (ret);
+        };
+    }
+    else if(process.platform != 'win32')
     {
         Object.defineProperty(this, '_pgrep', {
             value: (function ()
@@ -371,6 +405,17 @@ function processManager() {
             });
             return (result);
         }
+        if (this._processTable != null)
+        {
+            var ps = this._processTable.snapshot();
+            var pids = [];
+            for (var i = 0; i < ps.length; ++i)
+            {
+                if (ps[i].cmd.indexOf(cmd) >= 0) { pids.push(ps[i].pid); }
+            }
+            if (pids.length == 0) { throw (cmd + ' not found'); }
+            return (pids);
+        }
 
         var child = require('child_process').execFile('/bin/sh', ['sh']);
         child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
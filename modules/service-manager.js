@@ -128,6 +128,16 @@ function parseServiceStatus(token)
 
 if (process.platform == 'linux')
 {
+    // Native unit file, cgroup and PID file queries, so status checks don't need to spawn systemctl/service
+    var serviceStatus = null;
+    try { serviceStatus = require('ServiceStatus'); } catch (e) { }
+
+    function _systemd_UnitValue(conf, section, key)
+    {
+        var unit = serviceStatus != null ? serviceStatus.unitFile(conf) : null;
+        if (unit == null) { return (null); }
+        return ((unit[section] != null && unit[section][key] != null) ? unit[section][key] : '');
+    }
     function _upstart_GetServiceTable()
     {
         var child = require('child_process').execFile('/bin/sh', ['sh']);
@@ -166,6 +176,17 @@ if (process.platform == 'linux')
     }
     function _systemd_GetServiceTable()
     {
+        var services = serviceStatus != null ? serviceStatus.systemdServices() : null;
+        if (services != null)
+        {
+            var ret = {};
+            for (var unit in services)
+            {
+                if (services[unit].running) { ret[unit] = 'running'; }
+            }
+            return (ret);
+        }
+
         var child = require('child_process').execFile('/bin/sh', ['sh']);
         child.stderr.str = ''; child.stderr.on('data', function (c) { this.str += c.toString(); });
         child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
@@ -1488,6 +1509,13 @@ function serviceManager()
                                     Object.defineProperty(ret, '_autorestart', {
                                         value: (function ()
                                         {
+                                            try
+                                            {
+                                                return (/^\s*supervisor="supervise-daemon"/m.test(require('fs').readFileSync(ret.conf).toString()));
+                                            }
+                                            catch (e)
+                                            {
+                                            }
                                             var child = require('child_process').execFile('/bin/sh', ['sh']);
                                             child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
                                             child.stderr.on('data', function () { });
@@ -1502,6 +1530,10 @@ function serviceManager()
                                 {
                                     get: function ()
                                     {
+                                        if (serviceStatus != null && this.serviceType == 'init')
+                                        {
+                                            return ((this.OpenRC ? serviceStatus.openrc(this.name) : serviceStatus.sysv(this.name)).enabled ? 'AUTO_START' : 'DEMAND_START');
+                                        }
                                         var child = require('child_process').execFile('/bin/sh', ['sh']);
                                         child.stderr.on('data', function (c) { });
                                         child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
@@ -1629,6 +1661,12 @@ function serviceManager()
                                 {
                                     return (this.pid() == process.pid);
                                 }
+                                if (serviceStatus != null && isMe.platform == 'init')
+                                {
+                                    // Same as below, the child of the pid in the PID file, otherwise the pid itself
+                                    var status = serviceStatus.sysv(this.name);
+                                    if (status.pidFile != null) { return ((status.child != 0 ? status.child : status.pid) == process.pid); }
+                                }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout.str = '';
                                 child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1662,6 +1700,11 @@ function serviceManager()
                             ret.isRunning = function isRunning()
                             {
                                 if (this.OpenRC) { return (!isNaN(this.pid())); }
+                                if (serviceStatus != null && isRunning.platform == 'init')
+                                {
+                                    var status = serviceStatus.sysv(this.name);
+                                    if (status.pidFile != null) { return (status.running); }
+                                }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout.str = '';
                                 child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1759,6 +1802,14 @@ function serviceManager()
                             {
                                 ret.pid = function pid()
                                 {
+                                    if (serviceStatus != null)
+                                    {
+                                        // With supervise-daemon, the PID file belongs to the supervisor, so the service is its child
+                                        var status = serviceStatus.openrc(this.name);
+                                        if (status.pidFile == null) { return (NaN); }
+                                        if (this._autorestart) { return (status.child != 0 ? status.child : NaN); }
+                                        return (status.pid);
+                                    }
                                     var child = require('child_process').execFile('/bin/sh', ['sh']);
                                     child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
                                     child.stderr.on('data', function () { });
@@ -1827,6 +1878,8 @@ function serviceManager()
                                 {
                                     get: function ()
                                     {
+                                        var status = serviceStatus != null ? serviceStatus.systemd(this.escname + '.service') : null;
+                                        if (status != null) { return (status.enabled ? 'AUTO_START' : 'DEMAND_START'); }
                                         var child = require('child_process').execFile('/bin/sh', ['sh']);
                                         child.stderr.on('data', function (c) { });
                                         child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
@@ -1837,6 +1890,8 @@ function serviceManager()
                                 });
                             ret.description = function description()
                             {
+                                var value = _systemd_UnitValue(this.conf, 'Unit', 'Description');
+                                if (value != null) { return (value); }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
                                 if (require('fs').existsSync('/lib/systemd/system/' + this.escname.split('\\').join('\\\\') + '.service'))
@@ -1855,6 +1910,8 @@ function serviceManager()
                             }
                             ret.appWorkingDirectory = function appWorkingDirectory()
                             {
+                                var value = _systemd_UnitValue(this.conf, 'Service', 'WorkingDirectory');
+                                if (value != null) { return (value == '' ? '' : (value.replace(/\/$/, '') + '/')); }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout.str = '';
                                 child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1871,6 +1928,12 @@ function serviceManager()
                             };
                             ret.appLocation = function ()
                             {
+                                var value = _systemd_UnitValue(this.conf, 'Service', 'ExecStart');
+                                if (value != null)
+                                {
+                                    // Same as systemd-escape -u, without turning '-' into '/'
+                                    return (value.split(' ')[0].replace(/\\x([0-9a-fA-F]{2})/g, function (m, c) { return (String.fromCharCode(parseInt(c, 16))); }));
+                                }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout.str = '';
                                 child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1893,6 +1956,9 @@ function serviceManager()
                             };
                             ret.isMe = function isMe()
                             {
+                                // The cgroup can only tell us that we're not part of the service. Only systemd knows which process is the Main PID
+                                var status = serviceStatus != null ? serviceStatus.systemd(this.escname + '.service') : null;
+                                if (status != null && status.pids.indexOf(process.pid) < 0) { return (false); }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout.str = '';
                                 child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1903,6 +1969,8 @@ function serviceManager()
                             };
                             ret.isRunning = function isRunning()
                             {
+                                var status = serviceStatus != null ? serviceStatus.systemd(this.escname + '.service') : null;
+                                if (status != null) { return (status.running); }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout.str = '';
                                 child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1939,6 +2007,8 @@ function serviceManager()
                             };
                             ret.parameters = function parameters()
                             {
+                                var value = _systemd_UnitValue(this.conf, 'Service', 'ExecStart');
+                                if (value != null) { return (value.match(/(?:[^\s"]+|"[^"]*")+/g)); }
                                 var child = require('child_process').execFile('/bin/sh', ['sh']);
                                 child.stdout._str = '';
                                 child.stdout.on('data', function (chunk) { this._str += chunk.toString(); });
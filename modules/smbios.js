@@ -129,6 +129,13 @@ function SMBiosTables()
             if (callback) { callback.apply(this, [this._parse(SMData)]); return; } else { return (this._parse(SMData)); }
         }
         if (process.platform == 'linux') {
+            // Read the raw table from sysfs when we can, so we don't need to spawn dmidecode
+            var table = null;
+            try { table = require('HardwareInventory').smbios(); } catch (e) { }
+            if (table != null) {
+                if (callback) { callback.apply(this, [this._parse(table)]); return; } else { return (this._parse(table)); }
+            }
+
             var MemoryStream = require('MemoryStream');
             this.child = require('child_process').execFile('/usr/sbin/dmidecode', ['dmidecode', '-u']);
             this.child.SMBiosTable = this;
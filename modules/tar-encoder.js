@@ -163,20 +163,21 @@ function encodeFiles(files, basePath)
 
 function expandFolderPaths(folderPath, recurse, arr)
 {
-    var files = require('fs').readdirSync(folderPath);
+    // stat follows links, so type matches what statSync() would have returned for each entry
+    var files = require('fs').readdirSync(folderPath, { withFileTypes: true, stat: true });
     for(var f in files)
     {
-        if(require('fs').statSync(folderPath + '/' + files[f]).isDirectory())
+        if (files[f].type == 'directory' || files[f].type == 'block')
         {
             if (recurse)
             {
-                arr.push(folderPath + '/' + files[f]);
-                expandFolderPaths(folderPath + '/' + files[f], recurse, arr);
+                arr.push(folderPath + '/' + files[f].name);
+                expandFolderPaths(folderPath + '/' + files[f].name, recurse, arr);
             }
         }
         else
         {
-            arr.push(folderPath + '/' + files[f]);
+            arr.push(folderPath + '/' + files[f].name);
         }
     }
 }
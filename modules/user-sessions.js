@@ -419,10 +419,43 @@ function UserSessions()
     }
     else if(process.platform == 'linux' || process.platform == 'freebsd')
     {
+        var loginSessions = null;
+        if (process.platform == 'linux')
+        {
+            // Native passwd/logind enumeration, so we don't need to spawn getent/loginctl
+            try { loginSessions = require('LoginSessions'); } catch (e) { }
+        }
+
+        //
+        // Returns the logind sessions for uids >= min, in the same form as 'loginctl list-sessions'.
+        // Sessions without a seat or tty are skipped, unless 'all' is specified
+        //
+        function linux_nativeSessions(min, all)
+        {
+            var ret = [];
+            var sessions = loginSessions.sessions();
+            var station;
+            for (var i = 0; i < sessions.length; ++i)
+            {
+                if (sessions[i].uid == null || (min != null && sessions[i].uid < min)) { continue; }
+                station = sessions[i].seat ? sessions[i].seat : (sessions[i].tty ? sessions[i].tty : '');
+                if (station == '' && !all) { continue; }
+                ret.push({ uid: sessions[i].uid, sid: sessions[i].id, user: sessions[i].user, station: station, active: sessions[i].state == 'active' });
+            }
+            return (ret);
+        }
+        function linux_getUser(id)
+        {
+            // Same as getent, numeric keys are uids
+            if (typeof (id) == 'string' && /^[0-9]+$/.test(id)) { id = parseInt(id); }
+            return (loginSessions.getUser(id));
+        }
+
         Object.defineProperty(this, 'hasLoginCtl', 
             {
                 get: function ()
                 {
+                    if (loginSessions != null) { return (loginSessions.logind); }
                     if (this._hasLoginCtl != null) { return (this._hasLoginCtl); }
                     var child = require('child_process').execFile('/bin/sh', ['sh']);
                     child.stdout.str = '';
@@ -439,6 +472,33 @@ function UserSessions()
                 var ret = null;
                 var min = this.minUid();
                 var child;
+                var i;
+                if (loginSessions != null)
+                {
+                    var sessions = this.hasLoginCtl ? linux_nativeSessions(null) : [];
+                    var users = loginSessions.users();
+                    while (sessions.length > 0)
+                    {
+                        ret = loginSessions.getUser(sessions.pop().uid);
+                        if (ret != null && ret.uid < min && (ret.gecos.indexOf('Display Manager') >= 0 || ret.name == 'gdm' || ret.name == 'lightdm' || ret.name == 'sddm'))
+                        {
+                            return (ret.uid);
+                        }
+                    }
+                    for (i = 0; i < users.length; ++i)
+                    {
+                        if (users[i].uid < min && users[i].gecos.indexOf('Gnome Display Manager') >= 0) { return (users[i].uid); }
+                    }
+                    for (i = 0; i < users.length; ++i)
+                    {
+                        if (users[i].uid < min && (users[i].name + users[i].gecos + users[i].home + users[i].shell).indexOf('gdm') >= 0) { return (users[i].uid); }
+                    }
+                    for (i = 0; i < users.length; ++i)
+                    {
+                        if (users[i].uid < min && users[i].gecos.indexOf('Light Display Manager') >= 0) { return (users[i].uid); }
+                    }
+                    return (0);
+                }
                 if (process.platform == 'linux' || process.platform == 'freebsd')
                 {
                     if(this.hasLoginCtl)
@@ -520,39 +580,31 @@ function UserSessions()
                     }
                 }
 
-                child = require('child_process').execFile('/bin/sh', ['sh']);
-                child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
-                child.stderr.str = ''; child.stderr.on('data', function (c) { this.str += c.toString(); });
-                child.stdin.write('getent passwd | grep "Gnome Display Manager" | ' + "tr '\\n' '`' | awk -F: '{ print $3 }'\nexit\n");
-                child.waitExit();
-                if (child.stdout.str.trim() != '' && (ret = parseInt(child.stdout.str.trim())) < min) { return (parseInt(child.stdout.str.trim())); }
+                // gdmUid is read every time the display or the console session is resolved, so these run on the pooled shells
+                var shell = require('ShellPool');
+                child = shell.run('getent passwd | grep "Gnome Display Manager" | ' + "tr '\\n' '`' | awk -F: '{ print $3 }'");
+                if (child.stdout.trim() != '' && (ret = parseInt(child.stdout.trim())) < min) { return (parseInt(child.stdout.trim())); }
 
-                child = require('child_process').execFile('/bin/sh', ['sh']);
-                child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
-                child.stderr.str = ''; child.stderr.on('data', function (c) { console.log(c.toString()); });
-                child.stdin.write('getent passwd | grep gdm | ' + "tr '\\n' '`' | awk -F'`' '" + '{ for(i=1;i<NF;++i) { split($i, f, ":"); if(f[3]+0<' + min + '+0) { print f[3]; break; } } }' + "'\nexit\n");
-                child.waitExit();
-                if (child.stdout.str.trim() != '' && (ret = parseInt(child.stdout.str.trim())) < min) { return (parseInt(child.stdout.str.trim())); }
+                child = shell.run('getent passwd | grep gdm | ' + "tr '\\n' '`' | awk -F'`' '" + '{ for(i=1;i<NF;++i) { split($i, f, ":"); if(f[3]+0<' + min + '+0) { print f[3]; break; } } }' + "'");
+                if (child.stderr != '') { console.log(child.stderr); }
+                if (child.stdout.trim() != '' && (ret = parseInt(child.stdout.trim())) < min) { return (parseInt(child.stdout.trim())); }
 
-                child = require('child_process').execFile('/bin/sh', ['sh']);
-                child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
-                child.stderr.str = ''; child.stderr.on('data', function (c) { this.str += c.toString(); });
-                child.stdin.write('getent passwd | grep "Light Display Manager" | ' + "tr '\\n' '`' | awk -F: '{ print $3 }'\nexit\n");
-                child.waitExit();
-                if (child.stdout.str.trim() != '' && (ret = parseInt(child.stdout.str.trim())) < min) { return (parseInt(child.stdout.str.trim())); }
+                child = shell.run('getent passwd | grep "Light Display Manager" | ' + "tr '\\n' '`' | awk -F: '{ print $3 }'");
+                if (child.stdout.trim() != '' && (ret = parseInt(child.stdout.trim())) < min) { return (parseInt(child.stdout.trim())); }
 
                 return (0);
             }
         });
         this.getUid = function getUid(username)
         {
-            var child = require('child_process').execFile('/bin/sh', ['sh']);
-            child.stdout.str = '';
-            child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stdin.write("getent passwd \"" + username + "\" | awk -F: '{print $3}'\nexit\n");
-            child.waitExit();
+            if (loginSessions != null)
+            {
+                var u = loginSessions.getUser(username);
+                if (u != null) { return (u.uid); }
+                throw ('username: ' + username + ' NOT FOUND');
+            }
 
-            var ret = parseInt(child.stdout.str);
+            var ret = parseInt(require('ShellPool').run("getent passwd \"" + username + "\" | awk -F: '{print $3}'").stdout);
             if (ret >= 0) { return (ret); }
             throw ('username: ' + username + ' NOT FOUND');
         };
@@ -566,45 +618,54 @@ function UserSessions()
                 return;
             }
 
-            var child = require('child_process').execFile('/bin/sh', ['sh']);
-            child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
-
-            child.stdin.write("loginctl list-sessions | tr '\\n' '`' | awk '{");
-            child.stdin.write('printf "[";');
-            child.stdin.write('del="";');
-            child.stdin.write('n=split($0, lines, "`");');
-            child.stdin.write('for(i=2;i<n;++i)');
-            child.stdin.write('{');
-            child.stdin.write('   split(lines[i], tok, " ");');
-            child.stdin.write('   if(tok[4]=="") { continue; }');
-            child.stdin.write('   printf "%s{\\"Username\\": \\"%s\\", \\"SessionId\\": \\"%s\\", \\"State\\": \\"Online\\", \\"uid\\": \\"%s\\"}", del, tok[3], tok[1], tok[2];');
-            child.stdin.write('   del=",";');
-            child.stdin.write('}');
-            child.stdin.write('printf "]";');
-            child.stdin.write("}'\nexit\n");
-            child.waitExit();
+            var found = false;
+            if (loginSessions != null)
+            {
+                var sessions = linux_nativeSessions(null);
+                for (var i = 0; i < sessions.length && !found; ++i) { found = sessions[i].active; }
+            }
+            else
+            {
+                var child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
 
-            var info1 = JSON.parse(child.stdout.str);
-            var sids = [];
-            var i;
-            for (i = 0; i < info1.length; ++i) { sids.push(info1[i].SessionId); }
+                child.stdin.write("loginctl list-sessions | tr '\\n' '`' | awk '{");
+                child.stdin.write('printf "[";');
+                child.stdin.write('del="";');
+                child.stdin.write('n=split($0, lines, "`");');
+                child.stdin.write('for(i=2;i<n;++i)');
+                child.stdin.write('{');
+                child.stdin.write('   split(lines[i], tok, " ");');
+                child.stdin.write('   if(tok[4]=="") { continue; }');
+                child.stdin.write('   printf "%s{\\"Username\\": \\"%s\\", \\"SessionId\\": \\"%s\\", \\"State\\": \\"Online\\", \\"uid\\": \\"%s\\"}", del, tok[3], tok[1], tok[2];');
+                child.stdin.write('   del=",";');
+                child.stdin.write('}');
+                child.stdin.write('printf "]";');
+                child.stdin.write("}'\nexit\n");
+                child.waitExit();
 
-            console.info1('SIDs => ' + JSON.stringify(sids));
+                var info1 = JSON.parse(child.stdout.str);
+                var sids = [];
+                var i;
+                for (i = 0; i < info1.length; ++i) { sids.push(info1[i].SessionId); }
 
-            child = require('child_process').execFile('/bin/sh', ['sh']);
-            child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stdin.write("loginctl show-session -p State " + sids.join(' ') + " | grep State= | tr '\\n' '`' | awk -F'`' '{");
-            child.stdin.write('   for(n=1;n<NF;++n)');
-            child.stdin.write('   {');
-            child.stdin.write('      if($n=="State=active") { print n; break; }');
-            child.stdin.write('   }');
-            child.stdin.write("}'\nexit\n");
-            child.waitExit();
+                console.info1('SIDs => ' + JSON.stringify(sids));
 
+                child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stdin.write("loginctl show-session -p State " + sids.join(' ') + " | grep State= | tr '\\n' '`' | awk -F'`' '{");
+                child.stdin.write('   for(n=1;n<NF;++n)');
+                child.stdin.write('   {');
+                child.stdin.write('      if($n=="State=active") { print n; break; }');
+                child.stdin.write('   }');
+                child.stdin.write("}'\nexit\n");
+                child.waitExit();
+                found = child.stdout.str.trim() != '';
+            }
 
-            if(child.stdout.str.trim() != '')
+            if (found)
             {
                 // There was an active session
                 console.info1('Active Sessions found');
@@ -625,19 +686,38 @@ function UserSessions()
         this.Current = function Current(cb)
         {
             var ret = null;
-            var child = require('child_process').execFile('/bin/sh', ['sh']);
-            child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
+            var child;
 
             if (process.platform == 'freebsd' || !this.hasLoginCtl)
             {
+                child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
                 child.stdin.write("who | tr '\\n' '`' | awk -F'`' '" + '{ printf "{"; for(a=1;a<NF;++a) { n=split($a, tok, " "); printf "%s\\"%s\\": \\"%s\\"", (a>1?",":""), tok[2], tok[1];  } printf "}";  }\'\nexit\n');
                 child.waitExit();
             }
+            else if (loginSessions != null)
+            {
+                var min = this.minUid();
+                var sessions = linux_nativeSessions(min);
+                var i;
+                ret = [];
+                for (i = 0; i < sessions.length; ++i)
+                {
+                    ret.push({ Username: sessions[i].user, Domain: '', SessionId: sessions[i].sid, State: 'Online', uid: sessions[i].uid.toString(), StationName: sessions[i].station.startsWith('pts/') ? sessions[i].station : 'Console' });
+                }
+                for (i = 0; i < sessions.length; ++i)
+                {
+                    if (sessions[i].active) { ret[i].State = 'Active'; break; }
+                }
+            }
             else
             {
                 var min = this.minUid();
 
+                child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
                 child.stdin.write("loginctl list-sessions | tr '\\n' '`' | awk '{");
                 child.stdin.write('printf "[";');
                 child.stdin.write('del="";');
@@ -750,15 +830,26 @@ function UserSessions()
 
         this.minUid =  function minUid()
         {
-            var child = require('child_process').execFile('/bin/sh', ['sh']);
-            child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stdin.write("cat /etc/login.defs | grep UID_ | awk '{ if($1==\"UID_MIN\") { print $2; } }'\nexit\n");
-            child.waitExit();
-            return (parseInt(child.stdout.str.trim()) >= 0 ? parseInt(child.stdout.str.trim()) : 500);
+            try
+            {
+                var m = require('fs').readFileSync('/etc/login.defs').toString().match(/^\s*UID_MIN\s+([0-9]+)/m);
+                if (m != null) { return (parseInt(m[1])); }
+            }
+            catch (e)
+            {
+            }
+            return (500);
         }
         this._users = function _users()
         {
+            if (loginSessions != null)
+            {
+                var users = loginSessions.users();
+                var r = {};
+                for (var i = 0; i < users.length; ++i) { r[users[i].name] = users[i].uid.toString(); }
+                return (r);
+            }
+
             var child = require('child_process').execFile('/bin/sh', ['sh']);
             child.stdout.str = '';
             child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -775,6 +866,14 @@ function UserSessions()
             return (ret);
         }
         this._uids = function _uids() {
+            if (loginSessions != null)
+            {
+                var users = loginSessions.users();
+                var r = {};
+                for (var i = 0; i < users.length; ++i) { r[users[i].uid] = users[i].name; }
+                return (r);
+            }
+
             var child = require('child_process').execFile('/bin/sh', ['sh']);
             child.stdout.str = '';
             child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -792,6 +891,17 @@ function UserSessions()
         this.loginUids = function loginUids()
         {
             var min = this.minUid();
+            if (loginSessions != null)
+            {
+                var users = loginSessions.users();
+                var r = [];
+                for (var i = 0; i < users.length; ++i)
+                {
+                    if (users[i].uid >= min && users[i].shell.split('/').pop() != 'nologin') { r.push(users[i].uid); }
+                }
+                return (r);
+            }
+
             var child = require('child_process').execFile('/bin/sh', ['sh']);
             child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
             child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -842,12 +952,13 @@ function UserSessions()
         };
         this.consoleUid = function consoleUid(options)
         {
-            var child = require('child_process').execFile('/bin/sh', ['sh']);
-            child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-            child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
+            var child;
 
             if (process.platform == 'freebsd' || !this.hasLoginCtl)
             {
+                child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
                 child.stdin.write("who | tr '\\n' '`' | awk -F'`' '{");
                 child.stdin.write("  for(i=1;i<NF;++i) ");
                 child.stdin.write("  { ");
@@ -876,10 +987,32 @@ function UserSessions()
                     }
                 }
             }
+            else if (loginSessions != null)
+            {
+                var min = this.minUid();
+                var sessions = linux_nativeSessions(min);
+                var i;
+                if (options && options.active == true)
+                {
+                    var ret = [];
+                    for (i = 0; i < sessions.length; ++i)
+                    {
+                        if (sessions[i].active) { ret.push(sessions[i].uid); }
+                    }
+                    return (ret);
+                }
+                for (i = 0; i < sessions.length; ++i)
+                {
+                    if (sessions[i].active && !sessions[i].station.startsWith('pts/')) { return (sessions[i].uid); }
+                }
+            }
             else
             {
                 var min = this.minUid();
 
+                child = require('child_process').execFile('/bin/sh', ['sh']);
+                child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
                 child.stdin.write("loginctl list-sessions | tr '\\n' '`' | awk '{");
                 child.stdin.write('printf "[";');
                 child.stdin.write('del="";');
@@ -980,29 +1113,37 @@ function UserSessions()
                 if (gdm == 0)
                 {
                     // Before we give up, lets see if there is an X session somewhere, probably from VNC
-                    child = require('child_process').execFile('/bin/sh', ['sh']);
-                    child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
-                    child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
-                    child.stdin.write("loginctl list-sessions | tr '\\n' '`' | awk '{");
-                    child.stdin.write('printf "[";');
-                    child.stdin.write('del="";');
-                    child.stdin.write('n=split($0, lines, "`");');
-                    child.stdin.write('for(i=1;i<n;++i)');
-                    child.stdin.write('{');
-                    child.stdin.write('   split(lines[i], tok, " ");');
-                    child.stdin.write('   if((tok[2]+0)>=' + min + ')');
-                    child.stdin.write('   {');
-                    child.stdin.write('      printf "%s{\\"uid\\": \\"%s\\", \\"sid\\": \\"%s\\"}", del, tok[2], tok[1];');
-                    child.stdin.write('      del=",";');
-                    child.stdin.write('   }');
-                    child.stdin.write('}');
-                    child.stdin.write('printf "]";');
-                    child.stdin.write("}'\nexit\n");
-                    child.waitExit();
-                    var info1 = JSON.parse(child.stdout.str);
                     var uids = [];
                     var i;
-                    for (i = 0; i < info1.length; ++i) { uids.push(info1[i].uid); }
+                    if (loginSessions != null && this.hasLoginCtl)
+                    {
+                        var sessions = linux_nativeSessions(this.minUid(), true);
+                        for (i = 0; i < sessions.length; ++i) { uids.push(sessions[i].uid); }
+                    }
+                    else
+                    {
+                        child = require('child_process').execFile('/bin/sh', ['sh']);
+                        child.stdout.str = ''; child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
+                        child.stderr.str = ''; child.stderr.on('data', function (chunk) { this.str += chunk.toString(); });
+                        child.stdin.write("loginctl list-sessions | tr '\\n' '`' | awk '{");
+                        child.stdin.write('printf "[";');
+                        child.stdin.write('del="";');
+                        child.stdin.write('n=split($0, lines, "`");');
+                        child.stdin.write('for(i=1;i<n;++i)');
+                        child.stdin.write('{');
+                        child.stdin.write('   split(lines[i], tok, " ");');
+                        child.stdin.write('   if((tok[2]+0)>=' + min + ')');
+                        child.stdin.write('   {');
+                        child.stdin.write('      printf "%s{\\"uid\\": \\"%s\\", \\"sid\\": \\"%s\\"}", del, tok[2], tok[1];');
+                        child.stdin.write('      del=",";');
+                        child.stdin.write('   }');
+                        child.stdin.write('}');
+                        child.stdin.write('printf "]";');
+                        child.stdin.write("}'\nexit\n");
+                        child.waitExit();
+                        var info1 = JSON.parse(child.stdout.str);
+                        for (i = 0; i < info1.length; ++i) { uids.push(info1[i].uid); }
+                    }
                     console.info1('UIDS => ' + JSON.stringify(sids));
 
                     while(uids.length>0)
@@ -1026,6 +1167,12 @@ function UserSessions()
         
         this.getHomeFolder = function getHomeFolder(id)
         {
+            if (loginSessions != null)
+            {
+                var u = linux_getUser(id);
+                return (u != null ? u.home : '');
+            }
+
             var child = require('child_process').execFile('/bin/sh', ['sh']);
             child.stdout.str = '';
             child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1036,6 +1183,13 @@ function UserSessions()
 
         this.getUsername = function getUsername(uid)
         {
+            if (loginSessions != null)
+            {
+                var u = linux_getUser(uid);
+                if (u != null) { return (u.name); }
+                throw ('uid: ' + uid + ' NOT FOUND');
+            }
+
             var child = require('child_process').execFile('/bin/sh', ['sh']);
             child.stdout.str = '';
             child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -1046,6 +1200,13 @@ function UserSessions()
         };
         this.getGroupname = function getGroupname(gid)
         {
+            if (loginSessions != null)
+            {
+                var g = loginSessions.getGroup(typeof (gid) == 'string' && /^[0-9]+$/.test(gid) ? parseInt(gid) : gid);
+                if (g != null) { return (g.name); }
+                throw ('gid: ' + gid + ' NOT FOUND');
+            }
+
             var child = require('child_process').execFile('/bin/sh', ['sh']);
             child.stdout.str = '';
             child.stdout.on('data', function (chunk) { this.str += chunk.toString(); });
@@ -50,30 +50,29 @@ function linux_dns()
     //
     // The linux implementation will look for the dns address in /etc/resolve.conf
     //
-    var child = require('child_process').execFile('/bin/sh', ['sh']);
-    child.stdout.str = ''; child.stdout.on('data', function (c) { this.str += c.toString(); });
-    child.stderr.on('data', function () { });
-    child.stdin.write("cat /etc/resolv.conf | grep nameserver | tr '\n' '`' | awk -F'`' '");
-    child.stdin.write('{');
-    child.stdin.write('   DEL="";');
-    child.stdin.write('   printf "[";');
-    child.stdin.write('   for(i=1;i<NF;++i)');
-    child.stdin.write('   {');
-    child.stdin.write('      if($i~/^#/) { continue; }')
-    child.stdin.write('      z=split($i,T," ");');
-    child.stdin.write('      if(z==2 && T[1]=="nameserver")');
-    child.stdin.write('      {');
-    child.stdin.write('         printf "%s\\\"%s\\\"",DEL,T[2];');
-    child.stdin.write('         DEL=",";');
-    child.stdin.write('      }');
-    child.stdin.write('   }');
-    child.stdin.write('   printf "]";');
-    child.stdin.write("}'");
-    child.stdin.write('\nexit\n');
-    child.waitExit();
+    var script = "cat /etc/resolv.conf | grep nameserver | tr '\n' '`' | awk -F'`' '";
+    script += '{';
+    script += '   DEL="";';
+    script += '   printf "[";';
+    script += '   for(i=1;i<NF;++i)';
+    script += '   {';
+    script += '      if($i~/^#/) { continue; }';
+    script += '      z=split($i,T," ");';
+    script += '      if(z==2 && T[1]=="nameserver")';
+    script += '      {';
+    script += '         printf "%s\\\"%s\\\"",DEL,T[2];';
+    script += '         DEL=",";';
+    script += '      }';
+    script += '   }';
+    script += '   printf "]";';
+    script += "}'";
+
+    //
+    // This is called often enough, that it runs on the pooled shells, instead of spawning a new one each time
+    //
     try
     {
-        return(JSON.parse(child.stdout.str.trim()));
+        return(JSON.parse(require('ShellPool').run(script).stdout.trim()));
     }
     catch(e)
     {
@@ -0,0 +1,359 @@
+/*
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+	http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+//
+// Self test of the Linux KVM tile hashing and dirty tracking, over a corpus of generated frames
+//
+// Usage: make kvmtiletest [ARCHID=n] [KVMTILETEST_ARGS="frames mutations seed"]
+//
+// Drives getCopyRects(), update_tile_info(), next_dirty_tile() and getTileAt() the same way the KVM main loop does, with
+// three workers, and keeps a model of what the viewer has, by applying the copy and picture messages of every frame.
+// It fails if a tile that differs from what the viewer has is not dirty (a false negative), if the viewer doesn't have
+// the current content of every tile at the end of a frame, or if a mutation of a tile doesn't change its hash.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "meshcore/KVM/Linux/linux_tile.h"
+#include "meshcore/meshdefines.h"
+
+// Normally defined by linux_kvm.c
+int SCREEN_NUM = 0;
+int SCREEN_WIDTH = 1000;
+int SCREEN_HEIGHT = 300;
+int SCREEN_DEPTH = 24;
+int SCALED_WIDTH = 1000;		// Not a multiple of the tile width, so the last column of tiles is partly off screen
+int SCALED_HEIGHT = 300;
+int TILE_WIDTH = 32;
+int TILE_HEIGHT = 32;
+int TILE_WIDTH_COUNT = 32;
+int TILE_HEIGHT_COUNT = 10;
+int COMPRESSION_RATIO = 100;
+struct tileInfo_t g_tileInfo;
+extern int COPY_RECT_ENABLED;
+extern uint64_t util_tilehash(int x, int y, void *desktop, int tilewidth, int tileheight);
+
+// Normally defined by microstack, which this test doesn't link
+void ILib_POSIX_CrashHandler(int code) { fprintf(stderr, "Critical exit %d\n", code); abort(); }
+int ILibMemory_Copy_s(void *destination, size_t destinationSize, void *source, size_t sourceLength)
+{
+	if (sourceLength > destinationSize) { abort(); }
+	memcpy(destination, source, sourceLength);
+	return(0);
+}
+unsigned int crc32(unsigned int crc, const unsigned char *buf, unsigned int len)
+{
+	int k;
+	crc = ~crc;
+	while (len--)
+	{
+		crc ^= *buf++;
+		for (k = 0; k < 8; ++k) { crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320 : crc >> 1; }
+	}
+	return(~crc);
+}
+
+#define KVM_TILE_TEST_WORKERS 3
+
+int stride, rows;
+long long desktopsize;
+unsigned char *desktop, *viewer, *previous;
+unsigned int seed = 1;
+long falseNegatives = 0, falsePositives = 0, stale = 0, copies = 0, pictures = 0;
+
+int kvm_tile_test_rand() { seed = seed * 1103515245 + 12345; return((int)((seed >> 8) & 0x7FFFFF)); }
+
+int kvm_tile_test_differs(unsigned char *a, unsigned char *b, int row, int col)
+{
+	int y, width = TILE_WIDTH;
+
+	// Only the part of the tile that is on screen matters to the viewer
+	if ((col + 1) * TILE_WIDTH > SCALED_WIDTH) { width = SCALED_WIDTH - (col * TILE_WIDTH); }
+	for (y = row * TILE_HEIGHT; y < (row + 1) * TILE_HEIGHT && y < SCALED_HEIGHT; ++y)
+	{
+		if (memcmp(a + ((long long)y * stride) + (col * TILE_WIDTH * 3), b + ((long long)y * stride) + (col * TILE_WIDTH * 3), width * 3) != 0) { return(1); }
+	}
+	return(0);
+}
+
+// Width and height of an encoded tile, read from the PNG IHDR or the JPEG SOF
+void kvm_tile_test_imagesize(unsigned char *image, int length, int *width, int *height)
+{
+	int i;
+
+	*width = *height = 0;
+	if (length > 24 && image[0] == 0x89 && image[1] == 'P')
+	{
+		*width = (image[16] << 24) | (image[17] << 16) | (image[18] << 8) | image[19];
+		*height = (image[20] << 24) | (image[21] << 16) | (image[22] << 8) | image[23];
+		return;
+	}
+	for (i = 2; i + 9 < length; i += 2 + ((image[i + 2] << 8) | image[i + 3]))
+	{
+		if (image[i] != 0xFF) { break; }
+		if (image[i + 1] == 0xC0 || image[i + 1] == 0xC1 || image[i + 1] == 0xC2)
+		{
+			*height = (image[i + 5] << 8) | image[i + 6];
+			*width = (image[i + 7] << 8) | image[i + 8];
+			return;
+		}
+	}
+}
+
+// Messages are packed back to back, so their fields can be at any alignment
+#define KVM_TILE_TEST_U16(p) (((p)[0] << 8) | (p)[1])
+#define KVM_TILE_TEST_U32(p) ((KVM_TILE_TEST_U16(p) << 16) | KVM_TILE_TEST_U16((p) + 2))
+
+// Applies either the copies or the pictures of a frame to the viewer. Copies move what the viewer already has, pictures are the current content
+void kvm_tile_test_apply(struct tileFrame_t *frame, int type)
+{
+	size_t offset = 0;
+	unsigned char *h;
+	int messageType, size, x, y, w, hh, sx, sy, r;
+
+	while (offset < frame->length)
+	{
+		h = (unsigned char*)(frame->buffer + offset);
+		messageType = KVM_TILE_TEST_U16(h);
+		size = KVM_TILE_TEST_U16(h + 2);
+		if (messageType == MNG_JUMBO)
+		{
+			size = 8 + KVM_TILE_TEST_U32(h + 4);
+			h += 8;
+			messageType = KVM_TILE_TEST_U16(h);
+		}
+		if (messageType == MNG_KVM_COPY && type == MNG_KVM_COPY)
+		{
+			sx = KVM_TILE_TEST_U16(h + 4); sy = KVM_TILE_TEST_U16(h + 6); w = KVM_TILE_TEST_U16(h + 8); hh = KVM_TILE_TEST_U16(h + 10); x = KVM_TILE_TEST_U16(h + 12); y = KVM_TILE_TEST_U16(h + 14);
+			if (sy < y)
+			{
+				for (r = hh - 1; r >= 0; --r) { memmove(viewer + ((long long)(y + r) * stride) + (x * 3), viewer + ((long long)(sy + r) * stride) + (sx * 3), w * 3); }
+			}
+			else
+			{
+				for (r = 0; r < hh; ++r) { memmove(viewer + ((long long)(y + r) * stride) + (x * 3), viewer + ((long long)(sy + r) * stride) + (sx * 3), w * 3); }
+			}
+			++copies;
+		}
+		else if (messageType == MNG_KVM_PICTURE && type == MNG_KVM_PICTURE)
+		{
+			x = KVM_TILE_TEST_U16(h + 4); y = KVM_TILE_TEST_U16(h + 6);
+			kvm_tile_test_imagesize(h + 8, size - (int)((char*)(h + 8) - (frame->buffer + offset)), &w, &hh);
+			if (w <= 0 || hh <= 0) { printf("FAIL: unreadable tile at %d,%d\n", x, y); exit(1); }
+			for (r = y; r < y + hh && r < SCALED_HEIGHT; ++r)
+			{
+				memcpy(viewer + ((long long)r * stride) + (x * 3), desktop + ((long long)r * stride) + (x * 3), (x + w > SCALED_WIDTH ? SCALED_WIDTH - x : w) * 3);
+			}
+			++pictures;
+		}
+		offset += size;
+	}
+}
+
+// Changes the desktop the way real screens change, some of the time in ways that a weak hash would miss
+void kvm_tile_test_mutate(int frame)
+{
+	int i, x, y, w, h, r, k, tx, ty;
+	unsigned char tmp[32 * 3];
+
+	memcpy(previous, desktop, desktopsize);
+	switch (kvm_tile_test_rand() % 9)
+	{
+		case 0:		// Nothing changed
+			break;
+		case 1:		// A few single bit flips
+			for (i = 1 + (kvm_tile_test_rand() % 4); i > 0; --i)
+			{
+				desktop[((long long)(kvm_tile_test_rand() % SCALED_HEIGHT) * stride) + (kvm_tile_test_rand() % (SCALED_WIDTH * 3))] ^= (unsigned char)(1 << (kvm_tile_test_rand() % 8));
+			}
+			break;
+		case 2:		// A small filled rectangle, like a text cursor or a button
+			x = kvm_tile_test_rand() % SCALED_WIDTH; y = kvm_tile_test_rand() % SCALED_HEIGHT; w = 1 + (kvm_tile_test_rand() % 40); h = 1 + (kvm_tile_test_rand() % 20);
+			for (r = y; r < y + h && r < SCALED_HEIGHT; ++r) { memset(desktop + ((long long)r * stride) + (x * 3), kvm_tile_test_rand() & 0xFF, (x + w > SCALED_WIDTH ? SCALED_WIDTH - x : w) * 3); }
+			break;
+		case 3:		// Vertical scroll of a region, with new content coming in
+			x = (kvm_tile_test_rand() % 8) * TILE_WIDTH; w = TILE_WIDTH * (4 + (kvm_tile_test_rand() % 16)); k = (kvm_tile_test_rand() % 41) - 20;
+			if (x + w > SCALED_WIDTH) { w = SCALED_WIDTH - x; }
+			if (k == 0) { k = 3; }
+			for (r = (k > 0 ? 0 : SCALED_HEIGHT - 1); r >= 0 && r < SCALED_HEIGHT; r += (k > 0 ? 1 : -1))
+			{
+				if (r + k >= 0 && r + k < SCALED_HEIGHT) { memcpy(desktop + ((long long)r * stride) + (x * 3), previous + ((long long)(r + k) * stride) + (x * 3), w * 3); }
+				else { for (i = 0; i < w * 3; ++i) { desktop[((long long)r * stride) + (x * 3) + i] = (unsigned char)((r * 7) ^ (i * 13) ^ frame); } }
+			}
+			break;
+		case 4:		// Two rows of a tile swapped, so the tile has the same bytes in a different order
+			tx = kvm_tile_test_rand() % (SCALED_WIDTH / TILE_WIDTH); ty = kvm_tile_test_rand() % (SCALED_HEIGHT / TILE_HEIGHT);
+			y = ty * TILE_HEIGHT + (kvm_tile_test_rand() % TILE_HEIGHT); r = ty * TILE_HEIGHT + (kvm_tile_test_rand() % TILE_HEIGHT);
+			memcpy(tmp, desktop + ((long long)y * stride) + (tx * TILE_WIDTH * 3), sizeof(tmp));
+			memcpy(desktop + ((long long)y * stride) + (tx * TILE_WIDTH * 3), desktop + ((long long)r * stride) + (tx * TILE_WIDTH * 3), sizeof(tmp));
+			memcpy(desktop + ((long long)r * stride) + (tx * TILE_WIDTH * 3), tmp, sizeof(tmp));
+			break;
+		case 5:		// Two pixels of a row swapped
+			y = kvm_tile_test_rand() % SCALED_HEIGHT; x = kvm_tile_test_rand() % (SCALED_WIDTH - 1);
+			memcpy(tmp, desktop + ((long long)y * stride) + (x * 3), 3);
+			memcpy(desktop + ((long long)y * stride) + (x * 3), desktop + ((long long)y * stride) + ((x + 1) * 3), 3);
+			memcpy(desktop + ((long long)y * stride) + ((x + 1) * 3), tmp, 3);
+			break;
+		case 6:		// Content changed in the part of the last column of tiles that is on screen
+			for (r = kvm_tile_test_rand() % SCALED_HEIGHT, i = 0; i < 3; ++i) { desktop[((long long)r * stride) + ((SCALED_WIDTH - 1) * 3) + i] += 1 + (kvm_tile_test_rand() % 255); }
+			break;
+		case 7:		// Large repaint, like a window being opened
+			x = kvm_tile_test_rand() % (SCALED_WIDTH / 2); y = kvm_tile_test_rand() % (SCALED_HEIGHT / 2);
+			for (r = y; r < y + (SCALED_HEIGHT / 2); ++r)
+			{
+				for (i = x * 3; i < (x + (SCALED_WIDTH / 2)) * 3; ++i) { desktop[((long long)r * stride) + i] = (unsigned char)(((i / 24) + (r / 8) + frame) & 1 ? 0xF0 : 0x10); }
+			}
+			break;
+		case 8:		// A byte changed by a different amount in every channel
+			x = kvm_tile_test_rand() % SCALED_WIDTH; y = kvm_tile_test_rand() % SCALED_HEIGHT;
+			for (i = 0; i < 3; ++i) { desktop[((long long)y * stride) + (x * 3) + i] += (unsigned char)(i + 1); }
+			break;
+	}
+}
+
+// Runs one frame through the tile code, the same way the KVM main loop does, and checks the result against the viewer
+void kvm_tile_test_frame(struct tileFrame_t *frames)
+{
+	int row, col, i, c;
+
+	for (i = 0; i < KVM_TILE_TEST_WORKERS; ++i) { frames[i].length = 0; }
+
+	getCopyRects(&frames[0], desktop, desktopsize);
+	kvm_tile_test_apply(&frames[0], MNG_KVM_COPY);
+	for (i = 0; i < KVM_TILE_TEST_WORKERS; ++i) { update_tile_info(desktop, desktopsize, i); }
+
+	// Every tile that the viewer doesn't have must be dirty
+	for (row = 0; row < TILE_HEIGHT_COUNT; ++row)
+	{
+		for (col = 0; col < TILE_WIDTH_COUNT; ++col)
+		{
+			if (kvm_tile_test_differs(desktop, viewer, row, col))
+			{
+				if (!TILE_IS_DIRTY(TILE_INDEX(row, col))) { ++falseNegatives; printf("FAIL: tile %d,%d changed, but is not dirty\n", row, col); }
+			}
+			else if (TILE_IS_DIRTY(TILE_INDEX(row, col)) && !kvm_tile_test_differs(desktop, previous, row, col))
+			{
+				++falsePositives;
+			}
+		}
+	}
+
+	for (i = 0; i < KVM_TILE_TEST_WORKERS; ++i)
+	{
+		for (c = next_dirty_tile(0); c >= 0; c = next_dirty_tile(c + 1))
+		{
+			if (g_tileInfo.owner[c] != i) { continue; }
+			getTileAt(TILE_WIDTH * (c % TILE_WIDTH_COUNT), TILE_HEIGHT * (c / TILE_WIDTH_COUNT), &frames[i], desktop, desktopsize, c / TILE_WIDTH_COUNT, c % TILE_WIDTH_COUNT);
+		}
+	}
+	if (next_dirty_tile(0) >= 0) { printf("FAIL: tile %d is still dirty after the frame\n", next_dirty_tile(0)); exit(1); }
+
+	for (i = 0; i < KVM_TILE_TEST_WORKERS; ++i) { kvm_tile_test_apply(&frames[i], MNG_KVM_PICTURE); }
+	for (row = 0; row < TILE_HEIGHT_COUNT; ++row)
+	{
+		for (col = 0; col < TILE_WIDTH_COUNT; ++col)
+		{
+			if (kvm_tile_test_differs(desktop, viewer, row, col)) { ++stale; printf("FAIL: viewer doesn't have the current content of tile %d,%d\n", row, col); }
+		}
+	}
+}
+
+// Mutates random tiles of a random image, and checks that the hash of the tile always changes
+long kvm_tile_test_mutations(int count)
+{
+	unsigned char tmp[32 * 3];
+	long misses = 0;
+	uint64_t h0;
+	int i, k, tx, ty, x, y, y2;
+	long long offset;
+
+	for (i = 0; i < count; ++i)
+	{
+		for (k = 0; k < 64; ++k) { desktop[kvm_tile_test_rand() % (stride * SCALED_HEIGHT)] = (unsigned char)kvm_tile_test_rand(); }
+		tx = kvm_tile_test_rand() % (SCALED_WIDTH / TILE_WIDTH); ty = kvm_tile_test_rand() % (SCALED_HEIGHT / TILE_HEIGHT);
+		x = (tx * TILE_WIDTH * 3) + (kvm_tile_test_rand() % (TILE_WIDTH * 3));
+		y = (ty * TILE_HEIGHT) + (kvm_tile_test_rand() % TILE_HEIGHT);
+		offset = ((long long)y * stride) + x;
+		h0 = util_tilehash(tx * TILE_WIDTH, ty * TILE_HEIGHT, desktop, TILE_WIDTH, TILE_HEIGHT);
+
+		switch (kvm_tile_test_rand() % 3)
+		{
+			case 0:
+				desktop[offset] ^= (unsigned char)(1 << (kvm_tile_test_rand() % 8));
+				break;
+			case 1:
+				desktop[offset] += (unsigned char)(1 + (kvm_tile_test_rand() % 255));
+				break;
+			case 2:
+				y2 = (ty * TILE_HEIGHT) + (kvm_tile_test_rand() % TILE_HEIGHT);
+				if (y2 == y || memcmp(desktop + ((long long)y * stride) + (tx * TILE_WIDTH * 3), desktop + ((long long)y2 * stride) + (tx * TILE_WIDTH * 3), sizeof(tmp)) == 0) { --i; continue; }
+				memcpy(tmp, desktop + ((long long)y * stride) + (tx * TILE_WIDTH * 3), sizeof(tmp));
+				memcpy(desktop + ((long long)y * stride) + (tx * TILE_WIDTH * 3), desktop + ((long long)y2 * stride) + (tx * TILE_WIDTH * 3), sizeof(tmp));
+				memcpy(desktop + ((long long)y2 * stride) + (tx * TILE_WIDTH * 3), tmp, sizeof(tmp));
+				break;
+		}
+		if (util_tilehash(tx * TILE_WIDTH, ty * TILE_HEIGHT, desktop, TILE_WIDTH, TILE_HEIGHT) == h0) { ++misses; }
+	}
+	return(misses);
+}
+
+int main(int argc, char **argv)
+{
+	struct tileFrame_t frames[KVM_TILE_TEST_WORKERS];
+	int frameCount = argc > 1 ? atoi(argv[1]) : 2000;
+	int mutationCount = argc > 2 ? atoi(argv[2]) : 1000000;
+	int i, x, y;
+	long misses;
+
+	if (argc > 3) { seed = (unsigned int)atoi(argv[3]); }
+
+	stride = adjust_screen_size(SCALED_WIDTH) * 3;
+	rows = adjust_screen_size(SCALED_HEIGHT);
+	desktopsize = (long long)stride * rows;
+	if ((desktop = (unsigned char*)calloc(1, desktopsize)) == NULL || (viewer = (unsigned char*)calloc(1, desktopsize)) == NULL || (previous = (unsigned char*)calloc(1, desktopsize)) == NULL) { return(1); }
+	memset(frames, 0, sizeof(frames));
+
+	// Photo-like gradient on the left, text-like checkerboard on the right
+	for (y = 0; y < SCALED_HEIGHT; ++y)
+	{
+		for (x = 0; x < SCALED_WIDTH * 3; ++x) { desktop[((long long)y * stride) + x] = x < 1500 ? (unsigned char)(((x / 3) * (y + 1)) % 251) : (unsigned char)((((x / 3) / 8 + y / 8) & 1) * 200); }
+	}
+
+	// Same layout as three monitors, one of them overlapping the others
+	reset_tile_info();
+	set_tile_owner(0, 0, 500, 300, 0);
+	set_tile_owner(500, 0, 500, 300, 1);
+	set_tile_owner(700, 100, 300, 200, 2);
+	COPY_RECT_ENABLED = 1;
+
+	for (i = 0; i < frameCount; ++i)
+	{
+		if (i > 0) { kvm_tile_test_mutate(i); }
+		if (i > 0 && (i % 500) == 0) { invalidate_tile_info(); }		// Same as a refresh request from the viewer
+		kvm_tile_test_frame(frames);
+	}
+	printf("%d frames: %ld false negatives, %ld false positives, %ld stale tiles, %ld copies, %ld pictures\n", frameCount, falseNegatives, falsePositives, stale, copies, pictures);
+
+	misses = kvm_tile_test_mutations(mutationCount);
+	printf("%d tile mutations: %ld unchanged hashes\n", mutationCount, misses);
+
+	for (i = 0; i < KVM_TILE_TEST_WORKERS; ++i) { if (frames[i].buffer != NULL) { free(frames[i].buffer); } }
+	free_tile_buffers();
+	free(desktop); free(viewer); free(previous);
+
+	if (falseNegatives != 0 || stale != 0 || misses != 0) { printf("FAILED\n"); return(1); }
+	printf("PASSED\n");
+	return(0);
+}
@@ -0,0 +1,206 @@
+/*
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+//
+// SCTP tests over a loopback WebRTC Data Channel
+//
+// Usage: meshagent webrtc-sctp-test.js --test=loss [--size=bytes] [--seed=n] [--loss=0,1,2,5,10] [--cc=reno,cubic]
+//        meshagent webrtc-sctp-test.js --test=latency [--size=bytes] [--count=n] [--interval=ms] [--priority=n]
+//
+// loss:    Transfer time for each congestion control algorithm, over a sweep of simulated loss rates. Requires an agent built with _WEBRTCDEBUG
+// latency: Small message round trip time, with and without a bulk transfer running on another Data Channel
+//
+var promise = require('promise');
+
+var options = { test: 'loss', seed: 1, loss: '0,1,2,5,10', cc: 'reno,cubic', count: 200, interval: 10, priority: 1 };
+for (var i = 1; i < process.argv.length; ++i)
+{
+    var tokens = process.argv[i].split('=');
+    if (tokens.length == 2 && tokens[0].startsWith('--')) { options[tokens[0].substring(2)] = tokens[1]; }
+}
+if (options.size == null) { options.size = options.test == 'latency' ? (32 * 1024 * 1024) : (8 * 1024 * 1024); }
+['size', 'seed', 'count', 'interval', 'priority'].forEach(function (k) { options[k] = parseInt(options[k]); });
+
+//
+// Connects two factories over loopback. setup(ret) is called before the offer is exchanged, to configure the factories
+// and hook up the connections. The test resolves or rejects ret, and the Data Channels are closed when it settles.
+//
+function createLoopback(setup)
+{
+    var ret = new promise(function (r, j) { this._res = r; this._rej = j; });
+    ret.serverFactory = require('ILibWebRTC').createNewFactory();
+    ret.clientFactory = require('ILibWebRTC').createNewFactory();
+    ret.serverConnection = null;
+    ret.clientConnection = null;
+
+    setup(ret);
+
+    ret.timeout = setTimeout(function () { ret._rej('Timeout'); }, 300000);
+    ret.finally(function ()
+    {
+        clearTimeout(ret.timeout);
+        if (ret.cleanup != null) { ret.cleanup(); }
+        ret.serverConnection.closeDataChannels();
+        ret.clientConnection.closeDataChannels();
+    });
+
+    var offer = ret.clientConnection.generateOffer();
+    var counter = ret.serverConnection.setOffer(offer);
+    ret.clientConnection.setOffer(counter);
+
+    return (ret);
+}
+
+function percentile(list, p)
+{
+    if (list.length == 0) { return (0); }
+    var idx = Math.ceil((p / 100) * list.length) - 1;
+    return (list[idx < 0 ? 0 : idx]);
+}
+
+function runTransfer(cc, loss)
+{
+    return (createLoopback(function (ret)
+    {
+        ret.received = 0;
+        ret.clientFactory.setCongestionControl(cc);
+        ret.serverFactory._setSimulatedLoss(loss, options.seed);
+
+        ret.serverConnection = ret.serverFactory.createConnection();
+        ret.clientConnection = ret.clientFactory.createConnection();
+        ret.clientConnection.on('dataChannel', function (rtcchannel)
+        {
+            ret.start = Date.now();
+            rtcchannel.write(Buffer.alloc(options.size));
+        });
+        ret.serverConnection.on('connected', function ()
+        {
+            this.dc = this.createDataChannel('Loss Test');
+            this.dc.on('data', function (b)
+            {
+                ret.received += b.length;
+                if (ret.received >= options.size) { ret._res(Date.now() - ret.start); }
+            });
+        });
+    }));
+}
+
+function runPings(bulk)
+{
+    return (createLoopback(function (ret)
+    {
+        ret.samples = [];
+        ret.serverConnection = ret.serverFactory.createConnection();
+        ret.clientConnection = ret.clientFactory.createConnection();
+        ret.clientConnection.on('dataChannel', function (rtcchannel)
+        {
+            if (rtcchannel.name == 'Bulk')
+            {
+                rtcchannel.on('data', function (b) { });
+            }
+            else
+            {
+                // Echo the pings back
+                rtcchannel.on('data', function (b) { this.write(b); });
+            }
+        });
+        ret.serverConnection.on('connected', function ()
+        {
+            ret.interleaved = this.interleaved;
+            this.ping = this.createDataChannel('Ping');
+            this.ping.priority = options.priority;
+            this.ping.sent = 0;
+            this.ping.on('data', function (b)
+            {
+                ret.samples.push(Date.now() - b.readUInt32BE(4) - (b.readUInt32BE(0) * 4294967296));
+                if (ret.samples.length >= options.count) { ret._res({ samples: ret.samples, interleaved: ret.interleaved }); }
+            });
+            this.ping.on('ack', function ()
+            {
+                var self = this;
+                this.timer = setInterval(function ()
+                {
+                    if (self.sent++ >= options.count) { clearInterval(self.timer); return; }
+                    var b = Buffer.alloc(64);
+                    var now = Date.now();
+                    b.writeUInt32BE(Math.floor(now / 4294967296), 0);
+                    b.writeUInt32BE(now % 4294967296, 4);
+                    self.write(b);
+                }, options.interval);
+            });
+            if (bulk)
+            {
+                this.bulk = this.createDataChannel('Bulk');
+                this.bulk.on('ack', function () { this.write(Buffer.alloc(options.size)); });
+            }
+        });
+        ret.cleanup = function () { if (ret.serverConnection.ping != null) { clearInterval(ret.serverConnection.ping.timer); } };
+    }));
+}
+
+var results = [];
+switch (options.test)
+{
+    case 'loss':
+        if (require('ILibWebRTC')._setSimulatedLoss == null)
+        {
+            console.log('This test requires an agent built with _WEBRTCDEBUG');
+            process.exit();
+        }
+        console.log('SCTP Loss Sweep: ' + options.size + ' bytes, seed = ' + options.seed);
+        options.cc.split(',').forEach(function (cc)
+        {
+            options.loss.split(',').map(function (v) { return (parseInt(v)); }).forEach(function (loss)
+            {
+                try
+                {
+                    var ms = promise.wait(runTransfer(cc, loss));
+                    var mbps = ((options.size * 8) / (ms / 1000)) / 1000000;
+                    results.push({ cc: cc, loss: loss, ms: ms, mbps: mbps.toFixed(2) });
+                    console.log('   => [' + cc + '] loss ' + loss + '%: ' + ms + ' ms, ' + mbps.toFixed(2) + ' Mbps');
+                }
+                catch (e)
+                {
+                    results.push({ cc: cc, loss: loss, error: e.toString() });
+                    console.log('   => [' + cc + '] loss ' + loss + '%: ' + e);
+                }
+            });
+        });
+        break;
+    case 'latency':
+        console.log('SCTP Small Message Latency: ' + options.count + ' pings every ' + options.interval + ' ms, bulk = ' + options.size + ' bytes, priority = ' + options.priority);
+        [false, true].forEach(function (bulk)
+        {
+            try
+            {
+                var v = promise.wait(runPings(bulk));
+                var samples = v.samples.sort(function (a, b) { return (a - b); });
+                var r = { bulk: bulk, interleaved: v.interleaved, p50: percentile(samples, 50), p90: percentile(samples, 90), p99: percentile(samples, 99), max: samples[samples.length - 1] };
+                results.push(r);
+                console.log('   => ' + (bulk ? 'With' : 'Without') + ' bulk transfer' + (r.interleaved ? ' (I-DATA)' : ' (DATA)') + ': p50 = ' + r.p50 + ' ms, p90 = ' + r.p90 + ' ms, p99 = ' + r.p99 + ' ms, max = ' + r.max + ' ms');
+            }
+            catch (e)
+            {
+                results.push({ bulk: bulk, error: e.toString() });
+                console.log('   => ' + (bulk ? 'With' : 'Without') + ' bulk transfer: ' + e);
+            }
+        });
+        break;
+    default:
+        console.log('Unknown test: ' + options.test + ', must be loss or latency');
+        process.exit();
+        break;
+}
+console.log(JSON.stringify(results, null, 1));
+process.exit();